@@ -6,7 +6,6 @@
 
 #include <AK/Base64.h>
 #include <AK/Types.h>
-#include <AK/Vector.h>
 
 #include <simdutf.h>
 
@@ -83,16 +82,15 @@ static ErrorOr<ByteBuffer> decode_base64_impl(StringView input, LastChunkHandlin
 
 static ErrorOr<String> encode_base64_impl(StringView input, simdutf::base64_options options)
 {
-    Vector<u8> output;
-    TRY(output.try_resize(simdutf::base64_length_from_binary(input.length(), options)));
-
-    simdutf::binary_to_base64(
-        input.characters_without_null_termination(),
-        input.length(),
-        reinterpret_cast<char*>(output.data()),
-        options);
-
-    return String::from_utf8_without_validation(output);
+    // OPTIMIZATION: Encode straight into the string's own buffer, rather than into a temporary one that would then have
+    //               to be copied. Base64 only ever produces ASCII, so there is no need to validate it either.
+    return String::create_and_overwrite_without_validation(simdutf::base64_length_from_binary(input.length(), options), [&](Bytes output) {
+        simdutf::binary_to_base64(
+            input.characters_without_null_termination(),
+            input.length(),
+            reinterpret_cast<char*>(output.data()),
+            options);
+    });
 }
 
 ErrorOr<ByteBuffer> decode_base64(StringView input, LastChunkHandling last_chunk_handling)
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/HashTable.h>
 #include <AK/Singleton.h>
@@ -19,10 +21,66 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
     static bool equals(Detail::StringData const* a, Detail::StringData const* b) { return *a == *b; }
 };
 
-static auto& all_fly_strings()
+// NOTE: The fly string table is split into shards that are picked by the string's hash, each with its own lock, so that
+//       threads interning different strings rarely have to wait on each other.
+class FlyStringTableShard {
+public:
+    class Locker {
+        AK_MAKE_NONCOPYABLE(Locker);
+        AK_MAKE_NONMOVABLE(Locker);
+
+    public:
+        explicit Locker(FlyStringTableShard& shard)
+            : m_shard(shard)
+        {
+            while (m_shard.m_locked.exchange(true, AK::memory_order_acquire)) {
+                while (m_shard.m_locked.load(AK::memory_order_relaxed))
+                    AK::atomic_pause();
+            }
+        }
+
+        ~Locker()
+        {
+            m_shard.m_locked.store(false, AK::memory_order_release);
+        }
+
+    private:
+        FlyStringTableShard& m_shard;
+    };
+
+    HashTable<Detail::StringData const*, FlyStringTableHashTraits>& table() { return m_table; }
+
+private:
+    Atomic<bool> m_locked { false };
+    HashTable<Detail::StringData const*, FlyStringTableHashTraits> m_table;
+};
+
+static constexpr size_t fly_string_table_shard_bits = 5;
+static constexpr size_t fly_string_table_shard_count = 1 << fly_string_table_shard_bits;
+
+static auto& all_fly_string_table_shards()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
-    return *table;
+    static Singleton<Array<FlyStringTableShard, fly_string_table_shard_count>> shards;
+    return *shards;
+}
+
+static FlyStringTableShard& fly_string_table_shard_for_hash(u32 hash)
+{
+    // NOTE: The low bits of the hash pick the bucket inside a shard's table, so use the high bits to pick the shard.
+    return all_fly_string_table_shards()[hash >> (32 - fly_string_table_shard_bits)];
+}
+
+static RefPtr<Detail::StringData const> find_fly_string_data(StringView string)
+{
+    auto hash = string.hash();
+    auto& shard = fly_string_table_shard_for_hash(hash);
+    FlyStringTableShard::Locker locker(shard);
+
+    auto it = shard.table().find(hash, [&](auto& entry) { return entry->bytes_as_string_view() == string; });
+    if (it == shard.table().end())
+        return {};
+    // NOTE: The reference must be taken while the shard is locked, so the string can't be destroyed in the meantime.
+    return *it;
 }
 
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
@@ -31,8 +89,8 @@ ErrorOr<FlyString> FlyString::from_utf8(StringView string)
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto existing = find_fly_string_data(string))
+        return FlyString { Detail::StringBase(existing.release_nonnull()) };
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -42,8 +100,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto existing = find_fly_string_data(string))
+        return FlyString { Detail::StringBase(existing.release_nonnull()) };
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -61,11 +119,14 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_impl.data);
-    if (it == all_fly_strings().end()) {
-        m_data = string;
-        all_fly_strings().set(string.m_impl.data);
+    auto& shard = fly_string_table_shard_for_hash(string.m_impl.data->hash());
+    FlyStringTableShard::Locker locker(shard);
+
+    auto it = shard.table().find(string.m_impl.data);
+    if (it == shard.table().end()) {
         string.m_impl.data->set_fly_string(true);
+        m_data = string;
+        shard.table().set(string.m_impl.data);
     } else {
         m_data.m_impl.data = *it;
         m_data.m_impl.data->ref();
@@ -116,7 +177,12 @@ Detail::StringBase FlyString::data(Badge<String>) const
 
 size_t FlyString::number_of_fly_strings()
 {
-    return all_fly_strings().size();
+    size_t count = 0;
+    for (auto& shard : all_fly_string_table_shards()) {
+        FlyStringTableShard::Locker locker(shard);
+        count += shard.table().size();
+    }
+    return count;
 }
 
 unsigned Traits<FlyString>::hash(FlyString const& fly_string)
@@ -206,9 +272,19 @@ bool FlyString::ends_with_bytes(StringView bytes, CaseSensitivity case_sensitivi
 
 namespace Detail {
 
-void did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
+bool did_release_possibly_last_fly_string_reference(Badge<StringData>, StringData const& string_data)
 {
-    all_fly_strings().remove(&string_data);
+    auto& shard = fly_string_table_shard_for_hash(string_data.hash());
+    {
+        FlyStringTableShard::Locker locker(shard);
+        if (AK::atomic_fetch_sub(&string_data.m_ref_count, 1u, AK::memory_order_acq_rel) != 1)
+            return false;
+        shard.table().remove(&string_data);
+    }
+
+    // NOTE: Nothing can find the string anymore, so it can be destroyed without holding the lock.
+    delete &string_data;
+    return true;
 }
 
 }
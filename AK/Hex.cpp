@@ -6,9 +6,7 @@
  */
 
 #include <AK/Hex.h>
-#include <AK/StringBuilder.h>
 #include <AK/Types.h>
-#include <AK/Vector.h>
 
 namespace AK {
 
@@ -17,18 +15,18 @@ ErrorOr<ByteBuffer> decode_hex(StringView input)
     if ((input.length() % 2) != 0)
         return Error::from_string_literal("Hex string was not an even length");
 
-    auto output = TRY(ByteBuffer::create_zeroed(input.length() / 2));
+    auto output = TRY(ByteBuffer::create_uninitialized(input.length() / 2));
+    auto const* characters = input.characters_without_null_termination();
 
-    for (size_t i = 0; i < input.length() / 2; ++i) {
-        auto const c1 = decode_hex_digit(input[i * 2]);
-        if (c1 >= 16)
-            return Error::from_string_literal("Hex string contains invalid digit");
+    for (size_t i = 0; i < output.size(); ++i) {
+        auto const c1 = decode_hex_digit(characters[i * 2]);
+        auto const c2 = decode_hex_digit(characters[i * 2 + 1]);
 
-        auto const c2 = decode_hex_digit(input[i * 2 + 1]);
-        if (c2 >= 16)
+        // NOTE: An invalid digit decodes to 255, so checking both at once only takes a single branch.
+        if ((c1 | c2) >= 16)
             return Error::from_string_literal("Hex string contains invalid digit");
 
-        output[i] = (c1 << 4) + c2;
+        output[i] = (c1 << 4) | c2;
     }
 
     return { move(output) };
@@ -36,12 +34,19 @@ ErrorOr<ByteBuffer> decode_hex(StringView input)
 
 ByteString encode_hex(ReadonlyBytes const input)
 {
-    StringBuilder output(input.size() * 2);
-
-    for (auto ch : input)
-        output.appendff("{:02x}", ch);
-
-    return output.to_byte_string();
+    static constexpr auto hex_digits = "0123456789abcdef"sv;
+
+    if (input.is_empty())
+        return ByteString::empty();
+
+    // OPTIMIZATION: This is used on large buffers (e.g. to hash or to log them), so rather than formatting each byte
+    //               separately, the digits are written straight into the string.
+    return ByteString::create_and_overwrite(input.size() * 2, [&](Bytes output) {
+        for (size_t i = 0; i < input.size(); ++i) {
+            output[i * 2] = hex_digits[input[i] >> 4];
+            output[i * 2 + 1] = hex_digits[input[i] & 0xf];
+        }
+    });
 }
 
 }
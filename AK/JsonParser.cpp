@@ -5,9 +5,12 @@
  */
 
 #include <AK/CharacterTypes.h>
+#include <AK/Checked.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringConversions.h>
 #include <math.h>
 
@@ -24,6 +27,35 @@ ErrorOr<JsonValue> JsonParser::parse(StringView input)
     return parser.parse_json();
 }
 
+// Returns the number of bytes from the current position up to the next quotation mark, reverse solidus or control
+// character (which includes the 0 byte we get at EOF).
+size_t JsonParser::length_of_literal_string_run() const
+{
+    auto const* characters = reinterpret_cast<u8 const*>(m_input.characters_without_null_termination());
+    auto end = m_input.length();
+    auto index = m_index;
+
+    // OPTIMIZATION: Look at sixteen bytes at a time until one of them ends the run. UTF-8 sequences only consist of
+    //               bytes with their most significant bit set, so they never end a run and need no special handling.
+    using AK::SIMD::u8x16;
+    auto quotation_marks = u8x16 {} + static_cast<u8>('"');
+    auto reverse_solidi = u8x16 {} + static_cast<u8>('\\');
+    auto spaces = u8x16 {} + static_cast<u8>(' ');
+    for (; index + 16 <= end; index += 16) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(characters + index);
+        auto matches = bit_cast<AK::SIMD::u64x2>((chunk == quotation_marks) | (chunk == reverse_solidi) | (chunk < spaces));
+        if ((matches[0] | matches[1]) != 0)
+            break;
+    }
+
+    for (; index < end; ++index) {
+        auto ch = characters[index];
+        if (ch == '"' || ch == '\\' || ch < ' ')
+            break;
+    }
+    return index - m_index;
+}
+
 // ECMA-404 9 String
 // Boils down to
 // STRING = "\"" *("[^\"\\]" | "\\" ("[\"\\bfnrt]" | "u[0-9A-Za-z]{4}")) "\""
@@ -37,42 +69,36 @@ ErrorOr<JsonValue> JsonParser::parse(StringView input)
 //                             │                       │
 //                             ╰─── u[0-9A-Za-z]{4}  ──╯
 //
-ErrorOr<ByteString> JsonParser::consume_and_unescape_string()
+ErrorOr<String> JsonParser::consume_and_unescape_string()
 {
     if (!consume_specific('"'))
         return Error::from_string_literal("JsonParser: Expected '\"'");
+
+    // OPTIMIZATION: Strings without any escape sequences can be taken straight from the input.
+    auto literal_characters = length_of_literal_string_run();
+    if (peek(literal_characters) == '"') {
+        auto literal = consume(literal_characters);
+        ignore();
+        return String::from_utf8(literal);
+    }
+
     StringBuilder final_sb;
 
     for (;;) {
-        // OPTIMIZATION: We try to append as many literal characters as possible at a time
-        //               This also pre-checks some error conditions
-        // Note: All utf8 characters are either plain ascii,  or have their most signifiant bit set,
-        //       which puts the, above plain ascii in value, so they will always consist
-        //       of a set of "legal" non-special bytes,
-        //       hence we don't need to bother with a code-point iterator,
-        //       as a simple byte iterator suffices, which GenericLexer provides by default
-        size_t literal_characters = 0;
-        for (;;) {
-            char ch = peek(literal_characters);
-            // Note: We get a 0 byte when we hit EOF
-            if (ch == 0)
-                return Error::from_string_literal("JsonParser: EOF while parsing String");
-            // Spec: All code points may be placed within the quotation marks except
-            //       for the code points that must be escaped: quotation mark (U+0022),
-            //       reverse solidus (U+005C), and the control characters U+0000 to U+001F.
-            //       There are two-character escape sequence representations of some characters.
-            if (is_ascii_c0_control(ch))
-                return Error::from_string_literal("JsonParser: ASCII control sequence encountered");
-            if (ch == '"' || ch == '\\')
-                break;
-            ++literal_characters;
-        }
+        // Spec: All code points may be placed within the quotation marks except
+        //       for the code points that must be escaped: quotation mark (U+0022),
+        //       reverse solidus (U+005C), and the control characters U+0000 to U+001F.
+        //       There are two-character escape sequence representations of some characters.
+        char ch = peek(literal_characters);
+        // Note: We get a 0 byte when we hit EOF
+        if (ch == 0)
+            return Error::from_string_literal("JsonParser: EOF while parsing String");
+        if (is_ascii_c0_control(ch))
+            return Error::from_string_literal("JsonParser: ASCII control sequence encountered");
         final_sb.append(consume(literal_characters));
 
-        // We have checked all cases except end-of-string and escaped characters in the loop above,
+        // We have checked all cases except end-of-string and escaped characters above,
         // so we now only have to handle those two cases
-        char ch = peek();
-
         if (ch == '"') {
             consume();
             break;
@@ -130,9 +156,11 @@ ErrorOr<ByteString> JsonParser::consume_and_unescape_string()
             dbgln("JsonParser: Invalid escaped character '{}' ({:#x}) ", peek(), peek());
             return Error::from_string_literal("JsonParser: Invalid escaped character");
         }
+
+        literal_characters = length_of_literal_string_run();
     }
 
-    return final_sb.to_byte_string();
+    return final_sb.to_string();
 }
 
 ErrorOr<JsonValue> JsonParser::parse_object()
@@ -200,13 +228,10 @@ ErrorOr<JsonValue> JsonParser::parse_string()
 
 ErrorOr<JsonValue> JsonParser::parse_number()
 {
-    Vector<char, 32> number_buffer;
-
     auto start_index = tell();
 
     bool negative = false;
     if (peek() == '-') {
-        number_buffer.append('-');
         ++m_index;
         negative = true;
 
@@ -238,7 +263,9 @@ ErrorOr<JsonValue> JsonParser::parse_number()
         // start with a '.' or 'e'.
     }
 
-    bool all_zero = true;
+    // OPTIMIZATION: Integers are accumulated as we go, rather than being collected and then parsed separately. On
+    //               overflow, we leave it to the floating point parser.
+    Checked<u64> magnitude = 0;
     for (;;) {
         char ch = peek();
         if (ch == '.') {
@@ -256,10 +283,8 @@ ErrorOr<JsonValue> JsonParser::parse_number()
         }
 
         if (is_ascii_digit(ch)) {
-            if (ch != '0')
-                all_zero = false;
-
-            number_buffer.append(ch);
+            magnitude.mul(10);
+            magnitude.add(parse_ascii_digit(ch));
             ++m_index;
             continue;
         }
@@ -267,18 +292,20 @@ ErrorOr<JsonValue> JsonParser::parse_number()
         break;
     }
 
+    // It's possible the value doesn't fit in 64 bits
+    if (magnitude.has_overflow())
+        return fallback_to_double_parse();
+
+    if (!negative)
+        return JsonValue(magnitude.value());
+
     // Negative zero is always a double
-    if (negative && all_zero)
+    if (magnitude.value() == 0)
         return JsonValue(-0.0);
 
-    StringView number_string(number_buffer.data(), number_buffer.size());
-
-    if (auto number = number_string.to_number<u64>(); number.has_value())
-        return JsonValue(*number);
-    if (auto number = number_string.to_number<i64>(); number.has_value())
-        return JsonValue(*number);
+    if (magnitude.value() <= static_cast<u64>(NumericLimits<i64>::max()) + 1)
+        return JsonValue(static_cast<i64>(0 - magnitude.value()));
 
-    // It's possible the unsigned value is bigger than u64 max
     return fallback_to_double_parse();
 }
 
@@ -24,7 +24,8 @@ private:
     ErrorOr<JsonValue> parse_json();
     ErrorOr<JsonValue> parse_helper();
 
-    ErrorOr<ByteString> consume_and_unescape_string();
+    size_t length_of_literal_string_run() const;
+    ErrorOr<String> consume_and_unescape_string();
     ErrorOr<JsonValue> parse_array();
     ErrorOr<JsonValue> parse_object();
     ErrorOr<JsonValue> parse_number();
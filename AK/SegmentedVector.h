@@ -50,6 +50,9 @@ public:
     ALWAYS_INLINE VisibleType const& operator[](size_t i) const { return at(i); }
     ALWAYS_INLINE VisibleType& operator[](size_t i) { return at(i); }
 
+    ALWAYS_INLINE VisibleType const& last() const { return at(m_size - 1); }
+    ALWAYS_INLINE VisibleType& last() { return at(m_size - 1); }
+
     void append(T&& value)
     {
         if (m_segments.is_empty() || m_segments.last()->size() >= segment_size)
@@ -63,6 +66,16 @@ public:
         ++m_size;
     }
 
+    T take_last()
+    {
+        VERIFY(m_size > 0);
+        auto value = m_segments.last()->take_last();
+        if (m_segments.last()->is_empty())
+            (void)m_segments.take_last();
+        --m_size;
+        return value;
+    }
+
 private:
     Vector<NonnullOwnPtr<Vector<T, segment_size>>> m_segments;
     size_t m_size { 0 };
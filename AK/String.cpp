@@ -78,7 +78,7 @@ ErrorOr<String> String::from_utf16_le_with_replacement_character(ReadonlyBytes b
     Vector<char16_t> well_formed_utf16;
 
     if (!validate_utf16_le(bytes)) {
-        well_formed_utf16.resize(bytes.size());
+        well_formed_utf16.resize(utf16_length);
 
         simdutf::to_well_formed_utf16le(utf16_data, utf16_length, well_formed_utf16.data());
         utf16_data = well_formed_utf16.data();
@@ -106,8 +106,8 @@ ErrorOr<String> String::from_utf16_be_with_replacement_character(ReadonlyBytes b
 
     Vector<char16_t> well_formed_utf16;
 
-    if (!validate_utf16_le(bytes)) {
-        well_formed_utf16.resize(bytes.size());
+    if (!validate_utf16_be(bytes)) {
+        well_formed_utf16.resize(utf16_length);
 
         simdutf::to_well_formed_utf16be(utf16_data, utf16_length, well_formed_utf16.data());
         utf16_data = well_formed_utf16.data();
@@ -125,6 +125,24 @@ ErrorOr<String> String::from_utf16_be_with_replacement_character(ReadonlyBytes b
     return result;
 }
 
+ErrorOr<String> String::from_latin1(ReadonlyBytes bytes)
+{
+    if (bytes.is_empty())
+        return String {};
+
+    auto const* latin1_data = reinterpret_cast<char const*>(bytes.data());
+    auto utf8_length = simdutf::utf8_length_from_latin1(latin1_data, bytes.size());
+
+    String result;
+    TRY(result.replace_with_new_string(utf8_length, [&](Bytes buffer) -> ErrorOr<void> {
+        [[maybe_unused]] auto result = simdutf::convert_latin1_to_utf8(latin1_data, bytes.size(), reinterpret_cast<char*>(buffer.data()));
+        ASSERT(result == buffer.size());
+        return {};
+    }));
+
+    return result;
+}
+
 ErrorOr<String> String::from_stream(Stream& stream, size_t byte_count)
 {
     String result;
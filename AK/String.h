@@ -65,6 +65,18 @@ public:
 
     [[nodiscard]] static String from_utf8_without_validation(ReadonlyBytes);
 
+    // Creates a new String of byte_count bytes, which are written by the callback. The callback must write valid UTF-8.
+    template<typename Func>
+    static ErrorOr<String> create_and_overwrite_without_validation(size_t byte_count, Func&& fill_function)
+    {
+        String result;
+        TRY(result.replace_with_new_string(byte_count, [&](Bytes buffer) -> ErrorOr<void> {
+            fill_function(buffer);
+            return {};
+        }));
+        return result;
+    }
+
     static ErrorOr<String> from_string_builder(Badge<StringBuilder>, StringBuilder&);
     [[nodiscard]] static String from_string_builder_without_validation(Badge<StringBuilder>, StringBuilder&);
 
@@ -72,6 +84,9 @@ public:
     static ErrorOr<String> from_utf16_le_with_replacement_character(ReadonlyBytes);
     static ErrorOr<String> from_utf16_be_with_replacement_character(ReadonlyBytes);
 
+    // Creates a new String from a sequence of Latin-1 (ISO-8859-1) encoded bytes, i.e. the bytes are the code points.
+    static ErrorOr<String> from_latin1(ReadonlyBytes);
+
     // Creates a new String by reading byte_count bytes from a UTF-8 encoded Stream.
     static ErrorOr<String> from_stream(Stream&, size_t byte_count);
 
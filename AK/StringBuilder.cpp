@@ -98,6 +98,20 @@ inline ErrorOr<void> StringBuilder::will_append(size_t size_in_bytes)
     return {};
 }
 
+ErrorOr<void> StringBuilder::try_ensure_capacity(size_t capacity_in_code_units)
+{
+    Checked<size_t> needed_capacity = capacity_in_code_units;
+    needed_capacity *= m_mode == Mode::UTF8 ? 1 : 2;
+    needed_capacity += string_builder_prefix_size(m_mode);
+    VERIFY(!needed_capacity.has_overflow());
+    return m_buffer.try_ensure_capacity(needed_capacity.value());
+}
+
+void StringBuilder::ensure_capacity(size_t capacity_in_code_units)
+{
+    MUST(try_ensure_capacity(capacity_in_code_units));
+}
+
 size_t StringBuilder::length() const
 {
     return m_buffer.size() - string_builder_prefix_size(m_mode);
@@ -127,12 +141,23 @@ ErrorOr<void> StringBuilder::try_append(StringView string)
         TRY(will_append(string.length()));
         TRY(m_buffer.try_append(string.characters_without_null_termination(), string.length()));
         break;
-    case StringBuilder::Mode::UTF16:
+    case StringBuilder::Mode::UTF16: {
+        // NOTE: Each UTF-8 code unit turns into at most one UTF-16 code unit.
         TRY(will_append(string.length() * 2));
+
+        // Fast path.
+        auto* uninitialized_data_pointer = static_cast<char16_t*>(m_buffer.end_pointer());
+        if (auto code_units_written = simdutf::convert_utf8_to_utf16(string.characters_without_null_termination(), string.length(), uninitialized_data_pointer); code_units_written != 0) {
+            m_buffer.set_size(m_buffer.size() + code_units_written * 2);
+            break;
+        }
+
+        // Slow path. The string isn't valid UTF-8, so we let Utf8View decide how to replace the invalid sequences.
         for (auto code_point : Utf8View { string })
             TRY(try_append_code_point(code_point));
         break;
     }
+    }
 
     return {};
 }
@@ -381,11 +406,10 @@ ErrorOr<void> StringBuilder::try_append(Utf16View const& utf16_view)
         return try_append(utf16_view.bytes());
 
     if (m_mode == Mode::UTF16) {
-        TRY(will_append(utf16_view.length_in_code_units() * 2));
-
-        for (size_t i = 0; i < utf16_view.length_in_code_units(); ++i)
-            TRY(try_append_code_unit(utf16_view.code_unit_at(i)));
-
+        // NOTE: Unpaired surrogates are kept as they are, so the code units can be copied over wholesale.
+        auto code_units = utf16_view.utf16_span();
+        TRY(will_append(code_units.size() * sizeof(char16_t)));
+        TRY(m_buffer.try_append(code_units.data(), code_units.size() * sizeof(char16_t)));
         return {};
     }
 
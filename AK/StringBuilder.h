@@ -91,6 +91,11 @@ public:
     [[nodiscard]] Utf16View utf16_string_view() const;
     void clear();
 
+    // Makes room for a string of the given length in total, for callers that know (or can cheaply estimate) how long
+    // the string they're building will end up being. This avoids reallocating and copying the buffer as it grows.
+    ErrorOr<void> try_ensure_capacity(size_t capacity_in_code_units);
+    void ensure_capacity(size_t capacity_in_code_units);
+
     [[nodiscard]] size_t length() const;
     [[nodiscard]] bool is_empty() const;
     void trim(size_t count);
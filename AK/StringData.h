@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
@@ -17,7 +18,7 @@ static constexpr size_t MAX_SHORT_STRING_BYTE_COUNT = sizeof(StringData*) - size
 
 class StringData;
 
-void did_destroy_fly_string_data(Badge<StringData>, StringData const&);
+bool did_release_possibly_last_fly_string_reference(Badge<StringData>, StringData const&);
 
 class StringData final : public RefCounted<StringData> {
 public:
@@ -73,8 +74,36 @@ public:
     {
         if (m_substring)
             substring_data().superstring->unref();
-        if (m_is_fly_string)
-            Detail::did_destroy_fly_string_data({}, *this);
+    }
+
+    // NOTE: Fly strings are shared between every thread that interns the same string, so their reference count has to
+    //       be updated atomically. All other strings belong to a single thread and keep using the plain counter.
+    ALWAYS_INLINE void ref() const
+    {
+        if (!m_is_fly_string) {
+            RefCounted::ref();
+            return;
+        }
+        auto old_ref_count = AK::atomic_fetch_add(&m_ref_count, 1u, AK::memory_order_relaxed);
+        VERIFY(old_ref_count > 0);
+        VERIFY(!Checked<RefCountType>::addition_would_overflow(old_ref_count, 1));
+    }
+
+    ALWAYS_INLINE bool unref() const
+    {
+        if (!m_is_fly_string)
+            return RefCounted::unref();
+
+        // Dropping a reference that isn't the last one doesn't involve the fly string table.
+        auto ref_count = AK::atomic_load(&m_ref_count, AK::memory_order_relaxed);
+        while (ref_count > 1) {
+            if (AK::atomic_compare_exchange_strong(&m_ref_count, ref_count, ref_count - 1, AK::memory_order_acq_rel))
+                return false;
+        }
+
+        // NOTE: Another thread may look this string up in the fly string table and take a new reference to it before we
+        //       get to remove it, so the last reference has to be dropped while holding the table's lock.
+        return Detail::did_release_possibly_last_fly_string_reference({}, *this);
     }
 
     SubstringData const& substring_data() const
@@ -107,11 +136,16 @@ public:
     }
 
     bool is_fly_string() const { return m_is_fly_string; }
+
+    // NOTE: This must only be called while the string is still private to the calling thread, right before it is
+    //       published in the fly string table.
     void set_fly_string(bool is_fly_string) const { m_is_fly_string = is_fly_string; }
 
     size_t byte_count() const { return m_byte_count; }
 
 private:
+    friend bool did_release_possibly_last_fly_string_reference(Badge<StringData>, StringData const&);
+
     static constexpr size_t allocation_size_for_string_data(size_t length)
     {
         return sizeof(StringData) + (sizeof(char) * length);
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Brotli.h>
+
+#include <brotli/decode.h>
+
+namespace Compress {
+
+ErrorOr<NonnullOwnPtr<BrotliDecompressor>> BrotliDecompressor::create(MaybeOwned<Stream> stream)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
+
+    auto* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+    if (!state)
+        return Error::from_errno(ENOMEM);
+
+    auto decompressor = adopt_own_if_nonnull(new (nothrow) BrotliDecompressor(move(buffer), move(stream), state));
+    if (!decompressor) {
+        BrotliDecoderDestroyInstance(state);
+        return Error::from_errno(ENOMEM);
+    }
+    return decompressor.release_nonnull();
+}
+
+ErrorOr<ByteBuffer> BrotliDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    auto input_stream = make<AK::FixedMemoryStream>(bytes);
+    auto decompressor = TRY(BrotliDecompressor::create(MaybeOwned<Stream>(move(input_stream))));
+    return TRY(decompressor->read_until_eof(4096));
+}
+
+BrotliDecompressor::BrotliDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, BrotliDecoderState* state)
+    : m_stream(move(stream))
+    , m_state(state)
+    , m_buffer(move(buffer))
+{
+}
+
+BrotliDecompressor::~BrotliDecompressor()
+{
+    BrotliDecoderDestroyInstance(m_state);
+}
+
+ErrorOr<DecompressResult> BrotliDecompressor::decompress_some(ReadonlyBytes input, Bytes output)
+{
+    if (m_eof) {
+        if (!input.is_empty())
+            return Error::from_string_literal("Unexpected data after the end of the Brotli stream");
+        return DecompressResult {};
+    }
+
+    auto available_input = input.size();
+    auto const* next_input = input.data();
+    auto available_output = output.size();
+    auto* next_output = output.data();
+
+    auto result = BrotliDecoderDecompressStream(m_state, &available_input, &next_input, &available_output, &next_output, nullptr);
+    if (result == BROTLI_DECODER_RESULT_ERROR) {
+        // NOTE: The error strings are static, so they outlive the error.
+        auto const* message = BrotliDecoderErrorString(BrotliDecoderGetErrorCode(m_state));
+        return Error::from_string_view(StringView { message, strlen(message) });
+    }
+
+    if (result == BROTLI_DECODER_RESULT_SUCCESS) {
+        m_eof = true;
+        if (available_input != 0)
+            return Error::from_string_literal("Unexpected data after the end of the Brotli stream");
+    }
+
+    return DecompressResult {
+        .input_bytes_consumed = input.size() - available_input,
+        .output_bytes_produced = output.size() - available_output,
+    };
+}
+
+ErrorOr<Bytes> BrotliDecompressor::read_some(Bytes bytes)
+{
+    if (m_buffered_input.is_empty())
+        m_buffered_input = TRY(m_stream->read_some(m_buffer.span()));
+
+    auto result = TRY(decompress_some(m_buffered_input, bytes));
+    m_buffered_input = m_buffered_input.slice(result.input_bytes_consumed);
+
+    // No progress was possible, and there is no more input to come that could change that.
+    if (!m_eof && result.output_bytes_produced == 0 && m_buffered_input.is_empty() && m_stream->is_eof())
+        return Error::from_string_literal("No decompression progress on EOF stream");
+
+    return bytes.trim(result.output_bytes_produced);
+}
+
+ErrorOr<size_t> BrotliDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool BrotliDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool BrotliDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void BrotliDecompressor::close()
+{
+}
+
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Compress {
+
+// What a decompressor did with the input and output it was handed by decompress_some().
+struct DecompressResult {
+    size_t input_bytes_consumed { 0 };
+    size_t output_bytes_produced { 0 };
+};
+
+}
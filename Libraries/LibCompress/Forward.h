@@ -8,11 +8,13 @@
 
 namespace Compress {
 
+class BrotliDecompressor;
 class DeflateCompressor;
 class DeflateDecompressor;
 class GzipCompressor;
 class GzipDecompressor;
 class ZlibCompressor;
 class ZlibDecompressor;
+class ZstdDecompressor;
 
 }
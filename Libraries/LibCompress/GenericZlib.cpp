@@ -97,6 +97,39 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
     return bytes.slice(0, bytes.size() - m_zstream->avail_out);
 }
 
+ErrorOr<DecompressResult> GenericZlibDecompressor::decompress_some(ReadonlyBytes input, Bytes output)
+{
+    VERIFY(m_zstream->avail_in == 0);
+
+    m_zstream->avail_in = input.size();
+    m_zstream->next_in = const_cast<u8*>(input.data());
+    m_zstream->avail_out = output.size();
+    m_zstream->next_out = output.data();
+
+    auto ret = inflate(m_zstream, Z_NO_FLUSH);
+
+    DecompressResult result {
+        .input_bytes_consumed = input.size() - m_zstream->avail_in,
+        .output_bytes_produced = output.size() - m_zstream->avail_out,
+    };
+
+    // NOTE: We don't own the input, so zlib must not be left pointing into it.
+    m_zstream->avail_in = 0;
+    m_zstream->next_in = nullptr;
+
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+        return handle_zlib_error(ret);
+
+    if (ret == Z_STREAM_END) {
+        inflateReset(m_zstream);
+        m_eof = result.input_bytes_consumed == input.size();
+    } else if (result.input_bytes_consumed != 0) {
+        m_eof = false;
+    }
+
+    return result;
+}
+
 ErrorOr<size_t> GenericZlibDecompressor::write_some(ReadonlyBytes)
 {
     return Error::from_errno(EBADF);
@@ -225,4 +258,26 @@ ErrorOr<void> GenericZlibCompressor::finish()
     }
 }
 
+ErrorOr<void> GenericZlibCompressor::sync_flush()
+{
+    VERIFY(m_zstream->avail_in == 0);
+
+    // If the parameter flush is set to Z_SYNC_FLUSH, all pending output is flushed to the output buffer and the output is
+    // aligned on a byte boundary. If deflate returns with avail_out == 0, this function must be called again with the
+    // same value of the flush parameter and more output space, until the flush is complete.
+    do {
+        m_zstream->avail_out = m_buffer.size();
+        m_zstream->next_out = m_buffer.data();
+
+        auto ret = deflate(m_zstream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        auto have = m_buffer.size() - m_zstream->avail_out;
+        TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, have)));
+    } while (m_zstream->avail_out == 0);
+
+    return {};
+}
+
 }
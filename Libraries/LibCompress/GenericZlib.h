@@ -11,6 +11,7 @@
 #include <AK/MaybeOwned.h>
 #include <AK/MemoryStream.h>
 #include <AK/Stream.h>
+#include <LibCompress/DecompressResult.h>
 
 extern "C" {
 typedef struct z_stream_s z_stream;
@@ -36,6 +37,11 @@ public:
     virtual bool is_open() const override;
     virtual void close() override;
 
+    // Decompresses as much of the given input as fits into the given output, without going through the stream this
+    // decompressor reads from. Whatever input was not consumed has to be passed in again, along with more room for
+    // output. This must not be mixed with reading from the stream.
+    ErrorOr<DecompressResult> decompress_some(ReadonlyBytes input, Bytes output);
+
 protected:
     GenericZlibDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
 
@@ -63,6 +69,10 @@ public:
     virtual void close() override;
     ErrorOr<void> finish();
 
+    // Writes out all pending output, aligned to a byte boundary, without ending the stream. Compression can then carry
+    // on, still referring back to the data written so far.
+    ErrorOr<void> sync_flush();
+
 protected:
     GenericZlibCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
 
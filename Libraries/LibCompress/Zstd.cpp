@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Zstd.h>
+
+#include <zstd.h>
+
+namespace Compress {
+
+// NOTE: Frames can ask for a window of up to several gigabytes, which we would have to allocate up front. Like other
+//       decoders of untrusted data, we only accept windows of up to 8 MiB, as recommended by RFC 8878.
+static constexpr int maximum_window_log = 23;
+
+ErrorOr<NonnullOwnPtr<ZstdDecompressor>> ZstdDecompressor::create(MaybeOwned<Stream> stream)
+{
+    auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
+
+    auto* context = ZSTD_createDCtx();
+    if (!context)
+        return Error::from_errno(ENOMEM);
+
+    if (auto result = ZSTD_DCtx_setParameter(context, ZSTD_d_windowLogMax, maximum_window_log); ZSTD_isError(result)) {
+        ZSTD_freeDCtx(context);
+        auto const* message = ZSTD_getErrorName(result);
+        return Error::from_string_view(StringView { message, strlen(message) });
+    }
+
+    auto decompressor = adopt_own_if_nonnull(new (nothrow) ZstdDecompressor(move(buffer), move(stream), context));
+    if (!decompressor) {
+        ZSTD_freeDCtx(context);
+        return Error::from_errno(ENOMEM);
+    }
+    return decompressor.release_nonnull();
+}
+
+ErrorOr<ByteBuffer> ZstdDecompressor::decompress_all(ReadonlyBytes bytes)
+{
+    auto input_stream = make<AK::FixedMemoryStream>(bytes);
+    auto decompressor = TRY(ZstdDecompressor::create(MaybeOwned<Stream>(move(input_stream))));
+    return TRY(decompressor->read_until_eof(4096));
+}
+
+ZstdDecompressor::ZstdDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, ZSTD_DCtx* context)
+    : m_stream(move(stream))
+    , m_context(context)
+    , m_buffer(move(buffer))
+{
+}
+
+ZstdDecompressor::~ZstdDecompressor()
+{
+    ZSTD_freeDCtx(m_context);
+}
+
+ErrorOr<DecompressResult> ZstdDecompressor::decompress_some(ReadonlyBytes input, Bytes output)
+{
+    ZSTD_inBuffer input_buffer { input.data(), input.size(), 0 };
+    ZSTD_outBuffer output_buffer { output.data(), output.size(), 0 };
+
+    auto result = ZSTD_decompressStream(m_context, &output_buffer, &input_buffer);
+    if (ZSTD_isError(result)) {
+        // NOTE: The error names are static, so they outlive the error.
+        auto const* message = ZSTD_getErrorName(result);
+        return Error::from_string_view(StringView { message, strlen(message) });
+    }
+
+    // A result of 0 means a frame was decoded and flushed completely. Any input after it is the start of another frame,
+    // as zstd streams can be made up of several of them.
+    if (result == 0)
+        m_eof = input_buffer.pos == input.size();
+    else if (input_buffer.pos != 0)
+        m_eof = false;
+
+    return DecompressResult {
+        .input_bytes_consumed = input_buffer.pos,
+        .output_bytes_produced = output_buffer.pos,
+    };
+}
+
+ErrorOr<Bytes> ZstdDecompressor::read_some(Bytes bytes)
+{
+    if (m_buffered_input.is_empty())
+        m_buffered_input = TRY(m_stream->read_some(m_buffer.span()));
+
+    auto result = TRY(decompress_some(m_buffered_input, bytes));
+    m_buffered_input = m_buffered_input.slice(result.input_bytes_consumed);
+
+    // No progress was possible, and there is no more input to come that could change that.
+    if (!m_eof && result.output_bytes_produced == 0 && m_buffered_input.is_empty() && m_stream->is_eof())
+        return Error::from_string_literal("No decompression progress on EOF stream");
+
+    return bytes.trim(result.output_bytes_produced);
+}
+
+ErrorOr<size_t> ZstdDecompressor::write_some(ReadonlyBytes)
+{
+    return Error::from_errno(EBADF);
+}
+
+bool ZstdDecompressor::is_eof() const
+{
+    return m_eof;
+}
+
+bool ZstdDecompressor::is_open() const
+{
+    return m_stream->is_open();
+}
+
+void ZstdDecompressor::close()
+{
+}
+
+}
@@ -5,6 +5,7 @@
  */
 
 #include <AK/BinaryHeap.h>
+#include <AK/HashTable.h>
 #include <AK/Singleton.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
@@ -20,6 +21,15 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USE_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS) || defined(AK_OS_FREEBSD) || defined(AK_OS_NETBSD) || defined(AK_OS_OPENBSD) || defined(AK_OS_DRAGONFLY)
+#    define EVENT_LOOP_USE_KQUEUE
+#    include <fcntl.h>
+#    include <sys/event.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -49,6 +59,55 @@ bool has_flag(int value, int flag)
     return (value & flag) == flag;
 }
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+// Unless the EVENT_LOOP_BACKEND environment variable is set to "poll", we wait for events with epoll or kqueue. The kernel
+// then keeps track of the file descriptors we're interested in, so registering a notifier doesn't have to rebuild anything,
+// and waking up only costs as much as the number of notifiers that are ready, instead of the number of all notifiers.
+bool should_use_kernel_event_queue()
+{
+    static bool const should_use_kernel_event_queue = [] {
+        auto const* backend = getenv("EVENT_LOOP_BACKEND");
+        return !backend || StringView { backend, strlen(backend) } != "poll"sv;
+    }();
+    return should_use_kernel_event_queue;
+}
+
+NotificationType combined_notification_type(ReadonlySpan<Notifier*> notifiers)
+{
+    NotificationType type = NotificationType::None;
+    for (auto* notifier : notifiers)
+        type |= notifier->type();
+    return type;
+}
+#endif
+
+#if defined(EVENT_LOOP_USE_EPOLL)
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    // NOTE: epoll always reports errors and hang-ups.
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+
+NotificationType epoll_events_to_notification_type(u32 events)
+{
+    NotificationType type = NotificationType::None;
+    if (has_flag(events, EPOLLIN))
+        type |= NotificationType::Read;
+    if (has_flag(events, EPOLLOUT))
+        type |= NotificationType::Write;
+    if (has_flag(events, EPOLLHUP))
+        type |= NotificationType::Read | NotificationType::HangUp;
+    if (has_flag(events, EPOLLERR))
+        type |= NotificationType::Error;
+    return type;
+}
+#endif
+
 class EventLoopTimeout {
 public:
     static constexpr ssize_t INVALID_INDEX = NumericLimits<ssize_t>::max();
@@ -268,6 +327,11 @@ struct ThreadData {
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifiers.append(nullptr);
+
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        if (should_use_kernel_event_queue())
+            create_kernel_event_queue();
+#endif
     }
 
     ~ThreadData()
@@ -275,8 +339,233 @@ struct ThreadData {
         pthread_rwlock_wrlock(&*s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
         pthread_rwlock_unlock(&*s_thread_data_lock);
+
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        if (kernel_event_queue_fd >= 0)
+            ::close(kernel_event_queue_fd);
+#endif
+    }
+
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    bool uses_kernel_event_queue() const { return kernel_event_queue_fd >= 0; }
+
+    void create_kernel_event_queue()
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        kernel_event_queue_fd = epoll_create1(EPOLL_CLOEXEC);
+#    else
+        kernel_event_queue_fd = kqueue();
+        if (kernel_event_queue_fd >= 0)
+            (void)fcntl(kernel_event_queue_fd, F_SETFD, FD_CLOEXEC);
+#    endif
+        if (kernel_event_queue_fd < 0) {
+            dbgln("EventLoopImplementationUnix: Failed to create kernel event queue, falling back to poll(): {}", Error::from_errno(errno));
+            return;
+        }
+
+        VERIFY(update_kernel_event_queue(wake_pipe_fds[0], NotificationType::None, NotificationType::Read));
+    }
+
+    ErrorOr<size_t> wait_for_kernel_events(int timeout)
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        auto rc = epoll_wait(kernel_event_queue_fd, kernel_events.data(), kernel_events.size(), timeout);
+#    else
+        timespec timeout_spec {};
+        if (timeout >= 0) {
+            timeout_spec.tv_sec = timeout / 1000;
+            timeout_spec.tv_nsec = (timeout % 1000) * 1'000'000;
+        }
+        auto rc = kevent(kernel_event_queue_fd, nullptr, 0, kernel_events.data(), kernel_events.size(), timeout >= 0 ? &timeout_spec : nullptr);
+#    endif
+        if (rc < 0)
+            return Error::from_errno(errno);
+        return static_cast<size_t>(rc);
+    }
+
+    static int fd_for_kernel_event(auto const& event)
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        return event.data.fd;
+#    else
+        return static_cast<int>(event.ident);
+#    endif
+    }
+
+    static NotificationType notification_type_for_kernel_event(auto const& event)
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        return epoll_events_to_notification_type(event.events);
+#    else
+        NotificationType type = NotificationType::None;
+        if (event.filter == EVFILT_READ)
+            type |= NotificationType::Read;
+        if (event.filter == EVFILT_WRITE)
+            type |= NotificationType::Write;
+        if (has_flag(event.flags, EV_EOF))
+            type |= NotificationType::Read | NotificationType::HangUp;
+        if (has_flag(event.flags, EV_ERROR))
+            type |= NotificationType::Error;
+        return type;
+#    endif
+    }
+
+    void post_notifier_activations_for_kernel_events(size_t event_count)
+    {
+        // NOTE: kqueue reports reading and writing as separate events, so a notifier may get one activation for each.
+        for (size_t i = 0; i < event_count; ++i) {
+            auto const& event = kernel_events[i];
+            auto fd = fd_for_kernel_event(event);
+            if (fd == wake_pipe_fds[0])
+                continue;
+
+            auto fd_notifiers = notifiers_by_fd.get(fd);
+            if (!fd_notifiers.has_value())
+                continue;
+
+            auto event_type = notification_type_for_kernel_event(event);
+            for (auto* notifier : *fd_notifiers) {
+                auto type = event_type & notifier->type();
+                if (type != NotificationType::None)
+                    ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(fd, type));
+            }
+        }
+
+        for (auto fd : fds_not_in_kernel_event_queue) {
+            for (auto* notifier : notifiers_by_fd.get(fd).value()) {
+                auto type = notifier->type() & (NotificationType::Read | NotificationType::Write);
+                if (type != NotificationType::None)
+                    ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(fd, type));
+            }
+        }
+    }
+
+    // Tells the kernel which events we want to hear about for the given fd. A type of None means we're not interested in
+    // the fd anymore. Returns false if the kernel won't let us watch the fd.
+    bool update_kernel_event_queue(int fd, NotificationType old_type, NotificationType new_type)
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        if (new_type == NotificationType::None) {
+            // NOTE: This fails if the fd has already been closed, in which case the kernel has already forgotten about it.
+            (void)epoll_ctl(kernel_event_queue_fd, EPOLL_CTL_DEL, fd, nullptr);
+            return true;
+        }
+
+        epoll_event event {};
+        event.events = notification_type_to_epoll_events(new_type);
+        event.data.fd = fd;
+
+        auto operation = old_type == NotificationType::None ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+        if (epoll_ctl(kernel_event_queue_fd, operation, fd, &event) == 0)
+            return true;
+
+        // If the fd was closed and reused since it was registered, the kernel has forgotten about it. And if it was
+        // closed without unregistering its notifiers first, the kernel may still know about it.
+        if (errno == ENOENT && epoll_ctl(kernel_event_queue_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+            return true;
+        if (errno == EEXIST && epoll_ctl(kernel_event_queue_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+            return true;
+
+        // NOTE: epoll refuses to watch regular files and directories, which poll() considers to always be ready.
+        if (errno != EPERM)
+            dbgln("EventLoopImplementationUnix: Failed to watch fd {}: {}", fd, Error::from_errno(errno));
+        return false;
+#    else
+        // NOTE: kqueue reports hang-ups and errors through the read and write filters. If we're not interested in reading
+        //       or writing, we still need one of them, so we use an edge-triggered read filter, which doesn't keep waking
+        //       us up for data no one is going to read.
+        auto wants_read_filter = [](NotificationType type) {
+            return has_flag(type, NotificationType::Read) || (type != NotificationType::None && !has_flag(type, NotificationType::Write));
+        };
+
+        struct kevent changes[2];
+        int change_count = 0;
+
+        if (wants_read_filter(new_type))
+            EV_SET(&changes[change_count++], fd, EVFILT_READ, EV_ADD | (has_flag(new_type, NotificationType::Read) ? 0 : EV_CLEAR), 0, 0, nullptr);
+        else if (wants_read_filter(old_type))
+            EV_SET(&changes[change_count++], fd, EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+
+        if (has_flag(new_type, NotificationType::Write))
+            EV_SET(&changes[change_count++], fd, EVFILT_WRITE, EV_ADD, 0, 0, nullptr);
+        else if (has_flag(old_type, NotificationType::Write))
+            EV_SET(&changes[change_count++], fd, EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+
+        if (change_count == 0)
+            return true;
+
+        // NOTE: Deleting filters fails if the fd has already been closed, in which case the kernel has already forgotten
+        //       about it.
+        if (kevent(kernel_event_queue_fd, changes, change_count, nullptr, 0, nullptr) < 0 && new_type != NotificationType::None) {
+            dbgln("EventLoopImplementationUnix: Failed to watch fd {}: {}", fd, Error::from_errno(errno));
+            return false;
+        }
+        return true;
+#    endif
     }
 
+    // The events we want to hear about for an fd with notifiers. Even notifiers without a type want to hear about hang-ups
+    // and errors, so this is never None.
+    static NotificationType watched_notification_type(ReadonlySpan<Notifier*> notifiers)
+    {
+        auto type = combined_notification_type(notifiers);
+        return type == NotificationType::None ? NotificationType::HangUp : type;
+    }
+
+    void add_notifier_to_kernel_event_queue(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+        auto& fd_notifiers = notifiers_by_fd.ensure(fd);
+
+        auto old_type = fd_notifiers.is_empty() ? NotificationType::None : watched_notification_type(fd_notifiers);
+        fd_notifiers.append(&notifier);
+        auto new_type = watched_notification_type(fd_notifiers);
+
+        if (old_type == new_type || fds_not_in_kernel_event_queue.contains(fd))
+            return;
+        if (!update_kernel_event_queue(fd, old_type, new_type))
+            fds_not_in_kernel_event_queue.set(fd);
+    }
+
+    void remove_notifier_from_kernel_event_queue(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+        auto fd_notifiers = notifiers_by_fd.find(fd);
+        if (fd_notifiers == notifiers_by_fd.end())
+            return;
+
+        auto old_type = watched_notification_type(fd_notifiers->value);
+        fd_notifiers->value.remove_first_matching([&](auto* candidate) { return candidate == &notifier; });
+
+        auto new_type = NotificationType::None;
+        if (fd_notifiers->value.is_empty())
+            notifiers_by_fd.remove(fd_notifiers);
+        else
+            new_type = watched_notification_type(fd_notifiers->value);
+
+        if (fds_not_in_kernel_event_queue.contains(fd)) {
+            if (new_type == NotificationType::None)
+                fds_not_in_kernel_event_queue.remove(fd);
+            return;
+        }
+        if (old_type != new_type)
+            (void)update_kernel_event_queue(fd, old_type, new_type);
+    }
+
+    int kernel_event_queue_fd { -1 };
+#    if defined(EVENT_LOOP_USE_EPOLL)
+    Array<epoll_event, 64> kernel_events;
+#    else
+    Array<struct kevent, 64> kernel_events;
+#    endif
+
+    // NOTE: The kernel only lets us register an fd once, but several notifiers may be interested in the same fd.
+    HashMap<int, Vector<Notifier*, 1>> notifiers_by_fd;
+
+    // The fds the kernel event queue refuses to watch. Like poll(), we consider them to always be ready.
+    HashTable<int> fds_not_in_kernel_event_queue;
+#endif
+
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
@@ -339,6 +628,12 @@ void EventLoopManagerUnix::wait_for_events(EventLoopImplementation::PumpMode mod
 {
     auto& thread_data = ThreadData::the();
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    bool const uses_kernel_event_queue = thread_data.uses_kernel_event_queue();
+#else
+    bool const uses_kernel_event_queue = false;
+#endif
+
 retry:
     bool has_pending_events = ThreadEventQueue::current().has_pending_events();
 
@@ -363,20 +658,50 @@ retry:
     }
 
 try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
-    auto time_after_poll = MonotonicTime::now_coarse();
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
-            goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
-        VERIFY_NOT_REACHED();
+    bool wake_pipe_is_readable = false;
+    size_t marked_fd_count = 0;
+
+    if (uses_kernel_event_queue) {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        // NOTE: The fds the kernel won't watch for us are always ready, so we must not block if we have any of them.
+        if (!thread_data.fds_not_in_kernel_event_queue.is_empty()) {
+            should_wait_forever = false;
+            timeout = 0;
+        }
+
+        auto error_or_marked_fd_count = thread_data.wait_for_kernel_events(should_wait_forever ? -1 : timeout);
+        if (error_or_marked_fd_count.is_error()) {
+            if (error_or_marked_fd_count.error().code() == EINTR)
+                goto try_select_again;
+            dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+            VERIFY_NOT_REACHED();
+        }
+        marked_fd_count = error_or_marked_fd_count.value();
+
+        for (size_t i = 0; i < marked_fd_count; ++i) {
+            if (ThreadData::fd_for_kernel_event(thread_data.kernel_events[i]) == thread_data.wake_pipe_fds[0])
+                wake_pipe_is_readable = true;
+        }
+#endif
+    } else {
+        // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+        auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+        // Because POSIX, we might spuriously return from select() with EINTR; just select again.
+        if (error_or_marked_fd_count.is_error()) {
+            if (error_or_marked_fd_count.error().code() == EINTR)
+                goto try_select_again;
+            dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+            VERIFY_NOT_REACHED();
+        }
+        marked_fd_count = error_or_marked_fd_count.value();
+        wake_pipe_is_readable = has_flag(thread_data.poll_fds[0].revents, POLLIN);
     }
 
+    auto time_after_poll = MonotonicTime::now_coarse();
+
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (wake_pipe_is_readable) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -405,7 +730,11 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
+    if (uses_kernel_event_queue) {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        thread_data.post_notifier_activations_for_kernel_events(marked_fd_count);
+#endif
+    } else if (marked_fd_count != 0) {
         // Handle file system notifiers by making them normal events.
         for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
             auto& notifier = *thread_data.notifiers[i];
@@ -651,14 +980,20 @@ void EventLoopManagerUnix::unregister_timer(intptr_t timer_id)
 void EventLoopManagerUnix::register_notifier(Notifier& notifier)
 {
     auto& thread_data = ThreadData::the();
+    notifier.set_owner_thread(s_thread_id);
+
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    if (thread_data.uses_kernel_event_queue()) {
+        thread_data.add_notifier_to_kernel_event_queue(notifier);
+        return;
+    }
+#endif
 
     thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
     thread_data.notifiers.append(&notifier);
 
     auto events = notification_type_to_poll_events(notifier.type());
     thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
-
-    notifier.set_owner_thread(s_thread_id);
 }
 
 void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
@@ -667,6 +1002,13 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
     if (!thread_data)
         return;
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    if (thread_data->uses_kernel_event_queue()) {
+        thread_data->remove_notifier_from_kernel_event_queue(notifier);
+        return;
+    }
+#endif
+
     auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
 
     if (notifier_index + 1 < thread_data->poll_fds.size()) {
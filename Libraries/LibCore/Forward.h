@@ -27,6 +27,7 @@ class File;
 class LocalServer;
 class LocalSocket;
 class MappedFile;
+class MemoryPressureWatcher;
 class MimeData;
 class NetworkJob;
 class NetworkResponse;
@@ -51,6 +52,7 @@ class UDPSocket;
 
 struct ProxyData;
 
+enum class MemoryPressureLevel : u8;
 enum class TimerShouldFireWhenNotVisible;
 
 #ifdef AK_OS_MACH
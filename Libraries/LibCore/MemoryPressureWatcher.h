@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Types.h>
+
+namespace Core {
+
+enum class MemoryPressureLevel : u8 {
+    // There is enough memory available.
+    Normal,
+
+    // Memory is getting tight. Caches that are cheap to refill should be shed.
+    Moderate,
+
+    // The system (or our cgroup) is about to run out of memory. Everything that can be given back should be.
+    Critical,
+};
+
+class MemoryPressureWatcher {
+    AK_MAKE_NONCOPYABLE(MemoryPressureWatcher);
+
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> create();
+    virtual ~MemoryPressureWatcher() = default;
+
+    Function<void(MemoryPressureLevel)> on_memory_pressure_level_changed;
+
+protected:
+    MemoryPressureWatcher() = default;
+};
+
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/Platform.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
+#include <LibCore/Timer.h>
+
+#if !defined(AK_OS_LINUX)
+static_assert(false, "This file must only be used for Linux");
+#endif
+
+namespace Core {
+
+// NOTE: The kernel can notify us about pressure through triggers written to the PSI files, but those must be polled for
+//       POLLPRI, which Core::Notifier doesn't support. Reading the files every now and then is cheap enough.
+static constexpr int pressure_check_interval_ms = 1000;
+
+// https://docs.kernel.org/accounting/psi.html
+// The share of the last 10 seconds during which some (or all) tasks were stalled waiting for memory, in percent.
+static constexpr u32 moderate_some_stall_percentage = 10;
+static constexpr u32 critical_full_stall_percentage = 10;
+
+// How much of the memory limit of our cgroup may be in use before we're under pressure, in percent. Dense deployments
+// tend to hit these limits long before the system as a whole runs low on memory.
+static constexpr u64 moderate_cgroup_usage_percentage = 85;
+static constexpr u64 critical_cgroup_usage_percentage = 95;
+
+static ErrorOr<ByteString> read_file(ByteString const& path)
+{
+    auto file = TRY(File::open(path, File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    return ByteString { contents.bytes() };
+}
+
+// https://docs.kernel.org/admin-guide/cgroup-v2.html
+static Optional<ByteString> find_cgroup_directory()
+{
+    auto cgroups = read_file("/proc/self/cgroup"sv);
+    if (cgroups.is_error())
+        return {};
+
+    // NOTE: With cgroup v2, there is a single line of the form "0::/path/of/the/cgroup".
+    for (auto line : cgroups.value().view().lines()) {
+        if (line.starts_with("0::"sv))
+            return ByteString::formatted("/sys/fs/cgroup{}", line.substring_view(3));
+    }
+    return {};
+}
+
+// Returns the avg10 value of the "some" or "full" line of a PSI file.
+static Optional<u32> stall_percentage(StringView pressure, StringView kind)
+{
+    for (auto line : pressure.lines()) {
+        if (!line.starts_with(kind))
+            continue;
+
+        for (auto field : line.split_view(' ')) {
+            if (!field.starts_with("avg10="sv))
+                continue;
+
+            // NOTE: The value has two decimal places, which we don't care about.
+            auto value = field.substring_view(6);
+            if (auto decimal_point = value.find('.'); decimal_point.has_value())
+                value = value.substring_view(0, *decimal_point);
+            return value.to_number<u32>();
+        }
+    }
+    return {};
+}
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto cgroup_directory = find_cgroup_directory();
+
+        ByteString pressure_path { "/proc/pressure/memory"sv };
+        if (cgroup_directory.has_value()) {
+            if (auto path = ByteString::formatted("{}/memory.pressure", *cgroup_directory); !read_file(path).is_error())
+                pressure_path = move(path);
+        }
+
+        // NOTE: PSI may not be enabled in the kernel, in which case there is nothing for us to watch.
+        TRY(read_file(pressure_path));
+
+        return adopt_own(*new MemoryPressureWatcherImpl(move(pressure_path), move(cgroup_directory)));
+    }
+
+private:
+    MemoryPressureWatcherImpl(ByteString pressure_path, Optional<ByteString> cgroup_directory)
+        : m_pressure_path(move(pressure_path))
+        , m_cgroup_directory(move(cgroup_directory))
+    {
+        m_timer = Timer::create_repeating(pressure_check_interval_ms, [this] {
+            auto level = current_level();
+            if (level == m_level)
+                return;
+
+            m_level = level;
+            if (on_memory_pressure_level_changed)
+                on_memory_pressure_level_changed(level);
+        });
+        m_timer->start();
+    }
+
+    MemoryPressureLevel current_level() const
+    {
+        auto level = MemoryPressureLevel::Normal;
+
+        if (auto pressure = read_file(m_pressure_path); !pressure.is_error()) {
+            if (stall_percentage(pressure.value(), "full "sv).value_or(0) >= critical_full_stall_percentage)
+                return MemoryPressureLevel::Critical;
+            if (stall_percentage(pressure.value(), "some "sv).value_or(0) >= moderate_some_stall_percentage)
+                level = MemoryPressureLevel::Moderate;
+        }
+
+        if (auto usage_percentage = cgroup_usage_percentage(); usage_percentage.has_value()) {
+            if (*usage_percentage >= critical_cgroup_usage_percentage)
+                return MemoryPressureLevel::Critical;
+            if (*usage_percentage >= moderate_cgroup_usage_percentage)
+                level = MemoryPressureLevel::Moderate;
+        }
+
+        return level;
+    }
+
+    Optional<u64> cgroup_usage_percentage() const
+    {
+        if (!m_cgroup_directory.has_value())
+            return {};
+
+        // NOTE: A cgroup without a memory limit has "max" in this file.
+        auto limit = read_file(ByteString::formatted("{}/memory.max", *m_cgroup_directory));
+        if (limit.is_error())
+            return {};
+        auto limit_in_bytes = limit.value().view().trim_whitespace().to_number<u64>();
+        if (!limit_in_bytes.has_value() || *limit_in_bytes == 0)
+            return {};
+
+        auto usage = read_file(ByteString::formatted("{}/memory.current", *m_cgroup_directory));
+        if (usage.is_error())
+            return {};
+        auto usage_in_bytes = usage.value().view().trim_whitespace().to_number<u64>();
+        if (!usage_in_bytes.has_value())
+            return {};
+
+        return *usage_in_bytes * 100 / *limit_in_bytes;
+    }
+
+    ByteString m_pressure_path;
+    Optional<ByteString> m_cgroup_directory;
+    RefPtr<Timer> m_timer;
+    MemoryPressureLevel m_level { MemoryPressureLevel::Normal };
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
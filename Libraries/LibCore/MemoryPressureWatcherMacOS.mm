@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Platform.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/MemoryPressureWatcher.h>
+
+#if !defined(AK_OS_MACOS)
+static_assert(false, "This file must only be used for macOS");
+#endif
+
+#import <dispatch/dispatch.h>
+
+namespace Core {
+
+class MemoryPressureWatcherImpl;
+
+// NOTE: This is only ever touched on the main thread, so that events which were already on their way to the main event
+//       loop when the watcher was destroyed can tell that it's gone.
+static MemoryPressureWatcherImpl* s_the;
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto dispatch_queue = dispatch_queue_create("Ladybird.MemoryPressureWatcher", DISPATCH_QUEUE_SERIAL);
+        if (dispatch_queue == nullptr)
+            return Error::from_errno(errno);
+
+        auto source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_NORMAL | DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_queue);
+        if (source == nullptr) {
+            dispatch_release(dispatch_queue);
+            return Error::from_string_literal("Unable to create a memory pressure dispatch source");
+        }
+
+        return adopt_own(*new MemoryPressureWatcherImpl(dispatch_queue, source));
+    }
+
+    virtual ~MemoryPressureWatcherImpl() override
+    {
+        s_the = nullptr;
+
+        // NOTE: Cancelling the source doesn't wait for an event handler that is already running, so we wait for it.
+        dispatch_source_cancel(m_source);
+        dispatch_sync(m_dispatch_queue, ^{});
+        dispatch_release(m_source);
+        dispatch_release(m_dispatch_queue);
+    }
+
+private:
+    MemoryPressureWatcherImpl(dispatch_queue_t dispatch_queue, dispatch_source_t source)
+        : m_main_event_loop(EventLoop::current())
+        , m_dispatch_queue(dispatch_queue)
+        , m_source(source)
+    {
+        VERIFY(!s_the);
+        s_the = this;
+
+        dispatch_source_set_event_handler(m_source, ^{
+            auto level = level_from_dispatch_flags(dispatch_source_get_data(m_source));
+
+            m_main_event_loop.deferred_invoke([level] {
+                if (s_the && s_the->on_memory_pressure_level_changed)
+                    s_the->on_memory_pressure_level_changed(level);
+            });
+            m_main_event_loop.wake();
+        });
+        dispatch_resume(m_source);
+    }
+
+    static MemoryPressureLevel level_from_dispatch_flags(uintptr_t flags)
+    {
+        if (flags & DISPATCH_MEMORYPRESSURE_CRITICAL)
+            return MemoryPressureLevel::Critical;
+        if (flags & DISPATCH_MEMORYPRESSURE_WARN)
+            return MemoryPressureLevel::Moderate;
+        return MemoryPressureLevel::Normal;
+    }
+
+    EventLoop& m_main_event_loop;
+    dispatch_queue_t m_dispatch_queue { nullptr };
+    dispatch_source_t m_source { nullptr };
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
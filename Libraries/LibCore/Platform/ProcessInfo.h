@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <AK/Types.h>
 
 #if defined(AK_OS_MACH)
@@ -27,6 +28,9 @@ struct ProcessInfo {
 
     u64 time_spent_in_process { 0 };
 
+    // The total time the process has spent running on a CPU, in user and kernel mode.
+    AK::Duration cpu_time;
+
 #if defined(AK_OS_MACH)
     Core::MachPort child_task_port;
 #endif
@@ -65,6 +65,7 @@ ErrorOr<void> update_process_statistics(ProcessStatistics& statistics)
         u64 const time_process = utime + stime;
         float const time_scheduled_diff = time_process - process->time_spent_in_process;
         process->time_spent_in_process = time_process;
+        process->cpu_time = AK::Duration::from_nanoseconds(static_cast<i64>(time_process * 1'000'000'000 / user_hz));
 
         process->cpu_percent = 0.0;
         if (total_time_scheduled_diff > 0) {
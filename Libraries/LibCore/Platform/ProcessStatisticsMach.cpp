@@ -67,6 +67,7 @@ ErrorOr<void> update_process_statistics(ProcessStatistics& statistics)
 
         auto time_diff_process = time_in_process - AK::Duration::from_microseconds(process->time_spent_in_process);
         process->time_spent_in_process = time_in_process.to_microseconds();
+        process->cpu_time = time_in_process;
 
         process->cpu_percent = 0.0f;
         if (time_diff_process > AK::Duration::zero())
@@ -146,7 +146,8 @@ ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int opti
     int fd = -1;
 #if defined(AK_OS_LINUX) || defined(AK_OS_FREEBSD)
     // FIXME: Support more options on Linux.
-    auto linux_options = ((options & O_CLOEXEC) > 0) ? MFD_CLOEXEC : 0;
+    // NOTE: We allow sealing, so that whoever we share the file with can rely on it not changing size.
+    auto linux_options = MFD_ALLOW_SEALING | (((options & O_CLOEXEC) > 0) ? MFD_CLOEXEC : 0);
     fd = memfd_create("", linux_options);
     if (fd < 0)
         return Error::from_errno(errno);
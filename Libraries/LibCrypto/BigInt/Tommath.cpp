@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/ByteBuffer.h>
+#include <AK/CharacterTypes.h>
+#include <AK/ScopeGuard.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCrypto/BigInt/Tommath.h>
+#include <math.h>
+
+namespace Crypto {
+
+// Values up to this size are converted by libtommath directly.
+static constexpr int base_case_bit_count = 2048;
+
+// Only values at least this large are split up, as computing the powers of the base isn't free either.
+static constexpr int divide_and_conquer_threshold_bit_count = 4 * base_case_bit_count;
+
+// The powers base^(base_case_digit_count * 2^i) used to split up a value, along with their number of digits.
+class PowersOfBase {
+    AK_MAKE_NONCOPYABLE(PowersOfBase);
+    AK_MAKE_NONMOVABLE(PowersOfBase);
+
+public:
+    explicit PowersOfBase(u16 base)
+        : m_base(base)
+        , m_base_case_digit_count(max(1, static_cast<int>(base_case_bit_count / log2(base))))
+    {
+    }
+
+    ~PowersOfBase()
+    {
+        for (auto& power : m_powers)
+            mp_clear(&power);
+    }
+
+    size_t size() const { return m_powers.size(); }
+    mp_int const& power(size_t index) const { return m_powers[index]; }
+    size_t digit_count(size_t index) const { return static_cast<size_t>(m_base_case_digit_count) << index; }
+    size_t base_case_digit_count() const { return m_base_case_digit_count; }
+
+    ErrorOr<void> append_next()
+    {
+        mp_int power;
+        MP_TRY(mp_init(&power));
+        ArmedScopeGuard clear_power = [&] { mp_clear(&power); };
+
+        if (m_powers.is_empty()) {
+            mp_int base;
+            MP_TRY(mp_init(&base));
+            ScopeGuard clear_base = [&] { mp_clear(&base); };
+            mp_set_u64(&base, m_base);
+            MP_TRY(mp_expt_n(&base, m_base_case_digit_count, &power));
+        } else {
+            MP_TRY(mp_mul(&m_powers.last(), &m_powers.last(), &power));
+        }
+
+        TRY(m_powers.try_append(power));
+        clear_power.disarm();
+        return {};
+    }
+
+private:
+    u16 m_base { 0 };
+    int m_base_case_digit_count { 0 };
+    Vector<mp_int> m_powers;
+};
+
+// Appends the digits of a value less than powers.power(level), left padded with zeros up to minimum_width.
+static ErrorOr<void> append_digits(StringBuilder& builder, mp_int const& value, u16 base, PowersOfBase const& powers, size_t level, size_t minimum_width)
+{
+    if (level == 0) {
+        int size = 0;
+        MP_TRY(mp_radix_size(&value, base, &size));
+        auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+
+        size_t written = 0;
+        MP_TRY(mp_to_radix(&value, reinterpret_cast<char*>(buffer.data()), size, &written, base));
+
+        auto digits = StringView { buffer.bytes().slice(0, written - 1) };
+        for (size_t i = digits.length(); i < minimum_width; ++i)
+            TRY(builder.try_append('0'));
+        TRY(builder.try_append(digits));
+        return {};
+    }
+
+    auto const& divisor = powers.power(level - 1);
+    auto low_digit_count = powers.digit_count(level - 1);
+
+    // NOTE: Without padding, the high half must not be empty, or the low half would be printed with leading zeros.
+    if (minimum_width == 0 && mp_cmp_mag(&value, &divisor) == MP_LT)
+        return append_digits(builder, value, base, powers, level - 1, 0);
+
+    mp_int quotient;
+    mp_int remainder;
+    MP_TRY(mp_init_multi(&quotient, &remainder, nullptr));
+    ScopeGuard clear = [&] { mp_clear_multi(&quotient, &remainder, nullptr); };
+
+    // NOTE: Since powers.power(level) is the square of powers.power(level - 1), both halves are less than the latter.
+    MP_TRY(mp_div(&value, &divisor, &quotient, &remainder));
+
+    TRY(append_digits(builder, quotient, base, powers, level - 1, minimum_width > 0 ? minimum_width - low_digit_count : 0));
+    TRY(append_digits(builder, remainder, base, powers, level - 1, low_digit_count));
+    return {};
+}
+
+ErrorOr<String> mp_to_base(mp_int const& value, u16 base)
+{
+    VERIFY(base >= 2 && base <= 36);
+
+    if (mp_count_bits(&value) < divide_and_conquer_threshold_bit_count) {
+        int size = 0;
+        MP_TRY(mp_radix_size(&value, base, &size));
+        auto buffer = TRY(ByteBuffer::create_uninitialized(size));
+
+        size_t written = 0;
+        MP_TRY(mp_to_radix(&value, reinterpret_cast<char*>(buffer.data()), size, &written, base));
+        return StringView(buffer.bytes().slice(0, written - 1)).to_ascii_lowercase_string();
+    }
+
+    mp_int magnitude;
+    MP_TRY(mp_init(&magnitude));
+    ScopeGuard clear_magnitude = [&] { mp_clear(&magnitude); };
+    MP_TRY(mp_abs(&value, &magnitude));
+
+    PowersOfBase powers { base };
+    do {
+        TRY(powers.append_next());
+    } while (mp_cmp_mag(&magnitude, &powers.power(powers.size() - 1)) != MP_LT);
+
+    StringBuilder builder;
+    if (mp_isneg(&value))
+        TRY(builder.try_append('-'));
+    TRY(append_digits(builder, magnitude, base, powers, powers.size() - 1, 0));
+
+    return builder.string_view().to_ascii_lowercase_string();
+}
+
+static ErrorOr<void> read_digits(mp_int& result, StringView digits, u16 base, PowersOfBase const& powers)
+{
+    if (digits.length() <= powers.base_case_digit_count()) {
+        Vector<char, 512> buffer;
+        TRY(buffer.try_append(digits.characters_without_null_termination(), digits.length()));
+        TRY(buffer.try_append('\0'));
+        MP_TRY(mp_read_radix(&result, buffer.data(), base));
+        return {};
+    }
+
+    // Split off as many low digits as the largest of the powers of the base that is shorter than the value.
+    size_t level = powers.size() - 1;
+    while (powers.digit_count(level) >= digits.length())
+        --level;
+    auto low_digit_count = powers.digit_count(level);
+
+    mp_int low;
+    MP_TRY(mp_init(&low));
+    ScopeGuard clear_low = [&] { mp_clear(&low); };
+
+    TRY(read_digits(result, digits.substring_view(0, digits.length() - low_digit_count), base, powers));
+    TRY(read_digits(low, digits.substring_view(digits.length() - low_digit_count), base, powers));
+
+    MP_TRY(mp_mul(&result, &powers.power(level), &result));
+    MP_TRY(mp_add(&result, &low, &result));
+    return {};
+}
+
+ErrorOr<void> mp_from_base(mp_int& result, StringView digits, u16 base)
+{
+    VERIFY(base >= 2 && base <= 36);
+
+    auto is_negative = digits.starts_with('-');
+    auto magnitude_digits = is_negative ? digits.substring_view(1) : digits;
+
+    // NOTE: mp_read_radix() accepts a few things besides digits (like a trailing newline) that would be wrongly
+    //       accepted in the middle of a number if we split it up, so those are left to it.
+    auto can_split = magnitude_digits.length() * log2(base) >= divide_and_conquer_threshold_bit_count
+        && all_of(magnitude_digits, [](char c) { return is_ascii_alphanumeric(c); });
+
+    if (!can_split) {
+        auto buffer = TRY(ByteBuffer::create_uninitialized(digits.length() + 1));
+        digits.bytes().copy_to(buffer);
+        buffer[digits.length()] = '\0';
+        MP_TRY(mp_read_radix(&result, reinterpret_cast<char const*>(buffer.data()), base));
+        return {};
+    }
+
+    PowersOfBase powers { base };
+    do {
+        TRY(powers.append_next());
+    } while (powers.digit_count(powers.size() - 1) * 2 < magnitude_digits.length());
+
+    TRY(read_digits(result, magnitude_digits, base, powers));
+    if (is_negative)
+        MP_TRY(mp_neg(&result, &result));
+    return {};
+}
+
+}
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/String.h>
+#include <AK/StringView.h>
 
 #include <tommath.h>
 
@@ -31,3 +33,12 @@ inline ErrorOr<void> mp_error(mp_err error)
 #define MP_TRY(...) TRY(mp_error((__VA_ARGS__)))
 
 #define MP_MUST(...) MUST(mp_error((__VA_ARGS__)))
+
+namespace Crypto {
+
+// Like mp_to_radix() and mp_read_radix(), but splits large values in halves recursively instead of converting them one
+// digit at a time, which takes quadratic time.
+ErrorOr<String> mp_to_base(mp_int const&, u16 base);
+ErrorOr<void> mp_from_base(mp_int&, StringView digits, u16 base);
+
+}
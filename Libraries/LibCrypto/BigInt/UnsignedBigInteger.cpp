@@ -113,20 +113,18 @@ ErrorOr<UnsignedBigInteger> UnsignedBigInteger::from_base(u16 N, StringView str)
     if (str.is_empty())
         return UnsignedBigInteger(0);
 
-    auto buffer = TRY(ByteBuffer::create_zeroed(str.length() + 1));
-
-    size_t idx = 0;
-    for (auto& c : str) {
+    StringBuilder builder;
+    for (auto c : str) {
         if (c == '_') {
             // Skip underscores
             continue;
         }
 
-        buffer[idx++] = c;
+        TRY(builder.try_append(c));
     }
 
     UnsignedBigInteger result;
-    if (mp_read_radix(&result.m_mp, reinterpret_cast<char const*>(buffer.data()), N) != MP_OKAY)
+    if (mp_from_base(result.m_mp, builder.string_view(), N).is_error())
         return Error::from_string_literal("Invalid number");
     return result;
 }
@@ -137,14 +135,7 @@ ErrorOr<String> UnsignedBigInteger::to_base(u16 N) const
     if (is_zero())
         return "0"_string;
 
-    int size = 0;
-    MP_MUST(mp_radix_size(&m_mp, N, &size));
-    auto buffer = TRY(ByteBuffer::create_zeroed(size));
-
-    size_t written = 0;
-    MP_MUST(mp_to_radix(&m_mp, reinterpret_cast<char*>(buffer.data()), size, &written, N));
-
-    return StringView(buffer.bytes().slice(0, written - 1)).to_ascii_lowercase_string();
+    return mp_to_base(m_mp, N);
 }
 
 u64 UnsignedBigInteger::to_u64() const
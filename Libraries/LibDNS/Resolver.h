@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/CountingStream.h>
 #include <AK/HashTable.h>
@@ -61,6 +62,13 @@ class Resolver;
 class LookupResult : public AtomicRefCounted<LookupResult>
     , public Weakable<LookupResult> {
 public:
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    static constexpr AK::Duration max_negative_cache_duration = AK::Duration::from_seconds(5 * 60);
+
+    // How long expired records are kept around, so that they can be served while they are being refreshed.
+    // https://www.rfc-editor.org/rfc/rfc8767#section-4
+    static constexpr AK::Duration max_stale_duration = AK::Duration::from_seconds(5 * 60);
+
     explicit LookupResult(Messages::DomainName name)
         : m_name(move(name))
     {
@@ -84,9 +92,17 @@ public:
             return;
 
         auto now = AK::UnixDateTime::now();
+        if (m_negative_expiration.has_value()) {
+            if (m_negative_expiration.value() < now) {
+                dbgln_if(DNS_DEBUG, "DNS: Removing expired negative entry for {}", m_name.to_string());
+                m_valid = false;
+            }
+            return;
+        }
+
         for (size_t i = 0; i < m_cached_records.size();) {
             auto& record = m_cached_records[i];
-            if (record.expiration.has_value() && record.expiration.value() < now) {
+            if (record.expiration.has_value() && record.expiration.value() + max_stale_duration < now) {
                 dbgln_if(DNS_DEBUG, "DNS: Removing expired record for {}", m_name.to_string());
                 m_cached_records.remove(i);
             } else {
@@ -100,13 +116,60 @@ public:
             m_valid = false;
     }
 
+    // NOTE: Records we make up ourselves have a TTL of zero, and never expire.
     void add_record(Messages::ResourceRecord record)
     {
         m_valid = true;
+        m_negative_expiration = {};
         auto expiration = record.ttl > 0 ? Optional<AK::UnixDateTime>(AK::UnixDateTime::now() + AK::Duration::from_seconds(record.ttl)) : OptionalNone();
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    // Records from a response honor their TTL. A TTL of zero means that the record may only be used for the lookup that
+    // it was received for, so it expires right away.
+    void add_record_from_response(Messages::ResourceRecord record)
+    {
+        m_valid = true;
+        m_negative_expiration = {};
+        auto expiration = AK::UnixDateTime::now() + AK::Duration::from_seconds(record.ttl);
+        m_cached_records.append({ move(record), expiration });
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    void set_negative_cache_expiration(AK::UnixDateTime expiration)
+    {
+        m_valid = true;
+        m_negative_expiration = expiration;
+    }
+
+    // A negative entry remembers that the name doesn't exist, or has no records of the types we asked for.
+    bool is_negative() const { return m_negative_expiration.has_value(); }
+
+    bool is_stale() const
+    {
+        auto now = AK::UnixDateTime::now();
+        for (auto const& re : m_cached_records) {
+            if (re.expiration.has_value() && re.expiration.value() < now)
+                return true;
+        }
+        return false;
+    }
+
+    // Entries we made up ourselves, like the one for localhost, must stay in the cache.
+    bool is_permanent() const
+    {
+        if (m_cached_records.is_empty())
+            return false;
+        for (auto const& re : m_cached_records) {
+            if (re.expiration.has_value())
+                return false;
+        }
+        return true;
+    }
+
+    u64 last_access() const { return m_last_access.load(AK::MemoryOrder::memory_order_relaxed); }
+    void set_last_access(u64 access) const { m_last_access.store(access, AK::MemoryOrder::memory_order_relaxed); }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -190,6 +253,8 @@ private:
     };
 
     Vector<RecordWithExpiration> m_cached_records;
+    Optional<AK::UnixDateTime> m_negative_expiration;
+    mutable Atomic<u64> m_last_access { 0 };
     HashTable<Messages::ResourceType> m_desired_types;
     Vector<Messages::Records::DNSKEY> m_used_dnskeys {};
     HashTable<u16> m_seen_key_tags;
@@ -208,6 +273,11 @@ class Resolver {
     };
 
 public:
+    static constexpr size_t max_cache_entries = 4096;
+
+    // https://www.rfc-editor.org/rfc/rfc8305#section-3
+    static constexpr int resolution_delay_ms = 50;
+
     enum class ConnectionMode {
         TCP,
         UDP,
@@ -292,6 +362,12 @@ public:
                 return {};
 
             auto& result = *it->value;
+            result.set_last_access(++m_access_count);
+
+            // NOTE: A negative entry answers the lookup just as well, by telling the caller that there's nothing to find.
+            if (result.is_negative())
+                return result;
+
             for (auto const& type : desired_types) {
                 if (!result.has_record_of_type(type))
                     return {};
@@ -332,6 +408,76 @@ public:
         return result_promise;
     }
 
+    // Looks up both the IPv6 and IPv4 addresses of a host, as separate queries that are sent in parallel. As described by
+    // Happy Eyeballs, we don't necessarily wait for both: we finish as soon as we have IPv6 addresses, or shortly after
+    // we have IPv4 addresses, so that the caller can start connecting while the other answer is still on its way.
+    // https://www.rfc-editor.org/rfc/rfc8305#section-3
+    NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup_addresses(ByteString name, LookupOptions options = LookupOptions::default_())
+    {
+        using ResultPromise = Core::Promise<NonnullRefPtr<LookupResult const>>;
+
+        // NOTE: Address literals and lookups through the system resolver don't involve separate queries, and DNSSEC
+        //       validation needs the whole answer.
+        if (options.validate_dnssec_locally || IPv4Address::from_string(name).has_value() || IPv6Address::from_string(name).has_value() || !has_connection())
+            return lookup(move(name), Messages::Class::IN, { Messages::ResourceType::A, Messages::ResourceType::AAAA }, options);
+
+        struct State : RefCounted<State> {
+            RefPtr<LookupResult const> result;
+            size_t settled_count { 0 };
+            Optional<Error> error;
+            RefPtr<Core::Timer> resolution_delay_timer;
+        };
+        auto state = make_ref_counted<State>();
+        auto result_promise = ResultPromise::construct();
+
+        auto finish = [state, weak_promise = result_promise->make_weak_ptr<ResultPromise>()] {
+            if (!weak_promise || weak_promise->is_resolved() || weak_promise->is_rejected())
+                return;
+            if (state->resolution_delay_timer)
+                state->resolution_delay_timer->stop();
+            if (state->result)
+                weak_promise->resolve(*state->result);
+            else
+                weak_promise->reject(state->error.has_value() ? state->error.release_value() : Error::from_string_literal("DNS lookup failed"));
+        };
+
+        auto did_settle = [state, finish](Messages::ResourceType type, RefPtr<LookupResult const> result) {
+            ++state->settled_count;
+            if (result && !result->cached_addresses().is_empty())
+                state->result = move(result);
+
+            if (state->settled_count == 2) {
+                finish();
+                return;
+            }
+
+            if (!state->result)
+                return;
+
+            // If the IPv6 addresses arrive first, we can start connecting right away. If the IPv4 addresses arrive first,
+            // we wait a moment for the IPv6 ones, since those are preferred.
+            if (type == Messages::ResourceType::AAAA) {
+                finish();
+            } else if (!state->resolution_delay_timer) {
+                state->resolution_delay_timer = Core::Timer::create_single_shot(resolution_delay_ms, [finish] { finish(); });
+                state->resolution_delay_timer->start();
+            }
+        };
+
+        // NOTE: The AAAA query goes out first, since its answer is the one we prefer.
+        for (auto type : { Messages::ResourceType::AAAA, Messages::ResourceType::A }) {
+            auto promise = lookup(name, Messages::Class::IN, Vector { type }, options);
+            result_promise->add_child(promise);
+            promise->when_resolved([did_settle, type](auto& result) { did_settle(type, result); })
+                .when_rejected([state, did_settle, type](auto& error) {
+                    state->error = Error::copy(error);
+                    did_settle(type, nullptr);
+                });
+        }
+
+        return result_promise;
+    }
+
     NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup(ByteString name, Messages::Class class_ = Messages::Class::IN, LookupOptions options = LookupOptions::default_())
     {
         return lookup(move(name), class_, { Messages::ResourceType::A, Messages::ResourceType::AAAA }, options);
@@ -379,6 +525,16 @@ public:
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
                 dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+
+                // OPTIMIZATION: Rather than making the caller wait for a new lookup once records expire, we keep serving
+                //               them for a little while, and refresh them in the background.
+                //               https://www.rfc-editor.org/rfc/rfc8767#section-5
+                if (result->is_stale() && !options.repeating_lookup) {
+                    dbgln_if(DNS_DEBUG, "DNS: Cache entry for {} is stale, refreshing it", name);
+                    m_cache.with_write_locked([&](auto& cache) { cache.remove(name); });
+                    (void)lookup(name, class_, desired_types, options);
+                }
+
                 promise->resolve(result.release_nonnull());
                 return promise;
             }
@@ -445,6 +601,12 @@ public:
 
             if (existing) {
                 dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+                // NOTE: If we're about to ask for more types than the entry was created for, remember that these are on
+                //       their way too, so that concurrent lookups for them wait for this one instead of starting their own.
+                if (!already_in_cache && !existing->is_done()) {
+                    for (auto const& type : desired_types)
+                        existing->will_add_record_of_type(type);
+                }
                 return *existing;
             }
 
@@ -465,7 +627,7 @@ public:
             auto existing_promise = m_pending_lookups.with_write_locked(
                 [&](auto& lookups) -> RefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> {
                     if (auto* lookup = lookups->find(id))
-                        return lookup->promise;
+                        return join_pending_lookup(*lookup);
                     return nullptr;
                 });
             if (existing_promise)
@@ -557,18 +719,7 @@ public:
 
         if (cached_entry) {
             dbgln_if(DNS_DEBUG, "DNS::lookup({}) -> Lookup already underway", name);
-            auto user_promise = Core::Promise<NonnullRefPtr<LookupResult const>>::construct();
-            promise->on_resolution = [user_promise, cached_promise = cached_entry->promise](auto& result) {
-                user_promise->resolve(*result);
-                cached_promise->resolve(*result);
-                return ErrorOr<void> {};
-            };
-            promise->on_rejection = [user_promise, cached_promise = cached_entry->promise](auto& error) {
-                user_promise->reject(Error::copy(error));
-                cached_promise->reject(Error::copy(error));
-            };
-            cached_entry->promise = move(promise);
-            return user_promise;
+            return join_pending_lookup(*cached_entry);
         }
 
         auto pending_lookup = m_pending_lookups.with_write_locked([&](auto& lookups) -> PendingLookup* {
@@ -600,6 +751,25 @@ public:
     }
 
 private:
+    // Gives the caller a promise of its own for a lookup that's already underway, since the handlers of the lookup's
+    // promise belong to whoever started it.
+    static NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> join_pending_lookup(PendingLookup& lookup)
+    {
+        auto user_promise = Core::Promise<NonnullRefPtr<LookupResult const>>::construct();
+        auto promise = Core::Promise<NonnullRefPtr<LookupResult const>>::construct();
+        promise->on_resolution = [user_promise, cached_promise = lookup.promise](auto& result) {
+            user_promise->resolve(*result);
+            cached_promise->resolve(*result);
+            return ErrorOr<void> {};
+        };
+        promise->on_rejection = [user_promise, cached_promise = lookup.promise](auto& error) {
+            user_promise->reject(Error::copy(error));
+            cached_promise->reject(Error::copy(error));
+        };
+        lookup.promise = move(promise);
+        return user_promise;
+    }
+
     ErrorOr<Messages::Message> parse_one_message()
     {
         if (m_mode == ConnectionMode::UDP)
@@ -666,7 +836,19 @@ private:
                 }
 
                 for (auto& record : message.answers)
-                    result->add_record(move(record));
+                    result->add_record_from_response(move(record));
+
+                if (result->records().is_empty() && is_negative_response(message)) {
+                    // NOTE: An empty answer for only some of the types we asked for in separate queries isn't negative, as
+                    //       the other queries may still find records.
+                    auto has_other_pending_lookups = false;
+                    for (auto& other_lookup : *lookups) {
+                        if (other_lookup.id != lookup->id && other_lookup.result.ptr() == result.ptr())
+                            has_other_pending_lookups = true;
+                    }
+                    if (message.header.options.response_code() == Messages::Options::ResponseCode::NameError || !has_other_pending_lookups)
+                        result->set_negative_cache_expiration(AK::UnixDateTime::now() + negative_cache_duration(message));
+                }
 
                 result->finished_request();
                 lookup->promise->resolve(*result);
@@ -1133,7 +1315,7 @@ private:
         if (!promise->is_rejected()) {
             // Typically you'd store these validated RRs in the lookup result.
             for (auto& record : rrset_with_rrsig.rrset)
-                result->add_record(move(record));
+                result->add_record_from_response(move(record));
 
             // Resolve with an empty success.
             promise->resolve({});
@@ -1180,6 +1362,29 @@ private:
         m_socket_ready_promises.clear();
     }
 
+    // https://www.rfc-editor.org/rfc/rfc2308#section-2
+    static bool is_negative_response(Messages::Message const& message)
+    {
+        auto response_code = message.header.options.response_code();
+        return response_code == Messages::Options::ResponseCode::NameError
+            || (response_code == Messages::Options::ResponseCode::NoError && message.answers.is_empty());
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    static AK::Duration negative_cache_duration(Messages::Message const& message)
+    {
+        // The TTL of a negative answer is the minimum of the SOA record's own TTL and its MINIMUM field.
+        for (auto const& record : message.authorities) {
+            if (auto const* soa = record.record.get_pointer<Messages::Records::SOA>()) {
+                auto seconds = min(record.ttl, soa->minimum);
+                return min(AK::Duration::from_seconds(seconds), LookupResult::max_negative_cache_duration);
+            }
+        }
+
+        // Without an SOA record, we don't know how long the answer holds, so only use it for the lookup at hand.
+        return AK::Duration::zero();
+    }
+
     void flush_cache()
     {
         m_cache.with_write_locked([&](auto& cache) {
@@ -1191,10 +1396,35 @@ private:
             }
             for (auto const& key : to_remove)
                 cache.remove(key);
+
+            if (cache.size() <= max_cache_entries)
+                return;
+
+            // Evict the least recently used entries that aren't waiting for a response, until we're comfortably below the limit
+            // again. This way, we don't have to do this on every lookup after hitting the limit.
+            struct EvictionCandidate {
+                u64 last_access { 0 };
+                ByteString name;
+            };
+            Vector<EvictionCandidate> candidates;
+            for (auto& entry : cache) {
+                if (entry.value->is_done() && !entry.value->is_permanent())
+                    candidates.append({ entry.value->last_access(), entry.key });
+            }
+            quick_sort(candidates, [](auto const& a, auto const& b) { return a.last_access < b.last_access; });
+
+            auto target_size = max_cache_entries - max_cache_entries / 8;
+            for (auto const& candidate : candidates) {
+                if (cache.size() <= target_size)
+                    break;
+                dbgln_if(DNS_DEBUG, "DNS: Evicting {} from cache", candidate.name);
+                cache.remove(candidate.name);
+            }
         });
     }
 
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
+    Atomic<u64> m_access_count { 0 };
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
@@ -42,7 +42,28 @@ void Connection::send_message(JsonValue const& message)
             dbgln("\x1b[1;32m<<\x1b[0m {}", serialized);
     }
 
-    if (m_socket->write_formatted("{}:{}", serialized.byte_count(), serialized).is_error()) {
+    // OPTIMIZATION: Inspecting a page tends to produce bursts of packets (responses to pipelined requests, DOM mutation
+    //               events, console messages, etc.). Rather than writing each of them to the socket on its own, we
+    //               collect them until the current pass of the event loop is done and write them all at once.
+    auto should_schedule_flush = m_pending_messages.is_empty();
+    m_pending_messages.appendff("{}:{}", serialized.byte_count(), serialized);
+
+    if (should_schedule_flush) {
+        Core::deferred_invoke([self = NonnullRefPtr { *this }]() {
+            self->flush_pending_messages();
+        });
+    }
+}
+
+void Connection::flush_pending_messages()
+{
+    if (m_pending_messages.is_empty())
+        return;
+
+    auto result = m_socket->write_until_depleted(m_pending_messages.string_view().bytes());
+    m_pending_messages.clear();
+
+    if (result.is_error()) {
         if (on_connection_closed)
             on_connection_closed();
     }
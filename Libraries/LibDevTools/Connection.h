@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
+#include <AK/StringBuilder.h>
 #include <LibCore/Socket.h>
 #include <LibDevTools/Forward.h>
 
@@ -29,10 +30,15 @@ public:
 private:
     explicit Connection(NonnullOwnPtr<Core::BufferedTCPSocket>);
 
+    void flush_pending_messages();
+
     ErrorOr<void> on_ready_to_read();
     ErrorOr<JsonValue> read_message();
 
     NonnullOwnPtr<Core::BufferedTCPSocket> m_socket;
+
+    // Packets that were sent during this pass of the event loop, which are written to the socket together at its end.
+    StringBuilder m_pending_messages;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
@@ -47,6 +48,12 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Returns true if this call was the one to mark the cell. Safe to race with other marking threads.
+    bool set_marked_atomically() { return !AK::atomic_exchange(&m_mark, true, AK::memory_order_relaxed); }
+
+    bool is_remembered() const { return m_remembered; }
+    void set_remembered(Badge<Heap>, bool b) { m_remembered = b; }
+
     enum class State : bool {
         Live,
         Dead,
@@ -189,6 +196,7 @@ protected:
 
 private:
     bool m_mark { false };
+    bool m_remembered { false };
     bool m_overrides_must_survive_garbage_collection { false };
     State m_state { State::Live };
 } SWIFT_UNSAFE_REFERENCE;
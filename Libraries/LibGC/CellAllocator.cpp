@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/QuickSort.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -36,13 +37,25 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     auto& block = *m_usable_blocks.last();
     auto* cell = block.allocate();
     VERIFY(cell);
+    if (!block.is_in_nursery()) {
+        block.set_in_nursery(true);
+        m_nursery_blocks.append(&block);
+    }
     if (block.is_full())
         m_full_blocks.append(*m_usable_blocks.last());
     return cell;
 }
 
+void CellAllocator::clear_nursery(Badge<Heap>)
+{
+    for (auto* block : m_nursery_blocks)
+        block->set_in_nursery(false);
+    m_nursery_blocks.clear_with_capacity();
+}
+
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
 {
+    VERIFY(!block.is_in_nursery());
     block.m_list_node.remove();
     // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
     block.~HeapBlock();
@@ -55,4 +68,24 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::sort_usable_blocks_by_occupancy(Badge<Heap>)
+{
+    // OPTIMIZATION: We never move cells, so the only way to get rid of a sparsely populated block is for all of its
+    //               cells to die. To give them the best chance of doing so, we allocate from the fullest usable block
+    //               first, and leave the emptiest ones alone so they can be returned to the BlockAllocator.
+    Vector<HeapBlock*> blocks;
+    for (auto& block : m_usable_blocks)
+        blocks.append(&block);
+    if (blocks.size() < 2)
+        return;
+
+    for (auto* block : blocks)
+        block->m_list_node.remove();
+
+    // NOTE: allocate_cell() allocates from the last usable block, so the fullest one goes last.
+    quick_sort(blocks, [](auto* a, auto* b) { return a->live_cell_count() < b->live_cell_count(); });
+    for (auto* block : blocks)
+        m_usable_blocks.append(*block);
+}
+
 }
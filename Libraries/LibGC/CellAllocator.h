@@ -9,6 +9,7 @@
 #include <AK/IntrusiveList.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/Forward.h>
 #include <LibGC/HeapBlock.h>
@@ -27,6 +28,7 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
 
     Cell* allocate_cell(Heap&);
 
@@ -44,8 +46,23 @@ public:
         return IterationDecision::Continue;
     }
 
+    // The nursery is the set of blocks that have had cells allocated in them since the last collection.
+    // Only these blocks can contain young cells, so minor collections never need to look at any other block.
+    template<typename Callback>
+    IterationDecision for_each_nursery_block(Callback callback)
+    {
+        for (auto* block : m_nursery_blocks) {
+            if (callback(*block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    }
+
+    void clear_nursery(Badge<Heap>);
+
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    void sort_usable_blocks_by_occupancy(Badge<Heap>);
 
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
@@ -63,6 +80,7 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    Vector<HeapBlock*> m_nursery_blocks;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
 };
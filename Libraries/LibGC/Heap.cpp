@@ -12,6 +12,8 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
@@ -20,6 +22,8 @@
 #include <LibGC/HeapBlock.h>
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -52,15 +56,56 @@ void Heap::will_allocate(size_t size)
     if (should_collect_on_every_allocation()) {
         m_allocated_bytes_since_last_gc = 0;
         collect_garbage();
-    } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
+    } else if (m_generational_collection_enabled && m_allocated_bytes_since_last_gc + size > GC_NURSERY_BYTES_THRESHOLD) {
+        m_allocated_bytes_since_last_gc = 0;
+        collect_garbage(CollectionType::CollectYoungGeneration);
+    } else if (m_incremental_marking_enabled && !is_incremental_marking_in_progress() && m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
+        start_incremental_marking();
+    } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold * (is_incremental_marking_in_progress() ? 2 : 1)) {
+        // If the mutator outpaces incremental marking by too much, we have to finish the job synchronously.
         m_allocated_bytes_since_last_gc = 0;
         collect_garbage();
     }
 
     m_allocated_bytes_since_last_gc += size;
+    ++m_total_allocation_count;
+    m_total_allocated_bytes += size;
+
+    if (size >= m_bytes_until_next_allocation_sample) [[unlikely]]
+        sample_allocation(size);
+    else
+        m_bytes_until_next_allocation_sample -= size;
+}
+
+void Heap::sample_allocation(size_t size)
+{
+    if (!m_describe_allocation_site) {
+        m_bytes_until_next_allocation_sample = NumericLimits<u64>::max();
+        return;
+    }
+    m_bytes_until_next_allocation_sample = m_allocation_sample_interval;
+
+    auto& site = m_sampled_allocation_sites.ensure(m_describe_allocation_site());
+    ++site.samples;
+    site.sampled_bytes += size;
+}
+
+void Heap::start_sampling_allocations(size_t interval, AK::Function<String()> describe_allocation_site)
+{
+    VERIFY(interval > 0);
+    m_allocation_sample_interval = interval;
+    m_bytes_until_next_allocation_sample = interval;
+    m_describe_allocation_site = move(describe_allocation_site);
+    m_sampled_allocation_sites.clear();
+}
+
+void Heap::stop_sampling_allocations()
+{
+    m_bytes_until_next_allocation_sample = NumericLimits<u64>::max();
+    m_describe_allocation_site = nullptr;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+static void add_possible_value(PossiblePointers& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
@@ -73,14 +118,14 @@ static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, Fl
             possible_pointer = data;
         if (possible_pointer < min_block_address || possible_pointer > max_block_address)
             return;
-        possible_pointers.set(possible_pointer, move(origin));
+        possible_pointers.append({ possible_pointer, move(origin) });
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
         if (data < min_block_address || data > max_block_address)
             return;
         // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
         // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
+        possible_pointers.append({ data, move(origin) });
     }
 }
 
@@ -95,16 +140,30 @@ void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_a
 }
 
 template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, PossiblePointers& possible_pointers, Callback callback)
 {
-    for (auto possible_pointer : possible_pointers.keys()) {
+    // OPTIMIZATION: Values are collected into a flat vector rather than a hash map when scanning, since most of them
+    //               are rejected anyway. Sorting them afterwards lets us skip duplicates, and makes the values that
+    //               point into the same block adjacent so we only need to look that block up once.
+    quick_sort(possible_pointers, [](auto const& a, auto const& b) { return a.address < b.address; });
+
+    HeapBlock* last_heap_block = nullptr;
+    bool last_heap_block_is_live = false;
+    for (size_t i = 0; i < possible_pointers.size(); ++i) {
+        auto possible_pointer = possible_pointers[i].address;
         if (!possible_pointer)
             continue;
+        if (i > 0 && possible_pointers[i - 1].address == possible_pointer)
+            continue;
         auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
+        if (possible_heap_block != last_heap_block) {
+            last_heap_block = possible_heap_block;
+            last_heap_block_is_live = all_live_heap_blocks.contains(possible_heap_block);
+        }
+        if (!last_heap_block_is_live)
             continue;
         if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
-            callback(cell, possible_pointer);
+            callback(cell, possible_pointers[i].origin);
         }
     }
 }
@@ -143,13 +202,13 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
+        PossiblePointers possible_pointers;
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, HeapRoot const&) {
             if (m_node_being_visited)
                 m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(cell));
 
@@ -228,6 +287,106 @@ private:
     FlatPtr m_max_block_address;
 };
 
+AK::JsonObject Heap::statistics()
+{
+    static constexpr size_t number_of_occupancy_buckets = 10;
+
+    size_t total_live_cells = 0;
+    size_t total_live_bytes = 0;
+    size_t total_blocks = 0;
+
+    AK::JsonArray allocators;
+    for (auto& allocator : m_all_cell_allocators) {
+        size_t live_cells = 0;
+        size_t blocks = 0;
+        Array<size_t, number_of_occupancy_buckets> blocks_by_occupancy {};
+
+        allocator.for_each_block([&](HeapBlock& block) {
+            size_t live_cells_in_block = 0;
+            block.for_each_cell_in_state<Cell::State::Live>([&](Cell*) {
+                ++live_cells_in_block;
+            });
+            live_cells += live_cells_in_block;
+            ++blocks;
+            ++blocks_by_occupancy[min(live_cells_in_block * number_of_occupancy_buckets / block.cell_count(), number_of_occupancy_buckets - 1)];
+            return IterationDecision::Continue;
+        });
+
+        if (blocks == 0)
+            continue;
+
+        auto live_bytes = live_cells * allocator.cell_size();
+        total_live_cells += live_cells;
+        total_live_bytes += live_bytes;
+        total_blocks += blocks;
+
+        AK::JsonArray occupancy;
+        for (auto count : blocks_by_occupancy)
+            occupancy.must_append(count);
+
+        AK::JsonObject object;
+        if (auto const* class_name = allocator.class_name())
+            object.set("className"sv, MUST(String::from_utf8(StringView { class_name, strlen(class_name) })));
+        object.set("cellSize"sv, allocator.cell_size());
+        object.set("liveCells"sv, live_cells);
+        object.set("liveBytes"sv, live_bytes);
+        object.set("blocks"sv, blocks);
+        // The share of the memory in this allocator's blocks that isn't taken by a live cell.
+        object.set("fragmentation"sv, 1.0 - static_cast<double>(live_bytes) / static_cast<double>(blocks * HeapBlock::block_size));
+        // The number of blocks that are 0-10% full, 10-20% full, and so on.
+        object.set("blocksByOccupancy"sv, move(occupancy));
+        allocators.must_append(move(object));
+    }
+
+    AK::JsonArray collections;
+    for (auto const& collection : m_recent_collections) {
+        AK::JsonObject object;
+        object.set("type"sv, collection.type == CollectionType::CollectYoungGeneration ? "minor"sv : "full"sv);
+        object.set("rootGathering"sv, collection.root_gathering.to_nanoseconds() / 1'000'000.0);
+        object.set("conservativeScan"sv, collection.conservative_scan.to_nanoseconds() / 1'000'000.0);
+        object.set("marking"sv, collection.marking.to_nanoseconds() / 1'000'000.0);
+        object.set("finalization"sv, collection.finalization.to_nanoseconds() / 1'000'000.0);
+        object.set("sweeping"sv, collection.sweeping.to_nanoseconds() / 1'000'000.0);
+        object.set("liveCells"sv, collection.live_cells);
+        object.set("collectedCells"sv, collection.collected_cells);
+        collections.must_append(move(object));
+    }
+
+    struct SampledSite {
+        StringView description;
+        AllocationSite site;
+    };
+    Vector<SampledSite> sites;
+    for (auto const& [description, site] : m_sampled_allocation_sites)
+        sites.append({ description, site });
+    quick_sort(sites, [](auto const& a, auto const& b) { return a.site.samples > b.site.samples; });
+
+    AK::JsonArray allocation_sites;
+    for (auto const& [description, site] : sites) {
+        AK::JsonObject object;
+        object.set("site"sv, description);
+        object.set("samples"sv, site.samples);
+        object.set("sampledBytes"sv, site.sampled_bytes);
+        // NOTE: Each sample stands in for all the bytes allocated since the previous one.
+        object.set("estimatedBytes"sv, static_cast<u64>(site.samples) * m_allocation_sample_interval);
+        allocation_sites.must_append(move(object));
+    }
+
+    AK::JsonObject statistics;
+    statistics.set("liveCells"sv, total_live_cells);
+    statistics.set("liveBytes"sv, total_live_bytes);
+    statistics.set("blocks"sv, total_blocks);
+    statistics.set("blockBytes"sv, total_blocks * HeapBlock::block_size);
+    statistics.set("totalAllocationCount"sv, m_total_allocation_count);
+    statistics.set("totalAllocatedBytes"sv, m_total_allocated_bytes);
+    statistics.set("collectionCount"sv, m_collection_count);
+    statistics.set("timeSpentCollectingGarbage"sv, m_time_spent_collecting_garbage.to_nanoseconds() / 1'000'000.0);
+    statistics.set("cellAllocators"sv, move(allocators));
+    statistics.set("recentCollections"sv, move(collections));
+    statistics.set("allocationSites"sv, move(allocation_sites));
+    return statistics;
+}
+
 AK::JsonObject Heap::dump_graph()
 {
     HashMap<Cell*, HeapRoot> roots;
@@ -237,28 +396,98 @@ AK::JsonObject Heap::dump_graph()
     return visitor.dump();
 }
 
+void Heap::set_generational_collection_enabled(bool enabled)
+{
+    VERIFY(!m_collecting_garbage);
+    VERIFY(!enabled || !m_incremental_marking_enabled);
+    if (m_generational_collection_enabled == enabled)
+        return;
+
+    // Outside of generational mode, every cell is expected to be unmarked between collections.
+    if (!enabled) {
+        clear_remembered_set();
+        clear_all_mark_bits();
+    }
+    m_generational_collection_enabled = enabled;
+}
+
+void Heap::set_incremental_marking_enabled(bool enabled)
+{
+    VERIFY(!m_collecting_garbage);
+    VERIFY(!enabled || !m_generational_collection_enabled);
+    if (m_incremental_marking_enabled == enabled)
+        return;
+
+    if (!enabled && is_incremental_marking_in_progress())
+        abandon_incremental_marking();
+    m_incremental_marking_enabled = enabled;
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
 
+    if (collection_type == CollectionType::CollectYoungGeneration) {
+        // Once minor collections have promoted as much as the whole heap was worth after the last full
+        // collection, it's time to find out how much of the old generation is actually still alive.
+        if (!m_generational_collection_enabled || m_promoted_bytes_since_last_full_gc > m_gc_bytes_threshold)
+            collection_type = CollectionType::CollectGarbage;
+    }
+
     {
         TemporaryChange change(m_collecting_garbage, true);
 
+        auto collection_start = MonotonicTime::now();
+        ScopeGuard record_collection_time = [&] { m_time_spent_collecting_garbage += MonotonicTime::now() - collection_start; };
+
         Core::ElapsedTimer collection_measurement_timer;
         if (print_report)
             collection_measurement_timer.start();
 
-        if (collection_type == CollectionType::CollectGarbage) {
+        if (collection_type != CollectionType::CollectEverything) {
             if (m_gc_deferrals) {
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+        }
+
+        ++m_collection_count;
+        m_current_collection_statistics = { .type = collection_type };
+        auto marking_start_time = MonotonicTime::now();
+
+        // Survivors of previous collections are still marked in generational mode. A full collection
+        // has to start over from scratch.
+        if (m_generational_collection_enabled && collection_type != CollectionType::CollectYoungGeneration)
+            clear_all_mark_bits();
+
+        if (is_incremental_marking_in_progress()) {
+            if (collection_type == CollectionType::CollectEverything)
+                abandon_incremental_marking();
+            else
+                finish_incremental_marking();
+        } else if (collection_type != CollectionType::CollectEverything) {
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
-            mark_live_cells(roots);
+            mark_live_cells(roots, collection_type);
         }
-        finalize_unmarked_cells();
-        sweep_dead_cells(print_report, collection_measurement_timer);
+
+        // Every cell that survives this collection becomes old, so there are no old-to-young edges left to remember.
+        clear_remembered_set();
+
+        auto finalization_start_time = MonotonicTime::now();
+        m_current_collection_statistics.marking = finalization_start_time - marking_start_time - m_current_collection_statistics.root_gathering;
+
+        finalize_unmarked_cells(collection_type);
+
+        auto sweeping_start_time = MonotonicTime::now();
+        m_current_collection_statistics.finalization = sweeping_start_time - finalization_start_time;
+
+        sweep_dead_cells(print_report, collection_measurement_timer, collection_type);
+        m_current_collection_statistics.sweeping = MonotonicTime::now() - sweeping_start_time;
+
+        if (m_recent_collections.size() == max_recent_collections)
+            m_recent_collections.remove(0);
+        m_recent_collections.append(m_current_collection_statistics);
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -273,8 +502,14 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 
 void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 {
+    auto start_time = MonotonicTime::now();
+    ScopeGuard record_root_gathering_time = [&] { m_current_collection_statistics.root_gathering += MonotonicTime::now() - start_time; };
+
     m_gather_embedder_roots(roots);
+
+    auto conservative_scan_start_time = MonotonicTime::now();
     gather_conservative_roots(roots);
+    m_current_collection_statistics.conservative_scan += MonotonicTime::now() - conservative_scan_start_time;
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -293,7 +528,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(PossiblePointers& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -309,7 +544,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(PossiblePointers&, FlatPtr, FlatPtr, FlatPtr)
 {
 }
 #endif
@@ -323,7 +558,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
+    PossiblePointers possible_pointers;
 
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
@@ -353,10 +588,10 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         return IterationDecision::Continue;
     });
 
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
+    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, HeapRoot const& origin) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
+            roots.set(cell, origin);
         } else {
             dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
         }
@@ -367,13 +602,24 @@ class MarkingVisitor final : public Cell::Visitor {
 public:
     explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
         : m_heap(heap)
+    {
+        update_heap_block_addresses();
+        visit_roots(roots);
+    }
+
+    // Blocks may have been allocated since marking started if it's done incrementally.
+    void update_heap_block_addresses()
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
+        m_all_live_heap_blocks.clear_with_capacity();
         m_heap.for_each_block([&](auto& block) {
             m_all_live_heap_blocks.set(&block);
             return IterationDecision::Continue;
         });
+    }
 
+    void visit_roots(HashMap<Cell*, HeapRoot> const& roots)
+    {
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -391,13 +637,13 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
+        PossiblePointers possible_pointers;
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, HeapRoot const&) {
             if (cell->is_marked())
                 return;
             if (cell->state() != Cell::State::Live)
@@ -414,6 +660,21 @@ public:
         }
     }
 
+    // Returns true if the work queue was drained before the budget ran out.
+    bool mark_live_cells_within_budget(Core::ElapsedTimer const& timer, AK::Duration budget)
+    {
+        // Checking the clock after every single cell would cost more than the marking itself.
+        static constexpr size_t cells_per_budget_check = 256;
+
+        while (!m_work_queue.is_empty()) {
+            for (size_t i = 0; i < cells_per_budget_check && !m_work_queue.is_empty(); ++i)
+                m_work_queue.take_last()->visit_edges(*this);
+            if (timer.elapsed_time() >= budget)
+                return m_work_queue.is_empty();
+        }
+        return true;
+    }
+
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
@@ -422,18 +683,216 @@ private:
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+// Shared between all threads taking part in a parallel mark. Each thread traces from its own local mark stack,
+// and only goes through the mutex to donate surplus work to, or take work from, the shared list of chunks.
+struct ParallelMarkingState {
+    Threading::Mutex mutex;
+    Vector<Vector<Cell*>> shared_chunks;
+    size_t shared_chunk_count { 0 };
+    size_t idle_thread_count { 0 };
+    size_t thread_count { 0 };
+
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    FlatPtr min_block_address { 0 };
+    FlatPtr max_block_address { 0 };
+};
+
+class ParallelMarkingVisitor final : public Cell::Visitor {
+public:
+    explicit ParallelMarkingVisitor(ParallelMarkingState& state)
+        : m_state(state)
+    {
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        if (cell.is_marked() || !cell.set_marked_atomically())
+            return;
+        m_local_stack.append(&cell);
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        PossiblePointers possible_pointers;
+
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_state.min_block_address, m_state.max_block_address);
+
+        for_each_cell_among_possible_pointers(m_state.all_live_heap_blocks, possible_pointers, [&](Cell* cell, HeapRoot const&) {
+            if (cell->state() != Cell::State::Live)
+                return;
+            visit_impl(*cell);
+        });
+    }
+
+    void mark_all_live_cells()
+    {
+        for (;;) {
+            while (!m_local_stack.is_empty()) {
+                m_local_stack.take_last()->visit_edges(*this);
+                if (m_local_stack.size() >= donation_threshold)
+                    donate_work();
+            }
+            if (!take_work())
+                return;
+        }
+    }
+
+private:
+    static constexpr size_t donation_threshold = 256;
+
+    void donate_work()
+    {
+        // Only bother other threads with work if they might be running out.
+        if (AK::atomic_load(&m_state.shared_chunk_count, AK::memory_order_relaxed) >= m_state.thread_count)
+            return;
+
+        Vector<Cell*> chunk;
+        chunk.ensure_capacity(m_local_stack.size() / 2);
+        for (size_t i = 0; i < m_local_stack.size() / 2; ++i)
+            chunk.unchecked_append(m_local_stack[i]);
+        m_local_stack.remove(0, chunk.size());
+
+        Threading::MutexLocker locker(m_state.mutex);
+        m_state.shared_chunks.append(move(chunk));
+        AK::atomic_store(&m_state.shared_chunk_count, m_state.shared_chunks.size(), AK::memory_order_release);
+    }
+
+    bool try_take_shared_chunk()
+    {
+        if (AK::atomic_load(&m_state.shared_chunk_count, AK::memory_order_acquire) == 0)
+            return false;
+        Threading::MutexLocker locker(m_state.mutex);
+        if (m_state.shared_chunks.is_empty())
+            return false;
+        m_local_stack = m_state.shared_chunks.take_last();
+        AK::atomic_store(&m_state.shared_chunk_count, m_state.shared_chunks.size(), AK::memory_order_release);
+        return true;
+    }
+
+    // Returns false once every thread has run out of work, which means marking is complete.
+    bool take_work()
+    {
+        if (try_take_shared_chunk())
+            return true;
+
+        // Only threads that still have work can donate more, so once every thread is idle, nothing can produce work anymore.
+        AK::atomic_fetch_add(&m_state.idle_thread_count, static_cast<size_t>(1), AK::memory_order_acq_rel);
+        for (;;) {
+            if (AK::atomic_load(&m_state.shared_chunk_count, AK::memory_order_acquire) > 0) {
+                AK::atomic_fetch_sub(&m_state.idle_thread_count, static_cast<size_t>(1), AK::memory_order_acq_rel);
+                if (try_take_shared_chunk())
+                    return true;
+                AK::atomic_fetch_add(&m_state.idle_thread_count, static_cast<size_t>(1), AK::memory_order_acq_rel);
+                continue;
+            }
+            if (AK::atomic_load(&m_state.idle_thread_count, AK::memory_order_acquire) == m_state.thread_count)
+                return false;
+            AK::atomic_pause();
+        }
+    }
+
+    ParallelMarkingState& m_state;
+    Vector<Cell*> m_local_stack;
+};
+
+bool Heap::should_mark_in_parallel(CollectionType collection_type) const
+{
+    if (collection_type != CollectionType::CollectGarbage)
+        return false;
+    if (m_parallel_marking_thread_count <= 1)
+        return false;
+    return m_gc_bytes_threshold >= m_parallel_marking_heap_size_threshold;
+}
+
+void Heap::mark_live_cells_in_parallel(HashMap<Cell*, HeapRoot> const& roots)
+{
+    dbgln_if(HEAP_DEBUG, "mark_live_cells_in_parallel: {} threads", m_parallel_marking_thread_count);
+
+    ParallelMarkingState state;
+    state.thread_count = m_parallel_marking_thread_count;
+    find_min_and_max_block_addresses(state.min_block_address, state.max_block_address);
+    for_each_block([&](auto& block) {
+        state.all_live_heap_blocks.set(&block);
+        return IterationDecision::Continue;
+    });
+
+    // Deal the roots out round-robin, so every thread has something to start with.
+    state.shared_chunks.resize(state.thread_count);
+    size_t root_index = 0;
+    for (auto* root : roots.keys()) {
+        if (!root->set_marked_atomically())
+            continue;
+        state.shared_chunks[root_index++ % state.thread_count].append(root);
+    }
+    state.shared_chunks.remove_all_matching([](auto& chunk) { return chunk.is_empty(); });
+    state.shared_chunk_count = state.shared_chunks.size();
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    threads.ensure_capacity(state.thread_count - 1);
+    for (size_t i = 1; i < state.thread_count; ++i) {
+        auto thread = Threading::Thread::construct([&state] {
+            ParallelMarkingVisitor visitor(state);
+            visitor.mark_all_live_cells();
+            return static_cast<intptr_t>(0);
+        },
+            "GC Marker"sv);
+        thread->start();
+        threads.unchecked_append(move(thread));
+    }
+
+    ParallelMarkingVisitor visitor(state);
+    visitor.mark_all_live_cells();
+
+    for (auto& thread : threads)
+        (void)thread->join();
+}
+
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, CollectionType collection_type)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
+    if (should_mark_in_parallel(collection_type)) {
+        mark_live_cells_in_parallel(roots);
+        MarkingVisitor visitor(*this, {});
+        finish_marking(visitor, collection_type);
+        return;
+    }
+
+    // Old cells are still marked here. They won't be swept by a minor collection, so leave them for the next full one.
+    Vector<Ptr<Cell>> old_uprooted_cells;
+    if (collection_type == CollectionType::CollectYoungGeneration) {
+        m_uprooted_cells.remove_all_matching([&](auto& cell) {
+            if (!cell->is_marked())
+                return false;
+            old_uprooted_cells.append(cell);
+            return true;
+        });
+    }
+
     MarkingVisitor visitor(*this, roots);
 
+    // The visitor doesn't trace through cells that are already marked, which in a minor collection means the entire
+    // old generation. The only old cells that can point at young ones are those caught by the write barrier.
+    if (collection_type == CollectionType::CollectYoungGeneration) {
+        for (auto* cell : m_remembered_set)
+            cell->visit_edges(visitor);
+    }
+
     visitor.mark_all_live_cells();
 
+    finish_marking(visitor, collection_type);
+
+    m_uprooted_cells = move(old_uprooted_cells);
+}
+
+void Heap::finish_marking(MarkingVisitor& visitor, CollectionType collection_type)
+{
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
 
-    for_each_block([&](auto& block) {
+    for_each_block_to_collect(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
                 cell->visit_edges(visitor);
@@ -444,6 +903,78 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
     m_uprooted_cells.clear();
 }
 
+void Heap::start_incremental_marking()
+{
+    VERIFY(!m_collecting_garbage);
+    VERIFY(!is_incremental_marking_in_progress());
+
+    dbgln_if(HEAP_DEBUG, "start_incremental_marking:");
+
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+    m_incremental_marking_visitor = make<MarkingVisitor>(*this, roots);
+}
+
+bool Heap::perform_incremental_marking_step(AK::Duration budget)
+{
+    if (!is_incremental_marking_in_progress() || m_collecting_garbage)
+        return false;
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    {
+        TemporaryChange change(m_collecting_garbage, true);
+        ScopeGuard record_marking_time = [&] { m_time_spent_collecting_garbage += timer.elapsed_time(); };
+
+        // Cells caught by the write barrier since the last slice are gray again.
+        for (auto* cell : m_remembered_set)
+            cell->visit_edges(*m_incremental_marking_visitor);
+        clear_remembered_set();
+
+        if (!m_incremental_marking_visitor->mark_live_cells_within_budget(timer, budget))
+            return false;
+    }
+
+    if (m_gc_deferrals)
+        return false;
+
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+    return true;
+}
+
+void Heap::finish_incremental_marking()
+{
+    dbgln_if(HEAP_DEBUG, "finish_incremental_marking:");
+
+    auto visitor = m_incremental_marking_visitor.release_nonnull();
+
+    // The mutator has been running since marking started, so we have to take another look at the roots,
+    // and trace through everything that has been stored into already marked cells. This is the only
+    // part of incremental marking that runs without interruption.
+    visitor->update_heap_block_addresses();
+
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+    visitor->visit_roots(roots);
+
+    for (auto* cell : m_remembered_set)
+        cell->visit_edges(*visitor);
+
+    visitor->mark_all_live_cells();
+
+    finish_marking(*visitor, CollectionType::CollectGarbage);
+}
+
+void Heap::abandon_incremental_marking()
+{
+    dbgln_if(HEAP_DEBUG, "abandon_incremental_marking:");
+
+    m_incremental_marking_visitor = nullptr;
+    clear_remembered_set();
+    clear_all_mark_bits();
+}
+
 bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 {
     if (!cell.overrides_must_survive_garbage_collection({}))
@@ -451,9 +982,9 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
     return cell.must_survive_garbage_collection();
 }
 
-void Heap::finalize_unmarked_cells()
+void Heap::finalize_unmarked_cells(CollectionType collection_type)
 {
-    for_each_block([&](auto& block) {
+    for_each_block_to_collect(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked())
                 cell->finalize();
@@ -462,7 +993,24 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::clear_all_mark_bits()
+{
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+            cell->set_marked(false);
+        });
+        return IterationDecision::Continue;
+    });
+}
+
+void Heap::clear_remembered_set()
+{
+    for (auto* cell : m_remembered_set)
+        cell->set_remembered({}, false);
+    m_remembered_set.clear_with_capacity();
+}
+
+void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer, CollectionType collection_type)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
@@ -473,7 +1021,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
-    for_each_block([&](auto& block) {
+    for_each_block_to_collect(collection_type, [&](auto& block) {
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
@@ -483,7 +1031,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
-                cell->set_marked(false);
+                // In generational mode, the mark bit is what makes a surviving cell part of the old generation.
+                if (!m_generational_collection_enabled)
+                    cell->set_marked(false);
                 block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
@@ -499,6 +1049,10 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
+    // Must be done before releasing any empty blocks, since the nursery holds on to raw block pointers.
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.clear_nursery({});
+
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
         block->cell_allocator().block_did_become_empty({}, *block);
@@ -509,6 +1063,11 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    if (collection_type != CollectionType::CollectYoungGeneration) {
+        for (auto& allocator : m_all_cell_allocators)
+            allocator.sort_usable_blocks_by_occupancy({});
+    }
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
@@ -516,7 +1075,16 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_current_collection_statistics.live_cells = live_cells;
+    m_current_collection_statistics.collected_cells = collected_cells;
+
+    if (collection_type == CollectionType::CollectYoungGeneration) {
+        // NOTE: Nursery blocks may also contain old cells, so this overestimates the promoted bytes a bit.
+        m_promoted_bytes_since_last_full_gc += live_cell_bytes;
+    } else {
+        m_promoted_bytes_since_last_full_gc = 0;
+        m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    }
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -528,6 +1096,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 
         dbgln("Garbage collection report");
         dbgln("=============================================");
+        dbgln("Collection type: {}", collection_type == CollectionType::CollectYoungGeneration ? "Minor"sv : "Full"sv);
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
@@ -8,12 +8,17 @@
 
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/NumericLimits.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
+#include <AK/String.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -30,6 +35,15 @@
 
 namespace GC {
 
+class MarkingVisitor;
+
+// A value that may or may not point into a HeapBlock, found while scanning memory conservatively.
+struct PossiblePointer {
+    FlatPtr address { 0 };
+    HeapRoot origin;
+};
+using PossiblePointers = Vector<PossiblePointer>;
+
 class GC_API Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -51,14 +65,87 @@ public:
     enum class CollectionType {
         CollectGarbage,
         CollectEverything,
+        // Only traces and sweeps cells allocated since the last collection. Falls back to CollectGarbage
+        // unless generational collection has been enabled.
+        CollectYoungGeneration,
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // The total time spent in collections and incremental marking slices since the heap was created.
+    AK::Duration time_spent_collecting_garbage() const { return m_time_spent_collecting_garbage; }
+
+    // The number of collections that have run, and the number of cells and bytes allocated in total, since the heap was
+    // created.
+    size_t collection_count() const { return m_collection_count; }
+    u64 total_allocation_count() const { return m_total_allocation_count; }
+    u64 total_allocated_bytes() const { return m_total_allocated_bytes; }
+
+    // How long the phases of a collection took.
+    // NOTE: The conservative scan of the stack and registers is part of gathering the roots.
+    struct CollectionStatistics {
+        CollectionType type { CollectionType::CollectGarbage };
+        AK::Duration root_gathering;
+        AK::Duration conservative_scan;
+        AK::Duration marking;
+        AK::Duration finalization;
+        AK::Duration sweeping;
+        size_t live_cells { 0 };
+        size_t collected_cells { 0 };
+    };
+    Vector<CollectionStatistics> const& recent_collections() const { return m_recent_collections; }
+
+    // Returns the live cells and bytes of each cell allocator along with how full its blocks are, the statistics of
+    // the most recent collections, and the allocation sites that have been sampled. This looks at every cell in the
+    // heap, so it's not meant to be called often.
+    AK::JsonObject statistics();
+
+    // While sampling, about one allocation per `interval` bytes allocated is attributed to the allocation site that the
+    // callback describes, such as the JavaScript call stack. The sampled sites are part of the statistics.
+    void start_sampling_allocations(size_t interval, AK::Function<String()> describe_allocation_site);
+    void stop_sampling_allocations();
+
+    // Full collections of heaps that were at least this large after the previous collection are
+    // marked by this many threads in parallel (including the collecting thread).
+    // NOTE: This requires every visit_edges() implementation in the heap to be safe to run concurrently.
+    void set_parallel_marking_options(size_t thread_count, size_t heap_size_threshold)
+    {
+        m_parallel_marking_thread_count = thread_count;
+        m_parallel_marking_heap_size_threshold = heap_size_threshold;
+    }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // In generational mode, cells that survive a collection keep their mark bit and become part of the old
+    // generation. Minor collections only trace young cells, so every store of a cell reference into an
+    // already-old cell must be reported via write_barrier() for the referenced cell to be kept alive.
+    // NOTE: This is opt-in, as embedders are responsible for making sure all such stores go through the barrier.
+    bool is_generational_collection_enabled() const { return m_generational_collection_enabled; }
+    void set_generational_collection_enabled(bool);
+
+    // In incremental mode, marking is spread out over multiple slices with the mutator running in between.
+    // The write barrier then keeps the tri-color invariant by turning marked cells that get new references
+    // stored in them gray again, so their edges are traced once more before marking finishes.
+    // NOTE: This is opt-in for the same reason as generational mode, and the two can't be combined.
+    bool is_incremental_marking_enabled() const { return m_incremental_marking_enabled; }
+    void set_incremental_marking_enabled(bool);
+    bool is_incremental_marking_in_progress() const { return m_incremental_marking_visitor; }
+
+    // Returns true if marking completed during this slice and the collection was finished.
+    bool perform_incremental_marking_step(AK::Duration budget);
+
+    ALWAYS_INLINE void write_barrier(Cell& owner)
+    {
+        if (!owner.is_marked() || owner.is_remembered())
+            return;
+        if (!m_generational_collection_enabled && !m_incremental_marking_visitor)
+            return;
+        owner.set_remembered({}, true);
+        m_remembered_set.append(&owner);
+    }
+
     void did_create_root(Badge<RootImpl>, RootImpl&);
     void did_destroy_root(Badge<RootImpl>, RootImpl&);
 
@@ -106,14 +193,23 @@ private:
     }
 
     void will_allocate(size_t);
+    void sample_allocation(size_t);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
-    void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void gather_asan_fake_stack_roots(PossiblePointers&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, CollectionType);
+    void finish_marking(MarkingVisitor&, CollectionType);
+    bool should_mark_in_parallel(CollectionType) const;
+    void mark_live_cells_in_parallel(HashMap<Cell*, HeapRoot> const& roots);
+    void start_incremental_marking();
+    void finish_incremental_marking();
+    void abandon_incremental_marking();
+    void finalize_unmarked_cells(CollectionType);
+    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&, CollectionType);
+    void clear_all_mark_bits();
+    void clear_remembered_set();
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -135,11 +231,43 @@ private:
         }
     }
 
+    template<typename Callback>
+    void for_each_nursery_block(Callback callback)
+    {
+        for (auto& allocator : m_all_cell_allocators) {
+            if (allocator.for_each_nursery_block(callback) == IterationDecision::Break)
+                return;
+        }
+    }
+
+    // Visits the blocks that may contain cells a collection of the given type has to look at.
+    template<typename Callback>
+    void for_each_block_to_collect(CollectionType collection_type, Callback callback)
+    {
+        if (collection_type == CollectionType::CollectYoungGeneration)
+            for_each_nursery_block(move(callback));
+        else
+            for_each_block(move(callback));
+    }
+
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
+    static constexpr size_t GC_NURSERY_BYTES_THRESHOLD { 2 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
+    // Bytes promoted into the old generation by minor collections since the last full collection.
+    size_t m_promoted_bytes_since_last_full_gc { 0 };
+
     bool m_should_collect_on_every_allocation { false };
+    bool m_generational_collection_enabled { false };
+    bool m_incremental_marking_enabled { false };
+
+    size_t m_parallel_marking_thread_count { 0 };
+    size_t m_parallel_marking_heap_size_threshold { 0 };
+
+    OwnPtr<MarkingVisitor> m_incremental_marking_visitor;
+
+    Vector<Cell*> m_remembered_set;
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
@@ -155,6 +283,24 @@ private:
     size_t m_gc_deferrals { 0 };
     bool m_should_gc_when_deferral_ends { false };
 
+    AK::Duration m_time_spent_collecting_garbage;
+    size_t m_collection_count { 0 };
+    u64 m_total_allocation_count { 0 };
+    u64 m_total_allocated_bytes { 0 };
+
+    static constexpr size_t max_recent_collections = 16;
+    CollectionStatistics m_current_collection_statistics;
+    Vector<CollectionStatistics> m_recent_collections;
+
+    struct AllocationSite {
+        size_t samples { 0 };
+        u64 sampled_bytes { 0 };
+    };
+    size_t m_allocation_sample_interval { 0 };
+    u64 m_bytes_until_next_allocation_sample { NumericLimits<u64>::max() };
+    AK::Function<String()> m_describe_allocation_site;
+    HashMap<String, AllocationSite> m_sampled_allocation_sites;
+
     bool m_collecting_garbage { false };
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
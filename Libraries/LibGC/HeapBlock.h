@@ -31,6 +31,7 @@ public:
     size_t cell_size() const { return m_cell_size; }
     size_t cell_count() const { return (block_size - sizeof(HeapBlock)) / m_cell_size; }
     bool is_full() const { return !has_lazy_freelist() && !m_freelist; }
+    size_t live_cell_count() const { return m_live_cell_count; }
 
     ALWAYS_INLINE Cell* allocate()
     {
@@ -44,6 +45,7 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            ++m_live_cell_count;
         }
         return allocated_cell;
     }
@@ -92,6 +94,9 @@ public:
 
     CellAllocator& cell_allocator() { return m_cell_allocator; }
 
+    bool is_in_nursery() const { return m_in_nursery; }
+    void set_in_nursery(bool b) { m_in_nursery = b; }
+
 private:
     HeapBlock(Heap&, CellAllocator&, size_t cell_size);
 
@@ -111,6 +116,8 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
+    bool m_in_nursery { false };
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
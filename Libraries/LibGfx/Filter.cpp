@@ -9,6 +9,8 @@
 #include <LibGfx/SkiaUtils.h>
 #include <core/SkBlendMode.h>
 #include <core/SkColorFilter.h>
+#include <core/SkMatrix.h>
+#include <core/SkSamplingOptions.h>
 #include <effects/SkColorMatrix.h>
 #include <effects/SkImageFilters.h>
 
@@ -59,11 +61,38 @@ Filter Filter::blend(Optional<Filter const&> background, Optional<Filter const&>
     return Filter(Impl::create(filter));
 }
 
+// Blurs with a larger standard deviation than this are done at a lower resolution.
+static constexpr float maximum_full_resolution_blur_radius = 16.0f;
+
+// ...but never at less than this fraction of the full resolution.
+static constexpr float minimum_blur_scale = 1.0f / 8.0f;
+
+static float scale_for_blur_radius(float radius)
+{
+    auto scale = 1.0f;
+    while (radius * scale > maximum_full_resolution_blur_radius && scale > minimum_blur_scale)
+        scale /= 2;
+    return scale;
+}
+
 Filter Filter::blur(float radius_x, float radius_y, Optional<Filter const&> input)
 {
     sk_sp<SkImageFilter> input_skia = input.has_value() ? input->m_impl->filter : nullptr;
 
-    auto filter = SkImageFilters::Blur(radius_x, radius_y, input_skia);
+    // OPTIMIZATION: The cost of a blur grows with the number of pixels, and a large blur removes all the detail that a
+    //               smaller copy of its input would lose anyway. So for large radii (like the ones backdrop-filter
+    //               tends to be used with), we scale the input down, blur that with a proportionally smaller radius,
+    //               and scale the result back up with bilinear filtering. Each axis is scaled separately, so that a
+    //               blur along one axis only doesn't lose any detail along the other.
+    auto scale_x = scale_for_blur_radius(radius_x);
+    auto scale_y = scale_for_blur_radius(radius_y);
+    if (scale_x == 1.0f && scale_y == 1.0f)
+        return Filter(Impl::create(SkImageFilters::Blur(radius_x, radius_y, input_skia)));
+
+    SkSamplingOptions sampling { SkFilterMode::kLinear };
+    auto downscaled = SkImageFilters::MatrixTransform(SkMatrix::Scale(scale_x, scale_y), sampling, input_skia);
+    auto blurred = SkImageFilters::Blur(radius_x * scale_x, radius_y * scale_y, downscaled);
+    auto filter = SkImageFilters::MatrixTransform(SkMatrix::Scale(1 / scale_x, 1 / scale_y), sampling, blurred);
     return Filter(Impl::create(filter));
 }
 
@@ -5,17 +5,47 @@
  */
 
 #include <AK/Format.h>
+#include <AK/HashTable.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
 #include <LibCore/Resource.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 
 namespace Gfx {
 
-PathFontProvider::PathFontProvider() = default;
+// NOTE: Bump this whenever the format of the font index changes, or when we start finding something different in the same
+//       font files, so that stale indices are thrown away.
+static constexpr i64 FONT_INDEX_VERSION = 1;
+
+PathFontProvider::PathFontProvider()
+{
+    // FIXME: Move this to a generic "Ladybird cache directory" helper.
+    m_font_index_path = ByteString::formatted("{}/Ladybird/FontIndex.json", Core::StandardPaths::user_data_directory());
+}
+
 PathFontProvider::~PathFontProvider() = default;
 
+static bool is_font_file(LexicalPath const& path)
+{
+    return path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv) || path.has_extension(".woff"sv);
+}
+
+static ErrorOr<NonnullRefPtr<Typeface>> load_typeface_from_resource(Core::Resource const& resource)
+{
+    auto uri = resource.uri();
+    auto path = LexicalPath(uri.bytes_as_string_view());
+    if (path.has_extension(".woff"sv))
+        return WOFF::try_load_from_resource(resource);
+    return Typeface::try_load_from_resource(resource);
+}
+
 void PathFontProvider::load_all_fonts_from_uri(StringView uri)
 {
     auto root_or_error = Core::Resource::load_from_uri(uri);
@@ -28,28 +58,80 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
     }
     auto root = root_or_error.release_value();
 
-    root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
+    load_font_index();
+
+    bool font_index_changed = false;
+    HashTable<String> found_uris;
+
+    root->for_each_descendant_file([&](Core::Resource const& resource) -> IterationDecision {
         auto uri = resource.uri();
-        auto path = LexicalPath(uri.bytes_as_string_view());
-        if (path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv)) {
-            if (auto font_or_error = Typeface::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
-        } else if (path.has_extension(".woff"sv)) {
-            if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+        if (!is_font_file(LexicalPath(uri.bytes_as_string_view())))
+            return IterationDecision::Continue;
+
+        found_uris.set(uri);
+
+        auto modified_time = static_cast<i64>(resource.modified_time().value_or(0));
+        auto size = resource.data().size();
+
+        // OPTIMIZATION: If this file is in the index and hasn't changed since, we already know what's in it, so it's
+        //               only loaded once a font from it is actually used.
+        if (auto indexed_file = m_font_index.get(uri); indexed_file.has_value() && indexed_file->modified_time == modified_time && indexed_file->size == size) {
+            if (auto const& typeface = indexed_file->typeface; typeface.has_value())
+                add_typeface_entry(typeface->family, { uri, typeface->weight, typeface->width, typeface->slope, {}, false });
+            return IterationDecision::Continue;
+        }
+
+        IndexedFontFile indexed_file { modified_time, size, {} };
+
+        if (auto typeface_or_error = load_typeface_from_resource(resource); !typeface_or_error.is_error()) {
+            auto typeface = typeface_or_error.release_value();
+            indexed_file.typeface = IndexedTypeface { typeface->family(), typeface->weight(), typeface->width(), typeface->slope() };
+
+            add_typeface_entry(typeface->family(), { uri, typeface->weight(), typeface->width(), typeface->slope(), typeface, false });
         }
+
+        m_font_index.set(uri, move(indexed_file));
+        font_index_changed = true;
+
         return IterationDecision::Continue;
     });
+
+    // Forget about any files that used to be in this directory.
+    auto root_uri_prefix = MUST(String::formatted("{}/", root->uri()));
+    auto removed_any_files = m_font_index.remove_all_matching([&](String const& uri, IndexedFontFile const&) {
+        return uri.starts_with_bytes(root_uri_prefix) && !found_uris.contains(uri);
+    });
+
+    if (font_index_changed || removed_any_files)
+        save_font_index();
+}
+
+void PathFontProvider::add_typeface_entry(FlyString const& family, TypefaceEntry entry)
+{
+    auto& typefaces = m_typeface_by_family.ensure(family, [] {
+        return Vector<TypefaceEntry> {};
+    });
+    typefaces.append(move(entry));
+}
+
+RefPtr<Typeface> PathFontProvider::typeface_for_entry(TypefaceEntry& entry)
+{
+    if (entry.typeface || entry.failed_to_load)
+        return entry.typeface;
+
+    auto typeface_or_error = [&]() -> ErrorOr<NonnullRefPtr<Typeface>> {
+        auto resource = TRY(Core::Resource::load_from_uri(entry.uri));
+        return load_typeface_from_resource(*resource);
+    }();
+
+    if (typeface_or_error.is_error()) {
+        dbgln("PathFontProvider: Unable to load typeface from '{}': {}", entry.uri, typeface_or_error.error());
+        entry.failed_to_load = true;
+        return nullptr;
+    }
+
+    entry.typeface = typeface_or_error.release_value();
+    return entry.typeface;
 }
 
 RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope)
@@ -57,8 +139,10 @@ RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float poin
     auto it = m_typeface_by_family.find(family);
     if (it == m_typeface_by_family.end())
         return nullptr;
-    for (auto const& typeface : it->value) {
-        if (typeface->weight() == weight && typeface->width() == width && typeface->slope() == slope)
+    for (auto& entry : it->value) {
+        if (entry.weight != weight || entry.width != width || entry.slope != slope)
+            continue;
+        if (auto typeface = typeface_for_entry(entry))
             return typeface->font(point_size);
     }
     return nullptr;
@@ -69,9 +153,109 @@ void PathFontProvider::for_each_typeface_with_family_name(FlyString const& famil
     auto it = m_typeface_by_family.find(family_name);
     if (it == m_typeface_by_family.end())
         return;
-    for (auto const& typeface : it->value) {
-        callback(*typeface);
+    for (auto& entry : it->value) {
+        if (auto typeface = typeface_for_entry(entry))
+            callback(*typeface);
     }
 }
 
+void PathFontProvider::load_font_index()
+{
+    if (m_font_index_was_loaded)
+        return;
+    m_font_index_was_loaded = true;
+
+    auto font_index = [&]() -> ErrorOr<JsonValue> {
+        auto file = TRY(Core::File::open(m_font_index_path, Core::File::OpenMode::Read));
+        auto contents = TRY(file->read_until_eof());
+        return JsonValue::from_string(contents);
+    }();
+
+    if (font_index.is_error()) {
+        if (!font_index.error().is_errno() || font_index.error().code() != ENOENT)
+            dbgln("PathFontProvider: Unable to read font index '{}': {}", m_font_index_path, font_index.error());
+        return;
+    }
+    if (!font_index.value().is_object())
+        return;
+
+    auto const& font_index_object = font_index.value().as_object();
+    if (font_index_object.get_i64("version"sv) != FONT_INDEX_VERSION)
+        return;
+
+    auto files = font_index_object.get_object("files"sv);
+    if (!files.has_value())
+        return;
+
+    files->for_each_member([&](String const& uri, JsonValue const& value) {
+        if (!value.is_object())
+            return;
+        auto const& file = value.as_object();
+
+        auto modified_time = file.get_i64("modifiedTime"sv);
+        auto size = file.get_u64("size"sv);
+        if (!modified_time.has_value() || !size.has_value())
+            return;
+
+        IndexedFontFile indexed_file { *modified_time, static_cast<size_t>(*size), {} };
+
+        if (auto typeface = file.get_object("typeface"sv); typeface.has_value()) {
+            auto family = typeface->get_string("family"sv);
+            auto weight = typeface->get_u16("weight"sv);
+            auto width = typeface->get_u16("width"sv);
+            auto slope = typeface->get_u8("slope"sv);
+            if (!family.has_value() || !weight.has_value() || !width.has_value() || !slope.has_value())
+                return;
+
+            indexed_file.typeface = IndexedTypeface { FlyString { *family }, *weight, *width, *slope };
+        }
+
+        m_font_index.set(uri, move(indexed_file));
+    });
+}
+
+void PathFontProvider::save_font_index() const
+{
+    JsonObject files;
+    for (auto const& [uri, indexed_file] : m_font_index) {
+        JsonObject file;
+        file.set("modifiedTime"sv, indexed_file.modified_time);
+        file.set("size"sv, static_cast<u64>(indexed_file.size));
+
+        if (auto const& typeface = indexed_file.typeface; typeface.has_value()) {
+            JsonObject typeface_object;
+            typeface_object.set("family"sv, typeface->family.to_string());
+            typeface_object.set("weight"sv, typeface->weight);
+            typeface_object.set("width"sv, typeface->width);
+            typeface_object.set("slope"sv, typeface->slope);
+            file.set("typeface"sv, move(typeface_object));
+        }
+
+        files.set(uri, move(file));
+    }
+
+    JsonObject font_index;
+    font_index.set("version"sv, FONT_INDEX_VERSION);
+    font_index.set("files"sv, move(files));
+
+    // NOTE: Several processes may be doing this at the same time, so the index is written to a file of its own first,
+    //       and then moved into place. That way, nobody ever sees a partially written index.
+    auto result = [&]() -> ErrorOr<void> {
+        auto font_index_directory = LexicalPath { m_font_index_path }.parent();
+        TRY(Core::Directory::create(font_index_directory, Core::Directory::CreateDirectories::Yes));
+
+        auto temporary_path = ByteString::formatted("{}.{}", m_font_index_path, Core::System::getpid());
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(font_index.serialized()));
+        }
+
+        TRY(Core::System::rename(temporary_path, m_font_index_path));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("PathFontProvider: Unable to write font index '{}': {}", m_font_index_path, result.error());
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -31,8 +32,47 @@ public:
     virtual StringView name() const override { return m_name.bytes_as_string_view(); }
 
 private:
-    HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
+    // A typeface that was found while looking for fonts, which is only loaded once it's actually needed.
+    struct TypefaceEntry {
+        String uri;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+
+        RefPtr<Typeface> typeface;
+        bool failed_to_load { false };
+    };
+
+    // NOTE: Finding out what's in a font file means loading it, which adds up to quite a while on systems with a lot of
+    //       fonts installed. So what was found in each file is stored in an index on disk, which lets the next process
+    //       skip loading any file that hasn't changed since then.
+    struct IndexedTypeface {
+        FlyString family;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+    };
+
+    struct IndexedFontFile {
+        i64 modified_time { 0 };
+        size_t size { 0 };
+
+        // This is empty for files that turned out not to contain a typeface we can load.
+        Optional<IndexedTypeface> typeface;
+    };
+
+    void add_typeface_entry(FlyString const& family, TypefaceEntry);
+    RefPtr<Typeface> typeface_for_entry(TypefaceEntry&);
+
+    void load_font_index();
+    void save_font_index() const;
+
+    HashMap<FlyString, Vector<TypefaceEntry>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
     String m_name { "Path"_string };
+
+    ByteString m_font_index_path;
+    HashMap<String, IndexedFontFile> m_font_index;
+    bool m_font_index_was_loaded { false };
 };
 
 }
@@ -23,31 +23,36 @@
 
 namespace Gfx {
 
-static sk_sp<SkFontMgr> s_font_manager;
-
 struct TypefaceSkia::Impl {
     sk_sp<SkTypeface> skia_typeface;
 };
 
-ErrorOr<NonnullRefPtr<TypefaceSkia>> TypefaceSkia::load_from_buffer(AK::ReadonlyBytes buffer, int ttc_index)
+// NOTE: Web fonts are decoded on the thread pool, so this has to be safe to call from any thread.
+static SkFontMgr& font_manager()
 {
-    if (!s_font_manager) {
+    static sk_sp<SkFontMgr> s_font_manager = [] {
+        sk_sp<SkFontMgr> font_manager;
 #ifdef AK_OS_MACOS
         if (Gfx::FontDatabase::the().system_font_provider_name() != "FontConfig"sv) {
-            s_font_manager = SkFontMgr_New_CoreText(nullptr);
+            font_manager = SkFontMgr_New_CoreText(nullptr);
         }
 #endif
 #ifndef AK_OS_ANDROID
-        if (!s_font_manager) {
-            s_font_manager = SkFontMgr_New_FontConfig(nullptr);
+        if (!font_manager) {
+            font_manager = SkFontMgr_New_FontConfig(nullptr);
         }
 #else
-        s_font_manager = SkFontMgr_New_Android(nullptr);
+        font_manager = SkFontMgr_New_Android(nullptr);
 #endif
-    }
+        return font_manager;
+    }();
+    return *s_font_manager;
+}
 
+ErrorOr<NonnullRefPtr<TypefaceSkia>> TypefaceSkia::load_from_buffer(AK::ReadonlyBytes buffer, int ttc_index)
+{
     auto data = SkData::MakeWithoutCopy(buffer.data(), buffer.size());
-    auto skia_typeface = s_font_manager->makeFromData(data, ttc_index);
+    auto skia_typeface = font_manager().makeFromData(data, ttc_index);
 
     if (!skia_typeface) {
         return Error::from_string_literal("Failed to load typeface from buffer");
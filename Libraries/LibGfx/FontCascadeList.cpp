@@ -11,10 +11,13 @@ namespace Gfx {
 void FontCascadeList::add(NonnullRefPtr<Font const> font)
 {
     m_fonts.append({ move(font), {} });
+    clear_font_index_cache();
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> unicode_ranges)
 {
+    clear_font_index_cache();
+
     if (unicode_ranges.is_empty()) {
         m_fonts.append({ move(font), {} });
         return;
@@ -37,23 +40,55 @@ void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> u
 void FontCascadeList::extend(FontCascadeList const& other)
 {
     m_fonts.extend(other.m_fonts);
+    clear_font_index_cache();
 }
 
 Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
 {
-    for (auto const& entry : m_fonts) {
+    // NOTE: The font indices have to fit into the cache, which should never be a problem in practice.
+    if (m_fonts.size() >= last_resort_font_index) [[unlikely]] {
+        if (auto index = find_font_index_for_code_point(code_point); index.has_value())
+            return m_fonts[*index].font;
+        return *m_last_resort_font;
+    }
+
+    auto block_number = code_point / code_point_block_size;
+    if (!m_last_used_code_point_block || m_last_used_code_point_block_number != block_number) {
+        m_last_used_code_point_block = m_font_index_cache.ensure(block_number, [] { return make<CodePointBlock>(); }).ptr();
+        m_last_used_code_point_block_number = block_number;
+    }
+
+    auto& font_index = m_last_used_code_point_block->font_indices[code_point % code_point_block_size];
+    if (font_index == unknown_font_index)
+        font_index = static_cast<u8>(find_font_index_for_code_point(code_point).value_or(last_resort_font_index));
+
+    if (font_index == last_resort_font_index)
+        return *m_last_resort_font;
+    return m_fonts[font_index].font;
+}
+
+Optional<size_t> FontCascadeList::find_font_index_for_code_point(u32 code_point) const
+{
+    for (size_t i = 0; i < m_fonts.size(); ++i) {
+        auto const& entry = m_fonts[i];
         if (entry.range_data.has_value()) {
             if (!entry.range_data->enclosing_range.contains(code_point))
                 continue;
             for (auto const& range : entry.range_data->unicode_ranges) {
                 if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
+                    return i;
             }
         } else if (entry.font->contains_glyph(code_point)) {
-            return entry.font;
+            return i;
         }
     }
-    return *m_last_resort_font;
+    return {};
+}
+
+void FontCascadeList::clear_font_index_cache()
+{
+    m_font_index_cache.clear();
+    m_last_used_code_point_block = nullptr;
 }
 
 bool FontCascadeList::equals(FontCascadeList const& other) const
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -49,11 +52,37 @@ public:
         Optional<RangeData> range_data;
     };
 
-    void set_last_resort_font(NonnullRefPtr<Font> font) { m_last_resort_font = move(font); }
+    void set_last_resort_font(NonnullRefPtr<Font> font)
+    {
+        m_last_resort_font = move(font);
+        clear_font_index_cache();
+    }
 
 private:
+    Optional<size_t> find_font_index_for_code_point(u32 code_point) const;
+    void clear_font_index_cache();
+
     RefPtr<Font const> m_last_resort_font;
     Vector<Entry> m_fonts;
+
+    // OPTIMIZATION: Finding the font for a code point means checking whether every font in the list has a glyph for it,
+    //               until one does. For text that most of the fonts don't cover (e.g. CJK text or emoji, which is often
+    //               only covered by the fallback fonts at the end of the list), that happens for every single character.
+    //               So the index of the font that was found for each code point is remembered, in blocks of adjacent
+    //               code points, as text tends to stick to the same few blocks of code points.
+    static constexpr size_t code_point_block_size = 256;
+    static constexpr u8 unknown_font_index = 0xFF;
+    static constexpr u8 last_resort_font_index = 0xFE;
+
+    struct CodePointBlock {
+        CodePointBlock() { font_indices.fill(unknown_font_index); }
+
+        Array<u8, code_point_block_size> font_indices;
+    };
+
+    mutable HashMap<u32, NonnullOwnPtr<CodePointBlock>> m_font_index_cache;
+    mutable CodePointBlock* m_last_used_code_point_block { nullptr };
+    mutable u32 m_last_used_code_point_block_number { 0 };
 };
 
 }
@@ -18,6 +18,10 @@ struct PNGWriterOptions {
     // Data for the iCCP chunk.
     // FIXME: Allow writing cICP, sRGB, or gAMA instead too.
     Optional<ReadonlyBytes> icc_data;
+
+    // Makes encoding a lot faster, at the cost of a larger file: every row is filtered with the Sub filter instead of
+    // trying each filter to find the one that compresses best, and zlib uses its fastest compression level.
+    bool prefer_speed_over_size { false };
 };
 
 class PNGWriter {
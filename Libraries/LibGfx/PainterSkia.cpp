@@ -140,6 +140,18 @@ void PainterSkia::fill_rect(Gfx::FloatRect const& rect, Color color)
     });
 }
 
+void PainterSkia::fill_rect(Gfx::FloatRect const& rect, Gfx::PaintStyle const& paint_style, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
+{
+    auto paint = to_skia_paint(paint_style, filter);
+    paint.setAntiAlias(true);
+    float alpha = paint.getAlphaf();
+    paint.setAlphaf(alpha * global_alpha);
+    paint.setBlender(to_skia_blender(compositing_and_blending_operator));
+    impl().with_canvas([&](auto& canvas) {
+        canvas.drawRect(to_skia_rect(rect), paint);
+    });
+}
+
 void PainterSkia::draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode, Optional<Gfx::Filter> filter, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
 {
     SkPaint paint;
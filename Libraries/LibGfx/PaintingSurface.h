@@ -39,8 +39,10 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_iosurface(Core::IOSurfaceHandle&&, NonnullRefPtr<SkiaBackendContext>, Origin = Origin::TopLeft);
 #endif
 
-    void read_into_bitmap(Bitmap&);
-    void write_from_bitmap(Bitmap const&);
+    // NOTE: These only copy the pixels that are inside both the surface and the bitmap, converting them between the
+    //       formats of the two as they go. The position is that of the bitmap's top left corner on the surface.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
+    void write_from_bitmap(Bitmap const&, IntPoint destination_position = {});
 
     void notify_content_will_change();
 
@@ -27,6 +27,12 @@
 
 namespace Gfx {
 
+void SkiaBackendContext::apply_resource_cache_limit(GrDirectContext& context)
+{
+    if (s_resource_cache_limit_for_new_contexts.has_value())
+        context.setResourceCacheLimit(*s_resource_cache_limit_for_new_contexts);
+}
+
 #ifdef USE_VULKAN
 class SkiaVulkanBackendContext final : public SkiaBackendContext {
     AK_MAKE_NONCOPYABLE(SkiaVulkanBackendContext);
@@ -80,6 +86,7 @@ RefPtr<SkiaBackendContext> SkiaBackendContext::create_vulkan_context(Gfx::Vulkan
 
     sk_sp<GrDirectContext> ctx = GrDirectContexts::MakeVulkan(backend_context);
     VERIFY(ctx);
+    apply_resource_cache_limit(*ctx);
     return adopt_ref(*new SkiaVulkanBackendContext(ctx, move(extensions)));
 }
 #endif
@@ -120,6 +127,8 @@ RefPtr<SkiaBackendContext> SkiaBackendContext::create_metal_context(NonnullRefPt
     backend_context.fDevice.retain(metal_context->device());
     backend_context.fQueue.retain(metal_context->queue());
     sk_sp<GrDirectContext> ctx = GrDirectContexts::MakeMetal(backend_context);
+    if (ctx)
+        apply_resource_cache_limit(*ctx);
     return adopt_ref(*new SkiaMetalBackendContext(move(ctx), move(metal_context)));
 }
 #endif
@@ -8,6 +8,7 @@
 
 #include <AK/AtomicRefCounted.h>
 #include <AK/Noncopyable.h>
+#include <AK/Optional.h>
 #include <LibThreading/Mutex.h>
 
 #ifdef USE_VULKAN
@@ -49,7 +50,15 @@ public:
     void lock() { m_mutex.lock(); }
     void unlock() { m_mutex.unlock(); }
 
+    // Limits how much GPU memory Skia keeps for cached resources, such as uploaded images, in contexts created after
+    // this is called. Least recently used resources are purged first once the limit is exceeded.
+    static void set_resource_cache_limit_for_new_contexts(size_t bytes) { s_resource_cache_limit_for_new_contexts = bytes; }
+
 private:
+    static void apply_resource_cache_limit(GrDirectContext&);
+
+    static inline Optional<size_t> s_resource_cache_limit_for_new_contexts;
+
     Threading::Mutex m_mutex;
 };
 
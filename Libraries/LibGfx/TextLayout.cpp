@@ -7,10 +7,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/TextLayout.h>
 #include <harfbuzz/hb.h>
 
+#include <core/SkGraphics.h>
+
 namespace Gfx {
 
 Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View string, FontCascadeList const& font_cascade_list)
@@ -80,8 +85,118 @@ static hb_buffer_t* setup_text_shaping(Utf8View string, Font const& font, ShapeF
     return buffer;
 }
 
+// Remembers the glyphs of recently shaped text, so that the words of a page don't have to go through HarfBuzz again
+// on every relayout. Inline layout already shapes text one word at a time whenever lines can wrap, so keeping short
+// strings around is enough to cover most of what gets shaped over and over.
+// Glyph positions are stored relative to a baseline start of (0, 0).
+class ShapedTextCache {
+public:
+    static ShapedTextCache& the()
+    {
+        // NOTE: Like the HarfBuzz buffer above, this is only ever used from the thread doing the shaping.
+        static thread_local NeverDestroyed<ShapedTextCache> cache;
+        return *cache;
+    }
+
+    static constexpr size_t max_text_length_in_bytes = 64;
+    static constexpr size_t max_entry_count = 8192;
+
+    struct Entry {
+        Vector<DrawGlyph> glyphs;
+        float width { 0 };
+    };
+
+    Entry const* find(Font const& font, float letter_spacing, StringView text, ShapeFeatures const& features)
+    {
+        auto hash = hash_for(font, letter_spacing, text, features);
+        auto it = m_entries.find(hash, [&](auto const& entry) {
+            return entry.key.matches(font, letter_spacing, text, features);
+        });
+        if (it == m_entries.end())
+            return nullptr;
+
+        // Move the entry to the back, so that the least recently used entries are always at the front.
+        auto key = it->key;
+        auto entry = move(it->value);
+        m_entries.remove(it);
+        m_entries.set(move(key), move(entry));
+        return &m_entries.find(hash, [&](auto const& entry) { return entry.key.matches(font, letter_spacing, text, features); })->value;
+    }
+
+    void add(Font const& font, float letter_spacing, StringView text, ShapeFeatures const& features, Entry entry)
+    {
+        if (m_entries.size() >= max_entry_count)
+            m_entries.remove(m_entries.begin());
+        m_entries.set(Key { font, ByteString { text }, letter_spacing, features }, move(entry));
+    }
+
+    void clear() { m_entries.clear(); }
+
+private:
+    struct Key {
+        NonnullRefPtr<Font const> font;
+        ByteString text;
+        float letter_spacing { 0 };
+        ShapeFeatures features;
+
+        bool matches(Font const& other_font, float other_letter_spacing, StringView other_text, ShapeFeatures const& other_features) const
+        {
+            if (font.ptr() != &other_font || letter_spacing != other_letter_spacing || text != other_text)
+                return false;
+            if (features.size() != other_features.size())
+                return false;
+            for (size_t i = 0; i < features.size(); ++i) {
+                if (__builtin_memcmp(features[i].tag, other_features[i].tag, sizeof(features[i].tag)) != 0 || features[i].value != other_features[i].value)
+                    return false;
+            }
+            return true;
+        }
+
+        bool operator==(Key const& other) const { return matches(other.font, other.letter_spacing, other.text, other.features); }
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return hash_for(key.font, key.letter_spacing, key.text, key.features); }
+    };
+
+    static unsigned hash_for(Font const& font, float letter_spacing, StringView text, ShapeFeatures const& features)
+    {
+        auto hash = pair_int_hash(ptr_hash(&font), text.hash());
+        hash = pair_int_hash(hash, bit_cast<u32>(letter_spacing));
+        for (auto const& feature : features)
+            hash = pair_int_hash(hash, pair_int_hash(bit_cast<u32>(feature.tag), feature.value));
+        return hash;
+    }
+
+    OrderedHashMap<Key, Entry, KeyTraits> m_entries;
+};
+
+void purge_text_caches()
+{
+    ShapedTextCache::the().clear();
+    SkGraphics::PurgeFontCache();
+}
+
+static NonnullRefPtr<GlyphRun> create_glyph_run_from_cache_entry(ShapedTextCache::Entry const& entry, FloatPoint baseline_start, Font const& font, GlyphRun::TextType text_type)
+{
+    Vector<DrawGlyph> glyphs;
+    glyphs.ensure_capacity(entry.glyphs.size());
+    for (auto glyph : entry.glyphs) {
+        glyph.translate_by(baseline_start);
+        glyphs.unchecked_append(glyph);
+    }
+    return adopt_ref(*new GlyphRun(move(glyphs), font, text_type, entry.width));
+}
+
 NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
 {
+    auto text = string.as_string();
+    bool is_cacheable = text.length() <= ShapedTextCache::max_text_length_in_bytes;
+    if (is_cacheable) {
+        if (auto const* entry = ShapedTextCache::the().find(font, letter_spacing, text, features))
+            return create_glyph_run_from_cache_entry(*entry, baseline_start, font, text_type);
+    }
+
     auto* buffer = setup_text_shaping(string, font, features);
 
     u32 glyph_count;
@@ -104,7 +219,16 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
             point.translate_by(letter_spacing, 0);
     }
 
-    return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
+    auto width = point.x() - baseline_start.x();
+
+    if (is_cacheable) {
+        ShapedTextCache::Entry entry { .glyphs = glyph_run, .width = width };
+        for (auto& glyph : entry.glyphs)
+            glyph.translate_by(-baseline_start);
+        ShapedTextCache::the().add(font, letter_spacing, text, features, move(entry));
+    }
+
+    return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, width));
 }
 
 float measure_text_width(Utf8View const& string, Font const& font, ShapeFeatures const& features)
@@ -72,4 +72,8 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View string, FontCascadeList const&);
 float measure_text_width(Utf8View const& string, Gfx::Font const& font, ShapeFeatures const& features);
 
+// Drops the shaped text cached by the current thread, along with the rasterized glyphs cached by Skia, e.g. to give
+// memory back under memory pressure.
+void purge_text_caches();
+
 }
@@ -6,15 +6,20 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
 #include <AK/Vector.h>
 #include <LibCore/Socket.h>
 #include <LibCore/Timer.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
+#include <LibThreading/Mutex.h>
 
 namespace IPC {
 
+static Threading::Mutex s_connections_with_statistics_mutex;
+static HashTable<ConnectionBase*> s_connections_with_statistics;
+
 ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport, u32 local_endpoint_magic)
     : m_local_stub(local_stub)
     , m_transport(move(transport))
@@ -22,6 +27,19 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> t
 {
     m_responsiveness_timer = Core::Timer::create_single_shot(3000, [this] { may_have_become_unresponsive(); });
 
+    if (ConnectionStatistics::is_enabled()) {
+        m_statistics = make<ConnectionStatistics>();
+        m_transport->enable_send_queue_statistics();
+
+        if (auto interval = ConnectionStatistics::dump_interval(); interval.has_value()) {
+            m_statistics_dump_timer = Core::Timer::create_repeating(static_cast<int>(interval->to_milliseconds()), [this] { dump_statistics(); });
+            m_statistics_dump_timer->start();
+        }
+
+        Threading::MutexLocker locker(s_connections_with_statistics_mutex);
+        s_connections_with_statistics.set(this);
+    }
+
     m_transport->set_up_read_hook([this] {
         NonnullRefPtr protect = *this;
         // FIXME: Do something about errors.
@@ -30,7 +48,34 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> t
     });
 }
 
-ConnectionBase::~ConnectionBase() = default;
+ConnectionBase::~ConnectionBase()
+{
+    if (m_statistics) {
+        Threading::MutexLocker locker(s_connections_with_statistics_mutex);
+        s_connections_with_statistics.remove(this);
+    }
+}
+
+void ConnectionBase::dump_statistics() const
+{
+    if (!m_statistics) {
+        dbgln("IPC statistics for {} are not being collected, set IPC_STATISTICS to collect them", m_local_stub.name());
+        return;
+    }
+    m_statistics->dump(m_local_stub.name(), m_transport->send_queue_statistics());
+}
+
+void ConnectionBase::dump_statistics_of_all_connections()
+{
+    if (!ConnectionStatistics::is_enabled()) {
+        dbgln("IPC statistics are not being collected, set IPC_STATISTICS to collect them");
+        return;
+    }
+
+    Threading::MutexLocker locker(s_connections_with_statistics_mutex);
+    for (auto const* connection : s_connections_with_statistics)
+        connection->dump_statistics();
+}
 
 bool ConnectionBase::is_open() const
 {
@@ -39,7 +84,14 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
-    return post_message(TRY(message.encode()));
+    if (!m_statistics)
+        return post_message(TRY(message.encode()));
+
+    auto start_time = MonotonicTime::now();
+    auto buffer = TRY(message.encode());
+    m_statistics->did_send(message, buffer.data().size(), MonotonicTime::now() - start_time);
+
+    return post_message(move(buffer));
 }
 
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
@@ -72,7 +124,15 @@ void ConnectionBase::handle_messages()
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
+            auto message_id = message->message_id();
+            auto const* message_name = message->message_name();
+            auto start_time = MonotonicTime::now();
+
             auto handler_result = m_local_stub.handle(move(message));
+
+            if (m_statistics)
+                m_statistics->did_handle(m_local_endpoint_magic, message_id, message_name, MonotonicTime::now() - start_time);
+
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
                 continue;
@@ -95,7 +155,10 @@ void ConnectionBase::wait_for_transport_to_become_readable()
 ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 {
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
+        auto start_time = MonotonicTime::now();
         if (auto message = try_parse_message(raw_message.bytes, raw_message.fds)) {
+            if (m_statistics)
+                m_statistics->did_receive(*message, raw_message.bytes.size(), MonotonicTime::now() - start_time);
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", raw_message.bytes);
@@ -10,7 +10,9 @@
 
 #include <AK/Forward.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibCore/EventReceiver.h>
+#include <LibIPC/ConnectionStatistics.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/Message.h>
@@ -33,6 +35,10 @@ public:
 
     Transport& transport() const { return *m_transport; }
 
+    // Dumps the statistics collected for this connection, see ConnectionStatistics.
+    void dump_statistics() const;
+    static void dump_statistics_of_all_connections();
+
 protected:
     explicit ConnectionBase(IPC::Stub&, NonnullOwnPtr<Transport>, u32 local_endpoint_magic);
 
@@ -56,6 +62,9 @@ protected:
     Vector<NonnullOwnPtr<Message>> m_unprocessed_messages;
 
     u32 m_local_endpoint_magic { 0 };
+
+    OwnPtr<ConnectionStatistics> m_statistics;
+    RefPtr<Core::Timer> m_statistics_dump_timer;
 };
 
 template<typename LocalEndpoint, typename PeerEndpoint>
@@ -75,8 +84,7 @@ public:
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
-        MUST(post_message(RequestType(forward<Args>(args)...)));
-        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = send_sync_but_allow_failure<RequestType>(forward<Args>(args)...);
         VERIFY(response);
         return response.release_nonnull();
     }
@@ -84,9 +92,22 @@ public:
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
-        if (post_message(RequestType(forward<Args>(args)...)).is_error())
+        if (!m_statistics) {
+            if (post_message(RequestType(forward<Args>(args)...)).is_error())
+                return nullptr;
+            return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        }
+
+        RequestType request(forward<Args>(args)...);
+        auto start_time = MonotonicTime::now();
+
+        if (post_message(request).is_error())
             return nullptr;
-        return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+
+        if (response)
+            m_statistics->did_complete_round_trip(request, MonotonicTime::now() - start_time);
+        return response;
     }
 
 protected:
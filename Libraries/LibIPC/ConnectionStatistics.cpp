@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumberFormat.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Environment.h>
+#include <LibCore/System.h>
+#include <LibIPC/ConnectionStatistics.h>
+#include <LibIPC/Message.h>
+
+namespace IPC {
+
+static Optional<StringView> statistics_environment_variable()
+{
+    static auto const value = Core::Environment::get("IPC_STATISTICS"sv);
+    return value;
+}
+
+bool ConnectionStatistics::is_enabled()
+{
+    return statistics_environment_variable().has_value();
+}
+
+Optional<AK::Duration> ConnectionStatistics::dump_interval()
+{
+    auto value = statistics_environment_variable();
+    if (!value.has_value())
+        return {};
+
+    auto seconds = value->to_number<u32>();
+    if (!seconds.has_value() || *seconds == 0)
+        return {};
+    return AK::Duration::from_seconds(*seconds);
+}
+
+MessageStatistics& ConnectionStatistics::ensure_message_statistics(u32 endpoint_magic, i32 message_id, char const* message_name)
+{
+    auto key = (static_cast<u64>(endpoint_magic) << 32) | static_cast<u32>(message_id);
+    return m_message_statistics.ensure(key, [&] {
+        return MessageStatistics { .name = { message_name, strlen(message_name) } };
+    });
+}
+
+void ConnectionStatistics::did_send(Message const& message, size_t byte_count, AK::Duration encode_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+    auto& statistics = ensure_message_statistics(message.endpoint_magic(), message.message_id(), message.message_name());
+    ++statistics.sent_count;
+    statistics.sent_bytes += byte_count;
+    statistics.encode_time += encode_time;
+}
+
+void ConnectionStatistics::did_receive(Message const& message, size_t byte_count, AK::Duration decode_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+    auto& statistics = ensure_message_statistics(message.endpoint_magic(), message.message_id(), message.message_name());
+    ++statistics.received_count;
+    statistics.received_bytes += byte_count;
+    statistics.decode_time += decode_time;
+}
+
+void ConnectionStatistics::did_handle(u32 endpoint_magic, i32 message_id, char const* message_name, AK::Duration handle_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+    ensure_message_statistics(endpoint_magic, message_id, message_name).handle_time += handle_time;
+}
+
+void ConnectionStatistics::did_complete_round_trip(Message const& request, AK::Duration round_trip_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+    auto& statistics = ensure_message_statistics(request.endpoint_magic(), request.message_id(), request.message_name());
+    ++statistics.round_trip_count;
+    statistics.round_trip_time += round_trip_time;
+    statistics.max_round_trip_time = max(statistics.max_round_trip_time, round_trip_time);
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_microseconds()) / 1000.0;
+}
+
+static double average_milliseconds(AK::Duration duration, u64 count)
+{
+    return count != 0 ? to_milliseconds(duration) / static_cast<double>(count) : 0.0;
+}
+
+void ConnectionStatistics::dump(StringView connection_name, SendQueueStatistics const& send_queue_statistics) const
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    Vector<MessageStatistics const*> messages;
+    messages.ensure_capacity(m_message_statistics.size());
+    for (auto const& it : m_message_statistics)
+        messages.unchecked_append(&it.value);
+
+    // The messages we spend the most time on come first.
+    auto total_time = [](MessageStatistics const& statistics) {
+        return statistics.encode_time + statistics.decode_time + statistics.handle_time + statistics.round_trip_time;
+    };
+    quick_sort(messages, [&](auto const* a, auto const* b) { return total_time(*a) > total_time(*b); });
+
+    dbgln("IPC statistics for {} (pid {}):", connection_name, Core::System::getpid());
+    dbgln("  Send queue: {} messages, {:.3}ms average delay, {:.3}ms max delay",
+        send_queue_statistics.message_count,
+        average_milliseconds(send_queue_statistics.total_delay, send_queue_statistics.message_count),
+        to_milliseconds(send_queue_statistics.max_delay));
+
+    for (auto const* statistics : messages) {
+        dbgln("  {}:", statistics->name);
+        if (statistics->sent_count != 0)
+            dbgln("    Sent {} ({}), {:.3}ms encoding", statistics->sent_count, human_readable_size(statistics->sent_bytes), to_milliseconds(statistics->encode_time));
+        if (statistics->received_count != 0)
+            dbgln("    Received {} ({}), {:.3}ms decoding, {:.3}ms handling", statistics->received_count, human_readable_size(statistics->received_bytes), to_milliseconds(statistics->decode_time), to_milliseconds(statistics->handle_time));
+        if (statistics->round_trip_count != 0)
+            dbgln("    Round trips: {:.3}ms average, {:.3}ms max", average_milliseconds(statistics->round_trip_time, statistics->round_trip_count), to_milliseconds(statistics->max_round_trip_time));
+    }
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <LibIPC/Forward.h>
+#include <LibThreading/Mutex.h>
+
+namespace IPC {
+
+struct SendQueueStatistics {
+    u64 message_count { 0 };
+    AK::Duration total_delay;
+    AK::Duration max_delay;
+};
+
+struct MessageStatistics {
+    StringView name;
+
+    u64 sent_count { 0 };
+    u64 sent_bytes { 0 };
+    AK::Duration encode_time;
+
+    u64 received_count { 0 };
+    u64 received_bytes { 0 };
+    AK::Duration decode_time;
+    AK::Duration handle_time;
+
+    u64 round_trip_count { 0 };
+    AK::Duration round_trip_time;
+    AK::Duration max_round_trip_time;
+};
+
+// Per-message counters and timings of an IPC connection, to find out which messages are responsible when IPC is slow.
+// These are only collected if the IPC_STATISTICS environment variable is set. If it's set to a number, the statistics of
+// every connection are dumped periodically, every that many seconds.
+class ConnectionStatistics {
+public:
+    static bool is_enabled();
+    static Optional<AK::Duration> dump_interval();
+
+    void did_send(Message const&, size_t byte_count, AK::Duration encode_time);
+    void did_receive(Message const&, size_t byte_count, AK::Duration decode_time);
+    // NOTE: Handling a message consumes it, so this takes what identifies the message instead.
+    void did_handle(u32 endpoint_magic, i32 message_id, char const* message_name, AK::Duration handle_time);
+    void did_complete_round_trip(Message const& request, AK::Duration round_trip_time);
+
+    void dump(StringView connection_name, SendQueueStatistics const&) const;
+
+private:
+    MessageStatistics& ensure_message_statistics(u32 endpoint_magic, i32 message_id, char const* message_name);
+
+    mutable Threading::Mutex m_mutex;
+    HashMap<u64, MessageStatistics> m_message_statistics;
+};
+
+}
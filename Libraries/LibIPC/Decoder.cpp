@@ -6,15 +6,19 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/DateTime.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
+#include <LibCore/System.h>
 #include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
 #include <LibURL/Parser.h>
 #include <LibURL/URL.h>
+#include <fcntl.h>
 
 namespace IPC {
 
@@ -23,11 +27,50 @@ ErrorOr<size_t> Decoder::decode_size()
     return static_cast<size_t>(TRY(decode<u32>()));
 }
 
+// Decodes a payload encoded by Encoder::encode_payload(), which is sent in shared memory if it's large enough. The callback
+// receives a stream to read the payload's bytes from.
+template<typename Callback>
+static ErrorOr<void> decode_payload(Decoder& decoder, size_t length, Callback callback)
+{
+    if (length < Encoder::shared_memory_payload_threshold)
+        return callback(decoder.stream());
+
+    auto file = TRY(decoder.decode<IPC::File>());
+
+#ifdef F_GET_SEALS
+    // NOTE: The sender could otherwise truncate the file while we're reading it, which would crash us.
+    auto seals = fcntl(file.fd(), F_GET_SEALS);
+    if (seals < 0 || (seals & F_SEAL_SHRINK) == 0)
+        return Error::from_string_literal("IPC payload in shared memory was not sealed");
+#endif
+
+    auto stat = TRY(Core::System::fstat(file.fd()));
+    if (stat.st_size < 0 || static_cast<u64>(stat.st_size) < length)
+        return Error::from_string_literal("IPC payload in shared memory is smaller than its length");
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(file.take_fd(), length));
+    FixedMemoryStream stream { ReadonlyBytes { buffer.data<u8>(), length } };
+    return callback(stream);
+}
+
+ErrorOr<void> Decoder::decode_payload_into(Bytes bytes)
+{
+    return decode_payload(*this, bytes.size(), [&](Stream& stream) {
+        return stream.read_until_filled(bytes);
+    });
+}
+
 template<>
 ErrorOr<String> decode(Decoder& decoder)
 {
     auto length = TRY(decoder.decode_size());
-    return String::from_stream(decoder.stream(), length);
+
+    String string;
+    TRY(decode_payload(decoder, length, [&](Stream& stream) -> ErrorOr<void> {
+        string = TRY(String::from_stream(stream, length));
+        return {};
+    }));
+    return string;
 }
 
 template<>
@@ -38,8 +81,9 @@ ErrorOr<ByteString> decode(Decoder& decoder)
         return ByteString::empty();
 
     return ByteString::create_and_overwrite(length, [&](Bytes bytes) -> ErrorOr<void> {
-        TRY(decoder.decode_into(bytes));
-        return {};
+        return decode_payload(decoder, length, [&](Stream& stream) {
+            return stream.read_until_filled(bytes);
+        });
     });
 }
 
@@ -51,9 +95,7 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
         return ByteBuffer {};
 
     auto buffer = TRY(ByteBuffer::create_uninitialized(length));
-    auto bytes = buffer.bytes();
-
-    TRY(decoder.decode_into(bytes));
+    TRY(decoder.decode_payload_into(buffer.bytes()));
     return buffer;
 }
 
@@ -62,6 +62,9 @@ public:
 
     ErrorOr<size_t> decode_size();
 
+    // Reads the bytes of a payload encoded by Encoder::encode_payload(), after its size has been decoded.
+    ErrorOr<void> decode_payload_into(Bytes);
+
     Stream& stream() { return m_stream; }
     Queue<File>& files() { return m_files; }
 
@@ -22,6 +22,7 @@
 #include <LibIPC/File.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
+#include <fcntl.h>
 
 namespace IPC {
 
@@ -32,6 +33,25 @@ ErrorOr<void> Encoder::encode_size(size_t size)
     return encode(static_cast<u32>(size));
 }
 
+ErrorOr<void> Encoder::encode_payload(ReadonlyBytes bytes)
+{
+    TRY(encode_size(bytes.size()));
+
+    if (bytes.size() < shared_memory_payload_threshold)
+        return append(bytes.data(), bytes.size());
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(bytes.size()));
+    memcpy(buffer.data<u8>(), bytes.data(), bytes.size());
+
+#ifdef F_ADD_SEALS
+    // NOTE: The receiver maps the file, so we make sure it can't be truncated under its feet.
+    if (fcntl(buffer.fd(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0)
+        return Error::from_errno(errno);
+#endif
+
+    return encode(TRY(IPC::File::clone_fd(buffer.fd())));
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, float const& value)
 {
@@ -53,9 +73,7 @@ ErrorOr<void> encode(Encoder& encoder, String const& value)
 template<>
 ErrorOr<void> encode(Encoder& encoder, StringView const& value)
 {
-    TRY(encoder.encode_size(value.length()));
-    TRY(encoder.append(reinterpret_cast<u8 const*>(value.characters_without_null_termination()), value.length()));
-    return {};
+    return encoder.encode_payload(value.bytes());
 }
 
 template<>
@@ -67,9 +85,7 @@ ErrorOr<void> encode(Encoder& encoder, ByteString const& value)
 template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
-    TRY(encoder.encode_size(value.size()));
-    TRY(encoder.append(value.data(), value.size()));
-    return {};
+    return encoder.encode_payload(value.bytes());
 }
 
 template<>
@@ -9,6 +9,7 @@
 
 #include <AK/Concepts.h>
 #include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Variant.h>
 #include <LibCore/Forward.h>
@@ -58,6 +59,16 @@ public:
 
     ErrorOr<void> encode_size(size_t size);
 
+    // Encodes the size of the given bytes, followed by the bytes themselves. Payloads of at least the threshold size are
+    // sent in shared memory instead, which saves copying them through the transport and the receiver's buffers.
+#ifdef AK_OS_WINDOWS
+    // FIXME: Send large payloads in shared memory on Windows as well.
+    static constexpr size_t shared_memory_payload_threshold = NumericLimits<size_t>::max();
+#else
+    static constexpr size_t shared_memory_payload_threshold = 128 * KiB;
+#endif
+    ErrorOr<void> encode_payload(ReadonlyBytes);
+
 private:
     MessageBuffer& m_buffer;
 };
@@ -15,9 +15,21 @@ namespace IPC {
 void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds)
 {
     Threading::MutexLocker locker(m_mutex);
+
+    // NOTE: The send thread only ever waits for an empty queue to become non-empty, so we don't have to wake it up for
+    //       every message of a burst.
+    bool was_empty = m_stream.is_eof() && m_fds.is_empty();
+
     VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
     m_fds.append(fds.data(), fds.size());
-    m_condition.signal();
+
+    if (m_collects_statistics) {
+        m_enqueued_byte_count += bytes.size();
+        m_enqueued_messages.enqueue({ .end_offset = m_enqueued_byte_count, .enqueue_time = MonotonicTime::now() });
+    }
+
+    if (was_empty)
+        m_condition.signal();
 }
 
 SendQueue::Running SendQueue::block_until_message_enqueued()
@@ -49,6 +61,36 @@ void SendQueue::discard(size_t bytes_count, size_t fds_count)
     Threading::MutexLocker locker(m_mutex);
     MUST(m_stream.discard(bytes_count));
     m_fds.remove(0, fds_count);
+
+    if (m_collects_statistics) {
+        m_sent_byte_count += bytes_count;
+
+        auto now = MonotonicTime::now();
+        while (!m_enqueued_messages.is_empty() && m_enqueued_messages.head().end_offset <= m_sent_byte_count) {
+            auto delay = now - m_enqueued_messages.dequeue().enqueue_time;
+            ++m_statistics.message_count;
+            m_statistics.total_delay += delay;
+            m_statistics.max_delay = max(m_statistics.max_delay, delay);
+        }
+    }
+}
+
+void SendQueue::enable_statistics()
+{
+    Threading::MutexLocker locker(m_mutex);
+    if (m_collects_statistics)
+        return;
+
+    // NOTE: Whatever is already queued up is not accounted for.
+    m_collects_statistics = true;
+    m_enqueued_byte_count = m_stream.used_buffer_size();
+    m_sent_byte_count = 0;
+}
+
+SendQueueStatistics SendQueue::statistics()
+{
+    Threading::MutexLocker locker(m_mutex);
+    return m_statistics;
 }
 
 void SendQueue::stop()
@@ -67,7 +109,9 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
+            // OPTIMIZATION: Send everything that has been queued up in one go, so that a burst of messages only costs
+            //               us as many syscalls as it takes to fill the socket buffer.
+            auto [bytes, fds] = send_queue->peek(SOCKET_BUFFER_SIZE);
             ReadonlyBytes remaining_bytes_to_send = bytes;
 
             if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
@@ -242,7 +286,9 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     if (!m_socket->is_open())
         return TransferState::SocketClosed;
 
-    {
+    // If we couldn't send everything, the socket buffer is full, so we wait for the peer to make room for more. Otherwise
+    // there's no need to wait for anything.
+    if (!bytes.is_empty() || !fds.is_empty()) {
         Vector<struct pollfd, 1> pollfds;
         pollfds.append({ .fd = m_socket->fd().value(), .events = POLLOUT, .revents = 0 });
 
@@ -261,9 +307,14 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
     bool should_shutdown = false;
     while (is_open()) {
-        u8 buffer[4096];
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+
+        // OPTIMIZATION: We receive directly into the buffer of unprocessed bytes, in chunks large enough to pick up a
+        //               whole burst of messages with a single syscall.
+        auto previous_size = m_unprocessed_bytes.size();
+        auto buffer = m_unprocessed_bytes.must_get_bytes_for_writing(RECEIVE_CHUNK_SIZE);
+        auto maybe_bytes_read = m_socket->receive_message(buffer, MSG_DONTWAIT, received_fds);
+        m_unprocessed_bytes.set_size(previous_size + (maybe_bytes_read.is_error() ? 0 : maybe_bytes_read.value().size()));
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
@@ -286,7 +337,6 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
             break;
         }
 
-        m_unprocessed_bytes.append(bytes_read.data(), bytes_read.size());
         for (auto const& fd : received_fds) {
             m_unprocessed_fds.enqueue(File::adopt_fd(fd));
         }
@@ -9,8 +9,10 @@
 
 #include <AK/MemoryStream.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
+#include <LibIPC/ConnectionStatistics.h>
 #include <LibIPC/File.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/MutexProtected.h>
@@ -36,12 +38,27 @@ public:
     BytesAndFds peek(size_t max_bytes);
     void discard(size_t bytes_count, size_t fds_count);
 
+    void enable_statistics();
+    SendQueueStatistics statistics();
+
 private:
     AllocatingMemoryStream m_stream;
     Vector<int> m_fds;
     Threading::Mutex m_mutex;
     Threading::ConditionVariable m_condition { m_mutex };
     bool m_running { true };
+
+    // To measure how long messages wait in the queue, we remember where each message ends in the stream of bytes we
+    // have been asked to send, and when it was enqueued.
+    struct EnqueuedMessage {
+        u64 end_offset { 0 };
+        MonotonicTime enqueue_time;
+    };
+    bool m_collects_statistics { false };
+    Queue<EnqueuedMessage> m_enqueued_messages;
+    u64 m_enqueued_byte_count { 0 };
+    u64 m_sent_byte_count { 0 };
+    SendQueueStatistics m_statistics;
 };
 
 class TransportSocket {
@@ -50,6 +67,7 @@ class TransportSocket {
 
 public:
     static constexpr socklen_t SOCKET_BUFFER_SIZE = 128 * KiB;
+    static constexpr size_t RECEIVE_CHUNK_SIZE = 64 * KiB;
 
     explicit TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket);
     ~TransportSocket();
@@ -79,6 +97,9 @@ public:
 
     ErrorOr<IPC::File> clone_for_transfer();
 
+    void enable_send_queue_statistics() { m_send_queue->enable_statistics(); }
+    SendQueueStatistics send_queue_statistics() const { return m_send_queue->statistics(); }
+
 private:
     enum class TransferState {
         Continue,
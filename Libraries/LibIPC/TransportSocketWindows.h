@@ -9,6 +9,7 @@
 
 #include <AK/Queue.h>
 #include <LibCore/Socket.h>
+#include <LibIPC/ConnectionStatistics.h>
 #include <LibIPC/File.h>
 
 namespace IPC {
@@ -45,6 +46,10 @@ public:
 
     ErrorOr<IPC::File> clone_for_transfer();
 
+    // NOTE: Messages are written synchronously, so they never wait in a queue.
+    void enable_send_queue_statistics() { }
+    SendQueueStatistics send_queue_statistics() const { return {}; }
+
 private:
     ErrorOr<void> duplicate_handles(Bytes, Vector<size_t> const& handle_offsets);
     ErrorOr<void> transfer(ReadonlyBytes);
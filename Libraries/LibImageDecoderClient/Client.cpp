@@ -20,9 +20,10 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+    m_pending_animation_frames.clear();
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, StreamAnimationFrames stream_animation_frames)
 {
     auto promise = Core::Promise<DecodedImage>::construct();
     if (on_resolved)
@@ -45,7 +46,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
 
     memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
 
-    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type);
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type, stream_animation_frames == StreamAnimationFrames::Yes);
     if (!response) {
         dbgln("ImageDecoder disconnected trying to decode image");
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
@@ -57,7 +58,54 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+Optional<i64> Client::image_id_for_pending_promise(Core::Promise<DecodedImage> const& promise) const
+{
+    for (auto const& [image_id, pending_promise] : m_pending_decoded_images) {
+        if (pending_promise.ptr() == &promise)
+            return image_id;
+    }
+    return {};
+}
+
+void Client::prioritize_decoding(Core::Promise<DecodedImage> const& promise)
+{
+    if (auto image_id = image_id_for_pending_promise(promise); image_id.has_value())
+        async_prioritize_decoding(*image_id);
+}
+
+void Client::cancel_decoding(Core::Promise<DecodedImage> const& promise)
+{
+    auto image_id = image_id_for_pending_promise(promise);
+    if (!image_id.has_value())
+        return;
+
+    async_cancel_decoding(*image_id);
+    m_pending_decoded_images.take(*image_id).value()->reject(Error::from_errno(ECANCELED));
+}
+
+void Client::request_animation_frames(i64 animation_id, u32 first_frame_index, u32 frame_count, AnimationFramesCallback on_frames_decoded)
+{
+    m_pending_animation_frames.set(animation_id, move(on_frames_decoded));
+    async_request_animation_frames(animation_id, first_frame_index, frame_count);
+}
+
+void Client::release_animation(i64 animation_id)
+{
+    m_pending_animation_frames.remove(animation_id);
+    async_release_animation(animation_id);
+}
+
+void Client::did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations)
+{
+    auto on_frames_decoded = m_pending_animation_frames.take(image_id);
+    if (!on_frames_decoded.has_value())
+        return;
+
+    VERIFY(bitmap_sequence.bitmaps.size() == durations.size());
+    on_frames_decoded.value()(first_frame_index, move(bitmap_sequence.bitmaps), move(durations));
+}
+
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, AK::Duration queue_time, AK::Duration decode_time)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
@@ -65,6 +113,8 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     auto maybe_promise = m_pending_decoded_images.take(image_id);
     if (!maybe_promise.has_value()) {
         dbgln("ImageDecoderClient: No pending image with ID {}", image_id);
+        if (bitmaps.size() < frame_count)
+            async_release_animation(image_id);
         return;
     }
     auto promise = maybe_promise.release_value();
@@ -75,10 +125,17 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
+    image.queue_time = queue_time;
+    image.decode_time = decode_time;
+    image.frame_count = frame_count;
+    if (bitmaps.size() < frame_count)
+        image.streamed_animation_id = image_id;
     for (size_t i = 0; i < bitmaps.size(); ++i) {
         if (!bitmaps[i]) {
             dbgln("ImageDecoderClient: Invalid bitmap for request {} at index {}", image_id, i);
             promise->reject(Error::from_string_literal("Invalid bitmap"));
+            if (image.streamed_animation_id.has_value())
+                async_release_animation(image_id);
             return;
         }
 
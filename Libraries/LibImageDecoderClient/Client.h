@@ -26,6 +26,15 @@ struct DecodedImage {
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // If only the first few frames of an animation were decoded, this is what to request the rest of them with, out of
+    // frame_count frames in total. The decoder keeps its state around until release_animation() is called.
+    Optional<i64> streamed_animation_id;
+    u32 frame_count { 0 };
+
+    // How long the decode waited for a decoder thread, and how long the decode itself took.
+    AK::Duration queue_time;
+    AK::Duration decode_time;
 };
 
 class Client final
@@ -38,17 +47,36 @@ public:
 
     Client(NonnullOwnPtr<IPC::Transport>);
 
-    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    enum class StreamAnimationFrames {
+        No,
+        Yes,
+    };
+    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, StreamAnimationFrames = StreamAnimationFrames::No);
+
+    // Decodes frame_count frames of a streamed animation, starting at first_frame_index. Frames that failed to decode
+    // have a null bitmap. Only the callback of the latest request for an animation is called.
+    using AnimationFramesCallback = Function<void(u32 first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps, Vector<u32> durations)>;
+    void request_animation_frames(i64 animation_id, u32 first_frame_index, u32 frame_count, AnimationFramesCallback);
+    void release_animation(i64 animation_id);
+
+    // Lets the decoder know that an image from decode_image() is more urgent than others (e.g. because it is
+    // visible in the viewport), or no longer needed at all. The latter rejects the image's promise.
+    void prioritize_decoding(Core::Promise<DecodedImage> const&);
+    void cancel_decoding(Core::Promise<DecodedImage> const&);
 
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, AK::Duration queue_time, AK::Duration decode_time) override;
+    virtual void did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
 
+    Optional<i64> image_id_for_pending_promise(Core::Promise<DecodedImage> const&) const;
+
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    HashMap<i64, AnimationFramesCallback> m_pending_animation_frames;
 };
 
 }
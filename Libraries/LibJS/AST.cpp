@@ -40,6 +40,99 @@
 
 namespace JS {
 
+// OPTIMIZATION: Parsing a large script creates millions of small AST nodes, and they are almost all destroyed together
+//               once bytecode has been generated for them. Rather than getting each one from malloc, we carve them out
+//               of large chunks, and count how many nodes in each chunk are still alive. A chunk goes back to malloc
+//               once the last of its nodes is gone (and the thread that was filling it has moved on), so nodes that are
+//               kept around for longer (e.g. the bodies of functions that haven't been compiled yet) only keep their
+//               own chunks alive.
+struct alignas(alignof(max_align_t)) ASTNodeChunk {
+    static constexpr size_t size = 64 * KiB;
+
+    u8* data() { return reinterpret_cast<u8*>(this + 1); }
+
+    // NOTE: One of these is held by the allocator while it still allocates from the chunk.
+    Atomic<size_t> live_allocation_count { 1 };
+    size_t bytes_used { 0 };
+};
+
+static constexpr size_t ast_node_chunk_capacity = ASTNodeChunk::size - sizeof(ASTNodeChunk);
+
+// NOTE: Every allocation is preceded by a pointer to the chunk it came from, or null if it was allocated on its own.
+static constexpr size_t ast_node_allocation_header_size = alignof(max_align_t);
+static constexpr size_t largest_chunked_ast_node_allocation = 1 * KiB;
+
+static void release_ast_node_chunk(ASTNodeChunk& chunk)
+{
+    if (chunk.live_allocation_count.fetch_sub(1, AK::memory_order_acq_rel) != 1)
+        return;
+    chunk.~ASTNodeChunk();
+    ::operator delete(&chunk);
+}
+
+class ASTNodeAllocator {
+public:
+    ~ASTNodeAllocator()
+    {
+        if (m_current_chunk)
+            release_ast_node_chunk(*m_current_chunk);
+    }
+
+    void* allocate(size_t size)
+    {
+        auto allocation_size = align_up_to(ast_node_allocation_header_size + size, ast_node_allocation_header_size);
+
+        u8* memory = nullptr;
+        ASTNodeChunk* chunk = nullptr;
+
+        // NOTE: Nodes sharing a chunk would stop ASAN from detecting uses of destroyed nodes.
+#ifndef HAS_ADDRESS_SANITIZER
+        if (allocation_size <= largest_chunked_ast_node_allocation) {
+            if (!m_current_chunk || m_current_chunk->bytes_used + allocation_size > ast_node_chunk_capacity) {
+                if (m_current_chunk)
+                    release_ast_node_chunk(*m_current_chunk);
+                m_current_chunk = ::new (::operator new(ASTNodeChunk::size)) ASTNodeChunk;
+            }
+
+            chunk = m_current_chunk;
+            memory = chunk->data() + chunk->bytes_used;
+            chunk->bytes_used += allocation_size;
+            chunk->live_allocation_count.fetch_add(1, AK::memory_order_relaxed);
+        }
+#endif
+
+        if (!memory)
+            memory = static_cast<u8*>(::operator new(allocation_size));
+
+        *reinterpret_cast<ASTNodeChunk**>(memory) = chunk;
+        return memory + ast_node_allocation_header_size;
+    }
+
+    static void deallocate(void* pointer)
+    {
+        auto* memory = static_cast<u8*>(pointer) - ast_node_allocation_header_size;
+        if (auto* chunk = *reinterpret_cast<ASTNodeChunk**>(memory))
+            release_ast_node_chunk(*chunk);
+        else
+            ::operator delete(memory);
+    }
+
+private:
+    ASTNodeChunk* m_current_chunk { nullptr };
+};
+
+static thread_local ASTNodeAllocator s_ast_node_allocator;
+
+void* ASTNode::operator new(size_t size)
+{
+    return s_ast_node_allocator.allocate(size);
+}
+
+void ASTNode::operator delete(void* pointer)
+{
+    ASTNodeAllocator::deallocate(pointer);
+}
+
 ASTNode::ASTNode(SourceRange source_range)
     : m_start_offset(source_range.start.offset)
     , m_source_code(source_range.code)
@@ -826,7 +919,7 @@ void BindingPattern::dump(int indent) const
     }
 }
 
-FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
+FunctionNode::FunctionNode(RefPtr<Identifier const> name, SourceCodeSlice source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
     : m_name(move(name))
     , m_source_text(move(source_text))
     , m_body(move(body))
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/OwnPtr.h>
@@ -56,8 +57,10 @@ class ASTNode : public RefCounted<ASTNode> {
 public:
     virtual ~ASTNode() = default;
 
-    // NOTE: This is here to stop ASAN complaining about mismatch between new/delete sizes in ASTNodeWithTailArray.
-    void operator delete(void* ptr) { ::operator delete(ptr); }
+    // NOTE: AST nodes are allocated from chunks shared by many nodes, see AST.cpp. This also stops ASAN from complaining
+    //       about the mismatch between new/delete sizes in ASTNodeWithTailArray.
+    static void* operator new(size_t);
+    static void operator delete(void*);
 
     virtual Bytecode::CodeGenerationErrorOr<Optional<Bytecode::ScopedOperand>> generate_bytecode(Bytecode::Generator&, Optional<Bytecode::ScopedOperand> preferred_dst = {}) const;
     virtual void dump(int indent) const;
@@ -142,7 +145,7 @@ protected:
     {
         static_assert(sizeof(ActualDerived) == sizeof(Derived), "This leaf class cannot add more members");
         static_assert(alignof(ActualDerived) % alignof(T) == 0, "Need padding for tail array");
-        auto* memory = ::operator new(sizeof(ActualDerived) + tail_size * sizeof(T));
+        auto* memory = ASTNode::operator new(sizeof(ActualDerived) + tail_size * sizeof(T));
         return adopt_ref(*::new (memory) ActualDerived(move(source_range), forward<Args>(args)...));
     }
 
@@ -733,7 +736,9 @@ struct FunctionParameter {
     bool is_rest { false };
 };
 
-class FunctionParameters : public RefCounted<FunctionParameters> {
+// NOTE: The empty parameter list is shared by all functions without parameters, including ones whose AST was parsed on
+//       another thread, so it has to be safe to reference from any thread.
+class FunctionParameters : public AtomicRefCounted<FunctionParameters> {
 public:
     static NonnullRefPtr<FunctionParameters> create(Vector<FunctionParameter> parameters)
     {
@@ -782,7 +787,7 @@ class FunctionNode {
 public:
     FlyString name() const { return m_name ? m_name->string() : ""_fly_string; }
     RefPtr<Identifier const> name_identifier() const { return m_name; }
-    ByteString const& source_text() const { return m_source_text; }
+    SourceCodeSlice const& source_text() const { return m_source_text; }
     Statement const& body() const { return *m_body; }
     auto const& body_ptr() const { return m_body; }
     auto const& parameters() const { return m_parameters; }
@@ -805,13 +810,13 @@ public:
     virtual ~FunctionNode();
 
 protected:
-    FunctionNode(RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names);
+    FunctionNode(RefPtr<Identifier const> name, SourceCodeSlice source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names);
     void dump(int indent, ByteString const& class_name) const;
 
     RefPtr<Identifier const> m_name { nullptr };
 
 private:
-    ByteString m_source_text;
+    SourceCodeSlice m_source_text;
     NonnullRefPtr<Statement const> m_body;
     NonnullRefPtr<FunctionParameters const> m_parameters;
     i32 const m_function_length;
@@ -831,7 +836,7 @@ class FunctionDeclaration final
 public:
     static bool must_have_name() { return true; }
 
-    FunctionDeclaration(SourceRange source_range, RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights insights, Vector<LocalVariable> local_variables_names)
+    FunctionDeclaration(SourceRange source_range, RefPtr<Identifier const> name, SourceCodeSlice source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights insights, Vector<LocalVariable> local_variables_names)
         : Declaration(move(source_range))
         , FunctionNode(move(name), move(source_text), move(body), move(parameters), function_length, kind, is_strict_mode, insights, false, move(local_variables_names))
     {
@@ -861,7 +866,7 @@ class FunctionExpression final
 public:
     static bool must_have_name() { return false; }
 
-    FunctionExpression(SourceRange source_range, RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights insights, Vector<LocalVariable> local_variables_names, bool is_arrow_function = false)
+    FunctionExpression(SourceRange source_range, RefPtr<Identifier const> name, SourceCodeSlice source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights insights, Vector<LocalVariable> local_variables_names, bool is_arrow_function = false)
         : Expression(move(source_range))
         , FunctionNode(move(name), move(source_text), move(body), move(parameters), function_length, kind, is_strict_mode, insights, is_arrow_function, move(local_variables_names))
     {
@@ -1497,7 +1502,7 @@ public:
 
 class ClassExpression final : public Expression {
 public:
-    ClassExpression(SourceRange source_range, RefPtr<Identifier const> name, ByteString source_text, RefPtr<FunctionExpression const> constructor, RefPtr<Expression const> super_class, Vector<NonnullRefPtr<ClassElement const>> elements)
+    ClassExpression(SourceRange source_range, RefPtr<Identifier const> name, SourceCodeSlice source_text, RefPtr<FunctionExpression const> constructor, RefPtr<Expression const> super_class, Vector<NonnullRefPtr<ClassElement const>> elements)
         : Expression(move(source_range))
         , m_name(move(name))
         , m_source_text(move(source_text))
@@ -1509,7 +1514,7 @@ public:
 
     FlyString name() const { return m_name ? m_name->string() : ""_fly_string; }
 
-    ByteString const& source_text() const { return m_source_text; }
+    SourceCodeSlice const& source_text() const { return m_source_text; }
     RefPtr<FunctionExpression const> constructor() const { return m_constructor; }
 
     virtual void dump(int indent) const override;
@@ -1526,7 +1531,7 @@ private:
     friend ClassDeclaration;
 
     RefPtr<Identifier const> m_name;
-    ByteString m_source_text;
+    SourceCodeSlice m_source_text;
     RefPtr<FunctionExpression const> m_constructor;
     RefPtr<Expression const> m_super_class;
     Vector<NonnullRefPtr<ClassElement const>> m_elements;
@@ -8,6 +8,7 @@
  */
 
 #include <AK/Find.h>
+#include <AK/HashTable.h>
 #include <AK/Queue.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Generator.h>
@@ -160,6 +161,15 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> BinaryExpression::gener
         return dst;
     }
 
+    // OPTIMIZATION: `"name" in object` checks for the same property every time, so it can be cached like a GetById.
+    if (m_op == BinaryOp::In && is<StringLiteral>(*m_lhs)) {
+        auto const& property_name = static_cast<StringLiteral const&>(*m_lhs).value();
+        auto base = TRY(m_rhs->generate_bytecode(generator)).value();
+        auto dst = choose_dst(generator, preferred_dst);
+        generator.emit<Bytecode::Op::HasById>(dst, base, generator.intern_identifier(property_name), generator.next_property_lookup_cache());
+        return dst;
+    }
+
     // OPTIMIZATION: If LHS and/or RHS are numeric literals, we make sure they are converted to i32/u32
     //               as appropriate, to avoid having to perform these conversions at runtime.
 
@@ -286,7 +296,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> BinaryExpression::gener
         generator.emit<Bytecode::Op::In>(dst, lhs, rhs);
         break;
     case BinaryOp::InstanceOf:
-        generator.emit<Bytecode::Op::InstanceOf>(dst, lhs, rhs);
+        generator.emit<Bytecode::Op::InstanceOf>(dst, lhs, rhs, generator.next_property_lookup_cache());
         break;
     default:
         VERIFY_NOT_REACHED();
@@ -1137,6 +1147,29 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ForStatement::generate_
     return body_result;
 }
 
+static bool is_eligible_for_object_literal_shape_cache(Vector<NonnullRefPtr<ObjectProperty>> const& properties)
+{
+    // NOTE: Objects with more properties than this are turned into dictionaries by Object::storage_set(),
+    //       and dictionary shapes are unique to their object.
+    static constexpr size_t max_property_count = 64;
+    if (properties.size() < 2 || properties.size() > max_property_count)
+        return false;
+
+    HashTable<FlyString> seen_names;
+    for (auto const& property : properties) {
+        if (property->type() != ObjectProperty::Type::KeyValue || property->is_method())
+            return false;
+        if (!is<StringLiteral>(property->key()))
+            return false;
+        auto name = MUST(FlyString::from_utf8(static_cast<StringLiteral const&>(property->key()).value().bytes()));
+        if (PropertyKey { name }.is_number())
+            return false;
+        if (seen_names.set(name) != HashSetResult::InsertedNewEntry)
+            return false;
+    }
+    return true;
+}
+
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::generate_bytecode(Bytecode::Generator& generator, [[maybe_unused]] Optional<ScopedOperand> preferred_dst) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
@@ -1149,6 +1182,26 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::gener
 
     generator.push_home_object(object);
 
+    // OPTIMIZATION: A literal with only plain `name: value` properties, all with distinct non-index names, always
+    //               produces objects of the same shape. So instead of defining the properties one by one, we define
+    //               them all with a single instruction that can cache the resulting shape.
+    if (is_eligible_for_object_literal_shape_cache(m_properties)) {
+        Vector<ScopedOperand> values;
+        Vector<Bytecode::Op::PutObjectLiteralProperties::Property> properties;
+        values.ensure_capacity(m_properties.size());
+        properties.ensure_capacity(m_properties.size());
+        for (auto& property : m_properties) {
+            auto const& name = static_cast<StringLiteral const&>(property->key()).value();
+            auto value = TRY(generator.emit_named_evaluation_if_anonymous_function(property->value(), generator.intern_identifier(name)));
+            values.append(generator.copy_if_needed_to_preserve_evaluation_order(value));
+            properties.append({ generator.intern_identifier(MUST(FlyString::from_utf8(name.bytes()))), values.last() });
+        }
+        generator.emit_with_extra_slots<Bytecode::Op::PutObjectLiteralProperties, Bytecode::Op::PutObjectLiteralProperties::Property>(
+            properties.size(), object, generator.next_object_literal_shape_cache(), properties);
+        generator.pop_home_object();
+        return object;
+    }
+
     for (auto& property : m_properties) {
         Bytecode::Op::PropertyKind property_kind;
         switch (property->type()) {
@@ -12,24 +12,32 @@
 namespace JS::Bytecode {
 
 // TitleCaseName, snake_case_name, base, property, argument_count
-#define JS_ENUMERATE_BUILTINS(O)                                                                  \
-    O(MathAbs, math_abs, Math, abs, 1)                                                            \
-    O(MathLog, math_log, Math, log, 1)                                                            \
-    O(MathPow, math_pow, Math, pow, 2)                                                            \
-    O(MathExp, math_exp, Math, exp, 1)                                                            \
-    O(MathCeil, math_ceil, Math, ceil, 1)                                                         \
-    O(MathFloor, math_floor, Math, floor, 1)                                                      \
-    O(MathImul, math_imul, Math, imul, 2)                                                         \
-    O(MathRandom, math_random, Math, random, 0)                                                   \
-    O(MathRound, math_round, Math, round, 1)                                                      \
-    O(MathSqrt, math_sqrt, Math, sqrt, 1)                                                         \
-    O(MathSin, math_sin, Math, sin, 1)                                                            \
-    O(MathCos, math_cos, Math, cos, 1)                                                            \
-    O(MathTan, math_tan, Math, tan, 1)                                                            \
-    O(ArrayIteratorPrototypeNext, array_iterator_prototype_next, ArrayIteratorPrototype, next, 0) \
-    O(MapIteratorPrototypeNext, map_iterator_prototype_next, MapIteratorPrototype, next, 0)       \
-    O(SetIteratorPrototypeNext, set_iterator_prototype_next, SetIteratorPrototype, next, 0)       \
-    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0)
+#define JS_ENUMERATE_BUILTINS(O)                                                                     \
+    O(MathAbs, math_abs, Math, abs, 1)                                                               \
+    O(MathLog, math_log, Math, log, 1)                                                               \
+    O(MathPow, math_pow, Math, pow, 2)                                                               \
+    O(MathExp, math_exp, Math, exp, 1)                                                               \
+    O(MathCeil, math_ceil, Math, ceil, 1)                                                            \
+    O(MathFloor, math_floor, Math, floor, 1)                                                         \
+    O(MathImul, math_imul, Math, imul, 2)                                                            \
+    O(MathRandom, math_random, Math, random, 0)                                                      \
+    O(MathRound, math_round, Math, round, 1)                                                         \
+    O(MathSqrt, math_sqrt, Math, sqrt, 1)                                                            \
+    O(MathSin, math_sin, Math, sin, 1)                                                               \
+    O(MathCos, math_cos, Math, cos, 1)                                                               \
+    O(MathTan, math_tan, Math, tan, 1)                                                               \
+    O(ArrayIteratorPrototypeNext, array_iterator_prototype_next, ArrayIteratorPrototype, next, 0)    \
+    O(MapIteratorPrototypeNext, map_iterator_prototype_next, MapIteratorPrototype, next, 0)          \
+    O(SetIteratorPrototypeNext, set_iterator_prototype_next, SetIteratorPrototype, next, 0)          \
+    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0) \
+    JS_ENUMERATE_METHOD_BUILTINS(O)
+
+// Builtins that are called as methods of whatever value they're looked up on, rather than of a well-known object.
+// get_builtin() recognizes these by their property name alone, as the callee being the builtin is checked at runtime anyway.
+#define JS_ENUMERATE_METHOD_BUILTINS(O)                                                         \
+    O(StringPrototypeCharAt, string_prototype_char_at, StringPrototype, charAt, 1)              \
+    O(StringPrototypeCharCodeAt, string_prototype_char_code_at, StringPrototype, charCodeAt, 1) \
+    O(ArrayPrototypePush, array_prototype_push, ArrayPrototype, push, 1)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
@@ -24,6 +24,7 @@ Executable::Executable(
     NonnullRefPtr<SourceCode const> source_code,
     size_t number_of_property_lookup_caches,
     size_t number_of_global_variable_caches,
+    size_t number_of_object_literal_shape_caches,
     size_t number_of_registers,
     bool is_strict_mode)
     : bytecode(move(bytecode))
@@ -37,10 +38,32 @@ Executable::Executable(
 {
     property_lookup_caches.resize(number_of_property_lookup_caches);
     global_variable_caches.resize(number_of_global_variable_caches);
+    object_literal_shape_caches.resize(number_of_object_literal_shape_caches);
 }
 
 Executable::~Executable() = default;
 
+MegamorphicPropertyLookupCache& MegamorphicPropertyLookupCache::the()
+{
+    // NOTE: Shapes belong to the heap of a single VM, so each thread gets its own cache.
+    //       It's allocated lazily to keep it out of the TLS block of threads that never run JS.
+    static thread_local OwnPtr<MegamorphicPropertyLookupCache> cache;
+    if (!cache) [[unlikely]]
+        cache = make<MegamorphicPropertyLookupCache>();
+    return *cache;
+}
+
+void MegamorphicPropertyLookupCache::dump_statistics() const
+{
+    auto lookups = m_statistics.hits + m_statistics.misses;
+    dbgln("Property lookup caches:");
+    dbgln("    Inline cache misses: {}", m_statistics.inline_cache_misses);
+    dbgln("Megamorphic property lookup cache:");
+    dbgln("    Sites that went megamorphic: {}", m_statistics.sites_that_went_megamorphic);
+    dbgln("    Lookups: {} ({} hits, {} misses, {:.1}% hit rate)", lookups, m_statistics.hits, m_statistics.misses,
+        lookups ? static_cast<double>(m_statistics.hits) * 100.0 / static_cast<double>(lookups) : 0.0);
+}
+
 void Executable::dump() const
 {
     warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
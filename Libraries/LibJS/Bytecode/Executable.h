@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/HashFunctions.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
@@ -34,6 +35,47 @@ struct PropertyLookupCache {
         WeakPtr<PrototypeChainValidity> prototype_chain_validity;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Set once this site has seen more shapes than it can remember. From then on, lookups that miss
+    // the entries above also go through the MegamorphicPropertyLookupCache.
+    bool is_megamorphic { false };
+};
+
+// A global (per-thread) cache of property lookups keyed by (Shape, property name), shared by every
+// megamorphic property access site. It's direct-mapped, so colliding lookups simply replace each other.
+class JS_API MegamorphicPropertyLookupCache {
+public:
+    static MegamorphicPropertyLookupCache& the();
+
+    static constexpr size_t number_of_entries = 4096;
+    static_assert(is_power_of_two(number_of_entries));
+
+    struct Entry {
+        FlyString property_name;
+        PropertyLookupCache::Entry cache_entry;
+    };
+
+    Entry& entry_for(Shape const& shape, FlyString const& property_name)
+    {
+        auto hash = pair_int_hash(ptr_hash(&shape), property_name.hash());
+        return m_entries[hash & (number_of_entries - 1)];
+    }
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 sites_that_went_megamorphic { 0 };
+
+        // Property gets and puts that found nothing in the polymorphic inline cache of their site, whether or not
+        // they went on to look in this cache.
+        u64 inline_cache_misses { 0 };
+    };
+    Statistics& statistics() { return m_statistics; }
+    void dump_statistics() const;
+
+private:
+    AK::Array<Entry, number_of_entries> m_entries;
+    Statistics m_statistics;
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -43,6 +85,13 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the shape an object literal ended up with, so the next object created by the same literal
+// can switch to it directly instead of taking one shape transition per property.
+struct ObjectLiteralShapeCache {
+    WeakPtr<Shape> initial_shape;
+    WeakPtr<Shape> shape;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -62,6 +111,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_object_literal_shape_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -71,6 +121,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<ObjectLiteralShapeCache> object_literal_shape_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -80,6 +131,12 @@ public:
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // How many times this executable has been entered by the interpreter. This is what a tiering
+    // policy uses to decide whether an executable is hot enough to be worth optimizing further.
+    u32 execution_count { 0 };
+    static constexpr u32 hot_execution_count_threshold = 1000;
+    bool is_hot() const { return execution_count >= hot_execution_count_threshold; }
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
@@ -340,7 +340,87 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
-    for (auto& block : generator.m_root_basic_blocks) {
+    auto& basic_blocks = generator.m_root_basic_blocks;
+
+    // Pass: Thread jumps through blocks that do nothing but jump somewhere else.
+    //       Break, continue and the end of nested control flow often produce chains of these.
+    auto final_jump_target = [&](size_t block_index) {
+        // NOTE: A chain of jump-only blocks can loop back on itself (e.g. `for (;;) {}`), so we give up after
+        //       visiting as many blocks as there are.
+        for (size_t steps = 0; steps < basic_blocks.size(); ++steps) {
+            auto const& block = *basic_blocks[block_index];
+            if (!block.is_terminated())
+                break;
+            auto const& first_instruction = *InstructionStreamIterator { block.instruction_stream() };
+            if (first_instruction.type() != Instruction::Type::Jump)
+                break;
+            auto target_index = static_cast<Op::Jump const&>(first_instruction).target().basic_block_index();
+            if (target_index == block_index)
+                break;
+            block_index = target_index;
+        }
+        return block_index;
+    };
+    for (auto& block : basic_blocks) {
+        Bytecode::InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                label = Label { static_cast<u32>(final_jump_target(label.basic_block_index())) };
+            });
+            ++it;
+        }
+    }
+
+    // Pass: Find the blocks that can be reached from the entry block, either through a label or by unwinding.
+    //       Everything else (e.g. the code following a `return`, or the jump-only blocks we just threaded
+    //       through) never has to be emitted.
+    Vector<bool> is_block_reachable;
+    is_block_reachable.resize(basic_blocks.size());
+    {
+        Vector<size_t> blocks_to_visit;
+        auto mark_reachable = [&](size_t block_index) {
+            if (is_block_reachable[block_index])
+                return;
+            is_block_reachable[block_index] = true;
+            blocks_to_visit.append(block_index);
+        };
+        mark_reachable(0);
+        while (!blocks_to_visit.is_empty()) {
+            auto const& block = *basic_blocks[blocks_to_visit.take_last()];
+            if (block.handler())
+                mark_reachable(block.handler()->index());
+            if (block.finalizer())
+                mark_reachable(block.finalizer()->index());
+            Bytecode::InstructionStreamIterator it(block.instruction_stream());
+            while (!it.at_end()) {
+                auto& instruction = const_cast<Instruction&>(*it);
+                instruction.visit_labels([&](Label& label) {
+                    mark_reachable(label.basic_block_index());
+                });
+                ++it;
+            }
+        }
+    }
+
+    // The index of the block that will be emitted right after each block, which is what a jump can fall through to.
+    Vector<size_t> next_emitted_block_index;
+    next_emitted_block_index.resize(basic_blocks.size());
+    {
+        size_t next_index = basic_blocks.size();
+        for (size_t i = basic_blocks.size(); i-- > 0;) {
+            next_emitted_block_index[i] = next_index;
+            if (is_block_reachable[i])
+                next_index = i;
+        }
+    }
+
+    for (auto& block : basic_blocks) {
+        if (!is_block_reachable[block->index()])
+            continue;
+
+        auto next_block_index = next_emitted_block_index[block->index()];
+
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
             unlinked_exception_handlers.append({
@@ -365,7 +445,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
                 // OPTIMIZATION: Don't emit jumps that just jump to the next block.
-                if (jump.target().basic_block_index() == block->index() + 1) {
+                if (jump.target().basic_block_index() == next_block_index) {
                     if (basic_block_start_offsets.last() == bytecode.size()) {
                         // This block is empty, just skip it.
                         basic_block_start_offsets.take_last();
@@ -375,7 +455,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                 }
 
                 // OPTIMIZATION: For jumps to a return-or-end-only block, we can emit a `Return` or `End` directly instead.
-                auto& target_block = *generator.m_root_basic_blocks[jump.target().basic_block_index()];
+                auto& target_block = *basic_blocks[jump.target().basic_block_index()];
                 if (target_block.is_terminated()) {
                     auto target_instruction_iterator = InstructionStreamIterator { target_block.instruction_stream() };
                     auto& target_instruction = *target_instruction_iterator;
@@ -402,7 +482,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
             //               we can emit a `JumpTrue` or `JumpFalse` (to the other block) instead.
             if (instruction.type() == Instruction::Type::JumpIf) {
                 auto& jump = static_cast<Bytecode::Op::JumpIf&>(instruction);
-                if (jump.true_target().basic_block_index() == block->index() + 1) {
+                if (jump.true_target().basic_block_index() == next_block_index) {
                     Op::JumpFalse jump_false(jump.condition(), Label { jump.false_target() });
                     auto& label = jump_false.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_false));
@@ -411,7 +491,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                     ++it;
                     continue;
                 }
-                if (jump.false_target().basic_block_index() == block->index() + 1) {
+                if (jump.false_target().basic_block_index() == next_block_index) {
                     Op::JumpTrue jump_true(jump.condition(), Label { jump.true_target() });
                     auto& label = jump_true.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_true));
@@ -439,7 +519,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     }
     for (auto label_offset : label_offsets) {
         auto& label = *reinterpret_cast<Label*>(bytecode.data() + label_offset);
-        auto* block = generator.m_root_basic_blocks[label.basic_block_index()].ptr();
+        auto* block = basic_blocks[label.basic_block_index()].ptr();
         label.set_address(block_offsets.get(block).value());
     }
 
@@ -452,6 +532,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_object_literal_shape_cache,
         generator.m_next_register,
         is_strict_mode);
 
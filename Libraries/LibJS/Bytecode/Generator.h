@@ -337,6 +337,7 @@ public:
 
     [[nodiscard]] size_t next_global_variable_cache() { return m_next_global_variable_cache++; }
     [[nodiscard]] size_t next_property_lookup_cache() { return m_next_property_lookup_cache++; }
+    [[nodiscard]] size_t next_object_literal_shape_cache() { return m_next_object_literal_shape_cache++; }
 
     enum class DeduplicateConstant {
         Yes,
@@ -407,6 +408,7 @@ private:
     u32 m_next_block { 1 };
     u32 m_next_property_lookup_cache { 0 };
     u32 m_next_global_variable_cache { 0 };
+    u32 m_next_object_literal_shape_cache { 0 };
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
@@ -72,6 +72,7 @@
     O(GetInitializedBinding)           \
     O(GreaterThan)                     \
     O(GreaterThanEquals)               \
+    O(HasById)                         \
     O(HasPrivateId)                    \
     O(ImportCall)                      \
     O(In)                              \
@@ -125,6 +126,7 @@
     O(PutBySpread)                     \
     O(PutByValue)                      \
     O(PutByValueWithThis)              \
+    O(PutObjectLiteralProperties)      \
     O(PutPrivateById)                  \
     O(ResolveSuperBase)                \
     O(ResolveThisBinding)              \
@@ -165,6 +167,14 @@ public:
 #undef __BYTECODE_OP
     };
 
+    static constexpr size_t number_of_types = 0
+#define __BYTECODE_OP(op) +1
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        ;
+
+    static StringView type_name(Type);
+
     Type type() const { return m_type; }
     size_t length() const;
     ByteString to_byte_string(Bytecode::Executable const&) const;
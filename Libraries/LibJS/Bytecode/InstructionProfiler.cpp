@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/InstructionProfiler.h>
+
+namespace JS::Bytecode {
+
+InstructionProfiler::InstructionProfiler(GC::Heap& heap)
+    : m_heap(heap)
+    , m_allocation_count_at_current_instruction(heap.total_allocation_count())
+{
+}
+
+void InstructionProfiler::attribute_allocations_to_current_instruction()
+{
+    auto allocation_count = m_heap.total_allocation_count();
+    if (m_current_counters)
+        m_current_counters->allocations += allocation_count - m_allocation_count_at_current_instruction;
+    m_allocation_count_at_current_instruction = allocation_count;
+}
+
+void InstructionProfiler::did_execute_instruction(Executable& executable, size_t offset)
+{
+    attribute_allocations_to_current_instruction();
+
+    auto& profile = *m_profiles.ensure(&executable, [&] {
+        auto profile = make<ExecutableProfile>(GC::make_root(executable));
+        m_profiles_in_order_of_first_execution.append(profile.ptr());
+        return profile;
+    });
+
+    ++profile.executions;
+    m_current_counters = &profile.counters_by_offset.ensure(static_cast<u32>(offset));
+    ++m_current_counters->executions;
+}
+
+String InstructionProfiler::dump()
+{
+    attribute_allocations_to_current_instruction();
+
+    auto profiles = m_profiles_in_order_of_first_execution;
+    quick_sort(profiles, [](auto const* a, auto const* b) { return a->executions > b->executions; });
+
+    StringBuilder builder;
+    for (auto const* profile : profiles) {
+        auto const& executable = *profile->executable;
+        builder.appendff("JS bytecode executable \"{}\": {} instructions run\n", executable.name, profile->executions);
+        builder.appendff("    {:>12} {:>10} {:>10} {:>10} {:>10}\n", "runs"sv, "IC misses"sv, "MC hits"sv, "MC misses"sv, "allocs"sv);
+
+        for (InstructionStreamIterator it(executable.bytecode, &executable); !it.at_end(); ++it) {
+            auto counters = profile->counters_by_offset.get(static_cast<u32>(it.offset())).value_or({});
+            builder.appendff("    {:12} {:10} {:10} {:10} {:10} [{:4x}] {}\n",
+                counters.executions,
+                counters.inline_cache_misses,
+                counters.megamorphic_cache_hits,
+                counters.megamorphic_cache_misses,
+                counters.allocations,
+                it.offset(),
+                (*it).to_byte_string(executable));
+        }
+        builder.append('\n');
+    }
+    return MUST(builder.to_string());
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Root.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// Counts how many times each instruction of each executable is run, how often the property lookup caches of each
+// instruction miss, and how many cells are allocated by each instruction.
+//
+// NOTE: Allocations are attributed to the instruction that ran most recently when they happened, which (for calls)
+//       may be the last instruction of the function that was called rather than the call itself.
+//       Every executable that runs while profiling is kept alive until the profiler goes away, so its counts can be
+//       shown next to its bytecode.
+class JS_API InstructionProfiler {
+public:
+    struct Counters {
+        u64 executions { 0 };
+        u64 inline_cache_misses { 0 };
+        u64 megamorphic_cache_hits { 0 };
+        u64 megamorphic_cache_misses { 0 };
+        u64 allocations { 0 };
+    };
+
+    explicit InstructionProfiler(GC::Heap&);
+
+    void did_execute_instruction(Executable&, size_t offset);
+
+    void did_miss_inline_cache()
+    {
+        if (m_current_counters)
+            ++m_current_counters->inline_cache_misses;
+    }
+    void did_hit_megamorphic_cache()
+    {
+        if (m_current_counters)
+            ++m_current_counters->megamorphic_cache_hits;
+    }
+    void did_miss_megamorphic_cache()
+    {
+        if (m_current_counters)
+            ++m_current_counters->megamorphic_cache_misses;
+    }
+
+    // Returns the bytecode of every executable that has run, with the most frequently run ones first, and the counters
+    // of each instruction in front of it.
+    String dump();
+
+private:
+    struct ExecutableProfile {
+        GC::Root<Executable> executable;
+        HashMap<u32, Counters> counters_by_offset;
+        u64 executions { 0 };
+    };
+
+    void attribute_allocations_to_current_instruction();
+
+    GC::Heap& m_heap;
+    HashMap<Executable const*, NonnullOwnPtr<ExecutableProfile>> m_profiles;
+    Vector<ExecutableProfile*> m_profiles_in_order_of_first_execution;
+
+    // NOTE: This points into the counters of an ExecutableProfile, so it's only valid until another instruction of the
+    //       same executable is added there.
+    Counters* m_current_counters { nullptr };
+    u64 m_allocation_count_at_current_instruction { 0 };
+};
+
+}
@@ -26,6 +26,7 @@
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/Environment.h>
 #include <LibJS/Runtime/FunctionEnvironment.h>
+#include <LibJS/Runtime/FunctionPrototype.h>
 #include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -390,6 +391,17 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+    // While instructions are being counted or profiled, every instruction goes through a label that counts it first.
+    // NOTE: This is picked once per call, so that not counting costs nothing more than dispatching through a
+    //       table that isn't known at compile time.
+    static void* const counting_dispatch_table[] = {
+#define SET_UP_LABEL(name) &&count_##name,
+        ENUMERATE_BYTECODE_OPS(SET_UP_LABEL)
+    };
+#undef SET_UP_LABEL
+
+    void* const* dispatch_table = m_instruction_counts || m_instruction_profiler ? counting_dispatch_table : bytecode_dispatch_table;
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -397,13 +409,29 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
-        goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
+        goto* dispatch_table[static_cast<size_t>(next_instruction.type())];                         \
     } while (0)
 
     for (;;) {
     start:
+        if (m_sampling_profiler) [[unlikely]]
+            m_sampling_profiler->did_reach_safepoint(vm());
+
         for (;;) {
-            goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+            goto* dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+
+#define COUNT_INSTRUCTION(name)                                                           \
+    count_##name:                                                                         \
+    {                                                                                     \
+        if (m_instruction_counts)                                                         \
+            ++(*m_instruction_counts)[static_cast<size_t>(Instruction::Type::name)];      \
+        if (m_instruction_profiler)                                                       \
+            m_instruction_profiler->did_execute_instruction(executable, program_counter); \
+        goto handle_##name;                                                               \
+    }
+
+            ENUMERATE_BYTECODE_OPS(COUNT_INSTRUCTION)
+#undef COUNT_INSTRUCTION
 
         handle_Mov: {
             auto& instruction = *reinterpret_cast<Op::Mov const*>(&bytecode[program_counter]);
@@ -629,6 +657,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(GetInitializedBinding);
             HANDLE_INSTRUCTION(GreaterThan);
             HANDLE_INSTRUCTION(GreaterThanEquals);
+            HANDLE_INSTRUCTION(HasById);
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
@@ -667,6 +696,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(PutBySpread);
             HANDLE_INSTRUCTION(PutByValue);
             HANDLE_INSTRUCTION(PutByValueWithThis);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(PutObjectLiteralProperties);
             HANDLE_INSTRUCTION(PutPrivateById);
             HANDLE_INSTRUCTION(ResolveSuperBase);
             HANDLE_INSTRUCTION(ResolveThisBinding);
@@ -743,11 +773,19 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
     if (reg(Register::this_value()).is_special_empty_value())
         reg(Register::this_value()) = running_execution_context.this_value.value_or(js_special_empty_value());
 
+    // OPTIMIZATION: A generator or async function resumes in the very same execution context every time, which still
+    //               has the constants from when it started running, so there's no need to copy them in again.
+    bool constants_are_in_place = running_execution_context.executable == &executable;
     running_execution_context.executable = &executable;
 
+    if (executable.execution_count < NumericLimits<u32>::max())
+        ++executable.execution_count;
+
     auto* registers_and_constants_and_locals_and_arguments = running_execution_context.registers_and_constants_and_locals_and_arguments();
-    for (size_t i = 0; i < executable.constants.size(); ++i) {
-        registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
+    if (!constants_are_in_place) {
+        for (size_t i = 0; i < executable.constants.size(); ++i) {
+            registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
+        }
     }
 
     run_bytecode(entry_point.value_or(0));
@@ -853,22 +891,21 @@ ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM& vm, ECMAScriptFunct
     return bytecode_executable;
 }
 
+// NOTE: This function assumes that the index is valid within the TypedArray, and that the TypedArray is not detached.
+//       The whole TypedArray is then within its buffer, so the element's offset can be computed without overflow checks.
+template<typename T>
+ALWAYS_INLINE T* fast_typed_array_element_slot(TypedArrayBase& typed_array, u32 index)
+{
+    auto offset_into_array_buffer = typed_array.byte_offset() + static_cast<size_t>(index) * sizeof(T);
+    return reinterpret_cast<T*>(typed_array.viewed_array_buffer()->buffer().data() + offset_into_array_buffer);
+}
+
 // NOTE: This function assumes that the index is valid within the TypedArray,
 //       and that the TypedArray is not detached.
 template<typename T>
 inline Value fast_typed_array_get_element(TypedArrayBase& typed_array, u32 index)
 {
-    Checked<u32> offset_into_array_buffer = index;
-    offset_into_array_buffer *= sizeof(T);
-    offset_into_array_buffer += typed_array.byte_offset();
-
-    if (offset_into_array_buffer.has_overflow()) [[unlikely]] {
-        return js_undefined();
-    }
-
-    auto const& array_buffer = *typed_array.viewed_array_buffer();
-    auto const* slot = reinterpret_cast<T const*>(array_buffer.buffer().offset_pointer(offset_into_array_buffer.value()));
-    return Value { *slot };
+    return Value { *fast_typed_array_element_slot<T>(typed_array, index) };
 }
 
 // NOTE: This function assumes that the index is valid within the TypedArray,
@@ -876,17 +913,7 @@ inline Value fast_typed_array_get_element(TypedArrayBase& typed_array, u32 index
 template<typename T>
 inline void fast_typed_array_set_element(TypedArrayBase& typed_array, u32 index, T value)
 {
-    Checked<u32> offset_into_array_buffer = index;
-    offset_into_array_buffer *= sizeof(T);
-    offset_into_array_buffer += typed_array.byte_offset();
-
-    if (offset_into_array_buffer.has_overflow()) [[unlikely]] {
-        return;
-    }
-
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(offset_into_array_buffer.value()));
-    *slot = value;
+    *fast_typed_array_element_slot<T>(typed_array, index) = value;
 }
 
 static Completion throw_null_or_undefined_property_get(VM& vm, Value base_value, Optional<IdentifierTableIndex> base_identifier, IdentifierTableIndex property_identifier, Executable const& executable)
@@ -968,6 +995,39 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, base_identifier, property, executable);
 }
 
+// Makes room for a new entry at the front of a polymorphic inline cache, evicting the least recently added one.
+ALWAYS_INLINE PropertyLookupCache::Entry& get_cache_slot(PropertyLookupCache& cache)
+{
+    if (!cache.is_megamorphic && cache.entries.last().shape) {
+        cache.is_megamorphic = true;
+        ++MegamorphicPropertyLookupCache::the().statistics().sites_that_went_megamorphic;
+    }
+    for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
+        cache.entries[i] = cache.entries[i - 1];
+    }
+    cache.entries[0] = {};
+    return cache.entries[0];
+}
+
+// Returns true and sets `result` if the cache entry applies to an object with the given shape.
+ALWAYS_INLINE ThrowCompletionOr<bool> try_get_from_cache_entry(VM& vm, PropertyLookupCache::Entry const& cache_entry, Object& base_obj, Shape& shape, Value this_value, Value& result)
+{
+    if (&shape != cache_entry.shape)
+        return false;
+    if (cache_entry.prototype) {
+        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+        if (!cache_entry.prototype_chain_validity || !cache_entry.prototype_chain_validity->is_valid())
+            return false;
+        result = cache_entry.prototype->get_direct(cache_entry.property_offset.value());
+    } else {
+        // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+        result = base_obj.get_direct(cache_entry.property_offset.value());
+    }
+    if (result.is_accessor())
+        result = TRY(call(vm, result.as_accessor().getter(), this_value));
+    return true;
+}
+
 enum class GetByIdMode {
     Normal,
     Length,
@@ -993,63 +1053,167 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
 
     auto& shape = base_obj->shape();
 
+    Value cached_value;
     for (auto& cache_entry : cache.entries) {
-        if (cache_entry.prototype) {
-            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-            bool can_use_cache = [&]() -> bool {
-                if (&shape != cache_entry.shape)
-                    return false;
-                if (!cache_entry.prototype_chain_validity)
-                    return false;
-                if (!cache_entry.prototype_chain_validity->is_valid())
-                    return false;
-                return true;
-            }();
-            if (can_use_cache) {
-                auto value = cache_entry.prototype->get_direct(cache_entry.property_offset.value());
-                if (value.is_accessor())
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
-                return value;
-            }
-        } else if (&shape == cache_entry.shape) {
-            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-            auto value = base_obj->get_direct(cache_entry.property_offset.value());
-            if (value.is_accessor())
-                return TRY(call(vm, value.as_accessor().getter(), this_value));
-            return value;
+        if (TRY(try_get_from_cache_entry(vm, cache_entry, *base_obj, shape, this_value, cached_value)))
+            return cached_value;
+    }
+
+    auto const& property_name = executable.get_identifier(property);
+
+    auto* profiler = vm.bytecode_interpreter().instruction_profiler();
+    auto& megamorphic_cache = MegamorphicPropertyLookupCache::the();
+    ++megamorphic_cache.statistics().inline_cache_misses;
+    if (profiler) [[unlikely]]
+        profiler->did_miss_inline_cache();
+
+    MegamorphicPropertyLookupCache::Entry* megamorphic_entry = nullptr;
+    if (cache.is_megamorphic) {
+        megamorphic_entry = &megamorphic_cache.entry_for(shape, property_name);
+        if (megamorphic_entry->property_name == property_name
+            && TRY(try_get_from_cache_entry(vm, megamorphic_entry->cache_entry, *base_obj, shape, this_value, cached_value))) {
+            ++megamorphic_cache.statistics().hits;
+            if (profiler) [[unlikely]]
+                profiler->did_hit_megamorphic_cache();
+            return cached_value;
         }
+        ++megamorphic_cache.statistics().misses;
+        if (profiler) [[unlikely]]
+            profiler->did_miss_megamorphic_cache();
     }
 
     CacheablePropertyMetadata cacheable_metadata;
-    auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
+    auto value = TRY(base_obj->internal_get(property_name, this_value, &cacheable_metadata));
 
     // If internal_get() caused object's shape change, we can no longer be sure
     // that collected metadata is valid, e.g. if getter in prototype chain added
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
-        auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
-            for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
-                cache.entries[i] = cache.entries[i - 1];
+        auto fill_cache_entry = [&](PropertyLookupCache::Entry& entry) {
+            if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+                entry = {};
+                entry.shape = shape;
+                entry.property_offset = cacheable_metadata.property_offset.value();
+            } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
+                entry = {};
+                entry.shape = &base_obj->shape();
+                entry.property_offset = cacheable_metadata.property_offset.value();
+                entry.prototype = *cacheable_metadata.prototype;
+                entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
             }
-            cache.entries[0] = {};
-            return cache.entries[0];
         };
-        if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            auto& entry = get_cache_slot();
-            entry.shape = shape;
-            entry.property_offset = cacheable_metadata.property_offset.value();
-        } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
-            auto& entry = get_cache_slot();
-            entry.shape = &base_obj->shape();
-            entry.property_offset = cacheable_metadata.property_offset.value();
-            entry.prototype = *cacheable_metadata.prototype;
-            entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+        if (cacheable_metadata.type != CacheablePropertyMetadata::Type::NotCacheable) {
+            fill_cache_entry(get_cache_slot(cache));
+            if (megamorphic_entry) {
+                megamorphic_entry->property_name = property_name;
+                fill_cache_entry(megamorphic_entry->cache_entry);
+            }
         }
     }
 
     return value;
 }
 
+// Returns true if the cache entry says the property is on an object with the given shape, or on one of its prototypes.
+ALWAYS_INLINE bool cache_entry_has_property(PropertyLookupCache::Entry const& cache_entry, Shape const& shape)
+{
+    if (&shape != cache_entry.shape)
+        return false;
+    if (cache_entry.prototype && (!cache_entry.prototype_chain_validity || !cache_entry.prototype_chain_validity->is_valid()))
+        return false;
+    return true;
+}
+
+inline ThrowCompletionOr<bool> has_by_id(Object& base, PropertyKey const& property_key, PropertyLookupCache& cache)
+{
+    auto& shape = base.shape();
+    for (auto& cache_entry : cache.entries) {
+        if (cache_entry_has_property(cache_entry, shape))
+            return true;
+    }
+
+    auto has_property = TRY(base.internal_has_property(property_key));
+    if (!has_property || &shape != &base.shape())
+        return has_property;
+
+    // NOTE: We only ever remember where a property was found, never that it wasn't there, as exotic objects can have
+    //       properties that aren't in their shape. A property that is in the shape of the object, or in that of a
+    //       prototype whose chain hasn't changed since, is there no matter what else the objects do.
+    Object* object = &base;
+    while (object && !object->is_proxy_object() && !object->is_html_window_proxy()) {
+        auto& object_shape = object->shape();
+        if (!object_shape.lookup(property_key).has_value()) {
+            object = object_shape.prototype();
+            continue;
+        }
+
+        if (!object_shape.is_cacheable())
+            break;
+
+        if (object == &base) {
+            auto& entry = get_cache_slot(cache);
+            entry.shape = shape;
+        } else if (object_shape.is_prototype_shape() && object_shape.prototype_chain_validity()->is_valid()) {
+            auto& entry = get_cache_slot(cache);
+            entry.shape = shape;
+            entry.prototype = *object;
+            entry.prototype_chain_validity = *object_shape.prototype_chain_validity();
+        }
+        break;
+    }
+
+    return true;
+}
+
+// 13.10.2 InstanceofOperator ( V, target ), https://tc39.es/ecma262/#sec-instanceofoperator
+inline ThrowCompletionOr<Value> instance_of(VM& vm, Value value, Value target, PropertyLookupCache& cache)
+{
+    // 1. If target is not an Object, throw a TypeError exception.
+    if (!target.is_object())
+        return instance_of(vm, value, target);
+
+    auto& target_object = target.as_object();
+    auto& shape = target_object.shape();
+
+    // OPTIMIZATION: Almost every target inherits @@hasInstance from Function.prototype, where it can be neither changed
+    //               nor removed, and all it does there is OrdinaryHasInstance. Once we've seen where the lookup finds it
+    //               for this shape, we can go straight to OrdinaryHasInstance instead of looking it up and calling it.
+    for (auto& cache_entry : cache.entries) {
+        if (cache_entry_has_property(cache_entry, shape))
+            return ordinary_has_instance(vm, value, target);
+    }
+
+    // 2. Let instOfHandler be ? GetMethod(target, @@hasInstance).
+    CacheablePropertyMetadata cacheable_metadata;
+    auto instance_of_handler = TRY(target_object.internal_get(vm.well_known_symbol_has_instance(), target, &cacheable_metadata));
+
+    if (&shape == &target_object.shape()
+        && cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain
+        && is<FunctionPrototype>(*cacheable_metadata.prototype)) {
+        auto& entry = get_cache_slot(cache);
+        entry.shape = shape;
+        entry.property_offset = cacheable_metadata.property_offset.value();
+        entry.prototype = *cacheable_metadata.prototype;
+        entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+    }
+
+    // 3. If instOfHandler is not undefined, then
+    if (!instance_of_handler.is_nullish()) {
+        if (!instance_of_handler.is_function())
+            return vm.throw_completion<TypeError>(ErrorType::NotAFunction, instance_of_handler.to_string_without_side_effects());
+
+        // a. Return ToBoolean(? Call(instOfHandler, target, « V »)).
+        return Value(TRY(call(vm, instance_of_handler.as_function(), target, value)).to_boolean());
+    }
+
+    // 4. If IsCallable(target) is false, throw a TypeError exception.
+    if (!target.is_function())
+        return vm.throw_completion<TypeError>(ErrorType::NotAFunction, target.to_string_without_side_effects());
+
+    // 5. Return ? OrdinaryHasInstance(target, V).
+    return ordinary_has_instance(vm, value, target);
+}
+
 inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableIndex> base_identifier, Value base_value, Value property_key_value, Executable const& executable)
 {
     // OPTIMIZATION: Fast path for simple Int32 indexes in array-like objects.
@@ -1162,6 +1326,9 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
 
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
+    if (auto* profiler = interpreter.instruction_profiler()) [[unlikely]]
+        profiler->did_miss_inline_cache();
+
     auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
 
     if (auto* module = vm.running_execution_context().script_or_module.get_pointer<GC::Ref<Module>>()) {
@@ -1234,35 +1401,54 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
     }
     case Op::PropertyKind::KeyValue: {
         auto& shape = object->shape();
+
+        // Returns true if the cache entry applied and the store has been performed.
+        auto try_put_with_cache_entry = [&](PropertyLookupCache::Entry const& cache) -> ThrowCompletionOr<bool> {
+            if (cache.shape != &shape)
+                return false;
+            if (cache.prototype) {
+                // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+                if (!cache.prototype_chain_validity || !cache.prototype_chain_validity->is_valid())
+                    return false;
+                auto value_in_prototype = cache.prototype->get_direct(cache.property_offset.value());
+                if (!value_in_prototype.is_accessor())
+                    return false;
+                TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
+                return true;
+            }
+            auto value_in_object = object->get_direct(cache.property_offset.value());
+            if (value_in_object.is_accessor()) {
+                TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
+            } else {
+                object->put_direct(*cache.property_offset, value);
+            }
+            return true;
+        };
+
+        MegamorphicPropertyLookupCache::Entry* megamorphic_entry = nullptr;
         if (caches) {
             for (auto& cache : caches->entries) {
-                if (cache.prototype) {
-                    // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-                    bool can_use_cache = [&]() -> bool {
-                        if (&object->shape() != cache.shape)
-                            return false;
-                        if (!cache.prototype_chain_validity)
-                            return false;
-                        if (!cache.prototype_chain_validity->is_valid())
-                            return false;
-                        return true;
-                    }();
-                    if (can_use_cache) {
-                        auto value_in_prototype = cache.prototype->get_direct(cache.property_offset.value());
-                        if (value_in_prototype.is_accessor()) {
-                            TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
-                            return {};
-                        }
-                    }
-                } else if (cache.shape == &object->shape()) {
-                    auto value_in_object = object->get_direct(cache.property_offset.value());
-                    if (value_in_object.is_accessor()) {
-                        TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
-                    } else {
-                        object->put_direct(*cache.property_offset, value);
-                    }
+                if (TRY(try_put_with_cache_entry(cache)))
+                    return {};
+            }
+
+            auto* profiler = vm.bytecode_interpreter().instruction_profiler();
+            auto& megamorphic_cache = MegamorphicPropertyLookupCache::the();
+            ++megamorphic_cache.statistics().inline_cache_misses;
+            if (profiler) [[unlikely]]
+                profiler->did_miss_inline_cache();
+
+            if (caches->is_megamorphic && name.is_string()) {
+                megamorphic_entry = &megamorphic_cache.entry_for(shape, name.as_string());
+                if (megamorphic_entry->property_name == name.as_string() && TRY(try_put_with_cache_entry(megamorphic_entry->cache_entry))) {
+                    ++megamorphic_cache.statistics().hits;
+                    if (profiler) [[unlikely]]
+                        profiler->did_hit_megamorphic_cache();
                     return {};
                 }
+                ++megamorphic_cache.statistics().misses;
+                if (profiler) [[unlikely]]
+                    profiler->did_miss_megamorphic_cache();
             }
         }
 
@@ -1273,22 +1459,22 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         // that collected metadata is valid, e.g. if setter in prototype chain added
         // property with the same name into the object itself.
         if (succeeded && caches && &shape == &object->shape()) {
-            auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
-                for (size_t i = caches->entries.size() - 1; i >= 1; --i) {
-                    caches->entries[i] = caches->entries[i - 1];
+            auto fill_cache_entry = [&](PropertyLookupCache::Entry& cache) {
+                if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+                    cache.shape = object->shape();
+                    cache.property_offset = cacheable_metadata.property_offset.value();
+                } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
+                    cache.shape = object->shape();
+                    cache.property_offset = cacheable_metadata.property_offset.value();
+                    cache.prototype = *cacheable_metadata.prototype;
+                    cache.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
                 }
-                caches->entries[0] = {};
-                return caches->entries[0];
             };
-            auto& cache = get_cache_slot();
-            if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-                cache.shape = object->shape();
-                cache.property_offset = cacheable_metadata.property_offset.value();
-            } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
-                cache.shape = object->shape();
-                cache.property_offset = cacheable_metadata.property_offset.value();
-                cache.prototype = *cacheable_metadata.prototype;
-                cache.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+            fill_cache_entry(get_cache_slot(*caches));
+            if (megamorphic_entry && cacheable_metadata.type != CacheablePropertyMetadata::Type::NotCacheable) {
+                megamorphic_entry->property_name = name.as_string();
+                megamorphic_entry->cache_entry = {};
+                fill_cache_entry(megamorphic_entry->cache_entry);
             }
         }
 
@@ -1427,6 +1613,15 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<FlyStri
                     case TypedArrayBase::Kind::Uint8ClampedArray:
                         fast_typed_array_set_element<u8>(typed_array, index, clamp(value.as_i32(), 0, 255));
                         return {};
+                    case TypedArrayBase::Kind::Float16Array:
+                        fast_typed_array_set_element<f16>(typed_array, index, static_cast<f16>(value.as_i32()));
+                        return {};
+                    case TypedArrayBase::Kind::Float32Array:
+                        fast_typed_array_set_element<float>(typed_array, index, static_cast<float>(value.as_i32()));
+                        return {};
+                    case TypedArrayBase::Kind::Float64Array:
+                        fast_typed_array_set_element<double>(typed_array, index, static_cast<double>(value.as_i32()));
+                        return {};
                     default:
                         break;
                     }
@@ -1459,6 +1654,9 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<FlyStri
                     case TypedArrayBase::Kind::Uint32Array:
                         fast_typed_array_set_element<u32>(typed_array, index, MUST(value.to_u32(vm)));
                         return {};
+                    case TypedArrayBase::Kind::Uint8ClampedArray:
+                        fast_typed_array_set_element<u8>(typed_array, index, MUST(value.to_u8_clamp(vm)));
+                        return {};
                     default:
                         break;
                     }
@@ -1905,6 +2103,21 @@ inline ThrowCompletionOr<Value> get_object_property_iterator(Interpreter& interp
     return vm.heap().allocate<IteratorRecord>(iterator, js_undefined(), false);
 }
 
+StringView Instruction::type_name(Type type)
+{
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return #op##sv;
+
+    switch (type) {
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+#undef __BYTECODE_OP
+}
+
 ByteString Instruction::to_byte_string(Bytecode::Executable const& executable) const
 {
 #define __BYTECODE_OP(op)       \
@@ -2672,6 +2885,30 @@ ThrowCompletionOr<void> GetPrivateById::execute_impl(Bytecode::Interpreter& inte
     return {};
 }
 
+ThrowCompletionOr<void> HasById::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+
+    auto base = interpreter.get(m_base);
+    if (!base.is_object())
+        return vm.throw_completion<TypeError>(ErrorType::InOperatorWithObject);
+
+    auto& cache = interpreter.current_executable().property_lookup_caches[m_cache_index];
+    auto const& property_name = interpreter.current_executable().get_identifier(m_property);
+    interpreter.set(dst(), Value(TRY(has_by_id(base.as_object(), property_name, cache))));
+    return {};
+}
+
+ThrowCompletionOr<void> InstanceOf::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto lhs = interpreter.get(m_lhs);
+    auto rhs = interpreter.get(m_rhs);
+    auto& cache = interpreter.current_executable().property_lookup_caches[m_cache_index];
+    interpreter.set(m_dst, TRY(instance_of(vm, lhs, rhs, cache)));
+    return {};
+}
+
 ThrowCompletionOr<void> HasPrivateId::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -2687,6 +2924,35 @@ ThrowCompletionOr<void> HasPrivateId::execute_impl(Bytecode::Interpreter& interp
     return {};
 }
 
+void PutObjectLiteralProperties::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& object = interpreter.get(m_object).as_object();
+    auto& cache = interpreter.current_executable().object_literal_shape_caches[m_cache_index];
+    auto properties = this->properties();
+
+    // OPTIMIZATION: If this literal has already produced an object starting from the same shape, we know which shape
+    //               it ends up with, and that the properties are laid out in order. So we can switch to that shape
+    //               directly and fill in the property storage in one pass, skipping all the transitions.
+    if (cache.shape && cache.initial_shape.ptr() == &object.shape()) {
+        object.unsafe_set_shape(*cache.shape);
+        for (size_t i = 0; i < properties.size(); ++i)
+            object.put_direct(i, interpreter.get(properties[i].value));
+        return;
+    }
+
+    auto& initial_shape = object.shape();
+    for (auto const& property : properties) {
+        auto const& name = interpreter.current_executable().get_identifier(property.name);
+        object.define_direct_property(name, interpreter.get(property.value), default_attributes);
+    }
+
+    auto& final_shape = object.shape();
+    if (initial_shape.property_count() == 0 && !initial_shape.is_dictionary() && !final_shape.is_dictionary() && final_shape.property_count() == properties.size()) {
+        cache.initial_shape = initial_shape;
+        cache.shape = final_shape;
+    }
+}
+
 ThrowCompletionOr<void> PutBySpread::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -2797,7 +3063,9 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+// Returns nothing if the builtin has to be called normally after all, e.g. because it's called on a kind of this value that
+// doesn't have a fast path.
+static ThrowCompletionOr<Optional<Value>> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -2826,11 +3094,42 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
         return TRY(MathObject::cos_impl(interpreter.vm(), interpreter.get(arguments[0])));
     case Builtin::MathTan:
         return TRY(MathObject::tan_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::StringPrototypeCharAt: {
+        auto position = interpreter.get(arguments[0]);
+        if (!this_value.is_string() || !position.is_int32())
+            return Optional<Value> {};
+        auto index = position.as_i32();
+        auto const& string = this_value.as_string();
+        if (index < 0 || static_cast<size_t>(index) >= string.length_in_utf16_code_units())
+            return Value(&interpreter.vm().empty_string());
+        auto code_unit = string.utf16_string_view().code_unit_at(index);
+        if (is_ascii(code_unit))
+            return Value(&interpreter.vm().single_ascii_character_string(static_cast<u8>(code_unit)));
+        return PrimitiveString::create(interpreter.vm(), string.utf16_string_view().substring_view(index, 1));
+    }
+    case Builtin::StringPrototypeCharCodeAt: {
+        auto position = interpreter.get(arguments[0]);
+        if (!this_value.is_string() || !position.is_int32())
+            return Optional<Value> {};
+        auto index = position.as_i32();
+        auto const& string = this_value.as_string();
+        if (index < 0 || static_cast<size_t>(index) >= string.length_in_utf16_code_units())
+            return js_nan();
+        return Value(string.utf16_string_view().code_unit_at(index));
+    }
+    case Builtin::ArrayPrototypePush: {
+        if (!this_value.is_object() || !is<Array>(this_value.as_object()))
+            return Optional<Value> {};
+        auto& array = static_cast<Array&>(this_value.as_object());
+        if (!array.try_push_without_side_effects(interpreter.get(arguments[0])))
+            return Optional<Value> {};
+        return Value(array.indexed_properties().array_like_size());
+    }
     case Builtin::ArrayIteratorPrototypeNext:
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
-        VERIFY_NOT_REACHED();
+        return Optional<Value> {};
     case Bytecode::Builtin::__Count:
         VERIFY_NOT_REACHED();
     }
@@ -2901,9 +3200,10 @@ ThrowCompletionOr<void> CallBuiltin::execute_impl(Bytecode::Interpreter& interpr
     TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string()));
 
     if (m_argument_count == Bytecode::builtin_argument_count(m_builtin) && callee.is_object() && interpreter.realm().get_builtin_value(m_builtin) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, { m_arguments, m_argument_count })));
-
-        return {};
+        if (auto result = TRY(dispatch_builtin_call(interpreter, m_builtin, interpreter.get(m_this_value), { m_arguments, m_argument_count })); result.has_value()) {
+            interpreter.set(dst(), result.release_value());
+            return {};
+        }
     }
 
     auto argument_values = interpreter.allocate_argument_values(m_argument_count);
@@ -3502,6 +3802,15 @@ ByteString PutBySpread::to_byte_string_impl(Bytecode::Executable const& executab
         format_operand("src"sv, m_src, executable));
 }
 
+ByteString PutObjectLiteralProperties::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    StringBuilder builder;
+    builder.appendff("PutObjectLiteralProperties {}", format_operand("object"sv, m_object, executable));
+    for (auto const& property : properties())
+        builder.appendff(", {}:{}", executable.identifier_table->get(property.name), format_operand("value"sv, property.value, executable));
+    return builder.to_byte_string();
+}
+
 ByteString PutById::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     auto kind = property_kind_to_string(m_kind);
@@ -3574,6 +3883,22 @@ ByteString GetPrivateById::to_byte_string_impl(Bytecode::Executable const& execu
         executable.identifier_table->get(m_property));
 }
 
+ByteString HasById::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("HasById {}, {}, {}",
+        format_operand("dst"sv, m_dst, executable),
+        format_operand("base"sv, m_base, executable),
+        executable.identifier_table->get(m_property));
+}
+
+ByteString InstanceOf::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("InstanceOf {}, {}, {}",
+        format_operand("dst"sv, m_dst, executable),
+        format_operand("lhs"sv, m_lhs, executable),
+        format_operand("rhs"sv, m_rhs, executable));
+}
+
 ByteString HasPrivateId::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     return ByteString::formatted("HasPrivateId {}, {}, {}",
@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/InstructionProfiler.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -85,6 +89,19 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    void start_sampling_profiler(AK::Duration interval) { m_sampling_profiler = make<SamplingProfiler>(interval); }
+    OwnPtr<SamplingProfiler> stop_sampling_profiler() { return move(m_sampling_profiler); }
+
+    // Counts how many times each type of instruction is run, indexed by Instruction::Type. This slows down the
+    // interpreter quite a bit, so it's only meant for benchmarking.
+    using InstructionCounts = AK::Array<u64, Instruction::number_of_types>;
+    void start_counting_instructions() { m_instruction_counts = make<InstructionCounts>(); }
+    OwnPtr<InstructionCounts> stop_counting_instructions() { return move(m_instruction_counts); }
+
+    void start_instruction_profiler() { m_instruction_profiler = make<InstructionProfiler>(m_vm.heap()); }
+    OwnPtr<InstructionProfiler> stop_instruction_profiler() { return move(m_instruction_profiler); }
+    InstructionProfiler* instruction_profiler() { return m_instruction_profiler.ptr(); }
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -103,6 +120,9 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    OwnPtr<InstructionCounts> m_instruction_counts;
+    OwnPtr<InstructionProfiler> m_instruction_profiler;
 };
 
 JS_API extern bool g_dump_bytecode;
@@ -128,7 +128,6 @@ private:
     O(Exp, exp)                                             \
     O(Mod, mod)                                             \
     O(In, in)                                               \
-    O(InstanceOf, instance_of)                              \
     O(LooselyInequals, loosely_inequals)                    \
     O(LooselyEquals, loosely_equals)                        \
     O(StrictlyInequals, strict_inequals)                    \
@@ -1152,6 +1151,37 @@ private:
     IdentifierTableIndex m_property;
 };
 
+class HasById final : public Instruction {
+public:
+    HasById(Operand dst, Operand base, IdentifierTableIndex property, u32 cache_index)
+        : Instruction(Type::HasById)
+        , m_dst(dst)
+        , m_base(base)
+        , m_property(property)
+        , m_cache_index(cache_index)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_dst);
+        visitor(m_base);
+    }
+
+    Operand dst() const { return m_dst; }
+    Operand base() const { return m_base; }
+    IdentifierTableIndex property() const { return m_property; }
+    u32 cache_index() const { return m_cache_index; }
+
+private:
+    Operand m_dst;
+    Operand m_base;
+    IdentifierTableIndex m_property;
+    u32 m_cache_index { 0 };
+};
+
 class HasPrivateId final : public Instruction {
 public:
     HasPrivateId(Operand dst, Operand base, IdentifierTableIndex property)
@@ -1180,6 +1210,38 @@ private:
     IdentifierTableIndex m_property;
 };
 
+class InstanceOf final : public Instruction {
+public:
+    InstanceOf(Operand dst, Operand lhs, Operand rhs, u32 cache_index)
+        : Instruction(Type::InstanceOf)
+        , m_dst(dst)
+        , m_lhs(lhs)
+        , m_rhs(rhs)
+        , m_cache_index(cache_index)
+    {
+    }
+
+    ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_dst);
+        visitor(m_lhs);
+        visitor(m_rhs);
+    }
+
+    Operand dst() const { return m_dst; }
+    Operand lhs() const { return m_lhs; }
+    Operand rhs() const { return m_rhs; }
+    u32 cache_index() const { return m_cache_index; }
+
+private:
+    Operand m_dst;
+    Operand m_lhs;
+    Operand m_rhs;
+    u32 m_cache_index { 0 };
+};
+
 enum class PropertyKind {
     Getter,
     Setter,
@@ -1213,6 +1275,53 @@ private:
     Operand m_src;
 };
 
+// Defines the own properties of a freshly created object literal in one go.
+// NOTE: The property names are all distinct, and none of them are array indices.
+class PutObjectLiteralProperties final : public Instruction {
+public:
+    static constexpr bool IsVariableLength = true;
+
+    struct Property {
+        IdentifierTableIndex name;
+        Operand value;
+    };
+
+    PutObjectLiteralProperties(Operand object, u32 cache_index, ReadonlySpan<Property> properties)
+        : Instruction(Type::PutObjectLiteralProperties)
+        , m_object(object)
+        , m_cache_index(cache_index)
+        , m_property_count(properties.size())
+    {
+        for (size_t i = 0; i < m_property_count; ++i)
+            m_properties[i] = properties[i];
+    }
+
+    void execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_object);
+        for (size_t i = 0; i < m_property_count; ++i)
+            visitor(m_properties[i].value);
+    }
+
+    size_t length() const { return length_impl(); }
+    size_t length_impl() const
+    {
+        return round_up_to_power_of_two(alignof(void*), sizeof(*this) + sizeof(Property) * m_property_count);
+    }
+
+    Operand object() const { return m_object; }
+    u32 cache_index() const { return m_cache_index; }
+    ReadonlySpan<Property> properties() const { return { m_properties, m_property_count }; }
+
+private:
+    Operand m_object;
+    u32 m_cache_index { 0 };
+    u32 m_property_count { 0 };
+    Property m_properties[];
+};
+
 class PutById final : public Instruction {
 public:
     explicit PutById(Operand base, IdentifierTableIndex property, Operand src, PropertyKind kind, u32 cache_index, Optional<IdentifierTableIndex> base_identifier = {})
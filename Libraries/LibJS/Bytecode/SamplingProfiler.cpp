@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/SourceRange.h>
+
+namespace JS::Bytecode {
+
+SamplingProfiler::SamplingProfiler(AK::Duration interval)
+    : m_interval(interval)
+    , m_next_sample_time(MonotonicTime::now() + interval)
+{
+}
+
+static void append_frame(StringBuilder& builder, ExecutionContext const& context)
+{
+    auto function_name = context.function_name ? context.function_name->utf8_string_view() : ""sv;
+
+    if (!context.executable) {
+        builder.append(function_name.is_empty() ? "(native)"sv : function_name);
+        return;
+    }
+
+    builder.append(function_name.is_empty() ? "(anonymous)"sv : function_name);
+
+    auto unrealized_source_range = context.executable->source_range_at(context.program_counter);
+    if (!unrealized_source_range.source_code)
+        return;
+    auto source_range = unrealized_source_range.realize();
+    builder.appendff(" ({}:{})", source_range.filename(), source_range.start.line);
+}
+
+String SamplingProfiler::current_stack(VM const& vm)
+{
+    auto const& execution_context_stack = vm.execution_context_stack();
+
+    StringBuilder builder;
+    for (size_t i = 0; i < execution_context_stack.size(); ++i) {
+        if (i != 0)
+            builder.append(';');
+        append_frame(builder, *execution_context_stack[i]);
+    }
+
+    // NOTE: The folded stacks format has no way of escaping anything, so a newline in a function name would start a new
+    //       line in the output. Semicolons in one just make it show up as more than one frame, which is harmless.
+    return MUST(MUST(builder.to_string()).replace("\n"sv, " "sv, ReplaceMode::All));
+}
+
+void SamplingProfiler::take_sample_if_due(VM& vm)
+{
+    auto now = MonotonicTime::now();
+    if (now < m_next_sample_time)
+        return;
+    m_next_sample_time = now + m_interval;
+
+    if (vm.execution_context_stack().is_empty())
+        return;
+
+    m_stack_counts.ensure(current_stack(vm), [] { return 0; })++;
+    ++m_sample_count;
+}
+
+String SamplingProfiler::folded_stacks() const
+{
+    struct StackAndCount {
+        StringView stack;
+        size_t count { 0 };
+    };
+    Vector<StackAndCount> stacks;
+    stacks.ensure_capacity(m_stack_counts.size());
+    for (auto const& [stack, count] : m_stack_counts)
+        stacks.unchecked_append({ stack, count });
+
+    quick_sort(stacks, [](auto const& a, auto const& b) { return a.count > b.count; });
+
+    StringBuilder builder;
+    for (auto const& [stack, count] : stacks)
+        builder.appendff("{} {}\n", stack, count);
+    return MUST(builder.to_string());
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// Samples the JavaScript call stack about once per interval, and counts how often each stack was seen.
+//
+// Samples are only taken at safepoints in the interpreter (jumps and entering an executable), rather than from a signal
+// handler or another thread, as nothing else can safely look at the execution context stack while it's running. Time
+// spent in native code is therefore attributed to the stack it was called from once it returns. Each sample is turned
+// into source locations right away, so the profile never has to keep any executable alive.
+class JS_API SamplingProfiler {
+public:
+    explicit SamplingProfiler(AK::Duration interval);
+
+    ALWAYS_INLINE void did_reach_safepoint(VM& vm)
+    {
+        if (--m_safepoints_until_clock_check != 0) [[likely]]
+            return;
+        m_safepoints_until_clock_check = safepoints_between_clock_checks;
+        take_sample_if_due(vm);
+    }
+
+    size_t sample_count() const { return m_sample_count; }
+
+    // Returns the samples in the "folded stacks" format taken by flamegraph.pl, speedscope and similar tools: one line
+    // per distinct stack, with the frames from the outermost one inwards separated by semicolons, followed by a space
+    // and the number of samples of that stack.
+    String folded_stacks() const;
+
+    // Returns the JavaScript call stack in the same format as a stack in folded_stacks().
+    static String current_stack(VM const&);
+
+private:
+    // NOTE: Looking at the clock takes about as long as running several simple instructions does, so it's not done at
+    //       every safepoint.
+    static constexpr u32 safepoints_between_clock_checks = 64;
+
+    void take_sample_if_due(VM&);
+
+    AK::Duration m_interval;
+    MonotonicTime m_next_sample_time;
+    u32 m_safepoints_until_clock_check { safepoints_between_clock_checks };
+    size_t m_sample_count { 0 };
+    HashMap<String, size_t> m_stack_counts;
+};
+
+}
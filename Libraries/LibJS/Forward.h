@@ -164,6 +164,7 @@ class Cell;
 class ClassExpression;
 struct ClassFieldDefinition;
 class Completion;
+class CompletionCell;
 class Console;
 class CyclicModule;
 class DeclarativeEnvironment;
@@ -285,6 +286,9 @@ class SegmentsPrototype;
 
 struct ResolutionOptionDescriptor;
 
+enum class OptionDefaults;
+enum class OptionRequired;
+
 };
 
 namespace Temporal {
@@ -9,14 +9,128 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
-#include <AK/HashMap.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <stdio.h>
 
 namespace JS {
 
-HashMap<FlyString, TokenType> Lexer::s_keywords;
+struct Keyword {
+    StringView name;
+    TokenType type { TokenType::Invalid };
+};
+
+static constexpr Array keywords {
+    Keyword { "async"sv, TokenType::Async },
+    Keyword { "await"sv, TokenType::Await },
+    Keyword { "break"sv, TokenType::Break },
+    Keyword { "case"sv, TokenType::Case },
+    Keyword { "catch"sv, TokenType::Catch },
+    Keyword { "class"sv, TokenType::Class },
+    Keyword { "const"sv, TokenType::Const },
+    Keyword { "continue"sv, TokenType::Continue },
+    Keyword { "debugger"sv, TokenType::Debugger },
+    Keyword { "default"sv, TokenType::Default },
+    Keyword { "delete"sv, TokenType::Delete },
+    Keyword { "do"sv, TokenType::Do },
+    Keyword { "else"sv, TokenType::Else },
+    Keyword { "enum"sv, TokenType::Enum },
+    Keyword { "export"sv, TokenType::Export },
+    Keyword { "extends"sv, TokenType::Extends },
+    Keyword { "false"sv, TokenType::BoolLiteral },
+    Keyword { "finally"sv, TokenType::Finally },
+    Keyword { "for"sv, TokenType::For },
+    Keyword { "function"sv, TokenType::Function },
+    Keyword { "if"sv, TokenType::If },
+    Keyword { "import"sv, TokenType::Import },
+    Keyword { "in"sv, TokenType::In },
+    Keyword { "instanceof"sv, TokenType::Instanceof },
+    Keyword { "let"sv, TokenType::Let },
+    Keyword { "new"sv, TokenType::New },
+    Keyword { "null"sv, TokenType::NullLiteral },
+    Keyword { "return"sv, TokenType::Return },
+    Keyword { "super"sv, TokenType::Super },
+    Keyword { "switch"sv, TokenType::Switch },
+    Keyword { "this"sv, TokenType::This },
+    Keyword { "throw"sv, TokenType::Throw },
+    Keyword { "true"sv, TokenType::BoolLiteral },
+    Keyword { "try"sv, TokenType::Try },
+    Keyword { "typeof"sv, TokenType::Typeof },
+    Keyword { "var"sv, TokenType::Var },
+    Keyword { "void"sv, TokenType::Void },
+    Keyword { "while"sv, TokenType::While },
+    Keyword { "with"sv, TokenType::With },
+    Keyword { "yield"sv, TokenType::Yield },
+};
+
+static constexpr size_t keyword_table_size = 128;
+
+// NOTE: The constants were picked so that no two keywords hash to the same slot, the table below doesn't compile if
+//       they do. Every keyword is at least two characters long.
+static constexpr size_t keyword_hash(StringView identifier)
+{
+    return (identifier.length() + static_cast<u8>(identifier[0]) + 23 * static_cast<u8>(identifier[1])) % keyword_table_size;
+}
+
+static constexpr auto keyword_table = [] {
+    Array<Keyword, keyword_table_size> table {};
+    for (auto const& keyword : keywords) {
+        auto& slot = table[keyword_hash(keyword.name)];
+        VERIFY(slot.name.is_empty());
+        slot = keyword;
+    }
+    return table;
+}();
+
+static constexpr Optional<TokenType> keyword_token_type(StringView identifier)
+{
+    if (identifier.length() < 2)
+        return {};
+    auto const& keyword = keyword_table[keyword_hash(identifier)];
+    if (keyword.name != identifier)
+        return {};
+    return keyword.type;
+}
+
+static constexpr auto make_ascii_identifier_part_table()
+{
+    Array<bool, 128> table {};
+    for (u8 code_point = 0; code_point < 128; ++code_point)
+        table[code_point] = is_ascii_alphanumeric(code_point) || code_point == '_' || code_point == '$';
+    return table;
+}
+
+static constexpr auto s_ascii_identifier_part_table = make_ascii_identifier_part_table();
+
+static ALWAYS_INLINE bool is_ascii_identifier_part(char code_unit)
+{
+    return is_ascii(code_unit) && s_ascii_identifier_part_table[static_cast<u8>(code_unit)];
+}
+
+// Returns the length of the run of ASCII characters other than line terminators that starts at the given offset.
+static size_t length_of_ascii_run_without_line_terminators(StringView source, size_t offset)
+{
+    auto bytes = source.bytes();
+    auto index = offset;
+
+    // OPTIMIZATION: Look at sixteen bytes at a time until one of them is a line terminator or not ASCII.
+    using AK::SIMD::u8x16;
+    auto non_ascii_bytes = u8x16 {} + static_cast<u8>(0x80);
+    auto line_feeds = u8x16 {} + static_cast<u8>('\n');
+    auto carriage_returns = u8x16 {} + static_cast<u8>('\r');
+    for (; index + 16 <= bytes.size(); index += 16) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(bytes.data() + index);
+        auto matches = bit_cast<AK::SIMD::u64x2>((chunk >= non_ascii_bytes) | (chunk == line_feeds) | (chunk == carriage_returns));
+        if ((matches[0] | matches[1]) != 0)
+            break;
+    }
+
+    while (index < bytes.size() && is_ascii(bytes[index]) && bytes[index] != '\n' && bytes[index] != '\r')
+        ++index;
+    return index - offset;
+}
 
 static constexpr TokenType parse_two_char_token(StringView view)
 {
@@ -230,49 +344,6 @@ Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t
     , m_line_column(line_column)
     , m_parsed_identifiers(adopt_ref(*new ParsedIdentifiers))
 {
-    if (s_keywords.is_empty()) {
-        s_keywords.set("async"_fly_string, TokenType::Async);
-        s_keywords.set("await"_fly_string, TokenType::Await);
-        s_keywords.set("break"_fly_string, TokenType::Break);
-        s_keywords.set("case"_fly_string, TokenType::Case);
-        s_keywords.set("catch"_fly_string, TokenType::Catch);
-        s_keywords.set("class"_fly_string, TokenType::Class);
-        s_keywords.set("const"_fly_string, TokenType::Const);
-        s_keywords.set("continue"_fly_string, TokenType::Continue);
-        s_keywords.set("debugger"_fly_string, TokenType::Debugger);
-        s_keywords.set("default"_fly_string, TokenType::Default);
-        s_keywords.set("delete"_fly_string, TokenType::Delete);
-        s_keywords.set("do"_fly_string, TokenType::Do);
-        s_keywords.set("else"_fly_string, TokenType::Else);
-        s_keywords.set("enum"_fly_string, TokenType::Enum);
-        s_keywords.set("export"_fly_string, TokenType::Export);
-        s_keywords.set("extends"_fly_string, TokenType::Extends);
-        s_keywords.set("false"_fly_string, TokenType::BoolLiteral);
-        s_keywords.set("finally"_fly_string, TokenType::Finally);
-        s_keywords.set("for"_fly_string, TokenType::For);
-        s_keywords.set("function"_fly_string, TokenType::Function);
-        s_keywords.set("if"_fly_string, TokenType::If);
-        s_keywords.set("import"_fly_string, TokenType::Import);
-        s_keywords.set("in"_fly_string, TokenType::In);
-        s_keywords.set("instanceof"_fly_string, TokenType::Instanceof);
-        s_keywords.set("let"_fly_string, TokenType::Let);
-        s_keywords.set("new"_fly_string, TokenType::New);
-        s_keywords.set("null"_fly_string, TokenType::NullLiteral);
-        s_keywords.set("return"_fly_string, TokenType::Return);
-        s_keywords.set("super"_fly_string, TokenType::Super);
-        s_keywords.set("switch"_fly_string, TokenType::Switch);
-        s_keywords.set("this"_fly_string, TokenType::This);
-        s_keywords.set("throw"_fly_string, TokenType::Throw);
-        s_keywords.set("true"_fly_string, TokenType::BoolLiteral);
-        s_keywords.set("try"_fly_string, TokenType::Try);
-        s_keywords.set("typeof"_fly_string, TokenType::Typeof);
-        s_keywords.set("var"_fly_string, TokenType::Var);
-        s_keywords.set("void"_fly_string, TokenType::Void);
-        s_keywords.set("while"_fly_string, TokenType::While);
-        s_keywords.set("with"_fly_string, TokenType::With);
-        s_keywords.set("yield"_fly_string, TokenType::Yield);
-    }
-
     consume();
 }
 
@@ -366,6 +437,16 @@ void Lexer::consume()
     m_current_char = m_source[m_position++];
 }
 
+// Consumes the current character and the ones following it, all of which must be ASCII and not line terminators.
+void Lexer::consume_ascii_run(size_t length)
+{
+    VERIFY(length != 0);
+    m_position += length - 1;
+    m_line_column += length - 1;
+    m_current_char = m_source[m_position - 1];
+    consume();
+}
+
 bool Lexer::consume_decimal_number()
 {
     if (!is_ascii_digit(m_current_char))
@@ -667,6 +748,10 @@ Token Lexer::next()
                 consume();
                 do {
                     consume();
+
+                    // OPTIMIZATION: Skip past the ASCII parts of the comment in one go.
+                    if (auto length = length_of_ascii_run_without_line_terminators(m_source, m_position - 1); length != 0)
+                        consume_ascii_run(length);
                 } while (!is_eof() && !is_line_terminator());
             } else if (is_block_comment_start()) {
                 size_t start_line_number = m_line_number;
@@ -776,27 +861,49 @@ Token Lexer::next()
             token_message = "Start of private name '#' but not followed by valid identifier"sv;
         }
     } else if (auto code_point = is_identifier_start(identifier_length); code_point.has_value()) {
-        bool has_escaped_character = false;
         // identifier or keyword
-        StringBuilder builder;
-        do {
-            builder.append_code_point(*code_point);
-            for (size_t i = 0; i < identifier_length; ++i)
-                consume();
+        // OPTIMIZATION: Identifiers that are made up of nothing but ASCII characters, which is almost all of them, are
+        //               taken straight from the source instead of being decoded and encoded again.
+        auto identifier_start = m_position - 1;
+        size_t ascii_identifier_length = 0;
+        if (identifier_length == 1 && is_ascii(m_current_char)) {
+            ascii_identifier_length = 1;
+            while (identifier_start + ascii_identifier_length < m_source.length() && is_ascii_identifier_part(m_source[identifier_start + ascii_identifier_length]))
+                ++ascii_identifier_length;
+
+            // NOTE: If the identifier goes on with an escape sequence or a non-ASCII character, we have to take the slow path.
+            if (auto end = identifier_start + ascii_identifier_length; end < m_source.length() && (m_source[end] == '\\' || !is_ascii(m_source[end])))
+                ascii_identifier_length = 0;
+        }
+
+        if (ascii_identifier_length != 0) {
+            auto name = m_source.substring_view(identifier_start, ascii_identifier_length);
+            consume_ascii_run(ascii_identifier_length);
+
+            identifier = FlyString::from_utf8_without_validation(name.bytes());
+            token_type = keyword_token_type(name).value_or(TokenType::Identifier);
+        } else {
+            bool has_escaped_character = false;
+            StringBuilder builder;
+            do {
+                builder.append_code_point(*code_point);
+                for (size_t i = 0; i < identifier_length; ++i)
+                    consume();
 
-            has_escaped_character |= identifier_length > 1;
+                has_escaped_character |= identifier_length > 1;
 
-            code_point = is_identifier_middle(identifier_length);
-        } while (code_point.has_value());
+                code_point = is_identifier_middle(identifier_length);
+            } while (code_point.has_value());
 
-        identifier = builder.to_string_without_validation();
-        m_parsed_identifiers->identifiers.set(*identifier);
+            identifier = builder.to_string_without_validation();
 
-        auto it = s_keywords.find(identifier->hash(), [&](auto& entry) { return entry.key == identifier; });
-        if (it == s_keywords.end())
-            token_type = TokenType::Identifier;
-        else
-            token_type = has_escaped_character ? TokenType::EscapedKeyword : it->value;
+            if (auto keyword_type = keyword_token_type(identifier->bytes_as_string_view()); keyword_type.has_value())
+                token_type = has_escaped_character ? TokenType::EscapedKeyword : *keyword_type;
+            else
+                token_type = TokenType::Identifier;
+        }
+
+        m_parsed_identifiers->identifiers.set(*identifier);
     } else if (is_numeric_literal_start()) {
         token_type = TokenType::NumericLiteral;
         bool is_invalid_numeric_literal = false;
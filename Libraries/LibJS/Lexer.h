@@ -31,6 +31,7 @@ public:
 
 private:
     void consume();
+    void consume_ascii_run(size_t length);
     bool consume_exponent();
     bool consume_octal_number();
     bool consume_hexadecimal_number();
@@ -81,8 +82,6 @@ private:
 
     Optional<size_t> m_hit_invalid_unicode;
 
-    static HashMap<FlyString, TokenType> s_keywords;
-
     struct ParsedIdentifiers : public RefCounted<ParsedIdentifiers> {
         // Resolved identifiers must be kept alive for the duration of the parsing stage, otherwise
         // the only references to these strings are deleted by the Token destructor.
@@ -394,6 +394,10 @@ public:
             } else {
                 if (m_function_parameters || m_type == ScopeType::ClassField || m_type == ScopeType::ClassStaticInit) {
                     // NOTE: Class fields and class static initialization sections implicitly create functions
+                    // FIXME: This is true for every nested function, even one that only lives until the function creating
+                    //        it returns, e.g. an arrow function passed to forEach(). Telling those apart needs to know what
+                    //        the callee does with its argument, and even then the nested function runs in its own frame
+                    //        and can't get to our registers, so its bytecode would have to be inlined here first.
                     identifier_group.captured_by_nested_function = true;
                 }
 
@@ -1160,7 +1164,7 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
+    auto source_text = SourceCodeSlice { m_source_code, function_start_offset, function_end_offset };
     return create_ast_node<FunctionExpression>(
         { m_source_code, rule_start.position(), position() }, nullptr, move(source_text),
         move(body), move(parameters), function_length, function_kind, body->in_strict_mode(),
@@ -1662,7 +1666,7 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
             parsing_insights.uses_this_from_environment = true;
             parsing_insights.uses_this = true;
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, SourceCodeSlice {},
                 move(constructor_body), FunctionParameters::create(Vector { FunctionParameter { move(argument_name), nullptr, true } }), 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, parsing_insights, /* local_variables_names */ Vector<LocalVariable> {});
         } else {
@@ -1670,7 +1674,7 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
             parsing_insights.uses_this_from_environment = true;
             parsing_insights.uses_this = true;
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, SourceCodeSlice {},
                 move(constructor_body), FunctionParameters::empty(), 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, parsing_insights, /* local_variables_names */ Vector<LocalVariable> {});
         }
@@ -1689,7 +1693,7 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
+    auto source_text = SourceCodeSlice { m_source_code, function_start_offset, function_end_offset };
 
     return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), move(source_text), move(constructor), move(super_class), move(elements));
 }
@@ -3017,7 +3021,7 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length();
-    auto source_text = ByteString { m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset) };
+    auto source_text = SourceCodeSlice { m_source_code, function_start_offset, function_end_offset };
     parsing_insights.might_need_arguments_object = m_state.function_might_need_arguments_object;
     if (parse_options & FunctionNodeParseOptions::IsConstructor) {
         parsing_insights.uses_this = true;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NeverDestroyed.h>
+#include <LibJS/Lexer.h>
+#include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+ProgramCache& ProgramCache::the()
+{
+    static thread_local NeverDestroyed<ProgramCache> cache;
+    return *cache;
+}
+
+RefPtr<Program> ProgramCache::find(Program::Type type, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_source_length)
+        return nullptr;
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto& entry = m_entries[i];
+        if (entry.type != type || entry.line_number_offset != line_number_offset || entry.filename != filename)
+            continue;
+        if (entry.program->source_code().code() != source_text)
+            continue;
+
+        auto program = entry.program;
+        if (i != m_entries.size() - 1)
+            m_entries.append(m_entries.take(i));
+        return program;
+    }
+    return nullptr;
+}
+
+void ProgramCache::add(Program::Type type, StringView filename, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    auto source_length = program->source_code().code().bytes().size();
+    if (source_length < minimum_source_length || source_length > maximum_total_source_length)
+        return;
+
+    while (!m_entries.is_empty() && m_total_source_length + source_length > maximum_total_source_length) {
+        m_total_source_length -= m_entries.first().program->source_code().code().bytes().size();
+        m_entries.remove(0);
+    }
+
+    m_entries.append({
+        .type = type,
+        .filename = MUST(String::from_utf8(filename)),
+        .line_number_offset = line_number_offset,
+        .program = move(program),
+    });
+    m_total_source_length += source_length;
+}
+
+RefPtr<Program> ProgramCache::parse_on_any_thread(Program::Type type, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    auto parser = Parser(Lexer(source_text, filename, line_number_offset), type);
+    auto program = parser.parse_program();
+    if (parser.has_errors())
+        return nullptr;
+    return program;
+}
+
+void ProgramCache::clear()
+{
+    m_entries.clear();
+    m_total_source_length = 0;
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// Keeps the ASTs of recently parsed large scripts and modules around, so that parsing the exact same source
+// again (e.g. a framework bundle on every navigation) can skip the lexer and parser entirely.
+// NOTE: ASTs are not tied to a realm, and the per-function data hanging off them is already shared between
+//       all function objects created from the same node. They are not thread-safe though, so each thread
+//       has its own cache.
+class JS_API ProgramCache {
+public:
+    static ProgramCache& the();
+
+    RefPtr<Program> find(Program::Type, StringView source_text, StringView filename, size_t line_number_offset);
+    void add(Program::Type, StringView filename, size_t line_number_offset, NonnullRefPtr<Program>);
+
+    void clear();
+
+    // Parses a program the way ParseScript and ParseModule would, but without touching this (or any other per-thread)
+    // state, so that it can be done ahead of time on another thread. Adding the result to the cache of the thread that
+    // is going to create the script or module lets it skip parsing. The parsing thread must not keep any references to
+    // the program once it has been handed over. Returns null if there are errors, as those are reported when the
+    // script or module is created for real.
+    static RefPtr<Program> parse_on_any_thread(Program::Type, StringView source_text, StringView filename, size_t line_number_offset);
+
+    // Small scripts are cheap to parse, and not worth pushing a larger one out of the cache for.
+    static constexpr size_t minimum_source_length = 16 * KiB;
+    static constexpr size_t maximum_total_source_length = 64 * MiB;
+
+private:
+    struct Entry {
+        Program::Type type;
+        String filename;
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+    };
+
+    // Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    size_t m_total_source_length { 0 };
+};
+
+}
@@ -63,8 +63,8 @@ GC::Ref<Array> Array::create_from(Realm& realm, ReadonlySpan<Value> elements)
     return array;
 }
 
-Array::Array(Realm& realm, Object& prototype)
-    : Object(ConstructWithPrototypeTag::Tag, prototype)
+Array::Array(Realm& realm, Object& prototype, MayInterfereWithIndexedPropertyAccess may_interfere_with_indexed_property_access)
+    : Object(ConstructWithPrototypeTag::Tag, prototype, may_interfere_with_indexed_property_access)
     , m_realm(realm)
 {
     m_has_magical_length_property = true;
@@ -299,40 +299,57 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Array::internal_get_own_property
     return Object::internal_get_own_property(property_key);
 }
 
-ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* cacheable_metadata, PropertyLookupPhase phase)
+bool Array::has_default_prototype_chain() const
 {
-    auto& vm = this->vm();
+    auto const& intrinsics = m_realm->intrinsics();
+    auto* array_prototype = shape().prototype();
+    if (!array_prototype)
+        return false;
+    if (!array_prototype->indexed_properties().is_empty())
+        return false;
+    auto& array_prototype_shape = shape().prototype()->shape();
+    if (intrinsics.default_array_prototype_shape().ptr() != &array_prototype_shape)
+        return false;
 
-    auto default_prototype_chain_intact = [&] {
-        auto const& intrinsics = m_realm->intrinsics();
-        auto* array_prototype = shape().prototype();
-        if (!array_prototype)
-            return false;
-        if (!array_prototype->indexed_properties().is_empty())
-            return false;
-        auto& array_prototype_shape = shape().prototype()->shape();
-        if (intrinsics.default_array_prototype_shape().ptr() != &array_prototype_shape)
-            return false;
+    auto* object_prototype = array_prototype_shape.prototype();
+    if (!object_prototype)
+        return false;
+    if (!object_prototype->indexed_properties().is_empty())
+        return false;
+    auto& object_prototype_shape = array_prototype_shape.prototype()->shape();
+    if (intrinsics.default_object_prototype_shape().ptr() != &object_prototype_shape)
+        return false;
+    if (object_prototype_shape.prototype())
+        return false;
 
-        auto* object_prototype = array_prototype_shape.prototype();
-        if (!object_prototype)
-            return false;
-        if (!object_prototype->indexed_properties().is_empty())
-            return false;
-        auto& object_prototype_shape = array_prototype_shape.prototype()->shape();
-        if (intrinsics.default_object_prototype_shape().ptr() != &object_prototype_shape)
-            return false;
-        if (object_prototype_shape.prototype())
-            return false;
+    return true;
+}
 
-        return true;
-    };
+bool Array::try_push_without_side_effects(Value value)
+{
+    auto* storage = indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage() || may_interfere_with_indexed_property_access())
+        return false;
+    if (m_is_proxy_target || !m_is_extensible || !m_length_writable || !has_default_prototype_chain())
+        return false;
+
+    // NOTE: Past this, the new element would not have an array index anymore, so let the slow path deal with it.
+    if (indexed_properties().array_like_size() >= NumericLimits<u32>::max())
+        return false;
+
+    indexed_properties().append(value);
+    return true;
+}
+
+ThrowCompletionOr<bool> Array::internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* cacheable_metadata, PropertyLookupPhase phase)
+{
+    auto& vm = this->vm();
 
     VERIFY(receiver.is_object());
     auto& receiver_object = receiver.as_object();
 
     // Fast path for arrays with intact prototype chain
-    if (&receiver_object == this && !m_is_proxy_target && default_prototype_chain_intact()) {
+    if (&receiver_object == this && !m_is_proxy_target && has_default_prototype_chain()) {
         if (property_key.is_number()) {
             auto index = property_key.as_number();
             auto property_descriptor = TRY(internal_get_own_property(property_key));
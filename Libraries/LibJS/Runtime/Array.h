@@ -59,15 +59,21 @@ public:
 
     void set_is_proxy_target(bool is_proxy_target) { m_is_proxy_target = is_proxy_target; }
 
+    // OPTIMIZATION: Appends the value like Array.prototype.push would, if nothing could observe it being done directly,
+    //               i.e. the array is extensible, has a writable length, and only has the default prototypes above it.
+    //               Returns false, without doing anything, if it can't be done that way.
+    bool try_push_without_side_effects(Value);
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
 protected:
-    explicit Array(Realm& realm, Object& prototype);
+    explicit Array(Realm& realm, Object& prototype, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
 
 private:
     virtual bool is_array_exotic_object() const final { return true; }
 
     ThrowCompletionOr<bool> set_length(PropertyDescriptor const&);
+    bool has_default_prototype_chain() const;
 
     GC::Ref<Realm> m_realm;
     bool m_length_writable { true };
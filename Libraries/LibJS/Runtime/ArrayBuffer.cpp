@@ -266,6 +266,22 @@ ThrowCompletionOr<void> detach_array_buffer(VM& vm, ArrayBuffer& array_buffer, O
     return {};
 }
 
+// NOTE: This is DetachArrayBuffer, except that the data the buffer had is handed to the caller rather than thrown away. It
+//       lets operations that detach a buffer to hand its data to a new one, like TransferArrayBuffer in the Streams spec,
+//       do so without copying the data.
+ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data(VM& vm, ArrayBuffer& array_buffer, Optional<Value> key)
+{
+    VERIFY(!array_buffer.is_shared_array_buffer());
+
+    if (!key.has_value())
+        key = js_undefined();
+
+    if (!same_value(array_buffer.detach_key(), *key))
+        return vm.throw_completion<TypeError>(ErrorType::DetachKeyMismatch, *key, array_buffer.detach_key());
+
+    return array_buffer.detach_and_take_buffer();
+}
+
 // 25.1.3.6 CloneArrayBuffer ( srcBuffer, srcByteOffset, srcLength, cloneConstructor ), https://tc39.es/ecma262/#sec-clonearraybuffer
 ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM& vm, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length)
 {
@@ -84,6 +84,17 @@ public:
 
     void detach_buffer() { m_data_block.byte_buffer = Empty {}; }
 
+    // Detaches this buffer, and returns the data it had. Data that isn't owned by this buffer is copied.
+    ByteBuffer detach_and_take_buffer()
+    {
+        auto buffer = m_data_block.byte_buffer.visit(
+            [](Empty) -> ByteBuffer { VERIFY_NOT_REACHED(); },
+            [](ByteBuffer& buffer) { return move(buffer); },
+            [](ByteBuffer* buffer) { return *buffer; });
+        detach_buffer();
+        return buffer;
+    }
+
     // 25.1.3.4 IsDetachedBuffer ( arrayBuffer ), https://tc39.es/ecma262/#sec-isdetachedbuffer
     bool is_detached() const
     {
@@ -151,6 +162,7 @@ JS_API void copy_data_block_bytes(ByteBuffer& to_block, u64 to_index, ByteBuffer
 ThrowCompletionOr<ArrayBuffer*> allocate_array_buffer(VM&, FunctionObject& constructor, size_t byte_length, Optional<size_t> const& max_byte_length = {});
 ThrowCompletionOr<ArrayBuffer*> array_buffer_copy_and_detach(VM&, ArrayBuffer& array_buffer, Value new_length, PreserveResizability preserve_resizability);
 JS_API ThrowCompletionOr<void> detach_array_buffer(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
+JS_API ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
 ThrowCompletionOr<Optional<size_t>> get_array_buffer_max_byte_length_option(VM&, Value options);
 JS_API ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM&, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length);
 JS_API ThrowCompletionOr<GC::Ref<ArrayBuffer>> allocate_shared_array_buffer(VM&, FunctionObject& constructor, size_t byte_length);
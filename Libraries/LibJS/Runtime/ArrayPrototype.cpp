@@ -63,7 +63,7 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
     define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -719,6 +719,66 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// OPTIMIZATION: An array whose elements are all in simple storage without holes can be searched without going through
+//               [[HasProperty]] and [[Get]] for every index, as neither of them can run any code then.
+static SimpleIndexedPropertyStorage const* packed_simple_storage_for_search(Object const& object, size_t length)
+{
+    if (!is<Array>(object) || object.may_interfere_with_indexed_property_access())
+        return nullptr;
+
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (simple_storage.has_empty_elements() || simple_storage.array_like_size() != length)
+        return nullptr;
+
+    return &simple_storage;
+}
+
+// Finds the first element from start that's the number needle, in elements that are known to all be numbers, so each of
+// them is just compared as one, without looking at what kind of value it is first.
+static Optional<size_t> find_number_in_packed_elements(SimpleIndexedPropertyStorage const& storage, size_t start, Value needle, bool nan_is_equal)
+{
+    using ElementsKind = SimpleIndexedPropertyStorage::ElementsKind;
+
+    VERIFY(storage.elements_kind() != ElementsKind::Any);
+    VERIFY(needle.is_number());
+
+    auto elements = storage.elements().span().slice(0, storage.array_like_size());
+
+    if (needle.is_nan()) {
+        if (!nan_is_equal || storage.elements_kind() == ElementsKind::Int32)
+            return {};
+        for (size_t k = start; k < elements.size(); ++k) {
+            if (elements[k].is_nan())
+                return k;
+        }
+        return {};
+    }
+
+    if (storage.elements_kind() == ElementsKind::Int32) {
+        // NOTE: Integral numbers that fit in an i32 are always stored as one, so the only other number that can be equal
+        //       to an element is -0.
+        if (!needle.is_int32() && needle.as_double() != 0)
+            return {};
+        auto int32_needle = needle.is_int32() ? needle.as_i32() : 0;
+        for (size_t k = start; k < elements.size(); ++k) {
+            if (elements[k].as_i32() == int32_needle)
+                return k;
+        }
+        return {};
+    }
+
+    auto double_needle = needle.as_double();
+    for (size_t k = start; k < elements.size(); ++k) {
+        if (elements[k].as_double() == double_needle)
+            return k;
+    }
+    return {};
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -742,6 +802,20 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = packed_simple_storage_for_search(this_object, length)) {
+        if (storage->elements_kind() != SimpleIndexedPropertyStorage::ElementsKind::Any) {
+            if (!value_to_find.is_number())
+                return Value(false);
+            return Value(find_number_in_packed_elements(*storage, from_index, value_to_find, true).has_value());
+        }
+        for (auto element : storage->elements().span().slice(from_index, length - from_index)) {
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +869,20 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = packed_simple_storage_for_search(object, length)) {
+        if (storage->elements_kind() != SimpleIndexedPropertyStorage::ElementsKind::Any) {
+            if (!search_element.is_number())
+                return Value(-1);
+            auto index = find_number_in_packed_elements(*storage, k, search_element, false);
+            return index.has_value() ? Value(*index) : Value(-1);
+        }
+        for (; k < length; ++k) {
+            if (is_strictly_equal(search_element, storage->elements()[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -61,6 +61,7 @@ private:
     GC::Ptr<ECMAScriptFunctionObject> m_generating_function;
     Value m_previous_value;
     GC::Ptr<Promise> m_current_promise;
+    GC::Ptr<CompletionCell> m_completion_cell;
 };
 
 }
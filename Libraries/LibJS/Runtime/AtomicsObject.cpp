@@ -16,9 +16,12 @@
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
 #include <AK/TypeCasts.h>
+#include <LibCore/System.h>
+#include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -146,6 +149,59 @@ enum class WaitMode {
     Async,
 };
 
+// 25.4.3.13 NotifyWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-notifywaiter
+static void notify_waiter(VM& vm, PromiseCapability const& promise_capability, StringView result)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. If waiterRecord.[[PromiseCapability]] is blocking, then
+    //     a. Perform NotifyAgent(waiterRecord.[[AgentSignifier]]).
+    // 3. Else if AgentSignifier() is waiterRecord.[[AgentSignifier]], then
+    // NOTE: Only asynchronous waiters of this agent can be notified (see VM::AsyncAtomicsWaiter).
+
+    // a. Let promiseCapability be waiterRecord.[[PromiseCapability]].
+    // b. Perform ! Call(promiseCapability.[[Resolve]], undefined, « waiterRecord.[[Result]] »).
+    MUST(call(vm, *promise_capability.resolve(), js_undefined(), PrimitiveString::create(vm, result)));
+
+    // 4. Else,
+    //     a. Perform EnqueueResolveInAgentJob(waiterRecord.[[AgentSignifier]], waiterRecord.[[PromiseCapability]], waiterRecord.[[Result]]).
+    // 5. Return unused.
+}
+
+// 25.4.3.15 EnqueueAtomicsWaitAsyncTimeoutJob ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-enqueueatomicswaitasynctimeoutjob
+static void enqueue_atomics_wait_async_timeout_job(VM& vm, PromiseCapability& promise_capability, double timeout)
+{
+    // 1. Let timeoutJob be a new Abstract Closure with no parameters that captures WL and waiterRecord and performs the following steps when called:
+    auto timeout_job = GC::create_function(vm.heap(), [&vm, promise_capability = GC::Ref { promise_capability }] {
+        // a. Perform EnterCriticalSection(WL).
+        // b. If WL.[[Waiters]] contains waiterRecord, then
+        auto& waiters = vm.async_atomics_waiters();
+        auto index = waiters.find_first_index_if([&](auto const& waiter) { return waiter.promise_capability == promise_capability; });
+        if (!index.has_value())
+            return;
+
+        // i. Let timeOfJobExecution be the time value (UTC) identifying the current time.
+        // ii. Assert: ℝ(timeOfJobExecution) ≥ waiterRecord.[[TimeoutTime]] (ignoring potential non-monotonicity of time values).
+        // iii. Set waiterRecord.[[Result]] to "timed-out".
+        // iv. Perform RemoveWaiter(WL, waiterRecord).
+        waiters.remove(*index);
+
+        // v. Perform NotifyWaiter(WL, waiterRecord).
+        notify_waiter(vm, promise_capability, "timed-out"sv);
+
+        // c. Perform LeaveCriticalSection(WL).
+        // d. Return unused.
+    });
+
+    // 2. Let now be the time value (UTC) identifying the current time.
+    // 3. Let currentRealm be the current Realm Record.
+    auto& current_realm = *vm.current_realm();
+
+    // 4. Perform HostEnqueueTimeoutJob(timeoutJob, currentRealm, 𝔽(waiterRecord.[[TimeoutTime]]) - now).
+    vm.host_enqueue_timeout_job(timeout_job, current_realm, timeout);
+
+    // 5. Return unused.
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index_value, Value expected_value, Value timeout_value)
 {
@@ -189,12 +245,108 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
     if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)index;
-    (void)value;
-    (void)timeout;
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    // 12. Let WL be GetWaiterList(block, i).
+    // NOTE: See VM::AsyncAtomicsWaiter for how waiter lists are represented.
+
+    auto& realm = *vm.current_realm();
+
+    // 13. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    GC::Ptr<PromiseCapability> promise_capability;
+    GC::Ptr<Object> result_object;
+
+    // 14. Else,
+    if (mode == WaitMode::Async) {
+        // a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+        promise_capability = MUST(new_promise_capability(vm, realm.intrinsics().promise_constructor()));
+
+        // b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+        result_object = Object::create(realm, realm.intrinsics().object_prototype());
+    }
+
+    // 15. Perform EnterCriticalSection(WL).
+    // NOTE: Only this agent can access its waiters, so there's nothing to synchronize with.
+
+    // 16. Let elementType be TypedArrayElementType(typedArray).
+    // 17. Let w be GetValueFromBuffer(buffer, i, elementType, true, seq-cst).
+    auto current_value = typed_array.get_value_from_buffer(index, ArrayBuffer::Order::SeqCst);
+    i64 w = array_type_name == vm.names.BigInt64Array.as_string()
+        ? MUST(current_value.to_bigint_int64(vm))
+        : MUST(current_value.to_i32(vm));
+
+    auto create_synchronous_result = [&](StringView result) -> Value {
+        // a. Perform LeaveCriticalSection(WL).
+        // b. If mode is sync, return result.
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, result);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        MUST(result_object->create_data_property_or_throw(vm.names.async, Value { false }));
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", result).
+        MUST(result_object->create_data_property_or_throw(vm.names.value, PrimitiveString::create(vm, result)));
+
+        // e. Return resultObject.
+        return result_object;
+    };
+
+    // 18. If v ≠ w, then
+    if (value != w) {
+        // a-e. (See above, with "not-equal" as the result.)
+        return create_synchronous_result("not-equal"sv);
+    }
+
+    // 19. If t = 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a-e. (See above, with "timed-out" as the result.)
+        return create_synchronous_result("timed-out"sv);
+    }
+
+    // 20. Let thisAgent be AgentSignifier().
+    // 21. Let now be the time value (UTC) identifying the current time.
+    // 22. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 23. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 24. NOTE: When t is +∞, timeoutTime is also +∞.
+    // 25. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    // 26. Perform AddWaiter(WL, waiterRecord).
+    if (mode == WaitMode::Async)
+        vm.async_atomics_waiters().append({ *buffer, index, *promise_capability });
+
+    // 27. If mode is sync, then
+    if (mode == WaitMode::Sync) {
+        // a. Perform SuspendThisAgent(WL, waiterRecord).
+        // NOTE: As no other agent can share memory with this one, nothing can ever notify a blocked waiter. Suspending
+        //       this agent therefore amounts to sleeping until the timeout, after which the wait has timed out.
+        if (isinf(timeout)) {
+            for (;;)
+                (void)Core::System::sleep_ms(NumericLimits<u32>::max());
+        }
+        for (auto remaining = timeout; remaining > 0; remaining -= NumericLimits<u32>::max())
+            (void)Core::System::sleep_ms(static_cast<u32>(min(ceil(remaining), static_cast<double>(NumericLimits<u32>::max()))));
+
+        // 29. Perform LeaveCriticalSection(WL).
+        // 30. If mode is sync, return waiterRecord.[[Result]].
+        return PrimitiveString::create(vm, "timed-out"sv);
+    }
+
+    // 28. Else if timeoutTime is finite, then
+    if (!isinf(timeout)) {
+        // a. Perform EnqueueAtomicsWaitAsyncTimeoutJob(WL, waiterRecord).
+        enqueue_atomics_wait_async_timeout_job(vm, *promise_capability, timeout);
+    }
+
+    // 29. Perform LeaveCriticalSection(WL).
+
+    // 31. Perform ! CreateDataPropertyOrThrow(resultObject, "async", true).
+    MUST(result_object->create_data_property_or_throw(vm.names.async, Value { true }));
+
+    // 32. Perform ! CreateDataPropertyOrThrow(resultObject, "value", promiseCapability.[[Promise]]).
+    MUST(result_object->create_data_property_or_throw(vm.names.value, promise_capability->promise()));
+
+    // 33. Return resultObject.
+    return result_object;
 }
 
 template<typename T, typename AtomicFunction>
@@ -582,12 +734,29 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    // 8. Perform EnterCriticalSection(WL).
+    // 9. Let S be RemoveWaiters(WL, c).
+    Vector<GC::Ref<PromiseCapability>> removed_waiters;
+    vm.async_atomics_waiters().remove_all_matching([&](auto const& waiter) {
+        if (removed_waiters.size() >= count)
+            return false;
+        if (&waiter.buffer->buffer() != &block || waiter.byte_index_in_buffer != byte_index_in_buffer)
+            return false;
+        removed_waiters.append(waiter.promise_capability);
+        return true;
+    });
+
+    // 10. For each element W of S, do
+    for (auto promise_capability : removed_waiters) {
+        // a. Perform NotifyWaiter(WL, W).
+        notify_waiter(vm, promise_capability, "ok"sv);
+    }
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { removed_waiters.size() };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
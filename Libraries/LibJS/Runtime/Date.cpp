@@ -131,6 +131,44 @@ double time_from_year(i32 y)
     return ms_per_day * day_from_year(y);
 }
 
+struct CivilDate {
+    i32 year { 0 };
+    u8 month { 0 }; // Zero-based, like MonthFromTime().
+    u8 date { 0 };
+};
+
+// OPTIMIZATION: The year, month, and date of a time value are computed directly from its day number, rather than by
+//               computing the year several times over as the spec steps below do.
+// https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+static Optional<CivilDate> civil_date_from_time(double t)
+{
+    if (!isfinite(t))
+        return {};
+
+    auto days = day(t);
+    if (!AK::is_within_range<i32>(days))
+        return {};
+
+    // NOTE: The algorithm works with years that start on March 1st, so that leap days are at the end of the year,
+    //       grouped into eras of 400 years (146097 days). Day 0 is March 1st of year 0.
+    auto days_since_year_zero = static_cast<i64>(days) + 719468;
+    auto era = (days_since_year_zero >= 0 ? days_since_year_zero : days_since_year_zero - 146096) / 146097;
+    auto day_of_era = days_since_year_zero - era * 146097;
+    auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    auto month_starting_in_march = (5 * day_of_year + 2) / 153;
+
+    auto date = day_of_year - (153 * month_starting_in_march + 2) / 5 + 1;
+    auto month = month_starting_in_march < 10 ? month_starting_in_march + 2 : month_starting_in_march - 10;
+    auto year = year_of_era + era * 400 + (month <= 1 ? 1 : 0);
+
+    return CivilDate {
+        .year = static_cast<i32>(year),
+        .month = static_cast<u8>(month),
+        .date = static_cast<u8>(date),
+    };
+}
+
 // 21.4.1.8 YearFromTime ( t ), https://tc39.es/ecma262/#sec-yearfromtime
 i32 year_from_time(double t)
 {
@@ -170,6 +208,9 @@ bool in_leap_year(double t)
 // 21.4.1.11 MonthFromTime ( t ), https://tc39.es/ecma262/#sec-monthfromtime
 u8 month_from_time(double t)
 {
+    if (auto civil_date = civil_date_from_time(t); civil_date.has_value())
+        return civil_date->month;
+
     // 1. Let inLeapYear be InLeapYear(t).
     auto in_leap_year = static_cast<unsigned>(JS::in_leap_year(t));
 
@@ -230,6 +271,9 @@ u8 month_from_time(double t)
 // 21.4.1.12 DateFromTime ( t ), https://tc39.es/ecma262/#sec-datefromtime
 u8 date_from_time(double t)
 {
+    if (auto civil_date = civil_date_from_time(t); civil_date.has_value())
+        return civil_date->date;
+
     // 1. Let inLeapYear be InLeapYear(t).
     auto in_leap_year = static_cast<unsigned>(JS::in_leap_year(t));
 
@@ -396,6 +440,91 @@ static i64 clip_double_to_sane_time(double value)
     return static_cast<i64>(value);
 }
 
+// OPTIMIZATION: Dates look up the offset of the same time zone (usually the system time zone) over and over again, often
+//               for times that are close together. Instead of asking ICU every time, we remember the intervals between
+//               the time zone's transitions that we've seen, sorted by their start time.
+static constexpr size_t max_cached_time_zone_offset_intervals = 256;
+static String cached_time_zone_offset_intervals_time_zone;
+static Vector<Unicode::TimeZoneOffsetInterval> cached_time_zone_offset_intervals;
+
+static Optional<Unicode::TimeZoneOffsetInterval> cached_time_zone_offset_interval(StringView time_zone_identifier, UnixDateTime time)
+{
+    auto& intervals = cached_time_zone_offset_intervals;
+
+    if (cached_time_zone_offset_intervals_time_zone != time_zone_identifier) {
+        cached_time_zone_offset_intervals_time_zone = MUST(String::from_utf8(time_zone_identifier));
+        intervals.clear_with_capacity();
+    }
+
+    // Find the number of intervals that start at or before the given time, i.e. where a new interval would go.
+    size_t low = 0;
+    size_t high = intervals.size();
+
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+
+        if (intervals[middle].start <= time)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    if (low > 0 && intervals[low - 1].contains(time))
+        return intervals[low - 1];
+
+    auto interval = Unicode::time_zone_offset_interval(time_zone_identifier, time);
+    if (!interval.has_value())
+        return {};
+
+    // NOTE: ICU clamps the times it is given, so the interval may not contain times that are very far off.
+    if (interval->contains(time)) {
+        if (intervals.size() == max_cached_time_zone_offset_intervals) {
+            intervals.clear_with_capacity();
+            low = 0;
+        }
+
+        intervals.insert(low, *interval);
+    }
+
+    return interval;
+}
+
+static Unicode::TimeZoneOffset cached_time_zone_offset(StringView time_zone_identifier, UnixDateTime time)
+{
+    auto interval = cached_time_zone_offset_interval(time_zone_identifier, time);
+    VERIFY(interval.has_value());
+
+    return interval->offset;
+}
+
+// OPTIMIZATION: A local time that is further than this away from the transitions of the time zone exists exactly once,
+//               as no two offsets of a time zone are this far apart. Converting it to UTC then doesn't require
+//               disambiguating between the possible instants.
+static constexpr auto unambiguous_local_time_margin = AK::Duration::from_seconds(2 * 86400);
+
+static Optional<AK::Duration> unambiguous_time_zone_offset_for_local_time(StringView time_zone_identifier, double local_milliseconds)
+{
+    if (!isfinite(local_milliseconds))
+        return {};
+
+    auto local_time = UnixDateTime::from_milliseconds_since_epoch(clip_double_to_sane_time(local_milliseconds));
+
+    // The offset at the local time (taken as UTC) is at most a transition away from the offset at the instant.
+    auto guess = cached_time_zone_offset_interval(time_zone_identifier, local_time);
+    if (!guess.has_value())
+        return {};
+
+    auto interval = cached_time_zone_offset_interval(time_zone_identifier, local_time - guess->offset.offset);
+    if (!interval.has_value())
+        return {};
+
+    auto instant = local_time - interval->offset.offset;
+    if (!interval->contains(instant - unambiguous_local_time_margin) || !interval->contains(instant + unambiguous_local_time_margin))
+        return {};
+
+    return interval->offset.offset;
+}
+
 // 21.4.1.20 GetNamedTimeZoneEpochNanoseconds ( timeZoneIdentifier, year, month, day, hour, minute, second, millisecond, microsecond, nanosecond ), https://tc39.es/ecma262/#sec-getnamedtimezoneepochnanoseconds
 // 14.6.3 GetNamedTimeZoneEpochNanoseconds ( timeZoneIdentifier, isoDateTime ), https://tc39.es/proposal-temporal/#sec-getnamedtimezoneepochnanoseconds
 Vector<Crypto::SignedBigInteger> get_named_time_zone_epoch_nanoseconds(StringView time_zone_identifier, Temporal::ISODateTime const& iso_date_time)
@@ -422,10 +551,7 @@ Unicode::TimeZoneOffset get_named_time_zone_offset_nanoseconds(StringView time_z
     auto seconds = epoch_nanoseconds.divided_by(Temporal::NANOSECONDS_PER_SECOND).quotient;
     auto time = UnixDateTime::from_seconds_since_epoch(clip_bigint_to_sane_time(seconds));
 
-    auto offset = Unicode::time_zone_offset(time_zone_identifier, time);
-    VERIFY(offset.has_value());
-
-    return offset.release_value();
+    return cached_time_zone_offset(time_zone_identifier, time);
 }
 
 // 21.4.1.21 GetNamedTimeZoneOffsetNanoseconds ( timeZoneIdentifier, epochNanoseconds ), https://tc39.es/ecma262/#sec-getnamedtimezoneoffsetnanoseconds
@@ -435,10 +561,7 @@ Unicode::TimeZoneOffset get_named_time_zone_offset_milliseconds(StringView time_
     auto seconds = epoch_milliseconds / 1000.0;
     auto time = UnixDateTime::from_seconds_since_epoch(clip_double_to_sane_time(seconds));
 
-    auto offset = Unicode::time_zone_offset(time_zone_identifier, time);
-    VERIFY(offset.has_value());
-
-    return offset.release_value();
+    return cached_time_zone_offset(time_zone_identifier, time);
 }
 
 static Optional<String> cached_system_time_zone_identifier;
@@ -472,6 +595,8 @@ String system_time_zone_identifier()
 void clear_system_time_zone_cache()
 {
     cached_system_time_zone_identifier.clear();
+    cached_time_zone_offset_intervals_time_zone = {};
+    cached_time_zone_offset_intervals.clear();
 }
 
 // 21.4.1.25 LocalTime ( t ), https://tc39.es/ecma262/#sec-localtime
@@ -522,6 +647,11 @@ double utc_time(double time)
         // a. Let offsetNs be parseResult.[[OffsetMinutes]] × (60 × 10**9).
         offset_nanoseconds = static_cast<double>(*parse_result.offset_minutes) * 60'000'000'000;
     }
+    // OPTIMIZATION: Most local times aren't anywhere near a transition of the time zone, and have exactly one possible
+    //               instant. We can skip the ISO date-time record and BigInt arithmetic of the steps below for those.
+    else if (auto unambiguous_offset = unambiguous_time_zone_offset_for_local_time(system_time_zone_identifier, time); unambiguous_offset.has_value()) {
+        offset_nanoseconds = static_cast<double>(unambiguous_offset->to_nanoseconds());
+    }
     // 4. Else,
     else {
         // a. Let isoDateTime be TimeValueToISODateTimeRecord(t).
@@ -1004,10 +1004,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "date", "date").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed DateTimeFormat.
+    GC::Ptr<Intl::DateTimeFormat> date_format;
+    if (locales.is_undefined() && options.is_undefined())
+        date_format = realm.intrinsics().default_date_time_format(Intl::OptionRequired::Date, Intl::OptionDefaults::Date);
+    else
+        date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *date_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
@@ -1028,10 +1033,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "any", "all").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed DateTimeFormat.
+    GC::Ptr<Intl::DateTimeFormat> date_format;
+    if (locales.is_undefined() && options.is_undefined())
+        date_format = realm.intrinsics().default_date_time_format(Intl::OptionRequired::Any, Intl::OptionDefaults::All);
+    else
+        date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *date_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
@@ -1052,10 +1062,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let timeFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "time", "time").
-    auto time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed DateTimeFormat.
+    GC::Ptr<Intl::DateTimeFormat> time_format;
+    if (locales.is_undefined() && options.is_undefined())
+        time_format = realm.intrinsics().default_date_time_format(Intl::OptionRequired::Time, Intl::OptionDefaults::Time);
+    else
+        time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
 
     // 4. Return ? FormatDateTime(timeFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, time_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *time_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
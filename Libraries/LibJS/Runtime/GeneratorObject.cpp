@@ -50,6 +50,7 @@ void GeneratorObject::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_generating_function);
     visitor.visit(m_previous_value);
+    visitor.visit(m_completion_cell);
     m_execution_context->visit_edges(visitor);
 }
 
@@ -98,7 +99,12 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
         return {};
     };
 
-    auto compleion_cell = heap().allocate<CompletionCell>(completion);
+    // OPTIMIZATION: The completion we're resumed with is only read right after resuming, so the same cell can carry
+    //               every one of them instead of allocating a new one on each resumption.
+    if (!m_completion_cell)
+        m_completion_cell = heap().allocate<CompletionCell>(completion);
+    else
+        m_completion_cell->set_completion(completion);
 
     auto& bytecode_interpreter = vm.bytecode_interpreter();
 
@@ -107,7 +113,7 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
     // We should never enter `execute` again after the generator is complete.
     VERIFY(next_block.has_value());
 
-    auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), next_block, compleion_cell);
+    auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), next_block, m_completion_cell);
 
     vm.pop_execution_context();
 
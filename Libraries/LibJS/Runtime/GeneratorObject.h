@@ -55,6 +55,7 @@ private:
     NonnullOwnPtr<ExecutionContext> m_execution_context;
     GC::Ptr<ECMAScriptFunctionObject> m_generating_function;
     Value m_previous_value;
+    GC::Ptr<CompletionCell> m_completion_cell;
     GeneratorState m_generator_state { GeneratorState::SuspendedStart };
     Optional<StringView> m_generator_brand;
 };
@@ -62,6 +62,15 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // NOTE: The kinds of values the elements are known to be, from narrowest to widest. It's only ever widened as values
+    //       get stored, so it's a promise about every element that isn't empty, not a description of the current ones.
+    //       Whether the elements are packed or holey is what has_empty_elements() says.
+    enum class ElementsKind : u8 {
+        Int32,
+        Number,
+        Any,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,12 +104,30 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementsKind elements_kind() const { return m_elements_kind; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
+    static ElementsKind elements_kind_for(Value value)
+    {
+        if (value.is_int32())
+            return ElementsKind::Int32;
+        if (value.is_number())
+            return ElementsKind::Number;
+        return ElementsKind::Any;
+    }
+
+    void widen_elements_kind_for(Value value)
+    {
+        if (m_elements_kind != ElementsKind::Any && !value.is_special_empty_value())
+            m_elements_kind = max(m_elements_kind, elements_kind_for(value));
+    }
+
     void grow_storage_if_needed();
 
     Checked<size_t> m_number_of_empty_elements { 0 };
+    ElementsKind m_elements_kind { ElementsKind::Int32 };
     Vector<Value> m_packed_elements;
 };
 
@@ -30,6 +30,7 @@
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/DataViewConstructor.h>
 #include <LibJS/Runtime/DataViewPrototype.h>
+#include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/DateConstructor.h>
 #include <LibJS/Runtime/DatePrototype.h>
 #include <LibJS/Runtime/DisposableStackConstructor.h>
@@ -46,6 +47,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
 #include <LibJS/Runtime/Intl/CollatorPrototype.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatPrototype.h>
 #include <LibJS/Runtime/Intl/DisplayNamesConstructor.h>
@@ -57,6 +59,7 @@
 #include <LibJS/Runtime/Intl/ListFormatPrototype.h>
 #include <LibJS/Runtime/Intl/LocaleConstructor.h>
 #include <LibJS/Runtime/Intl/LocalePrototype.h>
+#include <LibJS/Runtime/Intl/NumberFormat.h>
 #include <LibJS/Runtime/Intl/NumberFormatConstructor.h>
 #include <LibJS/Runtime/Intl/NumberFormatPrototype.h>
 #include <LibJS/Runtime/Intl/PluralRulesConstructor.h>
@@ -311,17 +314,13 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
+    // OPTIMIZATION: The functions of the Array prototype, the Date constructor and the JSON object we hold on to are
+    //               captured when those intrinsics are created on first use, so that creating a realm doesn't have to
+    //               create them as well.
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 
-    array_prototype()->convert_to_prototype_if_needed();
-    m_default_array_prototype_shape = array_prototype()->shape();
     m_default_object_prototype_shape = object_prototype()->shape();
 
-    VERIFY(array_prototype()->indexed_properties().is_empty());
     VERIFY(object_prototype()->indexed_properties().is_empty());
 }
 
@@ -368,6 +367,16 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        /* NOTE: Nothing can have modified these intrinsics yet, so this captures the original functions. */                                             \
+        if constexpr (IsSame<Namespace::ConstructorName, ArrayConstructor>) {                                                                            \
+            m_array_prototype_values_function = &m_array_prototype->get_without_side_effects(vm.names.values).as_function();                             \
+            m_array_prototype->convert_to_prototype_if_needed();                                                                                         \
+            m_default_array_prototype_shape = m_array_prototype->shape();                                                                                \
+            VERIFY(m_array_prototype->indexed_properties().is_empty());                                                                                  \
+        } else if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>) {                                                                      \
+            m_date_constructor_now_function = &m_date_constructor->get_without_side_effects(vm.names.now).as_function();                                 \
+        }                                                                                                                                                \
     }                                                                                                                                                    \
                                                                                                                                                          \
     GC::Ref<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                          \
@@ -401,16 +410,52 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                              \
-    GC::Ref<ClassName> Intrinsics::snake_name##_object()                   \
-    {                                                                      \
-        if (!m_##snake_name##_object)                                      \
-            m_##snake_name##_object = m_realm->create<ClassName>(m_realm); \
-        return *m_##snake_name##_object;                                   \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                  \
+    GC::Ref<ClassName> Intrinsics::snake_name##_object()                                                                       \
+    {                                                                                                                          \
+        if (!m_##snake_name##_object) {                                                                                        \
+            m_##snake_name##_object = m_realm->create<ClassName>(m_realm);                                                     \
+                                                                                                                               \
+            /* NOTE: Nothing can have modified this object yet, so this captures the original functions. */                   \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                                     \
+                auto& vm = this->vm();                                                                                         \
+                m_json_parse_function = &m_json_object->get_without_side_effects(vm.names.parse).as_function();                \
+                m_json_stringify_function = &m_json_object->get_without_side_effects(vm.names.stringify).as_function();        \
+            }                                                                                                                  \
+        }                                                                                                                      \
+        return *m_##snake_name##_object;                                                                                       \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+GC::Ref<FunctionObject> Intrinsics::array_prototype_values_function()
+{
+    // NOTE: This is captured when the Array prototype is created.
+    (void)array_prototype();
+    return *m_array_prototype_values_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    // NOTE: This is captured when the Date constructor is created.
+    (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_parse_function()
+{
+    // NOTE: This is captured when the JSON object is created.
+    (void)json_object();
+    return *m_json_parse_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_stringify_function()
+{
+    // NOTE: This is captured when the JSON object is created.
+    (void)json_object();
+    return *m_json_stringify_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -480,6 +525,10 @@ void Intrinsics::visit_edges(Visitor& visitor)
 #undef __JS_ENUMERATE
 
     visitor.visit(m_default_collator);
+    visitor.visit(m_default_number_format);
+    visitor.visit(m_default_date_format);
+    visitor.visit(m_default_date_time_format);
+    visitor.visit(m_default_time_format);
 }
 
 GC::Ref<Intl::Collator> Intrinsics::default_collator()
@@ -490,6 +539,47 @@ GC::Ref<Intl::Collator> Intrinsics::default_collator()
     return *m_default_collator;
 }
 
+GC::Ref<Intl::NumberFormat> Intrinsics::default_number_format()
+{
+    if (!m_default_number_format) {
+        m_default_number_format = as<Intl::NumberFormat>(*MUST(construct(this->vm(), intl_number_format_constructor(), js_undefined(), js_undefined())));
+    }
+    return *m_default_number_format;
+}
+
+GC::Ref<Intl::DateTimeFormat> Intrinsics::default_date_time_format(Intl::OptionRequired required, Intl::OptionDefaults defaults)
+{
+    // NOTE: A DateTimeFormat created without a timeZone option uses the system time zone, which may change while we're
+    //       running. If it has, formats created for the previous time zone can't be used anymore.
+    auto time_zone = system_time_zone_identifier();
+    if (m_default_date_time_formats_time_zone != time_zone) {
+        m_default_date_format = nullptr;
+        m_default_date_time_format = nullptr;
+        m_default_time_format = nullptr;
+        m_default_date_time_formats_time_zone = move(time_zone);
+    }
+
+    auto& format = [&]() -> GC::Ptr<Intl::DateTimeFormat>& {
+        switch (required) {
+        case Intl::OptionRequired::Date:
+            VERIFY(defaults == Intl::OptionDefaults::Date);
+            return m_default_date_format;
+        case Intl::OptionRequired::Any:
+            VERIFY(defaults == Intl::OptionDefaults::All);
+            return m_default_date_time_format;
+        case Intl::OptionRequired::Time:
+            VERIFY(defaults == Intl::OptionDefaults::Time);
+            return m_default_time_format;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }();
+
+    if (!format)
+        format = MUST(Intl::create_date_time_format(this->vm(), intl_date_time_format_constructor(), js_undefined(), js_undefined(), required, defaults));
+    return *format;
+}
+
 // 10.2.4 AddRestrictedFunctionProperties ( F, realm ), https://tc39.es/ecma262/#sec-addrestrictedfunctionproperties
 void add_restricted_function_properties(FunctionObject& function, Realm& realm)
 {
@@ -51,7 +51,8 @@ public:
     [[nodiscard]] u32 mapped_arguments_object_well_known_symbol_iterator_offset() const { return m_mapped_arguments_object_well_known_symbol_iterator_offset; }
     [[nodiscard]] u32 mapped_arguments_object_callee_offset() const { return m_mapped_arguments_object_callee_offset; }
 
-    [[nodiscard]] GC::Ref<Shape> default_array_prototype_shape() const { return *m_default_array_prototype_shape; }
+    // NOTE: This is null until the Array prototype has been created.
+    [[nodiscard]] GC::Ptr<Shape> default_array_prototype_shape() const { return m_default_array_prototype_shape; }
     [[nodiscard]] GC::Ref<Shape> default_object_prototype_shape() const { return *m_default_object_prototype_shape; }
 
     [[nodiscard]] GC::Ref<Accessor> throw_type_error_accessor() { return *m_throw_type_error_accessor; }
@@ -87,10 +88,10 @@ public:
     GC::Ref<FunctionObject> unescape_function() const { return *m_unescape_function; }
 
     // Namespace/constructor object functions
-    GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    GC::Ref<FunctionObject> array_prototype_values_function();
+    GC::Ref<FunctionObject> date_constructor_now_function();
+    GC::Ref<FunctionObject> json_parse_function();
+    GC::Ref<FunctionObject> json_stringify_function();
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
@@ -125,7 +126,12 @@ public:
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
+    // OPTIMIZATION: The toLocaleString() family of methods constructs a new Intl object, and with it new ICU formatters,
+    //               every time they're called. They are commonly called without any locales or options though, in which
+    //               case the result is always the same, so those objects are created once and cached here.
     [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
+    [[nodiscard]] GC::Ref<Intl::NumberFormat> default_number_format();
+    [[nodiscard]] GC::Ref<Intl::DateTimeFormat> default_date_time_format(Intl::OptionRequired, Intl::OptionDefaults);
 
 private:
     Intrinsics(Realm& realm)
@@ -250,6 +256,11 @@ private:
 #undef __JS_ENUMERATE
 
     GC::Ptr<Intl::Collator> m_default_collator;
+    GC::Ptr<Intl::NumberFormat> m_default_number_format;
+    GC::Ptr<Intl::DateTimeFormat> m_default_date_format;
+    GC::Ptr<Intl::DateTimeFormat> m_default_date_time_format;
+    GC::Ptr<Intl::DateTimeFormat> m_default_time_format;
+    String m_default_date_time_formats_time_zone;
 };
 
 void add_restricted_function_properties(FunctionObject&, Realm&);
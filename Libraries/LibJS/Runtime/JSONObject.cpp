@@ -8,6 +8,7 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
+#include <AK/StringConversions.h>
 #include <AK/StringBuilder.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
@@ -447,21 +448,295 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Parses JSON text straight into JS values, without building an intermediate AK::JsonValue tree first.
+// This accepts exactly the same grammar as AK::JsonParser.
+class JSONValueParser : private GenericLexer {
+public:
+    JSONValueParser(VM& vm, StringView input)
+        : GenericLexer(input)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto result = TRY(parse_value());
+        ignore_while(is_space);
+        if (!is_eof())
+            return malformed();
+        return result;
+    }
+
+private:
+    static constexpr bool is_space(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    ThrowCompletionOr<Value> malformed()
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        ignore_while(is_space);
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"': {
+            auto string = TRY(parse_string());
+            return PrimitiveString::create(m_vm, move(string));
+        }
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 'f':
+            if (consume_specific("false"sv))
+                return Value(false);
+            break;
+        case 't':
+            if (consume_specific("true"sv))
+                return Value(true);
+            break;
+        case 'n':
+            if (consume_specific("null"sv))
+                return js_null();
+            break;
+        }
+        return malformed();
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        // NOTE: Objects with the same key order go through the same cached shape transitions, so they end up sharing a shape.
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        ignore(); // '{'
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            if (peek() != '"')
+                return malformed();
+            auto key = TRY(parse_string());
+            ignore_while(is_space);
+            if (!consume_specific(':'))
+                return malformed();
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+            ignore_while(is_space);
+            if (peek() == '}')
+                break;
+            if (!consume_specific(','))
+                return malformed();
+            ignore_while(is_space);
+            if (peek() == '}')
+                return malformed();
+        }
+        ignore(); // '}'
+        return object;
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        auto array = MUST(Array::create(m_realm, 0));
+
+        // NOTE: JSON arrays never have holes, so elements can be appended to the indexed storage directly.
+        auto& elements = array->indexed_properties();
+
+        ignore(); // '['
+        for (;;) {
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            auto element = TRY(parse_value());
+            elements.append(element);
+            ignore_while(is_space);
+            if (peek() == ']')
+                break;
+            if (!consume_specific(','))
+                return malformed();
+            ignore_while(is_space);
+            if (peek() == ']')
+                return malformed();
+        }
+        if (!consume_specific(']'))
+            return malformed();
+        return array;
+    }
+
+    ThrowCompletionOr<String> parse_string()
+    {
+        ignore(); // '"'
+
+        // Strings without escape sequences can be created straight from the input.
+        auto start = tell();
+        for (;;) {
+            char ch = peek();
+            if (ch == '\0' || is_ascii_c0_control(ch))
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            if (ch == '"') {
+                auto literal = m_input.substring_view(start, tell() - start);
+                ignore();
+                return String::from_utf8_without_validation(literal.bytes());
+            }
+            if (ch == '\\')
+                break;
+            ignore();
+        }
+
+        m_string_builder.clear();
+        m_string_builder.append(m_input.substring_view(start, tell() - start));
+
+        for (;;) {
+            auto literal_start = tell();
+            for (;;) {
+                char ch = peek();
+                if (ch == '\0' || is_ascii_c0_control(ch))
+                    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+                if (ch == '"' || ch == '\\')
+                    break;
+                ignore();
+            }
+            m_string_builder.append(m_input.substring_view(literal_start, tell() - literal_start));
+
+            if (consume_specific('"'))
+                break;
+
+            ignore(); // '\'
+            switch (char escape = peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                ignore();
+                m_string_builder.append(escape);
+                break;
+            case 'b':
+                ignore();
+                m_string_builder.append('\b');
+                break;
+            case 'f':
+                ignore();
+                m_string_builder.append('\f');
+                break;
+            case 'n':
+                ignore();
+                m_string_builder.append('\n');
+                break;
+            case 'r':
+                ignore();
+                m_string_builder.append('\r');
+                break;
+            case 't':
+                ignore();
+                m_string_builder.append('\t');
+                break;
+            case 'u': {
+                ignore();
+                auto code_point = decode_single_or_paired_surrogate();
+                if (code_point.is_error())
+                    return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+                m_string_builder.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            }
+        }
+
+        auto string = m_string_builder.to_string();
+        if (string.is_error())
+            return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+        return string.release_value();
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = tell();
+
+        bool negative = consume_specific('-');
+        if (!is_ascii_digit(peek()))
+            return malformed();
+        if (peek() == '0' && is_ascii_digit(peek(1)))
+            return malformed();
+
+        // Integers that fit in a double's mantissa can be accumulated exactly without going through the
+        // floating point parser.
+        static constexpr size_t max_exact_integer_digits = 15;
+
+        u64 integer = 0;
+        size_t digit_count = 0;
+        while (is_ascii_digit(peek())) {
+            integer = integer * 10 + parse_ascii_digit(consume());
+            ++digit_count;
+        }
+
+        bool is_integer = true;
+        if (peek() == '.') {
+            if (!is_ascii_digit(peek(1)))
+                return malformed();
+            ignore();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            char next = peek(1);
+            if (!is_ascii_digit(next) && ((next != '+' && next != '-') || !is_ascii_digit(peek(2))))
+                return malformed();
+            ignore(2);
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        if (is_integer && digit_count <= max_exact_integer_digits) {
+            if (negative)
+                return Value(integer == 0 ? -0.0 : -static_cast<double>(integer));
+            return Value(static_cast<double>(integer));
+        }
+
+        auto view = m_input.substring_view(start, tell() - start);
+        auto result = AK::parse_number<double>(view, TrimWhitespace::No);
+        if (!result.has_value())
+            return malformed();
+        return Value(result.value());
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringBuilder m_string_builder;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: Validation and evaluation are done in a single pass.
+    JSONValueParser parser(vm, text);
+    auto result = TRY(parser.parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -23,71 +23,142 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
-    m_entries.clear();
+    m_size = 0;
+
+    if (can_compact()) {
+        m_entries.clear();
+        m_buckets.clear();
+        return;
+    }
+
+    // NOTE: Iterators that are still around go on with whatever gets added after this.
+    for (auto& entry : m_entries)
+        remove_entry(entry);
+    m_buckets.span().fill(no_entry);
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
+    if (m_buckets.is_empty())
+        return false;
 
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
+    auto hash = ValueTraits::hash(key);
+    for (auto* link = &m_buckets[hash & (m_buckets.size() - 1)]; *link != no_entry; link = &m_entries[*link].next_in_bucket) {
+        auto& entry = m_entries[*link];
+        if (entry.hash != hash || !ValueTraits::equals(entry.key, key))
+            continue;
 
-    if (!index.has_value())
-        return false;
+        *link = entry.next_in_bucket;
+        remove_entry(entry);
+        --m_size;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    return true;
+        if (can_compact() && m_entries.size() >= minimum_entry_count_to_compact && m_size < m_entries.size() / 2)
+            rehash();
+        return true;
+    }
+
+    return false;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_entry(key); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry(key).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    if (auto index = find_entry(key); index.has_value()) {
+        m_entries[*index].value = value;
+        return;
+    }
+
+    if (m_entries.size() >= m_buckets.size())
+        rehash();
+
+    auto hash = ValueTraits::hash(key);
+    auto& bucket = m_buckets[hash & (m_buckets.size() - 1)];
+    m_entries.append({ .key = key, .value = value, .hash = hash, .next_in_bucket = bucket });
+    bucket = m_entries.size() - 1;
+    ++m_size;
+}
+
+void Map::copy_entries_from(Map const& other)
+{
+    VERIFY(m_entries.is_empty());
+
+    m_entries.ensure_capacity(other.m_size);
+    for (auto const& entry : other.m_entries) {
+        if (!entry.is_removed())
+            m_entries.unchecked_append(entry);
+    }
+    m_size = other.m_size;
+    rehash();
+}
+
+Optional<size_t> Map::find_entry(Value const& key) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    auto hash = ValueTraits::hash(key);
+    for (auto index = m_buckets[hash & (m_buckets.size() - 1)]; index != no_entry; index = m_entries[index].next_in_bucket) {
+        auto const& entry = m_entries[index];
+        if (entry.hash == hash && ValueTraits::equals(entry.key, key))
+            return index;
     }
+    return {};
+}
+
+void Map::remove_entry(Entry& entry)
+{
+    entry.key = js_special_empty_value();
+    entry.value = js_special_empty_value();
+    entry.next_in_bucket = no_entry;
 }
 
-size_t Map::map_size() const
+// Makes room for at least as many entries again as there are now, dropping the removed ones if no iterator can see them.
+void Map::rehash()
 {
-    return m_keys.size();
+    if (can_compact() && m_size != m_entries.size())
+        m_entries.remove_all_matching([](auto const& entry) { return entry.is_removed(); });
+
+    auto bucket_count = minimum_bucket_count;
+    while (bucket_count < 2 * m_entries.size())
+        bucket_count *= 2;
+
+    m_buckets.resize(bucket_count);
+    m_buckets.span().fill(no_entry);
+
+    for (size_t index = 0; index < m_entries.size(); ++index) {
+        auto& entry = m_entries[index];
+        if (entry.is_removed())
+            continue;
+        auto& bucket = m_buckets[entry.hash & (bucket_count - 1)];
+        entry.next_in_bucket = bucket;
+        bucket = index;
+    }
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto const& entry : m_entries) {
+        if (entry.is_removed())
+            continue;
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
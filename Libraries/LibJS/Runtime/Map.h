@@ -6,8 +6,8 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/NumericLimits.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -16,6 +16,10 @@
 
 namespace JS {
 
+// NOTE: The entries are kept in insertion order in a single array, which a hash table of chains through the entries
+//       indexes into (a "close table"). Removed entries are left behind with an empty key, so that iterators can keep
+//       walking the array by index no matter how the map changes. The array is only compacted while no iterator is
+//       around to notice.
 class JS_API Map : public Object {
     JS_OBJECT(Map, Object);
     GC_DECLARE_ALLOCATOR(Map);
@@ -30,17 +34,51 @@ public:
     Optional<Value> map_get(Value const&) const;
     bool map_has(Value const&) const;
     void map_set(Value const&, Value);
-    size_t map_size() const;
+    size_t map_size() const { return m_size; }
+
+    void copy_entries_from(Map const&);
+
+    struct Entry {
+        Value key;
+        Value value;
+        u32 hash { 0 };
+        u32 next_in_bucket { no_entry };
+
+        bool is_removed() const { return key.is_special_empty_value(); }
+    };
 
     struct EndIterator {
     };
 
     template<bool IsConst>
     struct IteratorImpl {
+        IteratorImpl(IteratorImpl const& other)
+            : m_map(other.m_map)
+            , m_index(other.m_index)
+        {
+            ++m_map->m_live_iterator_count;
+        }
+
+        IteratorImpl& operator=(IteratorImpl const& other)
+        {
+            if (this == &other)
+                return *this;
+            --m_map->m_live_iterator_count;
+            m_map = other.m_map;
+            m_index = other.m_index;
+            ++m_map->m_live_iterator_count;
+            return *this;
+        }
+
+        ~IteratorImpl()
+        {
+            --m_map->m_live_iterator_count;
+        }
+
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            skip_removed_entries();
+            return m_index >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
@@ -51,14 +89,14 @@ public:
 
         decltype(auto) operator*()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            skip_removed_entries();
+            return m_map->m_entries[m_index];
         }
 
         decltype(auto) operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            skip_removed_entries();
+            return m_map->m_entries[m_index];
         }
 
         bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
@@ -70,30 +108,21 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
+            ++m_map->m_live_iterator_count;
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
+            ++m_map->m_live_iterator_count;
         }
 
-        void ensure_index() const
+        void skip_removed_entries() const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
-        }
-
-        void ensure_next_element() const
-        {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+            while (m_index < entries.size() && entries[m_index].is_removed())
+                ++m_index;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
@@ -108,12 +137,22 @@ public:
     EndIterator end() const { return {}; }
 
 private:
+    static constexpr u32 no_entry = NumericLimits<u32>::max();
+    static constexpr size_t minimum_bucket_count = 8;
+    static constexpr size_t minimum_entry_count_to_compact = 32;
+
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    Optional<size_t> find_entry(Value const&) const;
+    void remove_entry(Entry&);
+    void rehash();
+    bool can_compact() const { return m_live_iterator_count == 0; }
+
+    Vector<Entry> m_entries;
+    Vector<u32> m_buckets;
+    size_t m_size { 0 };
+    mutable size_t m_live_iterator_count { 0 };
 };
 
 }
@@ -32,6 +32,12 @@ void MapIterator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_map);
 }
 
+void MapIterator::finalize()
+{
+    Base::finalize();
+    m_iterator.clear();
+}
+
 BuiltinIterator* MapIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
 {
     if (iterator_record.next_method.is_object()) {
@@ -53,15 +59,16 @@ ThrowCompletionOr<void> MapIterator::next(VM& vm, bool& done, Value& value)
         return {};
     }
 
-    if (m_iterator.is_end()) {
+    if (m_iterator->is_end()) {
         m_done = true;
+        m_iterator.clear();
         done = true;
         value = js_undefined();
         return {};
     }
 
-    auto entry = *m_iterator;
-    ++m_iterator;
+    auto entry = **m_iterator;
+    ++*m_iterator;
     if (m_iteration_kind == Object::PropertyKind::Key) {
         value = entry.key;
         return {};
@@ -31,11 +31,13 @@ private:
     explicit MapIterator(Map& map, Object::PropertyKind iteration_kind, Object& prototype);
 
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
     GC::Ref<Map> m_map;
     bool m_done { false };
     Object::PropertyKind m_iteration_kind;
-    Map::ConstIterator m_iterator;
+    // NOTE: This is cleared once it's done, so that the map can drop its removed entries again.
+    Optional<Map::ConstIterator> m_iterator;
 };
 
 }
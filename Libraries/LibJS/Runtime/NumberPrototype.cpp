@@ -271,7 +271,12 @@ JS_DEFINE_NATIVE_FUNCTION(NumberPrototype::to_locale_string)
     auto number_value = TRY(this_number_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed NumberFormat.
+    GC::Ptr<Intl::NumberFormat> number_format;
+    if (locales.is_undefined() && options.is_undefined())
+        number_format = realm.intrinsics().default_number_format();
+    else
+        number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
 
     // 3. Return ? FormatNumeric(numberFormat, x).
     auto formatted = Intl::format_numeric(*number_format, number_value);
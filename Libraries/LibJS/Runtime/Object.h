@@ -238,6 +238,10 @@ public:
     Shape& shape() { return *m_shape; }
     Shape const& shape() const { return *m_shape; }
 
+    // Switches to the given shape and resizes the property storage to match, without touching any values.
+    // The caller is responsible for the shape actually describing this object's properties.
+    void unsafe_set_shape(Shape&);
+
     void convert_to_prototype_if_needed();
 
     template<typename T>
@@ -263,8 +267,6 @@ protected:
     Object(ConstructWithPrototypeTag, Object& prototype, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
     explicit Object(Shape&, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
 
-    void unsafe_set_shape(Shape&);
-
     // [[Extensible]]
     bool m_is_extensible { true };
 
@@ -285,8 +287,13 @@ private:
     // True if this object has lazily allocated intrinsic properties.
     bool m_has_intrinsic_accessors { false };
 
+    // OPTIMIZATION: Most objects only ever have a handful of named properties, so we keep the first few inline in the
+    //               object itself. This saves a separate allocation for the storage of those objects, and a pointer
+    //               chase for every property access on them.
+    static constexpr size_t inline_property_storage_capacity = 4;
+
     GC::Ptr<Shape> m_shape;
-    Vector<Value> m_storage;
+    Vector<Value, inline_property_storage_capacity> m_storage;
     IndexedProperties m_indexed_properties;
     OwnPtr<Vector<PrivateElement>> m_private_elements; // [[PrivateElements]]
 };
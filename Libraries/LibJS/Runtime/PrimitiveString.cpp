@@ -221,7 +221,9 @@ void RopeString::resolve(EncodingPreference preference) const
     // This vector will hold all the pieces of the rope that need to be assembled
     // into the resolved string.
     Vector<PrimitiveString const*> pieces;
-    size_t approximate_length = 0;
+    size_t utf8_length = 0;
+    size_t utf16_length = 0;
+    bool has_piece_only_in_utf16 = false;
 
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
@@ -237,21 +239,30 @@ void RopeString::resolve(EncodingPreference preference) const
             continue;
         }
 
-        if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
+        if (current->has_utf8_string()) {
+            auto length_in_bytes = current->m_utf8_string->bytes_as_string_view().length();
+            utf8_length += length_in_bytes;
+            // NOTE: A piece never has more UTF-16 code units than it has UTF-8 bytes.
+            utf16_length += current->has_utf16_string() ? current->m_utf16_string->length_in_code_units() : length_in_bytes;
+        } else {
+            has_piece_only_in_utf16 = true;
+            utf16_length += current->m_utf16_string->length_in_code_units();
+        }
         pieces.append(current);
     }
 
-    if (preference == EncodingPreference::UTF16) {
-        // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
-        // into a UTF-16 code unit buffer and create a Utf16String from it.
-        StringBuilder builder(StringBuilder::Mode::UTF16);
+    // OPTIMIZATION: Building UTF-8 from pieces that only exist as UTF-16 would transcode (and keep) each of them on the
+    //               way, and then join surrogate pairs split between two of them back up. Building UTF-16 needs neither,
+    //               so we do that whenever there's such a piece, and leave transcoding the whole string at once to
+    //               utf8_string() if UTF-8 is what's wanted.
+    if (preference == EncodingPreference::UTF16 || has_piece_only_in_utf16) {
+        StringBuilder builder(StringBuilder::Mode::UTF16, utf16_length);
 
         for (auto const* current : pieces) {
-            if (current->has_utf8_string())
-                builder.append(current->utf8_string_view());
+            if (current->has_utf16_string())
+                builder.append(current->m_utf16_string->utf16_view());
             else
-                builder.append(current->utf16_string_view());
+                builder.append(current->m_utf8_string->bytes_as_string_view());
         }
 
         m_utf16_string = builder.to_utf16_string_without_validation();
@@ -262,14 +273,15 @@ void RopeString::resolve(EncodingPreference preference) const
     }
 
     // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    StringBuilder builder(approximate_length);
+    // NOTE: Every piece has a UTF-8 string here, so nothing is transcoded.
+    StringBuilder builder(utf8_length);
 
     // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
     PrimitiveString const* previous = nullptr;
     for (auto const* current : pieces) {
         if (!previous) {
             // This is the very first piece, just append it and continue.
-            builder.append(current->utf8_string());
+            builder.append(current->utf8_string_view());
             previous = current;
             continue;
         }
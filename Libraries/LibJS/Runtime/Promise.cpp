@@ -296,12 +296,17 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     // 2. If resultCapability is not present, then
     //     a. Set resultCapability to undefined.
 
+    // OPTIMIZATION: A promise that's already settled only ever runs the reaction for the state it's in, so the other one
+    //               (and its job callback) isn't made at all. Making either has no effect other than allocating it.
+    bool needs_fulfill_reaction = m_state != State::Rejected;
+    bool needs_reject_reaction = m_state != State::Fulfilled;
+
     // 3. If IsCallable(onFulfilled) is false, then
     //     a. Let onFulfilledJobCallback be empty.
     GC::Ptr<JobCallback> on_fulfilled_job_callback;
 
     // 4. Else,
-    if (on_fulfilled.is_function()) {
+    if (needs_fulfill_reaction && on_fulfilled.is_function()) {
         // a. Let onFulfilledJobCallback be HostMakeJobCallback(onFulfilled).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Creating JobCallback for on_fulfilled function @ {}", this, &on_fulfilled.as_function());
         on_fulfilled_job_callback = vm.host_make_job_callback(on_fulfilled.as_function());
@@ -312,17 +317,21 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     GC::Ptr<JobCallback> on_rejected_job_callback;
 
     // 6. Else,
-    if (on_rejected.is_function()) {
+    if (needs_reject_reaction && on_rejected.is_function()) {
         // a. Let onRejectedJobCallback be HostMakeJobCallback(onRejected).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Creating JobCallback for on_rejected function @ {}", this, &on_rejected.as_function());
         on_rejected_job_callback = vm.host_make_job_callback(on_rejected.as_function());
     }
 
     // 7. Let fulfillReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Fulfill, [[Handler]]: onFulfilledJobCallback }.
-    auto fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, result_capability, move(on_fulfilled_job_callback));
+    GC::Ptr<PromiseReaction> fulfill_reaction;
+    if (needs_fulfill_reaction)
+        fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, result_capability, move(on_fulfilled_job_callback));
 
     // 8. Let rejectReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Reject, [[Handler]]: onRejectedJobCallback }.
-    auto reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
+    GC::Ptr<PromiseReaction> reject_reaction;
+    if (needs_reject_reaction)
+        reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
 
     switch (m_state) {
     // 9. If promise.[[PromiseState]] is pending, then
@@ -342,7 +351,7 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
 
         // b. Let fulfillJob be NewPromiseReactionJob(fulfillReaction, value).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Fulfilled, creating PromiseJob for PromiseReaction @ {} with argument {}", this, fulfill_reaction.ptr(), value);
-        auto [fulfill_job, realm] = create_promise_reaction_job(vm, fulfill_reaction, value);
+        auto [fulfill_job, realm] = create_promise_reaction_job(vm, *fulfill_reaction, value);
 
         // c. Perform HostEnqueuePromiseJob(fulfillJob.[[Job]], fulfillJob.[[Realm]]).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Enqueuing job @ {} in realm {}", this, &fulfill_job, realm.ptr());
@@ -31,6 +31,12 @@ void SetIterator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_set);
 }
 
+void SetIterator::finalize()
+{
+    Base::finalize();
+    m_iterator.clear();
+}
+
 BuiltinIterator* SetIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
 {
     if (iterator_record.next_method.is_object()) {
@@ -52,8 +58,9 @@ ThrowCompletionOr<void> SetIterator::next(VM& vm, bool& done, Value& value)
         return {};
     }
 
-    if (m_iterator == m_set->end()) {
+    if (*m_iterator == m_set->end()) {
         m_done = true;
+        m_iterator.clear();
         done = true;
         value = js_undefined();
         return {};
@@ -61,8 +68,8 @@ ThrowCompletionOr<void> SetIterator::next(VM& vm, bool& done, Value& value)
 
     VERIFY(m_iteration_kind != Object::PropertyKind::Key);
 
-    value = (*m_iterator).key;
-    ++m_iterator;
+    value = (**m_iterator).key;
+    ++*m_iterator;
     if (m_iteration_kind == Object::PropertyKind::Value) {
         return {};
     }
@@ -32,11 +32,13 @@ private:
     explicit SetIterator(Set& set, Object::PropertyKind iteration_kind, Object& prototype);
 
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
     GC::Ref<Set> m_set;
     bool m_done { false };
     Object::PropertyKind m_iteration_kind;
-    Map::ConstIterator m_iterator;
+    // NOTE: This is cleared once it's done, so that the map can drop its removed entries again.
+    Optional<Map::ConstIterator> m_iterator;
 };
 
 }
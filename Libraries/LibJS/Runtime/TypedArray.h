@@ -115,6 +115,12 @@ inline bool is_valid_integer_index(TypedArrayBase const& typed_array, CanonicalI
     //               IsValidIntegerIndex. We just need to check whether the array itself is out-of-bounds and if
     //               the provided index is within the array bounds.
     if (auto const& array_length = typed_array.array_length(); !array_length.is_auto()) {
+        // OPTIMIZATION: If the ArrayBuffer is also fixed-length, it can't have shrunk since the TypedArray was created
+        //               within it, as being detached is the only way its length can change. The index is then the only
+        //               thing left to check.
+        if (typed_array.viewed_array_buffer()->is_fixed_length())
+            return property_index.as_index() < array_length.length();
+
         auto byte_length = array_buffer_byte_length(*typed_array.viewed_array_buffer(), ArrayBuffer::Unordered);
         auto byte_offset_end = typed_array.byte_offset() + array_length.length() * typed_array.element_size();
 
@@ -109,6 +109,11 @@ VM::VM(ErrorMessages error_messages)
         return make_job_callback(function_object);
     };
 
+    // NOTE: Without an event loop there's nothing to run a timeout job on, so asynchronous Atomics waiters only ever
+    //       wake up through Atomics.notify() here.
+    host_enqueue_timeout_job = [](GC::Ref<GC::Function<void()>>, Realm&, double) {
+    };
+
     host_load_imported_module = [this](ImportedModuleReferrer referrer, ModuleRequest const& module_request, GC::Ptr<GraphLoadingState::HostDefined> load_state, ImportedModulePayload payload) -> void {
         return load_imported_module(referrer, module_request, load_state, move(payload));
     };
@@ -267,6 +272,11 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto finalization_registry : m_finalization_registry_cleanup_jobs)
         roots.set(finalization_registry, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
+    for (auto& waiter : m_async_atomics_waiters) {
+        roots.set(waiter.buffer, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.set(waiter.promise_capability, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    }
+
     auto gather_roots_from_execution_context_stack = [&roots](Vector<ExecutionContext*> const& stack) {
         for (auto const& execution_context : stack) {
             ExecutionContextRootsCollector visitor;
@@ -279,7 +289,7 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
-    for (auto& job : m_promise_jobs)
+    for (auto job : m_promise_jobs.span().slice(m_first_pending_promise_job))
         roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 }
 
@@ -423,12 +433,18 @@ void VM::run_queued_promise_jobs_impl()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
+    // OPTIMIZATION: Jobs are taken off the front of the queue by moving an index along it, rather than by shifting all
+    //               the others down every time. Its storage is only reset (keeping the capacity) once every job has run.
+    // NOTE: The index is shared with nested runs, e.g. from a job that runs bytecode, so each job still only runs once.
+    while (m_first_pending_promise_job < m_promise_jobs.size()) {
+        auto job = m_promise_jobs[m_first_pending_promise_job++];
         dbgln_if(PROMISE_DEBUG, "Calling promise job function");
 
         [[maybe_unused]] auto result = job->function()();
     }
+
+    m_promise_jobs.clear_with_capacity();
+    m_first_pending_promise_job = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
@@ -248,7 +248,7 @@ public:
 
     void run_queued_promise_jobs()
     {
-        if (m_promise_jobs.is_empty())
+        if (m_first_pending_promise_job == m_promise_jobs.size())
             return;
         run_queued_promise_jobs_impl();
     }
@@ -299,6 +299,17 @@ public:
     Function<void(StringView)> host_unrecognized_date_string;
     Function<ThrowCompletionOr<void>(Realm&, NonnullOwnPtr<ExecutionContext>, ShadowRealm&)> host_initialize_shadow_realm;
     Function<Crypto::SignedBigInteger(Object const& global)> host_system_utc_epoch_nanoseconds;
+    Function<void(GC::Ref<GC::Function<void()>>, Realm&, double milliseconds)> host_enqueue_timeout_job;
+
+    // 25.4.3.2 Waiter Records, https://tc39.es/ecma262/#sec-waiter-record
+    // NOTE: No other agent can share memory with this one, so the only waiters that can ever be notified are the
+    //       asynchronous ones of this agent. We keep all of those in a single list, rather than one per location.
+    struct AsyncAtomicsWaiter {
+        GC::Ref<ArrayBuffer> buffer;
+        size_t byte_index_in_buffer { 0 };
+        GC::Ref<PromiseCapability> promise_capability;
+    };
+    Vector<AsyncAtomicsWaiter>& async_atomics_waiters() { return m_async_atomics_waiters; }
 
     Vector<StackTraceElement> stack_trace() const;
 
@@ -336,9 +347,12 @@ private:
     HashMap<String, GC::Ref<Symbol>> m_global_symbol_registry;
 
     Vector<GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>> m_promise_jobs;
+    size_t m_first_pending_promise_job { 0 };
 
     Vector<GC::Ptr<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
+    Vector<AsyncAtomicsWaiter> m_async_atomics_waiters;
+
     GC::Ptr<PrimitiveString> m_empty_string;
     GC::Ptr<PrimitiveString> m_single_ascii_character_strings[128] {};
     ErrorMessages m_error_messages;
@@ -2114,7 +2114,7 @@ ThrowCompletionOr<Value> instance_of(VM& vm, Value value, Value target)
         return vm.throw_completion<TypeError>(ErrorType::NotAFunction, target.to_string_without_side_effects());
 
     // 5. Return ? OrdinaryHasInstance(target, V).
-    return ordinary_has_instance(vm, target, value);
+    return ordinary_has_instance(vm, value, target);
 }
 
 // 7.3.22 OrdinaryHasInstance ( C, O ), https://tc39.es/ecma262/#sec-ordinaryhasinstance
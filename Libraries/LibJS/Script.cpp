@@ -7,6 +7,7 @@
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
 
@@ -17,6 +18,11 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    // OPTIMIZATION: If we've parsed this exact script before, we can reuse its AST.
+    auto& program_cache = ProgramCache::the();
+    if (auto cached_script = program_cache.find(Program::Type::Script, source_text, filename, line_number_offset))
+        return realm.heap().allocate<Script>(realm, filename, cached_script.release_nonnull(), host_defined);
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +31,8 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     if (parser.has_errors())
         return parser.errors();
 
+    program_cache.add(Program::Type::Script, filename, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
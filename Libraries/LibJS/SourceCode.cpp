@@ -33,6 +33,15 @@ String const& SourceCode::code() const
     return m_code;
 }
 
+ByteString SourceCodeSlice::to_byte_string() const
+{
+    return m_value.visit(
+        [](ByteString const& text) { return text; },
+        [](Range const& range) {
+            return ByteString { range.source_code->code().bytes_as_string_view().substring_view(range.start_offset, range.end_offset - range.start_offset) };
+        });
+}
+
 void SourceCode::fill_position_cache() const
 {
     constexpr size_t predicted_minimum_cached_positions = 8;
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/String.h>
+#include <AK/Variant.h>
 #include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
@@ -36,4 +38,31 @@ private:
     Vector<Position> mutable m_cached_positions;
 };
 
+// A [[SourceText]] range of some SourceCode. This lets every function and class in a script refer to its own
+// source text without copying it out at parse time, which matters since nested functions overlap.
+// The text is only materialized when something actually asks for it, e.g. Function.prototype.toString().
+class JS_API SourceCodeSlice {
+public:
+    SourceCodeSlice() = default;
+    SourceCodeSlice(ByteString text)
+        : m_value(move(text))
+    {
+    }
+    SourceCodeSlice(NonnullRefPtr<SourceCode const> source_code, size_t start_offset, size_t end_offset)
+        : m_value(Range { move(source_code), start_offset, end_offset })
+    {
+    }
+
+    ByteString to_byte_string() const;
+
+private:
+    struct Range {
+        NonnullRefPtr<SourceCode const> source_code;
+        size_t start_offset { 0 };
+        size_t end_offset { 0 };
+    };
+
+    Variant<ByteString, Range> m_value { ByteString {} };
+};
+
 }
@@ -9,6 +9,7 @@
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
@@ -132,12 +133,19 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
     // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
-    auto body = parser.parse_program();
-
-    // 2. If body is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    // OPTIMIZATION: If we've parsed this exact module before, we can reuse its AST.
+    auto& program_cache = ProgramCache::the();
+    auto body = program_cache.find(Program::Type::Module, source_text, filename, 1);
+    if (!body) {
+        auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
+        body = parser.parse_program();
+
+        // 2. If body is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        program_cache.add(Program::Type::Module, filename, 1, *body);
+    }
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
@@ -252,7 +260,7 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
         filename,
         host_defined,
         async,
-        move(body),
+        body.release_nonnull(),
         move(requested_modules),
         move(import_entries),
         move(local_export_entries),
@@ -787,7 +795,7 @@ ThrowCompletionOr<void> SourceTextModule::execute_module(VM& vm, GC::Ptr<Promise
         parsing_insights.uses_this_from_environment = true;
         parsing_insights.uses_this = true;
         auto module_wrapper_function = ECMAScriptFunctionObject::create(
-            realm(), "module code with top-level await"_fly_string, StringView {}, this->m_ecmascript_code,
+            realm(), "module code with top-level await"_fly_string, SourceCodeSlice {}, this->m_ecmascript_code,
             FunctionParameters::empty(), 0, {}, environment(), nullptr, FunctionKind::Async, true, parsing_insights);
         module_wrapper_function->set_is_module_wrapper(true);
 
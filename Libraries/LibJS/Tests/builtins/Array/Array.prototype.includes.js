@@ -17,6 +17,37 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("arrays of numbers", () => {
+    var integers = [1, 2, 3, 0];
+    expect(integers.includes(3)).toBeTrue();
+    expect(integers.includes(3.5)).toBeFalse();
+    expect(integers.includes(-0)).toBeTrue();
+    expect(integers.includes(NaN)).toBeFalse();
+    expect(integers.includes("3")).toBeFalse();
+    expect(integers.includes(1, 1)).toBeFalse();
+
+    var numbers = [1, 2.5, NaN, -0];
+    expect(numbers.includes(2.5)).toBeTrue();
+    expect(numbers.includes(NaN)).toBeTrue();
+    expect(numbers.includes(0)).toBeTrue();
+    expect(numbers.includes(NaN, 3)).toBeFalse();
+
+    numbers.push("4");
+    expect(numbers.includes("4")).toBeTrue();
+    expect(numbers.includes(4)).toBeFalse();
+});
+
+test("arrays with holes", () => {
+    var array = [1, , 3];
+    expect(array.includes(undefined)).toBeTrue();
+    Array.prototype[1] = 2;
+    try {
+        expect(array.includes(2)).toBeTrue();
+    } finally {
+        delete Array.prototype[1];
+    }
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
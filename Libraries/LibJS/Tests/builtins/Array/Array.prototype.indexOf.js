@@ -23,3 +23,36 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("arrays of numbers", () => {
+    var integers = [1, 2, 3, 0];
+    expect(integers.indexOf(3)).toBe(2);
+    expect(integers.indexOf(3.5)).toBe(-1);
+    expect(integers.indexOf(-0)).toBe(3);
+    expect(integers.indexOf(NaN)).toBe(-1);
+    expect(integers.indexOf("3")).toBe(-1);
+    expect(integers.indexOf(1, 1)).toBe(-1);
+
+    var numbers = [1, 2.5, NaN, -0];
+    expect(numbers.indexOf(2.5)).toBe(1);
+    expect(numbers.indexOf(NaN)).toBe(-1);
+    expect(numbers.indexOf(0)).toBe(3);
+
+    numbers.length = 0;
+    numbers.push(7);
+    expect(numbers.indexOf(7)).toBe(0);
+    numbers.push({});
+    expect(numbers.indexOf(7)).toBe(0);
+    expect(numbers.indexOf(numbers[1])).toBe(1);
+});
+
+test("arrays with holes", () => {
+    var array = [1, , 3];
+    expect(array.indexOf(undefined)).toBe(-1);
+    Array.prototype[1] = 2;
+    try {
+        expect(array.indexOf(2)).toBe(1);
+    } finally {
+        delete Array.prototype[1];
+    }
+});
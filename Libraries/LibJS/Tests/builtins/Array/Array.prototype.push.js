@@ -21,3 +21,43 @@ describe("normal behavior", () => {
         expect(a).toEqual(["hello", "friends", 1, 2, 3]);
     });
 });
+
+describe("observable behavior", () => {
+    test("frozen array", () => {
+        var a = Object.freeze([1, 2]);
+        expect(() => a.push(3)).toThrow(TypeError);
+        expect(a).toEqual([1, 2]);
+    });
+
+    test("non-writable length", () => {
+        var a = [1, 2];
+        Object.defineProperty(a, "length", { writable: false });
+        expect(() => a.push(3)).toThrow(TypeError);
+        expect(a).toHaveLength(2);
+    });
+
+    test("setter on the prototype", () => {
+        var setterCalls = 0;
+        Object.defineProperty(Array.prototype, 2, {
+            set() {
+                ++setterCalls;
+            },
+            configurable: true,
+        });
+        try {
+            var a = [1, 2];
+            expect(a.push(3)).toBe(3);
+            expect(setterCalls).toBe(1);
+            expect(a.hasOwnProperty(2)).toBeFalse();
+        } finally {
+            delete Array.prototype[2];
+        }
+    });
+
+    test("array-like this value", () => {
+        var o = { length: 1, push: Array.prototype.push };
+        expect(o.push("x")).toBe(2);
+        expect(o[1]).toBe("x");
+        expect(o.length).toBe(2);
+    });
+});
@@ -73,4 +73,46 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.waitAsync).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[0] = 1;
+
+        const result = Atomics.waitAsync(typedArray, 0, 0, 1000);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("not-equal");
+    });
+
+    test("zero timeout", () => {
+        const typedArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+
+        const result = Atomics.waitAsync(typedArray, 0, 0n, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("timed-out");
+    });
+
+    test("woken up by notify", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+
+        const first = Atomics.waitAsync(typedArray, 1, 0);
+        const second = Atomics.waitAsync(typedArray, 1, 0);
+        const other = Atomics.waitAsync(typedArray, 2, 0);
+        expect(first.async).toBeTrue();
+        expect(first.value).toBeInstanceOf(Promise);
+
+        const results = [];
+        first.value.then(value => results.push(`first: ${value}`));
+        second.value.then(value => results.push(`second: ${value}`));
+        other.value.then(value => results.push(`other: ${value}`));
+
+        expect(Atomics.notify(typedArray, 1, 1)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toEqual(["first: ok"]);
+
+        expect(Atomics.notify(typedArray, 1)).toBe(1);
+        expect(Atomics.notify(typedArray, 1)).toBe(0);
+        expect(Atomics.notify(typedArray, 2)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toEqual(["first: ok", "second: ok", "other: ok"]);
+    });
 });
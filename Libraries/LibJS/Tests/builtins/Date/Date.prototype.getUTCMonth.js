@@ -25,3 +25,24 @@ test("leap years", () => {
     expect(new Date(Date.UTC(2020, 2, 1)).getUTCDate()).toBe(1);
     expect(new Date(Date.UTC(2020, 2, 1)).getUTCMonth()).toBe(2);
 });
+
+test("first and last days of months", () => {
+    const years = [-200000, -401, -400, -1, 100, 1600, 1900, 1969, 1970, 2000, 2024, 2100, 2400, 200000];
+    const isLeapYear = year => (year % 4 === 0 && year % 100 !== 0) || year % 400 === 0;
+
+    for (const year of years) {
+        const daysInMonth = [31, isLeapYear(year) ? 29 : 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31];
+
+        for (let month = 0; month < 12; ++month) {
+            const first = new Date(Date.UTC(year, month, 1));
+            expect(first.getUTCFullYear()).toBe(year);
+            expect(first.getUTCMonth()).toBe(month);
+            expect(first.getUTCDate()).toBe(1);
+
+            const last = new Date(Date.UTC(year, month, daysInMonth[month]));
+            expect(last.getUTCFullYear()).toBe(year);
+            expect(last.getUTCMonth()).toBe(month);
+            expect(last.getUTCDate()).toBe(daysInMonth[month]);
+        }
+    }
+});
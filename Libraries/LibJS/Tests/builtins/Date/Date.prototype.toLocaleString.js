@@ -66,3 +66,23 @@ describe("correct behavior", () => {
         );
     });
 });
+
+describe("default formatter", () => {
+    test("repeated calls without arguments match a default DateTimeFormat", () => {
+        const date = new Date(Date.UTC(2021, 11, 7, 17, 40, 50, 456));
+        const options = {
+            year: "numeric",
+            month: "numeric",
+            day: "numeric",
+            hour: "numeric",
+            minute: "numeric",
+            second: "numeric",
+        };
+        const formatter = new Intl.DateTimeFormat(undefined, options);
+
+        for (let i = 0; i < 3; ++i) {
+            expect(date.toLocaleString()).toBe(formatter.format(date));
+            expect(date.toLocaleDateString()).toBe(new Intl.DateTimeFormat().format(date));
+        }
+    });
+});
@@ -123,6 +123,22 @@ describe("correct behavior", () => {
         expect(class { static async *foo() {} }.foo.toString()).toBe("async *foo() {}");
     });
 
+    test("nested functions", () => {
+        function outer() {
+            const inner = (a, b) => a + b;
+            return inner;
+        }
+        expect(outer().toString()).toBe("(a, b) => a + b");
+        expect(outer.toString()).toBe(
+            "function outer() {\n            const inner = (a, b) => a + b;\n            return inner;\n        }"
+        );
+    });
+
+    test("source text with non-ASCII characters", () => {
+        function ünïcödé() { return "😀"; }
+        expect(ünïcödé.toString()).toBe('function ünïcödé() { return "😀"; }');
+    });
+
     test("native function", () => {
         // Built-in functions
         expect(console.debug.toString()).toBe("function debug() { [native code] }");
@@ -74,3 +74,45 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("escape sequences", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"foo\\u0041bar"')).toBe("fooAbar");
+    expect(JSON.parse('"\\uD834\\uDD1E"')).toBe("𝄞");
+    expect(JSON.parse('{"a\\nb": "c\\td"}')).toEqual({ "a\nb": "c\td" });
+
+    ['"\\x41"', '"\\u00"', '"foo', '"\t"'].forEach(testCase => {
+        expect(() => {
+            JSON.parse(testCase);
+        }).toThrow(SyntaxError);
+    });
+});
+
+test("nested structures", () => {
+    const result = JSON.parse(' { "a" : [ 1 , { "b" : [ ] } , [ [ null ] ] ] , "c" : { } } ');
+    expect(result).toEqual({ a: [1, { b: [] }, [[null]]], c: {} });
+    expect(result.a).toHaveLength(3);
+
+    const objects = JSON.parse('[{"x":1,"y":2},{"x":3,"y":4},{"y":5,"x":6}]');
+    expect(objects.map(o => Object.keys(o))).toEqual([
+        ["x", "y"],
+        ["x", "y"],
+        ["y", "x"],
+    ]);
+});
+
+test("duplicate keys", () => {
+    const result = JSON.parse('{"a":1,"b":2,"a":3}');
+    expect(Object.keys(result)).toEqual(["a", "b"]);
+    expect(result.a).toBe(3);
+});
+
+test("invalid numbers", () => {
+    ["01", "-", "-a", "1.", "1.e5", "1e", "1e+", ".5", "+1"].forEach(testCase => {
+        expect(() => {
+            JSON.parse(testCase);
+        }).toThrow(SyntaxError);
+    });
+    expect(JSON.parse("1.5e3")).toBe(1500);
+    expect(JSON.parse("-12E-1")).toBe(-1.2);
+});
@@ -13,6 +13,24 @@ test("basic functionality", () => {
     expect(map).toHaveSize(2);
 });
 
+test("insertion order is kept after deleting most entries", () => {
+    const map = new Map();
+    for (let i = 0; i < 1000; ++i) map.set(i, i * 2);
+    for (let i = 0; i < 1000; ++i) {
+        if (i % 10 !== 0) expect(map.delete(i)).toBeTrue();
+    }
+    map.set("last", -1);
+
+    expect(map).toHaveSize(101);
+    expect(map.get(990)).toBe(1980);
+    expect(map.has(991)).toBeFalse();
+
+    const keys = [...map.keys()];
+    expect(keys).toHaveLength(101);
+    for (let i = 0; i < 100; ++i) expect(keys[i]).toBe(i * 10);
+    expect(keys[100]).toBe("last");
+});
+
 describe("modification with active iterators", () => {
     test("deleted element is skipped", () => {
         const map = new Map([
@@ -72,6 +90,21 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
     });
 
+    test("deleting most elements while iterating keeps the iterator in place", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        expect(iterator.next()).toBeIteratorResultWithValue(0);
+
+        for (let i = 1; i < 99; ++i) expect(map.delete(i)).toBeTrue();
+        map.set(100, 100);
+
+        expect(iterator.next()).toBeIteratorResultWithValue(99);
+        expect(iterator.next()).toBeIteratorResultWithValue(100);
+        expect(iterator.next()).toBeIteratorResultDone();
+    });
+
     test("deleting the last element before the iterator visited it means you immediately get end", () => {
         const map = new Map([[1, 2]]);
 
@@ -78,3 +78,19 @@ describe("styles", () => {
         ).toBe("\u0661\u066b\u0662\u0663 كيلومتر في الساعة");
     });
 });
+
+describe("default formatter", () => {
+    test("repeated calls without arguments match a default NumberFormat", () => {
+        const formatter = new Intl.NumberFormat();
+        for (let i = 0; i < 3; ++i) {
+            expect((1234.5 * i).toLocaleString()).toBe(formatter.format(1234.5 * i));
+            expect((1234n * BigInt(i)).toLocaleString()).toBe(formatter.format(1234n * BigInt(i)));
+        }
+    });
+
+    test("calls with options are not affected by calls without them", () => {
+        expect((0.5).toLocaleString()).toBe(new Intl.NumberFormat().format(0.5));
+        expect((0.5).toLocaleString("en", { style: "percent" })).toBe("50%");
+        expect((0.5).toLocaleString()).toBe(new Intl.NumberFormat().format(0.5));
+    });
+});
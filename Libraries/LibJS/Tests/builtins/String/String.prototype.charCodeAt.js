@@ -27,3 +27,10 @@ test("UTF-16", () => {
     expect(s.charCodeAt(1)).toBe(0xde00);
     expect(s.charCodeAt(2)).toBe(NaN);
 });
+
+test("called on non-string values", () => {
+    var o = { toString: () => "abc", charCodeAt: String.prototype.charCodeAt };
+    expect(o.charCodeAt(1)).toBe(98);
+    expect(new String("abc").charCodeAt(2)).toBe(99);
+    expect(() => String.prototype.charCodeAt.call(null, 0)).toThrow(TypeError);
+});
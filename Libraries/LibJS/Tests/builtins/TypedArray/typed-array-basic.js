@@ -84,3 +84,44 @@ test("basic Int32Array", () => {
     a[0]++;
     expect(a[0]).toBe(-0x80000000);
 });
+
+test("Uint8ClampedArray stores of non-integral numbers", () => {
+    var a = new Uint8ClampedArray(4);
+    a[0] = 1.5;
+    a[1] = 2.5;
+    a[2] = -1.5;
+    a[3] = 300.7;
+    expect(Array.from(a)).toEqual([2, 2, 0, 255]);
+});
+
+test("floating-point TypedArray stores of integers", () => {
+    var a = new Float32Array(2);
+    var b = new Float64Array(2);
+    a[1] = 7;
+    b[1] = -7;
+    expect(a[1]).toBe(7);
+    expect(b[1]).toBe(-7);
+});
+
+test("element access after the buffer is detached", () => {
+    var a = new Float32Array(4);
+    a[2] = 1.5;
+    detachArrayBuffer(a.buffer);
+    expect(a[2]).toBeUndefined();
+    a[2] = 3;
+    expect(a[2]).toBeUndefined();
+    expect(a.length).toBe(0);
+});
+
+test("element access after a resizable buffer shrinks", () => {
+    var buffer = new ArrayBuffer(16, { maxByteLength: 32 });
+    var a = new Uint8Array(buffer, 0, 8);
+    a[7] = 42;
+    expect(a[7]).toBe(42);
+    buffer.resize(4);
+    expect(a[7]).toBeUndefined();
+    expect(a[0]).toBeUndefined();
+    a[0] = 1;
+    buffer.resize(16);
+    expect(a[0]).toBe(0);
+});
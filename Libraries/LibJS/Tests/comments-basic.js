@@ -12,6 +12,19 @@ i;`;
     expect(source).toEvalTo(1);
 });
 
+test("long line comments", () => {
+    const source = `
+var i = 0;
+// ${"i++; ".repeat(100)}
+// ${"i++; ".repeat(100)}\u00e9 i++; ${"i++; ".repeat(100)}
+// ${"i++; ".repeat(100)}\u2028 i++;
+// ${"i++; ".repeat(100)}\u2029 i++;
+// ${"i++; ".repeat(100)}\r i++;
+i;`;
+
+    expect(source).toEvalTo(3);
+});
+
 test("html comments", () => {
     const source = `
 var i = 0;
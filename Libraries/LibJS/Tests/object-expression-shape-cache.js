@@ -0,0 +1,52 @@
+test("objects created by the same literal get the same properties in order", () => {
+    const make = (a, b, c) => ({ a, b, c });
+    for (let i = 0; i < 10; ++i) {
+        const o = make(i, i + 1, i + 2);
+        expect(Object.keys(o)).toEqual(["a", "b", "c"]);
+        expect(o.a).toBe(i);
+        expect(o.b).toBe(i + 1);
+        expect(o.c).toBe(i + 2);
+    }
+});
+
+test("properties are still writable, enumerable and configurable", () => {
+    for (let i = 0; i < 3; ++i) {
+        const o = { x: 1, y: 2 };
+        const descriptor = Object.getOwnPropertyDescriptor(o, "y");
+        expect(descriptor.writable).toBeTrue();
+        expect(descriptor.enumerable).toBeTrue();
+        expect(descriptor.configurable).toBeTrue();
+        o.y = 3;
+        delete o.x;
+        expect(Object.keys(o)).toEqual(["y"]);
+        expect(o.y).toBe(3);
+    }
+});
+
+test("values are evaluated in order", () => {
+    let x = 0;
+    for (let i = 0; i < 3; ++i) {
+        const o = { first: x, second: ++x, third: x++ };
+        expect(o.first).toBe(o.second - 1);
+        expect(o.second).toBe(o.third);
+    }
+});
+
+test("anonymous functions are named after their property", () => {
+    for (let i = 0; i < 3; ++i) {
+        const o = { foo: function () {}, bar: () => {} };
+        expect(o.foo.name).toBe("foo");
+        expect(o.bar.name).toBe("bar");
+    }
+});
+
+test("mutating one object does not affect the next one", () => {
+    const objects = [];
+    for (let i = 0; i < 3; ++i) {
+        const o = { a: i, b: i };
+        o.c = i;
+        objects.push(o);
+    }
+    expect(Object.keys(objects[2])).toEqual(["a", "b", "c"]);
+    expect(objects[2].a).toBe(2);
+});
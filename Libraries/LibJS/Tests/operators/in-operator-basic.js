@@ -32,3 +32,27 @@ test("error when used with primitives", () => {
         }).toThrowWithMessage(TypeError, "'in' operator must be used on an object");
     });
 });
+
+test("in operator with a string literal in a loop", () => {
+    const has = o => "foo" in o;
+    const o = { foo: 1 };
+    const p = Object.create(o);
+
+    for (let i = 0; i < 3; ++i) {
+        expect(has(o)).toBeTrue();
+        expect(has(p)).toBeTrue();
+        expect(has({})).toBeFalse();
+    }
+
+    delete o.foo;
+    expect(has(o)).toBeFalse();
+    expect(has(p)).toBeFalse();
+
+    o.foo = 2;
+    expect(has(o)).toBeTrue();
+    expect(has(p)).toBeTrue();
+
+    expect(has(new Proxy({}, { has: () => true }))).toBeTrue();
+    expect(has(new Proxy({ foo: 1 }, { has: () => false }))).toBeFalse();
+    expect("0" in ["x"]).toBeTrue();
+});
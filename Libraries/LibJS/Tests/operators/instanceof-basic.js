@@ -34,3 +34,26 @@ test("issue #3930, instanceof on arrow function", () => {
         a instanceof a;
     }).toThrow(TypeError);
 });
+
+test("instanceof in a loop", () => {
+    function Foo() {}
+    const isFoo = value => value instanceof Foo;
+    const foo = new Foo();
+
+    for (let i = 0; i < 3; ++i) {
+        expect(isFoo(foo)).toBeTrue();
+        expect(isFoo({})).toBeFalse();
+        expect(isFoo(1)).toBeFalse();
+    }
+
+    Object.defineProperty(Foo, Symbol.hasInstance, { value: () => true });
+    expect(isFoo({})).toBeTrue();
+});
+
+test("target without @@hasInstance", () => {
+    function Foo() {}
+    const foo = new Foo();
+    Object.setPrototypeOf(Foo, null);
+    expect(foo instanceof Foo).toBeTrue();
+    expect({} instanceof Foo).toBeFalse();
+});
@@ -16,6 +16,11 @@ test("non-ascii escapes", () => {
     expect(foo.𝓑𝓻\u{1d4f8}𝔀𝓷).toBe(12389);
     expect(foo.\u{1d4d1}\u{1d4fb}\u{1d4f8}\u{1d500}\u{1d4f7}).toBe(12389);
 
+    foo.brown𝓑 = 1;
+    foo.brown\u{1d4d1} = 2;
+    expect(foo.brown).toBe(12389);
+    expect(foo.brown𝓑).toBe(2);
+
     // U-16 High surrogate pair is allowed in string but not in identifier.
     expect("foo.𝓑𝓻\ud835\udcf8𝔀𝓷").toEval();
     expect("foo.𝓑𝓻\\ud835\\udcf8𝔀𝓷").not.toEval();
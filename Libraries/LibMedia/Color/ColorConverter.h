@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/SIMDExtras.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/Matrix4x4.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
@@ -154,96 +155,137 @@ public:
     template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
     static ALWAYS_INLINE Gfx::Color convert_simple_yuv_to_rgb(T y_in, T u_in, T v_in)
     {
-        static constexpr i32 bit_depth = 8;
-        static constexpr i32 maximum_value = (1 << bit_depth) - 1;
-        static constexpr i32 one = 1 << 14;
-        static constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
-            auto temp = static_cast<i64>(numerator) * one;
-            return static_cast<i32>(temp / denominator);
-        };
-        static constexpr auto coef = [](i32 hundred_thousandths) constexpr {
-            return fraction(hundred_thousandths, 100'000);
-        };
-        static constexpr auto multiply = [](i32 a, i32 b) constexpr {
-            return (a * b) / one;
-        };
+        constexpr auto factors = simple_yuv_to_rgb_factors<MC, FR>();
 
-        struct RangeFactors {
-            i32 y_offset, y_scale;
-            i32 uv_offset, uv_scale;
-        };
+        i32 y = (y_in + factors.y_offset) * factors.y_scale;
+        i32 u = u_in + factors.uv_offset;
+        i32 v = v_in + factors.uv_offset;
 
-        constexpr auto range_factors = [] {
-            RangeFactors range_factors;
+        i32 red = y + v * factors.red_v;
+        i32 green = y + u * factors.green_u + v * factors.green_v;
+        i32 blue = y + u * factors.blue_u;
 
-            i32 min = 0;
-            i32 y_max = 255;
-            i32 uv_max = 255;
+        red = clamp(red, 0, factors.maximum);
+        green = clamp(green, 0, factors.maximum);
+        blue = clamp(blue, 0, factors.maximum);
 
-            if constexpr (FR == VideoFullRangeFlag::Studio) {
-                min = 16;
-                y_max = 235;
-                uv_max = 240;
-            }
+        return Gfx::Color(u8(red / factors.divisor), u8(green / factors.divisor), u8(blue / factors.divisor));
+    }
 
-            range_factors.y_offset = -min * maximum_value / 255;
-            range_factors.y_scale = fraction(255, y_max - min);
-            range_factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
-            range_factors.uv_scale = fraction(255, uv_max - min) * 2;
+    // Does the same as convert_simple_yuv_to_rgb() for each of the pixels in a row, several of them at a time.
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
+    static ALWAYS_INLINE void convert_simple_yuv_row_to_rgb(T const* __restrict__ y_row, T const* __restrict__ u_row, T const* __restrict__ v_row, Gfx::ARGB32* __restrict__ scan_line, size_t width)
+    {
+        using namespace AK::SIMD;
+        using InputVector = Conditional<IsSame<T, u8>, u8x4, u16x4>;
+
+        constexpr auto factors = simple_yuv_to_rgb_factors<MC, FR>();
+        // NOTE: The values are never negative once clamped, so the division can be done with a shift.
+        static_assert(factors.divisor == 1 << 14);
+
+        size_t column = 0;
+        for (; column + 4 <= width; column += 4) {
+            auto y = (to_i32x4(load_unaligned<InputVector>(y_row + column)) + factors.y_offset) * factors.y_scale;
+            auto u = to_i32x4(load_unaligned<InputVector>(u_row + column)) + factors.uv_offset;
+            auto v = to_i32x4(load_unaligned<InputVector>(v_row + column)) + factors.uv_offset;
+
+            auto red = y + v * factors.red_v;
+            auto green = y + u * factors.green_u + v * factors.green_v;
+            auto blue = y + u * factors.blue_u;
+
+            auto clamp_to_range = [&](i32x4 value) {
+                value = value < 0 ? 0 : value;
+                return value > factors.maximum ? factors.maximum : value;
+            };
+            red = clamp_to_range(red) >> 14;
+            green = clamp_to_range(green) >> 14;
+            blue = clamp_to_range(blue) >> 14;
+
+            auto pixels = bit_cast<u32x4>(red << 16 | green << 8 | blue) | 0xff000000;
+            store_unaligned(scan_line + column, pixels);
+        }
 
-            range_factors.y_scale = multiply(range_factors.y_scale, fraction(255, maximum_value));
-            range_factors.uv_scale = multiply(range_factors.uv_scale, fraction(255, maximum_value));
+        for (; column < width; column++)
+            scan_line[column] = convert_simple_yuv_to_rgb<MC, FR>(y_row[column], u_row[column], v_row[column]).value();
+    }
 
-            return range_factors;
-        }();
+private:
+    struct SimpleYUVToRGBFactors {
+        i32 y_offset;
+        i32 y_scale;
+        i32 uv_offset;
+        i32 red_v;
+        i32 green_u;
+        i32 green_v;
+        i32 blue_u;
+        i32 maximum;
+        i32 divisor;
+    };
+
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR>
+    static consteval SimpleYUVToRGBFactors simple_yuv_to_rgb_factors()
+    {
+        constexpr i32 bit_depth = 8;
+        constexpr i32 maximum_value = (1 << bit_depth) - 1;
+        constexpr i32 one = 1 << 14;
+        constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
+            auto temp = static_cast<i64>(numerator) * one;
+            return static_cast<i32>(temp / denominator);
+        };
+        constexpr auto coef = [fraction](i32 hundred_thousandths) constexpr {
+            return fraction(hundred_thousandths, 100'000);
+        };
+        constexpr auto multiply = [](i32 a, i32 b) constexpr {
+            return (a * b) / one;
+        };
 
-        i32 y = y_in + range_factors.y_offset;
-        i32 u = u_in + range_factors.uv_offset;
-        i32 v = v_in + range_factors.uv_offset;
+        i32 min = 0;
+        i32 y_max = 255;
+        i32 uv_max = 255;
 
-        i32 red;
-        i32 green;
-        i32 blue;
+        if constexpr (FR == VideoFullRangeFlag::Studio) {
+            min = 16;
+            y_max = 235;
+            uv_max = 240;
+        }
 
-        constexpr i32 y_scale = range_factors.y_scale;
-        constexpr i32 uv_scale = range_factors.uv_scale;
+        SimpleYUVToRGBFactors factors {};
+        factors.y_offset = -min * maximum_value / 255;
+        factors.y_scale = multiply(fraction(255, y_max - min), fraction(255, maximum_value));
+        factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
+        auto uv_scale = multiply(fraction(255, uv_max - min) * 2, fraction(255, maximum_value));
 
-        // The equations below will have the following effects:
+        // The equations using these factors will have the following effects:
         //  - Scale the Y, U and V values into the range 0...maximum_value*one for these fixed-point operations.
         //  - Scale the values by the color range defined by VideoFullRangeFlag.
         //  - Scale the U and V values by 2 to put them in the actual YCbCr coordinate space.
         //  - Multiply by the YCbCr coefficients to convert to RGB.
         if constexpr (MC == MatrixCoefficients::BT709) {
-            red = y * y_scale + v * multiply(coef(78740), uv_scale);
-            green = y * y_scale + u * multiply(coef(-9366), uv_scale) + v * multiply(coef(-23406), uv_scale);
-            blue = y * y_scale + u * multiply(coef(92780), uv_scale);
+            factors.red_v = multiply(coef(78740), uv_scale);
+            factors.green_u = multiply(coef(-9366), uv_scale);
+            factors.green_v = multiply(coef(-23406), uv_scale);
+            factors.blue_u = multiply(coef(92780), uv_scale);
         }
 
         if constexpr (MC == MatrixCoefficients::BT601) {
-            red = y * y_scale + v * multiply(coef(70100), uv_scale);
-            green = y * y_scale + u * multiply(coef(-17207), uv_scale) + v * multiply(coef(-35707), uv_scale);
-            blue = y * y_scale + u * multiply(coef(88600), uv_scale);
+            factors.red_v = multiply(coef(70100), uv_scale);
+            factors.green_u = multiply(coef(-17207), uv_scale);
+            factors.green_v = multiply(coef(-35707), uv_scale);
+            factors.blue_u = multiply(coef(88600), uv_scale);
         }
 
         if constexpr (MC == MatrixCoefficients::BT2020ConstantLuminance) {
-            red = y * y_scale + v * multiply(coef(73730), uv_scale);
-            green = y * y_scale + u * multiply(coef(-8228), uv_scale) + v * multiply(coef(-28568), uv_scale);
-            blue = y * y_scale + u * multiply(coef(94070), uv_scale);
+            factors.red_v = multiply(coef(73730), uv_scale);
+            factors.green_u = multiply(coef(-8228), uv_scale);
+            factors.green_v = multiply(coef(-28568), uv_scale);
+            factors.blue_u = multiply(coef(94070), uv_scale);
         }
 
-        red = clamp(red, 0, maximum_value * one);
-        green = clamp(green, 0, maximum_value * one);
-        blue = clamp(blue, 0, maximum_value * one);
-
-        // This compiles down to a bit shift if maximum_value == 255
-        red /= fraction(maximum_value, 255);
-        green /= fraction(maximum_value, 255);
-        blue /= fraction(maximum_value, 255);
-
-        return Gfx::Color(u8(red), u8(green), u8(blue));
+        factors.maximum = maximum_value * one;
+        factors.divisor = fraction(maximum_value, 255);
+        return factors;
     }
 
-private:
     static constexpr size_t to_linear_size = 64;
     static constexpr size_t to_non_linear_size = 64;
 
@@ -4,35 +4,193 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/ScopeGuard.h>
 #include <LibCore/System.h>
 #include <LibMedia/VideoFrame.h>
 
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
-{
-    while (*formats >= 0) {
-        switch (*formats) {
-        case AV_PIX_FMT_YUV420P:
-        case AV_PIX_FMT_YUV420P10:
-        case AV_PIX_FMT_YUV420P12:
-        case AV_PIX_FMT_YUV422P:
-        case AV_PIX_FMT_YUV422P10:
-        case AV_PIX_FMT_YUV422P12:
-        case AV_PIX_FMT_YUV444P:
-        case AV_PIX_FMT_YUV444P10:
-        case AV_PIX_FMT_YUV444P12:
-        case AV_PIX_FMT_YUVJ420P:
-        case AV_PIX_FMT_YUVJ422P:
-        case AV_PIX_FMT_YUVJ444P:
-            return *formats;
-        default:
+static bool is_supported_planar_format(int format)
+{
+    switch (format) {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUV420P10:
+    case AV_PIX_FMT_YUV420P12:
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUV422P10:
+    case AV_PIX_FMT_YUV422P12:
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUV444P10:
+    case AV_PIX_FMT_YUV444P12:
+    case AV_PIX_FMT_YUVJ420P:
+    case AV_PIX_FMT_YUVJ422P:
+    case AV_PIX_FMT_YUVJ444P:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// NOTE: Hardware decoders usually can only hand their frames back to us with the chroma samples interleaved into a single
+//       plane, so we accept those formats when downloading a frame from the GPU, and split the chroma plane up again
+//       when copying it out.
+static bool is_supported_semi_planar_format(int format)
+{
+    switch (format) {
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_P010:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static AVHWDeviceType hardware_device_type_of(AVCodecContext* codec_context)
+{
+    if (!codec_context->hw_device_ctx)
+        return AV_HWDEVICE_TYPE_NONE;
+    return reinterpret_cast<AVHWDeviceContext*>(codec_context->hw_device_ctx->data)->type;
+}
+
+static bool is_hardware_format_for_device(AVCodec const* codec, AVHWDeviceType device_type, AVPixelFormat format)
+{
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            return false;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 && config->device_type == device_type && config->pix_fmt == format)
+            return true;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    // NOTE: FFmpeg only offers the hardware format if the hardware is able to decode this particular stream, so if it is
+    //       missing, we fall back to decoding in software without having to do anything else.
+    auto device_type = hardware_device_type_of(codec_context);
+    if (device_type != AV_HWDEVICE_TYPE_NONE) {
+        for (auto const* format = formats; *format >= 0; format++) {
+            if (is_hardware_format_for_device(codec_context->codec, device_type, *format))
+                return *format;
+        }
+    }
+
+    for (auto const* format = formats; *format >= 0; format++) {
+        if (is_supported_planar_format(*format))
+            return *format;
+    }
+    return AV_PIX_FMT_NONE;
+}
+
+static ReadonlySpan<AVHWDeviceType> preferred_hardware_device_types()
+{
+#if defined(AK_OS_MACOS) || defined(AK_OS_IOS)
+    static constexpr Array device_types { AV_HWDEVICE_TYPE_VIDEOTOOLBOX };
+#elif defined(AK_OS_WINDOWS)
+    static constexpr Array device_types { AV_HWDEVICE_TYPE_D3D11VA };
+#elif defined(AK_OS_LINUX) || defined(AK_OS_BSD_GENERIC)
+    static constexpr Array device_types { AV_HWDEVICE_TYPE_VAAPI };
+#else
+    static constexpr Array<AVHWDeviceType, 0> device_types {};
+#endif
+    return device_types;
+}
+
+// Unless the LIBMEDIA_VIDEO_DECODING environment variable is set to "software", we let FFmpeg decode on the GPU when the
+// platform's video acceleration API supports the codec, which takes most of the load off of the CPU for large videos.
+static bool should_try_hardware_decoding()
+{
+    static bool const should_try_hardware_decoding = [] {
+        auto const* decoding = getenv("LIBMEDIA_VIDEO_DECODING");
+        return !decoding || StringView { decoding, strlen(decoding) } != "software"sv;
+    }();
+    return should_try_hardware_decoding;
+}
+
+static AVBufferRef* create_hardware_device_context(AVCodec const* codec)
+{
+    if (!should_try_hardware_decoding())
+        return nullptr;
+
+    for (auto device_type : preferred_hardware_device_types()) {
+        for (int i = 0;; i++) {
+            auto const* config = avcodec_get_hw_config(codec, i);
+            if (!config)
+                break;
+            if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0 || config->device_type != device_type)
+                continue;
+
+            // NOTE: This fails if there is no usable device, e.g. when there is no GPU, its driver doesn't support
+            //       video decoding, or we aren't allowed to open it. We then simply decode in software instead.
+            AVBufferRef* device_context = nullptr;
+            if (av_hwdevice_ctx_create(&device_context, device_type, nullptr, nullptr, 0) == 0)
+                return device_context;
             break;
         }
-        formats++;
+    }
+
+    return nullptr;
+}
+
+static void copy_plane(u8* destination, u8 const* source, int source_line_size, size_t line_size, size_t height)
+{
+    for (size_t row = 0; row < height; row++) {
+        memcpy(destination, source, line_size);
+        source += source_line_size;
+        destination += line_size;
+    }
+}
+
+// NOTE: P010 keeps its 10-bit samples in the most significant bits of each 16-bit component, while our frames expect
+//       them in the least significant bits.
+static void copy_msb_aligned_plane(u16* destination, u8 const* source, int source_line_size, size_t width, size_t height, u32 shift)
+{
+    for (size_t row = 0; row < height; row++) {
+        auto const* source_row = reinterpret_cast<u16 const*>(source);
+        for (size_t column = 0; column < width; column++)
+            destination[column] = source_row[column] >> shift;
+        source += source_line_size;
+        destination += width;
+    }
+}
+
+template<typename T>
+static void deinterleave_chroma_plane(T* u_destination, T* v_destination, u8 const* source, int source_line_size, size_t width, size_t height, u32 shift)
+{
+    for (size_t row = 0; row < height; row++) {
+        auto const* source_row = reinterpret_cast<T const*>(source);
+        for (size_t column = 0; column < width; column++) {
+            u_destination[column] = source_row[column * 2] >> shift;
+            v_destination[column] = source_row[column * 2 + 1] >> shift;
+        }
+        source += source_line_size;
+        u_destination += width;
+        v_destination += width;
+    }
+}
+
+static AVPixelFormat choose_download_format(AVFrame const* hardware_frame)
+{
+    AVPixelFormat* formats = nullptr;
+    if (av_hwframe_transfer_get_formats(hardware_frame->hw_frames_ctx, AV_HWFRAME_TRANSFER_DIRECTION_FROM, &formats, 0) < 0)
+        return AV_PIX_FMT_NONE;
+    ScopeGuard free_formats = [&] { av_freep(&formats); };
+
+    for (auto const* format = formats; *format >= 0; format++) {
+        if (is_supported_planar_format(*format))
+            return *format;
+    }
+    for (auto const* format = formats; *format >= 0; format++) {
+        if (is_supported_semi_planar_format(*format))
+            return *format;
     }
     return AV_PIX_FMT_NONE;
 }
@@ -42,11 +200,13 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* software_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&software_frame);
         }
     };
 
@@ -60,6 +220,7 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
     codec_context->get_format = negotiate_output_format;
+    codec_context->hw_device_ctx = create_hardware_device_context(codec);
 
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
@@ -86,14 +247,19 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    software_frame = av_frame_alloc();
+    if (!software_frame)
+        return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, software_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* software_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_software_frame(software_frame)
 {
 }
 
@@ -101,6 +267,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_software_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -136,11 +303,22 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
 
     switch (result) {
     case 0: {
-        auto color_primaries = static_cast<ColorPrimaries>(m_frame->color_primaries);
-        auto transfer_characteristics = static_cast<TransferCharacteristics>(m_frame->color_trc);
-        auto matrix_coefficients = static_cast<MatrixCoefficients>(m_frame->colorspace);
+        AVFrame const* decoded_frame = m_frame;
+        if (m_frame->hw_frames_ctx) {
+            av_frame_unref(m_software_frame);
+            m_software_frame->format = choose_download_format(m_frame);
+            if (m_software_frame->format == AV_PIX_FMT_NONE)
+                return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Hardware decoder cannot output a supported pixel format"sv);
+            if (av_hwframe_transfer_data(m_software_frame, m_frame, 0) < 0 || av_frame_copy_props(m_software_frame, m_frame) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to download a frame from the hardware decoder"sv);
+            decoded_frame = m_software_frame;
+        }
+
+        auto color_primaries = static_cast<ColorPrimaries>(decoded_frame->color_primaries);
+        auto transfer_characteristics = static_cast<TransferCharacteristics>(decoded_frame->color_trc);
+        auto matrix_coefficients = static_cast<MatrixCoefficients>(decoded_frame->colorspace);
         auto color_range = [&] {
-            switch (m_frame->format) {
+            switch (decoded_frame->format) {
             case AV_PIX_FMT_YUVJ420P:
             case AV_PIX_FMT_YUVJ422P:
             case AV_PIX_FMT_YUVJ444P:
@@ -149,7 +327,7 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 break;
             }
 
-            switch (m_frame->color_range) {
+            switch (decoded_frame->color_range) {
             case AVColorRange::AVCOL_RANGE_MPEG:
                 return VideoFullRangeFlag::Studio;
             case AVColorRange::AVCOL_RANGE_JPEG:
@@ -161,7 +339,8 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
 
         size_t bit_depth = [&] {
-            switch (m_frame->format) {
+            switch (decoded_frame->format) {
+            case AV_PIX_FMT_NV12:
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
@@ -169,6 +348,7 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             case AV_PIX_FMT_YUVJ422P:
             case AV_PIX_FMT_YUVJ444P:
                 return 8;
+            case AV_PIX_FMT_P010:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
@@ -183,7 +363,9 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         size_t component_size = (bit_depth + 7) / 8;
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (decoded_frame->format) {
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
@@ -205,32 +387,48 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             }
         }();
 
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
+        auto size = Gfx::Size<u32> { decoded_frame->width, decoded_frame->height };
 
-        auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
+        auto timestamp = AK::Duration::from_microseconds(decoded_frame->pts);
         auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
 
-        for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+        auto is_semi_planar = is_supported_semi_planar_format(decoded_frame->format);
+        auto source_plane_count = is_semi_planar ? 2u : 3u;
+        for (u32 plane = 0; plane < source_plane_count; plane++) {
+            VERIFY(decoded_frame->linesize[plane] != 0);
+            if (decoded_frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
 
             bool const use_subsampling = plane > 0;
             auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
 
             auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+            auto source_line_size = is_semi_planar && use_subsampling ? output_line_size * 2 : output_line_size;
+            VERIFY(source_line_size <= static_cast<size_t>(decoded_frame->linesize[plane]));
 
-            auto const* source = m_frame->data[plane];
+            auto const* source = decoded_frame->data[plane];
             VERIFY(source != nullptr);
-            auto* destination = frame->get_raw_plane_data(plane);
-            VERIFY(destination != nullptr);
 
-            for (size_t row = 0; row < plane_size.height(); row++) {
-                memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
-                destination += output_line_size;
+            if (!is_semi_planar) {
+                auto* destination = frame->get_raw_plane_data(plane);
+                VERIFY(destination != nullptr);
+                copy_plane(destination, source, decoded_frame->linesize[plane], output_line_size, plane_size.height());
+                continue;
             }
+
+            auto const shift = component_size == 1 ? 0u : static_cast<u32>(16 - bit_depth);
+            if (plane == 0) {
+                if (shift == 0)
+                    copy_plane(frame->get_raw_plane_data(0), source, decoded_frame->linesize[0], output_line_size, plane_size.height());
+                else
+                    copy_msb_aligned_plane(frame->get_plane_data<u16>(0), source, decoded_frame->linesize[0], plane_size.width(), plane_size.height(), shift);
+                continue;
+            }
+
+            if (component_size == 1)
+                deinterleave_chroma_plane(frame->get_plane_data<u8>(1), frame->get_plane_data<u8>(2), source, decoded_frame->linesize[1], plane_size.width(), plane_size.height(), shift);
+            else
+                deinterleave_chroma_plane(frame->get_plane_data<u16>(1), frame->get_plane_data<u16>(2), source, decoded_frame->linesize[1], plane_size.width(), plane_size.height(), shift);
         }
 
         return frame;
@@ -193,6 +193,27 @@ void PlaybackManager::restart_playback()
     seek_to_timestamp(AK::Duration::zero());
 }
 
+DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> PlaybackManager::acquire_frame_bitmap(Gfx::IntSize size)
+{
+    // OPTIMIZATION: Frame bitmaps are large, so rather than allocating a new one for every frame, we keep a reference to
+    //               the ones we hand out, and reuse a bitmap once ours is the only reference left to it. At that point,
+    //               everything the frame was given to is done with it, and nothing can get a new reference to it except
+    //               through us.
+    m_frame_bitmap_pool.remove_all_matching([&](auto const& bitmap) {
+        return bitmap->ref_count() == 1 && bitmap->size() != size;
+    });
+
+    for (auto& bitmap : m_frame_bitmap_pool) {
+        if (bitmap->ref_count() == 1 && bitmap->size() == size)
+            return bitmap;
+    }
+
+    auto bitmap = DECODER_TRY_ALLOC(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, size));
+    if (m_frame_bitmap_pool.size() < frame_bitmap_pool_capacity)
+        m_frame_bitmap_pool.unchecked_append(bitmap);
+    return bitmap;
+}
+
 void PlaybackManager::decode_and_queue_one_sample()
 {
 #if PLAYBACK_MANAGER_DEBUG
@@ -264,7 +285,11 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
 
-            auto bitmap_result = decoded_frame->to_bitmap();
+            auto bitmap_result = [&] -> DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> {
+                auto bitmap = TRY(acquire_frame_bitmap(decoded_frame->size().to_type<int>()));
+                TRY(decoded_frame->output_to_bitmap(bitmap));
+                return bitmap;
+            }();
 
             if (bitmap_result.is_error())
                 item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), decoded_frame->timestamp());
@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Queue.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
 #include <LibCore/SharedCircularQueue.h>
 #include <LibGfx/Bitmap.h>
 #include <LibMedia/Demuxer.h>
@@ -88,6 +89,9 @@ private:
 };
 
 static constexpr size_t frame_buffer_count = 4;
+// NOTE: Besides the frames in the queue, one frame is held as the next frame to present, one is held by whoever received
+//       it through on_video_frame, and one may still be referenced by the last thing that was painted.
+static constexpr size_t frame_bitmap_pool_capacity = frame_buffer_count + 3;
 using VideoFrameQueue = Core::SharedSingleProducerCircularQueue<FrameQueueItem, frame_buffer_count>;
 
 enum class PlaybackState {
@@ -162,6 +166,7 @@ private:
     void set_state_update_timer(int delay_ms);
 
     void decode_and_queue_one_sample();
+    DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> acquire_frame_bitmap(Gfx::IntSize);
 
     void dispatch_decoder_error(DecoderError error);
     void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
@@ -186,6 +191,8 @@ private:
     Threading::Mutex m_decode_wait_mutex;
     Threading::ConditionVariable m_decode_wait_condition;
     Atomic<bool> m_buffer_is_full { false };
+    // This is only used by the decode thread.
+    Vector<NonnullRefPtr<Gfx::Bitmap>, frame_bitmap_pool_capacity> m_frame_bitmap_pool;
 
     OwnPtr<PlaybackStateHandler> m_playback_handler;
     Optional<FrameQueueItem> m_next_frame;
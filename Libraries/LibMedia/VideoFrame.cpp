@@ -4,9 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/FixedArray.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibMedia/Color/ColorConverter.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 
 #include "VideoFrame.h"
 
@@ -108,31 +112,27 @@ ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plan
     }
 }
 
-template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename Convert>
-ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+// Converts the rows from first_row up to end_row. The first row must be a multiple of the vertical step, and so must the
+// end row unless it's the end of the frame. The temporary buffer must have room for four rows of chroma samples.
+template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename ConvertRow>
+ALWAYS_INLINE void convert_rows_subsampled(ConvertRow convert_row, u32 const width, u32 const height, u32 const first_row, u32 const end_row, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap, Span<T> temporary_buffer)
 {
-    VERIFY(bitmap.width() >= 0);
-    VERIFY(bitmap.height() >= 0);
-    VERIFY(static_cast<u32>(bitmap.width()) == width);
-    VERIFY(static_cast<u32>(bitmap.height()) == height);
-
-    auto temporary_buffer = DECODER_TRY_ALLOC(FixedArray<T>::create(static_cast<size_t>(width) * 4));
-
     // Above rows
-    auto* u_row_a = temporary_buffer.span().slice(static_cast<size_t>(width) * 0, width).data();
-    auto* v_row_a = temporary_buffer.span().slice(static_cast<size_t>(width) * 1, width).data();
+    auto* u_row_a = temporary_buffer.slice(static_cast<size_t>(width) * 0, width).data();
+    auto* v_row_a = temporary_buffer.slice(static_cast<size_t>(width) * 1, width).data();
 
     // Below rows
-    auto* u_row_b = temporary_buffer.span().slice(static_cast<size_t>(width) * 2, width).data();
-    auto* v_row_b = temporary_buffer.span().slice(static_cast<size_t>(width) * 3, width).data();
+    auto* u_row_b = temporary_buffer.slice(static_cast<size_t>(width) * 2, width).data();
+    auto* v_row_b = temporary_buffer.slice(static_cast<size_t>(width) * 3, width).data();
 
     u32 const vertical_step = 1 << subsampling_vertical;
 
-    interpolate_row<subsampling_horizontal>(0, width, plane_u, plane_v, u_row_a, v_row_a);
+    // The above rows start out as the below rows of the previous step, or the first chroma row for the first step.
+    auto const first_uv_row = first_row >> subsampling_vertical;
+    interpolate_row<subsampling_horizontal>(first_uv_row == 0 ? 0 : first_uv_row - 1, width, plane_u, plane_v, u_row_a, v_row_a);
 
     // Do interpolation for all inner rows.
-    u32 const rows_end = height - subsampling_vertical;
-    for (u32 row = 0; row < rows_end; row += vertical_step) {
+    for (u32 row = first_row; row < end_row; row += vertical_step) {
         // Horizontally scale the row if subsampled.
         auto uv_row = row >> subsampling_vertical;
         interpolate_row<subsampling_horizontal>(uv_row, width, plane_u, plane_v, u_row_b, v_row_b);
@@ -149,17 +149,10 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
         }
 
         auto const* y_row_a = &plane_y[static_cast<size_t>(row) * width];
-        auto* scan_line_a = bitmap.scanline(static_cast<int>(row));
-
-        for (size_t column = 0; column < width; column++) {
-            scan_line_a[column] = convert(y_row_a[column], u_row_a[column], v_row_a[column]).value();
-        }
+        convert_row(y_row_a, u_row_a, v_row_a, bitmap.scanline(static_cast<int>(row)), width);
         if constexpr (subsampling_vertical != 0) {
             auto const* y_row_b = &plane_y[static_cast<size_t>(row + 1) * width];
-            auto* scan_line_b = bitmap.scanline(static_cast<int>(row + 1));
-            for (size_t column = 0; column < width; column++) {
-                scan_line_b[column] = convert(y_row_b[column], u_row_b[column], v_row_b[column]).value();
-            }
+            convert_row(y_row_b, u_row_b, v_row_b, bitmap.scanline(static_cast<int>(row + 1)), width);
         }
 
         AK::TypedTransfer<RemoveReference<decltype(*u_row_a)>>::move(u_row_a, u_row_b, width);
@@ -168,14 +161,86 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
 
     if constexpr (subsampling_vertical != 0) {
         // If there is a final row that hasn't been set above, convert it now.
-        if ((height & 1) == 0) {
+        if (end_row == height - subsampling_vertical && (height & 1) == 0) {
             auto const* y_row = &plane_y[static_cast<size_t>(height - 1) * width];
-            auto* scan_line = bitmap.scanline(static_cast<int>(height - 1));
-            for (size_t column = 0; column < width; column++) {
-                scan_line[column] = convert(y_row[column], u_row_a[column], v_row_a[column]).value();
-            }
+            convert_row(y_row, u_row_a, v_row_a, bitmap.scanline(static_cast<int>(height - 1)), width);
         }
     }
+}
+
+// Runs the given callback once for each band, with the bands spread over the thread pool and the calling thread. Returns
+// once all of them have been run.
+static void for_each_band_in_parallel(size_t band_count, Function<void(size_t)> const& callback)
+{
+    struct State : public AtomicRefCounted<State> {
+        Function<void(size_t)> const* callback { nullptr };
+        size_t band_count { 0 };
+        Atomic<size_t> next_band { 0 };
+        Threading::Mutex mutex;
+        Threading::ConditionVariable condition { mutex };
+        size_t finished_band_count { 0 };
+    };
+    auto state = adopt_ref(*new State);
+    state->callback = &callback;
+    state->band_count = band_count;
+
+    auto run_bands = [](State& state) {
+        for (;;) {
+            auto band = state.next_band.fetch_add(1);
+            if (band >= state.band_count)
+                return;
+            (*state.callback)(band);
+
+            Threading::MutexLocker locker { state.mutex };
+            if (++state.finished_band_count == state.band_count)
+                state.condition.signal();
+        }
+    };
+
+    // NOTE: Workers that only get around to this once all bands have been claimed return right away, so the callback
+    //       is never called after we return. As the calling thread claims bands as well, we never wait for workers
+    //       that are busy with other work.
+    for (size_t i = 1; i < band_count; i++)
+        Threading::ThreadPool::the().enqueue([state, run_bands] { run_bands(*state); }, Threading::ThreadPool::Priority::High);
+    run_bands(*state);
+
+    Threading::MutexLocker locker { state->mutex };
+    state->condition.wait_while([&] { return state->finished_band_count < state->band_count; });
+}
+
+template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename ConvertRow>
+ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(ConvertRow convert_row, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+{
+    VERIFY(bitmap.width() >= 0);
+    VERIFY(bitmap.height() >= 0);
+    VERIFY(static_cast<u32>(bitmap.width()) == width);
+    VERIFY(static_cast<u32>(bitmap.height()) == height);
+
+    u32 const vertical_step = 1 << subsampling_vertical;
+    u32 const rows_end = height - subsampling_vertical;
+
+    // OPTIMIZATION: Large frames are split into bands of rows that are converted in parallel. Each band only has to
+    //               interpolate one chroma row from the band above it to start.
+    static constexpr size_t minimum_pixels_per_band = 256 * 1024;
+    auto band_count = min<size_t>(static_cast<size_t>(width) * height / minimum_pixels_per_band, Threading::ThreadPool::the().worker_count());
+    u32 const row_step_count = ceil_div(rows_end, vertical_step);
+    u32 const row_steps_per_band = max(ceil_div(row_step_count, static_cast<u32>(max<size_t>(band_count, 1))), 1u);
+    band_count = max(ceil_div(row_step_count, row_steps_per_band), 1u);
+    u32 const rows_per_band = row_steps_per_band * vertical_step;
+
+    auto temporary_buffer = DECODER_TRY_ALLOC(FixedArray<T>::create(static_cast<size_t>(width) * 4 * band_count));
+
+    auto convert_band = [&](size_t band) {
+        auto first_row = static_cast<u32>(band) * rows_per_band;
+        auto end_row = min(first_row + rows_per_band, rows_end);
+        auto band_buffer = temporary_buffer.span().slice(static_cast<size_t>(width) * 4 * band, static_cast<size_t>(width) * 4);
+        convert_rows_subsampled<subsampling_horizontal, subsampling_vertical>(convert_row, width, height, first_row, end_row, plane_y, plane_u, plane_v, bitmap, band_buffer);
+    };
+
+    if (band_count == 1)
+        convert_band(0);
+    else
+        for_each_band_in_parallel(band_count, [&](size_t band) { convert_band(band); });
 
     return {};
 }
@@ -189,20 +254,40 @@ static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(
 
     constexpr auto output_cicp = CodingIndependentCodePoints(ColorPrimaries::BT709, TransferCharacteristics::SRGB, MatrixCoefficients::BT709, VideoFullRangeFlag::Full);
 
-    if (bit_depth == 8 && cicp.transfer_characteristics() == output_cicp.transfer_characteristics() && cicp.color_primaries() == output_cicp.color_primaries() && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
+    auto const can_use_simple_conversion = bit_depth == 8
+        && cicp.transfer_characteristics() == output_cicp.transfer_characteristics()
+        && cicp.color_primaries() == output_cicp.color_primaries();
+
+    if (can_use_simple_conversion && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
         switch (cicp.matrix_coefficients()) {
         case MatrixCoefficients::BT470BG:
         case MatrixCoefficients::BT601:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_row_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio, T>, width, height, plane_y, plane_u, plane_v, bitmap);
         case MatrixCoefficients::BT709:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_row_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio, T>, width, height, plane_y, plane_u, plane_v, bitmap);
+        default:
+            break;
+        }
+    }
+
+    if (can_use_simple_conversion && cicp.video_full_range_flag() == VideoFullRangeFlag::Full) {
+        switch (cicp.matrix_coefficients()) {
+        case MatrixCoefficients::BT470BG:
+        case MatrixCoefficients::BT601:
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_row_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Full, T>, width, height, plane_y, plane_u, plane_v, bitmap);
+        case MatrixCoefficients::BT709:
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_row_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Full, T>, width, height, plane_y, plane_u, plane_v, bitmap);
         default:
             break;
         }
     }
 
     auto converter = TRY(ColorConverter::create(bit_depth, cicp, output_cicp));
-    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([&](T y, T u, T v) { return converter.convert_yuv(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+    auto convert_row = [&](T const* y_row, T const* u_row, T const* v_row, Gfx::ARGB32* scan_line, size_t pixel_count) {
+        for (size_t column = 0; column < pixel_count; column++)
+            scan_line[column] = converter.convert_yuv(y_row[column], u_row[column], v_row[column]).value();
+    };
+    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(convert_row, width, height, plane_y, plane_u, plane_v, bitmap);
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical>
@@ -7,6 +7,7 @@
 #include "RegexByteCode.h"
 #include "RegexDebug.h"
 
+#include <AK/Atomic.h>
 #include <AK/BinarySearch.h>
 #include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
@@ -160,38 +161,51 @@ static bool restore_string_position(MatchInput const& input, MatchState& state)
 }
 
 OwnPtr<OpCode> ByteCode::s_opcodes[(size_t)OpCodeId::Last + 1];
-bool ByteCode::s_opcodes_initialized { false };
-size_t ByteCode::s_next_checkpoint_serial_id { 0 };
-static u32 s_next_string_table_serial { 0 };
+
+// NOTE: Patterns may be parsed on more than one thread at once (e.g. as part of parsing a script in the background),
+//       so the serials are either atomic or per thread.
+static Atomic<u32> s_next_string_table_serial { 0 };
+static thread_local size_t s_next_checkpoint_serial_id { 0 };
 
 StringTable::StringTable()
-    : m_serial(s_next_string_table_serial++)
+    : m_serial(s_next_string_table_serial.fetch_add(1, AK::memory_order_relaxed))
 {
 }
 
 StringTable::~StringTable()
 {
-    if (m_serial == s_next_string_table_serial - 1 && m_table.is_empty())
-        --s_next_string_table_serial; // We didn't use this serial, put it back.
+    // We didn't use this serial, put it back if nobody else has taken one since.
+    if (auto expected_serial = m_serial + 1; m_table.is_empty())
+        s_next_string_table_serial.compare_exchange_strong(expected_serial, m_serial, AK::memory_order_relaxed);
+}
+
+void ByteCode::reset_checkpoint_serial_id()
+{
+    s_next_checkpoint_serial_id = 0;
+}
+
+size_t ByteCode::allocate_checkpoint_serial_id()
+{
+    return s_next_checkpoint_serial_id++;
 }
 
 void ByteCode::ensure_opcodes_initialized()
 {
-    if (s_opcodes_initialized)
-        return;
-    for (u32 i = (u32)OpCodeId::First; i <= (u32)OpCodeId::Last; ++i) {
-        switch ((OpCodeId)i) {
-#define __ENUMERATE_OPCODE(OpCode)              \
-    case OpCodeId::OpCode:                      \
-        s_opcodes[i] = make<OpCode_##OpCode>(); \
+    [[maybe_unused]] static bool const initialized = [] {
+        for (u32 i = (u32)OpCodeId::First; i <= (u32)OpCodeId::Last; ++i) {
+            switch ((OpCodeId)i) {
+#define __ENUMERATE_OPCODE(OpCode)                  \
+    case OpCodeId::OpCode:                          \
+        s_opcodes[i] = make<OpCode_##OpCode>();     \
         break;
 
-            ENUMERATE_OPCODES
+                ENUMERATE_OPCODES
 
 #undef __ENUMERATE_OPCODE
+            }
         }
-    }
-    s_opcodes_initialized = true;
+        return true;
+    }();
 }
 
 ALWAYS_INLINE ExecutionResult OpCode_Exit::execute(MatchInput const& input, MatchState& state) const
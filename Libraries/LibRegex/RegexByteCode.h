@@ -488,7 +488,7 @@ public:
             // JUMP_NONEMPTY _C _START FORK
 
             // Note: This is only safe because REPEAT will leave one iteration outside (see repetition_n)
-            auto checkpoint = s_next_checkpoint_serial_id++;
+            auto checkpoint = allocate_checkpoint_serial_id();
             new_bytecode.insert(new_bytecode.size() - bytecode_to_repeat.size(), (ByteCodeValueType)OpCodeId::Checkpoint);
             new_bytecode.insert(new_bytecode.size() - bytecode_to_repeat.size(), (ByteCodeValueType)checkpoint);
 
@@ -533,7 +533,7 @@ public:
         // REGEXP
         // JUMP_NONEMPTY _C _START FORKSTAY (FORKJUMP -> Greedy)
 
-        auto checkpoint = s_next_checkpoint_serial_id++;
+        auto checkpoint = allocate_checkpoint_serial_id();
         bytecode_to_repeat.prepend((ByteCodeValueType)checkpoint);
         bytecode_to_repeat.prepend((ByteCodeValueType)OpCodeId::Checkpoint);
 
@@ -566,7 +566,7 @@ public:
 
         bytecode.empend(bytecode_to_repeat.size() + 2 + 4); // Jump to the _END label
 
-        auto checkpoint = s_next_checkpoint_serial_id++;
+        auto checkpoint = allocate_checkpoint_serial_id();
         bytecode.empend(static_cast<ByteCodeValueType>(OpCodeId::Checkpoint));
         bytecode.empend(static_cast<ByteCodeValueType>(checkpoint));
 
@@ -603,7 +603,7 @@ public:
 
     OpCode& get_opcode(MatchState& state) const;
 
-    static void reset_checkpoint_serial_id() { s_next_checkpoint_serial_id = 0; }
+    static void reset_checkpoint_serial_id();
 
 private:
     void insert_string(StringView view)
@@ -613,11 +613,10 @@ private:
             empend((ByteCodeValueType)view[i]);
     }
 
-    void ensure_opcodes_initialized();
+    static void ensure_opcodes_initialized();
     ALWAYS_INLINE OpCode& get_opcode_by_id(OpCodeId id) const;
     static OwnPtr<OpCode> s_opcodes[(size_t)OpCodeId::Last + 1];
-    static bool s_opcodes_initialized;
-    static size_t s_next_checkpoint_serial_id;
+    static size_t allocate_checkpoint_serial_id();
     StringTable m_string_table;
 };
 
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibRegex/RegexDFA.h>
+
+namespace regex {
+
+// Whether a Compare instruction only ever consumes a single character, and whether it does only depends on that character.
+static bool is_single_character_compare(ByteCode const& bytecode, size_t position)
+{
+    auto argument_count = bytecode.at(position + 1);
+    size_t offset = position + 3;
+    for (size_t i = 0; i < argument_count; ++i) {
+        switch (static_cast<CharacterCompareType>(bytecode.at(offset++))) {
+        case CharacterCompareType::Inverse:
+        case CharacterCompareType::TemporaryInverse:
+        case CharacterCompareType::AnyChar:
+        case CharacterCompareType::And:
+        case CharacterCompareType::Or:
+        case CharacterCompareType::EndAndOr:
+            break;
+        case CharacterCompareType::Char:
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+            ++offset;
+            break;
+        case CharacterCompareType::LookupTable: {
+            auto sensitive_count = bytecode.at(offset++);
+            auto insensitive_count = bytecode.at(offset++);
+            offset += sensitive_count + insensitive_count;
+            break;
+        }
+        case CharacterCompareType::Undefined:
+        case CharacterCompareType::String:
+        case CharacterCompareType::Reference:
+        case CharacterCompareType::RangeExpressionDummy:
+            return false;
+        }
+    }
+    return true;
+}
+
+Optional<NFA> NFA::from_bytecode(ByteCode const& bytecode)
+{
+    struct Edge {
+        size_t node;
+        bool is_alternative;
+        size_t target_position;
+    };
+
+    NFA nfa;
+    HashMap<size_t, u32> node_for_position;
+    Vector<Edge> edges;
+
+    auto bytecode_size = bytecode.size();
+    auto state = MatchState::only_for_enumeration();
+
+    auto append_node = [&](Node node) {
+        nfa.nodes.append(node);
+        return nfa.nodes.size() - 1;
+    };
+    auto jump_target = [&](size_t next_position, ssize_t offset) -> Optional<size_t> {
+        auto target = static_cast<ssize_t>(next_position) + offset;
+        if (target < 0)
+            return {};
+        return static_cast<size_t>(target);
+    };
+
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        auto position = state.instruction_position;
+        auto next_position = position + opcode.size();
+        node_for_position.set(position, nfa.nodes.size());
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            if (bytecode.at(position + 1) == 1 && static_cast<CharacterCompareType>(bytecode.at(position + 3)) == CharacterCompareType::String) {
+                // NOTE: Strings are consumed a character at a time, and are only compared here as-is. Patterns whose
+                //       strings aren't ASCII may be compared differently depending on the input, so those are left to the VM.
+                auto length = bytecode.at(position + 4);
+                if (length == 0) {
+                    edges.append({ append_node({ .kind = Node::Kind::Jump }), false, next_position });
+                    break;
+                }
+                for (size_t i = 0; i < length; ++i) {
+                    auto character = bytecode.at(position + 5 + i);
+                    if (character >= 0x80)
+                        return {};
+                    auto node = append_node({ .kind = Node::Kind::Character, .code_unit = static_cast<u32>(character) });
+                    if (i + 1 < length)
+                        nfa.nodes[node].next = node + 1;
+                    else
+                        edges.append({ node, false, next_position });
+                }
+                nfa.has_characters = true;
+                break;
+            }
+            if (!is_single_character_compare(bytecode, position))
+                return {};
+            edges.append({ append_node({ .kind = Node::Kind::Compare, .bytecode_position = position }), false, next_position });
+            break;
+        }
+        case OpCodeId::Jump: {
+            auto target = jump_target(next_position, static_cast<OpCode_Jump const&>(opcode).offset());
+            if (!target.has_value())
+                return {};
+            edges.append({ append_node({ .kind = Node::Kind::Jump }), false, *target });
+            break;
+        }
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump: {
+            auto target = jump_target(next_position, static_cast<OpCode_ForkJump const&>(opcode).offset());
+            if (!target.has_value())
+                return {};
+            auto node = append_node({ .kind = Node::Kind::Fork });
+            edges.append({ node, false, next_position });
+            edges.append({ node, true, *target });
+            break;
+        }
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay: {
+            auto target = jump_target(next_position, static_cast<OpCode_ForkStay const&>(opcode).offset());
+            if (!target.has_value())
+                return {};
+            auto node = append_node({ .kind = Node::Kind::Fork });
+            edges.append({ node, false, next_position });
+            edges.append({ node, true, *target });
+            break;
+        }
+        case OpCodeId::JumpNonEmpty: {
+            // NOTE: This only stops loops from going around again without having consumed anything, which wouldn't
+            //       reach any new position in the NFA anyway, so it can always go either way here.
+            auto& jump = static_cast<OpCode_JumpNonEmpty const&>(opcode);
+            switch (jump.form()) {
+            case OpCodeId::Jump:
+            case OpCodeId::ForkJump:
+            case OpCodeId::ForkStay:
+            case OpCodeId::ForkReplaceJump:
+            case OpCodeId::ForkReplaceStay:
+                break;
+            default:
+                return {};
+            }
+            auto target = jump_target(next_position, jump.offset());
+            if (!target.has_value())
+                return {};
+            auto node = append_node({ .kind = Node::Kind::Fork });
+            edges.append({ node, false, next_position });
+            edges.append({ node, true, *target });
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+            edges.append({ append_node({ .kind = Node::Kind::Jump }), false, next_position });
+            break;
+        case OpCodeId::CheckBegin:
+            edges.append({ append_node({ .kind = Node::Kind::CheckBegin }), false, next_position });
+            break;
+        case OpCodeId::CheckEnd:
+            edges.append({ append_node({ .kind = Node::Kind::CheckEnd }), false, next_position });
+            break;
+        case OpCodeId::Exit:
+            // NOTE: Only running off the end of the bytecode succeeds, an Exit before that fails.
+            append_node({ .kind = Node::Kind::Fail });
+            break;
+        default:
+            return {};
+        }
+
+        state.instruction_position = next_position;
+    }
+
+    auto accept_node = append_node({ .kind = Node::Kind::Accept });
+
+    for (auto const& edge : edges) {
+        u32 target_node;
+        if (edge.target_position >= bytecode_size) {
+            target_node = accept_node;
+        } else if (auto node = node_for_position.get(edge.target_position); node.has_value()) {
+            target_node = *node;
+        } else {
+            // A jump into the middle of an instruction, which the VM wouldn't make sense of either.
+            return {};
+        }
+
+        if (edge.is_alternative)
+            nfa.nodes[edge.node].alternative = target_node;
+        else
+            nfa.nodes[edge.node].next = target_node;
+    }
+
+    return nfa;
+}
+
+LazyDFA::LazyDFA(NFA const& nfa, ByteCode const& bytecode, AllOptions options, Anchoring anchoring)
+    : m_nfa(nfa)
+    , m_bytecode(bytecode)
+    , m_options(options)
+    , m_anchoring(anchoring)
+    , m_accept_node(nfa.nodes.size() - 1)
+{
+    VERIFY(nfa.nodes[m_accept_node].kind == NFA::Node::Kind::Accept);
+}
+
+void LazyDFA::add_closure(Vector<u32>& nodes, Vector<bool>& seen, u32 node, bool is_at_start, bool is_at_end) const
+{
+    Vector<u32, 16> nodes_to_visit;
+    nodes_to_visit.append(node);
+
+    while (!nodes_to_visit.is_empty()) {
+        auto index = nodes_to_visit.take_last();
+        if (seen[index])
+            continue;
+        seen[index] = true;
+
+        auto const& current = m_nfa.nodes[index];
+        switch (current.kind) {
+        case NFA::Node::Kind::Compare:
+        case NFA::Node::Kind::Character:
+            // There's nothing left to consume at the end.
+            if (!is_at_end)
+                nodes.append(index);
+            break;
+        case NFA::Node::Kind::Jump:
+            nodes_to_visit.append(current.next);
+            break;
+        case NFA::Node::Kind::Fork:
+            nodes_to_visit.append(current.alternative);
+            nodes_to_visit.append(current.next);
+            break;
+        case NFA::Node::Kind::CheckBegin:
+            if (is_at_start)
+                nodes_to_visit.append(current.next);
+            break;
+        case NFA::Node::Kind::CheckEnd:
+            // NOTE: Without knowing yet whether this is the end, the thread waits here until the end is reached.
+            if (is_at_end)
+                nodes_to_visit.append(current.next);
+            else
+                nodes.append(index);
+            break;
+        case NFA::Node::Kind::Accept:
+            nodes.append(index);
+            break;
+        case NFA::Node::Kind::Fail:
+            break;
+        }
+    }
+}
+
+Optional<u32> LazyDFA::state_for(Vector<u32> nodes)
+{
+    quick_sort(nodes);
+    if (auto id = m_state_ids.get(nodes); id.has_value())
+        return *id;
+
+    if (m_states.size() >= max_state_count) {
+        // NOTE: Patterns that need this many states would take too much memory, let the VM handle them.
+        m_has_given_up = true;
+        return {};
+    }
+
+    u32 id = m_states.size();
+    State state;
+    state.is_accepting = nodes.contains_slow(m_accept_node);
+    state.nodes = nodes;
+    state.transitions.fill(no_state);
+    m_states.append(move(state));
+    m_state_ids.set(move(nodes), id);
+    return id;
+}
+
+Optional<u32> LazyDFA::start_state(size_t start_position)
+{
+    bool is_at_start = start_position == 0;
+    auto& start_state = m_start_states[is_at_start ? 0 : 1];
+    if (start_state != no_state)
+        return start_state;
+
+    Vector<u32> nodes;
+    Vector<bool> seen;
+    seen.resize(m_nfa.nodes.size());
+    add_closure(nodes, seen, 0, is_at_start, false);
+
+    auto state = state_for(move(nodes));
+    if (!state.has_value())
+        return {};
+    start_state = *state;
+    return start_state;
+}
+
+Optional<bool> LazyDFA::compare_matches(MatchInput const& input, size_t bytecode_position, size_t position) const
+{
+    auto state = MatchState::only_for_enumeration();
+    state.instruction_position = bytecode_position;
+    state.string_position = position;
+    state.string_position_in_code_units = position;
+
+    auto& opcode = m_bytecode.get_opcode(state);
+    if (opcode.execute(input, state) != ExecutionResult::Continue)
+        return false;
+
+    // Every transition consumes exactly one character, anything else is for the VM to deal with.
+    if (state.string_position != position + 1)
+        return {};
+    return true;
+}
+
+Optional<u32> LazyDFA::transition(MatchInput const& input, u32 state_id, size_t position)
+{
+    auto character = input.view.unicode_aware_code_point_at(position);
+    if (character < cached_transition_count) {
+        if (auto next = m_states[state_id].transitions[character]; next != no_state)
+            return next;
+    } else if (auto next = m_states[state_id].other_transitions.get(character); next.has_value()) {
+        return *next;
+    }
+
+    Vector<u32> nodes;
+    Vector<bool> seen;
+    seen.resize(m_nfa.nodes.size());
+
+    for (auto index : m_states[state_id].nodes) {
+        auto const& node = m_nfa.nodes[index];
+        switch (node.kind) {
+        case NFA::Node::Kind::Character:
+            if (character == node.code_unit)
+                add_closure(nodes, seen, node.next, false, false);
+            break;
+        case NFA::Node::Kind::Compare: {
+            auto matches = compare_matches(input, node.bytecode_position, position);
+            if (!matches.has_value()) {
+                m_has_given_up = true;
+                return {};
+            }
+            if (*matches)
+                add_closure(nodes, seen, node.next, false, false);
+            break;
+        }
+        default:
+            // Threads waiting for the end die here, and accepting ones are done.
+            break;
+        }
+    }
+
+    if (m_anchoring == Anchoring::Anywhere)
+        add_closure(nodes, seen, 0, false, false);
+
+    auto next = state_for(move(nodes));
+    if (!next.has_value())
+        return {};
+
+    if (character < cached_transition_count)
+        m_states[state_id].transitions[character] = *next;
+    else
+        m_states[state_id].other_transitions.set(character, *next);
+    return *next;
+}
+
+bool LazyDFA::accepts_at_end(State const& state, bool is_at_start) const
+{
+    if (state.is_accepting)
+        return true;
+
+    Vector<u32> nodes;
+    Vector<bool> seen;
+    seen.resize(m_nfa.nodes.size());
+    for (auto index : state.nodes) {
+        if (m_nfa.nodes[index].kind == NFA::Node::Kind::CheckEnd)
+            add_closure(nodes, seen, m_nfa.nodes[index].next, is_at_start, true);
+    }
+    return nodes.contains_slow(m_accept_node);
+}
+
+Optional<bool> LazyDFA::matches(MatchInput const& input, size_t start_position)
+{
+    if (m_has_given_up)
+        return {};
+
+    auto length = input.view.length();
+    if (start_position > length)
+        return false;
+
+    auto state = start_state(start_position);
+    if (!state.has_value())
+        return {};
+
+    for (auto position = start_position; position < length; ++position) {
+        auto const& current = m_states[*state];
+        if (current.is_accepting)
+            return true;
+        if (current.nodes.is_empty())
+            return false;
+
+        state = transition(input, *state, position);
+        if (!state.has_value())
+            return {};
+    }
+
+    return accepts_at_end(m_states[*state], length == 0);
+}
+
+}
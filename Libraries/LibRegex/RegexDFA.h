@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibRegex/RegexByteCode.h>
+#include <LibRegex/RegexMatch.h>
+
+namespace regex {
+
+// The bytecode of a pattern as a plain NFA, for patterns where whether a thread of the VM can go on only depends on where
+// it is in the bytecode and in the input: no backreferences, lookaround, word boundaries or counted repetition.
+// Capture groups are ignored, as all it's used for is finding out whether the pattern matches at all.
+struct REGEX_API NFA {
+    struct Node {
+        enum class Kind : u8 {
+            // Consumes a character if the Compare instruction at bytecode_position accepts it.
+            Compare,
+            // Consumes a character if it's code_unit, for the characters of String compares.
+            Character,
+            Jump,
+            Fork,
+            CheckBegin,
+            CheckEnd,
+            Accept,
+            Fail,
+        };
+
+        Kind kind { Kind::Fail };
+        u32 code_unit { 0 };
+        size_t bytecode_position { 0 };
+        u32 next { 0 };
+        u32 alternative { 0 };
+    };
+
+    static Optional<NFA> from_bytecode(ByteCode const&);
+
+    // NOTE: Matching starts at the first node.
+    Vector<Node> nodes;
+    bool has_characters { false };
+};
+
+// Runs an NFA as a DFA whose states are only built once some input needs them. Each state remembers where it goes on
+// every character it's seen, so scanning an input is mostly one lookup per character, rather than interpreting every
+// compare that could apply and restarting the VM at every position.
+class REGEX_API LazyDFA {
+public:
+    enum class Anchoring : u8 {
+        AtStartPosition,
+        Anywhere,
+    };
+
+    LazyDFA(NFA const&, ByteCode const&, AllOptions, Anchoring);
+
+    // Returns whether the pattern matches at the start position (or anywhere after it, unless anchored), or nothing if
+    // the input needs something a DFA can't do, in which case the VM has to find out instead.
+    Optional<bool> matches(MatchInput const&, size_t start_position);
+
+    AllOptions options() const { return m_options; }
+
+private:
+    static constexpr size_t max_state_count = 1024;
+    static constexpr u32 cached_transition_count = 256;
+    static constexpr u32 no_state = NumericLimits<u32>::max();
+
+    struct NodeSetTraits : DefaultTraits<Vector<u32>> {
+        static unsigned hash(Vector<u32> const& nodes)
+        {
+            unsigned hash = 0;
+            for (auto node : nodes)
+                hash = pair_int_hash(hash, node);
+            return hash;
+        }
+        static bool equals(Vector<u32> const& a, Vector<u32> const& b) { return a == b; }
+    };
+
+    struct State {
+        // The nodes that threads are waiting at, i.e. the ones that consume characters, check for the end, or accept.
+        Vector<u32> nodes;
+        bool is_accepting { false };
+        Array<u32, cached_transition_count> transitions;
+        HashMap<u32, u32> other_transitions;
+    };
+
+    void add_closure(Vector<u32>& nodes, Vector<bool>& seen, u32 node, bool is_at_start, bool is_at_end) const;
+    Optional<u32> state_for(Vector<u32> nodes);
+    Optional<u32> start_state(size_t start_position);
+    Optional<u32> transition(MatchInput const&, u32 state, size_t position);
+    Optional<bool> compare_matches(MatchInput const&, size_t bytecode_position, size_t position) const;
+    bool accepts_at_end(State const&, bool is_at_start) const;
+
+    NFA const& m_nfa;
+    ByteCode const& m_bytecode;
+    AllOptions m_options;
+    Anchoring m_anchoring;
+    u32 m_accept_node { 0 };
+
+    Vector<State> m_states;
+    HashMap<Vector<u32>, u32, NodeSetTraits> m_state_ids;
+    Array<u32, 2> m_start_states { no_state, no_state };
+    bool m_has_given_up { false };
+};
+
+}
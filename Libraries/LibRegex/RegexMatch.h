@@ -51,6 +51,9 @@ public:
         return m_view.get<Utf16View>();
     }
 
+    bool is_u16_view() const { return m_view.has<Utf16View>(); }
+    StringView string_view() const { return m_view.get<StringView>(); }
+
     bool unicode() const { return m_unicode; }
     void set_unicode(bool unicode) { m_unicode = unicode; }
 
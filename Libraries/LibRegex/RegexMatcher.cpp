@@ -8,6 +8,7 @@
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -63,12 +64,22 @@ static void cache_parse_result(regex::Parser::Result const& result, CacheKey<Par
     s_cached_bytecode_size<Parser> += bytecode_size;
 }
 
+template<class Parser>
+static Optional<regex::Parser::Result> cached_parse_result(CacheKey<Parser> const& key)
+{
+    // NOTE: Entries that are used are moved to the back, so that the least recently used ones are evicted first.
+    auto result = s_parser_cache<Parser>.take(key);
+    if (result.has_value())
+        s_parser_cache<Parser>.set(key, *result);
+    return result;
+}
+
 template<class Parser>
 Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
     : pattern_value(move(pattern))
 {
-    if (auto cache_entry = s_parser_cache<Parser>.get({ pattern_value, regex_options }); cache_entry.has_value()) {
-        parser_result = cache_entry.value();
+    if (auto cache_entry = cached_parse_result<Parser>({ pattern_value, regex_options }); cache_entry.has_value()) {
+        parser_result = cache_entry.release_value();
     } else {
         regex::Lexer lexer(pattern_value);
 
@@ -91,8 +102,22 @@ Regex<Parser>::Regex(regex::Parser::Result parse_result, ByteString pattern, typ
     : pattern_value(move(pattern))
     , parser_result(move(parse_result))
 {
-    parser_result.bytecode.flatten();
-    run_optimization_passes();
+    // OPTIMIZATION: Patterns that were parsed ahead of time (e.g. regex literals) are evaluated over and over again, so
+    //               only optimize them the first time around.
+    Optional<regex::Parser::Result> cache_entry;
+    if (parser_result.error == regex::Error::NoError)
+        cache_entry = cached_parse_result<Parser>({ pattern_value, regex_options });
+
+    if (cache_entry.has_value()) {
+        parser_result = cache_entry.release_value();
+    } else {
+        parser_result.bytecode.flatten();
+        run_optimization_passes();
+
+        if (parser_result.error == regex::Error::NoError)
+            cache_parse_result<Parser>(parser_result, { pattern_value, regex_options });
+    }
+
     if (parser_result.error == regex::Error::NoError)
         matcher = make<Matcher<Parser>>(this, regex_options | static_cast<decltype(regex_options.value())>(parser_result.options.value()));
 }
@@ -157,6 +182,250 @@ RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename Parse
     return match(views, regex_options);
 }
 
+template<typename Parser>
+bool Matcher<Parser>::has_match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
+{
+    MatchInput input;
+    input.view = view;
+    input.view.set_unicode(false);
+    input.regex_options = m_regex_options | regex_options.value_or({}).value();
+
+    // OPTIMIZATION: When looking for a match anywhere in the input, the DFA can tell whether there is one by itself, and
+    //               nobody cares where it is.
+    bool continue_search = input.regex_options.has_flag_set(AllFlags::Global) && !input.regex_options.has_flag_set(AllFlags::Sticky);
+    if (continue_search && !input.regex_options.has_flag_set(AllFlags::Internal_Stateful) && !input.regex_options.has_flag_set(AllFlags::Unicode) && !input.regex_options.has_flag_set(AllFlags::UnicodeSets)) {
+        auto anchoring = m_pattern->parser_result.optimization_data.only_start_of_line ? LazyDFA::Anchoring::AtStartPosition : LazyDFA::Anchoring::Anywhere;
+        if (auto matches = match_with_dfa(input, 0, anchoring); matches.has_value()) {
+            m_pattern->start_offset = 0;
+            return *matches;
+        }
+    }
+
+    return match(view, regex_options).success;
+}
+
+template<typename Parser>
+Optional<bool> Matcher<Parser>::match_with_dfa(MatchInput const& input, size_t start_position, LazyDFA::Anchoring anchoring) const
+{
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    if (!optimization_data.nfa.has_value())
+        return {};
+
+    // NOTE: The DFA goes through the input a code unit at a time, and only knows about line boundaries at the very start
+    //       and end of it.
+    auto const& options = input.regex_options;
+    if (input.view.unicode() || options.has_flag_set(AllFlags::Multiline) || options.has_flag_set(AllFlags::MatchNotBeginOfLine) || options.has_flag_set(AllFlags::MatchNotEndOfLine))
+        return {};
+    if (optimization_data.nfa->has_characters && options.has_flag_set(AllFlags::Insensitive))
+        return {};
+
+    auto& dfa = m_dfas[to_underlying(anchoring)];
+    if (!dfa || dfa->options().value() != options.value())
+        dfa = make<LazyDFA>(*optimization_data.nfa, m_pattern->parser_result.bytecode, options, anchoring);
+    return dfa->matches(input, start_position);
+}
+
+template<typename CodeUnit>
+static Optional<size_t> find_code_unit(ReadonlySpan<CodeUnit> haystack, CodeUnit needle, size_t start)
+{
+    if (start >= haystack.size())
+        return {};
+
+    if constexpr (sizeof(CodeUnit) == 1) {
+        // NOTE: memchr is vectorized by every libc we run on.
+        auto const* found = static_cast<CodeUnit const*>(__builtin_memchr(haystack.data() + start, needle, haystack.size() - start));
+        if (!found)
+            return {};
+        return found - haystack.data();
+    } else {
+        using AK::SIMD::u16x8;
+        auto needles = u16x8 {} + static_cast<u16>(needle);
+
+        size_t index = start;
+        for (; index + 8 <= haystack.size(); index += 8) {
+            auto code_units = AK::SIMD::load_unaligned<u16x8>(haystack.data() + index);
+            auto matches = bit_cast<AK::SIMD::u64x2>(code_units == needles);
+            if ((matches[0] | matches[1]) != 0)
+                break;
+        }
+        for (; index < haystack.size(); ++index) {
+            if (haystack[index] == needle)
+                return index;
+        }
+        return {};
+    }
+}
+
+template<typename CodeUnit>
+static Optional<size_t> find_ascii_string(ReadonlySpan<CodeUnit> haystack, StringView needle, size_t start)
+{
+    VERIFY(!needle.is_empty());
+    if (needle.length() > haystack.size())
+        return {};
+
+    auto candidates = haystack.trim(haystack.size() - needle.length() + 1);
+    for (;;) {
+        auto candidate = find_code_unit(candidates, static_cast<CodeUnit>(needle[0]), start);
+        if (!candidate.has_value())
+            return {};
+
+        bool matches = true;
+        for (size_t i = 1; i < needle.length(); ++i) {
+            if (haystack[*candidate + i] != static_cast<CodeUnit>(needle[i])) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            return candidate;
+        start = *candidate + 1;
+    }
+}
+
+// Returns the code unit offset of the first place at or after start where the view contains the given ASCII string.
+static Optional<size_t> find_ascii_string(RegexStringView const& view, StringView needle, size_t start)
+{
+    if (!view.is_u16_view()) {
+        auto string = view.string_view();
+        return find_ascii_string(ReadonlySpan<char> { string.characters_without_null_termination(), string.length() }, needle, start);
+    }
+
+    auto const& u16_view = view.u16_view();
+    if (u16_view.has_ascii_storage())
+        return find_ascii_string(u16_view.ascii_span(), needle, start);
+    return find_ascii_string(u16_view.utf16_span(), needle, start);
+}
+
+template<typename T>
+class BumpAllocatedLinkedList {
+public:
+    BumpAllocatedLinkedList() = default;
+
+    ALWAYS_INLINE void append(T value)
+    {
+        Node* node_ptr;
+        if (m_first_free) {
+            node_ptr = m_first_free;
+            m_first_free = node_ptr->next;
+            node_ptr->value = move(value);
+            node_ptr->next = nullptr;
+        } else {
+            node_ptr = m_allocator.allocate(move(value));
+            VERIFY(node_ptr);
+        }
+
+        if (!m_first) {
+            m_first = node_ptr;
+            m_last = node_ptr;
+            return;
+        }
+
+        node_ptr->previous = m_last;
+        m_last->next = node_ptr;
+        m_last = node_ptr;
+    }
+
+    ALWAYS_INLINE T take_last()
+    {
+        VERIFY(m_last);
+        T value = move(m_last->value);
+        auto* node = m_last;
+        if (m_last == m_first) {
+            m_last = nullptr;
+            m_first = nullptr;
+        } else {
+            m_last = m_last->previous;
+            m_last->next = nullptr;
+        }
+        free_node(node);
+        return value;
+    }
+
+    // NOTE: The nodes are kept around to be reused by later appends.
+    void clear()
+    {
+        while (m_last) {
+            auto* node = m_last;
+            m_last = node->previous;
+            [[maybe_unused]] auto value = move(node->value);
+            free_node(node);
+        }
+        m_first = nullptr;
+    }
+
+    ALWAYS_INLINE T& last()
+    {
+        return m_last->value;
+    }
+
+    ALWAYS_INLINE bool is_empty() const
+    {
+        return m_first == nullptr;
+    }
+
+    auto reverse_begin() { return ReverseIterator(m_last); }
+    auto reverse_end() { return ReverseIterator(); }
+
+private:
+    struct Node {
+        T value;
+        Node* next { nullptr };
+        Node* previous { nullptr };
+    };
+
+    ALWAYS_INLINE void free_node(Node* node)
+    {
+        node->previous = nullptr;
+        node->next = m_first_free;
+        m_first_free = node;
+    }
+
+    struct ReverseIterator {
+        ReverseIterator() = default;
+        explicit ReverseIterator(Node* node)
+            : m_node(node)
+        {
+        }
+
+        T* operator->() { return &m_node->value; }
+        T& operator*() { return m_node->value; }
+        bool operator==(ReverseIterator const& it) const { return m_node == it.m_node; }
+        ReverseIterator& operator++()
+        {
+            if (m_node)
+                m_node = m_node->previous;
+            return *this;
+        }
+
+    private:
+        Node* m_node;
+    };
+
+    UniformBumpAllocator<Node, true, 2 * MiB> m_allocator;
+    Node* m_first { nullptr };
+    Node* m_last { nullptr };
+    // Nodes whose values have been taken out, linked through their next pointers.
+    Node* m_first_free { nullptr };
+};
+
+struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
+    static constexpr unsigned hash(u64 value)
+    {
+        return (value >> 32) ^ value;
+    }
+};
+
+// The threads the VM still has to try and the ones it's already seen fail, kept for all the start positions of a match
+// so that their memory is only allocated once.
+struct BacktrackArena {
+    BumpAllocatedLinkedList<MatchState> states_to_try_next;
+    HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
+    // OPTIMIZATION: If failed threads stay failed, the ones seen at one start position don't need to be tried again at
+    //               the next, so they're only forgotten once something matched. That keeps patterns like (a|a)*b from
+    //               being retried from scratch at every position of a long input.
+    bool remember_failed_states { false };
+};
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -168,6 +437,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     MatchInput input;
     MatchState state { m_pattern->parser_result.capture_groups_count };
+    BacktrackArena arena;
+    arena.remember_failed_states = m_pattern->parser_result.optimization_data.failed_threads_stay_failed;
     size_t operations = 0;
 
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
@@ -211,6 +482,12 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // NOTE: The prefix is only compared as-is to code units, so it can't be looked for when the VM compares code points or
+    //       ignores case.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto skip_to_literal_prefix = continue_search && !only_start_of_line && !literal_prefix.is_empty()
+        && !input.regex_options.has_flag_set(AllFlags::Insensitive) && !unicode;
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -235,6 +512,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             continue;
         }
         input.view = view;
+        arena.seen_state_hashes.clear_with_capacity();
         dbgln_if(REGEX_DEBUG, "[match] Starting match with view ({}): _{}_", view.length(), view);
 
         auto view_length = view.length_in_code_units();
@@ -243,6 +521,14 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         state.string_position_in_code_units = view_index;
         bool succeeded = false;
 
+        // OPTIMIZATION: If the DFA can tell that the pattern doesn't match anywhere the VM would try it, don't bother
+        //               running the VM at every one of those positions.
+        if (views.size() == 1) {
+            auto anchoring = continue_search && !only_start_of_line ? LazyDFA::Anchoring::Anywhere : LazyDFA::Anchoring::AtStartPosition;
+            if (auto matches = match_with_dfa(input, view_index, anchoring); matches.has_value() && !*matches)
+                goto done_with_view;
+        }
+
         if (view_index == view_length && m_pattern->parser_result.match_length_minimum == 0) {
             // Run the code until it tries to consume something.
             // This allows non-consuming code to run on empty strings, for instance
@@ -255,7 +541,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            auto success = execute(input, state, temp_operations);
+            auto success = execute(input, state, arena, temp_operations);
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
             if (success && (state.string_position <= view_index)) {
                 operations = temp_operations;
@@ -288,6 +574,15 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            // OPTIMIZATION: Every match starts with the same string, so skip straight to where it occurs next rather than
+            //               trying to match at every position in between.
+            if (skip_to_literal_prefix) {
+                auto next_candidate = find_ascii_string(input.view, literal_prefix, view_index);
+                if (!next_candidate.has_value())
+                    break;
+                view_index = *next_candidate;
+            }
+
             auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
@@ -307,7 +602,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (execute(input, state, arena, operations)) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -352,6 +647,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                 break;
         }
 
+    done_with_view:
         ++input.line;
         input.global_offset += view.length() + 1; // +1 includes the line break character
 
@@ -394,99 +690,14 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     return result;
 }
 
-template<typename T>
-class BumpAllocatedLinkedList {
-public:
-    BumpAllocatedLinkedList() = default;
-
-    ALWAYS_INLINE void append(T value)
-    {
-        auto node_ptr = m_allocator.allocate(move(value));
-        VERIFY(node_ptr);
-
-        if (!m_first) {
-            m_first = node_ptr;
-            m_last = node_ptr;
-            return;
-        }
-
-        node_ptr->previous = m_last;
-        m_last->next = node_ptr;
-        m_last = node_ptr;
-    }
-
-    ALWAYS_INLINE T take_last()
-    {
-        VERIFY(m_last);
-        T value = move(m_last->value);
-        if (m_last == m_first) {
-            m_last = nullptr;
-            m_first = nullptr;
-        } else {
-            m_last = m_last->previous;
-            m_last->next = nullptr;
-        }
-        return value;
-    }
-
-    ALWAYS_INLINE T& last()
-    {
-        return m_last->value;
-    }
-
-    ALWAYS_INLINE bool is_empty() const
-    {
-        return m_first == nullptr;
-    }
-
-    auto reverse_begin() { return ReverseIterator(m_last); }
-    auto reverse_end() { return ReverseIterator(); }
-
-private:
-    struct Node {
-        T value;
-        Node* next { nullptr };
-        Node* previous { nullptr };
-    };
-
-    struct ReverseIterator {
-        ReverseIterator() = default;
-        explicit ReverseIterator(Node* node)
-            : m_node(node)
-        {
-        }
-
-        T* operator->() { return &m_node->value; }
-        T& operator*() { return m_node->value; }
-        bool operator==(ReverseIterator const& it) const { return m_node == it.m_node; }
-        ReverseIterator& operator++()
-        {
-            if (m_node)
-                m_node = m_node->previous;
-            return *this;
-        }
-
-    private:
-        Node* m_node;
-    };
-
-    UniformBumpAllocator<Node, true, 2 * MiB> m_allocator;
-    Node* m_first { nullptr };
-    Node* m_last { nullptr };
-};
-
-struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
-    static constexpr unsigned hash(u64 value)
-    {
-        return (value >> 32) ^ value;
-    }
-};
-
 template<class Parser>
-bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, BacktrackArena& arena, size_t& operations) const
 {
-    BumpAllocatedLinkedList<MatchState> states_to_try_next;
-    HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
+    auto& states_to_try_next = arena.states_to_try_next;
+    auto& seen_state_hashes = arena.seen_state_hashes;
+    states_to_try_next.clear();
+    if (!arena.remember_failed_states)
+        seen_state_hashes.clear_with_capacity();
 #if REGEX_DEBUG
     size_t recursion_level = 0;
 #endif
@@ -563,6 +774,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
         case ExecutionResult::Continue:
             continue;
         case ExecutionResult::Succeeded:
+            seen_state_hashes.clear_with_capacity();
             return true;
         case ExecutionResult::Failed: {
             bool found = false;
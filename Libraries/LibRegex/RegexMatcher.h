@@ -46,6 +46,8 @@ struct REGEX_API RegexResult final {
 template<class Parser>
 class REGEX_API Regex;
 
+struct BacktrackArena;
+
 template<class Parser>
 class REGEX_API Matcher final {
 
@@ -59,6 +61,7 @@ public:
 
     RegexResult match(RegexStringView, Optional<typename ParserTraits<Parser>::OptionsType> = {}) const;
     RegexResult match(Vector<RegexStringView> const&, Optional<typename ParserTraits<Parser>::OptionsType> = {}) const;
+    bool has_match(RegexStringView, Optional<typename ParserTraits<Parser>::OptionsType> = {}) const;
 
     typename ParserTraits<Parser>::OptionsType options() const
     {
@@ -68,13 +71,17 @@ public:
     void reset_pattern(Badge<Regex<Parser>>, Regex<Parser> const* pattern)
     {
         m_pattern = pattern;
+        for (auto& dfa : m_dfas)
+            dfa = nullptr;
     }
 
 private:
-    bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    bool execute(MatchInput const& input, MatchState& state, BacktrackArena&, size_t& operations) const;
+    Optional<bool> match_with_dfa(MatchInput const&, size_t start_position, LazyDFA::Anchoring) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+    mutable Array<OwnPtr<LazyDFA>, 2> m_dfas;
 };
 
 template<class Parser>
@@ -211,8 +218,7 @@ public:
     {
         if (!matcher || parser_result.error != Error::NoError)
             return false;
-        RegexResult result = matcher->match(view, AllOptions { regex_options.value_or({}) } | AllFlags::SkipSubExprResults);
-        return result.success;
+        return matcher->has_match(view, AllOptions { regex_options.value_or({}) } | AllFlags::SkipSubExprResults);
     }
 
     bool has_match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options = {}) const
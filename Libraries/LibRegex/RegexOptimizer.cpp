@@ -25,14 +25,100 @@ namespace regex {
 
 using Detail::Block;
 
+// Returns the ASCII string that the compares starting at the given position have to match one after the other, before
+// anything else can happen.
+static ByteString literal_prefix_at(ByteCode const& bytecode, size_t position, size_t end)
+{
+    StringBuilder builder;
+
+    auto append_code_unit = [&](ByteCodeValueType code_unit) {
+        if (code_unit >= 0x80)
+            return false;
+        builder.append(static_cast<char>(code_unit));
+        return true;
+    };
+
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = position; state.instruction_position < end;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            if (compare.arguments_count() != 1)
+                return builder.to_byte_string();
+
+            auto argument_position = state.instruction_position + 3;
+            auto compare_type = static_cast<CharacterCompareType>(bytecode.at(argument_position));
+            if (compare_type == CharacterCompareType::Char) {
+                if (!append_code_unit(bytecode.at(argument_position + 1)))
+                    return builder.to_byte_string();
+            } else if (compare_type == CharacterCompareType::String) {
+                auto length = bytecode.at(argument_position + 1);
+                for (size_t i = 0; i < length; ++i) {
+                    if (!append_code_unit(bytecode.at(argument_position + 2 + i)))
+                        return builder.to_byte_string();
+                }
+            } else {
+                return builder.to_byte_string();
+            }
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            // These do not 'match' anything, so look through them.
+            break;
+        default:
+            return builder.to_byte_string();
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    return builder.to_byte_string();
+}
+
+// Threads only depend on each other through backreferences, lookaround (which drops forks) and fork replacement.
+static bool failed_threads_stay_failed(ByteCode const& bytecode)
+{
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = 0; state.instruction_position < bytecode.size();) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            for (auto const& compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+                if (compare.type == CharacterCompareType::Reference)
+                    return false;
+            }
+            break;
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::FailForks:
+        case OpCodeId::PopSaved:
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+            return false;
+        default:
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+    return true;
+}
+
 template<typename Parser>
 void Regex<Parser>::run_optimization_passes()
 {
     rewrite_with_useless_jumps_removed();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
-    if (attempt_rewrite_entire_match_as_substring_search(blocks))
+    if (attempt_rewrite_entire_match_as_substring_search(blocks)) {
+        parser_result.optimization_data.literal_prefix = literal_prefix_at(parser_result.bytecode, 0, parser_result.bytecode.size());
+        parser_result.optimization_data.nfa = NFA::from_bytecode(parser_result.bytecode);
         return;
+    }
 
     // Rewrite fork loops as atomic groups
     // e.g. a*b -> (ATOMIC a*)b
@@ -41,6 +127,11 @@ void Regex<Parser>::run_optimization_passes()
     fill_optimization_data(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    parser_result.optimization_data.failed_threads_stay_failed = failed_threads_stay_failed(parser_result.bytecode);
+
+    // Patterns that can be matched without backtracking get a lazy DFA to find out whether they match at all.
+    parser_result.optimization_data.nfa = NFA::from_bytecode(parser_result.bytecode);
 }
 
 struct StaticallyInterpretedCompares {
@@ -211,6 +302,8 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
         auto& opcode = bytecode.get_opcode(state);
         switch (opcode.opcode_id()) {
         case OpCodeId::Compare: {
+            parser_result.optimization_data.literal_prefix = literal_prefix_at(bytecode, state.instruction_position, block.end);
+
             auto flat_compares = static_cast<OpCode_Compare const&>(opcode).flat_compares();
             StaticallyInterpretedCompares compares;
             if (!interpret_compares(flat_compares, compares))
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexDFA.h"
 #include "RegexError.h"
 #include "RegexLexer.h"
 #include "RegexOptions.h"
@@ -68,6 +69,13 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If not empty, every match starts with this ASCII string.
+            ByteString literal_prefix;
+            // Whether a thread of the VM that failed would fail again whenever it gets to the same state, so that it doesn't
+            // have to be tried again at later start positions.
+            bool failed_threads_stay_failed = false;
+            // If populated, whether the pattern matches can be found out without backtracking.
+            Optional<NFA> nfa;
         } optimization_data {};
     };
 
@@ -28,7 +28,7 @@ bool Request::stop()
     return m_client->stop_request({}, *this);
 }
 
-void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
+void Request::set_request_fd(Badge<Requests::RequestClient>, int fd, Optional<Core::AnonymousBuffer> body_buffer)
 {
     // If the request was stopped while this IPC was in-flight, just bail.
     if (!m_internal_stream_data)
@@ -38,10 +38,16 @@ void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
     m_fd = fd;
 
     auto notifier = Core::Notifier::construct(fd, Core::Notifier::Type::Read);
-    auto stream = MUST(Core::File::adopt_fd(fd, Core::File::OpenMode::Read));
     notifier->on_activation = move(m_internal_stream_data->read_notifier->on_activation);
     m_internal_stream_data->read_notifier = move(notifier);
-    m_internal_stream_data->read_stream = move(stream);
+
+    if (body_buffer.has_value()) {
+        m_internal_stream_data->body_ring_buffer = MUST(ResponseBodyRingBuffer::attach(body_buffer.release_value()));
+        m_internal_stream_data->doorbell = MUST(Core::File::adopt_fd(fd, Core::File::OpenMode::ReadWrite));
+        return;
+    }
+
+    m_internal_stream_data->read_stream = MUST(Core::File::adopt_fd(fd, Core::File::OpenMode::Read));
 }
 
 void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_buffered_request_finished)
@@ -137,7 +143,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         if (!m_internal_stream_data)
             return;
 
-        if (!m_internal_stream_data->user_finish_called && (!m_internal_stream_data->read_stream || m_internal_stream_data->read_stream->is_eof())) {
+        if (!m_internal_stream_data->user_finish_called && m_internal_stream_data->has_received_entire_body()) {
             m_internal_stream_data->user_finish_called = true;
             user_on_finish(m_internal_stream_data->total_size, m_internal_stream_data->timing_info, m_internal_stream_data->network_error);
         }
@@ -151,6 +157,11 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         if (!m_internal_stream_data)
             return;
 
+        if (m_internal_stream_data->body_ring_buffer.has_value()) {
+            read_from_body_ring_buffer(on_data_available, { buffer, buffer_size });
+            return;
+        }
+
         do {
             auto result = m_internal_stream_data->read_stream->read_some({ buffer, buffer_size });
             if (result.is_error() && (!result.error().is_errno() || (result.error().is_errno() && result.error().code() != EINTR)))
@@ -173,4 +184,52 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
     };
 }
 
+void Request::read_from_body_ring_buffer(DataReceived const& on_data_available, Bytes scratch_buffer)
+{
+    auto& body_ring_buffer = *m_internal_stream_data->body_ring_buffer;
+    auto& doorbell = *m_internal_stream_data->doorbell;
+
+    // Acknowledge every ring of the doorbell before reading, so that none of them can get lost while we're reading.
+    while (true) {
+        auto result = doorbell.read_some(scratch_buffer);
+        if (result.is_error() && result.error().is_errno() && result.error().code() == EINTR)
+            continue;
+        if (result.is_error() && result.error().is_errno() && result.error().code() == EAGAIN)
+            break;
+        if (result.is_error() || result.value().is_empty()) {
+            m_internal_stream_data->doorbell_closed = true;
+            break;
+        }
+    }
+
+    // NOTE: We hand out the bytes straight from shared memory, and only let RequestServer reuse that part of the buffer
+    //       once the callback is done with them.
+    do {
+        while (true) {
+            auto bytes = body_ring_buffer.readable_bytes();
+            if (bytes.is_empty())
+                break;
+
+            on_data_available(bytes);
+
+            // If the request was stopped while handling the data, just bail.
+            if (!m_internal_stream_data)
+                return;
+
+            body_ring_buffer.discard(bytes.size());
+
+            if (body_ring_buffer.should_ring_producer()) {
+                u8 ring = 0;
+                (void)doorbell.write_some({ &ring, 1 });
+            }
+        }
+    } while (!m_internal_stream_data->doorbell_closed && !body_ring_buffer.prepare_to_wait());
+
+    if (m_internal_stream_data->doorbell_closed)
+        m_internal_stream_data->read_notifier->close();
+
+    if (m_internal_stream_data->request_done)
+        m_internal_stream_data->on_finish();
+}
+
 }
@@ -12,10 +12,13 @@
 #include <AK/MemoryStream.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/File.h>
 #include <LibCore/Notifier.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <LibRequests/ResponseBodyRingBuffer.h>
 
 namespace Requests {
 
@@ -58,12 +61,13 @@ public:
     void did_request_certificates(Badge<RequestClient>);
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
-    void set_request_fd(Badge<RequestClient>, int fd);
+    void set_request_fd(Badge<RequestClient>, int fd, Optional<Core::AnonymousBuffer> body_buffer);
 
 private:
     explicit Request(RequestClient&, i32 request_id);
 
     void set_up_internal_stream_data(DataReceived on_data_available);
+    void read_from_body_ring_buffer(DataReceived const& on_data_available, Bytes scratch_buffer);
 
     WeakPtr<RequestClient> m_client;
     int m_request_id { -1 };
@@ -90,8 +94,20 @@ private:
     struct InternalStreamData {
         InternalStreamData() { }
 
+        bool has_received_entire_body() const
+        {
+            if (body_ring_buffer.has_value())
+                return doorbell_closed && body_ring_buffer->readable_bytes().is_empty();
+            return !read_stream || read_stream->is_eof();
+        }
+
         OwnPtr<Stream> read_stream;
         RefPtr<Core::Notifier> read_notifier;
+
+        // If RequestServer hands us the response body through shared memory, the fd is only used as its doorbell.
+        Optional<ResponseBodyRingBuffer> body_ring_buffer;
+        OwnPtr<Core::File> doorbell;
+        bool doorbell_closed { false };
         u32 total_size { 0 };
         Optional<NetworkError> network_error;
         bool request_done { false };
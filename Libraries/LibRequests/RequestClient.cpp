@@ -28,7 +28,7 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, Optional<ByteString> const& cache_partition, ::RequestServer::RequestPriority priority)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -37,13 +37,13 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data, cache_partition, priority);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
 }
 
-void RequestClient::request_started(i32 request_id, IPC::File response_file)
+void RequestClient::request_started(i32 request_id, IPC::File response_file, Optional<Core::AnonymousBuffer> body_buffer)
 {
     auto request = m_requests.get(request_id);
     if (!request.has_value()) {
@@ -52,7 +52,7 @@ void RequestClient::request_started(i32 request_id, IPC::File response_file)
     }
 
     auto response_fd = response_file.take_fd();
-    request.value()->set_request_fd({}, response_fd);
+    request.value()->set_request_fd({}, response_fd, move(body_buffer));
 }
 
 bool RequestClient::stop_request(Badge<Request>, Request& request)
@@ -111,11 +111,16 @@ void RequestClient::websocket_connected(i64 websocket_id)
         maybe_connection.value()->did_open({});
 }
 
-void RequestClient::websocket_received(i64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(i64 websocket_id, Vector<WebSocket::Message> messages)
 {
     auto maybe_connection = m_websockets.get(websocket_id);
-    if (maybe_connection.has_value())
-        maybe_connection.value()->did_receive({}, move(data), is_text);
+    if (!maybe_connection.has_value())
+        return;
+
+    // NOTE: Keep the connection alive, in case it gets closed while handling one of the messages.
+    auto connection = maybe_connection.value();
+    for (auto& message : messages)
+        connection->did_receive({}, move(message.data), message.is_text);
 }
 
 void RequestClient::websocket_errored(i64 websocket_id, i32 message)
@@ -30,7 +30,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, Optional<ByteString> const& cache_partition = {}, ::RequestServer::RequestPriority = ::RequestServer::RequestPriority::Medium);
 
     RefPtr<WebSocket> websocket_connect(const URL::URL&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
@@ -42,13 +42,13 @@ public:
 private:
     virtual void die() override;
 
-    virtual void request_started(i32, IPC::File) override;
+    virtual void request_started(i32, IPC::File, Optional<Core::AnonymousBuffer>) override;
     virtual void request_finished(i32, u64, RequestTimingInfo, Optional<NetworkError>) override;
     virtual void certificate_requested(i32) override;
     virtual void headers_became_available(i32, HTTP::HeaderMap, Optional<u32>, Optional<String>) override;
 
     virtual void websocket_connected(i64 websocket_id) override;
-    virtual void websocket_received(i64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_received(i64 websocket_id, Vector<WebSocket::Message>) override;
     virtual void websocket_errored(i64 websocket_id, i32) override;
     virtual void websocket_closed(i64 websocket_id, u16, ByteString, bool) override;
     virtual void websocket_ready_state_changed(i64 websocket_id, u32 ready_state) override;
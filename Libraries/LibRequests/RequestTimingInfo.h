@@ -24,6 +24,8 @@ struct RequestTimingInfo {
     long response_end_microseconds { 0 };
     long encoded_body_size { 0 };
     ALPNHttpVersion http_version_alpn_identifier { ALPNHttpVersion::None };
+    // NOTE: This is non-zero if the request was sent as TLS 1.3 early data on a resumed session.
+    long early_data_sent_bytes { 0 };
 };
 
 }
@@ -43,6 +45,7 @@ inline ErrorOr<void> encode(Encoder& encoder, Requests::RequestTimingInfo const&
     TRY(encoder.encode(timing_info.response_end_microseconds));
     TRY(encoder.encode(timing_info.encoded_body_size));
     TRY(encoder.encode(timing_info.http_version_alpn_identifier));
+    TRY(encoder.encode(timing_info.early_data_sent_bytes));
     return {};
 }
 
@@ -59,6 +62,7 @@ inline ErrorOr<Requests::RequestTimingInfo> decode(Decoder& decoder)
     auto response_end_microseconds = TRY(decoder.decode<long>());
     auto encoded_body_size = TRY(decoder.decode<long>());
     auto http_version_alpn_identifier = TRY(decoder.decode<Requests::ALPNHttpVersion>());
+    auto early_data_sent_bytes = TRY(decoder.decode<long>());
 
     return Requests::RequestTimingInfo {
         .domain_lookup_start_microseconds = domain_lookup_start_microseconds,
@@ -71,6 +75,7 @@ inline ErrorOr<Requests::RequestTimingInfo> decode(Decoder& decoder)
         .response_end_microseconds = response_end_microseconds,
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn_identifier,
+        .early_data_sent_bytes = early_data_sent_bytes,
     };
 }
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <AK/StdLibExtras.h>
+#include <LibCore/AnonymousBuffer.h>
+
+namespace Requests {
+
+// A single-producer, single-consumer ring buffer in shared memory, through which RequestServer hands response bodies
+// to its client without copying them through a pipe.
+//
+// The buffer itself carries no notifications. Each side keeps a socket (the "doorbell") next to it, and rings the other
+// side by writing a byte to it, but only if the other side has said that it is waiting for one. RequestServer closing
+// its end of the doorbell marks the end of the response body, just like closing the write end of a pipe would.
+class ResponseBodyRingBuffer {
+public:
+    static constexpr size_t default_capacity = 1 * MiB;
+
+    static ErrorOr<ResponseBodyRingBuffer> create(size_t capacity = default_capacity)
+    {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(data_offset + capacity));
+        new (buffer.data<void>()) Header {};
+        return ResponseBodyRingBuffer { move(buffer) };
+    }
+
+    static ErrorOr<ResponseBodyRingBuffer> attach(Core::AnonymousBuffer buffer)
+    {
+        if (!buffer.is_valid() || buffer.size() <= data_offset)
+            return Error::from_string_literal("Response body buffer is too small");
+        return ResponseBodyRingBuffer { move(buffer) };
+    }
+
+    Core::AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+    size_t capacity() const { return m_capacity; }
+
+    // Producer side: Copies as many bytes as fit into the buffer, and returns how many that were. If not all of them
+    // fit, the producer asks to be rung once the consumer has made room.
+    size_t write(ReadonlyBytes bytes)
+    {
+        auto& header = this->header();
+        auto write_position = header.write_position.load();
+
+        auto free_space = m_capacity - (write_position - header.read_position.load());
+        if (free_space < bytes.size()) {
+            header.producer_needs_doorbell.store(true);
+            free_space = m_capacity - (write_position - header.read_position.load());
+        }
+
+        auto count = min(free_space, bytes.size());
+        auto offset = write_position % m_capacity;
+        auto first_part = min(count, m_capacity - offset);
+        __builtin_memcpy(data() + offset, bytes.data(), first_part);
+        __builtin_memcpy(data(), bytes.data() + first_part, count - first_part);
+
+        header.write_position.store(write_position + count);
+        return count;
+    }
+
+    // Consumer side: Returns the longest contiguous run of bytes that can be read. They stay valid until discarded.
+    ReadonlyBytes readable_bytes() const
+    {
+        auto const& header = this->header();
+        auto read_position = header.read_position.load();
+        auto available = header.write_position.load() - read_position;
+
+        // NOTE: The positions live in memory the other process can write to, so don't trust them blindly.
+        if (available > m_capacity)
+            return {};
+
+        auto offset = read_position % m_capacity;
+        return { data() + offset, min(available, m_capacity - offset) };
+    }
+
+    void discard(size_t count)
+    {
+        auto& header = this->header();
+        header.read_position.store(header.read_position.load() + count);
+    }
+
+    // Consumer side: Asks to be rung once more data is written. Returns false if data arrived in the meantime, in which
+    // case the consumer should keep reading instead of waiting.
+    bool prepare_to_wait()
+    {
+        header().consumer_needs_doorbell.store(true);
+        return readable_bytes().is_empty();
+    }
+
+    bool should_ring_consumer() { return header().consumer_needs_doorbell.exchange(false); }
+    bool should_ring_producer() { return header().producer_needs_doorbell.exchange(false); }
+
+private:
+    // NOTE: Both processes access the positions concurrently, so every access is sequentially consistent. This way,
+    //       a side that asks to be rung and then re-checks the positions can't miss an update from the other side.
+    struct Header {
+        Atomic<u64> write_position { 0 };
+        Atomic<u64> read_position { 0 };
+        Atomic<bool> producer_needs_doorbell { false };
+        Atomic<bool> consumer_needs_doorbell { true };
+    };
+
+    static constexpr size_t data_offset = align_up_to(sizeof(Header), 64);
+
+    explicit ResponseBodyRingBuffer(Core::AnonymousBuffer buffer)
+        : m_buffer(move(buffer))
+        , m_capacity(m_buffer.size() - data_offset)
+    {
+    }
+
+    Header& header() { return *reinterpret_cast<Header*>(m_buffer.data<u8>()); }
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_buffer.data<u8>()); }
+
+    u8* data() { return m_buffer.data<u8>() + data_offset; }
+    u8 const* data() const { return m_buffer.data<u8>() + data_offset; }
+
+    Core::AnonymousBuffer m_buffer;
+    size_t m_capacity { 0 };
+};
+
+}
@@ -12,6 +12,8 @@
 #include <AK/Function.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 
 namespace Requests {
 
@@ -80,3 +82,27 @@ private:
 };
 
 }
+
+namespace IPC {
+
+template<>
+inline ErrorOr<void> encode(Encoder& encoder, Requests::WebSocket::Message const& message)
+{
+    TRY(encoder.encode(message.data));
+    TRY(encoder.encode(message.is_text));
+    return {};
+}
+
+template<>
+inline ErrorOr<Requests::WebSocket::Message> decode(Decoder& decoder)
+{
+    auto data = TRY(decoder.decode<ByteBuffer>());
+    auto is_text = TRY(decoder.decode<bool>());
+
+    return Requests::WebSocket::Message {
+        .data = move(data),
+        .is_text = is_text,
+    };
+}
+
+}
@@ -5,10 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/Promise.h>
 #include <LibCrypto/OpenSSL.h>
 #include <LibTLS/TLSv12.h>
+#include <LibThreading/MutexProtected.h>
 
 #ifdef AK_OS_WINDOWS
 #    include <AK/Windows.h>
@@ -23,6 +25,35 @@
 
 namespace TLS {
 
+// Sessions we can resume the next time we connect to a host, keyed by host name. Resuming a session skips the key
+// exchange and certificate verification, which saves a round trip (with TLS 1.2) and a fair bit of CPU time.
+static Threading::MutexProtected<HashMap<ByteString, SSL_SESSION*>> s_resumable_sessions;
+
+static int store_resumable_session(SSL* ssl, SSL_SESSION* session)
+{
+    auto const* host = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+    if (!host)
+        return 0;
+
+    s_resumable_sessions.with_locked([&](auto& sessions) {
+        if (auto previous_session = sessions.take(host); previous_session.has_value())
+            SSL_SESSION_free(*previous_session);
+        sessions.set(host, session);
+    });
+
+    // NOTE: Returning 1 tells OpenSSL that we've taken over its reference to the session.
+    return 1;
+}
+
+static SSL_SESSION* take_resumable_session(ByteString const& host)
+{
+    // NOTE: TLS 1.3 session tickets should only be used once (https://www.rfc-editor.org/rfc/rfc8446#appendix-C.4),
+    //       so we remove them from the cache. The server sends us new ones on every connection anyway.
+    return s_resumable_sessions.with_locked([&](auto& sessions) -> SSL_SESSION* {
+        return sessions.take(host).value_or(nullptr);
+    });
+}
+
 ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect(ByteString const& host, u16 port, Options options)
 {
     auto tcp_socket = TRY(Core::TCPSocket::connect(host, port));
@@ -228,6 +259,10 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPS
     // Require a minimum TLS version of TLSv1.2.
     OPENSSL_TRY(SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION));
 
+    // Learn about new sessions through a callback, since TLS 1.3 servers send their session tickets after the handshake.
+    SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ssl_ctx, store_resumable_session);
+
     auto* ssl = OPENSSL_TRY_PTR(SSL_new(ssl_ctx));
     ArmedScopeGuard free_ssl = [&] { SSL_free(ssl); };
 
@@ -237,6 +272,12 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPS
     // Ensure we check that the server has supplied a certificate for the hostname that we were expecting.
     OPENSSL_TRY(SSL_set1_host(ssl, host.characters()));
 
+    if (auto* session = take_resumable_session(host)) {
+        if (SSL_SESSION_is_resumable(session))
+            (void)SSL_set_session(ssl, session);
+        SSL_SESSION_free(session);
+    }
+
     auto* bio = OPENSSL_TRY_PTR(BIO_new_socket(socket->fd(), 0));
 
     // SSL takes ownership of the BIO and will handle freeing it
@@ -8,6 +8,8 @@
  */
 
 #include <AK/BinarySearch.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -352,6 +354,53 @@ ErrorOr<String> Decoder::to_utf8(StringView input)
     return builder.to_string_without_validation();
 }
 
+// Returns the number of ASCII bytes at the start of the input.
+static size_t length_of_ascii_run(ReadonlyBytes input)
+{
+    size_t index = 0;
+
+    // OPTIMIZATION: Look at sixteen bytes at a time until one of them has its most significant bit set.
+    using AK::SIMD::u8x16;
+    auto non_ascii_bytes = u8x16 {} + static_cast<u8>(0x80);
+    for (; index + 16 <= input.size(); index += 16) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(input.data() + index);
+        auto matches = bit_cast<AK::SIMD::u64x2>(chunk >= non_ascii_bytes);
+        if ((matches[0] | matches[1]) != 0)
+            break;
+    }
+
+    while (index < input.size() && input[index] < 0x80)
+        ++index;
+    return index;
+}
+
+// Decodes an encoding which maps every ASCII byte to itself, and every other byte to a single code point.
+template<typename Callback>
+static ErrorOr<String> decode_ascii_compatible_single_byte_encoding(StringView input, Callback code_point_for_non_ascii_byte)
+{
+    // OPTIMIZATION: Runs of ASCII bytes, which are the bulk of most documents, are copied over as they are, rather than
+    //               being decoded and encoded again one code point at a time.
+    auto bytes = input.bytes();
+
+    auto ascii_length = length_of_ascii_run(bytes);
+    if (ascii_length == bytes.size())
+        return String::from_utf8_without_validation(bytes);
+
+    StringBuilder builder(bytes.size());
+    while (!bytes.is_empty()) {
+        TRY(builder.try_append(StringView { bytes.trim(ascii_length) }));
+        bytes = bytes.slice(ascii_length);
+
+        while (!bytes.is_empty() && bytes[0] >= 0x80) {
+            TRY(builder.try_append_code_point(code_point_for_non_ascii_byte(bytes[0])));
+            bytes = bytes.slice(1);
+        }
+
+        ascii_length = length_of_ascii_run(bytes);
+    }
+    return builder.to_string_without_validation();
+}
+
 ErrorOr<void> UTF8Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -408,6 +457,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return String::from_latin1(input.bytes());
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -479,6 +533,13 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    return decode_ascii_compatible_single_byte_encoding(input, [](u8 byte) -> u32 {
+        return 0xF780 + byte - 0x80;
+    });
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +563,14 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_ascii_compatible_single_byte_encoding(input, [this](u8 byte) -> u32 {
+        return m_translation_table[byte - 0x80];
+    });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
@@ -59,6 +59,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -68,6 +69,7 @@ class Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class PDFDocEncodingDecoder final : public Decoder {
@@ -80,6 +82,7 @@ class XUserDefinedDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class GB18030Decoder final : public Decoder {
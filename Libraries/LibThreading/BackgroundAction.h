@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Function.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
@@ -31,7 +32,6 @@ private:
     BackgroundActionBase() = default;
 
     static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
 };
 
 template<typename Result>
@@ -50,9 +50,9 @@ public:
     Optional<Result> const& result() const { return m_result; }
     Optional<Result>& result() { return m_result; }
 
-    void cancel() { m_canceled = true; }
+    void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_release); }
     // If your action is long-running, you should periodically check the cancel state and possibly return early.
-    bool is_canceled() const { return m_canceled; }
+    bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_acquire); }
 
 private:
     BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {})
@@ -77,10 +77,12 @@ private:
             m_on_error = on_error.release_value();
 
         enqueue_work([self = NonnullRefPtr(*this), promise = move(promise), origin_event_loop = &Core::EventLoop::current()]() mutable {
-            auto result = self->m_action(*self);
+            // NOTE: If we were canceled before we got to run, there's no point in running at all.
+            auto result = self->m_canceled ? ErrorOr<Result> { Error::from_errno(ECANCELED) } : self->m_action(*self);
 
             // The event loop cancels the promise when it exits.
-            self->m_canceled |= promise->is_rejected();
+            if (promise->is_rejected())
+                self->m_canceled.store(true, AK::MemoryOrder::memory_order_release);
 
             // All of our work was successful and we weren't cancelled; resolve the event loop's promise.
             if (!self->m_canceled && !result.is_error()) {
@@ -120,7 +122,7 @@ private:
         dbgln("Error occurred while running a BackgroundAction: {}", error);
     };
     Optional<Result> m_result;
-    bool m_canceled { false };
+    Atomic<bool> m_canceled { false };
 };
 
 void quit_background_thread();
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <LibCore/System.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+static thread_local ThreadPool* s_current_pool = nullptr;
+static thread_local size_t s_current_worker_index = 0;
+
+ThreadPool& ThreadPool::the()
+{
+    // NOTE: This is intentionally leaked, so that we don't have to join the workers while the process is exiting.
+    static ThreadPool* s_the = new ThreadPool(clamp<size_t>(Core::System::hardware_concurrency(), 1, max_worker_count));
+    return *s_the;
+}
+
+ThreadPool::ThreadPool(size_t worker_count)
+    : m_worker_count(worker_count)
+{
+    VERIFY(m_worker_count > 0);
+}
+
+ThreadPool::~ThreadPool()
+{
+    shutdown();
+}
+
+NonnullRefPtr<ThreadPool::Job> ThreadPool::enqueue(Function<void()> work, Priority priority)
+{
+    auto job = adopt_ref(*new Job(move(work), priority));
+
+    MutexLocker locker(m_mutex);
+    if (m_workers.is_empty())
+        start_workers();
+
+    // Work enqueued by a worker is likely to use the same data the worker is already using, so it stays with that
+    // worker. Everything else is spread over all workers.
+    size_t worker_index = 0;
+    if (s_current_pool == this)
+        worker_index = s_current_worker_index;
+    else
+        worker_index = m_next_worker_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    auto& worker = *m_workers[worker_index];
+    {
+        MutexLocker worker_locker(worker.mutex);
+        worker.queues[to_underlying(priority)].append(job);
+    }
+
+    m_pending_job_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+    m_condition.signal();
+
+    return job;
+}
+
+void ThreadPool::shutdown()
+{
+    // NOTE: A worker can't wait for itself to exit.
+    VERIFY(s_current_pool != this);
+
+    {
+        MutexLocker locker(m_mutex);
+        if (m_workers.is_empty())
+            return;
+
+        m_should_run = false;
+        m_condition.broadcast();
+    }
+
+    for (auto& worker : m_workers)
+        MUST(worker->thread->join());
+
+    MutexLocker locker(m_mutex);
+    m_workers.clear();
+    m_pending_job_count.store(0, AK::MemoryOrder::memory_order_release);
+    m_should_run = true;
+}
+
+void ThreadPool::start_workers()
+{
+    VERIFY(m_workers.is_empty());
+    m_workers.ensure_capacity(m_worker_count);
+
+    for (size_t i = 0; i < m_worker_count; ++i)
+        m_workers.unchecked_append(make<Worker>());
+
+    // NOTE: The workers are only started once they're all in place, since they steal from each other.
+    for (size_t i = 0; i < m_worker_count; ++i) {
+        auto& worker = *m_workers[i];
+        worker.thread = Thread::construct([this, i] { return run_worker(i); }, "Background Worker"sv);
+        worker.thread->start();
+    }
+}
+
+intptr_t ThreadPool::run_worker(size_t worker_index)
+{
+    s_current_pool = this;
+    s_current_worker_index = worker_index;
+
+    while (true) {
+        {
+            MutexLocker locker(m_mutex);
+            m_condition.wait_while([&] {
+                return m_should_run && m_pending_job_count.load(AK::MemoryOrder::memory_order_acquire) == 0;
+            });
+            if (!m_should_run)
+                break;
+        }
+
+        // NOTE: Another worker may have taken the job we were woken up for, in which case we go back to sleep.
+        auto job = take_job(worker_index);
+        if (!job)
+            continue;
+        m_pending_job_count.fetch_sub(1, AK::MemoryOrder::memory_order_acq_rel);
+
+        if (job->is_canceled())
+            continue;
+
+        // NOTE: We release the work as soon as it ran, so that whatever it holds on to is released on this thread, and
+        //       not whenever the last reference to the job goes away.
+        auto work = move(job->m_work);
+        work();
+    }
+
+    s_current_pool = nullptr;
+    return 0;
+}
+
+RefPtr<ThreadPool::Job> ThreadPool::take_job(size_t worker_index)
+{
+    for (size_t priority = 0; priority < priority_count; ++priority) {
+        {
+            auto& worker = *m_workers[worker_index];
+            MutexLocker locker(worker.mutex);
+            if (auto& queue = worker.queues[priority]; !queue.is_empty())
+                return queue.take_last();
+        }
+
+        for (size_t offset = 1; offset < m_workers.size(); ++offset) {
+            auto& victim = *m_workers[(worker_index + offset) % m_workers.size()];
+            MutexLocker locker(victim.mutex);
+            if (auto& queue = victim.queues[priority]; !queue.is_empty())
+                return queue.take_first();
+        }
+    }
+
+    return nullptr;
+}
+
+}
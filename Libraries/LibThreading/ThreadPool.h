@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A pool of worker threads, one per core, for work that shouldn't block the event loop.
+//
+// Every worker has its own queue for each priority. Work enqueued from a worker goes onto that worker's own queue, which
+// the worker runs newest first, as it's most likely to still be in the cache. Workers that run out of work steal the
+// oldest work from other workers' queues, so no worker sits idle while there is work left to do.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    enum class Priority : u8 {
+        High,
+        Normal,
+        Low,
+    };
+    static constexpr size_t priority_count = 3;
+
+    static constexpr size_t max_worker_count = 16;
+
+    class Job : public AtomicRefCounted<Job> {
+    public:
+        // Work that hasn't started running by the time it's canceled will never run. Long-running work should check
+        // is_canceled() periodically and return early.
+        void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_release); }
+        bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_acquire); }
+
+        Priority priority() const { return m_priority; }
+
+    private:
+        friend class ThreadPool;
+
+        Job(Function<void()> work, Priority priority)
+            : m_work(move(work))
+            , m_priority(priority)
+        {
+        }
+
+        Function<void()> m_work;
+        Priority m_priority { Priority::Normal };
+        Atomic<bool> m_canceled { false };
+    };
+
+    static ThreadPool& the();
+
+    explicit ThreadPool(size_t worker_count);
+    ~ThreadPool();
+
+    NonnullRefPtr<Job> enqueue(ESCAPING Function<void()>, Priority = Priority::Normal);
+
+    // Stops all workers after they finish the work they're running, and drops all work that hasn't started yet. The
+    // workers start again when more work is enqueued.
+    void shutdown();
+
+    size_t worker_count() const { return m_worker_count; }
+
+private:
+    struct Worker {
+        Mutex mutex;
+        Array<Vector<NonnullRefPtr<Job>>, priority_count> queues;
+        RefPtr<Thread> thread;
+    };
+
+    void start_workers();
+    intptr_t run_worker(size_t worker_index);
+    RefPtr<Job> take_job(size_t worker_index);
+
+    size_t m_worker_count { 0 };
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Atomic<size_t> m_next_worker_index { 0 };
+
+    // NOTE: This only guards starting and stopping the workers, and putting idle workers to sleep. The queues are
+    //       guarded by their worker's own mutex.
+    Mutex m_mutex;
+    ConditionVariable m_condition { m_mutex };
+    Atomic<size_t> m_pending_job_count { 0 };
+    bool m_should_run { true };
+};
+
+}
@@ -718,11 +718,139 @@ static String remove_ascii_tab_or_newline(StringView input)
     return MUST(output.to_string());
 }
 
+static constexpr bool is_canonical_host_code_point(char code_point)
+{
+    return is_ascii_lower_alpha(code_point) || is_ascii_digit(code_point) || code_point == '-' || code_point == '.' || code_point == '_';
+}
+
+// NOTE: These are the printable ASCII code points that are neither in the respective percent-encode set, nor treated
+//       specially by the state the basic URL parser would be in when it reaches them.
+static constexpr bool is_canonical_path_code_point(char code_point)
+{
+    return code_point > ' ' && code_point < 0x7f && !"\"#<>?^`{}/\\"sv.contains(code_point);
+}
+
+static constexpr bool is_canonical_special_query_code_point(char code_point)
+{
+    return code_point > ' ' && code_point < 0x7f && !"\"#<>'"sv.contains(code_point);
+}
+
+static constexpr bool is_canonical_fragment_code_point(char code_point)
+{
+    return code_point > ' ' && code_point < 0x7f && !"\"<>`"sv.contains(code_point);
+}
+
+// OPTIMIZATION: Most URLs we parse are absolute http(s) URLs that are already in their serialized form, e.g. because they
+//               were serialized by us before. For those, the basic URL parser would produce a URL whose components are
+//               exactly the substrings of the input between the delimiters, but it would take a trip through its state
+//               machine (and a few string copies) for each code point to get there. This recognizes such input in a
+//               single pass, and returns an empty Optional for anything that needs the full parser.
+Optional<URL> Parser::parse_canonical_special_url(StringView input)
+{
+    static constexpr Array schemes { "https"sv, "http"sv, "wss"sv, "ws"sv };
+
+    StringView scheme;
+    for (auto candidate : schemes) {
+        if (input.starts_with(candidate) && input.substring_view(candidate.length()).starts_with("://"sv)) {
+            scheme = candidate;
+            break;
+        }
+    }
+    if (scheme.is_empty())
+        return {};
+
+    auto length = input.length();
+    auto index = scheme.length() + "://"sv.length();
+
+    // The host has to be an ASCII domain that domain to ASCII would leave untouched, and which doesn't look like an IPv4
+    // address.
+    auto host_start = index;
+    while (index < length && is_canonical_host_code_point(input[index]))
+        ++index;
+    auto host = input.substring_view(host_start, index - host_start);
+    if (host.is_empty() || ends_in_a_number_checker(host))
+        return {};
+    for (auto label : host.split_view('.')) {
+        if (label.starts_with("xn--"sv))
+            return {};
+    }
+
+    Optional<u16> port;
+    if (index < length && input[index] == ':') {
+        auto port_start = ++index;
+        while (index < length && is_ascii_digit(input[index]))
+            ++index;
+        auto port_value = input.substring_view(port_start, index - port_start).to_number<u16>();
+        if (!port_value.has_value())
+            return {};
+        if (port_value != default_port_for_scheme(scheme))
+            port = port_value;
+    }
+
+    auto is_at_end_of_component = [&](StringView delimiters) {
+        return index == length || delimiters.contains(input[index]);
+    };
+
+    Vector<String> paths;
+    if (index < length && input[index] == '/') {
+        while (index < length && input[index] == '/') {
+            auto segment_start = ++index;
+            while (index < length && is_canonical_path_code_point(input[index]))
+                ++index;
+
+            auto segment = input.substring_view(segment_start, index - segment_start);
+            if (is_single_dot_path_segment(segment) || is_double_dot_path_segment(segment))
+                return {};
+            paths.append(String::from_utf8_without_validation(segment.bytes()));
+        }
+    } else {
+        // NOTE: A special URL always has a path, so an empty one serializes to "/".
+        paths.append(String {});
+    }
+    if (!is_at_end_of_component("?#"sv))
+        return {};
+
+    Optional<String> query;
+    if (index < length && input[index] == '?') {
+        auto query_start = ++index;
+        while (index < length && is_canonical_special_query_code_point(input[index]))
+            ++index;
+        query = String::from_utf8_without_validation(input.substring_view(query_start, index - query_start).bytes());
+        if (!is_at_end_of_component("#"sv))
+            return {};
+    }
+
+    Optional<String> fragment;
+    if (index < length && input[index] == '#') {
+        auto fragment_start = ++index;
+        while (index < length && is_canonical_fragment_code_point(input[index]))
+            ++index;
+        fragment = String::from_utf8_without_validation(input.substring_view(fragment_start, index - fragment_start).bytes());
+    }
+    if (index != length)
+        return {};
+
+    URL url;
+    url.m_data->scheme = String::from_utf8_without_validation(scheme.bytes());
+    url.m_data->host = Host { String::from_utf8_without_validation(host.bytes()) };
+    url.m_data->port = port;
+    url.m_data->paths = move(paths);
+    url.m_data->query = move(query);
+    url.m_data->fragment = move(fragment);
+    return url;
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
     dbgln_if(URL_PARSER_DEBUG, "URL::Parser::basic_parse: Parsing '{}'", raw_input);
 
+    // NOTE: An absolute URL doesn't depend on the base URL, and the encoding only matters for non-ASCII input.
+    if (!url && !state_override.has_value()) {
+        if (auto canonical_url = parse_canonical_special_url(raw_input); canonical_url.has_value())
+            return canonical_url.release_value();
+    }
+
     size_t start_index = 0;
     size_t end_index = raw_input.length();
 
@@ -67,6 +67,9 @@ public:
     static void shorten_urls_path(URL&);
 
     static Optional<Host> parse_host(StringView input, bool is_opaque = false);
+
+private:
+    static Optional<URL> parse_canonical_special_url(StringView);
 };
 
 #undef ENUMERATE_STATES
@@ -24,6 +24,15 @@ struct TimeZoneOffset {
     InDST in_dst { InDST::No };
 };
 
+// The time between two transitions of a time zone, during which its offset doesn't change.
+struct TimeZoneOffsetInterval {
+    bool contains(UnixDateTime time) const { return time >= start && time < end; }
+
+    TimeZoneOffset offset;
+    UnixDateTime start; // Inclusive.
+    UnixDateTime end;   // Exclusive.
+};
+
 String current_time_zone();
 ErrorOr<void> set_current_time_zone(StringView);
 void clear_system_time_zone_cache();
@@ -31,6 +40,7 @@ Vector<String> const& available_time_zones();
 Vector<String> available_time_zones_in_region(StringView region);
 Optional<String> resolve_primary_time_zone(StringView time_zone);
 Optional<TimeZoneOffset> time_zone_offset(StringView time_zone, UnixDateTime time);
+Optional<TimeZoneOffsetInterval> time_zone_offset_interval(StringView time_zone, UnixDateTime time);
 Vector<TimeZoneOffset> disambiguated_time_zone_offsets(StringView time_zone, UnixDateTime time);
 
 }
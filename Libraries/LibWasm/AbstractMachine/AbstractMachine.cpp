@@ -7,6 +7,7 @@
 #include <AK/Enumerate.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Compiler.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
 #include <LibWasm/AbstractMachine/Validator.h>
@@ -132,6 +133,11 @@ DataInstance* Store::get(DataAddress address)
     return &m_datas[value];
 }
 
+AbstractMachine::AbstractMachine() = default;
+AbstractMachine::AbstractMachine(AbstractMachine&&) = default;
+AbstractMachine& AbstractMachine::operator=(AbstractMachine&&) = default;
+AbstractMachine::~AbstractMachine() = default;
+
 ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
 {
     if (module.validation_status() != Module::ValidationStatus::Unchecked) {
@@ -147,6 +153,10 @@ ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
         return result.release_error();
     }
 
+    // OPTIMIZATION: Now that the module is known to be valid, fuse common instruction sequences so the interpreter
+    //               dispatches fewer instructions.
+    compile(module);
+
     return {};
 }
 InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<ExternValue> externs)
@@ -498,10 +508,18 @@ Result AbstractMachine::invoke(FunctionAddress address, Vector<Value> arguments)
 
 Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
 {
-    Configuration configuration { m_store };
+    // OPTIMIZATION: Some programs call into wasm thousands of times per frame, so reuse the configurations (and their
+    //               stacks) of previous calls instead of growing new ones from nothing every time.
+    //               The function may call back into the host, which may invoke another function before this one
+    //               returns, so a configuration is only reused once it's been handed back.
+    auto configuration = m_idle_configurations.is_empty() ? make<Configuration>(m_store) : m_idle_configurations.take_last();
+    configuration->reset();
     if (m_should_limit_instruction_count)
-        configuration.enable_instruction_count_limit();
-    return configuration.call(interpreter, address, move(arguments));
+        configuration->enable_instruction_count_limit();
+    auto result = configuration->call(interpreter, address, move(arguments));
+    if (m_idle_configurations.size() < max_idle_configuration_count)
+        m_idle_configurations.append(move(configuration));
+    return result;
 }
 
 void Linker::link(ModuleInstance const& instance)
@@ -338,6 +338,8 @@ public:
         , m_module_instance(instance)
         , m_code(code)
     {
+        for (auto& local : code.func().locals())
+            m_local_count += local.n();
     }
 
     auto& type() const { return m_type; }
@@ -345,16 +347,20 @@ public:
     auto& code() const { return m_code; }
     RefPtr<Module const> module_ref() const { return m_module.strong_ref(); }
 
+    // The number of locals the function declares, not counting its parameters.
+    size_t local_count() const { return m_local_count; }
+
 private:
     FunctionType m_type;
     WeakPtr<Module const> m_module;
     ModuleInstance const& m_module_instance;
     CodeSection::Code const& m_code;
+    size_t m_local_count { 0 };
 };
 
 class HostFunction {
 public:
-    explicit HostFunction(AK::Function<Result(Configuration&, Vector<Value>&)> function, FunctionType const& type, ByteString name)
+    explicit HostFunction(AK::Function<Result(Configuration&, Span<Value>)> function, FunctionType const& type, ByteString name)
         : m_function(move(function))
         , m_type(type)
         , m_name(move(name))
@@ -366,7 +372,7 @@ public:
     auto& name() const { return m_name; }
 
 private:
-    AK::Function<Result(Configuration&, Vector<Value>&)> m_function;
+    AK::Function<Result(Configuration&, Span<Value>)> m_function;
     FunctionType m_type;
     ByteString m_name;
 };
@@ -626,10 +632,14 @@ struct HostVisitOps {
 
 class AbstractMachine {
 public:
-    explicit AbstractMachine() = default;
+    explicit AbstractMachine();
+    AbstractMachine(AbstractMachine&&);
+    AbstractMachine& operator=(AbstractMachine&&);
+    ~AbstractMachine();
 
     // Validate a module; permanently sets the module's validity status.
-    ErrorOr<void, ValidationError> validate(Module&);
+    // NOTE: This doesn't depend on any machine, so modules can be validated on any thread.
+    static ErrorOr<void, ValidationError> validate(Module&);
     // Load and instantiate a module, and link it into this interpreter.
     InstantiationResult instantiate(Module const&, Vector<ExternValue>);
     Result invoke(FunctionAddress, Vector<Value>);
@@ -672,6 +682,9 @@ private:
     Store m_store;
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
+    static constexpr size_t max_idle_configuration_count = 8;
+    // Configurations that aren't running anything, kept around so invoking a function doesn't have to set up new stacks.
+    Vector<NonnullOwnPtr<Configuration>> m_idle_configurations;
     bool m_should_limit_instruction_count { false };
 };
 
@@ -8,7 +8,6 @@
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
 #include <AK/Endian.h>
-#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AK/SIMDExtras.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
@@ -68,6 +67,20 @@ void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelInd
     configuration.ip() = label.continuation();
 }
 
+template<typename PopType, typename Operator>
+void BytecodeInterpreter::branch_if_comparison(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
+{
+    auto rhs = configuration.value_stack().take_last().to<PopType>();
+    auto lhs = configuration.value_stack().take_last().to<PopType>();
+    dbgln_if(WASM_TRACE_DEBUG, "br_if({} {} {})", lhs, Operator::name(), rhs);
+    if (!Operator {}(lhs, rhs)) {
+        // Skip over the br_if this stands in for.
+        ip = ip.value() + 2;
+        return;
+    }
+    branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
+}
+
 template<typename ReadType, typename PushType>
 void BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction)
 {
@@ -83,8 +96,7 @@ void BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return;
     }
     dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
-    entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
+    entry = Value(static_cast<PushType>(read_value<ReadType>(memory->data().data() + instance_address)));
 }
 
 template<typename TDst, typename TSrc>
@@ -173,8 +185,7 @@ void BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, In
         return;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-splat({} : {}) -> stack", instance_address, M / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
-    auto value = read_value<NativeIntegralType<M>>(slice);
+    auto value = read_value<NativeIntegralType<M>>(memory->data().data() + instance_address);
     set_top_m_splat<M, NativeIntegralType>(configuration, value);
 }
 
@@ -233,22 +244,22 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     if (source == CallAddressSource::IndirectCall) {
         TRAP_IF_NOT(type->parameters().size() <= configuration.value_stack().size());
     }
-    Vector<Value> args;
-    args.ensure_capacity(type->parameters().size());
-    auto span = configuration.value_stack().span().slice_from_end(type->parameters().size());
-    for (auto& value : span)
-        args.unchecked_append(value);
 
-    configuration.value_stack().remove(configuration.value_stack().size() - span.size(), span.size());
-
-    Result result { Trap::from_string("") };
-    if (instance->has<WasmFunction>()) {
+    // OPTIMIZATION: Calls from wasm into wasm are what hot code mostly does, so skip the argument and result vectors
+    //               that Configuration::call() has to go through, and keep everything on the value stack instead.
+    if (auto* wasm_function = instance->get_pointer<WasmFunction>()) {
         CallFrameHandle handle { *this, configuration };
-        result = configuration.call(*this, address, move(args));
-    } else {
-        result = configuration.call(*this, address, move(args));
+        configuration.call_from_value_stack(*this, *wasm_function);
+        return;
     }
 
+    // OPTIMIZATION: Host functions get their arguments straight from the value stack, rather than from a copy of them.
+    //               Nothing pushes to this configuration's value stack while the host function runs, as calling back
+    //               into wasm goes through a configuration of its own.
+    auto& host_function = instance->get<HostFunction>();
+    auto argument_count = type->parameters().size();
+    auto result = host_function.function()(configuration, configuration.value_stack().span().slice_from_end(argument_count));
+    configuration.value_stack().shrink(configuration.value_stack().size() - argument_count, true);
     if (result.is_trap()) {
         m_trap = move(result.trap());
         return;
@@ -312,10 +323,7 @@ template<>
 struct ConvertToRaw<float> {
     u32 operator()(float value)
     {
-        ReadonlyBytes bytes { &value, sizeof(float) };
-        FixedMemoryStream stream { bytes };
-        auto res = stream.read_value<LittleEndian<u32>>().release_value_but_fixme_should_propagate_errors();
-        return static_cast<u32>(res);
+        return ConvertToRaw<u32> {}(bit_cast<u32>(value));
     }
 };
 
@@ -323,10 +331,7 @@ template<>
 struct ConvertToRaw<double> {
     u64 operator()(double value)
     {
-        ReadonlyBytes bytes { &value, sizeof(double) };
-        FixedMemoryStream stream { bytes };
-        auto res = stream.read_value<LittleEndian<u64>>().release_value_but_fixme_should_propagate_errors();
-        return static_cast<u64>(res);
+        return ConvertToRaw<u64> {}(bit_cast<u64>(value));
     }
 };
 
@@ -355,50 +360,35 @@ void BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
 {
     auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
     auto memory = configuration.store().get(address);
+    // NOTE: Neither the base nor the offset are wider than 32 bits, so this can't overflow.
     u64 instance_address = static_cast<u64>(base) + arg.offset;
-    Checked addition { instance_address };
-    addition += data.size();
-    if (addition.has_overflow() || addition.value() > memory->size()) {
+    if (instance_address + data.size() > memory->size()) {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected 0 <= {} and {} <= {})", instance_address, instance_address + data.size(), memory->size());
         return;
     }
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data.size(), instance_address);
-    data.copy_to(memory->data().bytes().slice(instance_address, data.size()));
+    __builtin_memcpy(memory->data().data() + instance_address, data.data(), data.size());
 }
 
 template<typename T>
-T BytecodeInterpreter::read_value(ReadonlyBytes data)
+T BytecodeInterpreter::read_value(u8 const* data)
 {
-    FixedMemoryStream stream { data };
-    auto value_or_error = stream.read_value<LittleEndian<T>>();
-    if (value_or_error.is_error()) {
-        dbgln("Read from {} failed", data.data());
-        m_trap = Trap::from_string("Read from memory failed");
-    }
-    return value_or_error.release_value();
+    T value;
+    __builtin_memcpy(&value, data, sizeof(T));
+    return AK::convert_between_host_and_little_endian(value);
 }
 
 template<>
-float BytecodeInterpreter::read_value<float>(ReadonlyBytes data)
+float BytecodeInterpreter::read_value<float>(u8 const* data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u32>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap::from_string("Read from memory failed");
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<float>(static_cast<u32>(raw_value));
+    return bit_cast<float>(read_value<u32>(data));
 }
 
 template<>
-double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
+double BytecodeInterpreter::read_value<double>(u8 const* data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u64>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap::from_string("Read from memory failed");
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<double>(static_cast<u64>(raw_value));
+    return bit_cast<double>(read_value<u64>(data));
 }
 
 ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
@@ -419,6 +409,62 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = value;
         return;
     }
+    case Instructions::synthetic_i32_add2local.value(): {
+        auto& args = instruction.arguments().get<Instruction::LocalPairArgs>();
+        auto& locals = configuration.frame().locals();
+        auto result = locals[args.first.value()].to<u32>() + locals[args.second.value()].to<u32>();
+        configuration.value_stack().append(Value(static_cast<i32>(result)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_addconstlocal.value(): {
+        auto& args = instruction.arguments().get<Instruction::LocalAndConstantArgs>();
+        auto result = configuration.frame().locals()[args.local.value()].to<u32>() + static_cast<u32>(args.constant);
+        configuration.value_stack().append(Value(static_cast<i32>(result)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_local_seti32_const.value(): {
+        auto& args = instruction.arguments().get<Instruction::LocalAndConstantArgs>();
+        configuration.frame().locals()[args.local.value()] = Value(args.constant);
+        ip = ip.value() + 2;
+        return;
+    }
+    case Instructions::synthetic_local_copy.value(): {
+        auto& args = instruction.arguments().get<Instruction::LocalPairArgs>();
+        auto& locals = configuration.frame().locals();
+        locals[args.second.value()] = locals[args.first.value()];
+        ip = ip.value() + 2;
+        return;
+    }
+    case Instructions::synthetic_br_if_i32_eqz.value(): {
+        auto value = configuration.value_stack().take_last().to<i32>();
+        if (value != 0) {
+            ip = ip.value() + 2;
+            return;
+        }
+        return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
+    }
+    case Instructions::synthetic_br_if_i32_eq.value():
+        return branch_if_comparison<i32, Operators::Equals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ne.value():
+        return branch_if_comparison<i32, Operators::NotEquals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_lts.value():
+        return branch_if_comparison<i32, Operators::LessThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ltu.value():
+        return branch_if_comparison<u32, Operators::LessThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_gts.value():
+        return branch_if_comparison<i32, Operators::GreaterThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_gtu.value():
+        return branch_if_comparison<u32, Operators::GreaterThan>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_les.value():
+        return branch_if_comparison<i32, Operators::LessThanOrEquals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_leu.value():
+        return branch_if_comparison<u32, Operators::LessThanOrEquals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_ges.value():
+        return branch_if_comparison<i32, Operators::GreaterThanOrEquals>(configuration, ip, instruction);
+    case Instructions::synthetic_br_if_i32_geu.value():
+        return branch_if_comparison<u32, Operators::GreaterThanOrEquals>(configuration, ip, instruction);
     case Instructions::i32_const.value():
         configuration.value_stack().append(Value(instruction.arguments().get<i32>()));
         return;
@@ -657,17 +703,13 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         u8 value = static_cast<u8>(configuration.value_stack().take_last().to<u32>());
         auto destination_offset = configuration.value_stack().take_last().to<u32>();
 
-        TRAP_IF_NOT(static_cast<size_t>(destination_offset + count) <= instance->data().size());
+        TRAP_IF_NOT(static_cast<u64>(destination_offset) + count <= instance->data().size());
 
         if (count == 0)
             return;
 
-        for (u32 i = 0; i < count; ++i) {
-            store_to_memory(configuration, Instruction::MemoryArgument { 0, 0 }, { &value, sizeof(value) }, destination_offset + i);
-            if (did_trap())
-                return;
-        }
-
+        // NOTE: The whole range was checked above, so there's no need to go through store_to_memory() for every byte.
+        __builtin_memset(instance->data().data() + destination_offset, value, count);
         return;
     }
     // https://webassembly.github.io/spec/core/bikeshed/#exec-memory-copy
@@ -678,9 +720,9 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         auto source_instance = configuration.store().get(source_address);
         auto destination_instance = configuration.store().get(destination_address);
 
-        auto count = configuration.value_stack().take_last().to<i32>();
-        auto source_offset = configuration.value_stack().take_last().to<i32>();
-        auto destination_offset = configuration.value_stack().take_last().to<i32>();
+        auto count = configuration.value_stack().take_last().to<u32>();
+        auto source_offset = configuration.value_stack().take_last().to<u32>();
+        auto destination_offset = configuration.value_stack().take_last().to<u32>();
 
         Checked<size_t> source_position = source_offset;
         source_position.saturating_add(count);
@@ -692,19 +734,8 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         if (count == 0)
             return;
 
-        Instruction::MemoryArgument memarg { 0, 0, args.dst_index };
-        if (destination_offset <= source_offset) {
-            for (auto i = 0; i < count; ++i) {
-                auto value = source_instance->data()[source_offset + i];
-                store_to_memory(configuration, memarg, { &value, sizeof(value) }, destination_offset + i);
-            }
-        } else {
-            for (auto i = count - 1; i >= 0; --i) {
-                auto value = source_instance->data()[source_offset + i];
-                store_to_memory(configuration, memarg, { &value, sizeof(value) }, destination_offset + i);
-            }
-        }
-
+        // NOTE: Both ranges were checked above, and memmove() takes care of them overlapping.
+        __builtin_memmove(destination_instance->data().data() + destination_offset, source_instance->data().data() + source_offset, count);
         return;
     }
     // https://webassembly.github.io/spec/core/bikeshed/#exec-memory-init
@@ -728,11 +759,7 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         if (count == 0)
             return;
 
-        Instruction::MemoryArgument memarg { 0, 0, args.memory_index };
-        for (size_t i = 0; i < (size_t)count; ++i) {
-            auto value = data.data()[source_offset + i];
-            store_to_memory(configuration, memarg, { &value, sizeof(value) }, destination_offset + i);
-        }
+        __builtin_memcpy(memory->data().data() + destination_offset, data.data().data() + source_offset, count);
         return;
     }
     // https://webassembly.github.io/spec/core/bikeshed/#exec-data-drop
@@ -1208,11 +1235,18 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         auto a = pop_vector<u8, MakeUnsigned>(configuration);
         using VectorType = Native128ByteVectorOf<u8, MakeUnsigned>;
         VectorType result;
+#if __has_builtin(__builtin_shuffle)
+        // OPTIMIZATION: GCC picks lanes from the concatenation of both vectors, which is exactly what Wasm wants,
+        //               and turns this into a few byte shuffles rather than 16 separate lane selects.
+        auto lanes = bit_cast<VectorType>(arg.lanes);
+        result = __builtin_shuffle(a, b, lanes);
+#else
         for (size_t i = 0; i < 16; ++i)
             if (arg.lanes[i] < 16)
                 result[i] = a[arg.lanes[i]];
             else
                 result[i] = b[arg.lanes[i] - 16];
+#endif
         configuration.value_stack().append(Value(bit_cast<u128>(result)));
         return;
     }
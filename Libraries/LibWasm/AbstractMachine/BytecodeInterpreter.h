@@ -55,6 +55,8 @@ struct BytecodeInterpreter : public Interpreter {
 protected:
     void interpret_instruction(Configuration&, InstructionPointer&, Instruction const&);
     void branch_to_label(Configuration&, LabelIndex);
+    template<typename PopT, typename Operator>
+    void branch_if_comparison(Configuration&, InstructionPointer&, Instruction const&);
     template<typename ReadT, typename PushT>
     void load_and_push(Configuration&, Instruction const&);
     template<typename PopT, typename StoreT>
@@ -84,8 +86,9 @@ protected:
     template<typename PopType, typename PushType, typename Operator, typename... Args>
     void unary_operation(Configuration&, Args&&...);
 
+    // NOTE: The caller is responsible for making sure that sizeof(T) bytes can be read from the given address.
     template<typename T>
-    T read_value(ReadonlyBytes data);
+    static T read_value(u8 const* data);
 
     ALWAYS_INLINE bool trap_if_not(bool value, StringView reason)
     {
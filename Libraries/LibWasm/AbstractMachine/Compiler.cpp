@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWasm/AbstractMachine/Compiler.h>
+#include <LibWasm/Opcode.h>
+
+namespace Wasm {
+
+static Optional<OpCode> fused_branch_if_opcode(OpCode comparison)
+{
+    switch (comparison.value()) {
+    case Instructions::i32_eqz.value():
+        return Instructions::synthetic_br_if_i32_eqz;
+    case Instructions::i32_eq.value():
+        return Instructions::synthetic_br_if_i32_eq;
+    case Instructions::i32_ne.value():
+        return Instructions::synthetic_br_if_i32_ne;
+    case Instructions::i32_lts.value():
+        return Instructions::synthetic_br_if_i32_lts;
+    case Instructions::i32_ltu.value():
+        return Instructions::synthetic_br_if_i32_ltu;
+    case Instructions::i32_gts.value():
+        return Instructions::synthetic_br_if_i32_gts;
+    case Instructions::i32_gtu.value():
+        return Instructions::synthetic_br_if_i32_gtu;
+    case Instructions::i32_les.value():
+        return Instructions::synthetic_br_if_i32_les;
+    case Instructions::i32_leu.value():
+        return Instructions::synthetic_br_if_i32_leu;
+    case Instructions::i32_ges.value():
+        return Instructions::synthetic_br_if_i32_ges;
+    case Instructions::i32_geu.value():
+        return Instructions::synthetic_br_if_i32_geu;
+    default:
+        return {};
+    }
+}
+
+static void compile(Expression& expression)
+{
+    auto& instructions = expression.instructions();
+
+    // NOTE: The only instructions that can be branched to are the ones right after a structured instruction (block, loop,
+    //       if, else and end), and the structured instructions themselves. None of the sequences fused here contain
+    //       one, so control can never enter a sequence anywhere but at its first instruction, which is where the
+    //       synthetic instruction goes. The rest of the sequence is left as is and jumped over.
+    for (size_t i = 0; i < instructions.size(); ++i) {
+        auto remaining = instructions.size() - i;
+        auto opcode = instructions[i].opcode();
+
+        if (remaining >= 3 && opcode == Instructions::local_get && instructions[i + 2].opcode() == Instructions::i32_add) {
+            auto local = instructions[i].arguments().get<LocalIndex>();
+            auto const& second = instructions[i + 1];
+
+            // local.get a, local.get b, i32.add
+            if (second.opcode() == Instructions::local_get) {
+                instructions[i] = Instruction { Instructions::synthetic_i32_add2local, Instruction::LocalPairArgs { local, second.arguments().get<LocalIndex>() } };
+                i += 2;
+                continue;
+            }
+
+            // local.get a, i32.const c, i32.add
+            if (second.opcode() == Instructions::i32_const) {
+                instructions[i] = Instruction { Instructions::synthetic_i32_addconstlocal, Instruction::LocalAndConstantArgs { local, second.arguments().get<i32>() } };
+                i += 2;
+                continue;
+            }
+        }
+
+        if (remaining < 2)
+            continue;
+
+        auto const& next = instructions[i + 1];
+
+        // i32.const c, local.set a
+        if (opcode == Instructions::i32_const && next.opcode() == Instructions::local_set) {
+            instructions[i] = Instruction { Instructions::synthetic_local_seti32_const, Instruction::LocalAndConstantArgs { next.arguments().get<LocalIndex>(), instructions[i].arguments().get<i32>() } };
+            i += 1;
+            continue;
+        }
+
+        // local.get a, local.set b
+        if (opcode == Instructions::local_get && next.opcode() == Instructions::local_set) {
+            instructions[i] = Instruction { Instructions::synthetic_local_copy, Instruction::LocalPairArgs { instructions[i].arguments().get<LocalIndex>(), next.arguments().get<LocalIndex>() } };
+            i += 1;
+            continue;
+        }
+
+        // i32.<comparison>, br_if l
+        if (next.opcode() == Instructions::br_if) {
+            // NOTE: The interpreter tells branches apart from straight-line execution by whether the instruction pointer
+            //       changed, so a branch back to the instruction that took it would go unnoticed. That's what branching
+            //       to a loop would be if the synthetic instruction started the loop's body, so leave those alone.
+            if (i > 0 && instructions[i - 1].opcode() == Instructions::loop)
+                continue;
+            if (auto fused_opcode = fused_branch_if_opcode(opcode); fused_opcode.has_value()) {
+                instructions[i] = Instruction { *fused_opcode, next.arguments().get<LabelIndex>() };
+                i += 1;
+                continue;
+            }
+        }
+    }
+}
+
+void compile(Module& module)
+{
+    for (auto& code : module.code_section().functions())
+        compile(code.func().body());
+}
+
+}
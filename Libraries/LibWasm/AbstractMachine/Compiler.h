@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+// Rewrites the function bodies of a validated module for the bytecode interpreter, replacing common instruction
+// sequences with synthetic instructions that do the work of the whole sequence in a single dispatch.
+void compile(Module&);
+
+}
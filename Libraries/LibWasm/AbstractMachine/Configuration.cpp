@@ -18,6 +18,15 @@ void Configuration::unwind(Badge<CallFrameHandle>, CallFrameHandle const& frame_
     m_ip = frame_handle.ip;
 }
 
+static void append_declared_locals(Vector<Value>& locals, WasmFunction const& function)
+{
+    locals.ensure_capacity(locals.size() + function.local_count());
+    for (auto& local : function.code().func().locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            locals.unchecked_append(Value(local.type()));
+    }
+}
+
 Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
 {
     auto* function = m_store.get(address);
@@ -25,11 +34,7 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
         return Trap::from_string("Attempt to call nonexistent function by address");
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
         Vector<Value> locals = move(arguments);
-        locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
-        for (auto& local : wasm_function->code().func().locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                locals.append(Value(local.type()));
-        }
+        append_declared_locals(locals, *wasm_function);
 
         set_frame(Frame {
             wasm_function->module(),
@@ -43,7 +48,38 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
 
     // It better be a host function, else something is really wrong.
     auto& host_function = function->get<HostFunction>();
-    return host_function.function()(*this, arguments);
+    return host_function.function()(*this, arguments.span());
+}
+
+void Configuration::call_from_value_stack(Interpreter& interpreter, WasmFunction const& function)
+{
+    auto parameter_count = function.type().parameters().size();
+
+    Vector<Value> locals;
+    locals.ensure_capacity(parameter_count + function.local_count());
+    auto arguments = m_value_stack.span().slice_from_end(parameter_count);
+    locals.unchecked_append(arguments.data(), arguments.size());
+    m_value_stack.shrink(m_value_stack.size() - parameter_count, true);
+    append_declared_locals(locals, function);
+
+    auto stack_height = m_value_stack.size();
+    set_frame(Frame {
+        function.module(),
+        move(locals),
+        function.code().func().body(),
+        function.type().results().size(),
+    });
+    m_ip = 0;
+
+    interpreter.interpret(*this);
+    if (interpreter.did_trap())
+        return;
+
+    label_stack().take_last();
+
+    // NOTE: Returning may leave values behind underneath the results, which have to go.
+    auto arity = frame().arity();
+    m_value_stack.remove(stack_height, m_value_stack.size() - stack_height - arity);
 }
 
 Result Configuration::execute(Interpreter& interpreter)
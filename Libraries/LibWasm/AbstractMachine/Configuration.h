@@ -17,6 +17,17 @@ public:
     {
     }
 
+    // Forgets everything from previous calls, while keeping the stacks' storage around to be reused by the next one.
+    void reset()
+    {
+        m_value_stack.clear_with_capacity();
+        m_label_stack.clear_with_capacity();
+        m_frame_stack.clear_with_capacity();
+        m_depth = 0;
+        m_ip = 0;
+        m_should_limit_instruction_count = false;
+    }
+
     void set_frame(Frame frame)
     {
         Label label(frame.arity(), frame.expression().instructions().size(), m_value_stack.size());
@@ -56,6 +67,8 @@ public:
 
     void unwind(Badge<CallFrameHandle>, CallFrameHandle const&);
     Result call(Interpreter&, FunctionAddress, Vector<Value> arguments);
+    // Calls a function from wasm code, taking its arguments from the top of the value stack and leaving its results there.
+    void call_from_value_stack(Interpreter&, WasmFunction const&);
     Result execute(Interpreter&);
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
@@ -330,11 +330,55 @@ struct VectorReplaceLane {
     }
 };
 
+namespace Detail {
+
+// OPTIMIZATION: These operators are understood by the vector extensions of GCC and Clang, which apply them to all lanes
+//               of a vector at once. That lets the compiler emit single SSE or NEON instructions for them, instead of
+//               having to untangle (and usually failing to vectorize) a loop over the lanes.
+template<typename Op>
+constexpr bool is_native_vector_arithmetic_operator = IsOneOf<Op, Add, Subtract, Multiply, BitAnd, BitOr, BitXor>;
+
+template<typename Op>
+constexpr bool is_native_vector_comparison_operator = IsOneOf<Op, Equals, NotEquals, GreaterThan, LessThan, LessThanOrEquals, GreaterThanOrEquals>;
+
+template<typename Op, SIMDVector V>
+ALWAYS_INLINE static V apply_native_vector_arithmetic(Op op, V lhs, V rhs)
+{
+    if constexpr (IsIntegral<ElementOf<V>>) {
+        // NOTE: Wasm integer arithmetic wraps around, so it's done on unsigned lanes, where overflowing is well-defined.
+        using UnsignedVector = NativeVectorType<sizeof(ElementOf<V>) * 8, vector_length<V>, MakeUnsigned>;
+        return bit_cast<V>(op(bit_cast<UnsignedVector>(lhs), bit_cast<UnsignedVector>(rhs)));
+    } else {
+        return op(lhs, rhs);
+    }
+}
+
+// Returns the lanes first, first + stride, first + 2 * stride, ... of a vector, count of them in total.
+template<size_t First, size_t Stride, size_t Count, SIMDVector V, size_t... Idx>
+ALWAYS_INLINE static auto select_lanes(V vector, IndexSequence<Idx...>)
+{
+    return __builtin_shufflevector(vector, vector, (First + Idx * Stride)...);
+}
+
+template<size_t First, size_t Stride, size_t Count, SIMDVector V>
+ALWAYS_INLINE static auto select_lanes(V vector)
+{
+    return select_lanes<First, Stride, Count>(vector, MakeIndexSequence<Count>());
+}
+
+}
+
 template<size_t VectorSize, typename Op, template<typename> typename SetSign = MakeSigned>
 struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
         using ElementType = NativeIntegralType<128 / VectorSize>;
+        if constexpr (Detail::is_native_vector_comparison_operator<Op>) {
+            // NOTE: Comparing two vectors results in a vector of all-ones or all-zeros lanes, just like Wasm wants.
+            using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+            return bit_cast<u128>(Op {}(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
+        }
+
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
@@ -370,6 +414,9 @@ struct VectorFloatCmpOp {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
         using ElementType = NativeIntegralType<128 / VectorSize>;
+        if constexpr (Detail::is_native_vector_comparison_operator<Op>)
+            return bit_cast<u128>(Op {}(first, other));
+
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i)
@@ -573,10 +620,15 @@ struct VectorIntegerExtOpPairwise {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        if constexpr (Detail::is_native_vector_arithmetic_operator<Op>) {
+            auto even = __builtin_convertvector((Detail::select_lanes<0, 2, VectorSize>(vector)), VectorResult);
+            auto odd = __builtin_convertvector((Detail::select_lanes<1, 2, VectorSize>(vector)), VectorResult);
+            return bit_cast<u128>(Detail::apply_native_vector_arithmetic(op, even, odd));
+        }
+
+        VectorResult result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
         }
@@ -611,19 +663,11 @@ struct VectorIntegerExt {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        // NOTE: Converting the vector sign- or zero-extends every lane, depending on the signedness of the input.
+        constexpr size_t first_lane = Mode == VectorExt::High ? VectorSize : 0;
+        auto half = Detail::select_lanes<first_lane, 1, VectorSize>(vector);
+        return bit_cast<u128>(__builtin_convertvector(half, VectorResult));
     }
 
     static StringView name()
@@ -649,11 +693,17 @@ struct VectorIntegerExtOp {
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto first = bit_cast<VectorInput>(lhs);
         auto second = bit_cast<VectorInput>(rhs);
-        VectorResult result;
         Op op;
 
+        if constexpr (Detail::is_native_vector_arithmetic_operator<Op>) {
+            constexpr size_t first_lane = Mode == VectorExt::High ? VectorSize : 0;
+            auto a = __builtin_convertvector((Detail::select_lanes<first_lane, 1, VectorSize>(first)), VectorResult);
+            auto b = __builtin_convertvector((Detail::select_lanes<first_lane, 1, VectorSize>(second)), VectorResult);
+            return bit_cast<u128>(Detail::apply_native_vector_arithmetic(op, a, b));
+        }
+
+        VectorResult result;
         using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             if constexpr (Mode == VectorExt::High) {
                 ResultType a = first[VectorSize + i];
@@ -692,10 +742,17 @@ struct VectorIntegerBinaryOp {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
+        if constexpr (Detail::is_native_vector_arithmetic_operator<Op>) {
+            return bit_cast<u128>(Detail::apply_native_vector_arithmetic(op, first, second));
+        } else if constexpr (IsOneOf<Op, Minimum, Maximum>) {
+            // NOTE: Select the lanes of either side with the all-ones or all-zeros mask from comparing them.
+            auto take_first = bit_cast<VectorType>(IsSame<Op, Minimum> ? first < second : first > second);
+            return bit_cast<u128>((first & take_first) | (second & ~take_first));
+        }
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -745,16 +802,14 @@ struct VectorDotProduct {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-
-        using ResultType = MakeUnsigned<NativeIntegralType<128 / VectorSize>>;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            ResultType low = v1[i * 2] * v2[i * 2];
-            ResultType high = v1[(i * 2) + 1] * v2[(i * 2) + 1];
-            result[i] = low + high;
-        }
 
-        return bit_cast<u128>(result);
+        auto even_products = Detail::apply_native_vector_arithmetic(Multiply {},
+            __builtin_convertvector((Detail::select_lanes<0, 2, VectorSize>(v1)), VectorResult),
+            __builtin_convertvector((Detail::select_lanes<0, 2, VectorSize>(v2)), VectorResult));
+        auto odd_products = Detail::apply_native_vector_arithmetic(Multiply {},
+            __builtin_convertvector((Detail::select_lanes<1, 2, VectorSize>(v1)), VectorResult),
+            __builtin_convertvector((Detail::select_lanes<1, 2, VectorSize>(v2)), VectorResult));
+        return bit_cast<u128>(Detail::apply_native_vector_arithmetic(Add {}, even_products, odd_products));
     }
 
     static StringView name() { return "dot"sv; }
@@ -834,8 +889,13 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
         Op op;
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>)
+            return bit_cast<u128>(op(first, second));
+        else if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
+
+        VectorType result;
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -460,8 +460,29 @@ namespace Instructions {
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
     ENUMERATE_MULTI_BYTE_WASM_OPCODES(M)
 
+// NOTE: Synthetic instructions never appear in a module's binary, they're produced out of common instruction sequences
+//       by compile() once a module has been validated. Each one stands in for a fixed number of original instructions,
+//       which stay in place after it so that instruction pointers don't change.
+#define ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)         \
+    M(synthetic_i32_add2local, 0xff00000000000000ull)      \
+    M(synthetic_i32_addconstlocal, 0xff00000000000001ull)  \
+    M(synthetic_local_seti32_const, 0xff00000000000002ull) \
+    M(synthetic_local_copy, 0xff00000000000003ull)         \
+    M(synthetic_br_if_i32_eqz, 0xff00000000000004ull)      \
+    M(synthetic_br_if_i32_eq, 0xff00000000000005ull)       \
+    M(synthetic_br_if_i32_ne, 0xff00000000000006ull)       \
+    M(synthetic_br_if_i32_lts, 0xff00000000000007ull)      \
+    M(synthetic_br_if_i32_ltu, 0xff00000000000008ull)      \
+    M(synthetic_br_if_i32_gts, 0xff00000000000009ull)      \
+    M(synthetic_br_if_i32_gtu, 0xff0000000000000aull)      \
+    M(synthetic_br_if_i32_les, 0xff0000000000000bull)      \
+    M(synthetic_br_if_i32_leu, 0xff0000000000000cull)      \
+    M(synthetic_br_if_i32_ges, 0xff0000000000000dull)      \
+    M(synthetic_br_if_i32_geu, 0xff0000000000000eull)
+
 #define M(name, value) static constexpr OpCode name = value;
 ENUMERATE_WASM_OPCODES(M)
+ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)
 #undef M
 
 }
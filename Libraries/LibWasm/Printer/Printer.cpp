@@ -454,6 +454,8 @@ void Printer::print(Wasm::Instruction const& instruction)
             [&](Instruction::MemoryCopyArgs const& args) { print("(from (memory index {}) to (memory index {}))", args.src_index.value(), args.dst_index.value()); },
             [&](Instruction::MemoryIndexArgument const& args) { print("(memory index {})", args.memory_index.value()); },
             [&](Instruction::LaneIndex const& args) { print("(lane {})", args.lane); },
+            [&](Instruction::LocalPairArgs const& args) { print("(local index {}) (local index {})", args.first.value(), args.second.value()); },
+            [&](Instruction::LocalAndConstantArgs const& args) { print("(local index {}) (constant {})", args.local.value(), args.constant); },
             [&](Instruction::ShuffleArgument const& args) {
                 print("{{ {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} }}",
                     args.lanes[0], args.lanes[1], args.lanes[2], args.lanes[3],
@@ -1141,5 +1143,20 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::f64x2_convert_low_i32x4_u, "f64x2.convert_low_i32x4_u" },
     { Instructions::structured_else, "synthetic:else" },
     { Instructions::structured_end, "synthetic:end" },
+    { Instructions::synthetic_i32_add2local, "synthetic:i32.add2local" },
+    { Instructions::synthetic_i32_addconstlocal, "synthetic:i32.addconstlocal" },
+    { Instructions::synthetic_local_seti32_const, "synthetic:local.seti32_const" },
+    { Instructions::synthetic_local_copy, "synthetic:local.copy" },
+    { Instructions::synthetic_br_if_i32_eqz, "synthetic:br_if.i32.eqz" },
+    { Instructions::synthetic_br_if_i32_eq, "synthetic:br_if.i32.eq" },
+    { Instructions::synthetic_br_if_i32_ne, "synthetic:br_if.i32.ne" },
+    { Instructions::synthetic_br_if_i32_lts, "synthetic:br_if.i32.lt_s" },
+    { Instructions::synthetic_br_if_i32_ltu, "synthetic:br_if.i32.lt_u" },
+    { Instructions::synthetic_br_if_i32_gts, "synthetic:br_if.i32.gt_s" },
+    { Instructions::synthetic_br_if_i32_gtu, "synthetic:br_if.i32.gt_u" },
+    { Instructions::synthetic_br_if_i32_les, "synthetic:br_if.i32.le_s" },
+    { Instructions::synthetic_br_if_i32_leu, "synthetic:br_if.i32.le_u" },
+    { Instructions::synthetic_br_if_i32_ges, "synthetic:br_if.i32.ge_s" },
+    { Instructions::synthetic_br_if_i32_geu, "synthetic:br_if.i32.ge_u" },
 };
 HashMap<ByteString, Wasm::OpCode> Wasm::Names::instructions_by_name;
@@ -454,6 +454,17 @@ public:
         u8 lanes[16];
     };
 
+    // Arguments of synthetic instructions, see compile().
+    struct LocalPairArgs {
+        LocalIndex first;
+        LocalIndex second;
+    };
+
+    struct LocalAndConstantArgs {
+        LocalIndex local;
+        i32 constant;
+    };
+
     template<typename T>
     explicit Instruction(OpCode opcode, T argument)
         : m_opcode(opcode)
@@ -478,7 +489,9 @@ private:
         IndirectCallArgs,
         LabelIndex,
         LaneIndex,
+        LocalAndConstantArgs,
         LocalIndex,
+        LocalPairArgs,
         MemoryArgument,
         MemoryAndLaneArgument,
         MemoryCopyArgs,
@@ -705,6 +718,7 @@ public:
     }
 
     auto& instructions() const { return m_instructions; }
+    auto& instructions() { return m_instructions; }
 
     static ParseResult<Expression> parse(Stream& stream, Optional<size_t> size_hint = {});
 
@@ -884,6 +898,7 @@ public:
 
         auto& locals() const { return m_locals; }
         auto& body() const { return m_body; }
+        auto& body() { return m_body; }
 
         static ParseResult<Func> parse(Stream& stream, size_t size_hint);
 
@@ -901,6 +916,7 @@ public:
 
         auto size() const { return m_size; }
         auto& func() const { return m_func; }
+        auto& func() { return m_func; }
 
         static ParseResult<Code> parse(Stream& stream);
 
@@ -917,6 +933,7 @@ public:
     }
 
     auto& functions() const { return m_functions; }
+    auto& functions() { return m_functions; }
 
     static ParseResult<CodeSection> parse(Stream& stream);
 
@@ -14,8 +14,10 @@
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleInvalidation.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::Animations {
@@ -631,8 +633,23 @@ void AnimationEffect::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_associated_animation);
 }
 
-static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties)
+static bool is_opacity_or_transform_property(CSS::PropertyID property_id)
 {
+    switch (property_id) {
+    case CSS::PropertyID::Opacity:
+    case CSS::PropertyID::Transform:
+    case CSS::PropertyID::Translate:
+    case CSS::PropertyID::Rotate:
+    case CSS::PropertyID::Scale:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties, bool& only_opacity_or_transform_changed)
+{
+    only_opacity_or_transform_changed = true;
     CSS::RequiredInvalidationAfterStyleChange invalidation;
     auto old_and_new_properties = MUST(Bitmap::create(to_underlying(CSS::last_property_id) + 1, 0));
     for (auto const& [property_id, _] : old_properties)
@@ -647,7 +664,10 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_f
         auto const* new_value = new_properties.get(property_id).value_or({});
         if (!old_value && !new_value)
             continue;
-        invalidation |= compute_property_invalidation(property_id, old_value, new_value);
+        auto property_invalidation = compute_property_invalidation(property_id, old_value, new_value);
+        if (!property_invalidation.is_none() && !is_opacity_or_transform_property(property_id))
+            only_opacity_or_transform_changed = false;
+        invalidation |= property_invalidation;
     }
     return invalidation;
 }
@@ -660,7 +680,8 @@ AnimationUpdateContext::~AnimationUpdateContext()
             continue;
         auto& element = it.key;
         GC::Ref<DOM::Element> target = element.element();
-        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values());
+        bool only_opacity_or_transform_changed = false;
+        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values(), only_opacity_or_transform_changed);
 
         if (invalidation.is_none())
             continue;
@@ -670,6 +691,7 @@ AnimationUpdateContext::~AnimationUpdateContext()
             auto element_invalidation = element.recompute_inherited_style();
             if (element_invalidation.is_none())
                 return TraversalDecision::SkipChildrenAndContinue;
+            only_opacity_or_transform_changed = false;
             invalidation |= element_invalidation;
             return TraversalDecision::Continue;
         });
@@ -696,7 +718,14 @@ AnimationUpdateContext::~AnimationUpdateContext()
             }
         }
         if (invalidation.repaint) {
-            element.document().set_needs_display();
+            // OPTIMIZATION: If nothing but the opacity or transform of a stacking context changed, which is the case on
+            //               every frame of most animations, the commands that were recorded for it can be updated
+            //               instead of painting it again.
+            auto* paintable_box = target->paintable_box();
+            if (only_opacity_or_transform_changed && !element.pseudo_element().has_value() && !invalidation.relayout && !invalidation.rebuild_layout_tree && !invalidation.rebuild_stacking_context_tree && paintable_box && paintable_box->stacking_context())
+                element.document().did_change_opacity_or_transform_of_stacking_context(*paintable_box);
+            else
+                element.document().set_needs_display();
             element.document().set_needs_to_resolve_paint_only_properties();
         }
         if (invalidation.rebuild_stacking_context_tree)
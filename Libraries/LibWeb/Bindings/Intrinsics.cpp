@@ -5,8 +5,10 @@
  */
 
 #include <LibJS/Forward.h>
+#include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/Bindings/SyntheticHostDefined.h>
@@ -21,9 +23,28 @@ void Intrinsics::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_namespaces);
     visitor.visit(m_prototypes);
     visitor.visit(m_constructors);
+    visitor.visit(m_prototype_shapes);
     visitor.visit(m_realm);
 }
 
+JS::Shape& Intrinsics::create_web_prototype_shape(FlyString const& class_name, JS::Object& prototype)
+{
+    auto shape = m_realm->intrinsics().empty_object_shape()->create_prototype_transition(&prototype);
+    m_prototype_shapes.set(class_name, shape);
+    return shape;
+}
+
+void set_prototype_shape(JS::Object& object, JS::Shape& prototype_shape)
+{
+    // NOTE: An object that still has the empty object shape can just take on the prototype shape, as that is where
+    //       setting its prototype would lead. Anything else has to go through the regular prototype transition.
+    if (&object.shape() == prototype_shape.realm().intrinsics().empty_object_shape().ptr()) {
+        object.unsafe_set_shape(prototype_shape);
+        return;
+    }
+    object.set_prototype(prototype_shape.prototype());
+}
+
 Intrinsics& host_defined_intrinsics(JS::Realm& realm)
 {
     ASSERT(realm.host_defined());
@@ -14,12 +14,12 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/VM.h>
 
-#define WEB_SET_PROTOTYPE_FOR_INTERFACE_WITH_CUSTOM_NAME(interface_class, interface_name)                      \
-    do {                                                                                                       \
-        static auto name = #interface_name##_fly_string;                                                       \
-        if (!shape().prototype()) {                                                                            \
-            set_prototype(&Bindings::ensure_web_prototype<Bindings::interface_class##Prototype>(realm, name)); \
-        }                                                                                                      \
+#define WEB_SET_PROTOTYPE_FOR_INTERFACE_WITH_CUSTOM_NAME(interface_class, interface_name)                                                  \
+    do {                                                                                                                                   \
+        static auto name = #interface_name##_fly_string;                                                                                   \
+        if (!shape().prototype()) {                                                                                                        \
+            Bindings::set_prototype_shape(*this, Bindings::ensure_web_prototype_shape<Bindings::interface_class##Prototype>(realm, name)); \
+        }                                                                                                                                  \
     } while (0)
 
 #define WEB_SET_PROTOTYPE_FOR_INTERFACE(interface_name) WEB_SET_PROTOTYPE_FOR_INTERFACE_WITH_CUSTOM_NAME(interface_name, interface_name)
@@ -56,6 +56,17 @@ public:
         return *m_prototypes.find(class_name)->value;
     }
 
+    // Returns the shape that objects with no properties and the interface's prototype as their prototype have, which is
+    // the same one that setting their prototype would have transitioned them to.
+    template<typename PrototypeType>
+    JS::Shape& ensure_web_prototype_shape(FlyString const& class_name)
+    {
+        if (auto it = m_prototype_shapes.find(class_name); it != m_prototype_shapes.end())
+            return *it->value;
+
+        return create_web_prototype_shape(class_name, ensure_web_prototype<PrototypeType>(class_name));
+    }
+
     template<typename PrototypeType>
     JS::NativeFunction& ensure_web_constructor(FlyString const& class_name)
     {
@@ -78,9 +89,16 @@ private:
     template<typename PrototypeType>
     void create_web_prototype_and_constructor(JS::Realm& realm);
 
+    JS::Shape& create_web_prototype_shape(FlyString const& class_name, JS::Object& prototype);
+
     HashMap<FlyString, GC::Ref<JS::Object>> m_namespaces;
     HashMap<FlyString, GC::Ref<JS::Object>> m_prototypes;
     HashMap<FlyString, GC::Ptr<JS::NativeFunction>> m_constructors;
+
+    // OPTIMIZATION: Every platform object sets its prototype when it's initialized. With these, that is a single lookup
+    //               of the interface name, rather than one for the prototype followed by one in the prototype
+    //               transitions of the empty object shape.
+    HashMap<FlyString, GC::Ref<JS::Shape>> m_prototype_shapes;
     GC::Ref<JS::Realm> m_realm;
 };
 
@@ -98,6 +116,15 @@ template<typename T>
     return host_defined_intrinsics(realm).ensure_web_prototype<T>(class_name);
 }
 
+template<typename T>
+[[nodiscard]] JS::Shape& ensure_web_prototype_shape(JS::Realm& realm, FlyString const& class_name)
+{
+    return host_defined_intrinsics(realm).ensure_web_prototype_shape<T>(class_name);
+}
+
+// Sets the prototype of the given object to that of the given shape, which came from ensure_web_prototype_shape().
+void set_prototype_shape(JS::Object&, JS::Shape&);
+
 template<typename T>
 [[nodiscard]] JS::NativeFunction& ensure_web_constructor(JS::Realm& realm, FlyString const& class_name)
 {
@@ -46,6 +46,7 @@
 #include <LibWeb/HTML/Scripting/WorkerAgent.h>
 #include <LibWeb/HTML/ShadowRealmGlobalScope.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HTML/WindowProxy.h>
 #include <LibWeb/HTML/WorkletGlobalScope.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -339,6 +340,27 @@ void initialize_main_thread_vm(AgentType type)
         }));
     };
 
+    // HostEnqueueTimeoutJob(timeoutJob, realm, milliseconds), https://html.spec.whatwg.org/multipage/webappapis.html#hostenqueuetimeoutjob
+    s_main_thread_vm->host_enqueue_timeout_job = [](GC::Ref<GC::Function<void()>> timeout_job, JS::Realm& realm, double milliseconds) {
+        // 1. Let global be realm's global object.
+        auto& global = realm.global_object();
+
+        auto* window_or_worker = as_if<HTML::WindowOrWorkerGlobalScopeMixin>(global);
+        if (!window_or_worker)
+            return;
+
+        // 2. Let timeoutStep be an algorithm step which queues a global task on the JavaScript engine task source given global to perform timeoutJob().
+        auto timeout_step = [&global, timeout_job] {
+            HTML::queue_global_task(HTML::Task::Source::JavaScriptEngine, global, GC::create_function(global.heap(), [timeout_job] {
+                timeout_job->function()();
+            }));
+        };
+
+        // 3. Run steps after a timeout given global, "JavaScript", milliseconds, and timeoutStep.
+        auto timeout = static_cast<i32>(min(ceil(milliseconds), static_cast<double>(NumericLimits<i32>::max())));
+        window_or_worker->run_steps_after_a_timeout(timeout, move(timeout_step));
+    };
+
     // 8.1.5.4.4 HostMakeJobCallback(callable), https://html.spec.whatwg.org/multipage/webappapis.html#hostmakejobcallback
     // https://whatpr.org/html/9893/webappapis.html#hostmakejobcallback
     s_main_thread_vm->host_make_job_callback = [](JS::FunctionObject& callable) -> GC::Ref<JS::JobCallback> {
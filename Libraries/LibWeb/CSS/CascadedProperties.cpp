@@ -22,49 +22,66 @@ CascadedProperties::~CascadedProperties() = default;
 void CascadedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto const& [property_id, entries] : m_properties) {
-        for (auto const& entry : entries) {
-            visitor.visit(entry.source);
-        }
+    for (auto const& entry : m_entries)
+        visitor.visit(entry.source);
+}
+
+CascadedProperties::Entry const* CascadedProperties::newest_entry(PropertyID property_id) const
+{
+    auto index = m_newest_entry[to_underlying(property_id)];
+    if (index == no_entry)
+        return nullptr;
+    return &entry_at(index);
+}
+
+void CascadedProperties::append_entry(Entry entry)
+{
+    VERIFY(m_entries.size() < NumericLimits<EntryIndex>::max());
+    auto& newest_entry = m_newest_entry[to_underlying(entry.property.property_id)];
+    entry.older_entry = newest_entry;
+    m_entries.append(move(entry));
+    newest_entry = static_cast<EntryIndex>(m_entries.size());
+}
+
+void CascadedProperties::remove_entries_matching(PropertyID property_id, Function<bool(Entry const&)> const& predicate)
+{
+    // NOTE: Removed entries are only unlinked from the property's chain. Their storage goes away along with
+    //       this object, since every cascade creates a fresh CascadedProperties.
+    auto* link = &m_newest_entry[to_underlying(property_id)];
+    while (*link != no_entry) {
+        auto& entry = entry_at(*link);
+        if (predicate(entry))
+            *link = entry.older_entry;
+        else
+            link = &entry.older_entry;
     }
 }
 
 void CascadedProperties::revert_property(PropertyID property_id, Important important, CascadeOrigin cascade_origin)
 {
-    auto it = m_properties.find(property_id);
-    if (it == m_properties.end())
-        return;
-    auto& entries = it->value;
-    entries.remove_all_matching([&](auto& entry) {
-        return entry.property.property_id == property_id
-            && entry.property.important == important
+    remove_entries_matching(property_id, [&](auto& entry) {
+        return entry.property.important == important
             && cascade_origin == entry.origin;
     });
-    if (entries.is_empty())
-        m_properties.remove(it);
 }
 
 void CascadedProperties::revert_layer_property(PropertyID property_id, Important important, Optional<FlyString> layer_name)
 {
-    auto it = m_properties.find(property_id);
-    if (it == m_properties.end())
-        return;
-    auto& entries = it->value;
-    entries.remove_all_matching([&](auto& entry) {
-        return entry.property.property_id == property_id
-            && entry.property.important == important
+    remove_entries_matching(property_id, [&](auto& entry) {
+        return entry.property.important == important
             && layer_name == entry.layer_name;
     });
-    if (entries.is_empty())
-        m_properties.remove(it);
 }
 
 void CascadedProperties::resolve_unresolved_properties(GC::Ref<DOM::Element> element, Optional<PseudoElement> pseudo_element)
 {
-    for (auto& [property_id, entries] : m_properties) {
-        for (auto& entry : entries) {
+    for (size_t i = 0; i < m_newest_entry.size(); ++i) {
+        for (auto index = m_newest_entry[i]; index != no_entry;) {
+            auto& entry = entry_at(index);
+            index = entry.older_entry;
             if (!entry.property.value->is_unresolved())
                 continue;
+            auto property_id = static_cast<PropertyID>(i);
             entry.property.value = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingParams { element->document() }, element, pseudo_element, property_id, entry.property.value->as_unresolved());
         }
     }
@@ -72,9 +89,8 @@ void CascadedProperties::resolve_unresolved_properties(GC::Ref<DOM::Element> ele
 
 void CascadedProperties::set_property(PropertyID property_id, NonnullRefPtr<CSSStyleValue const> value, Important important, CascadeOrigin origin, Optional<FlyString> layer_name, GC::Ptr<CSS::CSSStyleDeclaration const> source)
 {
-    auto& entries = m_properties.ensure(property_id);
-
-    for (auto& entry : entries.in_reverse()) {
+    for (auto index = m_newest_entry[to_underlying(property_id)]; index != no_entry;) {
+        auto& entry = entry_at(index);
         if (entry.origin == origin && entry.layer_name == layer_name) {
             if (entry.property.important == Important::Yes && important == Important::No)
                 return;
@@ -85,9 +101,10 @@ void CascadedProperties::set_property(PropertyID property_id, NonnullRefPtr<CSSS
             };
             return;
         }
+        index = entry.older_entry;
     }
 
-    entries.append(Entry {
+    append_entry(Entry {
         .property = StyleProperty {
             .important = important,
             .property_id = property_id,
@@ -102,9 +119,7 @@ void CascadedProperties::set_property(PropertyID property_id, NonnullRefPtr<CSSS
 void CascadedProperties::set_property_from_presentational_hint(PropertyID property_id, NonnullRefPtr<CSSStyleValue const> value)
 {
     StyleComputer::for_each_property_expanding_shorthands(property_id, value, [this](PropertyID longhand_property_id, CSSStyleValue const& longhand_value) {
-        auto& entries = m_properties.ensure(longhand_property_id);
-
-        entries.append(Entry {
+        append_entry(Entry {
             .property = StyleProperty {
                 .important = Important::No,
                 .property_id = longhand_property_id,
@@ -119,29 +134,28 @@ void CascadedProperties::set_property_from_presentational_hint(PropertyID proper
 
 RefPtr<CSSStyleValue const> CascadedProperties::property(PropertyID property_id) const
 {
-    auto it = m_properties.find(property_id);
-    if (it == m_properties.end())
+    auto const* entry = newest_entry(property_id);
+    if (!entry)
         return nullptr;
 
-    return it->value.last().property.value;
+    return entry->property.value;
 }
 
 GC::Ptr<CSSStyleDeclaration const> CascadedProperties::property_source(PropertyID property_id) const
 {
-    auto it = m_properties.find(property_id);
-    if (it == m_properties.end())
+    auto const* entry = newest_entry(property_id);
+    if (!entry)
         return nullptr;
 
-    return it->value.last().source;
+    return entry->source;
 }
 
 bool CascadedProperties::is_property_important(PropertyID property_id) const
 {
-    auto it = m_properties.find(property_id);
-    if (it == m_properties.end())
+    auto const* entry = newest_entry(property_id);
+    if (!entry)
         return false;
 
-    return it->value.last().property.important == Important::Yes;
+    return entry->property.important == Important::Yes;
 }
-
 }
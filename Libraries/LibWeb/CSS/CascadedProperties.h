@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Function.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/CSS/CSSStyleValue.h>
@@ -40,13 +42,29 @@ private:
 
     virtual void visit_edges(Visitor&) override;
 
+    // NOTE: Entries are referred to by their index in m_entries plus one, so that zero can mean "no entry".
+    using EntryIndex = u16;
+    static constexpr EntryIndex no_entry = 0;
+
     struct Entry {
         StyleProperty property;
         CascadeOrigin origin;
         Optional<FlyString> layer_name;
         GC::Ptr<CSS::CSSStyleDeclaration const> source;
+        EntryIndex older_entry { no_entry };
     };
-    HashMap<PropertyID, Vector<Entry>> m_properties;
+
+    Entry& entry_at(EntryIndex index) { return m_entries[index - 1]; }
+    Entry const& entry_at(EntryIndex index) const { return m_entries[index - 1]; }
+    Entry const* newest_entry(PropertyID) const;
+    void append_entry(Entry);
+    void remove_entries_matching(PropertyID, Function<bool(Entry const&)> const&);
+
+    // OPTIMIZATION: Instead of a HashMap of Vectors, all entries live in one Vector, and each property indexes
+    //               directly to its newest entry. Older entries for the same property (from other origins or
+    //               layers) are chained behind it, so cascading an element does almost no allocations.
+    Array<EntryIndex, to_underlying(last_property_id) + 1> m_newest_entry {};
+    Vector<Entry> m_entries;
 };
 
 }
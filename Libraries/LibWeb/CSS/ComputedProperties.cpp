@@ -5,7 +5,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
 #include <AK/NonnullRawPtr.h>
+#include <AK/Singleton.h>
 #include <AK/TypeCasts.h>
 #include <LibCore/DirIterator.h>
 #include <LibGC/CellAllocator.h>
@@ -44,10 +46,85 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
-ComputedProperties::ComputedProperties() = default;
+struct InternedPropertyValuesTraits : public DefaultTraits<ComputedProperties::PropertyValues const*> {
+    static unsigned hash(ComputedProperties::PropertyValues const* values) { return values->hash; }
+    static bool equals(ComputedProperties::PropertyValues const* a, ComputedProperties::PropertyValues const* b) { return *a == *b; }
+};
+
+static auto& interned_property_values()
+{
+    static Singleton<HashTable<ComputedProperties::PropertyValues const*, InternedPropertyValuesTraits>> table;
+    return *table;
+}
+
+ComputedProperties::PropertyValues::PropertyValues(PropertyValues const& other)
+    : values(other.values)
+    , important(other.important)
+    , inherited(other.inherited)
+{
+}
+
+ComputedProperties::PropertyValues::~PropertyValues()
+{
+    if (is_interned)
+        interned_property_values().remove(this);
+}
+
+unsigned ComputedProperties::PropertyValues::compute_hash() const
+{
+    // NOTE: Values are compared by identity, which is enough to catch sharing of inherited and initial values,
+    //       and of declared values that came from the same rules.
+    unsigned hash = 0;
+    for (auto const& value : values)
+        hash = pair_int_hash(hash, ptr_hash(value.ptr()));
+    for (auto byte : important)
+        hash = pair_int_hash(hash, byte);
+    for (auto byte : inherited)
+        hash = pair_int_hash(hash, byte);
+    return hash;
+}
+
+bool ComputedProperties::PropertyValues::operator==(PropertyValues const& other) const
+{
+    return values == other.values && important == other.important && inherited == other.inherited;
+}
+
+ComputedProperties::ComputedProperties()
+    : m_property_values(adopt_ref(*new PropertyValues))
+{
+}
 
 ComputedProperties::~ComputedProperties() = default;
 
+ComputedProperties::PropertyValues& ComputedProperties::mutable_property_values()
+{
+    if (m_property_values->ref_count() > 1) {
+        m_property_values = adopt_ref(*new PropertyValues(*m_property_values));
+    } else if (m_property_values->is_interned) {
+        interned_property_values().remove(m_property_values.ptr());
+        m_property_values->is_interned = false;
+    }
+    return *m_property_values;
+}
+
+// OPTIMIZATION: Most elements on a page share their values with some other element. Once an element's style has been
+//               fully computed, we look for an existing identical set of values and share it instead of keeping our own.
+void ComputedProperties::share_property_values_if_possible()
+{
+    if (m_property_values->is_interned)
+        return;
+
+    m_property_values->hash = m_property_values->compute_hash();
+
+    auto& table = interned_property_values();
+    if (auto it = table.find(m_property_values.ptr()); it != table.end()) {
+        m_property_values = const_cast<PropertyValues&>(**it);
+        return;
+    }
+    m_property_values->is_interned = true;
+    table.set(m_property_values.ptr());
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -58,43 +135,45 @@ void ComputedProperties::visit_edges(Visitor& visitor)
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
-    return m_property_important[n / 8] & (1 << (n % 8));
+    return m_property_values->important[n / 8] & (1 << (n % 8));
 }
 
 void ComputedProperties::set_property_important(PropertyID property_id, Important important)
 {
     size_t n = to_underlying(property_id);
+    auto& property_important = mutable_property_values().important;
     if (important == Important::Yes)
-        m_property_important[n / 8] |= (1 << (n % 8));
+        property_important[n / 8] |= (1 << (n % 8));
     else
-        m_property_important[n / 8] &= ~(1 << (n % 8));
+        property_important[n / 8] &= ~(1 << (n % 8));
 }
 
 bool ComputedProperties::is_property_inherited(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
-    return m_property_inherited[n / 8] & (1 << (n % 8));
+    return m_property_values->inherited[n / 8] & (1 << (n % 8));
 }
 
 void ComputedProperties::set_property_inherited(PropertyID property_id, Inherited inherited)
 {
     size_t n = to_underlying(property_id);
+    auto& property_inherited = mutable_property_values().inherited;
     if (inherited == Inherited::Yes)
-        m_property_inherited[n / 8] |= (1 << (n % 8));
+        property_inherited[n / 8] |= (1 << (n % 8));
     else
-        m_property_inherited[n / 8] &= ~(1 << (n % 8));
+        property_inherited[n / 8] &= ~(1 << (n % 8));
 }
 
 void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<CSSStyleValue const> value, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = move(value);
+    mutable_property_values().values[to_underlying(id)] = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
-    m_property_values[to_underlying(id)] = style_for_revert.m_property_values[to_underlying(id)];
+    mutable_property_values().values[to_underlying(id)] = style_for_revert.m_property_values->values[to_underlying(id)];
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -117,14 +196,14 @@ CSSStyleValue const& ComputedProperties::property(PropertyID property_id, WithAn
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)];
+    return *m_property_values->values[to_underlying(property_id)];
 }
 
 CSSStyleValue const* ComputedProperties::maybe_null_property(PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_property_values[to_underlying(property_id)];
+    return m_property_values->values[to_underlying(property_id)];
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -760,12 +839,12 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
+    if (m_property_values == other.m_property_values)
+        return true;
 
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (size_t i = 0; i < m_property_values->values.size(); ++i) {
+        auto const& my_style = m_property_values->values[i];
+        auto const& other_style = other.m_property_values->values[i];
         if (!my_style) {
             if (other_style)
                 return false;
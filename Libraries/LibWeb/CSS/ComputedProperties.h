@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -37,9 +38,10 @@ public:
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback((PropertyID)i, *m_property_values[i]);
+        auto const& values = m_property_values->values;
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (values[i])
+                callback((PropertyID)i, *values[i]);
         }
     }
 
@@ -252,6 +254,23 @@ public:
         m_attempted_pseudo_class_matches = results;
     }
 
+    // NOTE: The property values themselves are kept in a separate copy-on-write object, so that elements that
+    //       end up with exactly the same values (which is common on repetitive pages) can share one copy.
+    struct PropertyValues : public RefCounted<PropertyValues> {
+        PropertyValues() = default;
+        PropertyValues(PropertyValues const&);
+        ~PropertyValues();
+
+        unsigned compute_hash() const;
+        bool operator==(PropertyValues const&) const;
+
+        Array<RefPtr<CSSStyleValue const>, number_of_properties> values;
+        Array<u8, ceil_div(number_of_properties, 8uz)> important {};
+        Array<u8, ceil_div(number_of_properties, 8uz)> inherited {};
+        unsigned hash { 0 };
+        bool is_interned { false };
+    };
+
 private:
     friend class StyleComputer;
 
@@ -265,9 +284,10 @@ private:
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<CSSStyleValue const>, number_of_properties> m_property_values;
-    Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
-    Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
+    PropertyValues& mutable_property_values();
+    void share_property_values_if_possible();
+
+    NonnullRefPtr<PropertyValues> m_property_values;
 
     HashMap<PropertyID, NonnullRefPtr<CSSStyleValue const>> m_animated_property_values;
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibGfx/Font/WOFF/Loader.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
+
+namespace Web::CSS {
+
+DecodedFontCache& DecodedFontCache::the()
+{
+    static DecodedFontCache cache;
+    return cache;
+}
+
+DecodedFontCache::Digest DecodedFontCache::digest_of(ReadonlyBytes bytes)
+{
+    return Crypto::Hash::SHA256::hash(bytes.data(), bytes.size());
+}
+
+RefPtr<Gfx::Typeface const> DecodedFontCache::get(Digest const& digest, Optional<Gfx::FontFormat> format)
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].digest != digest || m_entries[i].format != format)
+            continue;
+
+        auto entry = m_entries.take(i);
+        auto typeface = entry.typeface;
+        m_entries.append(move(entry));
+        return typeface;
+    }
+    return {};
+}
+
+void DecodedFontCache::set(Digest const& digest, Optional<Gfx::FontFormat> format, NonnullRefPtr<Gfx::Typeface const> typeface, size_t byte_size)
+{
+    if (byte_size > max_total_byte_size)
+        return;
+
+    m_entries.remove_first_matching([&](auto const& entry) {
+        if (entry.digest != digest || entry.format != format)
+            return false;
+        m_total_byte_size -= entry.byte_size;
+        return true;
+    });
+
+    while (m_total_byte_size + byte_size > max_total_byte_size)
+        m_total_byte_size -= m_entries.take_first().byte_size;
+
+    m_entries.append({ digest, format, move(typeface), byte_size });
+    m_total_byte_size += byte_size;
+}
+
+void DecodedFontCache::clear()
+{
+    m_entries.clear();
+    m_total_byte_size = 0;
+}
+
+ErrorOr<NonnullRefPtr<Gfx::Typeface const>> decode_font(ReadonlyBytes bytes, Optional<Gfx::FontFormat> format)
+{
+    if (!format.has_value() || format == Gfx::FontFormat::TrueType || format == Gfx::FontFormat::OpenType) {
+        if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error() || format.has_value())
+            return result;
+    }
+    if (!format.has_value() || format == Gfx::FontFormat::WOFF) {
+        if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error() || format.has_value())
+            return result;
+    }
+    if (!format.has_value() || format == Gfx::FontFormat::WOFF2) {
+        if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error() || format.has_value())
+            return result;
+    }
+    return Error::from_string_literal("Automatic format detection failed");
+}
+
+void decode_font_in_background(ByteBuffer bytes, Optional<Gfx::FontFormat> format, Function<void(RefPtr<Gfx::Typeface const>)> on_complete)
+{
+    // OPTIMIZATION: Decompressing WOFF and WOFF2 fonts takes a while for large fonts, and so does hashing them. Neither
+    //               touches anything but the bytes, so both happen on the thread pool. Only the cache lookup (and
+    //               whatever on_complete does with the font) needs the main thread.
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().enqueue([&main_thread_event_loop, bytes = move(bytes), format, on_complete = move(on_complete)]() mutable {
+        auto digest = DecodedFontCache::digest_of(bytes);
+
+        main_thread_event_loop.deferred_invoke([&main_thread_event_loop, bytes = move(bytes), digest, format, on_complete = move(on_complete)]() mutable {
+            if (auto typeface = DecodedFontCache::the().get(digest, format)) {
+                on_complete(move(typeface));
+                return;
+            }
+
+            Threading::ThreadPool::the().enqueue([&main_thread_event_loop, bytes = move(bytes), digest, format, on_complete = move(on_complete)]() mutable {
+                auto typeface_or_error = decode_font(bytes, format);
+
+                main_thread_event_loop.deferred_invoke([byte_size = bytes.size(), digest, format, typeface_or_error = move(typeface_or_error), on_complete = move(on_complete)]() mutable {
+                    if (typeface_or_error.is_error()) {
+                        on_complete(nullptr);
+                        return;
+                    }
+                    DecodedFontCache::the().set(digest, format, typeface_or_error.value(), byte_size);
+                    on_complete(typeface_or_error.release_value());
+                });
+                main_thread_event_loop.wake();
+            });
+        });
+        main_thread_event_loop.wake();
+    });
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibCrypto/Hash/HashFunction.h>
+#include <LibGfx/Font/FontSupport.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Web::CSS {
+
+// Web fonts that were decoded in this process, so that documents (and iframes) using the same fonts can share them
+// instead of each decoding their own copy.
+// NOTE: Typefaces aren't safe to share between threads, so this is only ever used on the main thread.
+class DecodedFontCache {
+public:
+    using Digest = Crypto::Hash::Digest<256>;
+
+    static constexpr size_t max_total_byte_size = 64 * MiB;
+
+    static DecodedFontCache& the();
+    static Digest digest_of(ReadonlyBytes);
+
+    // Without a format, the font was decoded as whichever supported format it turned out to be in. The byte size is
+    // that of the font file.
+    RefPtr<Gfx::Typeface const> get(Digest const&, Optional<Gfx::FontFormat>);
+    void set(Digest const&, Optional<Gfx::FontFormat>, NonnullRefPtr<Gfx::Typeface const>, size_t byte_size);
+
+    void clear();
+
+private:
+    struct Entry {
+        Digest digest;
+        Optional<Gfx::FontFormat> format;
+        NonnullRefPtr<Gfx::Typeface const> typeface;
+        size_t byte_size { 0 };
+    };
+
+    // NOTE: Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    size_t m_total_byte_size { 0 };
+};
+
+ErrorOr<NonnullRefPtr<Gfx::Typeface const>> decode_font(ReadonlyBytes, Optional<Gfx::FontFormat>);
+
+// Decodes a font on the thread pool, unless the same font was decoded before, and then calls on_complete with the
+// result on the main thread.
+void decode_font_in_background(ByteBuffer, Optional<Gfx::FontFormat>, Function<void(RefPtr<Gfx::Typeface const>)> on_complete);
+
+}
@@ -15,6 +15,7 @@
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/PhaseTimings.h>
 
 namespace Web {
 
@@ -42,8 +43,39 @@ GC::Ref<JS::Realm> internal_css_realm()
     return *realm;
 }
 
+static constexpr size_t minimum_source_length_for_cached_style_sheet_rules = 4 * KiB;
+static constexpr size_t maximum_number_of_cached_style_sheet_rules = 16;
+
+struct CachedStyleSheetRules {
+    String source_text;
+    Vector<CSS::Parser::Rule> rules;
+};
+
+static CachedStyleSheetRules const& cached_style_sheet_rules_for(String const& source_text)
+{
+    // NOTE: Ordered from least to most recently used.
+    static Vector<NonnullOwnPtr<CachedStyleSheetRules>> s_cached_style_sheet_rules;
+
+    for (size_t i = 0; i < s_cached_style_sheet_rules.size(); ++i) {
+        if (s_cached_style_sheet_rules[i]->source_text != source_text)
+            continue;
+        auto entry = s_cached_style_sheet_rules.take(i);
+        s_cached_style_sheet_rules.append(move(entry));
+        return *s_cached_style_sheet_rules.last();
+    }
+
+    if (s_cached_style_sheet_rules.size() >= maximum_number_of_cached_style_sheet_rules)
+        s_cached_style_sheet_rules.take_first();
+
+    auto rules = CSS::Parser::Parser::create(CSS::Parser::ParsingParams {}, source_text).parse_as_stylesheet_rules();
+    s_cached_style_sheet_rules.append(make<CachedStyleSheetRules>(CachedStyleSheetRules { source_text, move(rules) }));
+    return *s_cached_style_sheet_rules.last();
+}
+
 GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams const& context, StringView css, Optional<::URL::URL> location, Vector<NonnullRefPtr<CSS::MediaQuery>> media_query_list)
 {
+    PhaseTimer phase_timer { Phase::CSSParse };
+
     if (css.is_empty()) {
         auto rule_list = CSS::CSSRuleList::create(*context.realm);
         auto media_list = CSS::MediaList::create(*context.realm, {});
@@ -51,6 +83,19 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
         style_sheet->set_source_text({});
         return style_sheet;
     }
+
+    // OPTIMIZATION: Tokenizing a style sheet and consuming it into rules only depends on its source text, so the rules
+    //               of recently parsed large style sheets are kept around. Documents that load the same style sheet
+    //               (e.g. after a same-site navigation, or from several iframes) then only have to convert the rules.
+    if (css.length() >= minimum_source_length_for_cached_style_sheet_rules && context.rule_context.is_empty()) {
+        // FIXME: Avoid this copy
+        auto source_text = MUST(String::from_utf8(css));
+        auto const& cached_rules = cached_style_sheet_rules_for(source_text);
+        auto style_sheet = CSS::Parser::Parser::create(context, ""sv).convert_to_css_stylesheet(cached_rules.rules, move(location), move(media_query_list));
+        style_sheet->set_source_text(cached_rules.source_text);
+        return style_sheet;
+    }
+
     auto style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location, move(media_query_list));
     // FIXME: Avoid this copy
     style_sheet->set_source_text(MUST(String::from_utf8(css)));
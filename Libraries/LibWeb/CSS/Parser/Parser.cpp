@@ -175,7 +175,17 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     // To parse a CSS stylesheet, first parse a stylesheet.
     auto const& style_sheet = parse_a_stylesheet(m_token_stream, location);
 
-    auto rule_list = CSSRuleList::create(realm(), convert_rules(style_sheet.rules));
+    return convert_to_css_stylesheet(style_sheet.rules, move(location), move(media_query_list));
+}
+
+Vector<Rule> Parser::parse_as_stylesheet_rules()
+{
+    return parse_a_stylesheets_contents(m_token_stream);
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::convert_to_css_stylesheet(Vector<Rule> const& raw_rules, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list)
+{
+    auto rule_list = CSSRuleList::create(realm(), convert_rules(raw_rules));
     auto media_list = MediaList::create(realm(), move(media_query_list));
     return CSSStyleSheet::create(realm(), rule_list, media_list, move(location));
 }
@@ -96,6 +96,8 @@ public:
 
     GC::RootVector<GC::Ref<CSSRule>> convert_rules(Vector<Rule> const& raw_rules);
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
+    Vector<Rule> parse_as_stylesheet_rules();
+    GC::Ref<CSS::CSSStyleSheet> convert_to_css_stylesheet(Vector<Rule> const& raw_rules, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
 
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
@@ -545,6 +545,28 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // Let result initially be an empty string.
     StringBuilder result;
 
+    // OPTIMIZATION: Most ident sequences are plain ASCII without escapes, so we take as much of that as we can straight
+    //               from the input, instead of consuming it code point by code point.
+    auto remaining = remaining_input();
+    size_t ascii_length = 0;
+    while (ascii_length < remaining.size() && is_ascii(remaining[ascii_length]) && is_ident_code_point(remaining[ascii_length]))
+        ++ascii_length;
+    auto ascii_prefix = remaining.trim(ascii_length);
+    skip_bytes(ascii_length);
+
+    if (ascii_length == remaining.size())
+        return FlyString::from_utf8_without_validation(ascii_prefix);
+
+    if (auto next_byte = remaining[ascii_length]; is_ascii(next_byte) && !is_reverse_solidus(next_byte)) {
+        // NOTE: This leaves things as if the code point after the ident sequence had been consumed and reconsumed,
+        //       just like the loop below does.
+        m_prev_utf8_iterator = m_utf8_iterator;
+        m_prev_position = m_position;
+        return FlyString::from_utf8_without_validation(ascii_prefix);
+    }
+
+    result.append(StringView { ascii_prefix });
+
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
         auto input = next_code_point();
@@ -703,9 +725,12 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
-    }
+    // NOTE: Whitespace is always ASCII, so we don't need to decode the input to find the end of it.
+    auto remaining = remaining_input();
+    size_t length = 0;
+    while (length < remaining.size() && is_whitespace(remaining[length]))
+        ++length;
+    skip_bytes(length);
 }
 
 void Tokenizer::reconsume_current_input_code_point()
@@ -875,6 +900,22 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
     auto original_source_text_start_byte_offset_including_quotation_mark = current_byte_offset() - 1;
     StringBuilder builder;
 
+    // OPTIMIZATION: Up to the first escape or newline, the value of the string is just the input, so we take it from
+    //               there directly. If the string ends before any of those, we don't need to build up a new string.
+    auto remaining = remaining_input();
+    size_t plain_length = 0;
+    while (plain_length < remaining.size() && remaining[plain_length] != ending_code_point && !is_reverse_solidus(remaining[plain_length]) && !is_newline(remaining[plain_length]))
+        ++plain_length;
+    auto plain_prefix = remaining.trim(plain_length);
+    skip_bytes(plain_length);
+
+    if (plain_length < remaining.size() && remaining[plain_length] == ending_code_point) {
+        (void)next_code_point();
+        return Token::create_string(FlyString::from_utf8_without_validation(plain_prefix), input_since(original_source_text_start_byte_offset_including_quotation_mark));
+    }
+
+    builder.append(StringView { plain_prefix });
+
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
         auto input = next_code_point();
@@ -945,6 +986,12 @@ start:
     (void)next_code_point();
     (void)next_code_point();
 
+    // OPTIMIZATION: Search for the end of the comment in the input bytes, rather than code point by code point.
+    if (auto comment_length = StringView { remaining_input() }.find("*/"sv); comment_length.has_value()) {
+        skip_bytes(*comment_length + 2);
+        goto start;
+    }
+
     for (;;) {
         auto twin_inner = peek_twin();
         if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
@@ -1238,4 +1285,38 @@ String Tokenizer::input_since(size_t offset) const
     return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
 }
 
+ReadonlyBytes Tokenizer::remaining_input() const
+{
+    return m_utf8_view.as_string().bytes().slice(current_byte_offset());
+}
+
+// Consumes the code points making up the next byte_count bytes of the input, which must end on a code point boundary.
+// This leaves the tokenizer in the same state as calling next_code_point() for each of them would.
+void Tokenizer::skip_bytes(size_t byte_count)
+{
+    if (byte_count == 0)
+        return;
+
+    auto bytes = remaining_input().trim(byte_count);
+    size_t last_code_point_offset = 0;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        // NOTE: Continuation bytes are part of the preceding code point.
+        if ((bytes[i] & 0xC0) == 0x80)
+            continue;
+
+        last_code_point_offset = i;
+        m_prev_position = m_position;
+        if (is_newline(bytes[i])) {
+            m_position.line++;
+            m_position.column = 0;
+        } else {
+            m_position.column++;
+        }
+    }
+
+    auto offset = current_byte_offset();
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + last_code_point_offset);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + byte_count);
+}
+
 }
@@ -70,6 +70,8 @@ private:
 
     size_t current_byte_offset() const;
     String input_since(size_t offset) const;
+    ReadonlyBytes remaining_input() const;
+    void skip_bytes(size_t byte_count);
 
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
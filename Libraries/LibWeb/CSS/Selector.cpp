@@ -8,6 +8,7 @@
 #include "Selector.h"
 #include <AK/GenericShorthands.h>
 #include <LibWeb/CSS/Serialize.h>
+#include <LibWeb/HTML/AttributeNames.h>
 
 namespace Web::CSS {
 
@@ -79,6 +80,26 @@ static bool can_selector_use_fast_matches(Selector const& selector)
     return true;
 }
 
+// https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
+static bool is_attribute_with_case_insensitive_value_in_html(Selector::SimpleSelector::Attribute const& attribute)
+{
+    if (attribute.qualified_name.namespace_type != Selector::SimpleSelector::QualifiedName::NamespaceType::Default)
+        return false;
+    return attribute.qualified_name.name.name.is_one_of(
+        HTML::AttributeNames::accept, HTML::AttributeNames::accept_charset, HTML::AttributeNames::align,
+        HTML::AttributeNames::alink, HTML::AttributeNames::axis, HTML::AttributeNames::bgcolor, HTML::AttributeNames::charset,
+        HTML::AttributeNames::checked, HTML::AttributeNames::clear, HTML::AttributeNames::codetype, HTML::AttributeNames::color,
+        HTML::AttributeNames::compact, HTML::AttributeNames::declare, HTML::AttributeNames::defer, HTML::AttributeNames::dir,
+        HTML::AttributeNames::direction, HTML::AttributeNames::disabled, HTML::AttributeNames::enctype, HTML::AttributeNames::face,
+        HTML::AttributeNames::frame, HTML::AttributeNames::hreflang, HTML::AttributeNames::http_equiv, HTML::AttributeNames::lang,
+        HTML::AttributeNames::language, HTML::AttributeNames::link, HTML::AttributeNames::media, HTML::AttributeNames::method,
+        HTML::AttributeNames::multiple, HTML::AttributeNames::nohref, HTML::AttributeNames::noresize, HTML::AttributeNames::noshade,
+        HTML::AttributeNames::nowrap, HTML::AttributeNames::readonly, HTML::AttributeNames::rel, HTML::AttributeNames::rev,
+        HTML::AttributeNames::rules, HTML::AttributeNames::scope, HTML::AttributeNames::scrolling, HTML::AttributeNames::selected,
+        HTML::AttributeNames::shape, HTML::AttributeNames::target, HTML::AttributeNames::text, HTML::AttributeNames::type,
+        HTML::AttributeNames::valign, HTML::AttributeNames::valuetype, HTML::AttributeNames::vlink);
+}
+
 Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     : m_compound_selectors(move(compound_selectors))
 {
@@ -93,6 +114,15 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
         }
     }
 
+    for (auto& compound_selector : m_compound_selectors) {
+        for (auto& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type == SimpleSelector::Type::Attribute) {
+                auto& attribute = simple_selector.attribute();
+                attribute.default_match_is_case_insensitive_for_html = is_attribute_with_case_insensitive_value_in_html(attribute);
+            }
+        }
+    }
+
     // https://drafts.csswg.org/css-nesting-1/#contain-the-nesting-selector
     // "A selector is said to contain the nesting selector if, when it was parsed as any type of selector,
     // a <delim-token> with the value "&" (U+0026 AMPERSAND) was encountered."
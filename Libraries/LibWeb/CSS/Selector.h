@@ -187,6 +187,9 @@ public:
             QualifiedName qualified_name;
             String value {};
             CaseType case_type;
+            // NOTE: Resolved when the selector is built, so matching doesn't have to check the attribute name against
+            //       the list of attributes whose values HTML compares case-insensitively by default.
+            bool default_match_is_case_insensitive_for_html { false };
         };
 
         struct Invalid {
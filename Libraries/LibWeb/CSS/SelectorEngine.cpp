@@ -248,7 +248,7 @@ static inline bool matches_indeterminate_pseudo_class(DOM::Element const& elemen
     return false;
 }
 
-static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule, DOM::Element const& element, Function<IterationDecision(DOM::Attr const&)> const& process_attribute)
+static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule, DOM::Element const& element, Function<IterationDecision(DOM::AttributeListEntry const&)> const& process_attribute)
 {
     auto const& qualified_name = attribute_selector.qualified_name;
     auto const& attribute_name = qualified_name.name.name;
@@ -257,10 +257,21 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
     // "In keeping with the Namespaces in the XML recommendation, default namespaces do not apply to attributes,
     //  therefore attribute selectors without a namespace component apply only to attributes that have no namespace (equivalent to "|attr")"
     case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Default:
-    case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::None:
-        if (auto const* attribute = element.attributes()->get_attribute(attribute_name))
-            (void)process_attribute(*attribute);
+    case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::None: {
+        // OPTIMIZATION: The selector carries a pre-lowercased copy of the attribute name, so we can look the attribute
+        //               up by FlyString identity instead of comparing each name case-insensitively like get_attribute().
+        bool const compare_as_lowercase = element.namespace_uri() == Namespace::HTML && element.document().is_html_document();
+        auto const& name_to_find = compare_as_lowercase ? qualified_name.name.lowercase_name : attribute_name;
+        auto const& attributes = *element.attributes();
+        for (auto i = 0u; i < attributes.length(); ++i) {
+            auto const& attribute = attributes.entry_at(i);
+            if (attribute.name() == name_to_find) {
+                (void)process_attribute(attribute);
+                break;
+            }
+        }
         return;
+    }
     case CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Any: {
         // When comparing the name part of a CSS attribute selector to the names of attributes on HTML elements in HTML
         // documents, the name part of the CSS attribute selector must first be converted to ASCII lowercase. The same
@@ -269,13 +280,14 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
         // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
         bool const case_insensitive = element.document().is_html_document() && element.namespace_uri() == Namespace::HTML;
 
-        for (auto i = 0u; i < element.attributes()->length(); ++i) {
-            auto const* attr = element.attributes()->item(i);
+        auto const& attributes = *element.attributes();
+        for (auto i = 0u; i < attributes.length(); ++i) {
+            auto const& attribute = attributes.entry_at(i);
             bool matches = case_insensitive
-                ? attr->local_name().equals_ignoring_ascii_case(attribute_name)
-                : attr->local_name() == attribute_name;
+                ? attribute.local_name() == qualified_name.name.lowercase_name
+                : attribute.local_name() == attribute_name;
             if (matches) {
-                if (process_attribute(*attr) == IterationDecision::Break)
+                if (process_attribute(attribute) == IterationDecision::Break)
                     break;
             }
         }
@@ -295,7 +307,7 @@ static inline void for_each_matching_attribute(CSS::Selector::SimpleSelector::At
     VERIFY_NOT_REACHED();
 }
 
-static bool matches_single_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, DOM::Attr const& attribute, CaseSensitivity case_sensitivity)
+static bool matches_single_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute_selector, DOM::AttributeListEntry const& attribute, CaseSensitivity case_sensitivity)
 {
     auto const case_insensitive_match = case_sensitivity == CaseSensitivity::CaseInsensitive;
 
@@ -367,8 +379,6 @@ static bool matches_single_attribute(CSS::Selector::SimpleSelector::Attribute co
 
 static inline bool matches_attribute(CSS::Selector::SimpleSelector::Attribute const& attribute, [[maybe_unused]] GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule, DOM::Element const& element)
 {
-    auto const& attribute_name = attribute.qualified_name.name.name;
-
     auto case_sensitivity = [&](CSS::Selector::SimpleSelector::Attribute::CaseType case_type) {
         switch (case_type) {
         case CSS::Selector::SimpleSelector::Attribute::CaseType::CaseInsensitiveMatch:
@@ -377,22 +387,9 @@ static inline bool matches_attribute(CSS::Selector::SimpleSelector::Attribute co
             return CaseSensitivity::CaseSensitive;
         case CSS::Selector::SimpleSelector::Attribute::CaseType::DefaultMatch:
             // See: https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
-            if (element.document().is_html_document()
-                && element.namespace_uri() == Namespace::HTML
-                && attribute.qualified_name.namespace_type == CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Default
-                && attribute_name.is_one_of(
-                    HTML::AttributeNames::accept, HTML::AttributeNames::accept_charset, HTML::AttributeNames::align,
-                    HTML::AttributeNames::alink, HTML::AttributeNames::axis, HTML::AttributeNames::bgcolor, HTML::AttributeNames::charset,
-                    HTML::AttributeNames::checked, HTML::AttributeNames::clear, HTML::AttributeNames::codetype, HTML::AttributeNames::color,
-                    HTML::AttributeNames::compact, HTML::AttributeNames::declare, HTML::AttributeNames::defer, HTML::AttributeNames::dir,
-                    HTML::AttributeNames::direction, HTML::AttributeNames::disabled, HTML::AttributeNames::enctype, HTML::AttributeNames::face,
-                    HTML::AttributeNames::frame, HTML::AttributeNames::hreflang, HTML::AttributeNames::http_equiv, HTML::AttributeNames::lang,
-                    HTML::AttributeNames::language, HTML::AttributeNames::link, HTML::AttributeNames::media, HTML::AttributeNames::method,
-                    HTML::AttributeNames::multiple, HTML::AttributeNames::nohref, HTML::AttributeNames::noresize, HTML::AttributeNames::noshade,
-                    HTML::AttributeNames::nowrap, HTML::AttributeNames::readonly, HTML::AttributeNames::rel, HTML::AttributeNames::rev,
-                    HTML::AttributeNames::rules, HTML::AttributeNames::scope, HTML::AttributeNames::scrolling, HTML::AttributeNames::selected,
-                    HTML::AttributeNames::shape, HTML::AttributeNames::target, HTML::AttributeNames::text, HTML::AttributeNames::type,
-                    HTML::AttributeNames::valign, HTML::AttributeNames::valuetype, HTML::AttributeNames::vlink)) {
+            if (attribute.default_match_is_case_insensitive_for_html
+                && element.document().is_html_document()
+                && element.namespace_uri() == Namespace::HTML) {
                 return CaseSensitivity::CaseInsensitive;
             }
 
@@ -402,7 +399,7 @@ static inline bool matches_attribute(CSS::Selector::SimpleSelector::Attribute co
     }(attribute.case_type);
 
     bool found_matching_attribute = false;
-    for_each_matching_attribute(attribute, style_sheet_for_rule, element, [&attribute, case_sensitivity, &found_matching_attribute](DOM::Attr const& attr) {
+    for_each_matching_attribute(attribute, style_sheet_for_rule, element, [&attribute, case_sensitivity, &found_matching_attribute](DOM::AttributeListEntry const& attr) {
         if (matches_single_attribute(attribute, attr, case_sensitivity)) {
             found_matching_attribute = true;
             return IterationDecision::Break;
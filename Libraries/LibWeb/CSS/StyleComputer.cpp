@@ -21,8 +21,6 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/FontStyleMapping.h>
 #include <LibGfx/Font/Typeface.h>
-#include <LibGfx/Font/WOFF/Loader.h>
-#include <LibGfx/Font/WOFF2/Loader.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
@@ -37,6 +35,7 @@
 #include <LibWeb/CSS/CSSStyleRule.h>
 #include <LibWeb/CSS/CSSTransition.h>
 #include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
 #include <LibWeb/CSS/Fetch.h>
 #include <LibWeb/CSS/Interpolation.h>
 #include <LibWeb/CSS/InvalidationSet.h>
@@ -73,9 +72,9 @@
 #include <LibWeb/CSS/StyleValues/TransformationStyleValue.h>
 #include <LibWeb/CSS/StyleValues/TransitionStyleValue.h>
 #include <LibWeb/CSS/StyleValues/UnresolvedStyleValue.h>
-#include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
@@ -240,23 +239,17 @@ void FontLoader::start_loading_next_url()
             // 2. Load a font from stream according to its type.
 
             // NB: We need to fetch the next source if this one fails to fetch OR decode. So, first try to decode it.
-            RefPtr<Gfx::Typeface const> typeface;
             if (auto* bytes = stream.template get_pointer<ByteBuffer>()) {
-                if (auto maybe_typeface = loader.try_load_font(response, *bytes); !maybe_typeface.is_error())
-                    typeface = maybe_typeface.release_value();
-            }
-
-            if (!typeface) {
-                // NB: If we have other sources available, try the next one.
-                if (loader.m_urls.is_empty()) {
-                    loader.font_did_load_or_fail(nullptr);
-                } else {
-                    loader.m_fetch_controller = nullptr;
-                    loader.start_loading_next_url();
+                if (auto format = font_format_for_response(response, *bytes); format.has_value()) {
+                    decode_font_in_background(move(*bytes), format, [weak_loader](RefPtr<Gfx::Typeface const> typeface) {
+                        if (!weak_loader.is_null())
+                            weak_loader->font_did_decode_or_fail(move(typeface));
+                    });
+                    return;
                 }
-            } else {
-                loader.font_did_load_or_fail(move(typeface));
             }
+
+            loader.font_did_decode_or_fail(nullptr);
         });
 
     if (maybe_fetch_controller.is_error()) {
@@ -280,7 +273,23 @@ void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
     m_fetch_controller = nullptr;
 }
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
+void FontLoader::font_did_decode_or_fail(RefPtr<Gfx::Typeface const> typeface)
+{
+    if (typeface) {
+        font_did_load_or_fail(move(typeface));
+        return;
+    }
+
+    // NB: If we have other sources available, try the next one.
+    if (m_urls.is_empty()) {
+        font_did_load_or_fail(nullptr);
+    } else {
+        m_fetch_controller = nullptr;
+        start_loading_next_url();
+    }
+}
+
+Optional<Gfx::FontFormat> FontLoader::font_format_for_response(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
 {
     // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
     auto mime_type = response.header_list()->extract_mime_type();
@@ -288,24 +297,17 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Inf
         mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
     }
     if (mime_type.has_value()) {
-        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
-            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
-            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
-            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
+        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv)
+            return Gfx::FontFormat::TrueType;
+        if (mime_type->essence() == "font/otf"sv)
+            return Gfx::FontFormat::OpenType;
+        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv)
+            return Gfx::FontFormat::WOFF;
+        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv)
+            return Gfx::FontFormat::WOFF2;
     }
 
-    return Error::from_string_literal("Automatic format detection failed");
+    return {};
 }
 
 struct StyleComputer::MatchingFontCandidate {
@@ -332,7 +334,7 @@ static CSSStyleSheet& default_stylesheet()
 {
     static GC::Root<CSSStyleSheet> sheet;
     if (!sheet.cell()) {
-        extern String default_stylesheet_source;
+        extern StringView default_stylesheet_source;
         sheet = GC::make_root(parse_css_stylesheet(CSS::Parser::ParsingParams(internal_css_realm()), default_stylesheet_source));
     }
     return *sheet;
@@ -342,7 +344,7 @@ static CSSStyleSheet& quirks_mode_stylesheet()
 {
     static GC::Root<CSSStyleSheet> sheet;
     if (!sheet.cell()) {
-        extern String quirks_mode_stylesheet_source;
+        extern StringView quirks_mode_stylesheet_source;
         sheet = GC::make_root(parse_css_stylesheet(CSS::Parser::ParsingParams(internal_css_realm()), quirks_mode_stylesheet_source));
     }
     return *sheet;
@@ -352,7 +354,7 @@ static CSSStyleSheet& mathml_stylesheet()
 {
     static GC::Root<CSSStyleSheet> sheet;
     if (!sheet.cell()) {
-        extern String mathml_stylesheet_source;
+        extern StringView mathml_stylesheet_source;
         sheet = GC::make_root(parse_css_stylesheet(CSS::Parser::ParsingParams(internal_css_realm()), mathml_stylesheet_source));
     }
     return *sheet;
@@ -362,7 +364,7 @@ static CSSStyleSheet& svg_stylesheet()
 {
     static GC::Root<CSSStyleSheet> sheet;
     if (!sheet.cell()) {
-        extern String svg_stylesheet_source;
+        extern StringView svg_stylesheet_source;
         sheet = GC::make_root(parse_css_stylesheet(CSS::Parser::ParsingParams(internal_css_realm()), svg_stylesheet_source));
     }
     return *sheet;
@@ -370,22 +372,32 @@ static CSSStyleSheet& svg_stylesheet()
 
 Optional<String> StyleComputer::user_agent_style_sheet_source(StringView name)
 {
-    extern String default_stylesheet_source;
-    extern String quirks_mode_stylesheet_source;
-    extern String mathml_stylesheet_source;
-    extern String svg_stylesheet_source;
+    extern StringView default_stylesheet_source;
+    extern StringView quirks_mode_stylesheet_source;
+    extern StringView mathml_stylesheet_source;
+    extern StringView svg_stylesheet_source;
 
     if (name == "CSS/Default.css"sv)
-        return default_stylesheet_source;
+        return MUST(String::from_utf8(default_stylesheet_source));
     if (name == "CSS/QuirksMode.css"sv)
-        return quirks_mode_stylesheet_source;
+        return MUST(String::from_utf8(quirks_mode_stylesheet_source));
     if (name == "MathML/Default.css"sv)
-        return mathml_stylesheet_source;
+        return MUST(String::from_utf8(mathml_stylesheet_source));
     if (name == "SVG/Default.css"sv)
-        return svg_stylesheet_source;
+        return MUST(String::from_utf8(svg_stylesheet_source));
     return {};
 }
 
+void StyleComputer::load_user_agent_style_sheets()
+{
+    // OPTIMIZATION: The UA style sheets are parsed lazily when the first document computes style. Processes that are
+    //               started ahead of time can call this to get that out of the way before a page is loaded.
+    (void)default_stylesheet();
+    (void)quirks_mode_stylesheet();
+    (void)mathml_stylesheet();
+    (void)svg_stylesheet();
+}
+
 template<typename Callback>
 void StyleComputer::for_each_stylesheet(CascadeOrigin cascade_origin, Callback callback) const
 {
@@ -460,6 +472,19 @@ InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<Invalidati
     return result;
 }
 
+SiblingInvalidationSet StyleComputer::sibling_invalidation_set_for_properties(Vector<InvalidationSet::Property> const& properties) const
+{
+    if (!m_style_invalidation_data)
+        return {};
+    auto const& sibling_invalidation_sets = m_style_invalidation_data->sibling_invalidation_sets;
+    SiblingInvalidationSet result;
+    for (auto const& property : properties) {
+        if (auto it = sibling_invalidation_sets.find(property); it != sibling_invalidation_sets.end())
+            result.include_all_from(it->value);
+    }
+    return result;
+}
+
 bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::Property const& property) const
 {
     if (!m_style_invalidation_data)
@@ -868,6 +893,82 @@ void StyleComputer::for_each_property_expanding_shorthands(PropertyID property_i
     set_longhand_property(property_id, value);
 }
 
+// Collects the names of the custom properties that var() functions in the given values refer to, including those in
+// fallbacks. Returns false if substituting the values depends on anything else, like an attr() or a computed var() name.
+static bool collect_custom_properties_referenced_by_var_functions(Vector<Parser::ComponentValue> const& values, Vector<FlyString>& names)
+{
+    for (auto const& value : values) {
+        if (value.is_block()) {
+            if (!collect_custom_properties_referenced_by_var_functions(value.block().value, names))
+                return false;
+            continue;
+        }
+
+        if (!value.is_function())
+            continue;
+
+        auto const& function = value.function();
+        if (auto function_id = Parser::to_arbitrary_substitution_function(function.name); function_id.has_value()) {
+            if (*function_id != Parser::ArbitrarySubstitutionFunction::Var)
+                return false;
+
+            auto first_non_whitespace = function.value.find_if([](auto const& argument) { return !argument.is(Parser::Token::Type::Whitespace); });
+            if (first_non_whitespace == function.value.end() || !first_non_whitespace->is(Parser::Token::Type::Ident))
+                return false;
+            if (auto const& name = first_non_whitespace->token().ident(); !names.contains_slow(name))
+                names.append(name);
+        }
+
+        if (!collect_custom_properties_referenced_by_var_functions(function.value, names))
+            return false;
+    }
+    return true;
+}
+
+NonnullRefPtr<CSSStyleValue const> StyleComputer::resolve_unresolved_style_value(DOM::Element& element, Optional<PseudoElement> pseudo_element, PropertyID property_id, UnresolvedStyleValue const& unresolved) const
+{
+    auto resolve = [&] {
+        return Parser::Parser::resolve_unresolved_style_value(Parser::ParsingParams { element.document() }, element, pseudo_element, property_id, unresolved);
+    };
+
+    // OPTIMIZATION: Declarations that use var() tend to be matched by lots of elements that all see the same values for
+    //               the custom properties involved, for example when those are design tokens set on :root. As the result
+    //               of substitution only depends on those values, we can reuse it for all of them instead of substituting
+    //               and parsing again for each element.
+    auto& entry = *m_substituted_value_cache.ensure(&unresolved, [&] {
+        auto entry = adopt_own(*new SubstitutedValueCacheEntry { .unresolved_value = unresolved });
+        Vector<FlyString> names;
+        if (collect_custom_properties_referenced_by_var_functions(unresolved.values(), names))
+            entry->referenced_custom_properties = move(names);
+        return entry;
+    });
+    if (!entry.referenced_custom_properties.has_value())
+        return resolve();
+
+    DOM::AbstractElement abstract_element { element, pseudo_element };
+    Vector<ValueComparingNonnullRefPtr<CSSStyleValue const>> custom_property_values;
+    custom_property_values.ensure_capacity(entry.referenced_custom_properties->size());
+    for (auto const& name : *entry.referenced_custom_properties)
+        custom_property_values.unchecked_append(compute_value_of_custom_property(abstract_element, name));
+
+    // NOTE: Resolving the value marks the element as relying on custom properties, so that has to happen either way.
+    element.set_style_uses_css_custom_properties(true);
+
+    for (auto const& substituted_value : entry.substituted_values) {
+        if (substituted_value.property_id == property_id && substituted_value.custom_property_values == custom_property_values)
+            return substituted_value.value;
+    }
+
+    auto value = resolve();
+    if (entry.substituted_values.size() == max_substituted_values_per_declaration)
+        entry.substituted_values.take_first();
+    entry.substituted_values.append({ .property_id = property_id, .custom_property_values = move(custom_property_values), .value = value });
+
+    if (m_substituted_value_cache.size() > max_substituted_value_cache_size)
+        m_substituted_value_cache.clear();
+    return value;
+}
+
 void StyleComputer::cascade_declarations(
     CascadedProperties& cascaded_properties,
     DOM::Element& element,
@@ -899,7 +1000,7 @@ void StyleComputer::cascade_declarations(
             auto property_value = property.value;
 
             if (property_value->is_unresolved())
-                property_value = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingParams { element.document() }, element, pseudo_element, property.property_id, property_value->as_unresolved());
+                property_value = resolve_unresolved_style_value(element, pseudo_element, property.property_id, property_value->as_unresolved());
 
             if (property_value->is_guaranteed_invalid()) {
                 // https://drafts.csswg.org/css-values-5/#invalid-at-computed-value-time
@@ -1574,6 +1675,113 @@ StyleComputer::MatchingRuleSet StyleComputer::build_matching_rule_set(DOM::Eleme
     return matching_rule_set;
 }
 
+bool StyleComputer::can_be_style_sharing_candidate(DOM::Element const& element)
+{
+    // NOTE: Rule matching for shadow hosts and elements with an ID depends on more than what we compare below.
+    if (element.shadow_root() || element.id().has_value())
+        return false;
+
+    // NOTE: These mean that the selectors that matched depend on the element's siblings or descendants.
+    if (element.style_affected_by_structural_changes()
+        || element.affected_by_has_pseudo_class_in_subject_position()
+        || element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+        return false;
+
+    return true;
+}
+
+static bool is_involved_in_dynamic_pseudo_class_state(DOM::Element const& element)
+{
+    auto const& document = element.document();
+    auto is_involved = [&](DOM::Node const* node) {
+        return node && element.is_shadow_including_inclusive_ancestor_of(*node);
+    };
+    return is_involved(document.hovered_node())
+        || is_involved(document.focused_element())
+        || is_involved(document.active_element())
+        || is_involved(document.target_element());
+}
+
+// OPTIMIZATION: Long runs of siblings like `<li class="row">` or table cells usually match exactly the same rules.
+//               If the previous element sibling was just styled, and nothing that selectors can observe differs
+//               between the two elements, we reuse its matched rules instead of running selector matching again.
+//               The cascade and everything after it still runs for each element.
+StyleComputer::MatchingRuleSet const* StyleComputer::find_shareable_matching_rule_set(DOM::Element const& element, PseudoClassBitmap& attempted_pseudo_class_matches) const
+{
+    if (!m_style_sharing_candidate.has_value())
+        return nullptr;
+
+    auto const& candidate = *m_style_sharing_candidate->element;
+    if (element.previous_element_sibling() != &candidate)
+        return nullptr;
+
+    if (!can_be_style_sharing_candidate(element) || !can_be_style_sharing_candidate(candidate))
+        return nullptr;
+
+    if (element.local_name() != candidate.local_name() || element.namespace_uri() != candidate.namespace_uri())
+        return nullptr;
+
+    if (element.class_names() != candidate.class_names())
+        return nullptr;
+
+    auto attribute_count = element.attribute_list_size();
+    if (attribute_count != candidate.attribute_list_size())
+        return nullptr;
+    if (attribute_count > 0) {
+        auto const& attributes = *element.attributes();
+        auto const& candidate_attributes = *candidate.attributes();
+        for (u32 i = 0; i < attribute_count; ++i) {
+            auto const& attribute = *attributes.item(i);
+            auto const& candidate_attribute = *candidate_attributes.item(i);
+            if (attribute.local_name() != candidate_attribute.local_name()
+                || attribute.namespace_uri() != candidate_attribute.namespace_uri()
+                || attribute.value() != candidate_attribute.value())
+                return nullptr;
+        }
+    }
+
+    // Finally, make sure every pseudo-class the candidate's rules looked at would give the same answer for this element.
+    // Since the two elements are siblings, anything evaluated against their ancestors is the same for both.
+    auto const& candidate_attempted_pseudo_class_matches = m_style_sharing_candidate->attempted_pseudo_class_matches;
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (!candidate_attempted_pseudo_class_matches.get(pseudo_class))
+            continue;
+        switch (pseudo_class) {
+        // These only depend on the element's tag name, attributes and ancestors, which we already compared.
+        case PseudoClass::AnyLink:
+        case PseudoClass::Is:
+        case PseudoClass::Lang:
+        case PseudoClass::Link:
+        case PseudoClass::LocalLink:
+        case PseudoClass::Not:
+        case PseudoClass::Root:
+        case PseudoClass::Scope:
+        case PseudoClass::Visited:
+        case PseudoClass::Where:
+            break;
+        case PseudoClass::Defined:
+            if (element.is_defined() != candidate.is_defined())
+                return nullptr;
+            break;
+        case PseudoClass::Active:
+        case PseudoClass::Focus:
+        case PseudoClass::FocusVisible:
+        case PseudoClass::FocusWithin:
+        case PseudoClass::Hover:
+        case PseudoClass::Target:
+            if (is_involved_in_dynamic_pseudo_class_state(element) || is_involved_in_dynamic_pseudo_class_state(candidate))
+                return nullptr;
+            break;
+        default:
+            return nullptr;
+        }
+    }
+
+    attempted_pseudo_class_matches |= candidate_attempted_pseudo_class_matches;
+    return &m_style_sharing_candidate->matching_rule_set;
+}
+
 // https://www.w3.org/TR/css-cascade/#cascading
 // https://drafts.csswg.org/css-cascade-5/#layering
 GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element& element, Optional<CSS::PseudoElement> pseudo_element, bool did_match_any_pseudo_element_rules, ComputeStyleMode mode, MatchingRuleSet const& matching_rule_set, Optional<LogicalAliasMappingContext> logical_alias_mapping_context, ReadonlySpan<PropertyID> properties_to_cascade) const
@@ -1655,7 +1863,7 @@ NonnullRefPtr<CSSStyleValue const> StyleComputer::get_inherit_value(CSS::Propert
 
 void StyleComputer::compute_defaulted_property_value(ComputedProperties& style, DOM::Element const* element, CSS::PropertyID property_id, Optional<CSS::PseudoElement> pseudo_element) const
 {
-    auto& value_slot = style.m_property_values[to_underlying(property_id)];
+    auto& value_slot = style.mutable_property_values().values[to_underlying(property_id)];
     if (!value_slot) {
         if (is_inherited_property(property_id)) {
             style.set_property(
@@ -2197,8 +2405,10 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
         style.first_available_computed_font().pixel_metrics()
     };
 
+    auto& property_values = style.mutable_property_values().values;
+
     // "A percentage value specifies an absolute font size relative to the parent element’s computed font-size. Negative percentages are invalid."
-    auto& font_size_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::FontSize)];
+    auto& font_size_value_slot = property_values[to_underlying(CSS::PropertyID::FontSize)];
     if (font_size_value_slot && font_size_value_slot->is_percentage()) {
         auto parent_font_size = get_inherit_value(CSS::PropertyID::FontSize, element)->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
         font_size_value_slot = LengthStyleValue::create(
@@ -2213,7 +2423,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
+    auto& line_height_value_slot = property_values[to_underlying(CSS::PropertyID::LineHeight)];
     if (line_height_value_slot && line_height_value_slot->is_percentage()) {
         line_height_value_slot = LengthStyleValue::create(
             Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
@@ -2226,8 +2436,8 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     if (line_height_value_slot && line_height_value_slot->is_length())
         line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
+    for (size_t i = 0; i < property_values.size(); ++i) {
+        auto& value_slot = property_values[i];
         if (!value_slot)
             continue;
         value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
@@ -2469,20 +2679,30 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
-    auto matching_rule_set = build_matching_rule_set(element, pseudo_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode);
+    Optional<MatchingRuleSet> matching_rule_set;
+    bool can_share_matching_rules = mode == ComputeStyleMode::Normal && !pseudo_element.has_value();
+    if (can_share_matching_rules) {
+        if (auto const* shared_matching_rule_set = find_shareable_matching_rule_set(element, attempted_pseudo_class_matches))
+            matching_rule_set = *shared_matching_rule_set;
+    }
+    if (!matching_rule_set.has_value()) {
+        matching_rule_set = build_matching_rule_set(element, pseudo_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode);
+        if (can_share_matching_rules && can_be_style_sharing_candidate(element))
+            m_style_sharing_candidate = StyleSharingCandidate { element, *matching_rule_set, attempted_pseudo_class_matches };
+    }
 
     // Resolve all the CSS custom properties ("variables") for this element:
     // FIXME: Also resolve !important custom properties, in a second cascade.
     if (!pseudo_element.has_value() || pseudo_element_supports_property(*pseudo_element, PropertyID::Custom)) {
         HashMap<FlyString, CSS::StyleProperty> custom_properties;
-        for (auto& layer : matching_rule_set.author_rules) {
+        for (auto& layer : matching_rule_set->author_rules) {
             cascade_custom_properties(element, pseudo_element, layer.rules, custom_properties);
         }
         element.set_custom_properties(pseudo_element, move(custom_properties));
     }
 
-    auto logical_alias_mapping_context = compute_logical_alias_mapping_context(element, pseudo_element, mode, matching_rule_set);
-    auto cascaded_properties = compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+    auto logical_alias_mapping_context = compute_logical_alias_mapping_context(element, pseudo_element, mode, *matching_rule_set);
+    auto cascaded_properties = compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, mode, *matching_rule_set, logical_alias_mapping_context, {});
     element.set_cascaded_properties(pseudo_element, cascaded_properties);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -2750,6 +2970,8 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::Element& elem
         start_needed_transitions(*previous_style, computed_style, element, pseudo_element);
     }
 
+    computed_style->share_property_values_if_possible();
+
     return computed_style;
 }
 
@@ -3043,6 +3265,10 @@ void StyleComputer::build_rule_cache()
 void StyleComputer::invalidate_rule_cache()
 {
     m_author_rule_cache = nullptr;
+    m_substituted_value_cache.clear();
+
+    // NOTE: The style sharing cache refers to rules owned by the rule caches.
+    reset_style_sharing_cache();
 
     // NOTE: We could be smarter about keeping the user rule cache, and style sheet.
     //       Currently we are re-parsing the user style sheet every time we build the caches,
@@ -3244,8 +3470,9 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
         callback(element.id().value().hash());
     for (auto const& class_ : element.class_names())
         callback(class_.hash());
-    element.for_each_attribute([&](auto& attribute) {
-        callback(attribute.lowercase_name().hash());
+    // NOTE: Selectors hash the lowercased local name of attributes they look for, so we have to do the same here.
+    element.for_each_attribute([&](DOM::AttributeListEntry const& attribute) {
+        callback(attribute.lowercased_local_name().hash());
     });
 }
 
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <LibGfx/Font/FontSupport.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibWeb/Animations/KeyframeEffect.h>
@@ -132,6 +133,7 @@ public:
     static NonnullRefPtr<CSSStyleValue const> get_inherit_value(CSS::PropertyID, DOM::Element const*, Optional<CSS::PseudoElement> = {});
 
     static Optional<String> user_agent_style_sheet_source(StringView name);
+    static void load_user_agent_style_sheets();
 
     explicit StyleComputer(DOM::Document&);
     ~StyleComputer();
@@ -143,6 +145,8 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    void reset_style_sharing_cache() const { m_style_sharing_candidate.clear(); }
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::Element&, Optional<CSS::PseudoElement> = {}) const;
@@ -153,6 +157,7 @@ public:
     [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::PseudoElement>, PseudoClassBitmap& attempted_psuedo_class_matches, Optional<FlyString const> qualified_layer_name = {}) const;
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
+    SiblingInvalidationSet sibling_invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
     bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&) const;
 
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
@@ -216,6 +221,14 @@ private:
 
     [[nodiscard]] MatchingRuleSet build_matching_rule_set(DOM::Element const&, Optional<PseudoElement>, PseudoClassBitmap& attempted_pseudo_class_matches, bool& did_match_any_pseudo_element_rules, ComputeStyleMode) const;
 
+    struct StyleSharingCandidate {
+        GC::Root<DOM::Element const> element;
+        MatchingRuleSet matching_rule_set;
+        PseudoClassBitmap attempted_pseudo_class_matches;
+    };
+    [[nodiscard]] static bool can_be_style_sharing_candidate(DOM::Element const&);
+    [[nodiscard]] MatchingRuleSet const* find_shareable_matching_rule_set(DOM::Element const&, PseudoClassBitmap& attempted_pseudo_class_matches) const;
+
     LogicalAliasMappingContext compute_logical_alias_mapping_context(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode, MatchingRuleSet const&) const;
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::Element&, Optional<CSS::PseudoElement>, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&, Optional<LogicalAliasMappingContext>, ReadonlySpan<PropertyID> properties_to_cascade) const;
@@ -296,6 +309,25 @@ private:
     CSSPixelRect m_viewport_rect;
 
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+
+    mutable Optional<StyleSharingCandidate> m_style_sharing_candidate;
+
+    [[nodiscard]] NonnullRefPtr<CSSStyleValue const> resolve_unresolved_style_value(DOM::Element&, Optional<PseudoElement>, PropertyID, UnresolvedStyleValue const&) const;
+
+    struct SubstitutedValue {
+        PropertyID property_id;
+        Vector<ValueComparingNonnullRefPtr<CSSStyleValue const>> custom_property_values;
+        NonnullRefPtr<CSSStyleValue const> value;
+    };
+    struct SubstitutedValueCacheEntry {
+        // NOTE: This keeps the value that is used as the key alive, so that its address can't be reused by another one.
+        NonnullRefPtr<UnresolvedStyleValue const> unresolved_value;
+        Optional<Vector<FlyString>> referenced_custom_properties;
+        Vector<SubstitutedValue> substituted_values;
+    };
+    static constexpr size_t max_substituted_values_per_declaration = 8;
+    static constexpr size_t max_substituted_value_cache_size = 4096;
+    mutable HashMap<UnresolvedStyleValue const*, NonnullOwnPtr<SubstitutedValueCacheEntry>> m_substituted_value_cache;
 };
 
 class FontLoader : public Weakable<FontLoader> {
@@ -313,8 +345,9 @@ public:
     bool is_loading() const;
 
 private:
-    ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_font(Fetch::Infrastructure::Response const&, ByteBuffer const&);
+    static Optional<Gfx::FontFormat> font_format_for_response(Fetch::Infrastructure::Response const&, ByteBuffer const&);
 
+    void font_did_decode_or_fail(RefPtr<Gfx::Typeface const>);
     void font_did_load_or_fail(RefPtr<Gfx::Typeface const>);
 
     StyleComputer& m_style_computer;
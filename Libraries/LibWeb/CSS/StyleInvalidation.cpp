@@ -66,6 +66,17 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
         if (old_value_opacity != new_value_opacity && (old_value_opacity == 1 || new_value_opacity == 1)) {
             invalidation.rebuild_stacking_context_tree = true;
         }
+    } else if (AK::first_is_one_of(property_id, CSS::PropertyID::Transform, CSS::PropertyID::Translate, CSS::PropertyID::Rotate, CSS::PropertyID::Scale) && old_value && new_value) {
+        // OPTIMIZATION: Like with opacity, whether a transform creates a stacking context only depends on it being
+        //               `none` or not. So animating a transform between two non-none values doesn't require a
+        //               stacking context tree rebuild, since the transform itself is resolved again when painting.
+        auto establishes_stacking_context = [&](CSSStyleValue const& value) {
+            if (property_id == CSS::PropertyID::Transform)
+                return !CSS::ComputedProperties::transformations_for_style_value(value).is_empty();
+            return value.is_transformation();
+        };
+        if (establishes_stacking_context(*old_value) != establishes_stacking_context(*new_value))
+            invalidation.rebuild_stacking_context_tree = true;
     } else if (CSS::property_affects_stacking_context(property_id)) {
         invalidation.rebuild_stacking_context_tree = true;
     }
@@ -106,7 +106,12 @@ enum class InsideNthChildPseudoClass {
     Yes
 };
 
-static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class);
+enum class IsTopLevelSelector : bool {
+    No,
+    Yes,
+};
+
+static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class, IsTopLevelSelector is_top_level_selector = IsTopLevelSelector::No);
 
 static void add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in_has_pseudo_class(Selector const& selector, StyleInvalidationData& style_invalidation_data);
 
@@ -209,7 +214,7 @@ static void add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in
     });
 }
 
-static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class)
+static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidationData& style_invalidation_data, Selector const& selector, InsideNthChildPseudoClass inside_nth_child_pseudo_class, IsTopLevelSelector is_top_level_selector)
 {
     auto const& compound_selectors = selector.compound_selectors();
     int compound_selector_index = compound_selectors.size() - 1;
@@ -217,6 +222,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
 
     InvalidationSet invalidation_set_for_rightmost_selector;
     Selector::Combinator previous_compound_combinator = Selector::Combinator::None;
+    bool previous_group_is_rightmost = false;
     for_each_consecutive_simple_selector_group(selector, [&](Vector<Selector::SimpleSelector const&> const& simple_selectors, Selector::Combinator combinator, bool is_rightmost) {
         // Collect properties used in :has() so we can decide if only specific properties
         // trigger descendant invalidation or if the entire document must be invalidated.
@@ -259,17 +265,39 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
             }
         } else {
             VERIFY(previous_compound_combinator != Selector::Combinator::None);
+
+            // If this compound is separated from the subject by a single sibling combinator, like ".a" in ".a + .b"
+            // or ".a ~ .b", changing one of its properties can only affect the following siblings of the changed
+            // element. Nested selectors (e.g. inside :is()) are excluded, because their subject is not necessarily
+            // the subject of the whole selector.
+            bool can_use_sibling_invalidation_set = is_top_level_selector == IsTopLevelSelector::Yes
+                && previous_group_is_rightmost
+                && AK::first_is_one_of(previous_compound_combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling);
+
             for (auto const& simple_selector : simple_selectors) {
                 InvalidationSet s;
                 build_invalidation_sets_for_simple_selector(simple_selector, s, ExcludePropertiesNestedInNotPseudoClass::No, style_invalidation_data, inside_nth_child_pseudo_class);
                 s.for_each_property([&](auto const& invalidation_property) {
+                    if (can_use_sibling_invalidation_set) {
+                        auto& sibling_invalidation_set = style_invalidation_data.sibling_invalidation_sets.ensure(invalidation_property, [] {
+                            return SiblingInvalidationSet {};
+                        });
+                        auto max_distance = previous_compound_combinator == Selector::Combinator::NextSibling ? 1 : NumericLimits<size_t>::max();
+                        sibling_invalidation_set.max_distance = max(sibling_invalidation_set.max_distance, max_distance);
+                        if (invalidation_set_for_rightmost_selector.is_empty())
+                            sibling_invalidation_set.invalidation_set.set_needs_invalidate_self();
+                        else
+                            sibling_invalidation_set.invalidation_set.include_all_from(invalidation_set_for_rightmost_selector);
+                        return IterationDecision::Continue;
+                    }
+
                     auto& descendant_invalidation_set = style_invalidation_data.descendant_invalidation_sets.ensure(invalidation_property, [] {
                         return InvalidationSet {};
                     });
                     // If the rightmost selector's invalidation set is empty, it means there's no
                     // specific property-based invalidation, so we fall back to invalidating the whole subtree.
-                    // If combinator to the right of current compound selector is NextSibling or SubsequentSibling,
-                    // we also need to invalidate the whole subtree, because we don't support sibling invalidation sets.
+                    // If combinator to the right of current compound selector is NextSibling or SubsequentSibling
+                    // and the sibling invalidation set above can't be used, we also need to invalidate the whole subtree.
                     if (AK::first_is_one_of(previous_compound_combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling)) {
                         descendant_invalidation_set.set_needs_invalidate_whole_subtree();
                     } else if (invalidation_set_for_rightmost_selector.is_empty()) {
@@ -284,6 +312,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
         }
 
         previous_compound_combinator = combinator;
+        previous_group_is_rightmost = is_rightmost;
     });
 
     return invalidation_set_for_rightmost_selector;
@@ -291,7 +320,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
 
 void StyleInvalidationData::build_invalidation_sets_for_selector(Selector const& selector)
 {
-    (void)build_invalidation_sets_for_selector_impl(*this, selector, InsideNthChildPseudoClass::No);
+    (void)build_invalidation_sets_for_selector_impl(*this, selector, InsideNthChildPseudoClass::No, IsTopLevelSelector::Yes);
 }
 
 }
@@ -12,8 +12,26 @@
 
 namespace Web::CSS {
 
+// Describes which elements following a changed element (in tree order, among its siblings) need their style
+// invalidated because of a `+` or `~` combinator immediately to the left of a selector's subject.
+struct SiblingInvalidationSet {
+    // How many following element siblings may be affected. Unbounded for the `~` combinator.
+    size_t max_distance { 0 };
+    // Siblings that include these properties are invalidated. If it needs self invalidation, every sibling within
+    // max_distance is invalidated.
+    InvalidationSet invalidation_set;
+
+    bool is_empty() const { return max_distance == 0; }
+    void include_all_from(SiblingInvalidationSet const& other)
+    {
+        max_distance = max(max_distance, other.max_distance);
+        invalidation_set.include_all_from(other.invalidation_set);
+    }
+};
+
 struct StyleInvalidationData {
     HashMap<InvalidationSet::Property, InvalidationSet> descendant_invalidation_sets;
+    HashMap<InvalidationSet::Property, SiblingInvalidationSet> sibling_invalidation_sets;
     HashTable<FlyString> ids_used_in_has_selectors;
     HashTable<FlyString> class_names_used_in_has_selectors;
     HashTable<FlyString> attribute_names_used_in_has_selectors;
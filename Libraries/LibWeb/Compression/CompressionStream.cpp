@@ -26,6 +26,9 @@ GC_DEFINE_ALLOCATOR(CompressionStream);
 WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
     // 1. If format is unsupported in CompressionStream, then throw a TypeError.
+    if (format == Bindings::CompressionFormat::Brotli || format == Bindings::CompressionFormat::Zstd)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Compression format '{}' is not supported", Bindings::idl_enum_to_string(format))) };
+
     // 2. Set this's format to format.
     auto input_stream = make<AllocatingMemoryStream>();
 
@@ -37,6 +40,9 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
             return TRY(Compress::DeflateCompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipCompressor::create(move(input_stream)));
+        case Bindings::CompressionFormat::Brotli:
+        case Bindings::CompressionFormat::Zstd:
+            break;
         }
 
         VERIFY_NOT_REACHED();
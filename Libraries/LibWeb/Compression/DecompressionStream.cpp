@@ -5,9 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/MemoryStream.h>
+#include <LibCompress/Brotli.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
+#include <LibCompress/Zstd.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
@@ -27,9 +30,8 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
 {
     // 1. If format is unsupported in DecompressionStream, then throw a TypeError.
     // 2. Set this's format to format.
-    auto input_stream = make<AllocatingMemoryStream>();
-
-    auto decompressor = [&, input_stream = MaybeOwned<Stream> { *input_stream }]() mutable -> ErrorOr<Decompressor> {
+    // NOTE: Chunks are handed to the decompressor directly, so the stream it would otherwise read them from stays empty.
+    auto decompressor = [&, input_stream = MaybeOwned<Stream> { make<AllocatingMemoryStream>() }]() mutable -> ErrorOr<Decompressor> {
         switch (format) {
         case Bindings::CompressionFormat::Deflate:
             return TRY(Compress::ZlibDecompressor::create(move(input_stream)));
@@ -37,6 +39,10 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
             return TRY(Compress::DeflateDecompressor::create(move(input_stream)));
         case Bindings::CompressionFormat::Gzip:
             return TRY(Compress::GzipDecompressor::create((move(input_stream))));
+        case Bindings::CompressionFormat::Brotli:
+            return TRY(Compress::BrotliDecompressor::create(move(input_stream)));
+        case Bindings::CompressionFormat::Zstd:
+            return TRY(Compress::ZstdDecompressor::create(move(input_stream)));
         }
 
         VERIFY_NOT_REACHED();
@@ -47,7 +53,7 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
 
     // 5. Set this's transform to a new TransformStream.
     // NOTE: We do this first so that we may store it as nonnull in the GenericTransformStream.
-    auto stream = realm.create<DecompressionStream>(realm, realm.create<Streams::TransformStream>(realm), decompressor.release_value(), move(input_stream));
+    auto stream = realm.create<DecompressionStream>(realm, realm.create<Streams::TransformStream>(realm), decompressor.release_value());
 
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the decompress and enqueue a chunk
     //    algorithm with this and chunk.
@@ -82,11 +88,10 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
     return stream;
 }
 
-DecompressionStream::DecompressionStream(JS::Realm& realm, GC::Ref<Streams::TransformStream> transform, Decompressor decompressor, NonnullOwnPtr<AllocatingMemoryStream> input_stream)
+DecompressionStream::DecompressionStream(JS::Realm& realm, GC::Ref<Streams::TransformStream> transform, Decompressor decompressor)
     : Bindings::PlatformObject(realm)
     , Streams::GenericTransformStreamMixin(transform)
     , m_decompressor(move(decompressor))
-    , m_input_stream(move(input_stream))
 {
 }
 
@@ -115,16 +120,8 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
 
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
-
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
-    }();
+    // OPTIMIZATION: The chunk is decompressed straight out of its buffer, which no script can get to until we're done.
+    auto maybe_buffer = decompress(WebIDL::get_buffer_source_bytes(chunk.as_object()));
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
 
@@ -149,17 +146,15 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
     auto& realm = this->realm();
 
     // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
+    auto maybe_buffer = decompress({});
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", maybe_buffer.error())) };
 
     auto buffer = maybe_buffer.release_value();
 
-    // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
     // 2. If the end of the compressed input has not been reached, then throw a TypeError.
-    VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
+    if (!m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Unable to decompress flush: Unexpected end of compressed data"sv };
 
     // 3. If buffer is empty, return.
     if (buffer.is_empty())
@@ -174,4 +169,35 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
     return {};
 }
 
+// Decompresses all of the given input, and whatever output the decompressor still had pending, into a single buffer.
+ErrorOr<ByteBuffer> DecompressionStream::decompress(ReadonlyBytes input)
+{
+    static constexpr size_t minimum_buffer_size = 16 * KiB;
+
+    ByteBuffer buffer;
+    TRY(buffer.try_resize(max(input.size() * 2, minimum_buffer_size)));
+    size_t buffer_size = 0;
+
+    while (true) {
+        auto result = TRY(m_decompressor.visit([&](auto const& decompressor) {
+            return decompressor->decompress_some(input, buffer.bytes().slice(buffer_size));
+        }));
+        input = input.slice(result.input_bytes_consumed);
+        buffer_size += result.output_bytes_produced;
+
+        // There is nothing more to come out once all of the input went in and there was room left for output.
+        if (input.is_empty() && buffer_size < buffer.size())
+            break;
+
+        if (result.input_bytes_consumed == 0 && result.output_bytes_produced == 0)
+            return Error::from_string_literal("No decompression progress");
+
+        if (buffer_size == buffer.size())
+            TRY(buffer.try_resize(buffer.size() * 2));
+    }
+
+    buffer.resize(buffer_size);
+    return buffer;
+}
+
 }
@@ -6,7 +6,6 @@
 
 #pragma once
 
-#include <AK/MemoryStream.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Variant.h>
 #include <LibCompress/Forward.h>
@@ -22,7 +21,9 @@ namespace Web::Compression {
 using Decompressor = Variant<
     NonnullOwnPtr<Compress::ZlibDecompressor>,
     NonnullOwnPtr<Compress::DeflateDecompressor>,
-    NonnullOwnPtr<Compress::GzipDecompressor>>;
+    NonnullOwnPtr<Compress::GzipDecompressor>,
+    NonnullOwnPtr<Compress::BrotliDecompressor>,
+    NonnullOwnPtr<Compress::ZstdDecompressor>>;
 
 // https://compression.spec.whatwg.org/#decompressionstream
 class DecompressionStream final
@@ -36,7 +37,7 @@ public:
     virtual ~DecompressionStream() override;
 
 private:
-    DecompressionStream(JS::Realm&, GC::Ref<Streams::TransformStream>, Decompressor, NonnullOwnPtr<AllocatingMemoryStream>);
+    DecompressionStream(JS::Realm&, GC::Ref<Streams::TransformStream>, Decompressor);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
@@ -44,8 +45,9 @@ private:
     WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Value);
     WebIDL::ExceptionOr<void> decompress_flush_and_enqueue();
 
+    ErrorOr<ByteBuffer> decompress(ReadonlyBytes);
+
     Decompressor m_decompressor;
-    NonnullOwnPtr<AllocatingMemoryStream> m_input_stream;
 };
 
 }
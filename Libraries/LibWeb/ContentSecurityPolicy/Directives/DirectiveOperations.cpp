@@ -841,18 +841,17 @@ enum class NonceableResult {
     // FIXME: File spec issue to ask if this should include SVGScriptElement.
     if (is<HTML::HTMLScriptElement>(element.ptr())) {
         for (size_t attribute_index = 0; attribute_index < element->attributes()->length(); ++attribute_index) {
-            auto const* attribute = element->attributes()->item(attribute_index);
-            VERIFY(attribute);
+            auto const& attribute = element->attributes()->entry_at(attribute_index);
 
             // 1. If attribute’s name contains an ASCII case-insensitive match for "<script" or "<style", return
             //    "Not Nonceable".
-            auto attribute_name = attribute->name().to_string();
+            auto attribute_name = attribute.name().to_string();
             if (attribute_name.contains("<script"sv, CaseSensitivity::CaseInsensitive) || attribute_name.contains("<style"sv, CaseSensitivity::CaseInsensitive))
                 return NonceableResult::NotNonceable;
 
             // 2. If attribute’s value contains an ASCII case-insensitive match for "<script" or "<style", return
             //    "Not Nonceable".
-            auto const& attribute_value = attribute->value();
+            auto const& attribute_value = attribute.value();
             if (attribute_value.contains("<script"sv, CaseSensitivity::CaseInsensitive) || attribute_value.contains("<style"sv, CaseSensitivity::CaseInsensitive))
                 return NonceableResult::NotNonceable;
         }
@@ -3685,34 +3685,59 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
     return key;
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+static Optional<::Crypto::Hash::HashKind> sha_hash_kind(String const& algorithm_name)
 {
-    auto& algorithm_name = algorithm.name;
-
-    ::Crypto::Hash::HashKind hash_kind;
-    if (algorithm_name == "SHA-1") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA1;
-    } else if (algorithm_name == "SHA-256") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA256;
-    } else if (algorithm_name == "SHA-384") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA384;
-    } else if (algorithm_name == "SHA-512") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA512;
-    } else {
-        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm_name)));
-    }
+    if (algorithm_name == "SHA-1")
+        return ::Crypto::Hash::HashKind::SHA1;
+    if (algorithm_name == "SHA-256")
+        return ::Crypto::Hash::HashKind::SHA256;
+    if (algorithm_name == "SHA-384")
+        return ::Crypto::Hash::HashKind::SHA384;
+    if (algorithm_name == "SHA-512")
+        return ::Crypto::Hash::HashKind::SHA512;
+    return {};
+}
 
+static ErrorOr<ByteBuffer> sha_digest(::Crypto::Hash::HashKind hash_kind, ReadonlyBytes data)
+{
     ::Crypto::Hash::Manager hash { hash_kind };
     hash.update(data);
 
     auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+}
+
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto& algorithm_name = algorithm.name;
+
+    auto hash_kind = sha_hash_kind(algorithm_name);
+    if (!hash_kind.has_value())
+        return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm_name)));
+
+    auto result_buffer = sha_digest(*hash_kind, data);
     if (result_buffer.is_error())
         return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_string);
 
     return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
 }
 
+Optional<AlgorithmMethods::BackgroundOperation> SHA::digest_in_background(AlgorithmParams const& algorithm, ByteBuffer& data)
+{
+    // NOTE: Small inputs are hashed in less time than it takes to hand them to another thread and back.
+    static constexpr size_t minimum_size_to_hash_in_background = 64 * KiB;
+    if (data.size() < minimum_size_to_hash_in_background)
+        return {};
+
+    auto hash_kind = sha_hash_kind(algorithm.name);
+    if (!hash_kind.has_value())
+        return {};
+
+    return BackgroundOperation { [hash_kind = *hash_kind, data = move(data)] {
+        return sha_digest(hash_kind, data);
+    } };
+}
+
 // https://w3c.github.io/webcrypto/#ecdsa-operations
 WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> ECDSA::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
@@ -6809,7 +6834,7 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+WebIDL::ExceptionOr<Optional<AlgorithmMethods::BackgroundOperation>> PBKDF2::derive_bits_in_background(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6848,8 +6873,21 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", hash_algorithm)));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    // NOTE: Deriving a key takes a while with the number of iterations that is recommended, so the steps from here on
+    //       don't touch the JS heap, and can run off the main thread.
+    return BackgroundOperation { [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes] -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        return pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    } };
+}
+
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto& realm = *m_realm;
+
+    // 1-4. Let result be the result of performing the PBKDF2 operation.
+    auto operation = TRY(derive_bits_in_background(params, key, length_optional));
+    auto maybe_result = (*operation)();
 
     // 5. If the key derivation operation fails, then throw an OperationError.
     if (maybe_result.is_error())
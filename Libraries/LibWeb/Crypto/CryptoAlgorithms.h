@@ -361,6 +361,23 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "unwwrapKey is not supported"_string);
     }
 
+    // Work that performs an operation without touching the JS heap, so that it can run off the main thread. It produces
+    // the bytes that the operation would otherwise have returned in an ArrayBuffer.
+    using BackgroundOperation = Function<ErrorOr<ByteBuffer>()>;
+
+    // Operations that can take a long time may return their work here instead, after doing any checks that can throw.
+    // The regular operation above is only performed if this returns nothing. If work is returned, the data it works on
+    // may have been moved into it.
+    virtual Optional<BackgroundOperation> digest_in_background(AlgorithmParams const&, ByteBuffer&)
+    {
+        return {};
+    }
+
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return Optional<BackgroundOperation> {};
+    }
+
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new AlgorithmMethods(realm)); }
 
 protected:
@@ -520,6 +537,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -534,6 +552,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual Optional<BackgroundOperation> digest_in_background(AlgorithmParams const&, ByteBuffer&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -8,6 +8,7 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/QuickSort.h>
+#include <LibCore/EventLoop.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
@@ -18,6 +19,8 @@
 #include <LibWeb/Crypto/KeyAlgorithms.h>
 #include <LibWeb/Crypto/SubtleCrypto.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/Buffers.h>
@@ -44,6 +47,29 @@ static void define_an_algorithm(String op, String algorithm);
 
 GC_DEFINE_ALLOCATOR(SubtleCrypto);
 
+// OPTIMIZATION: Performs an operation that doesn't touch the JS heap on the thread pool, then resolves the promise with
+//               an ArrayBuffer of its result back on the main thread, or rejects it with an OperationError.
+static void resolve_promise_with_background_operation(GC::Ref<WebIDL::Promise> promise, AlgorithmMethods::BackgroundOperation operation, StringView error_message)
+{
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().enqueue([&main_thread_event_loop, promise = GC::Root { promise }, operation = move(operation), error_message]() mutable {
+        auto result = operation();
+
+        main_thread_event_loop.deferred_invoke([promise = move(promise), result = move(result), error_message]() mutable {
+            auto& realm = HTML::relevant_realm(*promise->promise());
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            if (result.is_error()) {
+                WebIDL::reject_promise(realm, *promise, WebIDL::OperationError::create(realm, MUST(String::from_utf8(error_message))));
+                return;
+            }
+
+            WebIDL::resolve_promise(realm, *promise, JS::ArrayBuffer::create(realm, result.release_value()));
+        });
+        main_thread_event_loop.wake();
+    });
+}
+
 GC::Ref<SubtleCrypto> SubtleCrypto::create(JS::Realm& realm)
 {
     return realm.create<SubtleCrypto>(realm);
@@ -275,12 +301,18 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+        // 9. Resolve promise with result.
+        if (auto operation = algorithm_object.methods->digest_in_background(*algorithm_object.parameter, data_buffer); operation.has_value()) {
+            resolve_promise_with_background_operation(promise, operation.release_value(), "Failed to create result buffer"sv);
+            return;
+        }
+
         auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
 
         if (result.is_exception()) {
@@ -632,6 +664,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        // 10. Resolve promise with result.
+        auto operation = normalized_algorithm.methods->derive_bits_in_background(*normalized_algorithm.parameter, base_key, length_optional);
+        if (operation.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), operation.release_error()).release_value());
+            return;
+        }
+        if (operation.value().has_value()) {
+            resolve_promise_with_background_operation(promise, operation.release_value().release_value(), "Failed to derive key"sv);
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
@@ -26,11 +26,11 @@ public:
 
     virtual FlyString node_name() const override { return name(); }
 
+    QualifiedName const& qualified_name() const { return m_qualified_name; }
     Optional<FlyString> const& namespace_uri() const { return m_qualified_name.namespace_(); }
     Optional<FlyString> const& prefix() const { return m_qualified_name.prefix(); }
     FlyString const& local_name() const { return m_qualified_name.local_name(); }
     FlyString const& name() const { return m_qualified_name.as_string(); }
-    FlyString const& lowercase_name() const { return m_lowercase_name; }
 
     String const& value() const { return m_value; }
     void set_value(String value);
@@ -43,8 +43,6 @@ public:
     // Always returns true: https://dom.spec.whatwg.org/#dom-attr-specified
     constexpr bool specified() const { return true; }
 
-    void handle_attribute_changes(Element&, Optional<String> const& old_value, Optional<String> const& new_value);
-
 private:
     Attr(Document&, QualifiedName, String value, Element*);
 
@@ -52,7 +50,6 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
 
     QualifiedName m_qualified_name;
-    FlyString m_lowercase_name;
     String m_value;
     GC::Ptr<Element> m_owner_element;
 };
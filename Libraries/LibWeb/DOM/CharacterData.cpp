@@ -66,9 +66,7 @@ WebIDL::ExceptionOr<String> CharacterData::substring_data(size_t offset, size_t
 WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t count, String const& data)
 {
     // 1. Let length be node’s length.
-    // FIXME: This is very inefficient!
-    auto utf16_string = Utf16String::from_utf8(m_data);
-    auto length = utf16_string.length_in_code_units();
+    auto length = length_in_utf16_code_units();
 
     // 2. If offset is greater than length, then throw an "IndexSizeError" DOMException.
     if (offset > length)
@@ -81,22 +79,45 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
     // 5. Insert data into node’s data after offset code units.
     // 6. Let delete offset be offset + data’s length.
     // 7. Starting from delete offset code units, remove count code units from node’s data.
-    auto before_data = utf16_string.substring_view(0, offset);
-    auto inserted_data = Utf16String::from_utf8(data);
-    auto after_data = utf16_string.substring_view(offset + count);
-
-    StringBuilder full_data(StringBuilder::Mode::UTF16, before_data.length_in_code_units() + inserted_data.length_in_code_units() + after_data.length_in_code_units());
-    full_data.append(before_data);
-    full_data.append(inserted_data);
-    full_data.append(after_data);
-
-    auto full_view = full_data.utf16_string_view();
-    bool characters_are_the_same = utf16_string == full_view;
+    size_t inserted_data_length = 0;
+    bool characters_are_the_same = false;
     auto old_data = m_data;
 
-    // OPTIMIZATION: Skip UTF-8 encoding if the characters are the same.
-    if (!characters_are_the_same) {
-        m_data = MUST(full_view.to_utf8());
+    if (offset == length) {
+        // OPTIMIZATION: Appending data doesn't need either string as UTF-16. This is what the HTML parser does for
+        //               every run of text it inserts, as well as what setting the data of an empty node does.
+        inserted_data_length = AK::utf16_code_unit_length_from_utf8(data);
+        characters_are_the_same = data.is_empty();
+        if (!characters_are_the_same) {
+            if (m_data.is_empty()) {
+                m_data = data;
+            } else {
+                StringBuilder builder(m_data.bytes().size() + data.bytes().size());
+                builder.append(m_data);
+                builder.append(data);
+                m_data = MUST(builder.to_string());
+            }
+        }
+    } else {
+        // FIXME: This is very inefficient!
+        auto utf16_string = Utf16String::from_utf8(m_data);
+        auto before_data = utf16_string.substring_view(0, offset);
+        auto inserted_data = Utf16String::from_utf8(data);
+        auto after_data = utf16_string.substring_view(offset + count);
+        inserted_data_length = inserted_data.length_in_code_units();
+
+        StringBuilder full_data(StringBuilder::Mode::UTF16, before_data.length_in_code_units() + inserted_data.length_in_code_units() + after_data.length_in_code_units());
+        full_data.append(before_data);
+        full_data.append(inserted_data);
+        full_data.append(after_data);
+
+        auto full_view = full_data.utf16_string_view();
+        characters_are_the_same = utf16_string == full_view;
+
+        // OPTIMIZATION: Skip UTF-8 encoding if the characters are the same.
+        if (!characters_are_the_same) {
+            m_data = MUST(full_view.to_utf8());
+        }
     }
 
     // 4. Queue a mutation record of "characterData" for node with null, null, node’s data, « », « », null, and null.
@@ -121,14 +142,14 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
     //     start offset by data’s length and decrease it by count.
     for (auto* range : Range::live_ranges()) {
         if (range->start_container() == this && range->start_offset() > (offset + count))
-            range->set_start_offset(range->start_offset() + inserted_data.length_in_code_units() - count);
+            range->set_start_offset(range->start_offset() + inserted_data_length - count);
     }
 
     // 11. For each live range whose end node is node and end offset is greater than offset plus count, increase its end
     //     offset by data’s length and decrease it by count.
     for (auto* range : Range::live_ranges()) {
         if (range->end_container() == this && range->end_offset() > (offset + count))
-            range->set_end_offset(range->end_offset() + inserted_data.length_in_code_units() - count);
+            range->set_end_offset(range->end_offset() + inserted_data_length - count);
     }
 
     // 12. If node’s parent is non-null, then run the children changed steps for node’s parent.
@@ -14,6 +14,7 @@
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
 #include <AK/InsertionSort.h>
+#include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
@@ -93,6 +94,7 @@
 #include <LibWeb/HTML/CustomElements/CustomElementDefinition.h>
 #include <LibWeb/HTML/CustomElements/CustomElementReactionNames.h>
 #include <LibWeb/HTML/CustomElements/CustomElementRegistry.h>
+#include <LibWeb/HTML/DecodedImageData.h>
 #include <LibWeb/HTML/DocumentState.h>
 #include <LibWeb/HTML/DragEvent.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
@@ -154,8 +156,10 @@
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
 #include <LibWeb/ResizeObserver/ResizeObserverEntry.h>
 #include <LibWeb/SVG/SVGDecodedImageData.h>
@@ -512,6 +516,12 @@ void Document::initialize(JS::Realm& realm)
     page().client().page_did_create_new_document(*this);
 }
 
+void Document::bump_dom_tree_version(Node& changed_node, DOMTreeChange change)
+{
+    ++m_dom_tree_version;
+    changed_node.did_change_inclusive_subtree({}, change);
+}
+
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#populate-with-html/head/body
 WebIDL::ExceptionOr<void> Document::populate_with_html_head_and_body()
 {
@@ -584,6 +594,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_document_observers);
     visitor.visit(m_document_observers_being_notified);
     visitor.visit(m_pending_scroll_event_targets);
+    visitor.visit(m_paintables_with_changed_opacity_or_transform);
     visitor.visit(m_pending_scrollend_event_targets);
     visitor.visit(m_resize_observers);
 
@@ -1289,6 +1300,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (!navigable || navigable->active_document() != this)
         return;
 
+    PhaseTimer phase_timer { Phase::Layout };
+
     // NOTE: If our parent document needs a relayout, we must do that *first*.
     //       This is necessary as the parent layout may cause our viewport to change.
     if (navigable->container() && &navigable->container()->document() != this)
@@ -1303,6 +1316,9 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (m_created_for_appropriate_template_contents)
         return;
 
+    ++m_layout_generation;
+    ++m_geometry_generation;
+
     // Clear text blocks cache so we rebuild them on the next find action.
     if (m_layout_root)
         m_layout_root->invalidate_text_blocks_cache();
@@ -1313,6 +1329,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     auto viewport_rect = navigable->viewport_rect();
 
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    auto layout_update_start = MonotonicTime::now();
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
         Layout::TreeBuilder tree_builder;
@@ -1336,7 +1353,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     });
 
     m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (child.needs_layout_update()) {
+        if (child.needs_intrinsic_sizes_update()) {
             child.reset_cached_intrinsic_sizes();
         }
         child.clear_contained_abspos_children();
@@ -1424,6 +1441,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (auto window = this->window())
         window->scroll_by(0, 0);
 
+    m_last_layout_update_interval = HTML::FrameTimingInterval { layout_update_start, MonotonicTime::now() };
+
     if constexpr (UPDATE_LAYOUT_DEBUG) {
         dbgln("LAYOUT {} {} µs", to_string(reason), timer.elapsed_time().to_microseconds());
     }
@@ -1434,9 +1453,6 @@ void Document::update_layout(UpdateLayoutReason reason)
     bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
 
-    if (node.is_element())
-        style_computer.push_ancestor(static_cast<Element const&>(node));
-
     // NOTE: If the current node has `display:none`, we can disregard all invalidation
     //       caused by its children, as they will not be rendered anyway.
     //       We will still recompute style for the children, though.
@@ -1466,6 +1482,11 @@ void Document::update_layout(UpdateLayoutReason reason)
     node.set_needs_style_update(false);
     invalidation |= node_invalidation;
 
+    // OPTIMIZATION: We only add the current node to the ancestor filter after computing its own style.
+    //               It isn't an ancestor of itself, and leaving it out lets the filter reject more rules.
+    if (node.is_element())
+        style_computer.push_ancestor(static_cast<Element const&>(node));
+
     bool children_need_inherited_style_update = !invalidation.is_none();
     if (needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update) {
         if (node.is_element()) {
@@ -1501,6 +1522,9 @@ void Document::update_style()
     if (!browsing_context())
         return;
 
+    PhaseTimer phase_timer { Phase::Style };
+    auto style_update_start = MonotonicTime::now();
+
     update_animated_style_if_needed();
 
     // Associated with each top-level browsing context is a current transition generation that is incremented on each
@@ -1524,13 +1548,24 @@ void Document::update_style()
     evaluate_media_rules();
 
     style_computer().reset_ancestor_filter();
+    style_computer().reset_style_sharing_cache();
 
     auto invalidation = update_style_recursively(*this, style_computer(), false);
+    style_computer().reset_style_sharing_cache();
+    // NOTE: Elements that only need a repaint have already invalidated the commands of their stacking contexts.
     if (!invalidation.is_none())
-        invalidate_display_list();
+        invalidate_display_list_except_retained_commands();
     if (invalidation.rebuild_stacking_context_tree)
         invalidate_stacking_context_tree();
     m_needs_full_style_update = false;
+
+    m_last_style_update_interval = HTML::FrameTimingInterval { style_update_start, MonotonicTime::now() };
+}
+
+void Document::take_style_and_layout_update_timings(HTML::FrameTimings& frame_timings)
+{
+    frame_timings.style_update = exchange(m_last_style_update_interval, {});
+    frame_timings.layout_update = exchange(m_last_layout_update_interval, {});
 }
 
 void Document::update_animated_style_if_needed()
@@ -1827,10 +1862,10 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
     Function<void(Node&)> invalidate_affected_elements_recursively = [&](Node& node) -> void {
         if (node.is_element()) {
             auto& element = static_cast<Element&>(node);
-            style_computer.push_ancestor(element);
             if (element.affected_by_pseudo_class(pseudo_class) && matches_different_set_of_rules_after_state_change(element)) {
                 element.set_needs_style_update(true);
             }
+            style_computer.push_ancestor(element);
         }
 
         node.for_each_child([&](auto& child) {
@@ -1929,7 +1964,7 @@ GC::Ref<NodeList> Document::get_elements_by_name(FlyString const& name)
 GC::Ref<HTMLCollection> Document::applets()
 {
     if (!m_applets)
-        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; });
+        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; }, HTMLCollection::FilterDependsOnAttributes::No);
     return *m_applets;
 }
 
@@ -1950,7 +1985,7 @@ GC::Ref<HTMLCollection> Document::images()
     if (!m_images) {
         m_images = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLImageElement>(element);
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_images;
 }
@@ -1961,7 +1996,7 @@ GC::Ref<HTMLCollection> Document::embeds()
     if (!m_embeds) {
         m_embeds = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLEmbedElement>(element);
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_embeds;
 }
@@ -1989,7 +2024,7 @@ GC::Ref<HTMLCollection> Document::forms()
     if (!m_forms) {
         m_forms = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLFormElement>(element);
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_forms;
 }
@@ -2000,7 +2035,7 @@ GC::Ref<HTMLCollection> Document::scripts()
     if (!m_scripts) {
         m_scripts = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLScriptElement>(element);
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_scripts;
 }
@@ -4253,7 +4288,7 @@ void Document::set_browsing_context(GC::Ptr<HTML::BrowsingContext> browsing_cont
 }
 
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
-void Document::unload(GC::Ptr<Document>)
+void Document::unload(GC::Ptr<Document> new_document)
 {
     // FIXME: 1. Assert: this is running as part of a task queued on oldDocument's event loop.
 
@@ -4265,7 +4300,8 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    // NOTE: There's no new document when the navigable is being closed, in which case there's nothing to come back to.
+    auto intend_to_store_in_bfcache = new_document && can_be_kept_in_back_forward_cache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4317,7 +4353,11 @@ void Document::unload(GC::Ptr<Document>)
 
     // FIXME: 17. Set oldDocument's has been scrolled by the user to false.
 
-    // FIXME: 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    // 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    // NOTE: Documents that aren't salvageable run these when they're destroyed below, so they're only run here for
+    //       documents that we're about to keep in the back/forward cache.
+    if (m_salvageable)
+        run_unloading_cleanup_steps();
 
     // 19. If oldDocument's salvageable state is false, then destroy oldDocument.
     if (!m_salvageable) {
@@ -4327,6 +4367,9 @@ void Document::unload(GC::Ptr<Document>)
     // 20. Decrease oldDocument's unload counter by 1.
     m_unload_counter -= 1;
 
+    if (m_salvageable)
+        navigable()->traversable_navigable()->did_keep_document_in_back_forward_cache(*this);
+
     // FIXME: 21. If newDocument is given, newDocument's was created via cross-origin redirects is false, and newDocument's origin is the same as oldDocument's origin, then set
     //            newDocument's previous document unload timing to unloadTimingInfo.
 
@@ -4386,9 +4429,84 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // NOTE: A document that's still salvageable after being unloaded is kept alive in its session history entry, so
+    //       that it can be used again for history traversal. Such documents never have any descendant navigables.
+    if (m_salvageable) {
+        VERIFY(descendant_navigables.is_empty());
+        if (after_all_unloads)
+            after_all_unloads->function()();
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
+// AD-HOC: The spec leaves it up to the user agent which documents it keeps in the back/forward cache. We only keep the
+//         ones that are simple to freeze and bring back: fully loaded top-level documents without any nested navigables.
+bool Document::can_be_kept_in_back_forward_cache() const
+{
+    if (!m_salvageable)
+        return false;
+
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable())
+        return false;
+
+    if (is_initial_about_blank() || is_decoded_svg() || m_readiness != HTML::DocumentReadyState::Complete)
+        return false;
+
+    if (!url().scheme().is_one_of("http"sv, "https"sv, "file"sv))
+        return false;
+
+    // NOTE: Nested navigables would all have to be frozen and brought back together with this document.
+    if (!const_cast<Document&>(*this).document_tree_child_navigables().is_empty())
+        return false;
+
+    // NOTE: Pages with unload handlers generally expect to be gone once those have run, which a document that's kept in
+    //       the back/forward cache never does, as unload isn't fired at it.
+    if (auto window = m_window; window && window->has_event_listener(HTML::EventNames::unload))
+        return false;
+
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& entries_for_navigation_api)
+{
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase
+    //              activeTimers[handle] by suspendDuration.
+    // NOTE: Tasks of a document that isn't fully active aren't runnable, so timers that ran out while this document was
+    //       in the back/forward cache had their callbacks wait until now.
+
+    // 3. Update the navigation API entries for reactivation given document's relevant global object's navigation API,
+    //    entriesForNavigationAPI, and reactivatedEntry.
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    window.navigation()->update_the_navigation_api_entries_for_reactivation(entries_for_navigation_api, reactivated_entry);
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        m_page_showing = true;
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+    }
+
+    // AD-HOC: The layout tree was torn down when this document stopped being active, so it has to be built again.
+    set_needs_display();
+}
+
 // https://html.spec.whatwg.org/multipage/iframe-embed-object.html#allowed-to-use
 bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 {
@@ -4672,10 +4790,11 @@ void Document::queue_an_intersection_observer_entry(IntersectionObserver::Inters
 }
 
 // https://www.w3.org/TR/intersection-observer/#compute-the-intersection
-static CSSPixelRect compute_intersection(GC::Ref<Element> target, IntersectionObserver::IntersectionObserver const& observer)
+static CSSPixelRect compute_intersection(CSSPixelRect const& target_rect, IntersectionObserver::IntersectionObserver const& observer)
 {
     // 1. Let intersectionRect be the result of getting the bounding box for target.
-    auto intersection_rect = target->get_bounding_client_rect();
+    // NOTE: The caller already got the bounding box for target, so it's passed in instead of being computed again.
+    auto intersection_rect = target_rect;
 
     // FIXME: 2. Let container be the containing block of target.
     // FIXME: 3. While container is not root:
@@ -4718,6 +4837,16 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
         // 2. For each target in observer’s internal [[ObservationTargets]] slot, processed in the same order that
         //    observe() was called on each target:
         for (auto& target : observer->observation_targets()) {
+            // OPTIMIZATION: Unless layout was performed, a scroll offset or transform changed, or the root intersection
+            //               rectangle is a different one, we would come up with the same thresholdIndex and isIntersecting
+            //               as the last time, and not queue an entry. So we don't have to look at the target at all.
+            auto& intersection_observer_registration = target->get_intersection_observer_registration({}, observer);
+            auto geometry_generation = target->document().geometry_generation();
+            if (intersection_observer_registration.previous_geometry_generation == geometry_generation && intersection_observer_registration.previous_root_bounds == root_bounds)
+                continue;
+            intersection_observer_registration.previous_geometry_generation = geometry_generation;
+            intersection_observer_registration.previous_root_bounds = root_bounds;
+
             // 1. Let:
             // thresholdIndex be 0.
             size_t threshold_index = 0;
@@ -4749,7 +4878,7 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
                 // 5. Let intersectionRect be the result of running the compute the intersection algorithm on target and
                 //    observer’s intersection root.
-                intersection_rect = compute_intersection(target, observer);
+                intersection_rect = compute_intersection(target_rect, observer);
 
                 // 6. Let targetArea be targetRect’s area.
                 auto target_area = target_rect.width() * target_rect.height();
@@ -4779,7 +4908,7 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
             // 11. Let intersectionObserverRegistration be the IntersectionObserverRegistration record in target’s
             //     internal [[RegisteredIntersectionObservers]] slot whose observer property is equal to observer.
-            auto& intersection_observer_registration = target->get_intersection_observer_registration({}, observer);
+            // NOTE: This was already done above.
 
             // 12. Let previousThresholdIndex be the intersectionObserverRegistration’s previousThresholdIndex property.
             auto previous_threshold_index = intersection_observer_registration.previous_threshold_index;
@@ -5190,8 +5319,11 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
     }
 }
 
@@ -5200,6 +5332,44 @@ HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& Document::shared_resour
     return m_shared_resource_requests;
 }
 
+static size_t decoded_image_size_of(HTML::SharedResourceRequest const& request)
+{
+    auto image_data = request.image_data();
+    return image_data ? image_data->decoded_size_in_bytes() : 0;
+}
+
+// NOTE: Shared resource requests and the list of available images keep every image the document has loaded alive, which
+//       adds up to a lot of memory on pages that keep loading new ones, like infinitely scrolling ones. So once the
+//       decoded images they hold on to grow past this size, we forget about the least recently used ones. Elements
+//       that still display one of them keep it alive, and anything else that wants it fetches and decodes it again.
+//       The user agent is allowed to remove images from the list of available images at any time to save memory.
+static constexpr size_t maximum_decoded_size_of_shared_images = 256 * MiB;
+
+void Document::did_finish_shared_resource_request(HTML::SharedResourceRequest& finished_request)
+{
+    m_decoded_size_of_shared_images += decoded_image_size_of(finished_request);
+    if (m_decoded_size_of_shared_images <= maximum_decoded_size_of_shared_images)
+        return;
+
+    Vector<GC::Ref<HTML::SharedResourceRequest>> candidates;
+    for (auto const& [url, request] : m_shared_resource_requests) {
+        if (request && request != &finished_request && request->is_finished() && decoded_image_size_of(*request) != 0)
+            candidates.append(*request);
+    }
+    quick_sort(candidates, [](auto const& a, auto const& b) { return a->last_use_time() < b->last_use_time(); });
+
+    // NOTE: We evict down to somewhat below the limit, so that we don't have to go through all of the requests again for
+    //       every image that's loaded after this one.
+    static constexpr auto eviction_target = maximum_decoded_size_of_shared_images / 4 * 3;
+    for (auto const& request : candidates) {
+        if (m_decoded_size_of_shared_images <= eviction_target)
+            break;
+        m_decoded_size_of_shared_images -= decoded_image_size_of(*request);
+        m_list_of_available_images->remove_all_with_image_data(*request->image_data());
+        m_shared_resource_requests.remove(request->url());
+    }
+}
+
 // https://www.w3.org/TR/web-animations-1/#dom-document-timeline
 GC::Ref<Animations::DocumentTimeline> Document::timeline()
 {
@@ -6150,6 +6320,8 @@ GC::Ptr<HTML::HTMLElement> Document::topmost_auto_or_hint_popover()
 
 void Document::set_needs_to_refresh_scroll_state(bool b)
 {
+    if (b)
+        ++m_geometry_generation;
     if (auto* paintable = this->paintable())
         paintable->set_needs_to_refresh_scroll_state(b);
 }
@@ -6393,9 +6565,22 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
 }
 
 void Document::invalidate_display_list()
+{
+    ++m_display_list_generation;
+    invalidate_display_list_except_retained_commands();
+}
+
+void Document::invalidate_display_list_except_retained_commands()
 {
     m_cached_display_list.clear();
 
+    // NOTE: The commands retained for these were recorded with their old opacity or transform.
+    for (auto& paintable_box : m_paintables_with_changed_opacity_or_transform) {
+        if (auto* stacking_context = paintable_box->stacking_context())
+            stacking_context->invalidate_retained_display_list_commands();
+    }
+    m_paintables_with_changed_opacity_or_transform.clear();
+
     auto navigable = this->navigable();
     if (!navigable)
         return;
@@ -6405,10 +6590,70 @@ void Document::invalidate_display_list()
     }
 }
 
+void Document::did_change_opacity_or_transform_of_stacking_context(Painting::PaintableBox& paintable_box)
+{
+    // NOTE: The display list of a nested document is recorded into the one of its container, so both have to be
+    //       recorded again anyway.
+    if (auto navigable = this->navigable(); navigable && navigable->container()) {
+        set_needs_display();
+        return;
+    }
+
+    if (!m_paintables_with_changed_opacity_or_transform.contains_slow(GC::Ref { paintable_box }))
+        m_paintables_with_changed_opacity_or_transform.append(paintable_box);
+    set_needs_display(InvalidateDisplayList::No);
+}
+
+// OPTIMIZATION: When all that changed since the last display list was recorded is the opacity or transform of some
+//               stacking contexts, which is what animations of those properties do on every frame, the last display list
+//               is copied and the commands that push those stacking contexts are updated, instead of painting again.
+RefPtr<Painting::DisplayList> Document::copy_cached_display_list_with_updated_opacities_and_transforms()
+{
+    auto paintable_boxes = move(m_paintables_with_changed_opacity_or_transform);
+
+    update_paint_and_hit_testing_properties_if_needed();
+
+    auto* viewport_paintable = paintable();
+    if (!viewport_paintable || !viewport_paintable->stacking_context()) {
+        invalidate_display_list();
+        return nullptr;
+    }
+
+    // NOTE: The last display list may still be getting played back, so it's left alone.
+    auto const& old_display_list = *m_cached_display_list;
+    auto display_list = Painting::DisplayList::create();
+    display_list->append_commands_from(old_display_list, 0, old_display_list.commands().size());
+    display_list->set_device_pixels_per_css_pixel(old_display_list.device_pixels_per_css_pixel());
+    viewport_paintable->stacking_context()->retain_commands_from_copy_of_display_list(old_display_list, display_list);
+
+    for (auto& paintable_box : paintable_boxes) {
+        auto* stacking_context = paintable_box->stacking_context();
+        if (!stacking_context || !stacking_context->update_opacity_and_transform_of_retained_display_list_commands(display_list)) {
+            invalidate_display_list();
+            return nullptr;
+        }
+    }
+
+    m_cached_display_list = display_list;
+    return display_list;
+}
+
 RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config)
 {
     if (m_cached_display_list && m_cached_display_list_paint_config == config) {
-        return m_cached_display_list;
+        if (m_paintables_with_changed_opacity_or_transform.is_empty())
+            return m_cached_display_list;
+        if (auto display_list = copy_cached_display_list_with_updated_opacities_and_transforms())
+            return display_list;
+    }
+    if (!m_paintables_with_changed_opacity_or_transform.is_empty())
+        invalidate_display_list_except_retained_commands();
+
+    // NOTE: Commands recorded with a different configuration (or device pixel ratio) can't be reused.
+    auto device_pixels_per_css_pixel = page().client().device_pixels_per_css_pixel();
+    if (m_cached_display_list_paint_config != config || m_last_recorded_device_pixels_per_css_pixel != device_pixels_per_css_pixel) {
+        ++m_display_list_generation;
+        m_last_recorded_device_pixels_per_css_pixel = device_pixels_per_css_pixel;
     }
 
     auto display_list = Painting::DisplayList::create();
@@ -6606,6 +6851,21 @@ NonnullRefPtr<CSS::CSSStyleValue const> Document::custom_property_initial_value(
     return CSS::GuaranteedInvalidStyleValue::create();
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_for_dom_query(StringView selector_text) const
+{
+    if (auto selectors = m_parsed_dom_query_selectors.get(selector_text); selectors.has_value())
+        return selectors.value();
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+
+    // NOTE: A script that builds its selectors on the fly could come up with any number of different strings, so start
+    //       over rather than letting the cache grow without bound.
+    if (m_parsed_dom_query_selectors.size() >= max_parsed_dom_query_selector_count)
+        m_parsed_dom_query_selectors.clear();
+    m_parsed_dom_query_selectors.set(MUST(String::from_utf8(selector_text)), selectors);
+    return selectors;
+}
+
 GC::Ptr<Element> ElementByIdMap::get(FlyString const& element_id) const
 {
     if (auto elements = m_map.get(element_id); elements.has_value() && !elements->is_empty()) {
@@ -23,6 +23,7 @@
 #include <LibUnicode/Forward.h>
 #include <LibWeb/CSS/CSSPropertyRule.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
+#include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -31,6 +32,7 @@
 #include <LibWeb/HTML/CrossOrigin/OpenerPolicy.h>
 #include <LibWeb/HTML/DocumentReadyState.h>
 #include <LibWeb/HTML/Focus.h>
+#include <LibWeb/HTML/FrameTimeline.h>
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/History.h>
 #include <LibWeb/HTML/LazyLoadingElement.h>
@@ -53,8 +55,7 @@ enum class QuirksMode {
 
 #define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X)       \
     X(DocumentAddAnElementToTheTopLayer)                  \
-    X(DocumentRequestAnElementToBeRemovedFromTheTopLayer) \
-    X(ShadowRootSetInnerHTML)
+    X(DocumentRequestAnElementToBeRemovedFromTheTopLayer)
 
 enum class InvalidateLayoutTreeReason {
 #define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASON(e) e,
@@ -185,14 +186,24 @@ public:
 
     // AD-HOC: This number increments whenever a node is added or removed from the document, or an element attribute changes.
     //         It can be used as a crude invalidation mechanism for caches that depend on the DOM structure.
+    //         Caches that only depend on one subtree should use Node::subtree_version() instead.
     u64 dom_tree_version() const { return m_dom_tree_version; }
-    void bump_dom_tree_version() { ++m_dom_tree_version; }
+    void bump_dom_tree_version(Node& changed_node, DOMTreeChange = DOMTreeChange::Structure);
 
     // AD-HOC: This number increments whenever CharacterData is modified in the document. It is used together with
     //         dom_tree_version() to understand whether either the DOM tree structure or contents were changed.
     u64 character_data_version() const { return m_character_data_version; }
     void bump_character_data_version() { ++m_character_data_version; }
 
+    // AD-HOC: This number increments whenever layout is performed. Anything that's computed from the sizes of boxes
+    //         only has to be computed again once it changed.
+    u64 layout_generation() const { return m_layout_generation; }
+
+    // AD-HOC: This number increments whenever layout is performed, a scroll offset changes or transforms may have
+    //         changed. Anything that's computed from where boxes are on the screen only has to be computed again once
+    //         it changed.
+    u64 geometry_generation() const { return m_geometry_generation; }
+
     WebIDL::ExceptionOr<void> populate_with_html_head_and_body();
 
     GC::Ptr<Selection::Selection> get_selection() const;
@@ -651,6 +662,9 @@ public:
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(GC::Ptr<Document> new_document, GC::Ptr<GC::Function<void()>> after_all_unloads = {});
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& entries_for_navigation_api);
+
     // https://html.spec.whatwg.org/multipage/dom.html#active-parser
     GC::Ptr<HTML::HTMLParser> active_parser();
 
@@ -715,6 +729,7 @@ public:
     void update_for_history_step_application(GC::Ref<HTML::SessionHistoryEntry>, bool do_not_reactivate, size_t script_history_length, size_t script_history_index, Optional<Bindings::NavigationType> navigation_type, Optional<Vector<GC::Ref<HTML::SessionHistoryEntry>>> entries_for_navigation_api = {}, GC::Ptr<HTML::SessionHistoryEntry> previous_entry_for_activation = {}, bool update_navigation_api = true);
 
     HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& shared_resource_requests();
+    void did_finish_shared_resource_request(HTML::SharedResourceRequest&);
 
     void restore_the_history_object_state(GC::Ref<HTML::SessionHistoryEntry> entry);
 
@@ -761,7 +776,11 @@ public:
     GC::RootVector<GC::Ref<Element>> elements_from_point(double x, double y);
     GC::Ptr<Element const> scrolling_element() const;
 
-    void set_needs_to_resolve_paint_only_properties() { m_needs_to_resolve_paint_only_properties = true; }
+    void set_needs_to_resolve_paint_only_properties()
+    {
+        m_needs_to_resolve_paint_only_properties = true;
+        ++m_geometry_generation;
+    }
     void set_needs_animated_style_update() { m_needs_animated_style_update = true; }
 
     virtual JS::Value named_item_value(FlyString const& name) const override;
@@ -832,9 +851,23 @@ public:
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
+    bool has_cached_display_list() const { return m_cached_display_list; }
 
     void invalidate_display_list();
 
+    // Like invalidate_display_list(), but lets stacking contexts that weren't invalidated reuse their commands.
+    void invalidate_display_list_except_retained_commands();
+
+    // For when nothing but the opacity or transform of the stacking context of this box changed, as happens on every
+    // frame of animations of those properties.
+    void did_change_opacity_or_transform_of_stacking_context(Painting::PaintableBox&);
+
+    // Bumped whenever commands retained by stacking contexts from earlier display lists must not be reused anymore.
+    u64 display_list_generation() const { return m_display_list_generation; }
+
+    // Moves the timings of the style and layout updates performed since the last painted frame into the given frame.
+    void take_style_and_layout_update_timings(HTML::FrameTimings&);
+
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
 
@@ -899,6 +932,10 @@ public:
 
     ElementByIdMap& element_by_id() const;
 
+    // Parses a selectors string passed to querySelector(), matches() and friends. Scripts tend to pass the same few
+    // strings over and over, so the result is kept around for the next call with the same string.
+    Optional<CSS::SelectorList> parse_selector_for_dom_query(StringView selector_text) const;
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -929,6 +966,8 @@ private:
 
     void run_unloading_cleanup_steps();
 
+    bool can_be_kept_in_back_forward_cache() const;
+
     void evaluate_media_rules();
 
     enum class AddLineFeed {
@@ -942,6 +981,8 @@ private:
 
     Element* find_a_potential_indicated_element(FlyString const& fragment) const;
 
+    RefPtr<Painting::DisplayList> copy_cached_display_list_with_updated_opacities_and_transforms();
+
     void dispatch_events_for_transition(GC::Ref<CSS::CSSTransition>);
     void dispatch_events_for_animation_if_necessary(GC::Ref<Animations::Animation>);
 
@@ -970,6 +1011,9 @@ private:
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
 
+    static constexpr size_t max_parsed_dom_query_selector_count = 256;
+    mutable HashMap<String, Optional<CSS::SelectorList>> m_parsed_dom_query_selectors;
+
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
@@ -1168,6 +1212,7 @@ private:
     GC::Ptr<HTML::SessionHistoryEntry> m_latest_entry;
 
     HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>> m_shared_resource_requests;
+    size_t m_decoded_size_of_shared_images { 0 };
 
     // https://www.w3.org/TR/web-animations-1/#timeline-associated-with-a-document
     HashTable<GC::Ref<Animations::AnimationTimeline>> m_associated_animation_timelines;
@@ -1203,6 +1248,8 @@ private:
 
     u64 m_dom_tree_version { 0 };
     u64 m_character_data_version { 0 };
+    u64 m_layout_generation { 0 };
+    u64 m_geometry_generation { 0 };
 
     // https://drafts.csswg.org/css-position-4/#document-top-layer
     // Documents have a top layer, an ordered set containing elements from the document.
@@ -1237,6 +1284,12 @@ private:
 
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
+    u64 m_display_list_generation { 0 };
+    double m_last_recorded_device_pixels_per_css_pixel { 0 };
+    Vector<GC::Ref<Painting::PaintableBox>> m_paintables_with_changed_opacity_or_transform;
+
+    Optional<HTML::FrameTimingInterval> m_last_style_update_interval;
+    Optional<HTML::FrameTimingInterval> m_last_layout_update_interval;
 
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
@@ -8,8 +8,10 @@
 
 #include <AK/Debug.h>
 #include <AK/LexicalPath.h>
+#include <LibCore/EventLoop.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/DocumentLoading.h>
 #include <LibWeb/HTML/HTMLHeadElement.h>
@@ -61,6 +63,8 @@ bool build_xml_document(DOM::Document& document, ByteBuffer const& data, Optiona
 }
 
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#navigate-html
+static constexpr size_t minimum_document_size_to_decode_in_background = 64 * KiB;
+
 static WebIDL::ExceptionOr<GC::Ref<DOM::Document>> load_html_document(HTML::NavigationParams const& navigation_params)
 {
     // To load an HTML document, given navigation params navigationParams:
@@ -93,9 +97,29 @@ static WebIDL::ExceptionOr<GC::Ref<DOM::Document>> load_html_document(HTML::Navi
     else {
         // FIXME: Parse as we receive the document data, instead of waiting for the whole document to be fetched first.
         auto process_body = GC::create_function(document->heap(), [document, url = navigation_params.response->url().value(), mime_type = navigation_params.response->header_list()->extract_mime_type()](ByteBuffer data) {
-            Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(document->heap(), [document = document, data = move(data), url = url, mime_type] {
-                auto parser = HTML::HTMLParser::create_with_uncertain_encoding(document, data, mime_type);
-                parser->run(url);
+            Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(document->heap(), [document = document, data = move(data), url = url, mime_type] mutable {
+                // OPTIMIZATION: Tokenizing has to happen on the main thread, since the tree builder switches the
+                //               tokenizer's state and scripts can insert input as it goes. Decoding the input into
+                //               code points doesn't depend on any of that though, and takes a while for large
+                //               documents, so it happens on the thread pool while the event loop gets on with other
+                //               work.
+                auto encoding = HTML::HTMLParser::encoding_for_uncertain_input(document, data, mime_type);
+                if (data.size() < minimum_document_size_to_decode_in_background) {
+                    auto parser = HTML::HTMLParser::create(document, data, encoding);
+                    parser->run(url);
+                    return;
+                }
+
+                auto& main_thread_event_loop = Core::EventLoop::current();
+                Threading::ThreadPool::the().enqueue([&main_thread_event_loop, document = GC::Root { document }, data = move(data), url = move(url), encoding = move(encoding)]() mutable {
+                    auto decoded_input = HTML::HTMLTokenizer::decode_input(data, encoding);
+
+                    main_thread_event_loop.deferred_invoke([document = move(document), decoded_input = move(decoded_input), url = move(url), encoding = move(encoding)]() mutable {
+                        auto parser = HTML::HTMLParser::create(*document, move(decoded_input), encoding);
+                        parser->run(url);
+                    });
+                    main_thread_event_loop.wake();
+                });
             }));
         });
 
@@ -36,6 +36,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/HTMLCollection.h>
+#include <LibWeb/DOM/MutationType.h>
 #include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
@@ -79,6 +80,7 @@
 #include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/InlineNode.h>
 #include <LibWeb/Layout/ListItemBox.h>
+#include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
@@ -189,7 +191,10 @@ GC::Ptr<Attr> Element::get_attribute_node(FlyString const& name) const
     // The getAttributeNode(qualifiedName) method steps are to return the result of getting an attribute given qualifiedName and this.
     if (!m_attributes)
         return {};
-    return m_attributes->get_attribute(name);
+    size_t item_index = 0;
+    if (!m_attributes->get_attribute(name, &item_index))
+        return {};
+    return m_attributes->attr_at(item_index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-getattributenodens
@@ -198,7 +203,10 @@ GC::Ptr<Attr> Element::get_attribute_node_ns(Optional<FlyString> const& namespac
     // The getAttributeNodeNS(namespace, localName) method steps are to return the result of getting an attribute given namespace, localName, and this.
     if (!m_attributes)
         return {};
-    return m_attributes->get_attribute_ns(namespace_, name);
+    size_t item_index = 0;
+    if (!m_attributes->get_attribute_ns(namespace_, name, &item_index))
+        return {};
+    return m_attributes->attr_at(item_index);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-setattribute
@@ -212,19 +220,18 @@ WebIDL::ExceptionOr<void> Element::set_attribute(FlyString const& name, String c
     bool insert_as_lowercase = namespace_uri() == Namespace::HTML && document().document_type() == Document::Type::HTML;
 
     // 3. Let attribute be the first attribute in this’s attribute list whose qualified name is qualifiedName, and null otherwise.
-    auto* attribute = attributes()->get_attribute(name);
+    size_t attribute_index = 0;
+    auto const* attribute = attributes()->get_attribute(name, &attribute_index);
 
     // 4. If attribute is null, create an attribute whose local name is qualifiedName, value is value, and node document
     //    is this’s node document, then append this attribute to this, and then return.
     if (!attribute) {
-        auto new_attribute = Attr::create(document(), insert_as_lowercase ? name.to_ascii_lowercase() : name, value);
-        m_attributes->append_attribute(new_attribute);
-
+        m_attributes->append_attribute(QualifiedName { insert_as_lowercase ? name.to_ascii_lowercase() : name, {}, {} }, value);
         return {};
     }
 
     // 5. Change attribute to value.
-    attribute->change_attribute(value);
+    m_attributes->change_attribute(attribute_index, value);
 
     return {};
 }
@@ -354,7 +361,13 @@ WebIDL::ExceptionOr<void> Element::set_attribute_ns(Optional<FlyString> const& n
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
 void Element::append_attribute(FlyString const& name, String const& value)
 {
-    attributes()->append_attribute(Attr::create(document(), name, value));
+    attributes()->append_attribute(QualifiedName { name, {}, {} }, value);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-append
+void Element::append_attribute(QualifiedName name, String value)
+{
+    attributes()->append_attribute(move(name), move(value));
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
@@ -367,22 +380,19 @@ void Element::append_attribute(Attr& attribute)
 void Element::set_attribute_value(FlyString const& local_name, String const& value, Optional<FlyString> const& prefix, Optional<FlyString> const& namespace_)
 {
     // 1. Let attribute be the result of getting an attribute given namespace, localName, and element.
-    auto* attribute = attributes()->get_attribute_ns(namespace_, local_name);
+    size_t attribute_index = 0;
+    auto const* attribute = attributes()->get_attribute_ns(namespace_, local_name, &attribute_index);
 
     // 2. If attribute is null, create an attribute whose namespace is namespace, namespace prefix is prefix, local name
     //    is localName, value is value, and node document is element’s node document, then append this attribute to element,
     //    and then return.
     if (!attribute) {
-        QualifiedName name { local_name, prefix, namespace_ };
-
-        auto new_attribute = Attr::create(document(), move(name), value);
-        m_attributes->append_attribute(new_attribute);
-
+        m_attributes->append_attribute(QualifiedName { local_name, prefix, namespace_ }, value);
         return;
     }
 
     // 3. Change attribute to value.
-    attribute->change_attribute(value);
+    m_attributes->change_attribute(attribute_index, value);
 }
 
 // https://dom.spec.whatwg.org/#dom-element-setattributenode
@@ -456,15 +466,14 @@ WebIDL::ExceptionOr<bool> Element::toggle_attribute(FlyString const& name, Optio
     bool insert_as_lowercase = namespace_uri() == Namespace::HTML && document().document_type() == Document::Type::HTML;
 
     // 3. Let attribute be the first attribute in this’s attribute list whose qualified name is qualifiedName, and null otherwise.
-    auto* attribute = attributes()->get_attribute(name);
+    auto const* attribute = attributes()->get_attribute(name);
 
     // 4. If attribute is null, then:
     if (!attribute) {
         // 1. If force is not given or is true, create an attribute whose local name is qualifiedName, value is the empty
         //    string, and node document is this’s node document, then append this attribute to this, and then return true.
         if (!force.has_value() || force.value()) {
-            auto new_attribute = Attr::create(document(), insert_as_lowercase ? name.to_ascii_lowercase() : name.to_string(), String {});
-            m_attributes->append_attribute(new_attribute);
+            m_attributes->append_attribute(QualifiedName { insert_as_lowercase ? name.to_ascii_lowercase() : name, {}, {} }, String {});
 
             return true;
         }
@@ -490,10 +499,8 @@ Vector<String> Element::get_attribute_names() const
     if (!m_attributes)
         return {};
     Vector<String> names;
-    for (size_t i = 0; i < m_attributes->length(); ++i) {
-        auto const* attribute = m_attributes->item(i);
-        names.append(attribute->name().to_string());
-    }
+    for (size_t i = 0; i < m_attributes->length(); ++i)
+        names.append(m_attributes->entry_at(i).name().to_string());
     return names;
 }
 
@@ -648,13 +655,40 @@ GC::Ptr<Layout::NodeWithStyle> Element::create_layout_node_for_display_type(DOM:
     return document.heap().allocate<Layout::InlineNode>(document, element, move(style));
 }
 
+// https://dom.spec.whatwg.org/#handle-attribute-changes
+void Element::handle_attribute_changes(QualifiedName const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value)
+{
+    auto const& local_name = attribute_name.local_name();
+    auto const& namespace_ = attribute_name.namespace_();
+
+    // 1. Queue a mutation record of "attributes" for element with attribute’s local name, attribute’s namespace, oldValue, « », « », null, and null.
+    queue_mutation_record(MutationType::attributes, local_name, namespace_, old_value, {}, {}, nullptr, nullptr);
+
+    // 2. If element is custom, then enqueue a custom element callback reaction with element, callback name "attributeChangedCallback",
+    //    and « attribute’s local name, oldValue, newValue, attribute’s namespace ».
+    if (is_custom()) {
+        auto& vm = this->vm();
+
+        GC::RootVector<JS::Value> arguments { vm.heap() };
+        arguments.append(JS::PrimitiveString::create(vm, local_name));
+        arguments.append(!old_value.has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, old_value.value()));
+        arguments.append(!new_value.has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, new_value.value()));
+        arguments.append(!namespace_.has_value() ? JS::js_null() : JS::PrimitiveString::create(vm, namespace_.value()));
+
+        enqueue_a_custom_element_callback_reaction(HTML::CustomElementReactionNames::attributeChangedCallback, move(arguments));
+    }
+
+    // 3. Run the attribute change steps with element, attribute’s local name, oldValue, newValue, and attribute’s namespace.
+    run_attribute_change_steps(local_name, old_value, new_value, namespace_);
+}
+
 void Element::run_attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_)
 {
     attribute_changed(local_name, old_value, value, namespace_);
 
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
-        document().bump_dom_tree_version();
+        document().bump_dom_tree_version(*this, DOMTreeChange::Attribute);
     }
 }
 
@@ -760,8 +794,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
         layout_node()->apply_style(*m_computed_properties);
-        if (invalidation.repaint && paintable())
-            paintable()->set_needs_display();
+        if (invalidation.repaint)
+            set_needs_display_after_style_change();
 
         // Do the same for pseudo-elements.
         for (auto i = 0; i < to_underlying(CSS::PseudoElement::KnownPseudoElementCount); i++) {
@@ -776,8 +810,12 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
 
             if (auto node_with_style = pseudo_element->layout_node()) {
                 node_with_style->apply_style(*pseudo_element_style);
-                if (invalidation.repaint && node_with_style->first_paintable())
-                    node_with_style->first_paintable()->set_needs_display();
+                if (invalidation.repaint) {
+                    if (auto* paintable = node_with_style->first_paintable())
+                        paintable->set_needs_display();
+                    else
+                        document().invalidate_display_list();
+                }
             }
         }
     }
@@ -826,9 +864,20 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_inherited_style()
         return invalidation;
 
     layout_node()->apply_style(*computed_properties);
+    if (invalidation.repaint)
+        set_needs_display_after_style_change();
     return invalidation;
 }
 
+void Element::set_needs_display_after_style_change()
+{
+    // NOTE: Without a paintable we don't know which stacking context paints us, so the whole display list is invalidated.
+    if (auto* paintable = this->paintable())
+        paintable->set_needs_display();
+    else
+        document().invalidate_display_list();
+}
+
 GC::Ref<CSS::ComputedProperties> Element::resolved_css_values(Optional<CSS::PseudoElement> type)
 {
     auto element_computed_style = CSS::CSSStyleProperties::create_resolved_style(realm(), AbstractElement { *this, type });
@@ -965,7 +1014,7 @@ GC::Ptr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_dom_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -985,7 +1034,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_dom_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -1545,6 +1594,10 @@ bool Element::includes_properties_from_invalidation_set(CSS::InvalidationSet con
             case CSS::PseudoClass::LocalLink: {
                 return matches_local_link_pseudo_class();
             }
+            case CSS::PseudoClass::Required:
+            case CSS::PseudoClass::Optional:
+                // NOTE: Only form controls can match these, so we conservatively include all of them.
+                return is<HTML::HTMLInputElement>(*this) || is<HTML::HTMLSelectElement>(*this) || is<HTML::HTMLTextAreaElement>(*this);
             default:
                 VERIFY_NOT_REACHED();
             }
@@ -2762,15 +2815,14 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
     //    and « attribute's local name, null, attribute's value, attribute's namespace ».
     size_t attribute_count = m_attributes ? m_attributes->length() : 0;
     for (size_t attribute_index = 0; attribute_index < attribute_count; ++attribute_index) {
-        auto const* attribute = m_attributes->item(attribute_index);
-        VERIFY(attribute);
+        auto const& attribute = m_attributes->entry_at(attribute_index);
 
         GC::RootVector<JS::Value> arguments { vm.heap() };
 
-        arguments.append(JS::PrimitiveString::create(vm, attribute->local_name()));
+        arguments.append(JS::PrimitiveString::create(vm, attribute.local_name()));
         arguments.append(JS::js_null());
-        arguments.append(JS::PrimitiveString::create(vm, attribute->value()));
-        arguments.append(attribute->namespace_uri().has_value() ? JS::PrimitiveString::create(vm, attribute->namespace_uri().value()) : JS::js_null());
+        arguments.append(JS::PrimitiveString::create(vm, attribute.value()));
+        arguments.append(attribute.namespace_uri().has_value() ? JS::PrimitiveString::create(vm, attribute.namespace_uri().value()) : JS::js_null());
 
         enqueue_a_custom_element_callback_reaction(HTML::CustomElementReactionNames::attributeChangedCallback, move(arguments));
     }
@@ -2913,18 +2965,18 @@ Optional<String> Element::locate_a_namespace_prefix(Optional<String> const& name
     return {};
 }
 
-void Element::for_each_attribute(Function<void(Attr const&)> callback) const
+void Element::for_each_attribute(Function<void(AttributeListEntry const&)> callback) const
 {
     if (!m_attributes)
         return;
     for (size_t i = 0; i < m_attributes->length(); ++i)
-        callback(*m_attributes->item(i));
+        callback(m_attributes->entry_at(i));
 }
 
 void Element::for_each_attribute(Function<void(FlyString const&, String const&)> callback) const
 {
-    for_each_attribute([&callback](Attr const& attr) {
-        callback(attr.name(), attr.value());
+    for_each_attribute([&callback](AttributeListEntry const& attribute) {
+        callback(attribute.name(), attribute.value());
     });
 }
 
@@ -3816,6 +3868,16 @@ void Element::attribute_changed(FlyString const& local_name, Optional<String> co
             m_dir = Dir::Auto;
         else
             m_dir = {};
+    } else if (local_name == HTML::AttributeNames::lang) {
+        // NOTE: Text transforms depend on the language, so the text for rendering of the text nodes that inherit it has to
+        //       be computed again.
+        for_each_in_subtree_of_type<Text>([](Text& text) {
+            if (auto* layout_node = text.layout_node(); layout_node && layout_node->is_text_node()) {
+                static_cast<Layout::TextNode&>(*layout_node).invalidate_text_for_rendering();
+                layout_node->set_needs_layout_update(SetNeedsLayoutReason::StyleChange);
+            }
+            return TraversalDecision::Continue;
+        });
     }
 
     // https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#reflecting-content-attributes-in-idl-attributes:concept-element-attributes-change-ext
@@ -151,6 +151,7 @@ public:
     WebIDL::ExceptionOr<GC::Ptr<Attr>> set_attribute_node_ns(Attr&);
 
     void append_attribute(FlyString const& name, String const& value);
+    void append_attribute(QualifiedName, String value);
     void append_attribute(Attr&);
     void remove_attribute(FlyString const& name);
     void remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& name);
@@ -185,7 +186,7 @@ public:
     int client_height() const;
     [[nodiscard]] double current_css_zoom() const;
 
-    void for_each_attribute(Function<void(Attr const&)>) const;
+    void for_each_attribute(Function<void(AttributeListEntry const&)>) const;
 
     void for_each_attribute(Function<void(FlyString const&, String const&)>) const;
 
@@ -198,6 +199,7 @@ public:
     virtual bool is_presentational_hint(FlyString const&) const { return false; }
     virtual void apply_presentational_hints(GC::Ref<CSS::CascadedProperties>) const { }
 
+    void handle_attribute_changes(QualifiedName const&, Optional<String> const& old_value, Optional<String> const& new_value);
     void run_attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_);
 
     CSS::RequiredInvalidationAfterStyleChange recompute_style();
@@ -545,6 +547,7 @@ private:
     FlyString make_html_uppercased_qualified_name() const;
 
     void invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value);
+    void set_needs_display_after_style_change();
 
     WebIDL::ExceptionOr<GC::Ptr<Node>> insert_adjacent(StringView where, GC::Ref<Node> node);
 
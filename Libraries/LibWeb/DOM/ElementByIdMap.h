@@ -17,6 +17,18 @@ public:
     void remove(FlyString const& element_id, Element&);
     GC::Ptr<Element> get(FlyString const& element_id) const;
 
+    template<typename Callback>
+    void for_each_element_with_id(FlyString const& element_id, Callback callback) const
+    {
+        auto elements = m_map.get(element_id);
+        if (!elements.has_value())
+            return;
+        for (auto const& element : *elements) {
+            if (element.has_value())
+                callback(*element);
+        }
+    }
+
 private:
     HashMap<FlyString, Vector<WeakPtr<Element>>> m_map;
 };
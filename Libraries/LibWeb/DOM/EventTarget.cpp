@@ -898,6 +898,17 @@ bool EventTarget::has_event_listener(FlyString const& type) const
     return false;
 }
 
+bool EventTarget::has_non_passive_event_listener(FlyString const& type) const
+{
+    if (!m_data)
+        return false;
+    for (auto& listener : m_data->event_listener_list) {
+        if (listener->type == type && !listener->passive.value_or(false))
+            return true;
+    }
+    return false;
+}
+
 bool EventTarget::has_event_listeners() const
 {
     return m_data && !m_data->event_listener_list.is_empty();
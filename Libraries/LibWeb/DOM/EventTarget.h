@@ -57,6 +57,7 @@ public:
     void set_event_handler_attribute(FlyString const& name, WebIDL::CallbackType*);
 
     bool has_event_listener(FlyString const& type) const;
+    bool has_non_passive_event_listener(FlyString const& type) const;
     bool has_event_listeners() const;
 
     virtual bool is_window_or_worker_global_scope_mixin() const { return false; }
@@ -17,16 +17,17 @@ namespace Web::DOM {
 
 GC_DEFINE_ALLOCATOR(HTMLCollection);
 
-GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterDependsOnAttributes filter_depends_on_attributes)
 {
-    return root.realm().create<HTMLCollection>(root, scope, move(filter));
+    return root.realm().create<HTMLCollection>(root, scope, move(filter), filter_depends_on_attributes);
 }
 
-HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterDependsOnAttributes filter_depends_on_attributes)
     : PlatformObject(root.realm())
     , m_root(root)
     , m_filter(move(filter))
     , m_scope(scope)
+    , m_filter_depends_on_attributes(filter_depends_on_attributes)
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
         .supports_indexed_properties = true,
@@ -74,28 +75,60 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
     }
 }
 
-void HTMLCollection::update_cache_if_needed() const
+u64 HTMLCollection::current_subtree_version() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // OPTIMIZATION: Only changes to the root's subtree can change what's in the collection, and attribute changes can
+    //               only do so if the filter looks at attributes.
+    if (m_filter_depends_on_attributes == FilterDependsOnAttributes::No)
+        return m_root->subtree_structure_version();
+    return m_root->subtree_version();
+}
+
+void HTMLCollection::invalidate_cache_if_needed() const
+{
+    // Nothing to do, the subtree hasn't changed since we last filled in the cache.
+    auto subtree_version = current_subtree_version();
+    if (m_cached_subtree_version == subtree_version)
         return;
 
     m_cached_elements.clear();
+    m_cached_elements_are_complete = false;
     m_cached_name_to_element_mappings = nullptr;
+    m_cached_subtree_version = subtree_version;
+}
+
+Element* HTMLCollection::next_matching_element(Element const* after) const
+{
     if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return IterationDecision::Continue;
-        });
+        auto const* node = after ? after->next_in_pre_order(m_root.ptr()) : m_root->first_child();
+        for (; node; node = node->next_in_pre_order(m_root.ptr())) {
+            if (auto const* element = as_if<Element>(*node); element && m_filter(*element))
+                return const_cast<Element*>(element);
+        }
+        return nullptr;
+    }
+
+    auto const* element = after ? after->next_element_sibling() : m_root->first_child_of_type<Element>();
+    for (; element; element = element->next_element_sibling()) {
+        if (m_filter(*element))
+            return const_cast<Element*>(element);
+    }
+    return nullptr;
+}
+
+void HTMLCollection::update_cache_if_needed(size_t up_to_index) const
+{
+    invalidate_cache_if_needed();
+
+    while (!m_cached_elements_are_complete && m_cached_elements.size() <= up_to_index) {
+        auto const* last_cached_element = m_cached_elements.is_empty() ? nullptr : m_cached_elements.last().ptr();
+        auto* element = next_matching_element(last_cached_element);
+        if (!element) {
+            m_cached_elements_are_complete = true;
+            break;
+        }
+        m_cached_elements.append(*element);
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
@@ -119,7 +152,7 @@ size_t HTMLCollection::length() const
 Element* HTMLCollection::item(size_t index) const
 {
     // The item(index) method steps are to return the indexth element in the collection. If there is no indexth element in the collection, then the method must return null.
-    update_cache_if_needed();
+    update_cache_if_needed(index);
     if (index >= m_cached_elements.size())
         return nullptr;
     return m_cached_elements[index];
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/NumericLimits.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Forward.h>
@@ -30,7 +31,15 @@ public:
         Children,
         Descendants,
     };
-    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+
+    // Whether the filter looks at attributes, and so has to be run again when an attribute changes. Filters that only
+    // look at what elements are and where they are in the tree should say No.
+    enum class FilterDependsOnAttributes {
+        No,
+        Yes,
+    };
+
+    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterDependsOnAttributes = FilterDependsOnAttributes::Yes);
 
     virtual ~HTMLCollection() override;
 
@@ -46,7 +55,7 @@ public:
     virtual bool is_supported_property_name(FlyString const&) const override;
 
 protected:
-    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterDependsOnAttributes = FilterDependsOnAttributes::Yes);
 
     virtual void initialize(JS::Realm&) override;
 
@@ -56,17 +65,24 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    void update_cache_if_needed() const;
+    u64 current_subtree_version() const;
+    void invalidate_cache_if_needed() const;
+    void update_cache_if_needed(size_t up_to_index = NumericLimits<size_t>::max()) const;
     void update_name_to_element_mappings_if_needed() const;
+    Element* next_matching_element(Element const* after) const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    // NOTE: The cache is only filled in as far as someone has looked, so that e.g. item(0) doesn't have to walk the
+    //       entire subtree. Walking on picks up from the last cached element.
+    mutable u64 m_cached_subtree_version { NumericLimits<u64>::max() };
     mutable Vector<GC::Ref<Element>> m_cached_elements;
+    mutable bool m_cached_elements_are_complete { false };
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
     GC::Ref<ParentNode> m_root;
     Function<bool(Element const&)> m_filter;
 
     Scope m_scope { Scope::Descendants };
+    FilterDependsOnAttributes m_filter_depends_on_attributes { FilterDependsOnAttributes::Yes };
 };
 
 }
@@ -14,16 +14,17 @@ namespace Web::DOM {
 
 GC_DEFINE_ALLOCATOR(LiveNodeList);
 
-GC::Ref<NodeList> LiveNodeList::create(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter)
+GC::Ref<NodeList> LiveNodeList::create(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter, FilterDependsOnAttributes filter_depends_on_attributes)
 {
-    return realm.create<LiveNodeList>(realm, root, scope, move(filter));
+    return realm.create<LiveNodeList>(realm, root, scope, move(filter), filter_depends_on_attributes);
 }
 
-LiveNodeList::LiveNodeList(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter)
+LiveNodeList::LiveNodeList(JS::Realm& realm, Node const& root, Scope scope, Function<bool(Node const&)> filter, FilterDependsOnAttributes filter_depends_on_attributes)
     : NodeList(realm)
     , m_root(root)
     , m_filter(move(filter))
     , m_scope(scope)
+    , m_filter_depends_on_attributes(filter_depends_on_attributes)
 {
 }
 
@@ -33,64 +34,77 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_root);
+    visitor.visit(m_cached_nodes);
 }
 
-GC::RootVector<Node*> LiveNodeList::collection() const
+Node const* LiveNodeList::next_matching_node(Node const* after) const
 {
-    GC::RootVector<Node*> nodes(heap());
     if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return IterationDecision::Continue;
-        });
+        auto const* node = after ? after->next_in_pre_order(m_root.ptr()) : m_root->first_child();
+        for (; node; node = node->next_in_pre_order(m_root.ptr())) {
+            if (m_filter(*node))
+                return node;
+        }
+        return nullptr;
+    }
+
+    auto const* node = after ? after->next_sibling() : m_root->first_child();
+    for (; node; node = node->next_sibling()) {
+        if (m_filter(*node))
+            return node;
+    }
+    return nullptr;
+}
+
+void LiveNodeList::update_cache_if_needed(size_t up_to_index) const
+{
+    // See HTMLCollection::current_subtree_version().
+    auto subtree_version = m_filter_depends_on_attributes == FilterDependsOnAttributes::No
+        ? m_root->subtree_structure_version()
+        : m_root->subtree_version();
+    if (m_cached_subtree_version != subtree_version) {
+        m_cached_nodes.clear();
+        m_cached_nodes_are_complete = false;
+        m_cached_subtree_version = subtree_version;
+    }
+
+    while (!m_cached_nodes_are_complete && m_cached_nodes.size() <= up_to_index) {
+        auto const* last_cached_node = m_cached_nodes.is_empty() ? nullptr : m_cached_nodes.last().ptr();
+        auto const* node = next_matching_node(last_cached_node);
+        if (!node) {
+            m_cached_nodes_are_complete = true;
+            break;
+        }
+        m_cached_nodes.append(*node);
     }
-    return nodes;
 }
 
 Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) const
 {
-    Node* matched_node = nullptr;
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node) && filter(node)) {
-                matched_node = const_cast<Node*>(&node);
-                return TraversalDecision::Break;
-            }
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node) && filter(node)) {
-                matched_node = const_cast<Node*>(&node);
-                return IterationDecision::Break;
-            }
-            return IterationDecision::Continue;
-        });
+    for (size_t index = 0;; ++index) {
+        update_cache_if_needed(index);
+        if (index >= m_cached_nodes.size())
+            return nullptr;
+        if (filter(m_cached_nodes[index]))
+            return const_cast<Node*>(m_cached_nodes[index].ptr());
     }
-    return matched_node;
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-length
 u32 LiveNodeList::length() const
 {
-    return collection().size();
+    update_cache_if_needed();
+    return m_cached_nodes.size();
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-item
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
-    auto nodes = collection();
-    if (index >= nodes.size())
+    update_cache_if_needed(index);
+    if (index >= m_cached_nodes.size())
         return nullptr;
-    return nodes[index];
+    return m_cached_nodes[index];
 }
 
 }
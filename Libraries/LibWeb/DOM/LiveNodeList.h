@@ -8,12 +8,11 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/NumericLimits.h>
 #include <LibWeb/DOM/NodeList.h>
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
     GC_DECLARE_ALLOCATOR(LiveNodeList);
@@ -24,25 +23,38 @@ public:
         Descendants,
     };
 
-    [[nodiscard]] static GC::Ref<NodeList> create(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter);
+    // See HTMLCollection::FilterDependsOnAttributes.
+    enum class FilterDependsOnAttributes {
+        No,
+        Yes,
+    };
+
+    [[nodiscard]] static GC::Ref<NodeList> create(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter, FilterDependsOnAttributes = FilterDependsOnAttributes::Yes);
     virtual ~LiveNodeList() override;
 
     virtual u32 length() const override;
     virtual Node const* item(u32 index) const override;
 
 protected:
-    LiveNodeList(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter);
+    LiveNodeList(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter, FilterDependsOnAttributes = FilterDependsOnAttributes::Yes);
 
     Node* first_matching(Function<bool(Node const&)> const& filter) const;
 
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    GC::RootVector<Node*> collection() const;
+    void update_cache_if_needed(size_t up_to_index = NumericLimits<size_t>::max()) const;
+    Node const* next_matching_node(Node const* after) const;
+
+    // NOTE: Like HTMLCollection, this only fills in the cache as far as someone has looked.
+    mutable u64 m_cached_subtree_version { NumericLimits<u64>::max() };
+    mutable Vector<GC::Ref<Node const>> m_cached_nodes;
+    mutable bool m_cached_nodes_are_complete { false };
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
     Scope m_scope { Scope::Descendants };
+    FilterDependsOnAttributes m_filter_depends_on_attributes { FilterDependsOnAttributes::Yes };
 };
 
 }
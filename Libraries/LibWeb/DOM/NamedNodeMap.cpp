@@ -9,6 +9,7 @@
 #include <LibWeb/Bindings/NamedNodeMapPrototype.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Namespace.h>
@@ -44,7 +45,18 @@ void NamedNodeMap::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_element);
-    visitor.visit(m_attributes);
+    for (auto const& attribute : m_attributes)
+        visitor.visit(attribute.m_attr);
+}
+
+Attr& NamedNodeMap::attr_at(size_t index) const
+{
+    auto& attribute = m_attributes[index];
+    if (!attribute.m_attr) {
+        auto& element = const_cast<Element&>(associated_element());
+        attribute.m_attr = Attr::create(element.document(), attribute.m_qualified_name, move(attribute.m_value), &element);
+    }
+    return *attribute.m_attr;
 }
 
 // https://dom.spec.whatwg.org/#ref-for-dfn-supported-property-names%E2%91%A0
@@ -55,7 +67,7 @@ Vector<FlyString> NamedNodeMap::supported_property_names() const
     names.ensure_capacity(m_attributes.size());
 
     for (auto const& attribute : m_attributes) {
-        auto const attribute_name = attribute->name();
+        auto const& attribute_name = attribute.name();
         if (!names.contains_slow(attribute_name))
             names.append(attribute_name.to_string());
     }
@@ -79,19 +91,25 @@ Attr const* NamedNodeMap::item(u32 index) const
         return nullptr;
 
     // 2. Otherwise, return this’s attribute list[index].
-    return m_attributes[index].ptr();
+    return &attr_at(index);
 }
 
 // https://dom.spec.whatwg.org/#dom-namednodemap-getnameditem
 Attr const* NamedNodeMap::get_named_item(FlyString const& qualified_name) const
 {
-    return get_attribute(qualified_name);
+    size_t item_index = 0;
+    if (!get_attribute(qualified_name, &item_index))
+        return nullptr;
+    return &attr_at(item_index);
 }
 
 // https://dom.spec.whatwg.org/#dom-namednodemap-getnameditemns
 Attr const* NamedNodeMap::get_named_item_ns(Optional<FlyString> const& namespace_, FlyString const& local_name) const
 {
-    return get_attribute_ns(namespace_, local_name);
+    size_t item_index = 0;
+    if (!get_attribute_ns(namespace_, local_name, &item_index))
+        return nullptr;
+    return &attr_at(item_index);
 }
 
 // https://dom.spec.whatwg.org/#dom-namednodemap-setnameditem
@@ -110,38 +128,44 @@ WebIDL::ExceptionOr<GC::Ptr<Attr>> NamedNodeMap::set_named_item_ns(Attr& attribu
 WebIDL::ExceptionOr<Attr const*> NamedNodeMap::remove_named_item(FlyString const& qualified_name)
 {
     // 1. Let attr be the result of removing an attribute given qualifiedName and element.
-    auto const* attribute = remove_attribute(qualified_name);
+    // NOTE: This has to return the removed Attr, so one is created for the attribute before it's removed.
+    size_t item_index = 0;
+    GC::Ptr<Attr> attribute;
+    if (get_attribute(qualified_name, &item_index)) {
+        attribute = attr_at(item_index);
+        remove_attribute_at_index(item_index);
+    }
 
     // 2. If attr is null, then throw a "NotFoundError" DOMException.
     if (!attribute)
         return WebIDL::NotFoundError::create(realm(), MUST(String::formatted("Attribute with name '{}' not found", qualified_name)));
 
     // 3. Return attr.
-    return attribute;
+    return attribute.ptr();
 }
 
 // https://dom.spec.whatwg.org/#dom-namednodemap-removenameditemns
 WebIDL::ExceptionOr<Attr const*> NamedNodeMap::remove_named_item_ns(Optional<FlyString> const& namespace_, FlyString const& local_name)
 {
     // 1. Let attr be the result of removing an attribute given namespace, localName, and element.
-    auto const* attribute = remove_attribute_ns(namespace_, local_name);
+    // NOTE: This has to return the removed Attr, so one is created for the attribute before it's removed.
+    size_t item_index = 0;
+    GC::Ptr<Attr> attribute;
+    if (get_attribute_ns(namespace_, local_name, &item_index)) {
+        attribute = attr_at(item_index);
+        remove_attribute_at_index(item_index);
+    }
 
     // 2. If attr is null, then throw a "NotFoundError" DOMException.
     if (!attribute)
         return WebIDL::NotFoundError::create(realm(), MUST(String::formatted("Attribute with namespace '{}' and local name '{}' not found", namespace_, local_name)));
 
     // 3. Return attr.
-    return attribute;
+    return attribute.ptr();
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-get-by-name
-Attr* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t* item_index)
-{
-    return const_cast<Attr*>(const_cast<NamedNodeMap const*>(this)->get_attribute(qualified_name, item_index));
-}
-
-// https://dom.spec.whatwg.org/#concept-element-attributes-get-by-name
-Attr const* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t* item_index) const
+AttributeListEntry const* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t* item_index) const
 {
     if (item_index)
         *item_index = 0;
@@ -152,11 +176,11 @@ Attr const* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t*
     // 2. Return the first attribute in element’s attribute list whose qualified name is qualifiedName; otherwise null.
     for (auto const& attribute : m_attributes) {
         if (compare_as_lowercase) {
-            if (attribute->name().equals_ignoring_ascii_case(qualified_name) && !AK::any_of(attribute->name().bytes(), is_ascii_upper_alpha))
-                return attribute;
+            if (attribute.name().equals_ignoring_ascii_case(qualified_name) && !AK::any_of(attribute.name().bytes(), is_ascii_upper_alpha))
+                return &attribute;
         } else {
-            if (attribute->name() == qualified_name)
-                return attribute;
+            if (attribute.name() == qualified_name)
+                return &attribute;
         }
 
         if (item_index)
@@ -167,13 +191,7 @@ Attr const* NamedNodeMap::get_attribute(FlyString const& qualified_name, size_t*
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-get-by-namespace
-Attr* NamedNodeMap::get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index)
-{
-    return const_cast<Attr*>(const_cast<NamedNodeMap const*>(this)->get_attribute_ns(namespace_, local_name, item_index));
-}
-
-// https://dom.spec.whatwg.org/#concept-element-attributes-get-by-namespace
-Attr const* NamedNodeMap::get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index) const
+AttributeListEntry const* NamedNodeMap::get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index) const
 {
     if (item_index)
         *item_index = 0;
@@ -185,8 +203,8 @@ Attr const* NamedNodeMap::get_attribute_ns(Optional<FlyString> const& namespace_
 
     // 2. Return the attribute in element’s attribute list whose namespace is namespace and local name is localName, if any; otherwise null.
     for (auto const& attribute : m_attributes) {
-        if (attribute->namespace_uri() == normalized_namespace && attribute->local_name() == local_name)
-            return attribute.ptr();
+        if (attribute.namespace_uri() == normalized_namespace && attribute.local_name() == local_name)
+            return &attribute;
         if (item_index)
             ++(*item_index);
     }
@@ -203,7 +221,9 @@ WebIDL::ExceptionOr<GC::Ptr<Attr>> NamedNodeMap::set_attribute(Attr& attribute)
 
     // 2. Let oldAttr be the result of getting an attribute given attr’s namespace, attr’s local name, and element.
     size_t old_attribute_index = 0;
-    auto* old_attribute = get_attribute_ns(attribute.namespace_uri(), attribute.local_name(), &old_attribute_index);
+    GC::Ptr<Attr> old_attribute;
+    if (get_attribute_ns(attribute.namespace_uri(), attribute.local_name(), &old_attribute_index))
+        old_attribute = attr_at(old_attribute_index);
 
     // 3. If oldAttr is attr, return attr.
     if (old_attribute == &attribute)
@@ -211,7 +231,7 @@ WebIDL::ExceptionOr<GC::Ptr<Attr>> NamedNodeMap::set_attribute(Attr& attribute)
 
     // 4. If oldAttr is non-null, then replace oldAttr with attr.
     if (old_attribute) {
-        replace_attribute(*old_attribute, attribute, old_attribute_index);
+        replace_attribute(old_attribute_index, attribute);
     }
     // 5. Otherwise, append attr to element.
     else {
@@ -223,35 +243,33 @@ WebIDL::ExceptionOr<GC::Ptr<Attr>> NamedNodeMap::set_attribute(Attr& attribute)
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-replace
-void NamedNodeMap::replace_attribute(Attr& old_attribute, Attr& new_attribute, size_t old_attribute_index)
+void NamedNodeMap::replace_attribute(size_t old_attribute_index, Attr& new_attribute)
 {
-    VERIFY(old_attribute.owner_element());
-
     // 1. Let element be oldAttribute’s element.
-    auto* element = old_attribute.owner_element();
+    auto& element = associated_element();
 
     // 2. Replace oldAttribute by newAttribute in element’s attribute list.
-    m_attributes.remove(old_attribute_index);
-    m_attributes.insert(old_attribute_index, new_attribute);
+    auto old_attribute = exchange(m_attributes[old_attribute_index], AttributeListEntry { new_attribute });
 
     // 3. Set newAttribute’s element to element.
-    new_attribute.set_owner_element(element);
+    new_attribute.set_owner_element(&element);
 
     // 4. Set newAttribute’s node document to element’s node document.
-    new_attribute.set_document(Badge<NamedNodeMap> {}, element->document());
+    new_attribute.set_document(Badge<NamedNodeMap> {}, element.document());
 
     // 5. Set oldAttribute’s element to null.
-    old_attribute.set_owner_element(nullptr);
+    if (old_attribute.m_attr)
+        old_attribute.m_attr->set_owner_element(nullptr);
 
     // 6. Handle attribute changes for oldAttribute with element, oldAttribute’s value, and newAttribute’s value.
-    old_attribute.handle_attribute_changes(*new_attribute.owner_element(), old_attribute.value(), new_attribute.value());
+    element.handle_attribute_changes(old_attribute.qualified_name(), old_attribute.value(), new_attribute.value());
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
 void NamedNodeMap::append_attribute(Attr& attribute)
 {
     // 1. Append attribute to element’s attribute list.
-    m_attributes.append(attribute);
+    m_attributes.append(AttributeListEntry { attribute });
 
     // 2. Set attribute’s element to element.
     attribute.set_owner_element(&associated_element());
@@ -260,30 +278,59 @@ void NamedNodeMap::append_attribute(Attr& attribute)
     attribute.set_document(Badge<NamedNodeMap> {}, associated_element().document());
 
     // 4. Handle attribute changes for attribute with element, null, and attribute’s value.
-    attribute.handle_attribute_changes(associated_element(), {}, attribute.value());
+    associated_element().handle_attribute_changes(attribute.qualified_name(), {}, attribute.value());
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-append
+void NamedNodeMap::append_attribute(QualifiedName qualified_name, String value)
+{
+    // NOTE: This appends an attribute without creating an Attr for it. Steps 2 and 3 happen whenever one is created.
+
+    // 1. Append attribute to element’s attribute list.
+    m_attributes.empend(qualified_name, value);
+
+    // 4. Handle attribute changes for attribute with element, null, and attribute’s value.
+    associated_element().handle_attribute_changes(qualified_name, {}, value);
+}
+
+// https://dom.spec.whatwg.org/#concept-element-attributes-change
+void NamedNodeMap::change_attribute(size_t attribute_index, String value)
+{
+    auto& attribute = m_attributes[attribute_index];
+    if (attribute.m_attr) {
+        attribute.m_attr->change_attribute(move(value));
+        return;
+    }
+
+    // 1. Let oldValue be attribute’s value.
+    // 2. Set attribute’s value to value.
+    auto old_value = exchange(attribute.m_value, value);
+
+    // 3. Handle attribute changes for attribute with attribute’s element, oldValue, and value.
+    // NOTE: The name is copied, as the attribute list may change while the attribute changes are handled.
+    auto qualified_name = attribute.qualified_name();
+    associated_element().handle_attribute_changes(qualified_name, old_value, value);
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-remove
 void NamedNodeMap::remove_attribute_at_index(size_t attribute_index)
 {
-    GC::Ref<Attr> attribute = m_attributes.at(attribute_index);
-
     // 1. Let element be attribute’s element.
-    auto* element = attribute->owner_element();
-    VERIFY(element);
+    auto& element = associated_element();
 
     // 2. Remove attribute from element’s attribute list.
-    m_attributes.remove(attribute_index);
+    auto attribute = m_attributes.take(attribute_index);
 
     // 3. Set attribute’s element to null.
-    attribute->set_owner_element(nullptr);
+    if (attribute.m_attr)
+        attribute.m_attr->set_owner_element(nullptr);
 
     // 4. Handle attribute changes for attribute with element, attribute’s value, and null.
-    attribute->handle_attribute_changes(*element, attribute->value(), {});
+    element.handle_attribute_changes(attribute.qualified_name(), attribute.value(), {});
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-remove-by-name
-Attr const* NamedNodeMap::remove_attribute(FlyString const& qualified_name)
+void NamedNodeMap::remove_attribute(FlyString const& qualified_name)
 {
     size_t item_index = 0;
 
@@ -295,11 +342,12 @@ Attr const* NamedNodeMap::remove_attribute(FlyString const& qualified_name)
         remove_attribute_at_index(item_index);
 
     // 3. Return attr.
-    return attribute;
+    // NOTE: Nothing that calls this needs the removed Attr, so none is created just to be returned. See
+    //       remove_named_item() for the one that does.
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-remove-by-namespace
-Attr const* NamedNodeMap::remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name)
+void NamedNodeMap::remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name)
 {
     size_t item_index = 0;
 
@@ -311,7 +359,7 @@ Attr const* NamedNodeMap::remove_attribute_ns(Optional<FlyString> const& namespa
         remove_attribute_at_index(item_index);
 
     // 3. Return attr.
-    return attribute;
+    // NOTE: See remove_attribute().
 }
 
 Optional<JS::Value> NamedNodeMap::item_value(size_t index) const
@@ -334,7 +382,7 @@ JS::Value NamedNodeMap::named_item_value(FlyString const& name) const
 WebIDL::ExceptionOr<GC::Ref<Attr>> NamedNodeMap::remove_attribute_node(GC::Ref<Attr> attr)
 {
     // 1. If this’s attribute list does not contain attr, then throw a "NotFoundError" DOMException.
-    auto index = m_attributes.find_first_index(attr);
+    auto index = m_attributes.find_first_index_if([&](auto const& attribute) { return attribute.m_attr == attr; });
     if (!index.has_value())
         return WebIDL::NotFoundError::create(realm(), "Attribute not found"_string);
 
@@ -10,11 +10,50 @@
 #pragma once
 
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/DOM/Attr.h>
+#include <LibWeb/DOM/QualifiedName.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::DOM {
 
+// An attribute in an element's attribute list.
+// OPTIMIZATION: Most attributes are never looked at as Attr nodes, so the node is only created once something asks for
+//               one (e.g. element.attributes or getAttributeNode()). Until then, the name and value are kept right here.
+class AttributeListEntry {
+public:
+    AttributeListEntry(QualifiedName qualified_name, String value)
+        : m_qualified_name(move(qualified_name))
+        , m_value(move(value))
+    {
+    }
+
+    explicit AttributeListEntry(Attr& attr)
+        : m_qualified_name(attr.qualified_name())
+        , m_attr(attr)
+    {
+    }
+
+    QualifiedName const& qualified_name() const { return m_qualified_name; }
+    Optional<FlyString> const& namespace_uri() const { return m_qualified_name.namespace_(); }
+    Optional<FlyString> const& prefix() const { return m_qualified_name.prefix(); }
+    FlyString const& local_name() const { return m_qualified_name.local_name(); }
+    FlyString const& lowercased_local_name() const { return m_qualified_name.lowercased_local_name(); }
+    FlyString const& name() const { return m_qualified_name.as_string(); }
+
+    // NOTE: Once there is an Attr, its value can be changed through it, so it's the one that has to be asked.
+    String const& value() const { return m_attr ? m_attr->value() : m_value; }
+
+    GC::Ptr<Attr> attr() const { return m_attr; }
+
+private:
+    friend class NamedNodeMap;
+
+    QualifiedName m_qualified_name;
+    String m_value;
+    GC::Ptr<Attr> m_attr;
+};
+
 // https://dom.spec.whatwg.org/#interface-namednodemap
 class NamedNodeMap : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(NamedNodeMap, Bindings::PlatformObject);
@@ -41,20 +80,25 @@ public:
     WebIDL::ExceptionOr<Attr const*> remove_named_item_ns(Optional<FlyString> const& namespace_, FlyString const& local_name);
 
     // Methods defined by the spec for internal use:
-    Attr* get_attribute(FlyString const& qualified_name, size_t* item_index = nullptr);
-    Attr const* get_attribute(FlyString const& qualified_name, size_t* item_index = nullptr) const;
+    AttributeListEntry const* get_attribute(FlyString const& qualified_name, size_t* item_index = nullptr) const;
     WebIDL::ExceptionOr<GC::Ptr<Attr>> set_attribute(Attr& attribute);
-    void replace_attribute(Attr& old_attribute, Attr& new_attribute, size_t old_attribute_index);
+    void replace_attribute(size_t old_attribute_index, Attr& new_attribute);
     void append_attribute(Attr& attribute);
+    void append_attribute(QualifiedName, String value);
+    void change_attribute(size_t attribute_index, String value);
 
-    Attr* get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index = nullptr);
-    Attr const* get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index = nullptr) const;
+    AttributeListEntry const* get_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name, size_t* item_index = nullptr) const;
 
-    Attr const* remove_attribute(FlyString const& qualified_name);
-    Attr const* remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name);
+    void remove_attribute(FlyString const& qualified_name);
+    void remove_attribute_ns(Optional<FlyString> const& namespace_, FlyString const& local_name);
 
     WebIDL::ExceptionOr<GC::Ref<Attr>> remove_attribute_node(GC::Ref<Attr>);
 
+    AttributeListEntry const& entry_at(size_t index) const { return m_attributes[index]; }
+
+    // Returns the Attr for the attribute at the given index, creating it first if there isn't one yet.
+    Attr& attr_at(size_t index) const;
+
 private:
     explicit NamedNodeMap(Element&);
 
@@ -67,7 +111,8 @@ private:
     void remove_attribute_at_index(size_t attribute_index);
 
     GC::Ref<DOM::Element> m_element;
-    Vector<GC::Ref<Attr>> m_attributes;
+    // NOTE: This is mutable so that Attr nodes can be created on demand by the getters.
+    mutable Vector<AttributeListEntry> m_attributes;
 };
 
 }
@@ -57,6 +57,7 @@
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Layout/TextNode.h>
+#include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/MathML/MathMLElement.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
@@ -234,7 +235,7 @@ void Node::set_text_content(Optional<String> const& maybe_content)
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeSetTextContent);
     }
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*this);
 }
 
 // https://dom.spec.whatwg.org/#dom-node-normalize
@@ -495,6 +496,50 @@ void Node::invalidate_style(StyleInvalidationReason reason)
         ancestor->m_child_needs_style_update = true;
 }
 
+void Node::invalidate_style_for_inserted_children(ReadonlySpan<GC::Root<Node>> children)
+{
+    if (children.size() == 1) {
+        children.first()->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+        return;
+    }
+
+    // OPTIMIZATION: Invalidating the style of each of the children on its own would look at all of their siblings
+    //               every time, which makes inserting a large DocumentFragment quadratic. Since they are all siblings,
+    //               we can instead do what that would have amounted to once for all of them.
+    auto first_child = children.first_matching([](auto const& child) { return !child->is_character_data(); });
+    if (!first_child.has_value())
+        return;
+
+    // NOTE: Looking for elements affected by :has() starts at the node itself, and includes all of its siblings on the
+    //       way up, so the first of the children covers all of them.
+    if (document().style_computer().may_have_has_selectors())
+        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(**first_child);
+
+    if (document().needs_full_style_update())
+        return;
+
+    for (auto* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+        if (ancestor->entire_subtree_needs_style_update())
+            return;
+    }
+
+    for (auto const& child : children) {
+        if (!child->is_character_data())
+            child->set_entire_subtree_needs_style_update(true);
+    }
+
+    // NOTE: Every sibling comes either before the last or after the first of the children, so this is the union of
+    //       the siblings that invalidating the style of each of them would have looked at.
+    for_each_child_of_type<Element>([](auto& element) {
+        if (element.style_affected_by_structural_changes())
+            element.set_entire_subtree_needs_style_update(true);
+        return IterationDecision::Continue;
+    });
+
+    for (auto* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host())
+        ancestor->m_child_needs_style_update = true;
+}
+
 void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::InvalidationSet::Property> const& properties, StyleInvalidationOptions options)
 {
     if (is_character_data())
@@ -508,6 +553,19 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
         document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
     }
 
+    auto sibling_invalidation_set = document().style_computer().sibling_invalidation_set_for_properties(properties);
+    if (!sibling_invalidation_set.is_empty()) {
+        size_t sibling_distance = 0;
+        for (auto* sibling = next_sibling(); sibling && sibling_distance < sibling_invalidation_set.max_distance; sibling = sibling->next_sibling()) {
+            auto* element = as_if<Element>(sibling);
+            if (!element)
+                continue;
+            ++sibling_distance;
+            if (sibling_invalidation_set.invalidation_set.needs_invalidate_self() || element->includes_properties_from_invalidation_set(sibling_invalidation_set.invalidation_set))
+                element->set_needs_style_update(true);
+        }
+    }
+
     auto invalidation_set = document().style_computer().invalidation_set_for_properties(properties);
     if (invalidation_set.needs_invalidate_whole_subtree()) {
         invalidate_style(reason);
@@ -671,18 +729,20 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     }
 
     // 5. If child is non-null, then:
-    if (child) {
+    if (child && !Range::live_ranges().is_empty()) {
+        auto child_index = child->index();
+
         // 1. For each live range whose start node is parent and start offset is greater than child’s index, increase
         //    its start offset by count.
         for (auto& range : Range::live_ranges()) {
-            if (range->start_container() == this && range->start_offset() > child->index())
+            if (range->start_container() == this && range->start_offset() > child_index)
                 range->increase_start_offset(count);
         }
 
         // 2. For each live range whose end node is parent and end offset is greater than child’s index, increase its
         //    end offset by count.
         for (auto& range : Range::live_ranges()) {
-            if (range->end_container() == this && range->end_offset() > child->index())
+            if (range->end_container() == this && range->end_offset() > child_index)
                 range->increase_end_offset(count);
         }
     }
@@ -727,8 +787,6 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         // 6. Run assign slottables for a tree with node’s root.
         assign_slottables_for_a_tree(node_to_insert->root());
 
-        node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
-
         // 7. For each shadow-including inclusive descendant inclusiveDescendant of node, in shadow-including tree order:
         node_to_insert->for_each_shadow_including_inclusive_descendant([&](Node& inclusive_descendant) {
             // 1. Run the insertion steps with inclusiveDescendant.
@@ -756,6 +814,8 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         });
     }
 
+    invalidate_style_for_inserted_children(nodes);
+
     // 8. If suppress observers flag is unset, then queue a tree mutation record for parent with nodes, « », previousSibling, and child.
     if (!suppress_observers) {
         queue_tree_mutation_record(nodes, {}, previous_sibling.ptr(), child.ptr());
@@ -791,8 +851,15 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     if (is_connected()) {
         if (layout_node() && layout_node()->display().is_contents() && parent_element()) {
             parent_element()->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBeforeWithDisplayContents);
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+        } else if (is_element() && !static_cast<Element const&>(*this).is_shadow_host() && !is<HTML::HTMLSlotElement>(*this) && layout_node()) {
+            // NOTE: Only the inserted nodes are marked, so that the layout tree builder can insert their layout nodes in
+            //       between the ones of their siblings. It rebuilds our layout subtree instead if it can't.
+            for (auto& node_to_insert : nodes)
+                node_to_insert->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+        } else {
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
         }
-        set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
     }
 
     // AD-HOC: invalidate the ordinal of the first list_item of the list_owner of the child node, if any.
@@ -805,7 +872,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     //       an ordinal value (default from constructor).
     // FIXME: This will not work if the child or the parent is not an element. Is insert_before even possible in this situation?
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*this);
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -935,7 +1002,7 @@ void Node::remove(bool suppress_observers)
 
         // NOTE: If we didn't have a layout node before, rebuilding the layout tree isn't gonna give us one
         //       after we've been removed from the DOM.
-        if (layout_node())
+        if (layout_node() && !Layout::TreeBuilder::remove_layout_nodes_of_node_being_removed(*this))
             parent->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeRemove);
     }
 
@@ -1027,7 +1094,7 @@ void Node::remove(bool suppress_observers)
     // 17. Run the children changed steps for parent.
     parent->children_changed(nullptr);
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*parent);
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -1240,7 +1307,7 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
 
         // NOTE: If we didn't have a layout node before, rebuilding the layout tree isn't gonna give us one
         //       after we've been removed from the DOM.
-        if (layout_node())
+        if (layout_node() && !Layout::TreeBuilder::remove_layout_nodes_of_node_being_removed(*this))
             old_parent->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeRemove);
     }
 
@@ -1358,7 +1425,8 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
     new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*old_parent);
+    document().bump_dom_tree_version(new_parent);
 
     return {};
 }
@@ -1378,24 +1446,14 @@ WebIDL::ExceptionOr<GC::Ref<Node>> Node::clone_single_node(Document& document) c
         auto element_copy = TRY(DOM::create_element(document, element.local_name(), element.namespace_uri(), element.prefix(), element.is_value()));
 
         // 2. For each attribute of node’s attribute list:
-        Optional<WebIDL::Exception> maybe_exception;
-        element.for_each_attribute([&](Attr const& attr) {
+        element.for_each_attribute([&](AttributeListEntry const& attribute) {
             // 1. Let copyAttribute be the result of cloning a single node given attribute and document.
-            auto copy_attribute_or_error = attr.clone_single_node(document);
-            if (copy_attribute_or_error.is_error()) {
-                maybe_exception = copy_attribute_or_error.release_error();
-                return;
-            }
-
-            auto copy_attribute = copy_attribute_or_error.release_value();
-
             // 2. Append copyAttribute to copy.
-            element_copy->append_attribute(as<Attr>(*copy_attribute));
+            // OPTIMIZATION: A clone of an attribute is just its name and value, so there's no need to create an Attr
+            //               for it. One is created if anything asks for it later.
+            element_copy->append_attribute(attribute.qualified_name(), attribute.value());
         });
 
-        if (maybe_exception.has_value())
-            return *maybe_exception;
-
         copy = move(element_copy);
     }
 
@@ -1516,6 +1574,20 @@ void Node::set_document(Badge<NamedNodeMap>, Document& document)
     set_document(document);
 }
 
+void Node::did_change_inclusive_subtree(Badge<Document>, DOMTreeChange change)
+{
+    // NOTE: The versions come from one counter for all documents, so that a node that's adopted into another document
+    //       can never end up with a version that a cache has already seen for a different state of its subtree.
+    static u64 s_last_subtree_version = 0;
+    auto version = ++s_last_subtree_version;
+
+    for (auto* node = this; node; node = node->parent()) {
+        node->m_subtree_version = version;
+        if (change == DOMTreeChange::Structure)
+            node->m_subtree_structure_version = version;
+    }
+}
+
 void Node::set_document(Document& document)
 {
     if (m_document.ptr() == &document)
@@ -1723,7 +1795,7 @@ GC::Ref<NodeList> Node::child_nodes()
     if (!m_child_nodes) {
         m_child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
             return true;
-        });
+        }, LiveNodeList::FilterDependsOnAttributes::No);
     }
     return *m_child_nodes;
 }
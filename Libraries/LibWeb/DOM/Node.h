@@ -48,6 +48,13 @@ enum class ShouldComputeRole {
     Yes,
 };
 
+enum class DOMTreeChange {
+    // Nodes were inserted or removed, or the data of a node changed.
+    Structure,
+    // An attribute of an element changed.
+    Attribute,
+};
+
 #define ENUMERATE_STYLE_INVALIDATION_REASONS(X)     \
     X(AdoptedStyleSheetsList)                       \
     X(CSSFontLoaded)                                \
@@ -125,6 +132,7 @@ enum class SetNeedsLayoutReason {
     X(NodeSetTextContent)                                 \
     X(None)                                               \
     X(SVGGraphicsElementTransformChange)                  \
+    X(ShadowRootSetInnerHTML)                             \
     X(StyleChange)
 
 enum class SetNeedsLayoutTreeUpdateReason {
@@ -361,6 +369,9 @@ public:
     void set_entire_subtree_needs_style_update(bool b) { m_entire_subtree_needs_style_update = b; }
 
     void invalidate_style(StyleInvalidationReason);
+
+    // Does what invalidating the style of each of the given newly inserted children of this node would.
+    void invalidate_style_for_inserted_children(ReadonlySpan<GC::Root<Node>>);
     struct StyleInvalidationOptions {
         bool invalidate_self { false };
         bool invalidate_elements_that_use_css_custom_properties { false };
@@ -370,6 +381,12 @@ public:
     void set_document(Badge<Document>, Document&);
     void set_document(Badge<NamedNodeMap>, Document&);
 
+    // These numbers change whenever anything in this node's inclusive subtree changes, and whenever its structure
+    // changes, respectively. Live collections use them to find out whether they have to look at their subtree again.
+    u64 subtree_version() const { return m_subtree_version; }
+    u64 subtree_structure_version() const { return m_subtree_structure_version; }
+    void did_change_inclusive_subtree(Badge<Document>, DOMTreeChange);
+
     virtual EventTarget* get_parent(Event const&) override;
 
     template<typename T>
@@ -483,6 +500,9 @@ protected:
 
     UniqueNodeID m_unique_id;
 
+    u64 m_subtree_version { 0 };
+    u64 m_subtree_structure_version { 0 };
+
     // https://dom.spec.whatwg.org/#registered-observer-list
     // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
     OwnPtr<Vector<GC::Ref<RegisteredObserver>>> m_registered_observer_list;
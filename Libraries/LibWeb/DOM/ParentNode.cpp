@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -47,12 +48,56 @@ enum class ReturnMatches {
     First,
     All,
 };
+
+// If a selector starts with a lone ID selector followed by a child or descendant combinator (or nothing at all), every
+// element it matches either has that ID or is a descendant of an element that does.
+static Optional<FlyString> leading_id_selector(CSS::Selector const& selector)
+{
+    auto const& compound_selectors = selector.compound_selectors();
+    auto const& simple_selectors = compound_selectors.first().simple_selectors;
+    if (simple_selectors.size() != 1 || simple_selectors.first().type != CSS::Selector::SimpleSelector::Type::Id)
+        return {};
+    if (compound_selectors.size() > 1) {
+        auto combinator = compound_selectors[1].combinator;
+        if (combinator != CSS::Selector::Combinator::ImmediateChild && combinator != CSS::Selector::Combinator::Descendant)
+            return {};
+    }
+    return simple_selectors.first().name();
+}
+
+// Returns the only element with the given ID in the tree of node, or null if there is none. Returns nothing if we can't
+// tell without looking at the whole tree, or if more than one element has the ID.
+static Optional<GC::Ptr<Element>> only_element_with_id_in_tree_of(ParentNode& node, FlyString const& id)
+{
+    // NOTE: Only documents and shadow roots that are connected keep track of their elements by ID.
+    if (!node.is_connected())
+        return {};
+    auto& root = node.root();
+    ElementByIdMap const* element_by_id = nullptr;
+    if (is<Document>(root))
+        element_by_id = &static_cast<Document&>(root).element_by_id();
+    else if (is<ShadowRoot>(root))
+        element_by_id = &static_cast<ShadowRoot&>(root).element_by_id();
+    else
+        return {};
+
+    GC::Ptr<Element> only_element;
+    size_t element_count = 0;
+    element_by_id->for_each_element_with_id(id, [&](Element& element) {
+        only_element = &element;
+        ++element_count;
+    });
+    if (element_count > 1)
+        return {};
+    return only_element;
+}
+
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_for_dom_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -67,8 +112,7 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+    auto match = [&](Element& element) {
         for (auto& selector : selectors) {
             SelectorEngine::MatchContext context;
             if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
@@ -81,12 +125,42 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
             }
         }
         return TraversalDecision::Continue;
-    });
-
-    if (return_matches == ReturnMatches::First)
-        return { single_result };
+    };
+    auto result = [&]() -> Variant<GC::Ptr<Element>, GC::Ref<NodeList>> {
+        if (return_matches == ReturnMatches::First)
+            return { single_result };
+        return { StaticNodeList::create(node.realm(), move(results)) };
+    };
+
+    // OPTIMIZATION: Selectors like "#id" and "#id .class" can only match the element with that ID or the elements inside
+    //               of it, so if there's just the one element with the ID, we can find it through the ID map and only
+    //               look inside of it.
+    if (selectors.size() == 1) {
+        auto const& selector = *selectors.first();
+        if (auto id = leading_id_selector(selector); id.has_value()) {
+            if (auto element_with_id = only_element_with_id_in_tree_of(node, *id); element_with_id.has_value()) {
+                if (!*element_with_id)
+                    return result();
+
+                auto& element = **element_with_id;
+                // NOTE: If the element is node or one of its ancestors, the selector can match anything in node's
+                //       subtree, so there's nothing to skip.
+                if (!element.is_inclusive_ancestor_of(node)) {
+                    if (node.is_ancestor_of(element)) {
+                        if (selector.compound_selectors().size() == 1)
+                            match(element);
+                        else
+                            element.for_each_in_subtree_of_type<Element>(match);
+                    }
+                    return result();
+                }
+            }
+        }
+    }
 
-    return { StaticNodeList::create(node.realm(), move(results)) };
+    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+    node.for_each_in_subtree_of_type<Element>(match);
+    return result();
 }
 
 // https://dom.spec.whatwg.org/#dom-parentnode-queryselector
@@ -138,7 +212,7 @@ GC::Ref<HTMLCollection> ParentNode::children()
     if (!m_children) {
         m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_children;
 }
@@ -151,7 +225,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     if (qualified_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
 
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
@@ -164,13 +238,13 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
 
             // - Whose namespace is not the HTML namespace and whose qualified name is qualifiedName.
             return element.qualified_name() == qualified_name;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
         return element.qualified_name() == qualified_name;
-    });
+    }, HTMLCollection::FilterDependsOnAttributes::No);
 }
 
 // https://dom.spec.whatwg.org/#concept-getelementsbytagnamens
@@ -185,27 +259,27 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name_ns(Optional<FlyStri
     if (namespace_ == "*" && local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
 
     // 3. Otherwise, if namespace is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose local name is localName.
     if (namespace_ == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [local_name](Element const& element) {
             return element.local_name() == local_name;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
 
     // 4. Otherwise, if localName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace.
     if (local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_](Element const& element) {
             return element.namespace_uri() == namespace_;
-        });
+        }, HTMLCollection::FilterDependsOnAttributes::No);
     }
 
     // 5. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace and local name is localName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_, local_name](Element const& element) {
         return element.namespace_uri() == namespace_ && element.local_name() == local_name;
-    });
+    }, HTMLCollection::FilterDependsOnAttributes::No);
 }
 
 // https://dom.spec.whatwg.org/#dom-parentnode-prepend
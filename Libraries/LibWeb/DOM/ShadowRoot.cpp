@@ -87,8 +87,8 @@ WebIDL::ExceptionOr<void> ShadowRoot::set_inner_html(StringView value)
         this->set_needs_style_update(true);
 
         if (this->is_connected()) {
-            // NOTE: Since the DOM has changed, we have to rebuild the layout tree.
-            this->document().invalidate_layout_tree(InvalidateLayoutTreeReason::ShadowRootSetInnerHTML);
+            // NOTE: Since the DOM has changed, we have to rebuild the layout tree of our host.
+            this->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::ShadowRootSetInnerHTML);
         }
     }
 
@@ -11,12 +11,12 @@
 #include <LibWeb/CSS/StyleValues/CSSKeywordValue.h>
 #include <LibWeb/CSS/StyleValues/DisplayStyleValue.h>
 #include <LibWeb/CSS/StyleValues/StyleValueList.h>
-#include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CharacterData.h>
 #include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/DOM/DocumentType.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Editing/CommandNames.h>
 #include <LibWeb/Editing/Commands.h>
@@ -2198,7 +2198,7 @@ bool is_modifiable_element(GC::Ref<DOM::Node> node)
     // possibly style;
     auto has_no_attributes_except = [&](auto exclusions) {
         auto attribute_count = 0;
-        html_element.for_each_attribute([&](DOM::Attr const& attribute) {
+        html_element.for_each_attribute([&](DOM::AttributeListEntry const& attribute) {
             if (!exclusions.contains_slow(attribute.local_name()))
                 ++attribute_count;
         });
@@ -2403,7 +2403,7 @@ bool is_simple_indentation_element(GC::Ref<DOM::Node> node)
 
     // that has no attributes except possibly
     bool has_only_valid_attributes = true;
-    element.for_each_attribute([&](DOM::Attr const& attribute) {
+    element.for_each_attribute([&](DOM::AttributeListEntry const& attribute) {
         // * a style attribute that sets no properties other than "margin", "border", "padding", or subproperties of
         //   those;
         if (attribute.local_name() == HTML::AttributeNames::style) {
@@ -39,10 +39,8 @@ void FetchedDataReceiver::set_pending_promise(GC::Ref<WebIDL::Promise> promise)
     auto had_pending_promise = m_pending_promise != nullptr;
     m_pending_promise = promise;
 
-    if (!had_pending_promise && !m_buffer.is_empty()) {
-        on_data_received(m_buffer);
-        m_buffer.clear();
-    }
+    if (!had_pending_promise && !m_buffer.is_empty())
+        pull_from_bytes(exchange(m_buffer, {}));
 }
 
 // This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
@@ -60,11 +58,16 @@ void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
         return;
     }
 
+    pull_from_bytes(MUST(ByteBuffer::copy(bytes)));
+}
+
+void FetchedDataReceiver::pull_from_bytes(ByteBuffer bytes)
+{
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination(),
-        GC::create_function(heap(), [this, bytes = MUST(ByteBuffer::copy(bytes))]() mutable {
+        GC::create_function(heap(), [this, bytes = move(bytes)]() mutable {
             HTML::TemporaryExecutionContext execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
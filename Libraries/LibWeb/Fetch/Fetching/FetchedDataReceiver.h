@@ -28,6 +28,8 @@ private:
 
     virtual void visit_edges(Visitor& visitor) override;
 
+    void pull_from_bytes(ByteBuffer);
+
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ref<Streams::ReadableStream> m_stream;
     GC::Ptr<WebIDL::Promise> m_pending_promise;
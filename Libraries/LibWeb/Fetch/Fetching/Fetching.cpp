@@ -10,6 +10,8 @@
 
 #include <AK/Base64.h>
 #include <AK/Debug.h>
+#include <AK/IntrusiveList.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibRequests/RequestTimingInfo.h>
@@ -1389,10 +1391,110 @@ WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> http_redirect_fetch(JS::Realm& rea
     return main_fetch(realm, fetch_params, recursive);
 }
 
+class CachePartition;
+
+struct CachedResponse {
+    AK_MAKE_NONCOPYABLE(CachedResponse);
+    AK_MAKE_NONMOVABLE(CachedResponse);
+
+public:
+    CachedResponse(CachePartition& partition, URL::URL url, GC::Ref<Infrastructure::Response> response, size_t size_in_bytes)
+        : partition(partition)
+        , url(move(url))
+        , response(response)
+        , size_in_bytes(size_in_bytes)
+    {
+    }
+
+    CachePartition& partition;
+    URL::URL url;
+    GC::Root<Infrastructure::Response> response;
+    size_t size_in_bytes { 0 };
+
+    // Both lists are ordered from least to most recently used.
+    IntrusiveListNode<CachedResponse> partition_list_node;
+    IntrusiveListNode<CachedResponse> cache_list_node;
+
+    using PartitionList = IntrusiveList<&CachedResponse::partition_list_node>;
+    using CacheList = IntrusiveList<&CachedResponse::cache_list_node>;
+};
+
+// NOTE: Stored responses stay alive for as long as they are in the cache, so the cache keeps track of how many bytes
+//       they hold and evicts the least recently used ones once it goes over its size limit. A single partition may
+//       only use up part of that limit, so that one site can't push out everything another site has stored.
+class HTTPCache {
+public:
+    static constexpr size_t default_size_limit = 64 * MiB;
+
+    static HTTPCache& the()
+    {
+        static HTTPCache s_cache;
+        return s_cache;
+    }
+
+    CachePartition& get(Infrastructure::NetworkPartitionKey const& key);
+
+    size_t size_limit() const { return m_size_limit; }
+    size_t partition_size_limit() const { return m_size_limit / 2; }
+    size_t max_response_size() const { return m_size_limit / 8; }
+
+    void set_size_limit(size_t size_limit)
+    {
+        m_size_limit = size_limit;
+        shrink_to(m_size_limit);
+    }
+
+    void shrink_to(size_t target_size);
+
+    void did_store(CachedResponse& cached_response)
+    {
+        m_lru_list.append(cached_response);
+        m_resident_bytes += cached_response.size_in_bytes;
+        shrink_to(m_size_limit);
+    }
+
+    void did_use(CachedResponse& cached_response)
+    {
+        m_lru_list.append(cached_response);
+    }
+
+    void did_remove(CachedResponse& cached_response)
+    {
+        m_lru_list.remove(cached_response);
+        m_resident_bytes -= cached_response.size_in_bytes;
+    }
+
+    void did_evict() { ++m_eviction_count; }
+    void did_hit() { ++m_hit_count; }
+    void did_miss() { ++m_miss_count; }
+
+    HTTPCacheStatistics statistics() const;
+
+private:
+    // NOTE: The partitions remove their responses from this list when they are destroyed, so it has to outlive them.
+    CachedResponse::CacheList m_lru_list;
+    HashMap<Infrastructure::NetworkPartitionKey, NonnullRefPtr<CachePartition>> m_cache;
+
+    size_t m_size_limit { default_size_limit };
+    size_t m_resident_bytes { 0 };
+    u64 m_hit_count { 0 };
+    u64 m_miss_count { 0 };
+    u64 m_eviction_count { 0 };
+};
+
 class CachePartition : public RefCounted<CachePartition> {
 public:
+    ~CachePartition()
+    {
+        while (!m_lru_list.is_empty())
+            remove(*m_lru_list.first());
+    }
+
+    size_t resident_bytes() const { return m_resident_bytes; }
+    size_t entry_count() const { return m_cache.size(); }
+
     // https://httpwg.org/specs/rfc9111.html#constructing.responses.from.caches
-    GC::Ptr<Infrastructure::Response> select_response(JS::Realm& realm, URL::URL const& url, ReadonlyBytes method, Vector<Infrastructure::Header> const& headers, Vector<GC::Ptr<Infrastructure::Response>>& initial_set_of_stored_responses) const
+    GC::Ptr<Infrastructure::Response> select_response(JS::Realm& realm, URL::URL const& url, ReadonlyBytes method, Vector<Infrastructure::Header> const& headers, Vector<GC::Ptr<Infrastructure::Response>>& initial_set_of_stored_responses)
     {
         // When presented with a request, a cache MUST NOT reuse a stored response unless:
 
@@ -1400,13 +1502,16 @@ public:
         auto it = m_cache.find(url);
         if (it == m_cache.end()) {
             dbgln("\033[31;1mHTTP CACHE MISS!\033[0m {}", url);
+            HTTPCache::the().did_miss();
             return {};
         }
-        auto const& cached_response = it->value;
+        auto& cached_entry = *it->value;
+        auto const& cached_response = cached_entry.response;
 
         // - the request method associated with the stored response allows it to be used for the presented request, and
         if (method != cached_response->method()) {
             dbgln("\033[31;1mHTTP CACHE MISS!\033[0m (Bad method) {}", url);
+            HTTPCache::the().did_miss();
             return {};
         }
 
@@ -1423,14 +1528,18 @@ public:
         //          + successfully validated (see Section 4.3).
 
         dbgln("\033[32;1mHTTP CACHE HIT!\033[0m {}", url);
+        HTTPCache::the().did_hit();
+
+        m_lru_list.append(cached_entry);
+        HTTPCache::the().did_use(cached_entry);
 
         return cached_response->clone(realm);
     }
 
-    void store_response(JS::Realm& realm, Infrastructure::Request const& http_request, Infrastructure::Response const& response)
+    bool store_response(JS::Realm& realm, Infrastructure::Request const& http_request, Infrastructure::Response const& response)
     {
         if (!is_cacheable(http_request, response))
-            return;
+            return false;
 
         auto cached_response = Infrastructure::Response::create(realm.vm());
 
@@ -1440,7 +1549,65 @@ public:
         cached_response->set_method(MUST(ByteBuffer::copy(http_request.method())));
         cached_response->set_status(response.status());
         cached_response->url_list().append(http_request.current_url());
-        m_cache.set(http_request.current_url(), move(cached_response));
+
+        if (auto it = m_cache.find(http_request.current_url()); it != m_cache.end())
+            remove(*it->value);
+
+        // NOTE: A response this large would push out many others, so we don't store it at all.
+        auto& cache = HTTPCache::the();
+        auto size_in_bytes = estimated_size_in_bytes(*cached_response);
+        if (size_in_bytes > cache.max_response_size())
+            return false;
+
+        auto entry = make<CachedResponse>(*this, http_request.current_url(), *cached_response, size_in_bytes);
+        auto& entry_ref = *entry;
+        m_cache.set(http_request.current_url(), move(entry));
+
+        m_lru_list.append(entry_ref);
+        m_resident_bytes += size_in_bytes;
+
+        while (m_resident_bytes > cache.partition_size_limit() && m_lru_list.first() != &entry_ref) {
+            remove(*m_lru_list.first());
+            cache.did_evict();
+        }
+
+        cache.did_store(entry_ref);
+        return true;
+    }
+
+    // NOTE: Fetches whose response may be stored here are tracked while they are in flight, so that identical fetches
+    //       can wait for that response instead of requesting it again.
+    using InFlightFetchWaiter = GC::Function<void(bool did_store_response)>;
+
+    bool has_fetch_in_flight(URL::URL const& url) const { return m_in_flight_fetches.contains(url); }
+
+    void did_start_fetch(URL::URL const& url)
+    {
+        m_in_flight_fetches.ensure(url);
+    }
+
+    void wait_for_fetch_in_flight(URL::URL const& url, GC::Ref<InFlightFetchWaiter> waiter)
+    {
+        m_in_flight_fetches.get(url)->append(waiter);
+    }
+
+    void did_finish_fetch(URL::URL const& url, bool did_store_response)
+    {
+        auto waiters = m_in_flight_fetches.take(url);
+        if (!waiters.has_value())
+            return;
+        for (auto const& waiter : *waiters)
+            waiter->function()(did_store_response);
+    }
+
+    void remove(CachedResponse& cached_response)
+    {
+        m_lru_list.remove(cached_response);
+        m_resident_bytes -= cached_response.size_in_bytes;
+        HTTPCache::the().did_remove(cached_response);
+
+        auto url = cached_response.url;
+        m_cache.remove(url);
     }
 
     // https://httpwg.org/specs/rfc9111.html#freshening.responses
@@ -1476,6 +1643,16 @@ public:
     }
 
 private:
+    static size_t estimated_size_in_bytes(Infrastructure::Response const& response)
+    {
+        size_t size = sizeof(Infrastructure::Response);
+        for (auto const& header : *response.header_list())
+            size += header.name.size() + header.value.size();
+        if (auto body = response.body(); body && body->source().has<ByteBuffer>())
+            size += body->source().get<ByteBuffer>().size();
+        return size;
+    }
+
     // https://httpwg.org/specs/rfc9111.html#storing.fields
     bool is_exempted_for_storage(StringView header_name)
     {
@@ -1625,27 +1802,116 @@ private:
         return true;
     }
 
-    HashMap<URL::URL, GC::Root<Infrastructure::Response>> m_cache;
+    HashMap<URL::URL, NonnullOwnPtr<CachedResponse>> m_cache;
+    CachedResponse::PartitionList m_lru_list;
+    size_t m_resident_bytes { 0 };
+    HashMap<URL::URL, Vector<GC::Root<InFlightFetchWaiter>>> m_in_flight_fetches;
 };
 
-class HTTPCache {
-public:
-    CachePartition& get(Infrastructure::NetworkPartitionKey const& key)
-    {
-        return *m_cache.ensure(key, [] {
-            return adopt_ref(*new CachePartition);
+CachePartition& HTTPCache::get(Infrastructure::NetworkPartitionKey const& key)
+{
+    return *m_cache.ensure(key, [] {
+        return adopt_ref(*new CachePartition);
+    });
+}
+
+void HTTPCache::shrink_to(size_t target_size)
+{
+    while (m_resident_bytes > target_size && !m_lru_list.is_empty()) {
+        m_lru_list.first()->partition.remove(*m_lru_list.first());
+        ++m_eviction_count;
+    }
+}
+
+HTTPCacheStatistics HTTPCache::statistics() const
+{
+    HTTPCacheStatistics statistics {
+        .hit_count = m_hit_count,
+        .miss_count = m_miss_count,
+        .eviction_count = m_eviction_count,
+        .resident_bytes = m_resident_bytes,
+        .size_limit = m_size_limit,
+    };
+
+    for (auto const& [key, partition] : m_cache) {
+        statistics.entry_count += partition->entry_count();
+        statistics.partitions.append({
+            .top_level_origin = key.top_level_origin.serialize(),
+            .entry_count = partition->entry_count(),
+            .resident_bytes = partition->resident_bytes(),
         });
     }
 
-    static HTTPCache& the()
-    {
-        static HTTPCache s_cache;
-        return s_cache;
+    quick_sort(statistics.partitions, [](auto const& a, auto const& b) { return a.resident_bytes > b.resident_bytes; });
+    return statistics;
+}
+
+HTTPCacheStatistics http_cache_statistics()
+{
+    return HTTPCache::the().statistics();
+}
+
+void set_http_cache_size_limit(size_t size_limit)
+{
+    HTTPCache::the().set_size_limit(size_limit);
+}
+
+void shrink_http_cache(size_t target_size)
+{
+    HTTPCache::the().shrink_to(target_size);
+}
+
+// AD-HOC: Let RequestServer know how urgently we need the response, so that resources which block rendering don't have
+//         to compete with those that are only needed later.
+static RequestServer::RequestPriority request_server_priority(Infrastructure::Request const& request)
+{
+    using Destination = Infrastructure::Request::Destination;
+    using RequestPriority = RequestServer::RequestPriority;
+
+    auto priority = [&] {
+        if (request.render_blocking() || request.mode() == Infrastructure::Request::Mode::Navigate)
+            return RequestPriority::Highest;
+        if (!request.destination().has_value())
+            return RequestPriority::Medium;
+
+        switch (*request.destination()) {
+        case Destination::Document:
+        case Destination::Frame:
+        case Destination::IFrame:
+        case Destination::Style:
+            return RequestPriority::Highest;
+        case Destination::Font:
+        case Destination::Script:
+            return RequestPriority::High;
+        case Destination::Audio:
+        case Destination::Image:
+        case Destination::Track:
+        case Destination::Video:
+            return RequestPriority::Low;
+        case Destination::Report:
+            return RequestPriority::Lowest;
+        default:
+            return RequestPriority::Medium;
+        }
+    }();
+
+    // https://fetch.spec.whatwg.org/#request-priority
+    // NOTE: The priority hint (e.g. from fetchpriority) nudges the priority we derived from the destination.
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        if (priority != RequestPriority::Highest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) + 1);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        if (priority != RequestPriority::Lowest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) - 1);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
     }
 
-private:
-    HashMap<Infrastructure::NetworkPartitionKey, NonnullRefPtr<CachePartition>> m_cache;
-};
+    return priority;
+}
 
 // https://fetch.spec.whatwg.org/#determine-the-http-cache-partition
 static RefPtr<CachePartition> determine_the_http_cache_partition(Infrastructure::Request const& request)
@@ -2048,6 +2314,8 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
         return PendingResponse::create(vm, request, Infrastructure::Response::appropriate_network_error(vm, fetch_params));
 
     GC::Ptr<PendingResponse> pending_forward_response;
+    bool is_shared_fetch_in_flight = false;
+    auto is_response_from_fetch_in_flight = RefCountedFlag::create(false);
 
     // 10. If response is null, then:
     if (!response) {
@@ -2057,14 +2325,54 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
 
         // 2. Let forwardResponse be the result of running HTTP-network fetch given httpFetchParams, includeCredentials,
         //    and isNewConnectionFetch.
-        pending_forward_response = TRY(nonstandard_resource_loader_file_or_http_network_fetch(realm, *http_fetch_params, include_credentials, is_new_connection_fetch));
+        // OPTIMIZATION: If the same response is already being fetched into httpCache (e.g. an image used by several
+        //               elements), wait for it to be stored there instead of requesting it a second time. The stored
+        //               response's body is a clone of the one that is still being received, so it streams to every
+        //               waiter. If nothing could be stored after all, each waiter goes to the network by itself.
+        auto may_share_fetch_in_flight = http_cache
+            && !stored_response
+            && http_request->cache_mode() == Infrastructure::Request::CacheMode::Default
+            && StringView { http_request->method() } == "GET"sv
+            && !http_request->header_list()->contains("Range"sv.bytes());
+
+        if (may_share_fetch_in_flight && http_cache->has_fetch_in_flight(http_request->current_url())) {
+            auto waiting_pending_response = PendingResponse::create(vm, request);
+            pending_forward_response = waiting_pending_response;
+
+            http_cache->wait_for_fetch_in_flight(http_request->current_url(), GC::create_function(realm.heap(), [&realm, &vm, http_cache, http_fetch_params, http_request, include_credentials, is_new_connection_fetch, waiting_pending_response, is_response_from_fetch_in_flight](bool did_store_response) {
+                if (did_store_response) {
+                    GC::RootVector<GC::Ptr<Infrastructure::Response>> unused_stored_responses(realm.heap());
+                    if (auto stored_response = http_cache->select_response(realm, http_request->current_url(), http_request->method(), *http_request->header_list(), unused_stored_responses)) {
+                        stored_response->set_cache_state(Infrastructure::Response::CacheState::Local);
+                        is_response_from_fetch_in_flight->set_value(true);
+                        waiting_pending_response->resolve(*stored_response);
+                        return;
+                    }
+                }
+
+                auto forward_response = nonstandard_resource_loader_file_or_http_network_fetch(realm, *http_fetch_params, include_credentials, is_new_connection_fetch);
+                if (forward_response.is_error()) {
+                    waiting_pending_response->resolve(Infrastructure::Response::network_error(vm, "Failed to start HTTP-network fetch"_string));
+                    return;
+                }
+                forward_response.value()->when_loaded([waiting_pending_response](GC::Ref<Infrastructure::Response> response) {
+                    waiting_pending_response->resolve(response);
+                });
+            }));
+        } else {
+            pending_forward_response = TRY(nonstandard_resource_loader_file_or_http_network_fetch(realm, *http_fetch_params, include_credentials, is_new_connection_fetch));
+            if (may_share_fetch_in_flight) {
+                http_cache->did_start_fetch(http_request->current_url());
+                is_shared_fetch_in_flight = true;
+            }
+        }
     } else {
         pending_forward_response = PendingResponse::create(vm, request, Infrastructure::Response::create(vm));
     }
 
     auto returned_pending_response = PendingResponse::create(vm, request);
 
-    pending_forward_response->when_loaded([&realm, &vm, &fetch_params, request, response, stored_response, initial_set_of_stored_responses, http_request, returned_pending_response, is_authentication_fetch, is_new_connection_fetch, revalidating_flag, include_credentials, response_was_null = !response, http_cache](GC::Ref<Infrastructure::Response> resolved_forward_response) mutable {
+    pending_forward_response->when_loaded([&realm, &vm, &fetch_params, request, response, stored_response, initial_set_of_stored_responses, http_request, returned_pending_response, is_authentication_fetch, is_new_connection_fetch, revalidating_flag, include_credentials, response_was_null = !response, http_cache, is_shared_fetch_in_flight, is_response_from_fetch_in_flight](GC::Ref<Infrastructure::Response> resolved_forward_response) mutable {
         dbgln_if(WEB_FETCH_DEBUG, "Fetch: Running 'HTTP-network-or-cache fetch' pending_forward_response load callback");
         if (response_was_null) {
             auto forward_response = resolved_forward_response;
@@ -2105,8 +2413,13 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
                 // NOTE: If forwardResponse is a network error, this effectively caches the network error, which is
                 //       sometimes known as "negative caching".
                 // NOTE: The associated body info is stored in the cache alongside the response.
-                if (http_cache)
-                    http_cache->store_response(realm, *http_request, *forward_response);
+                // NOTE: A response we got from another fetch in flight is already stored.
+                auto did_store_response = false;
+                if (http_cache && !is_response_from_fetch_in_flight->value())
+                    did_store_response = http_cache->store_response(realm, *http_request, *forward_response);
+
+                if (is_shared_fetch_in_flight)
+                    http_cache->did_finish_fetch(http_request->current_url(), did_store_response);
             }
         }
 
@@ -2296,6 +2609,15 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
 
+    // NOTE: RequestServer's disk cache is partitioned like the HTTP cache. Requests without a partition, or that must
+    //       not be stored, bypass it entirely.
+    if (request->cache_mode() != Infrastructure::Request::CacheMode::NoStore) {
+        if (auto key = Infrastructure::determine_the_network_partition_key(*request); key.has_value() && !key->top_level_origin.is_opaque())
+            load_request.set_cache_partition(key->top_level_origin.serialize().to_byte_string());
+    }
+
+    load_request.set_priority(request_server_priority(*request));
+
     if (auto const* body = request->body().get_pointer<GC::Ref<Infrastructure::Body>>()) {
         TRY((*body)->source().visit(
             [&](ByteBuffer const& byte_buffer) -> WebIDL::ExceptionOr<void> {
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Forward.h>
@@ -53,4 +55,27 @@ void set_sec_fetch_site_header(Infrastructure::Request&);
 void set_sec_fetch_user_header(Infrastructure::Request&);
 void append_fetch_metadata_headers_for_request(Infrastructure::Request&);
 
+struct HTTPCacheStatistics {
+    struct Partition {
+        String top_level_origin;
+        size_t entry_count { 0 };
+        size_t resident_bytes { 0 };
+    };
+
+    u64 hit_count { 0 };
+    u64 miss_count { 0 };
+    u64 eviction_count { 0 };
+    size_t resident_bytes { 0 };
+    size_t size_limit { 0 };
+    size_t entry_count { 0 };
+    Vector<Partition> partitions;
+};
+
+HTTPCacheStatistics http_cache_statistics();
+void set_http_cache_size_limit(size_t);
+
+// Evicts the least recently used responses from the HTTP cache until at most target_size bytes remain, e.g. when
+// the system is running low on memory.
+void shrink_http_cache(size_t target_size = 0);
+
 }
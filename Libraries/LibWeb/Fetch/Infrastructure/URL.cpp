@@ -9,7 +9,6 @@
 #include <AK/Base64.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Fetch/Infrastructure/URL.h>
-#include <LibWeb/Infra/Strings.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 
 namespace Web::Fetch::Infrastructure {
@@ -76,7 +75,10 @@ ErrorOr<DataURL> process_data_url(URL::URL const& data_url)
         trimmed_substring_view = trimmed_substring_view.trim(" "sv, TrimMode::Right);
         if (trimmed_substring_view.ends_with(';')) {
             // 1. Let stringBody be the isomorphic decode of body.
-            auto string_body = Infra::isomorphic_decode(body);
+            // OPTIMIZATION: Isomorphic decoding leaves ASCII bytes alone, and any other byte would decode to a code point
+            //               that isn't valid in base64 either way. So instead of making a copy of what may be a very large
+            //               body, we decode the body's bytes directly.
+            auto string_body = StringView { body };
 
             // 2. Set body to the forgiving-base64 decode of stringBody.
             // 3. If body is failure, then return failure.
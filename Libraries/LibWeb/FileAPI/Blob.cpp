@@ -86,6 +86,17 @@ ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optio
     // 1. Let bytes be an empty sequence of bytes.
     ByteBuffer bytes {};
 
+    // OPTIMIZATION: Most parts end up in bytes exactly as they are, so the space for all of them is allocated up front,
+    //               rather than growing bytes again and again while appending them.
+    size_t expected_size = 0;
+    for (auto const& blob_part : blob_parts) {
+        expected_size += blob_part.visit(
+            [](String const& string) { return string.bytes().size(); },
+            [](GC::Root<WebIDL::BufferSource> const& buffer_source) { return WebIDL::get_buffer_source_bytes(*buffer_source->raw_object()).size(); },
+            [](GC::Root<Blob> const& blob) { return blob->raw_bytes().size(); });
+    }
+    TRY(bytes.try_ensure_capacity(expected_size));
+
     // 2. For each element in parts:
     for (auto const& blob_part : blob_parts) {
         TRY(blob_part.visit(
@@ -103,9 +114,10 @@ ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optio
                 return bytes.try_append(s.bytes());
             },
             // 2. If element is a BufferSource, get a copy of the bytes held by the buffer source, and append those bytes to bytes.
+            // OPTIMIZATION: Appending the bytes to bytes copies them already, so they're not copied into a buffer of their
+            //               own first.
             [&](GC::Root<WebIDL::BufferSource> const& buffer_source) -> ErrorOr<void> {
-                auto data_buffer = TRY(WebIDL::get_buffer_source_copy(*buffer_source->raw_object()));
-                return bytes.try_append(data_buffer.bytes());
+                return bytes.try_append(WebIDL::get_buffer_source_bytes(*buffer_source->raw_object()));
             },
             // 3. If element is a Blob, append the bytes it represents to bytes.
             [&](GC::Root<Blob> const& blob) -> ErrorOr<void> {
@@ -126,21 +138,35 @@ bool is_basic_latin(StringView view)
 }
 
 Blob::Blob(JS::Realm& realm)
-    : PlatformObject(realm)
+    : Blob(realm, ByteBuffer {})
 {
 }
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_shared_bytes(BlobBytes::create(move(byte_buffer)))
+    , m_bytes(m_shared_bytes->bytes())
     , m_type(move(type))
 {
 }
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer)
+    : Blob(realm, move(byte_buffer), String {})
+{
+}
+
+Blob::Blob(JS::Realm& realm, NonnullRefPtr<BlobBytes const> shared_bytes, ReadonlyBytes bytes, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_shared_bytes(move(shared_bytes))
+    , m_bytes(bytes)
+    , m_type(move(type))
+{
+}
+
+void Blob::set_bytes(ByteBuffer byte_buffer)
 {
+    m_shared_bytes = BlobBytes::create(move(byte_buffer));
+    m_bytes = m_shared_bytes->bytes();
 }
 
 Blob::~Blob() = default;
@@ -160,7 +186,7 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::TransferDataEncoder& s
     serialized.encode(m_type);
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    serialized.encode(m_byte_buffer);
+    serialized.encode_buffer(m_bytes);
 
     return {};
 }
@@ -176,7 +202,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(HTML::TransferDataDecoder&
     m_type = serialized.decode<String>();
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(serialized.decode_buffer(realm));
+    set_bytes(TRY(serialized.decode_buffer(realm)));
 
     return {};
 }
@@ -188,12 +214,6 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     if (!blob_parts.has_value() && !options.has_value())
         return realm.create<Blob>(realm);
 
-    ByteBuffer byte_buffer {};
-    // 2. Let bytes be the result of processing blob parts given blobParts and options.
-    if (blob_parts.has_value()) {
-        byte_buffer = MUST(process_blob_parts(blob_parts.value(), options));
-    }
-
     auto type = String {};
     // 3. If the type member of the options argument is not the empty string, run the following sub-steps:
     if (options.has_value() && !options->type.is_empty()) {
@@ -210,6 +230,20 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
         }
     }
 
+    // 2. Let bytes be the result of processing blob parts given blobParts and options.
+    // OPTIMIZATION: When the only part is another blob, bytes is that blob's byte sequence exactly, so we can refer to it
+    //               rather than copying it. Processing the parts is done after the type, which doesn't depend on it, for
+    //               this reason.
+    if (blob_parts.has_value() && blob_parts->size() == 1 && blob_parts->first().has<GC::Root<Blob>>()) {
+        auto const& blob = *blob_parts->first().get<GC::Root<Blob>>();
+        return realm.create<Blob>(realm, blob.m_shared_bytes, blob.m_bytes, move(type));
+    }
+
+    ByteBuffer byte_buffer {};
+    if (blob_parts.has_value()) {
+        byte_buffer = MUST(process_blob_parts(blob_parts.value(), options));
+    }
+
     // 4. Return a Blob object referring to bytes as its associated byte sequence, with its size set to the length of bytes, and its type set to the value of t from the substeps above.
     return realm.create<Blob>(realm, move(byte_buffer), move(type));
 }
@@ -233,8 +267,6 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice(Optional<i64> start, Optional<i64
 // https://w3c.github.io/FileAPI/#slice-blob
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optional<i64> end, Optional<String> const& content_type)
 {
-    auto& vm = realm().vm();
-
     // 1. Let originalSize be blob’s size.
     auto original_size = size();
 
@@ -302,8 +334,8 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optiona
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY_OR_THROW_OOM(vm, m_byte_buffer.slice(relative_start, span));
-    return realm().create<Blob>(realm(), move(byte_buffer), move(relative_content_type));
+    // OPTIMIZATION: S refers to the very same byte sequence, so it's shared rather than copied.
+    return realm().create<Blob>(realm(), m_shared_bytes, m_bytes.slice(relative_start, span), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -330,16 +362,17 @@ GC::Ref<Streams::ReadableStream> Blob::get_stream()
         //    NOTE: for simplicity the chunk is the entire buffer for now.
         {
             // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
+            // NOTE: The byte sequence can't change, so it's only copied once it's put into the chunk below.
+            auto bytes = m_bytes;
 
             // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, bytes = move(bytes)]() {
+            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, shared_bytes = m_shared_bytes, bytes]() {
                 auto& realm = stream->realm();
                 HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
                 // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
                 // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(realm, bytes);
+                auto array_buffer = JS::ArrayBuffer::create(realm, MUST(ByteBuffer::copy(bytes)));
                 auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
 
                 // 3. Enqueue chunk in stream.
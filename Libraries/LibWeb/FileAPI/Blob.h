@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibWeb/Bindings/BlobPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -27,6 +29,23 @@ struct BlobPropertyBag {
 [[nodiscard]] ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options = {});
 [[nodiscard]] bool is_basic_latin(StringView view);
 
+// NOTE: The byte sequence a blob refers to never changes, so it's shared by every blob that refers to all or part of it,
+//       such as slices of the blob, instead of each of them holding a copy.
+class BlobBytes final : public RefCounted<BlobBytes> {
+public:
+    static NonnullRefPtr<BlobBytes> create(ByteBuffer bytes) { return adopt_ref(*new BlobBytes(move(bytes))); }
+
+    ReadonlyBytes bytes() const { return m_bytes.bytes(); }
+
+private:
+    explicit BlobBytes(ByteBuffer bytes)
+        : m_bytes(move(bytes))
+    {
+    }
+
+    ByteBuffer const m_bytes;
+};
+
 class Blob
     : public Bindings::PlatformObject
     , public Bindings::Serializable {
@@ -41,7 +60,7 @@ public:
     static WebIDL::ExceptionOr<GC::Ref<Blob>> construct_impl(JS::Realm&, Optional<Vector<BlobPart>> const& blob_parts = {}, Optional<BlobPropertyBag> const& options = {});
 
     // https://w3c.github.io/FileAPI/#dfn-size
-    u64 size() const { return m_byte_buffer.size(); }
+    u64 size() const { return m_bytes.size(); }
     // https://w3c.github.io/FileAPI/#dfn-type
     String const& type() const { return m_type; }
 
@@ -52,7 +71,7 @@ public:
     GC::Ref<WebIDL::Promise> array_buffer();
     GC::Ref<WebIDL::Promise> bytes();
 
-    ReadonlyBytes raw_bytes() const { return m_byte_buffer.bytes(); }
+    ReadonlyBytes raw_bytes() const { return m_bytes; }
 
     GC::Ref<Streams::ReadableStream> get_stream();
 
@@ -64,12 +83,17 @@ public:
 protected:
     Blob(JS::Realm&, ByteBuffer, String type);
     Blob(JS::Realm&, ByteBuffer);
+    Blob(JS::Realm&, NonnullRefPtr<BlobBytes const>, ReadonlyBytes, String type);
 
     virtual void initialize(JS::Realm&) override;
 
     WebIDL::ExceptionOr<GC::Ref<Blob>> slice_blob(Optional<i64> start = {}, Optional<i64> end = {}, Optional<String> const& content_type = {});
 
-    ByteBuffer m_byte_buffer {};
+    void set_bytes(ByteBuffer);
+
+    // The bytes this blob refers to, which are all or part of m_shared_bytes.
+    NonnullRefPtr<BlobBytes const> m_shared_bytes;
+    ReadonlyBytes m_bytes;
     String m_type {};
 
 private:
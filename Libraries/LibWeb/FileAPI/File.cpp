@@ -97,7 +97,7 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::TransferDataEncoder& s
     serialized.encode(m_type);
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    serialized.encode(m_byte_buffer);
+    serialized.encode_buffer(m_bytes);
 
     // 3. Set serialized.[[Name]] to the value of value’s name attribute.
     serialized.encode(m_name);
@@ -119,7 +119,7 @@ WebIDL::ExceptionOr<void> File::deserialization_steps(HTML::TransferDataDecoder&
     m_type = serialized.decode<String>();
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(serialized.decode_buffer(realm));
+    set_bytes(TRY(serialized.decode_buffer(realm)));
 
     // 3. Initialize the value of value’s name attribute to serialized.[[Name]].
     m_name = serialized.decode<String>();
@@ -372,6 +372,7 @@ class AbstractElement;
 class AbstractRange;
 class AccessibilityTreeNode;
 class Attr;
+class AttributeListEntry;
 class CDATASection;
 class CharacterData;
 class Comment;
@@ -556,6 +557,7 @@ class EventLoop;
 class EventSource;
 class FormAssociatedElement;
 class FormDataEvent;
+class FrameTimeline;
 class History;
 class HTMLAllCollection;
 class HTMLAnchorElement;
@@ -664,6 +666,9 @@ class PluginArray;
 class PopoverInvokerElement;
 class PromiseRejectionEvent;
 class RadioNodeList;
+class Scheduler;
+class SchedulingState;
+class Script;
 class SelectedFile;
 class SessionHistoryEntry;
 class SharedResourceRequest;
@@ -709,6 +714,7 @@ struct DeserializedTransferRecord;
 struct EmbedderPolicy;
 struct Environment;
 struct EnvironmentSettingsObject;
+struct FrameTimings;
 struct NavigationParams;
 struct OpenerPolicy;
 struct OpenerPolicyEnforcementResult;
@@ -805,6 +811,13 @@ struct LayoutState;
 
 }
 
+namespace Web::LongTasks {
+
+class PerformanceLongTaskTiming;
+class TaskAttributionTiming;
+
+}
+
 namespace Web::MathML {
 
 class MathMLElement;
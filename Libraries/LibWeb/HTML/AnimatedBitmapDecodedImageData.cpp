@@ -4,31 +4,195 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/WeakPtr.h>
+#include <AK/Weakable.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(AnimatedBitmapDecodedImageData);
 
+static size_t size_in_bytes(Gfx::ImmutableBitmap const& bitmap)
+{
+    return static_cast<size_t>(bitmap.width()) * bitmap.height() * sizeof(u32);
+}
+
+// Keeps the frames of a streamed animation from the one that is being shown up to a few frames ahead of it, and asks
+// ImageDecoder for whichever of those are missing. Where the animation is shown is taken from which frame is asked for.
+class AnimatedBitmapDecodedImageData::StreamedFrames
+    : public RefCounted<StreamedFrames>
+    , public Weakable<StreamedFrames> {
+public:
+    static constexpr size_t frames_kept_ahead = 8;
+
+    StreamedFrames(i64 animation_id, size_t frame_count, Gfx::ColorSpace color_space, Vector<Frame> const& initial_frames)
+        : m_animation_id(animation_id)
+        , m_color_space(move(color_space))
+    {
+        m_frames.resize(frame_count);
+        for (size_t i = 0; i < min(initial_frames.size(), frame_count); ++i) {
+            m_frames[i].bitmap = initial_frames[i].bitmap;
+            m_frames[i].duration = initial_frames[i].duration;
+        }
+    }
+
+    ~StreamedFrames()
+    {
+        Platform::ImageCodecPlugin::the().release_animation(m_animation_id);
+    }
+
+    size_t frame_count() const { return m_frames.size(); }
+
+    RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index)
+    {
+        if (frame_index >= m_frames.size())
+            return nullptr;
+        set_playhead(frame_index);
+
+        // NOTE: If a frame isn't here in time, we keep showing the last one we had rather than nothing at all.
+        if (auto bitmap = m_frames[frame_index].bitmap)
+            m_last_shown_bitmap = move(bitmap);
+        return m_last_shown_bitmap;
+    }
+
+    int frame_duration(size_t frame_index)
+    {
+        if (frame_index >= m_frames.size())
+            return 0;
+        set_playhead(frame_index);
+
+        if (auto duration = m_frames[frame_index].duration; duration.has_value())
+            m_last_known_duration = *duration;
+        return m_last_known_duration;
+    }
+
+private:
+    struct StreamedFrame {
+        RefPtr<Gfx::ImmutableBitmap> bitmap;
+        // NOTE: Durations take up next to nothing, so those are kept once known.
+        Optional<int> duration;
+    };
+
+    bool is_kept(size_t frame_index) const
+    {
+        auto frames_ahead = (frame_index + m_frames.size() - m_playhead) % m_frames.size();
+        return frames_ahead <= frames_kept_ahead;
+    }
+
+    void set_playhead(size_t frame_index)
+    {
+        if (m_playhead == frame_index && m_did_set_playhead)
+            return;
+        m_playhead = frame_index;
+        m_did_set_playhead = true;
+
+        for (size_t i = 0; i < m_frames.size(); ++i) {
+            if (!is_kept(i))
+                m_frames[i].bitmap = nullptr;
+        }
+
+        request_missing_frames();
+    }
+
+    void request_missing_frames()
+    {
+        if (m_has_pending_request)
+            return;
+
+        auto kept_frame_count = min(frames_kept_ahead + 1, m_frames.size());
+        for (size_t offset = 0; offset < kept_frame_count; ++offset) {
+            auto first_frame_index = (m_playhead + offset) % m_frames.size();
+            if (m_frames[first_frame_index].bitmap)
+                continue;
+
+            // NOTE: ImageDecoder decodes a range of frames, so we stop at the end of the animation rather than wrapping
+            //       around. Whatever is missing from its start is requested once these have arrived.
+            auto frame_count = min(kept_frame_count - offset, m_frames.size() - first_frame_index);
+            m_has_pending_request = true;
+            Platform::ImageCodecPlugin::the().request_animation_frames(m_animation_id, first_frame_index, frame_count, [weak_this = make_weak_ptr()](size_t first_frame_index, Vector<Platform::Frame> frames) {
+                if (weak_this)
+                    weak_this->did_decode_frames(first_frame_index, move(frames));
+            });
+            return;
+        }
+    }
+
+    void did_decode_frames(size_t first_frame_index, Vector<Platform::Frame> frames)
+    {
+        m_has_pending_request = false;
+
+        for (size_t i = 0; i < frames.size() && first_frame_index + i < m_frames.size(); ++i) {
+            auto& frame = m_frames[first_frame_index + i];
+            frame.duration = static_cast<int>(frames[i].duration);
+            if (frames[i].bitmap && is_kept(first_frame_index + i))
+                frame.bitmap = Gfx::ImmutableBitmap::create(*frames[i].bitmap, Gfx::AlphaType::Premultiplied, m_color_space);
+        }
+
+        // NOTE: Frames that failed to decode are not asked for again until the animation comes around to them next time.
+        bool did_decode_missing_frame = any_of(frames, [](auto const& frame) { return frame.bitmap; });
+        if (did_decode_missing_frame)
+            request_missing_frames();
+    }
+
+    i64 m_animation_id { 0 };
+    Gfx::ColorSpace m_color_space;
+    Vector<StreamedFrame> m_frames;
+    size_t m_playhead { 0 };
+    bool m_did_set_playhead { false };
+    bool m_has_pending_request { false };
+    RefPtr<Gfx::ImmutableBitmap> m_last_shown_bitmap;
+    int m_last_known_duration { 0 };
+};
+
 ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated)
 {
     return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
 }
 
-AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create_streamed(JS::Realm& realm, Vector<Frame>&& initial_frames, size_t frame_count, size_t loop_count, i64 animation_id, Gfx::ColorSpace color_space)
+{
+    VERIFY(!initial_frames.is_empty());
+    auto streamed_frames = adopt_ref(*new StreamedFrames(animation_id, frame_count, move(color_space), initial_frames));
+    initial_frames.shrink(1);
+    return realm.create<AnimatedBitmapDecodedImageData>(move(initial_frames), loop_count, true, move(streamed_frames));
+}
+
+AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated, RefPtr<StreamedFrames> streamed_frames)
     : m_frames(move(frames))
+    , m_streamed_frames(move(streamed_frames))
     , m_loop_count(loop_count)
     , m_animated(animated)
 {
+    if (m_streamed_frames) {
+        // The first frame, and the ones kept around after the one being shown.
+        m_decoded_size_in_bytes = size_in_bytes(*m_frames.first().bitmap) * (StreamedFrames::frames_kept_ahead + 2);
+        return;
+    }
+
+    for (auto const& frame : m_frames) {
+        if (frame.bitmap)
+            m_decoded_size_in_bytes += size_in_bytes(*frame.bitmap);
+    }
 }
 
 AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
 
+size_t AnimatedBitmapDecodedImageData::frame_count() const
+{
+    if (m_streamed_frames)
+        return m_streamed_frames->frame_count();
+    return m_frames.size();
+}
+
 RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
+    if (m_streamed_frames)
+        return m_streamed_frames->bitmap(frame_index);
     if (frame_index >= m_frames.size())
         return nullptr;
     return m_frames[frame_index].bitmap;
@@ -36,6 +200,8 @@ RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame
 
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 {
+    if (m_streamed_frames)
+        return m_streamed_frames->frame_duration(frame_index);
     if (frame_index >= m_frames.size())
         return 0;
     return m_frames[frame_index].duration;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGfx/ColorSpace.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/HTML/DecodedImageData.h>
 
@@ -22,12 +23,16 @@ public:
     };
 
     static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+
+    // Creates an animation of which only the first few of frame_count frames have been decoded. The others are decoded
+    // by ImageDecoder shortly before they are shown, and dropped again once they have been.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create_streamed(JS::Realm&, Vector<Frame>&& initial_frames, size_t frame_count, size_t loop_count, i64 animation_id, Gfx::ColorSpace);
     virtual ~AnimatedBitmapDecodedImageData() override;
 
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
     virtual int frame_duration(size_t frame_index) const override;
 
-    virtual size_t frame_count() const override { return m_frames.size(); }
+    virtual size_t frame_count() const override;
     virtual size_t loop_count() const override { return m_loop_count; }
     virtual bool is_animated() const override { return m_animated; }
 
@@ -35,12 +40,19 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
+    virtual size_t decoded_size_in_bytes() const override { return m_decoded_size_in_bytes; }
+
 private:
-    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
+    class StreamedFrames;
+
+    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated, RefPtr<StreamedFrames> = {});
 
+    // NOTE: For a streamed animation, this only holds the first frame, which the intrinsic size comes from.
     Vector<Frame> m_frames;
+    RefPtr<StreamedFrames> m_streamed_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+    size_t m_decoded_size_in_bytes { 0 };
 };
 
 }
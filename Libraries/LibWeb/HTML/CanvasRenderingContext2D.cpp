@@ -97,6 +97,21 @@ Gfx::Path CanvasRenderingContext2D::rect_path(float x, float y, float width, flo
 
 void CanvasRenderingContext2D::fill_rect(float x, float y, float width, float height)
 {
+    // OPTIMIZATION: Unless there's a shadow to draw underneath it, the rectangle is drawn as a rectangle rather than as a
+    //               path. That's a lot cheaper than filling a path, and it lets Skia merge runs of rectangles that are
+    //               drawn with the same paint, as charts tend to do, into a single draw.
+    if (!shadows_are_drawn()) {
+        auto* painter = this->painter();
+        if (!painter)
+            return;
+
+        auto rect = Gfx::FloatRect(x, y, width, height);
+        auto& state = this->drawing_state();
+        painter->fill_rect(rect, state.fill_style.to_gfx_paint_style(), state.filter, state.global_alpha, state.current_compositing_and_blending_operator);
+        did_draw(rect);
+        return;
+    }
+
     fill_internal(rect_path(x, y, width, height), Gfx::WindingRule::EvenOdd);
 }
 
@@ -232,11 +247,14 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
 
     auto color_type = m_context_attributes.alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
 
-    auto skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
+    // NOTE: A context that will be read from frequently is kept in memory rather than on the GPU, so that reading it back
+    //       doesn't have to wait for the GPU to finish drawing, and then copy the pixels out of GPU memory every time.
+    RefPtr<Gfx::SkiaBackendContext> skia_backend_context;
+    if (!m_context_attributes.will_read_frequently)
+        skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
     m_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, canvas_element().bitmap_size_for_canvas(), color_type, Gfx::AlphaType::Premultiplied);
 
     // https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
@@ -475,9 +493,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -488,17 +506,17 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
 
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    // OPTIMIZATION: Only the pixels in the source rectangle are read back from the surface, and they are converted to
+    //               the format of the ImageData while they're being copied, rather than taking a snapshot of the whole
+    //               surface and drawing it into the ImageData.
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
     // NOTE: No-op, already done during creation.
@@ -514,18 +532,16 @@ void CanvasRenderingContext2D::put_image_data(ImageData& image_data, float x, fl
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
     // FIXME: "put pixels from an ImageData onto a bitmap" is a spec algorithm.
     //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-    if (auto* painter = this->painter()) {
-        auto dst_rect = Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-        painter->draw_bitmap(
-            dst_rect,
-            Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-            image_data.bitmap().rect(),
-            Gfx::ScalingMode::NearestNeighbor,
-            drawing_state().filter,
-            1.0f,
-            Gfx::CompositingAndBlendingOperator::SourceOver);
-        did_draw(dst_rect);
-    }
+    if (!painter())
+        return;
+
+    // NOTE: The pixels replace those of the output bitmap, without being affected by the current transformation
+    //       matrix, the clipping region, global alpha, compositing, filters or shadows, so they can be written into
+    //       the surface directly. That also converts them from the format of the ImageData along the way.
+    auto destination_position = Gfx::IntPoint { static_cast<int>(x), static_cast<int>(y) };
+    canvas_element().surface()->write_from_bitmap(image_data.bitmap(), destination_position);
+
+    did_draw(Gfx::FloatRect(x, y, image_data.width(), image_data.height()));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
@@ -962,8 +978,24 @@ void CanvasRenderingContext2D::set_shadow_color(String color)
         return;
     }
 }
+// https://html.spec.whatwg.org/multipage/canvas.html#when-shadows-are-drawn
+bool CanvasRenderingContext2D::shadows_are_drawn() const
+{
+    // Shadows are only drawn if the opacity component of the alpha component of the shadow color is nonzero and either
+    // the shadowBlur is nonzero, or the shadowOffsetX is nonzero, or the shadowOffsetY is nonzero.
+    auto const& state = drawing_state();
+    if (state.shadow_color.alpha() == 0)
+        return false;
+    return state.shadow_blur != 0 || state.shadow_offset_x != 0 || state.shadow_offset_y != 0;
+}
+
 void CanvasRenderingContext2D::paint_shadow_for_fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
 {
+    // OPTIMIZATION: Most of the time, there is no shadow, and drawing an invisible one would cost as much as drawing the
+    //               path itself, and then some for the blur.
+    if (!shadows_are_drawn())
+        return;
+
     auto* painter = this->painter();
     if (!painter)
         return;
@@ -990,6 +1022,9 @@ void CanvasRenderingContext2D::paint_shadow_for_fill_internal(Gfx::Path const& p
 
 void CanvasRenderingContext2D::paint_shadow_for_stroke_internal(Gfx::Path const& path)
 {
+    if (!shadows_are_drawn())
+        return;
+
     auto* painter = this->painter();
     if (!painter)
         return;
@@ -31,6 +31,9 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const = 0;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const = 0;
 
+    // NOTE: Images that are rendered whenever they are needed don't hold on to any decoded pixels.
+    virtual size_t decoded_size_in_bytes() const { return 0; }
+
 protected:
     DecodedImageData();
 };
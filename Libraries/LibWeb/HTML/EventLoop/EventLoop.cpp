@@ -6,6 +6,9 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/FontFaceSet.h>
@@ -14,14 +17,17 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scheduler.h>
 #include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/Script.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
@@ -32,6 +38,11 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(EventLoop);
 
+static constexpr AK::Duration incremental_marking_slice_budget = AK::Duration::from_milliseconds(2);
+
+// FIXME: Account for the actual refresh rate of the display, which is what the rendering updates are paced by.
+static constexpr double rendering_update_interval_in_milliseconds = 1000.0 / 60.0;
+
 EventLoop::EventLoop(Type type)
     : m_type(type)
 {
@@ -53,7 +64,9 @@ void EventLoop::visit_edges(Visitor& visitor)
     visitor.visit(m_currently_running_task);
     visitor.visit(m_backup_incumbent_realm_stack);
     visitor.visit(m_rendering_task_function);
+    visitor.visit(m_current_scheduling_state);
     visitor.visit(m_system_event_loop_timer);
+    m_first_script_entered_by_current_task.visit([](Empty) {}, [&](auto const& cell) { visitor.visit(cell); });
 }
 
 void EventLoop::schedule()
@@ -160,7 +173,7 @@ void EventLoop::process()
 
     // 1. Let oldestTask and taskStartTime be null.
     GC::Ptr<Task> oldest_task;
-    [[maybe_unused]] double task_start_time = 0;
+    double task_start_time = 0;
 
     // 2. If the event loop has a task queue with at least one runnable task, then:
     if (m_task_queue->has_runnable_tasks()) {
@@ -177,6 +190,7 @@ void EventLoop::process()
 
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
+        m_first_script_entered_by_current_task = Empty {};
 
         // 6. Perform oldestTask's steps.
         oldest_task->execute();
@@ -188,20 +202,48 @@ void EventLoop::process()
         perform_a_microtask_checkpoint();
     }
 
+    // NOTE: If the garbage collector is marking incrementally, let it make some progress between tasks.
+    if (heap().is_incremental_marking_in_progress())
+        heap().perform_incremental_marking_step(incremental_marking_slice_budget);
+
     // 3. Let taskEndTime be the unsafe shared current time. [HRT]
-    [[maybe_unused]] auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
+    auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 4. If oldestTask is not null, then:
+    // OPTIMIZATION: Only long tasks are reported, so we don't need to collect the top-level browsing contexts of others.
+    if (oldest_task && task_end_time - task_start_time >= LongTasks::long_tasks_threshold) {
+        // 1. Let top-level browsing contexts be an empty set.
+        Vector<GC::Ref<BrowsingContext>> top_level_browsing_contexts;
+
+        // 2. For each environment settings object settings of oldestTask's script evaluation environment settings object set:
+        for (auto const& settings : oldest_task->script_evaluation_environment_settings_object_set()) {
+            // 1. Let global be settings's global object.
+            // 2. If global is not a Window object, then continue.
+            auto* global = as_if<Window>(settings->global_object());
+            if (!global)
+                continue;
+
+            // 3. If global's browsing context is null, then continue.
+            auto* browsing_context = global->browsing_context();
+            if (!browsing_context)
+                continue;
+
+            // 4. Let tlbc be global's browsing context's top-level browsing context.
+            auto top_level_browsing_context = browsing_context->top_level_browsing_context();
+
+            // 5. If tlbc is not null, then append it to top-level browsing contexts.
+            if (top_level_browsing_context && !top_level_browsing_contexts.contains_slow(*top_level_browsing_context))
+                top_level_browsing_contexts.append(*top_level_browsing_context);
+        }
+
+        // 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
+        LongTasks::report_long_tasks(task_start_time, task_end_time, top_level_browsing_contexts, *oldest_task);
+    }
+
     if (oldest_task) {
-        // FIXME: 1. Let top-level browsing contexts be an empty set.
-        // FIXME: 2. For each environment settings object settings of oldestTask's script evaluation environment settings object set:
-        // FIXME: 2.1. Let global be settings's global object.
-        // FIXME: 2.2. If global is not a Window object, then continue.
-        // FIXME: 2.3. If global's browsing context is null, then continue.
-        // FIXME: 2.4. Let tlbc be global's browsing context's top-level browsing context.
-        // FIXME: 2.5. If tlbc is not null, then append it to top-level browsing contexts.
-        // FIXME: 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
         // FIXME: 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+
+        did_run_task(*oldest_task, task_start_time, task_end_time);
     }
 
     // 5. If this is a window event loop that has no runnable task in this event loop's task queues, then:
@@ -216,10 +258,19 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // OPTIMIZATION: If the garbage collector is marking incrementally and there are no idle callbacks to run, it
+        //               may use the rest of the idle period to make progress, rather than a slice after each task.
+        if (heap().is_incremental_marking_in_progress() && !m_task_queue->has_runnable_tasks()) {
+            auto idle_time_in_milliseconds = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+            auto idle_time = AK::Duration::from_microseconds(static_cast<i64>(idle_time_in_milliseconds * 1000));
+            if (idle_time > incremental_marking_slice_budget)
+                heap().perform_incremental_marking_step(idle_time);
+        }
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
-    if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint)) {
+    if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint) || heap().is_incremental_marking_in_progress()) {
         schedule();
     }
 }
@@ -241,8 +292,10 @@ void EventLoop::queue_task_to_update_the_rendering()
     for (auto& navigable : all_navigables()) {
         if (!navigable->is_traversable())
             continue;
-        if (!navigable->has_a_rendering_opportunity())
+        if (!navigable->has_a_rendering_opportunity()) {
+            navigable->set_has_missed_rendering_opportunity();
             continue;
+        }
 
         auto document = navigable->active_document();
         if (!document)
@@ -254,13 +307,60 @@ void EventLoop::queue_task_to_update_the_rendering()
     }
 }
 
-void EventLoop::process_input_events() const
+void EventLoop::did_run_task(Task const& task, HighResolutionTime::DOMHighResTimeStamp task_start_time, HighResolutionTime::DOMHighResTimeStamp task_end_time)
+{
+    auto duration = AK::Duration::from_nanoseconds(static_cast<i64>((task_end_time - task_start_time) * 1'000'000));
+    m_task_statistics.did_run_task(task.source(), duration);
+
+    if (task_end_time - task_start_time >= LongTasks::long_tasks_threshold) {
+        LongTask long_task { .source = task.source(), .duration = duration };
+
+        m_first_script_entered_by_current_task.visit(
+            [](Empty) {},
+            [&](GC::Ref<JS::FunctionObject> function) {
+                auto* ecmascript_function = as_if<JS::ECMAScriptFunctionObject>(*function);
+                if (!ecmascript_function)
+                    return;
+
+                auto source_range = ecmascript_function->ecmascript_code().source_range();
+                long_task.script_url = MUST(String::formatted("{}:{}", source_range.filename(), source_range.start.line));
+
+                if (auto executable = ecmascript_function->bytecode_executable())
+                    long_task.script_name = executable->name.to_string();
+                else
+                    long_task.script_name = ecmascript_function->name().to_string();
+            },
+            [&](GC::Ref<Script> script) {
+                long_task.script_url = MUST(String::from_byte_string(script->filename()));
+            });
+
+        m_task_statistics.did_run_long_task(move(long_task));
+    }
+
+    m_first_script_entered_by_current_task = Empty {};
+}
+
+void EventLoop::did_enter_script(JS::FunctionObject& function)
+{
+    if (m_currently_running_task && m_first_script_entered_by_current_task.has<Empty>())
+        m_first_script_entered_by_current_task = GC::Ref { function };
+}
+
+void EventLoop::did_enter_script(Script& script)
+{
+    if (m_currently_running_task && m_first_script_entered_by_current_task.has<Empty>())
+        m_first_script_entered_by_current_task = GC::Ref { script };
+}
+
+void EventLoop::process_input_events()
 {
     auto process_input_events_queue = [&](Page& page) {
         auto& page_client = page.client();
         auto& input_events_queue = page_client.input_event_queue();
         while (!input_events_queue.is_empty()) {
             auto event = input_events_queue.dequeue();
+            m_task_statistics.did_handle_input_event(MonotonicTime::now() - event.queued_time);
+
             auto result = event.event.visit(
                 [&](KeyEvent const& key_event) {
                     switch (key_event.type) {
@@ -280,7 +380,7 @@ void EventLoop::process_input_events() const
                     case MouseEvent::Type::MouseMove:
                         return page.handle_mousemove(mouse_event.position, mouse_event.screen_position, mouse_event.buttons, mouse_event.modifiers);
                     case MouseEvent::Type::MouseWheel:
-                        return page.handle_mousewheel(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers, mouse_event.wheel_delta_x, mouse_event.wheel_delta_y);
+                        return page.handle_mousewheel(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers, mouse_event.wheel_delta_x, mouse_event.wheel_delta_y, event.has_already_scrolled);
                     case MouseEvent::Type::DoubleClick:
                         return page.handle_doubleclick(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers);
                     }
@@ -686,14 +786,33 @@ double EventLoop::compute_deadline() const
         //    set hasPendingRenders to true.
         if (window->has_animation_frame_callbacks())
             has_pending_renders = true;
-        // FIXME: 2. Let timerCallbackEstimates be the result of getting the values of windowInSameLoop's map of active timers.
-        // FIXME: 3. For each timeoutDeadline of timerCallbackEstimates, if timeoutDeadline is less than deadline, set deadline to timeoutDeadline.
+        // NOTE: We believe a window might have pending rendering updates if its navigable needs to be repainted.
+        else if (auto navigable = window->navigable(); navigable && navigable->needs_repaint())
+            has_pending_renders = true;
+
+        // 2. Let timerCallbackEstimates be the result of getting the values of windowInSameLoop's map of active timers.
+        // 3. For each timeoutDeadline of timerCallbackEstimates, if timeoutDeadline is less than deadline, set deadline to timeoutDeadline.
+        // OPTIMIZATION: Only the earliest of the timers can lower the deadline.
+        if (auto timeout_deadline = window->earliest_active_timer_deadline(); timeout_deadline.has_value()) {
+            // NOTE: The values of the map of active timers are relative to the time origin of the window, while deadline
+            //       is a moment on the shared monotonic clock.
+            auto shared_timeout_deadline = relevant_principal_settings_object(*window).time_origin() + *timeout_deadline;
+            if (shared_timeout_deadline < deadline)
+                deadline = shared_timeout_deadline;
+        }
     }
     // 4. If hasPendingRenders is true, then:
     if (has_pending_renders) {
         // 1. Let nextRenderDeadline be this event loop's last render opportunity time plus (1000 divided by the current refresh rate).
-        // FIXME: Hardcoded to 60Hz
-        auto next_render_deadline = m_last_render_opportunity_time + (1000.0 / 60.0);
+        auto next_render_deadline = m_last_render_opportunity_time + rendering_update_interval_in_milliseconds;
+
+        // NOTE: If rendering opportunities were missed since then (e.g. because a task ran for long), the rendering
+        //       updates are still paced by the refresh rate, so the next one is a whole number of intervals later.
+        if (next_render_deadline < m_last_idle_period_start_time) {
+            auto missed_intervals = ceil((m_last_idle_period_start_time - next_render_deadline) / rendering_update_interval_in_milliseconds);
+            next_render_deadline += missed_intervals * rendering_update_interval_in_milliseconds;
+        }
+
         // 2. If nextRenderDeadline is less than deadline, then return nextRenderDeadline.
         if (next_render_deadline < deadline)
             return next_render_deadline;
@@ -8,11 +8,13 @@
 
 #include <AK/Function.h>
 #include <AK/Noncopyable.h>
+#include <AK/Variant.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Forward.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
+#include <LibWeb/HTML/EventLoop/TaskStatistics.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 
 namespace Web::HTML {
@@ -63,6 +65,7 @@ public:
     void increment_termination_nesting_level() { ++m_termination_nesting_level; }
     void decrement_termination_nesting_level() { --m_termination_nesting_level; }
 
+    Task* currently_running_task() { return m_currently_running_task; }
     Task const* currently_running_task() const { return m_currently_running_task; }
 
     void schedule();
@@ -92,12 +95,23 @@ public:
 
     bool running_rendering_task() const { return m_running_rendering_task; }
 
+    // https://wicg.github.io/scheduling-apis/#event-loop-current-scheduling-state
+    GC::Ptr<SchedulingState> current_scheduling_state() const { return m_current_scheduling_state; }
+    void set_current_scheduling_state(GC::Ptr<SchedulingState> state) { m_current_scheduling_state = state; }
+
+    // Remembers the first script that's entered while a task runs, so that a long task can be attributed to it.
+    void did_enter_script(JS::FunctionObject&);
+    void did_enter_script(Script&);
+
+    TaskStatistics const& task_statistics() const { return m_task_statistics; }
+
 private:
     explicit EventLoop(Type);
 
     virtual void visit_edges(Visitor&) override;
 
-    void process_input_events() const;
+    void process_input_events();
+    void did_run_task(Task const&, HighResolutionTime::DOMHighResTimeStamp task_start_time, HighResolutionTime::DOMHighResTimeStamp task_end_time);
     void update_the_rendering();
 
     Type m_type { Type::Window };
@@ -138,6 +152,12 @@ private:
     bool m_running_rendering_task { false };
 
     GC::Ptr<GC::Function<void()>> m_rendering_task_function;
+
+    GC::Ptr<SchedulingState> m_current_scheduling_state;
+
+    Variant<Empty, GC::Ref<JS::FunctionObject>, GC::Ref<Script>> m_first_script_entered_by_current_task;
+
+    TaskStatistics m_task_statistics;
 };
 
 EventLoop& main_thread_event_loop();
@@ -7,6 +7,7 @@
 #include <AK/IDAllocator.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 
 namespace Web::HTML {
 
@@ -25,9 +26,26 @@ GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document cons
     return vm.heap().allocate<Task>(source, document, move(steps));
 }
 
+Task::Priority Task::priority_for_source(Source source)
+{
+    switch (source) {
+    case Source::UserInteraction:
+        return Priority::UserInput;
+    case Source::Rendering:
+        return Priority::Rendering;
+    case Source::TimerTask:
+        return Priority::Timer;
+    case Source::IdleTask:
+        return Priority::Idle;
+    default:
+        return Priority::Normal;
+    }
+}
+
 Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
+    , m_priority(priority_for_source(source))
     , m_steps(steps)
     , m_document(document)
 {
@@ -40,6 +58,7 @@ void Task::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_steps);
     visitor.visit(m_document);
+    visitor.visit(m_script_evaluation_environment_settings_object_set);
 }
 
 void Task::execute()
@@ -47,6 +66,13 @@ void Task::execute()
     m_steps->function()();
 }
 
+void Task::add_to_script_evaluation_environment_settings_object_set(EnvironmentSettingsObject& settings)
+{
+    // NOTE: A task almost always runs scripts of a single settings object, so this linear search is cheap.
+    if (!m_script_evaluation_environment_settings_object_set.contains_slow(settings))
+        m_script_evaluation_environment_settings_object_set.append(settings);
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#concept-task-runnable
 bool Task::is_runnable() const
 {
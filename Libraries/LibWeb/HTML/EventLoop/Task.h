@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/DistinctNumeric.h>
+#include <AK/Vector.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Forward.h>
@@ -80,24 +81,55 @@ public:
         // https://w3c.github.io/media-capabilities/#media-capabilities-task-source
         MediaCapabilities,
 
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // The event loop runs runnable tasks with a higher priority first, and tasks with the same priority in the order
+    // they were queued in. Tasks of the same source always have the same priority, except for posted tasks, which
+    // have the priority they were posted with.
+    enum class Priority : u8 {
+        UserInput,
+        UserBlockingContinuation,
+        UserBlocking,
+        Rendering,
+        UserVisibleContinuation,
+        Normal,
+        Timer,
+        BackgroundContinuation,
+        Background,
+        Idle,
+    };
+    static constexpr size_t priority_count = to_underlying(Priority::Idle) + 1;
+
+    static Priority priority_for_source(Source);
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
 
     [[nodiscard]] TaskID id() const { return m_id; }
     Source source() const { return m_source; }
+
+    Priority priority() const { return m_priority; }
+    // NOTE: This must be called before the task is queued.
+    void set_priority(Priority priority) { m_priority = priority; }
+
     void execute();
 
     DOM::Document const* document() const;
 
     bool is_runnable() const;
 
+    // https://html.spec.whatwg.org/multipage/webappapis.html#script-evaluation-environment-settings-object-set
+    Vector<GC::Ref<EnvironmentSettingsObject>, 1> const& script_evaluation_environment_settings_object_set() const { return m_script_evaluation_environment_settings_object_set; }
+    void add_to_script_evaluation_environment_settings_object_set(EnvironmentSettingsObject&);
+
 private:
     Task(Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
@@ -105,8 +137,10 @@ private:
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::Normal };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
+    Vector<GC::Ref<EnvironmentSettingsObject>, 1> m_script_evaluation_environment_settings_object_set;
 };
 
 struct UniqueTaskSource {
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibGC/RootVector.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
@@ -12,6 +13,50 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(TaskQueue);
 
+// After this many tasks in a row ran ahead of an older runnable task with a lower priority, the oldest runnable task
+// runs next, whatever its priority.
+static constexpr size_t max_tasks_taken_ahead_of_older_tasks = 16;
+
+GC::Ref<Task> TaskQueue::PriorityQueue::take(size_t index)
+{
+    if (index != 0)
+        return m_tasks.take(m_start + index);
+
+    auto task = m_tasks[m_start++];
+    compact();
+    return task;
+}
+
+template<typename Callback>
+void TaskQueue::PriorityQueue::remove_all_matching(Callback callback)
+{
+    m_tasks.remove(0, m_start);
+    m_start = 0;
+    m_tasks.remove_all_matching(callback);
+}
+
+void TaskQueue::PriorityQueue::compact()
+{
+    if (is_empty()) {
+        m_tasks.clear_with_capacity();
+        m_start = 0;
+        return;
+    }
+
+    // NOTE: The tasks that were already taken are only dropped once they make up most of the queue, so shifting the
+    //       tasks that are left stays cheap on average.
+    if (m_start >= 32 && m_start >= m_tasks.size() / 2) {
+        m_tasks.remove(0, m_start);
+        m_start = 0;
+    }
+}
+
+void TaskQueue::PriorityQueue::visit_edges(Cell::Visitor& visitor)
+{
+    for (size_t i = m_start; i < m_tasks.size(); ++i)
+        visitor.visit(m_tasks[i]);
+}
+
 TaskQueue::TaskQueue(HTML::EventLoop& event_loop)
     : m_event_loop(event_loop)
 {
@@ -23,27 +68,77 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& queue : m_queues)
+        queue.visit_edges(visitor);
+    visitor.visit(m_last_added_task);
 }
 
 void TaskQueue::add(GC::Ref<Task> task)
 {
-    m_tasks.append(task);
+    m_queues[to_underlying(task->priority())].append(task);
+    ++m_task_count;
+    m_last_added_task = task;
     m_event_loop->schedule();
 }
 
+bool TaskQueue::is_candidate(Task const& task) const
+{
+    if (m_event_loop->running_rendering_task() && task.source() == Task::Source::Rendering)
+        return false;
+    return task.is_runnable();
+}
+
+Optional<size_t> TaskQueue::first_candidate_index(Task::Priority priority) const
+{
+    auto const& queue = m_queues[to_underlying(priority)];
+    for (size_t i = 0; i < queue.size(); ++i) {
+        if (is_candidate(queue.at(i)))
+            return i;
+    }
+    return {};
+}
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_event_loop->running_rendering_task() && m_tasks[i]->source() == Task::Source::Rendering)
+    struct Candidate {
+        Task::Priority priority;
+        size_t index;
+        TaskID id;
+    };
+    Optional<Candidate> highest_priority_candidate;
+    Optional<Candidate> oldest_candidate;
+
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        auto priority = static_cast<Task::Priority>(i);
+        auto index = first_candidate_index(priority);
+        if (!index.has_value())
             continue;
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+
+        Candidate candidate { priority, *index, m_queues[i].at(*index)->id() };
+        if (!highest_priority_candidate.has_value())
+            highest_priority_candidate = candidate;
+        if (!oldest_candidate.has_value() || candidate.id < oldest_candidate->id)
+            oldest_candidate = candidate;
     }
-    return nullptr;
+
+    if (!highest_priority_candidate.has_value())
+        return nullptr;
+
+    auto candidate = *highest_priority_candidate;
+    if (candidate.id == oldest_candidate->id) {
+        m_tasks_taken_ahead_of_older_tasks = 0;
+    } else if (m_tasks_taken_ahead_of_older_tasks >= max_tasks_taken_ahead_of_older_tasks) {
+        candidate = *oldest_candidate;
+        m_tasks_taken_ahead_of_older_tasks = 0;
+    } else {
+        ++m_tasks_taken_ahead_of_older_tasks;
+    }
+
+    --m_task_count;
+    return m_queues[to_underlying(candidate.priority)].take(candidate.index);
 }
 
 bool TaskQueue::has_runnable_tasks() const
@@ -51,54 +146,54 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (m_event_loop->running_rendering_task() && task->source() == Task::Source::Rendering)
-            continue;
-        if (task->is_runnable())
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        if (first_candidate_index(static_cast<Task::Priority>(i)).has_value())
             return true;
     }
     return false;
 }
 
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    for (auto& queue : m_queues) {
+        if (!queue.is_empty()) {
+            --m_task_count;
+            return queue.take(0);
+        }
+    }
+    return {};
+}
+
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    m_tasks.remove_all_matching([&](auto& task) {
-        return filter(*task);
-    });
+    for (auto& queue : m_queues) {
+        auto size_before = queue.size();
+        queue.remove_all_matching([&](auto& task) {
+            return filter(*task);
+        });
+        m_task_count -= size_before - queue.size();
+    }
 }
 
 GC::RootVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     GC::RootVector<GC::Ref<Task>> matching_tasks(heap());
 
-    for (size_t i = 0; i < m_tasks.size();) {
-        auto& task = m_tasks.at(i);
-
-        if (filter(*task)) {
-            matching_tasks.append(task);
-            m_tasks.remove(i);
-        } else {
-            ++i;
+    for (auto& queue : m_queues) {
+        for (size_t i = 0; i < queue.size();) {
+            if (filter(*queue.at(i))) {
+                matching_tasks.append(queue.take(i));
+                --m_task_count;
+            } else {
+                ++i;
+            }
         }
     }
 
-    return matching_tasks;
-}
-
-Task const* TaskQueue::last_added_task() const
-{
-    if (m_tasks.is_empty())
-        return nullptr;
-    return m_tasks.last();
-}
+    // NOTE: Tasks of different priorities are kept apart, so we restore the order they were queued in.
+    quick_sort(matching_tasks, [](auto const& a, auto const& b) { return a->id() < b->id(); });
 
-bool TaskQueue::has_rendering_tasks() const
-{
-    for (auto const& task : m_tasks) {
-        if (task->source() == Task::Source::Rendering)
-            return true;
-    }
-    return false;
+    return matching_tasks;
 }
 
 }
@@ -6,12 +6,16 @@
 
 #pragma once
 
-#include <AK/Queue.h>
+#include <AK/Array.h>
+#include <AK/Vector.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
 namespace Web::HTML {
 
+// Tasks are kept in one queue per priority. The first runnable task of the highest priority runs first, except that a
+// task of a lower priority gets to run after too many tasks jumped ahead of it, so that a steady stream of high
+// priority tasks can't starve everything else.
 class TaskQueue : public JS::Cell {
     GC_CELL(TaskQueue, JS::Cell);
     GC_DECLARE_ALLOCATOR(TaskQueue);
@@ -20,33 +24,58 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_task_count == 0; }
 
     bool has_runnable_tasks() const;
-    bool has_rendering_tasks() const;
+    bool has_rendering_tasks() const { return !m_queues[to_underlying(Task::Priority::Rendering)].is_empty(); }
 
     void add(GC::Ref<HTML::Task>);
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::RootVector<GC::Ref<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
 
-    Task const* last_added_task() const;
+    Task const* last_added_task() const { return m_last_added_task; }
 
 private:
+    // A FIFO queue of tasks that dequeues in constant time, by moving its start forward instead of shifting all tasks.
+    class PriorityQueue {
+    public:
+        bool is_empty() const { return m_start == m_tasks.size(); }
+        size_t size() const { return m_tasks.size() - m_start; }
+
+        GC::Ref<Task> const& at(size_t index) const { return m_tasks[m_start + index]; }
+
+        void append(GC::Ref<Task> task) { m_tasks.append(task); }
+        GC::Ref<Task> take(size_t index);
+
+        template<typename Callback>
+        void remove_all_matching(Callback);
+
+        void visit_edges(Cell::Visitor&);
+
+    private:
+        void compact();
+
+        Vector<GC::Ref<Task>> m_tasks;
+        size_t m_start { 0 };
+    };
+
     virtual void visit_edges(Visitor&) override;
 
+    bool is_candidate(Task const&) const;
+    Optional<size_t> first_candidate_index(Task::Priority) const;
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
-    Vector<GC::Ref<HTML::Task>> m_tasks;
+    Array<PriorityQueue, Task::priority_count> m_queues;
+    size_t m_task_count { 0 };
+    GC::Ptr<Task> m_last_added_task;
+
+    size_t m_tasks_taken_ahead_of_older_tasks { 0 };
 };
 
 }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibWeb/HTML/EventLoop/TaskStatistics.h>
+
+namespace Web::HTML {
+
+void DurationHistogram::record(AK::Duration duration)
+{
+    auto milliseconds = duration.to_milliseconds();
+
+    size_t bucket = 0;
+    while (bucket < bucket_upper_bounds_in_milliseconds.size() && milliseconds >= bucket_upper_bounds_in_milliseconds[bucket])
+        ++bucket;
+
+    ++m_buckets[bucket];
+    ++m_count;
+    m_total += duration;
+    m_max = AK::max(m_max, duration);
+}
+
+static size_t histogram_index_for_source(Task::Source source)
+{
+    return min(to_underlying(source), to_underlying(Task::Source::UniqueTaskSourceStart));
+}
+
+static StringView task_source_name(size_t index)
+{
+    switch (static_cast<Task::Source>(index)) {
+    case Task::Source::Unspecified:
+        return "Unspecified"sv;
+    case Task::Source::DOMManipulation:
+        return "DOMManipulation"sv;
+    case Task::Source::UserInteraction:
+        return "UserInteraction"sv;
+    case Task::Source::Networking:
+        return "Networking"sv;
+    case Task::Source::HistoryTraversal:
+        return "HistoryTraversal"sv;
+    case Task::Source::IdleTask:
+        return "IdleTask"sv;
+    case Task::Source::PostedMessage:
+        return "PostedMessage"sv;
+    case Task::Source::Microtask:
+        return "Microtask"sv;
+    case Task::Source::TimerTask:
+        return "TimerTask"sv;
+    case Task::Source::JavaScriptEngine:
+        return "JavaScriptEngine"sv;
+    case Task::Source::Geolocation:
+        return "Geolocation"sv;
+    case Task::Source::BitmapTask:
+        return "BitmapTask"sv;
+    case Task::Source::NavigationAndTraversal:
+        return "NavigationAndTraversal"sv;
+    case Task::Source::FileReading:
+        return "FileReading"sv;
+    case Task::Source::IntersectionObserver:
+        return "IntersectionObserver"sv;
+    case Task::Source::PerformanceTimeline:
+        return "PerformanceTimeline"sv;
+    case Task::Source::CanvasBlobSerializationTask:
+        return "CanvasBlobSerializationTask"sv;
+    case Task::Source::Clipboard:
+        return "Clipboard"sv;
+    case Task::Source::Permissions:
+        return "Permissions"sv;
+    case Task::Source::FontLoading:
+        return "FontLoading"sv;
+    case Task::Source::RemoteEvent:
+        return "RemoteEvent"sv;
+    case Task::Source::Rendering:
+        return "Rendering"sv;
+    case Task::Source::DatabaseAccess:
+        return "DatabaseAccess"sv;
+    case Task::Source::WebSocket:
+        return "WebSocket"sv;
+    case Task::Source::MediaCapabilities:
+        return "MediaCapabilities"sv;
+    case Task::Source::PostedTask:
+        return "PostedTask"sv;
+    case Task::Source::UniqueTaskSourceStart:
+        return "Unique"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void TaskStatistics::did_run_task(Task::Source source, AK::Duration duration)
+{
+    m_task_durations[histogram_index_for_source(source)].record(duration);
+}
+
+void TaskStatistics::did_run_long_task(LongTask long_task)
+{
+    m_long_tasks.enqueue(move(long_task));
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_microseconds()) / 1000.0;
+}
+
+static void append_histogram(StringBuilder& builder, StringView name, DurationHistogram const& histogram)
+{
+    builder.appendff("{:<28} {:>8} {:>10.3} {:>10.3}", name, histogram.count(), to_milliseconds(histogram.total()) / static_cast<double>(histogram.count()), to_milliseconds(histogram.max()));
+    for (auto count : histogram.buckets())
+        builder.appendff(" {:>6}", count);
+    builder.append('\n');
+}
+
+String TaskStatistics::dump() const
+{
+    StringBuilder builder;
+
+    builder.appendff("{:<28} {:>8} {:>10} {:>10}", "source"sv, "tasks"sv, "avg (ms)"sv, "max (ms)"sv);
+    for (auto upper_bound : DurationHistogram::bucket_upper_bounds_in_milliseconds)
+        builder.appendff(" {:>4}ms", upper_bound);
+    builder.appendff(" {:>6}\n", ">1s"sv);
+
+    for (size_t index = 0; index < m_task_durations.size(); ++index) {
+        if (m_task_durations[index].count() != 0)
+            append_histogram(builder, task_source_name(index), m_task_durations[index]);
+    }
+
+    if (m_input_event_queueing_delay.count() != 0)
+        append_histogram(builder, "(input event queueing delay)"sv, m_input_event_queueing_delay);
+
+    if (!m_long_tasks.is_empty()) {
+        builder.append("\nMost recent long tasks:\n"sv);
+        for (auto const& long_task : m_long_tasks) {
+            builder.appendff("{:>10.3}ms {:<24}", to_milliseconds(long_task.duration), task_source_name(histogram_index_for_source(long_task.source)));
+            if (!long_task.script_url.is_empty() || !long_task.script_name.is_empty())
+                builder.appendff(" {} ({})", long_task.script_name.is_empty() ? "<anonymous>"sv : long_task.script_name.bytes_as_string_view(), long_task.script_url);
+            builder.append('\n');
+        }
+    }
+
+    return MUST(builder.to_string());
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+
+namespace Web::HTML {
+
+// Counts how many durations fell into each of a fixed set of buckets, growing roughly exponentially up to a second.
+class DurationHistogram {
+public:
+    static constexpr Array<i64, 11> bucket_upper_bounds_in_milliseconds { 1, 2, 4, 8, 16, 33, 50, 100, 250, 500, 1000 };
+    static constexpr size_t bucket_count = bucket_upper_bounds_in_milliseconds.size() + 1;
+
+    void record(AK::Duration);
+
+    u64 count() const { return m_count; }
+    AK::Duration total() const { return m_total; }
+    AK::Duration max() const { return m_max; }
+    Array<u64, bucket_count> const& buckets() const { return m_buckets; }
+
+private:
+    Array<u64, bucket_count> m_buckets {};
+    u64 m_count { 0 };
+    AK::Duration m_total;
+    AK::Duration m_max;
+};
+
+// https://w3c.github.io/longtasks/#long-task
+struct LongTask {
+    Task::Source source { Task::Source::Unspecified };
+    AK::Duration duration;
+
+    // The script that was entered first while the task ran, if any.
+    String script_url;
+    String script_name;
+};
+
+// How long the tasks of an event loop ran for, per task source, and how long input events waited to be handled, to
+// find out where jank comes from.
+class TaskStatistics {
+public:
+    static constexpr size_t long_task_capacity = 64;
+
+    void did_run_task(Task::Source, AK::Duration);
+    void did_run_long_task(LongTask);
+    void did_handle_input_event(AK::Duration queueing_delay) { m_input_event_queueing_delay.record(queueing_delay); }
+
+    String dump() const;
+
+private:
+    // NOTE: All unique task sources share the last histogram.
+    Array<DurationHistogram, to_underlying(Task::Source::UniqueTaskSourceStart) + 1> m_task_durations;
+    DurationHistogram m_input_event_queueing_delay;
+    CircularQueue<LongTask, long_task_capacity> m_long_tasks;
+};
+
+}
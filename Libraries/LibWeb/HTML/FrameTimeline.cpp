@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/StringBuilder.h>
+#include <LibWeb/HTML/FrameTimeline.h>
+
+namespace Web::HTML {
+
+static i64 to_microseconds(MonotonicTime time)
+{
+    return time.nanoseconds() / 1000;
+}
+
+static i64 duration_in_microseconds(FrameTimingInterval const& interval)
+{
+    return (interval.end - interval.start).to_microseconds();
+}
+
+String FrameTimeline::dump() const
+{
+    StringBuilder builder;
+    builder.append("frame    style   layout     swap   record  enqueue   raster  present   (durations and offsets from frame start in µs)\n"sv);
+
+    auto append_interval = [&](Optional<FrameTimingInterval> const& interval) {
+        if (interval.has_value())
+            builder.appendff(" {:>8}", duration_in_microseconds(*interval));
+        else
+            builder.append("        -"sv);
+    };
+
+    for (auto const& frame : m_frames) {
+        // NOTE: Offsets are relative to the backing store swap, which starts every frame.
+        auto frame_start = frame.backing_store_swap.has_value() ? frame.backing_store_swap->start : MonotonicTime::now();
+        auto append_offset = [&](Optional<MonotonicTime> const& time) {
+            if (time.has_value())
+                builder.appendff(" {:>8}", (*time - frame_start).to_microseconds());
+            else
+                builder.append("        -"sv);
+        };
+
+        builder.appendff("{:>5}", frame.frame_id);
+        append_interval(frame.style_update);
+        append_interval(frame.layout_update);
+        append_interval(frame.backing_store_swap);
+        append_interval(frame.display_list_recording);
+        append_offset(frame.rendering_task_enqueued);
+        append_interval(frame.rasterization);
+        append_offset(frame.presented);
+        builder.append('\n');
+    }
+    return MUST(builder.to_string());
+}
+
+String FrameTimeline::to_trace_events_json() const
+{
+    // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+    JsonArray trace_events;
+
+    auto append_complete_event = [&](StringView name, u64 frame_id, Optional<FrameTimingInterval> const& interval, u64 thread_id) {
+        if (!interval.has_value())
+            return;
+        JsonObject event;
+        event.set("name"sv, name);
+        event.set("cat"sv, "rendering"sv);
+        event.set("ph"sv, "X"sv);
+        event.set("ts"sv, to_microseconds(interval->start));
+        event.set("dur"sv, duration_in_microseconds(*interval));
+        event.set("pid"sv, 0);
+        event.set("tid"sv, thread_id);
+        JsonObject args;
+        args.set("frame"sv, frame_id);
+        event.set("args"sv, move(args));
+        trace_events.must_append(move(event));
+    };
+
+    auto append_instant_event = [&](StringView name, u64 frame_id, Optional<MonotonicTime> const& time, u64 thread_id) {
+        if (!time.has_value())
+            return;
+        JsonObject event;
+        event.set("name"sv, name);
+        event.set("cat"sv, "rendering"sv);
+        event.set("ph"sv, "i"sv);
+        event.set("s"sv, "t"sv);
+        event.set("ts"sv, to_microseconds(*time));
+        event.set("pid"sv, 0);
+        event.set("tid"sv, thread_id);
+        JsonObject args;
+        args.set("frame"sv, frame_id);
+        event.set("args"sv, move(args));
+        trace_events.must_append(move(event));
+    };
+
+    // NOTE: Rasterization happens on the rendering thread, everything else on the main thread.
+    static constexpr u64 main_thread_id = 0;
+    static constexpr u64 rendering_thread_id = 1;
+
+    for (auto const& frame : m_frames) {
+        append_complete_event("Style update"sv, frame.frame_id, frame.style_update, main_thread_id);
+        append_complete_event("Layout update"sv, frame.frame_id, frame.layout_update, main_thread_id);
+        append_complete_event("Backing store swap"sv, frame.frame_id, frame.backing_store_swap, main_thread_id);
+        append_complete_event("Display list recording"sv, frame.frame_id, frame.display_list_recording, main_thread_id);
+        append_instant_event("Rendering task enqueued"sv, frame.frame_id, frame.rendering_task_enqueued, main_thread_id);
+        append_complete_event("Rasterization"sv, frame.frame_id, frame.rasterization, rendering_thread_id);
+        append_instant_event("Presented"sv, frame.frame_id, frame.presented, main_thread_id);
+    }
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(trace_events));
+    trace.set("displayTimeUnit"sv, "ms"sv);
+    return trace.serialized();
+}
+
+}
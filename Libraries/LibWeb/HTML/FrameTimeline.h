@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/CircularQueue.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+
+namespace Web::HTML {
+
+struct FrameTimingInterval {
+    MonotonicTime start;
+    MonotonicTime end;
+};
+
+// Timestamps of the steps of the rendering pipeline that contributed to a single painted frame.
+// NOTE: Style and layout updates are the most recent ones performed for the document before the frame was recorded,
+//       and are missing if the frame could reuse the previous style and layout.
+struct FrameTimings {
+    u64 frame_id { 0 };
+    Optional<FrameTimingInterval> style_update;
+    Optional<FrameTimingInterval> layout_update;
+    Optional<FrameTimingInterval> backing_store_swap;
+    Optional<FrameTimingInterval> display_list_recording;
+    Optional<MonotonicTime> rendering_task_enqueued;
+    Optional<FrameTimingInterval> rasterization;
+    Optional<MonotonicTime> presented;
+};
+
+// Keeps the timings of the most recently painted frames of a navigable.
+class FrameTimeline {
+public:
+    static constexpr size_t capacity = 256;
+
+    u64 allocate_frame_id() { return ++m_last_frame_id; }
+    void append(FrameTimings const& frame) { m_frames.enqueue(frame); }
+
+    CircularQueue<FrameTimings, capacity> const& frames() const { return m_frames; }
+
+    String dump() const;
+
+    // Serializes the timeline in the Trace Event Format, which can be loaded by external profilers such as Perfetto.
+    String to_trace_events_json() const;
+
+private:
+    CircularQueue<FrameTimings, capacity> m_frames;
+    u64 m_last_frame_id { 0 };
+};
+
+}
@@ -73,7 +73,7 @@ GC::Ptr<DOM::HTMLCollection> const& HTMLFieldSetElement::elements()
                 || is<HTMLOutputElement>(element)
                 || is<HTMLSelectElement>(element)
                 || is<HTMLTextAreaElement>(element);
-        });
+        }, DOM::HTMLCollection::FilterDependsOnAttributes::No);
     }
     return m_elements;
 }
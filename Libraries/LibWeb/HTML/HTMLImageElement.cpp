@@ -839,6 +839,37 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
 
             m_load_event_delayer.clear();
+        },
+        [this, image_request]() {
+            batching_dispatcher().enqueue(GC::create_function(realm().heap(), [this, image_request] {
+                VERIFY(image_request->shared_resource_request());
+                if (image_request->state() == ImageRequest::State::CompletelyAvailable || image_request->state() == ImageRequest::State::Broken)
+                    return;
+                if (image_request != m_pending_request && image_request != m_current_request)
+                    return;
+
+                auto image_data = image_request->shared_resource_request()->image_data();
+                if (!image_data)
+                    return;
+                image_request->set_image_data(image_data);
+
+                // NOTE: These are the steps that run while the image is being fetched, once the user agent has some of its
+                //       data, from https://html.spec.whatwg.org/multipage/images.html#update-the-image-data
+                // 1. If image request is the pending request, abort the image request for the current request, upgrade the
+                //    pending request to the current request and prepare image request for presentation given the img element.
+                if (image_request == m_pending_request) {
+                    abort_the_image_request(realm(), m_current_request);
+                    upgrade_pending_request_to_current_request();
+                    image_request->prepare_for_presentation(*this);
+                }
+
+                // 2. Set image request to the partially available state.
+                image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+                set_needs_style_update(true);
+                if (auto layout_node = this->layout_node())
+                    layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+            }));
         });
 }
 
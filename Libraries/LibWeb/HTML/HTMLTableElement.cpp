@@ -369,7 +369,7 @@ GC::Ref<DOM::HTMLCollection> HTMLTableElement::t_bodies()
     if (!m_t_bodies) {
         m_t_bodies = DOM::HTMLCollection::create(*this, DOM::HTMLCollection::Scope::Children, [](DOM::Element const& element) {
             return element.local_name() == TagNames::tbody;
-        });
+        }, DOM::HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_t_bodies;
 }
@@ -426,7 +426,7 @@ GC::Ref<DOM::HTMLCollection> HTMLTableElement::rows()
             }
 
             return false;
-        });
+        }, DOM::HTMLCollection::FilterDependsOnAttributes::No);
     }
     return *m_rows;
 }
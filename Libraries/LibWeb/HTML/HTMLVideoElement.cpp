@@ -6,6 +6,7 @@
  */
 
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/Bindings/HTMLVideoElementPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -123,7 +124,10 @@ void HTMLVideoElement::set_video_track(GC::Ptr<HTML::VideoTrack> video_track)
 
 void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position)
 {
-    m_current_frame = { move(frame), position };
+    RefPtr<Gfx::ImmutableBitmap> immutable_frame;
+    if (frame)
+        immutable_frame = Gfx::ImmutableBitmap::create(*frame);
+    m_current_frame = { move(frame), move(immutable_frame), position };
     if (paintable())
         paintable()->set_needs_display();
 }
@@ -227,8 +231,8 @@ WebIDL::ExceptionOr<void> HTMLVideoElement::determine_element_poster_frame(Optio
             (void)Platform::ImageCodecPlugin::the().decode_image(
                 image_data,
                 [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& image) -> ErrorOr<void> {
-                    if (!image.frames.is_empty())
-                        strong_this->m_poster_frame = move(image.frames[0].bitmap);
+                    if (!image.frames.is_empty() && image.frames[0].bitmap)
+                        strong_this->m_poster_frame = Gfx::ImmutableBitmap::create(*image.frames[0].bitmap);
                     return {};
                 },
                 [](auto&) {});
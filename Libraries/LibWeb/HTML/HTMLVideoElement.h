@@ -17,6 +17,11 @@ namespace Web::HTML {
 
 struct VideoFrame {
     RefPtr<Gfx::Bitmap> frame;
+
+    // NOTE: This wraps the same pixels as the frame above. It's created once per frame rather than every time the video
+    //       is painted, so that the painter sees the same image when it repaints an unchanged frame and can reuse
+    //       whatever it uploaded for it last time.
+    RefPtr<Gfx::ImmutableBitmap> immutable_frame;
     double position { 0.0 };
 };
 
@@ -40,7 +45,7 @@ public:
 
     void set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position);
     VideoFrame const& current_frame() const { return m_current_frame; }
-    RefPtr<Gfx::Bitmap> const& poster_frame() const { return m_poster_frame; }
+    RefPtr<Gfx::ImmutableBitmap> const& poster_frame() const { return m_poster_frame; }
 
     // FIXME: This is a hack for images used as CanvasImageSource. Do something more elegant.
     RefPtr<Gfx::Bitmap> bitmap() const
@@ -72,7 +77,7 @@ private:
 
     GC::Ptr<HTML::VideoTrack> m_video_track;
     VideoFrame m_current_frame;
-    RefPtr<Gfx::Bitmap> m_poster_frame;
+    RefPtr<Gfx::ImmutableBitmap> m_poster_frame;
 
     u32 m_video_width { 0 };
     u32 m_video_height { 0 };
@@ -49,6 +49,13 @@ void ListOfAvailableImages::remove(Key const& key)
     m_images.remove(key);
 }
 
+void ListOfAvailableImages::remove_all_with_image_data(DecodedImageData const& image_data)
+{
+    m_images.remove_all_matching([&](auto const&, auto const& entry) {
+        return entry->image_data.ptr() == &image_data;
+    });
+}
+
 ListOfAvailableImages::Entry* ListOfAvailableImages::get(Key const& key)
 {
     auto it = m_images.find(key);
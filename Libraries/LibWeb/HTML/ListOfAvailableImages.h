@@ -49,6 +49,7 @@ public:
 
     void add(Key const&, GC::Ref<DecodedImageData>, bool ignore_higher_layer_caching);
     void remove(Key const&);
+    void remove_all_with_image_data(DecodedImageData const&);
     [[nodiscard]] Entry* get(Key const&);
 
     void visit_edges(JS::Cell::Visitor& visitor) override;
@@ -25,6 +25,7 @@
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/BrowsingContextGroup.h>
 #include <LibWeb/HTML/DocumentState.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLIFrameElement.h>
 #include <LibWeb/HTML/HistoryHandlingBehavior.h>
 #include <LibWeb/HTML/Navigable.h>
@@ -48,6 +49,7 @@
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Selection/Selection.h>
 #include <LibWeb/XHR/FormData.h>
@@ -2576,22 +2578,30 @@ void Navigable::set_has_session_history_entry_and_ready_for_navigation()
 
 bool Navigable::is_ready_to_paint() const
 {
-    return m_number_of_queued_rasterization_tasks <= 1;
+    return m_number_of_queued_rasterization_tasks < max_number_of_frames_in_flight;
 }
 
 void Navigable::ready_to_paint()
 {
     m_number_of_queued_rasterization_tasks--;
-    VERIFY(m_number_of_queued_rasterization_tasks >= 0 && m_number_of_queued_rasterization_tasks < 2);
+    VERIFY(m_number_of_queued_rasterization_tasks >= 0 && m_number_of_queued_rasterization_tasks < max_number_of_frames_in_flight);
+
+    // OPTIMIZATION: If we had to skip a rendering opportunity while waiting for the UI process, produce the next frame
+    //               right away instead of waiting for the next refresh timer tick.
+    if (exchange(m_has_missed_rendering_opportunity, false))
+        main_thread_event_loop().queue_task_to_update_the_rendering();
 }
 
 void Navigable::paint_next_frame()
 {
+    FrameTimings frame_timings;
+    auto backing_store_swap_start = MonotonicTime::now();
     auto [backing_store_id, painting_surface] = m_backing_store_manager->acquire_store_for_next_frame();
     if (!painting_surface)
         return;
+    frame_timings.backing_store_swap = FrameTimingInterval { backing_store_swap_start, MonotonicTime::now() };
 
-    VERIFY(m_number_of_queued_rasterization_tasks <= 1);
+    VERIFY(m_number_of_queued_rasterization_tasks < max_number_of_frames_in_flight);
     m_number_of_queued_rasterization_tasks++;
 
     auto viewport_rect = page().css_to_device_rect(this->viewport_rect());
@@ -2601,10 +2611,24 @@ void Navigable::paint_next_frame()
             return;
         auto& traversable = *page().top_level_traversable();
         traversable.page().client().page_did_paint(viewport_rect.to_type<int>(), backing_store_id);
-    });
+    },
+        move(frame_timings));
 }
 
-void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
+// OPTIMIZATION: If nothing but scroll offsets changed since the last frame, the display list we have is still good, as
+//               scroll offsets are only applied when it's played back. So a frame can be produced right away, without
+//               waiting for the next rendering update, by playing it back again on the rendering thread.
+void Navigable::paint_next_frame_if_only_scroll_offsets_changed()
+{
+    auto document = active_document();
+    if (!document || !document->has_cached_display_list())
+        return;
+    if (!is_ready_to_paint())
+        return;
+    paint_next_frame();
+}
+
+void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback, Optional<FrameTimings> frame_timings)
 {
     m_needs_repaint = false;
     auto document = active_document();
@@ -2613,13 +2637,23 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         return;
     }
     document->paintable()->refresh_scroll_state();
-    auto display_list = document->record_display_list(paint_config);
+    auto display_list_recording_start = MonotonicTime::now();
+    auto display_list = [&] {
+        PhaseTimer phase_timer { Phase::PaintRecord };
+        return document->record_display_list(paint_config);
+    }();
     if (!display_list) {
         callback();
         return;
     }
     auto scroll_state_snapshot = document->paintable()->scroll_state().snapshot();
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot), painting_surface, move(callback));
+    if (frame_timings.has_value()) {
+        frame_timings->frame_id = m_rendering_thread.frame_timeline().allocate_frame_id();
+        document->take_style_and_layout_update_timings(*frame_timings);
+        frame_timings->display_list_recording = FrameTimingInterval { display_list_recording_start, MonotonicTime::now() };
+        frame_timings->rendering_task_enqueued = MonotonicTime::now();
+    }
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot), painting_surface, move(callback), move(frame_timings));
 }
 
 RefPtr<Gfx::SkiaBackendContext> Navigable::skia_backend_context() const
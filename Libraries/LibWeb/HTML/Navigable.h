@@ -207,8 +207,12 @@ public:
 
     bool is_ready_to_paint() const;
     void ready_to_paint();
+    void set_has_missed_rendering_opportunity() { m_has_missed_rendering_opportunity = true; }
     void paint_next_frame();
-    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback);
+    void paint_next_frame_if_only_scroll_offsets_changed();
+    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback, Optional<FrameTimings> = {});
+
+    FrameTimeline const& frame_timeline() const { return m_rendering_thread.frame_timeline(); }
 
     bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_repaint() { m_needs_repaint = true; }
@@ -285,7 +289,13 @@ private:
     bool m_needs_repaint { true };
     bool m_pending_set_browser_zoom_request { false };
     bool m_should_show_line_box_borders { false };
+    // NOTE: Frames are pipelined: the next frame is recorded on the main thread while the previous one is still being
+    //       rasterized on the rendering thread or waiting to be presented by the UI process. Each frame in flight owns
+    //       one of the backing stores, so we can't have more frames in flight than there are backing stores, and the
+    //       main thread stops producing frames (backpressure) until the UI process acknowledges the oldest one.
+    static constexpr i32 max_number_of_frames_in_flight = 2;
     i32 m_number_of_queued_rasterization_tasks { 0 };
+    bool m_has_missed_rendering_opportunity { false };
     GC::Ref<Painting::BackingStoreManager> m_backing_store_manager;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     RenderingThread m_rendering_thread;
@@ -14,13 +14,13 @@
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
 #include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
-#include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Comment.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/DocumentType.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/Event.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
 #include <LibWeb/DOM/QualifiedName.h>
 #include <LibWeb/DOM/ShadowRoot.h>
@@ -38,6 +38,8 @@
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/PreconnectScanner.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
 #include <LibWeb/HTML/Window.h>
@@ -46,6 +48,7 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/MathML/TagNames.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/SVG/SVGScriptElement.h>
 #include <LibWeb/SVG/TagNames.h>
 
@@ -157,7 +160,12 @@ static bool is_html_integration_point(DOM::Element const& element)
 }
 
 HTMLParser::HTMLParser(DOM::Document& document, StringView input, StringView encoding)
-    : m_tokenizer(input, encoding)
+    : HTMLParser(document, HTMLTokenizer::decode_input(input, encoding), encoding)
+{
+}
+
+HTMLParser::HTMLParser(DOM::Document& document, HTMLTokenizer::DecodedInput decoded_input, StringView encoding)
+    : m_tokenizer(move(decoded_input))
     , m_scripting_enabled(document.is_scripting_enabled())
     , m_document(document)
 {
@@ -204,6 +212,8 @@ void HTMLParser::initialize(JS::Realm& realm)
 
 void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
+    PhaseTimer phase_timer { Phase::HTMLParse };
+
     m_stop_parsing = false;
 
     for (;;) {
@@ -221,6 +231,11 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
             }
         }
 
+        // NOTE: Consecutive characters are collected and inserted into their text node all at once. Anything else may
+        //       insert nodes or run script, either of which could observe that, so insert them first.
+        if (!token.is_character())
+            flush_character_insertions();
+
         // https://html.spec.whatwg.org/multipage/parsing.html#tree-construction-dispatcher
         // As each token is emitted from the tokenizer, the user agent must follow the appropriate steps from the following list, known as the tree construction dispatcher:
         if (m_stack_of_open_elements.is_empty()
@@ -264,6 +279,12 @@ void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint st
 {
     m_document->set_url(url);
     m_document->set_source(m_tokenizer.source());
+
+    // OPTIMIZATION: Start connecting to the origins of subresources before the parser gets to the elements that load
+    //               them, so that connection setup overlaps with parsing and script execution.
+    if (m_document->browsing_context())
+        PreconnectScanner::scan(*m_document, m_tokenizer.source());
+
     run(stop_at_insertion_point);
     the_end(*m_document, this);
 }
@@ -826,9 +847,7 @@ GC::Ref<DOM::Element> HTMLParser::create_element_for(HTMLToken const& token, Opt
 
     // 10. Append each attribute in the given token to element.
     token.for_each_attribute([&](auto const& attribute) {
-        DOM::QualifiedName qualified_name { attribute.local_name, attribute.prefix, attribute.namespace_ };
-        auto dom_attribute = realm().create<DOM::Attr>(*document, move(qualified_name), attribute.value, element);
-        element->append_attribute(dom_attribute);
+        element->append_attribute(DOM::QualifiedName { attribute.local_name, attribute.prefix, attribute.namespace_ }, attribute.value);
         return IterationDecision::Continue;
     });
 
@@ -3293,7 +3312,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3312,7 +3332,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Our speculative HTML parser runs to completion as soon as it's started, so there's nothing to stop.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4996,8 +5017,36 @@ DOM::Document& HTMLParser::document()
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
+// Returns whether parsing markup as a fragment with the given context element would produce nothing but a single Text
+// node with markup as its data.
+static bool fragment_parses_as_plain_text(DOM::Element const& context_element, StringView markup)
+{
+    // NOTE: Without any of these, every state the tokenizer may start in emits nothing but character tokens, without
+    //       replacing or dropping any of them.
+    for (auto byte : markup.bytes()) {
+        if (byte == '<' || byte == '&' || byte == '\r' || byte == '\0')
+            return false;
+    }
+
+    // NOTE: These are the context elements for which resetting the insertion mode appropriately does not end up in
+    //       "in body", where character tokens are inserted as they are.
+    if (context_element.namespace_uri() != Namespace::HTML)
+        return false;
+    return !context_element.local_name().is_one_of(HTML::TagNames::select, HTML::TagNames::tr, HTML::TagNames::tbody, HTML::TagNames::thead, HTML::TagNames::tfoot, HTML::TagNames::caption, HTML::TagNames::colgroup, HTML::TagNames::table, HTML::TagNames::template_, HTML::TagNames::frameset, HTML::TagNames::html);
+}
+
 Vector<GC::Root<DOM::Node>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
+    // OPTIMIZATION: Setting innerHTML and friends to a string without any markup in it is common, and all that the
+    //               algorithm below does for those is create a single Text node. We skip creating a temporary document
+    //               and a parser for them.
+    if (markup.is_empty())
+        return {};
+    if (fragment_parses_as_plain_text(context_element, markup)) {
+        GC::Ref<DOM::Node> text = context_element.realm().create<DOM::Text>(context_element.document(), String::from_utf8_without_validation(markup.bytes()));
+        return { GC::make_root(text) };
+    }
+
     // 1. Let document be a Document node whose type is "html".
     auto temp_document = DOM::Document::create_for_fragment_parsing(context_element.realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -5104,12 +5153,18 @@ GC::Ref<HTMLParser> HTMLParser::create_for_scripting(DOM::Document& document)
     return document.realm().create<HTMLParser>(document);
 }
 
-GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+ByteString HTMLParser::encoding_for_uncertain_input(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
 {
     if (document.has_encoding())
-        return document.realm().create<HTMLParser>(document, input, document.encoding().value().to_byte_string());
+        return document.encoding().value().to_byte_string();
     auto encoding = run_encoding_sniffing_algorithm(document, input, maybe_mime_type);
     dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+    return encoding;
+}
+
+GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+{
+    auto encoding = encoding_for_uncertain_input(document, input, maybe_mime_type);
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
@@ -5118,47 +5173,104 @@ GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, StringView input
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
+GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, HTMLTokenizer::DecodedInput decoded_input, StringView encoding)
+{
+    return document.realm().create<HTMLParser>(document, move(decoded_input), encoding);
+}
+
 enum class AttributeMode {
     No,
     Yes,
 };
 
-static String escape_string(StringView string, AttributeMode attribute_mode)
+static constexpr Array<bool, 256> make_escape_table(AttributeMode attribute_mode)
 {
-    // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    StringBuilder builder;
-    for (auto code_point : Utf8View { string }) {
+    Array<bool, 256> table {};
+    table['&'] = true;
+    table['<'] = true;
+    table['>'] = true;
+    if (attribute_mode == AttributeMode::Yes)
+        table['"'] = true;
+    // NOTE: U+00A0 NO-BREAK SPACE is encoded as 0xC2 0xA0 in UTF-8, so its lead byte has to be looked at more closely.
+    table[0xC2] = true;
+    return table;
+}
+
+static constexpr auto text_escape_table = make_escape_table(AttributeMode::No);
+static constexpr auto attribute_escape_table = make_escape_table(AttributeMode::Yes);
+
+// https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+static void append_escaped_string(StringBuilder& builder, StringView string, AttributeMode attribute_mode)
+{
+    // OPTIMIZATION: Rather than appending one code point at a time, we look for the bytes that may need escaping in the
+    //               UTF-8 data, and append the runs of bytes in between them all at once.
+    auto const& needs_escape = attribute_mode == AttributeMode::Yes ? attribute_escape_table : text_escape_table;
+    auto const* bytes = reinterpret_cast<u8 const*>(string.characters_without_null_termination());
+    size_t length = string.length();
+    size_t run_start = 0;
+
+    for (size_t i = 0; i < length; ++i) {
+        if (!needs_escape[bytes[i]]) [[likely]]
+            continue;
+
+        StringView replacement;
+        size_t replaced_length = 1;
+        switch (bytes[i]) {
         // 1. Replace any occurrence of the "&" character by the string "&amp;".
-        if (code_point == '&')
-            builder.append("&amp;"sv);
+        case '&':
+            replacement = "&amp;"sv;
+            break;
         // 2. Replace any occurrences of the U+00A0 NO-BREAK SPACE character by the string "&nbsp;".
-        else if (code_point == 0xA0)
-            builder.append("&nbsp;"sv);
+        case 0xC2:
+            if (i + 1 >= length || bytes[i + 1] != 0xA0)
+                continue;
+            replacement = "&nbsp;"sv;
+            replaced_length = 2;
+            break;
         // 3. Replace any occurrences of the "<" character by the string "&lt;".
-        else if (code_point == '<')
-            builder.append("&lt;"sv);
+        case '<':
+            replacement = "&lt;"sv;
+            break;
         // 4. Replace any occurrences of the ">" character by the string "&gt;".
-        else if (code_point == '>')
-            builder.append("&gt;"sv);
+        case '>':
+            replacement = "&gt;"sv;
+            break;
         // 5. If the algorithm was invoked in the attribute mode, then replace any occurrences of the """ character by the string "&quot;".
-        else if (code_point == '"' && attribute_mode == AttributeMode::Yes)
-            builder.append("&quot;"sv);
-        else
-            builder.append_code_point(code_point);
+        case '"':
+            replacement = "&quot;"sv;
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+
+        builder.append(string.substring_view(run_start, i - run_start));
+        builder.append(replacement);
+        i += replaced_length - 1;
+        run_start = i + 1;
     }
-    return builder.to_string_without_validation();
+
+    builder.append(string.substring_view(run_start));
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
 String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<GC::Root<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+{
+    // 2. Let s be a string, and initialize it to the empty string.
+    StringBuilder builder;
+    append_html_fragment_serialization(builder, node, serializable_shadow_roots, shadow_roots, fragment_serialization_mode);
+
+    // 6. Return s.
+    return builder.to_string_without_validation();
+}
+
+// OPTIMIZATION: Every recursive invocation of the serialization algorithm appends straight to the caller's s, instead of
+//               building a string of its own that would then be copied into it.
+void HTMLParser::append_html_fragment_serialization(StringBuilder& builder, DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<GC::Root<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
 {
     // NOTE: Steps in this function are jumbled a bit to accommodate the Element.outerHTML API.
     //       When called with FragmentSerializationMode::Outer, we will serialize the element itself,
     //       not just its children.
 
-    // 2. Let s be a string, and initialize it to the empty string.
-    StringBuilder builder;
-
     auto serialize_element = [&](DOM::Element const& element) {
         // If current node is an element in the HTML namespace, the MathML namespace, or the SVG namespace, then let tagname be current node's local name.
         // Otherwise, let tagname be current node's qualified name.
@@ -5179,7 +5291,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append(" is=\""sv);
-            builder.append(escape_string(element.is_value().value(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value().value(), AttributeMode::Yes);
             builder.append('"');
         }
 
@@ -5212,7 +5324,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append(attribute.name());
 
             builder.append("=\""sv);
-            builder.append(escape_string(attribute.value(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value(), AttributeMode::Yes);
             builder.append('"');
         });
 
@@ -5229,7 +5341,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // a U+002F SOLIDUS character (/),
         // tagname again,
         // and finally a U+003E GREATER-THAN SIGN character (>).
-        builder.append(serialize_html_fragment(element, serializable_shadow_roots, shadow_roots));
+        append_html_fragment_serialization(builder, element, serializable_shadow_roots, shadow_roots);
         builder.append("</"sv);
         builder.append(tag_name);
         builder.append('>');
@@ -5239,7 +5351,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
     if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
         serialize_element(as<DOM::Element>(node));
-        return builder.to_string_without_validation();
+        return;
     }
 
     // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
@@ -5252,7 +5364,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // 1. If the node serializes as void, then return the empty string.
         //    (NOTE: serializes as void is defined only on elements in the spec)
         if (element.serializes_as_void())
-            return String {};
+            return;
 
         // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
         //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
@@ -5296,7 +5408,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
                 // 8. Append the value of running the HTML fragment serialization algorithm with shadow,
                 //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
-                builder.append(serialize_html_fragment(*shadow, serializable_shadow_roots, shadow_roots));
+                append_html_fragment_serialization(builder, *shadow, serializable_shadow_roots, shadow_roots);
 
                 // 9. Append "</template>".
                 builder.append("</template>"sv);
@@ -5335,7 +5447,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data(), AttributeMode::No);
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -5379,9 +5491,6 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
         return IterationDecision::Continue;
     });
-
-    // 6. Return s.
-    return MUST(builder.to_string());
 }
 
 // https://html.spec.whatwg.org/multipage/common-microsyntaxes.html#current-dimension-value
@@ -5643,13 +5752,30 @@ JS::Realm& HTMLParser::realm()
     return m_document->realm();
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // NOTE: Speculative fetches only make sense for documents that are going to be rendered.
+    if (!m_document->browsing_context())
+        return;
+
+    // 1. Optionally, return.
+    if (m_speculatively_fetched_urls.size() >= SpeculativeHTMLParser::max_speculative_fetches)
+        return;
+
+    // NOTE: Instead of creating a speculative HTML parser with its own document (steps 2 through 6), we only look ahead
+    //       through the unparsed input with a tokenizer. See SpeculativeHTMLParser for details.
+    SpeculativeHTMLParser::run(*m_document, m_tokenizer.unconsumed_input(SpeculativeHTMLParser::max_scanned_code_points), m_speculatively_fetched_urls);
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#abort-a-parser
 void HTMLParser::abort()
 {
     // 1. Throw away any pending content in the input stream, and discard any future content that would have been added to it.
     m_tokenizer.abort();
 
-    // FIXME: 2. Stop the speculative HTML parser for this HTML parser.
+    // 2. Stop the speculative HTML parser for this HTML parser.
+    // NOTE: Our speculative HTML parser runs to completion as soon as it's started, so there's nothing to stop.
 
     // 3. Update the current document readiness to "interactive".
     m_document->update_readiness(DocumentReadyState::Interactive);
@@ -63,6 +63,10 @@ public:
     static GC::Ref<HTMLParser> create_for_scripting(DOM::Document&);
     static GC::Ref<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
     static GC::Ref<HTMLParser> create(DOM::Document&, StringView input, StringView encoding);
+    static GC::Ref<HTMLParser> create(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
+
+    // Returns the encoding create_with_uncertain_encoding() would decode the input with.
+    static ByteString encoding_for_uncertain_input(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
 
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(const URL::URL&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
@@ -103,11 +107,14 @@ public:
 
 private:
     HTMLParser(DOM::Document&, StringView input, StringView encoding);
+    HTMLParser(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
     HTMLParser(DOM::Document&);
 
     virtual void visit_edges(Cell::Visitor&) override;
     virtual void initialize(JS::Realm&) override;
 
+    static void append_html_fragment_serialization(StringBuilder&, DOM::Node const&, SerializableShadowRoots, Vector<GC::Root<DOM::ShadowRoot>> const&, DOM::FragmentSerializationMode = DOM::FragmentSerializationMode::Inner);
+
     char const* insertion_mode_name() const;
 
     DOM::QuirksMode which_quirks_mode(HTMLToken const&) const;
@@ -172,6 +179,7 @@ private:
     void increment_script_nesting_level();
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
+    void start_the_speculative_html_parser();
 
     void adjust_mathml_attributes(HTMLToken&);
     void adjust_svg_tag_names(HTMLToken&);
@@ -225,6 +233,9 @@ private:
     GC::ForeignPtr<Web::SpeculativeHTMLParser> m_speculative_parser;
 #endif
 
+    // URLs of resources that the speculative HTML parser has already fetched for this parser's document.
+    HashTable<String> m_speculatively_fetched_urls;
+
     Vector<HTMLToken> m_pending_table_character_tokens;
 
     GC::Ptr<DOM::Text> m_character_insertion_node;
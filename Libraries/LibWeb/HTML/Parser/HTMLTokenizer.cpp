@@ -8,6 +8,8 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -250,6 +252,62 @@ Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoin
     return m_decoded_input[it];
 }
 
+size_t HTMLTokenizer::length_of_run_without(u32 a, u32 b, u32 c, StopAtInsertionPoint stop_at_insertion_point) const
+{
+    auto begin = static_cast<size_t>(m_current_offset);
+    auto end = m_decoded_input.size();
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        end = min(end, static_cast<size_t>(max(m_insertion_point.position, m_current_offset)));
+
+    auto const* code_points = m_decoded_input.data();
+    size_t index = begin;
+
+    // OPTIMIZATION: Look at four code points at a time until one of them ends the run.
+    using AK::SIMD::u32x4;
+    auto as = u32x4 {} + a;
+    auto bs = u32x4 {} + b;
+    auto cs = u32x4 {} + c;
+    auto carriage_returns = u32x4 {} + static_cast<u32>('\r');
+    for (; index + 4 <= end; index += 4) {
+        auto chunk = AK::SIMD::load_unaligned<u32x4>(code_points + index);
+        auto matches = bit_cast<AK::SIMD::u64x2>((chunk == as) | (chunk == bs) | (chunk == cs) | (chunk == carriage_returns));
+        if ((matches[0] | matches[1]) != 0)
+            break;
+    }
+
+    for (; index < end; ++index) {
+        auto code_point = code_points[index];
+        if (code_point == a || code_point == b || code_point == c || code_point == '\r')
+            break;
+    }
+    return index - begin;
+}
+
+void HTMLTokenizer::queue_current_character_and_run_without(u32 current_input_character, u32 a, u32 b, u32 c, StopAtInsertionPoint stop_at_insertion_point)
+{
+    // NOTE: Every code point is still its own character token, but queueing the run all at once saves going through the
+    //       state machine for each of them. The run is capped so a huge text node doesn't queue up a huge number of
+    //       tokens at once.
+    static constexpr size_t max_queued_run_length = 256;
+
+    m_queued_tokens.enqueue(HTMLToken::make_character(current_input_character));
+    auto length = min(length_of_run_without(a, b, c, stop_at_insertion_point), max_queued_run_length);
+    for (size_t i = 0; i < length; ++i)
+        m_queued_tokens.enqueue(HTMLToken::make_character(m_decoded_input[m_current_offset + i]));
+    if (length != 0)
+        skip(length);
+}
+
+void HTMLTokenizer::append_current_character_and_run_without(u32 current_input_character, u32 a, u32 b, u32 c, StopAtInsertionPoint stop_at_insertion_point)
+{
+    m_current_builder.append_code_point(current_input_character);
+    auto length = length_of_run_without(a, b, c, stop_at_insertion_point);
+    for (size_t i = 0; i < length; ++i)
+        m_current_builder.append_code_point(m_decoded_input[m_current_offset + i]);
+    if (length != 0)
+        skip(length);
+}
+
 HTMLToken::Position HTMLTokenizer::nth_last_position(size_t n)
 {
     if (n + 1 > m_source_positions.size()) {
@@ -302,7 +360,8 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    queue_current_character_and_run_without(current_input_character.value(), '&', '<', 0, stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -1314,7 +1373,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    m_current_builder.append_code_point(current_input_character.value());
+                    append_current_character_and_run_without(current_input_character.value(), '"', '&', 0, stop_at_insertion_point);
                     continue;
                 }
             }
@@ -1346,7 +1405,7 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    m_current_builder.append_code_point(current_input_character.value());
+                    append_current_character_and_run_without(current_input_character.value(), '\'', '&', 0, stop_at_insertion_point);
                     continue;
                 }
             }
@@ -1989,7 +2048,8 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    queue_current_character_and_run_without(current_input_character.value(), '&', '<', 0, stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -2108,7 +2168,8 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    queue_current_character_and_run_without(current_input_character.value(), '<', 0, 0, stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -2227,7 +2288,8 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    queue_current_character_and_run_without(current_input_character.value(), '<', 0, 0, stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -2246,7 +2308,8 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    queue_current_character_and_run_without(current_input_character.value(), 0, 0, 0, stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -2883,13 +2946,27 @@ HTMLTokenizer::HTMLTokenizer()
 }
 
 HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+    : HTMLTokenizer(decode_input(input, encoding))
+{
+}
+
+HTMLTokenizer::DecodedInput HTMLTokenizer::decode_input(StringView input, StringView encoding)
 {
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
-    m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+
+    DecodedInput decoded_input;
+    decoded_input.source = MUST(decoder->to_utf8(input));
+    decoded_input.code_points.ensure_capacity(decoded_input.source.bytes().size());
+    for (auto code_point : decoded_input.source.code_points())
+        decoded_input.code_points.unchecked_append(code_point);
+    return decoded_input;
+}
+
+HTMLTokenizer::HTMLTokenizer(DecodedInput decoded_input)
+    : m_source(move(decoded_input.source))
+    , m_decoded_input(move(decoded_input.code_points))
+{
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
@@ -2983,6 +3060,18 @@ void HTMLTokenizer::restore_to(ssize_t new_iterator)
     m_current_offset = new_iterator;
 }
 
+String HTMLTokenizer::unconsumed_input(size_t max_code_points) const
+{
+    auto offset = min(static_cast<size_t>(m_current_offset), m_decoded_input.size());
+    auto code_points = m_decoded_input.span().slice(offset);
+    code_points = code_points.trim(max_code_points);
+
+    StringBuilder builder;
+    for (auto code_point : code_points)
+        builder.append_code_point(code_point);
+    return builder.to_string_without_validation();
+}
+
 String HTMLTokenizer::consume_current_builder()
 {
     auto string = m_current_builder.to_string_without_validation();
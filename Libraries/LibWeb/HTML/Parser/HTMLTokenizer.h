@@ -105,6 +105,16 @@ public:
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
 
+    // The input, decoded from its encoding into the code points the tokenizer consumes. Unlike tokenizing itself, which
+    // the tree builder steers as it goes, this doesn't depend on anything else and can happen on another thread.
+    struct DecodedInput {
+        String source;
+        Vector<u32> code_points;
+    };
+    static DecodedInput decode_input(StringView input, StringView encoding);
+
+    explicit HTMLTokenizer(DecodedInput);
+
     enum class State {
 #define __ENUMERATE_TOKENIZER_STATE(state) state,
         ENUMERATE_TOKENIZER_STATES
@@ -130,6 +140,9 @@ public:
 
     auto const& source() const { return m_source; }
 
+    // Returns (up to the given number of code points of) the input that hasn't been tokenized yet.
+    String unconsumed_input(size_t max_code_points) const;
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
@@ -156,6 +169,15 @@ private:
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
+    // Returns how many code points from the next input character on are none of the given ones. A U+000D CR also ends
+    // the run, as it has to go through newline normalization.
+    size_t length_of_run_without(u32, u32, u32, StopAtInsertionPoint) const;
+
+    // NOTE: These consume the run that follows the current input character, if it's one that the state it's used in
+    //       would treat no differently from the current input character.
+    void queue_current_character_and_run_without(u32 current_input_character, u32, u32, u32, StopAtInsertionPoint);
+    void append_current_character_and_run_without(u32 current_input_character, u32, u32, u32, StopAtInsertionPoint);
+
     enum class ConsumeNextResult {
         Consumed,
         NotConsumed,
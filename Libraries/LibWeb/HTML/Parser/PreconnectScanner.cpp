@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/PreconnectScanner.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+
+namespace Web::HTML {
+
+enum class ConnectionLevel {
+    None,
+    ResolveOnly,
+    CreateConnection,
+};
+
+static ConnectionLevel connection_level_for_link(StringView rel)
+{
+    auto level = ConnectionLevel::None;
+
+    for (auto keyword : rel.split_view_if(Infra::is_ascii_whitespace)) {
+        if (keyword.is_one_of_ignoring_ascii_case("preconnect"sv, "stylesheet"sv, "preload"sv, "modulepreload"sv, "icon"sv))
+            return ConnectionLevel::CreateConnection;
+        if (keyword.equals_ignoring_ascii_case("dns-prefetch"sv))
+            level = ConnectionLevel::ResolveOnly;
+    }
+
+    return level;
+}
+
+void PreconnectScanner::scan(DOM::Document& document, StringView input)
+{
+    auto const& document_origin = document.origin();
+    auto base_url = document.fallback_base_url();
+
+    Vector<URL::URL> urls_to_preconnect;
+    Vector<URL::URL> urls_to_prefetch_dns;
+    HashTable<String> seen_origins;
+
+    auto note_url = [&](StringView value, ConnectionLevel level) {
+        auto url = DOMURL::parse(value, base_url);
+        if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+            return;
+
+        // NOTE: We're already connected to the document's own origin, since that's where the document came from.
+        auto origin = url->origin();
+        if (origin.is_same_origin(document_origin))
+            return;
+        if (seen_origins.set(origin.serialize()) != HashSetResult::InsertedNewEntry)
+            return;
+
+        if (level == ConnectionLevel::CreateConnection && urls_to_preconnect.size() < max_preconnected_origins)
+            urls_to_preconnect.append(url.release_value());
+        else if (urls_to_prefetch_dns.size() < max_dns_prefetched_origins)
+            urls_to_prefetch_dns.append(url.release_value());
+    };
+
+    // NOTE: We only need to know where the resources come from, so looking at the start of the document is good enough.
+    HTMLTokenizer tokenizer { input.substring_view(0, min(input.length(), max_scanned_input_length)), "UTF-8"sv };
+
+    while (true) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        if (tag_name == TagNames::base) {
+            if (auto href = token->attribute(AttributeNames::href); href.has_value()) {
+                if (auto url = DOMURL::parse(*href, document.fallback_base_url()); url.has_value())
+                    base_url = url.release_value();
+            }
+            continue;
+        }
+
+        if (tag_name == TagNames::link) {
+            if (auto href = token->attribute(AttributeNames::href); href.has_value()) {
+                if (auto level = connection_level_for_link(token->attribute(AttributeNames::rel).value_or({})); level != ConnectionLevel::None)
+                    note_url(*href, level);
+            }
+            continue;
+        }
+
+        if (tag_name.is_one_of(TagNames::script, TagNames::img, TagNames::iframe, TagNames::source, TagNames::video, TagNames::audio, TagNames::embed, TagNames::track, TagNames::input)) {
+            if (auto src = token->attribute(AttributeNames::src); src.has_value())
+                note_url(*src, ConnectionLevel::CreateConnection);
+        }
+        if (tag_name == TagNames::video) {
+            if (auto poster = token->attribute(AttributeNames::poster); poster.has_value())
+                note_url(*poster, ConnectionLevel::CreateConnection);
+        }
+
+        // NOTE: Without a tree builder, we have to switch the tokenizer into the right state for elements with special
+        //       content ourselves, so that we don't mistake e.g. markup in script strings for elements.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes) || (tag_name == TagNames::noscript && document.is_scripting_enabled()))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::textarea, TagNames::title))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name == TagNames::plaintext)
+            break;
+    }
+
+    for (auto const& url : urls_to_preconnect)
+        ResourceLoader::the().preconnect(url);
+    for (auto const& url : urls_to_prefetch_dns)
+        ResourceLoader::the().prefetch_dns(url);
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StringView.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Looks ahead through the markup of a document for the origins of resources it's going to load, and asks RequestServer
+// to resolve and connect to them right away. That way, the DNS lookups and TCP/TLS handshakes overlap with parsing
+// (and with waiting for parser-blocking scripts), instead of only starting once the parser reaches each element.
+class PreconnectScanner {
+public:
+    static constexpr size_t max_scanned_input_length = 128 * KiB;
+    static constexpr size_t max_preconnected_origins = 6;
+    static constexpr size_t max_dns_prefetched_origins = 16;
+
+    static void scan(DOM::Document&, StringView input);
+};
+
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+
+namespace Web::HTML {
+
+using Destination = Fetch::Infrastructure::Request::Destination;
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+static void speculatively_fetch(DOM::Document& document, URL::URL const& url, Destination destination, CORSSettingAttribute cors_setting, HashTable<String>& speculatively_fetched_urls)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+    if (speculatively_fetched_urls.size() >= SpeculativeHTMLParser::max_speculative_fetches)
+        return;
+    if (speculatively_fetched_urls.set(url.serialize()) != HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& realm = document.realm();
+    auto& vm = realm.vm();
+
+    auto request = create_potential_CORS_request(vm, url, destination, cors_setting);
+    request->set_client(&document.relevant_settings_object());
+
+    // NOTE: A speculative fetch must not be observable by scripts, so we don't give the request an initiator type, which
+    //       would make it show up in resource timing.
+
+    // NOTE: We read the whole response body, even though we're not interested in it, so that the response ends up in the
+    //       HTTP cache where the fetch issued by the element itself can pick it up.
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [](auto, auto) { };
+
+    (void)Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+}
+
+static Optional<Destination> destination_for_preload(StringView as)
+{
+    if (as.equals_ignoring_ascii_case("script"sv))
+        return Destination::Script;
+    if (as.equals_ignoring_ascii_case("style"sv))
+        return Destination::Style;
+    if (as.equals_ignoring_ascii_case("font"sv))
+        return Destination::Font;
+    if (as.equals_ignoring_ascii_case("image"sv))
+        return Destination::Image;
+    return {};
+}
+
+void SpeculativeHTMLParser::run(DOM::Document& document, StringView input, HashTable<String>& speculatively_fetched_urls)
+{
+    auto base_url = document.base_url();
+
+    auto fetch_attribute = [&](HTMLToken const& token, FlyString const& attribute_name, Destination destination, CORSSettingAttribute cors_setting) {
+        auto value = token.attribute(attribute_name);
+        if (!value.has_value() || value->is_empty())
+            return;
+        if (auto url = DOMURL::parse(*value, base_url); url.has_value())
+            speculatively_fetch(document, *url, destination, cors_setting, speculatively_fetched_urls);
+    };
+
+    HTMLTokenizer tokenizer { input, "UTF-8"sv };
+
+    while (true) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+        auto cors_setting = cors_setting_attribute_from_keyword(token->attribute(AttributeNames::crossorigin));
+
+        if (tag_name == TagNames::base) {
+            if (auto href = token->attribute(AttributeNames::href); href.has_value()) {
+                if (auto url = DOMURL::parse(*href, document.fallback_base_url()); url.has_value())
+                    base_url = url.release_value();
+            }
+        } else if (tag_name == TagNames::link) {
+            auto rel = token->attribute(AttributeNames::rel).value_or({});
+            auto keywords = rel.bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
+            auto has_keyword = [&](StringView keyword) {
+                return keywords.first_matching([&](auto candidate) { return candidate.equals_ignoring_ascii_case(keyword); }).has_value();
+            };
+
+            if (has_keyword("stylesheet"sv) && !has_keyword("alternate"sv)) {
+                fetch_attribute(*token, AttributeNames::href, Destination::Style, cors_setting);
+            } else if (has_keyword("modulepreload"sv)) {
+                // NOTE: Module scripts are always fetched in CORS mode.
+                if (cors_setting == CORSSettingAttribute::NoCORS)
+                    cors_setting = CORSSettingAttribute::Anonymous;
+                fetch_attribute(*token, AttributeNames::href, Destination::Script, cors_setting);
+            } else if (has_keyword("preload"sv)) {
+                // NOTE: Preloaded images may come from a srcset, and we can't tell which candidate will be chosen.
+                if (token->has_attribute(AttributeNames::imagesrcset))
+                    continue;
+                if (auto destination = destination_for_preload(token->attribute(AttributeNames::as).value_or({})); destination.has_value())
+                    fetch_attribute(*token, AttributeNames::href, *destination, cors_setting);
+            }
+        } else if (tag_name == TagNames::script) {
+            auto type = token->attribute(AttributeNames::type).value_or({});
+            if (type.equals_ignoring_ascii_case("module"sv)) {
+                if (cors_setting == CORSSettingAttribute::NoCORS)
+                    cors_setting = CORSSettingAttribute::Anonymous;
+                fetch_attribute(*token, AttributeNames::src, Destination::Script, cors_setting);
+            } else if ((type.is_empty() || MimeSniff::is_javascript_mime_type_essence_match(type)) && !token->has_attribute(AttributeNames::nomodule)) {
+                fetch_attribute(*token, AttributeNames::src, Destination::Script, cors_setting);
+            }
+        } else if (tag_name == TagNames::img) {
+            // NOTE: Lazy images may never be loaded, and for responsive images we can't tell which candidate will be chosen.
+            auto loading = token->attribute(AttributeNames::loading).value_or({});
+            if (!loading.equals_ignoring_ascii_case("lazy"sv) && !token->has_attribute(AttributeNames::srcset))
+                fetch_attribute(*token, AttributeNames::src, Destination::Image, cors_setting);
+        }
+
+        // NOTE: Without a tree builder, we have to switch the tokenizer into the right state for elements with special
+        //       content ourselves, so that we don't mistake e.g. markup in script strings for elements.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes) || (tag_name == TagNames::noscript && document.is_scripting_enabled()))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::textarea, TagNames::title))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name == TagNames::plaintext)
+            break;
+    }
+}
+
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/String.h>
+#include <AK/StringView.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#active-speculative-html-parser
+// While the HTML parser waits for a parser-blocking script, this looks ahead through the input it hasn't parsed yet
+// for the stylesheets, scripts, fonts and images that are going to be needed, and speculatively fetches them into the
+// HTTP cache. Unlike the speculative HTML parser described by the spec, it only runs the tokenizer and never builds
+// speculative mock elements, which is enough to find the resources without the cost of tree construction.
+class SpeculativeHTMLParser {
+public:
+    static constexpr size_t max_scanned_code_points = 256 * KiB;
+    static constexpr size_t max_speculative_fetches = 64;
+
+    // NOTE: The set of already fetched URLs is owned by the HTML parser, since a document may block on many scripts
+    //       and we look ahead through mostly the same input every time.
+    static void run(DOM::Document&, StringView input, HashTable<String>& speculatively_fetched_urls);
+};
+
+}
@@ -8,6 +8,7 @@
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/PhaseTimings.h>
 
 namespace Web::HTML {
 
@@ -67,19 +68,29 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, task->painting_surface);
+        auto rasterization_start = MonotonicTime::now();
+        {
+            PhaseTimer phase_timer { Phase::Raster };
+            m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, task->painting_surface);
+        }
+        if (task->frame_timings.has_value())
+            task->frame_timings->rasterization = FrameTimingInterval { rasterization_start, MonotonicTime::now() };
         if (m_exit)
             break;
-        m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
+        m_main_thread_event_loop.deferred_invoke([this, callback = move(task->callback), frame_timings = move(task->frame_timings)]() mutable {
+            if (frame_timings.has_value()) {
+                frame_timings->presented = MonotonicTime::now();
+                m_frame_timeline.append(*frame_timings);
+            }
             callback();
         });
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback)
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback, Optional<FrameTimings> frame_timings)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(painting_surface), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(painting_surface), move(callback), move(frame_timings) });
     m_rendering_task_ready_wake_condition.signal();
 }
 
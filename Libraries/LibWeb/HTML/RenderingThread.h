@@ -13,6 +13,7 @@
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/HTML/FrameTimeline.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/ScrollState.h>
 
@@ -28,7 +29,11 @@ public:
 
     void start(DisplayListPlayerType);
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player);
-    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Gfx::PaintingSurface>, Function<void()>&& callback);
+    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Gfx::PaintingSurface>, Function<void()>&& callback, Optional<FrameTimings> = {});
+
+    // NOTE: The frame timeline is only accessed on the main thread.
+    FrameTimeline& frame_timeline() { return m_frame_timeline; }
+    FrameTimeline const& frame_timeline() const { return m_frame_timeline; }
 
 private:
     void rendering_thread_loop();
@@ -47,12 +52,15 @@ private:
         Painting::ScrollStateSnapshot scroll_state_snapshot;
         NonnullRefPtr<Gfx::PaintingSurface> painting_surface;
         Function<void()> callback;
+        Optional<FrameTimings> frame_timings;
     };
     // NOTE: Queue will only contain multiple items in case tasks were scheduled by screenshot requests.
     //       Otherwise, it will contain only one item at a time.
     Queue<Task> m_rendering_tasks;
     Threading::Mutex m_rendering_task_mutex;
     Threading::ConditionVariable m_rendering_task_ready_wake_condition { m_rendering_task_mutex };
+
+    FrameTimeline m_frame_timeline;
 };
 
 }
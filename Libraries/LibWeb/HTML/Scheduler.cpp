@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventLoop/TaskQueue.h>
+#include <LibWeb/HTML/Scheduler.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+GC_DEFINE_ALLOCATOR(SchedulingState);
+
+// https://wicg.github.io/scheduling-apis/#scheduler-task-handle
+class SchedulerTaskHandle final : public JS::Cell {
+    GC_CELL(SchedulerTaskHandle, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SchedulerTaskHandle);
+
+public:
+    GC::Ref<WebIDL::Promise> promise() const { return m_promise; }
+
+    GC::Ptr<DOM::AbortSignal> signal() const { return m_signal; }
+
+    GC::Ptr<Task> task() const { return m_task; }
+    void set_task(GC::Ptr<Task> task) { m_task = task; }
+
+    void set_abort_algorithm_id(Optional<DOM::AbortSignal::AbortAlgorithmID> id) { m_abort_algorithm_id = id; }
+
+    void remove_abort_steps()
+    {
+        if (m_signal && m_abort_algorithm_id.has_value())
+            m_signal->remove_abort_algorithm(m_abort_algorithm_id.release_value());
+    }
+
+private:
+    SchedulerTaskHandle(GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+        : m_promise(promise)
+        , m_signal(signal)
+    {
+    }
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_promise);
+        visitor.visit(m_signal);
+        visitor.visit(m_task);
+    }
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-handle-promise
+    GC::Ref<WebIDL::Promise> m_promise;
+
+    GC::Ptr<DOM::AbortSignal> m_signal;
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-handle-task
+    GC::Ptr<Task> m_task;
+
+    Optional<DOM::AbortSignal::AbortAlgorithmID> m_abort_algorithm_id;
+};
+
+GC_DEFINE_ALLOCATOR(SchedulerTaskHandle);
+
+GC::Ref<SchedulingState> SchedulingState::create(JS::Heap& heap, GC::Ptr<DOM::AbortSignal> abort_source, Bindings::TaskPriority priority)
+{
+    return heap.allocate<SchedulingState>(abort_source, priority);
+}
+
+void SchedulingState::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_abort_source);
+}
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+// https://wicg.github.io/scheduling-apis/#select-the-next-scheduler-task-queue-from-all-schedulers
+// NOTE: Rather than keeping its own task queues, the scheduler gives each of its tasks a priority of the event loop's
+//       task queue. Continuations of a priority run before the other tasks of that priority.
+static Task::Priority task_priority_for(Bindings::TaskPriority priority, bool is_continuation)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return is_continuation ? Task::Priority::UserBlockingContinuation : Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return is_continuation ? Task::Priority::UserVisibleContinuation : Task::Priority::Normal;
+    case Bindings::TaskPriority::Background:
+        return is_continuation ? Task::Priority::BackgroundContinuation : Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+// https://wicg.github.io/scheduling-apis/#schedule-a-posttask-task
+GC::Ref<WebIDL::Promise> Scheduler::post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let state be a new scheduling state.
+    // 5. Set state's abort source to signal.
+    // 6. If options["priority"] exists, then set state's priority source to the result of creating a fixed priority
+    //    unabortable task signal given options["priority"].
+    // FIXME: 7. Otherwise if signal is not null and implements the TaskSignal interface, then set state's priority source to signal.
+    // 8. If state's priority source is null, then set state's priority source to the result of creating a fixed
+    //    priority unabortable task signal given "user-visible".
+    auto state = SchedulingState::create(heap(), signal, options.priority.value_or(Bindings::TaskPriority::UserVisible));
+
+    // 9. Let handle be the result of creating a task handle given result and signal.
+    // 10. If signal is not null, then add handle's abort steps to signal.
+    auto handle = create_a_task_handle(result, signal);
+
+    // 11. Let enqueueSteps be the following steps:
+    auto enqueue_steps = GC::create_function(heap(), [this, handle, state, callback] {
+        // 1. Set handle's queue to the result of selecting the scheduler task queue for scheduler given state's
+        //    priority source and false.
+        auto priority = task_priority_for(state->priority(), false);
+
+        // 2. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+        schedule_a_task_to_invoke_an_algorithm(handle, priority, [this, handle, state, callback] {
+            auto& realm = this->realm();
+
+            // 1. Let event loop be the scheduler's relevant agent's event loop.
+            auto& event_loop = *relevant_agent(*this).event_loop;
+
+            // 2. Set event loop's current scheduling state to state.
+            event_loop.set_current_scheduling_state(state);
+
+            // 3. Let callbackResult be the result of invoking callback with « » and "rethrow". If that threw an
+            //    exception, then reject result with that. Otherwise, resolve result with callbackResult.
+            auto callback_result = WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Rethrow, {});
+
+            TemporaryExecutionContext context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
+            if (callback_result.is_error())
+                WebIDL::reject_promise(realm, handle->promise(), callback_result.release_value());
+            else
+                WebIDL::resolve_promise(realm, handle->promise(), callback_result.release_value());
+
+            // 4. Set event loop's current scheduling state to null.
+            event_loop.set_current_scheduling_state(nullptr);
+        });
+    });
+
+    // 12. Let delay be options["delay"].
+    auto delay = options.delay;
+
+    // 13. If delay is greater than 0, then run steps after a timeout given scheduler's relevant global object,
+    //     "scheduler-postTask", delay, and the following steps:
+    if (delay > 0) {
+        auto& window_or_worker = as<WindowOrWorkerGlobalScopeMixin>(relevant_global_object(*this));
+        auto timeout = static_cast<i32>(min(delay, static_cast<WebIDL::UnsignedLongLong>(NumericLimits<i32>::max())));
+
+        window_or_worker.run_steps_after_a_timeout(timeout, [signal, enqueue_steps] {
+            // 1. If signal is null or signal is not aborted, then run enqueueSteps.
+            if (!signal || !signal->aborted())
+                enqueue_steps->function()();
+        });
+    }
+    // 14. Otherwise, run enqueueSteps.
+    else {
+        enqueue_steps->function()();
+    }
+
+    // 15. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // 1. Let inheritedState be the scheduler's relevant agent's event loop's current scheduling state.
+    auto inherited_state = relevant_agent(*this).event_loop->current_scheduling_state();
+
+    // 2. Let abortSource be inheritedState's abort source if inheritedState is not null, or otherwise null.
+    auto abort_source = inherited_state ? inherited_state->abort_source() : nullptr;
+
+    // 3. If abortSource is not null and abortSource is aborted, then return a promise rejected with abortSource's
+    //    abort reason.
+    if (abort_source && abort_source->aborted())
+        return WebIDL::create_rejected_promise(realm, abort_source->reason());
+
+    // 4. Let prioritySource be inheritedState's priority source if inheritedState is not null, or otherwise null.
+    // 5. If prioritySource is null, then set prioritySource to the result of creating a fixed priority unabortable
+    //    task signal given "user-visible".
+    auto priority = inherited_state ? inherited_state->priority() : Bindings::TaskPriority::UserVisible;
+
+    // 6. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 7. Let handle be the result of creating a task handle given result and abortSource.
+    // 8. If abortSource is not null, then add handle's abort steps to abortSource.
+    auto handle = create_a_task_handle(result, abort_source);
+
+    // 9. Set handle's queue to the result of selecting the scheduler task queue for scheduler given prioritySource and
+    //    true.
+    // 10. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+    schedule_a_task_to_invoke_an_algorithm(handle, task_priority_for(priority, true), [this, handle] {
+        auto& realm = this->realm();
+
+        // 1. Resolve result.
+        TemporaryExecutionContext context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
+        WebIDL::resolve_promise(realm, handle->promise(), JS::js_undefined());
+    });
+
+    // 11. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#create-a-scheduler-task-handle
+GC::Ref<SchedulerTaskHandle> Scheduler::create_a_task_handle(GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+{
+    // 1. Let handle be a new scheduler task handle.
+    // 2. Set handle's task to null.
+    // 3. Set handle's queue to null.
+    // 4. Set handle's abort steps to the following steps:
+    // 5. Set handle's promise to promise.
+    auto handle = heap().allocate<SchedulerTaskHandle>(promise, signal);
+    if (!signal)
+        return handle;
+
+    handle->set_abort_algorithm_id(signal->add_abort_algorithm([this, handle, signal] {
+        auto& realm = this->realm();
+
+        // 1. Reject promise with signal's abort reason.
+        WebIDL::reject_promise(realm, handle->promise(), signal->reason());
+
+        // 2. If task is not null, then remove task from queue.
+        if (auto task = handle->task()) {
+            relevant_agent(*this).event_loop->task_queue().remove_tasks_matching([id = task->id()](Task const& task) {
+                return task.id() == id;
+            });
+            handle->set_task(nullptr);
+        }
+    }));
+
+    // 6. Return handle.
+    return handle;
+}
+
+// https://wicg.github.io/scheduling-apis/#schedule-a-task-to-invoke-an-algorithm
+void Scheduler::schedule_a_task_to_invoke_an_algorithm(SchedulerTaskHandle& handle, Task::Priority priority, Function<void()> steps)
+{
+    // 1. Let global be the relevant global object for scheduler.
+    auto& global = relevant_global_object(*this);
+
+    // 2. Let document be global's associated Document if global is a Window object; otherwise null.
+    GC::Ptr<DOM::Document> document;
+    if (auto* window = as_if<Window>(global))
+        document = window->associated_document();
+
+    // 3. Let event loop be the scheduler's relevant agent's event loop.
+    auto& event_loop = *relevant_agent(*this).event_loop;
+
+    // 4. Set handle's task to the result of queuing a scheduler task on handle's queue given global, the posted task
+    //    task source, document, and the following steps:
+    auto task = Task::create(vm(), Task::Source::PostedTask, document, GC::create_function(heap(), [handle = GC::Ref { handle }, steps = move(steps)] {
+        // NOTE: The task has run, so it can no longer be removed from its queue, and aborting no longer has any effect.
+        handle->set_task(nullptr);
+        handle->remove_abort_steps();
+
+        // 1. Run steps.
+        steps();
+    }));
+    task->set_priority(priority);
+    handle.set_task(task);
+
+    event_loop.task_queue().add(task);
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+class SchedulerTaskHandle;
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduling-state
+class SchedulingState final : public JS::Cell {
+    GC_CELL(SchedulingState, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SchedulingState);
+
+public:
+    [[nodiscard]] static GC::Ref<SchedulingState> create(JS::Heap&, GC::Ptr<DOM::AbortSignal> abort_source, Bindings::TaskPriority);
+
+    GC::Ptr<DOM::AbortSignal> abort_source() const { return m_abort_source; }
+    Bindings::TaskPriority priority() const { return m_priority; }
+
+private:
+    SchedulingState(GC::Ptr<DOM::AbortSignal> abort_source, Bindings::TaskPriority priority)
+        : m_abort_source(abort_source)
+        , m_priority(priority)
+    {
+    }
+
+    virtual void visit_edges(Visitor&) override;
+
+    // https://wicg.github.io/scheduling-apis/#scheduling-state-abort-source
+    GC::Ptr<DOM::AbortSignal> m_abort_source;
+
+    // https://wicg.github.io/scheduling-apis/#scheduling-state-priority-source
+    // FIXME: This is a TaskSignal in the spec, whose priority can change. We don't implement TaskSignal yet, so the
+    //        priority is always fixed.
+    Bindings::TaskPriority m_priority { Bindings::TaskPriority::UserVisible };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+
+    GC::Ref<WebIDL::Promise> post_task(GC::Ref<WebIDL::CallbackType>, SchedulerPostTaskOptions const&);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    GC::Ref<SchedulerTaskHandle> create_a_task_handle(GC::Ref<WebIDL::Promise>, GC::Ptr<DOM::AbortSignal>);
+    void schedule_a_task_to_invoke_an_algorithm(SchedulerTaskHandle&, Task::Priority, Function<void()> steps);
+};
+
+}
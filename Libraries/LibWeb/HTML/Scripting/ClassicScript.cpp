@@ -8,10 +8,13 @@
 #include <LibCore/ElapsedTimer.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::HTML {
@@ -50,7 +53,10 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 
     // 10. Let result be ParseScript(source, realm, script).
     auto parse_timer = Core::ElapsedTimer::start_new();
-    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
+    auto result = [&] {
+        PhaseTimer phase_timer { Phase::JSParse };
+        return JS::Script::parse(source, realm, script->filename(), script, source_line_number);
+    }();
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
 
     // 11. If result is a list of errors, then:
@@ -84,6 +90,8 @@ JS::Completion ClassicScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envi
     if (can_run_script(realm) == RunScriptDecision::DoNotRun)
         return JS::normal_completion(JS::js_undefined());
 
+    PhaseTimer phase_timer { Phase::JSExecute };
+
     // FIXME: 3. Record classic script execution start time given script.
 
     // 4. Prepare to run script given realm.
@@ -99,6 +107,7 @@ JS::Completion ClassicScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envi
     // 7. Otherwise, set evaluationStatus to ScriptEvaluation(script's record).
     else {
         auto timer = Core::ElapsedTimer::start_new();
+        relevant_agent(realm.global_object()).event_loop->did_enter_script(*this);
 
         evaluation_status = vm().bytecode_interpreter().run(*m_script_record, lexical_environment_override);
 
@@ -144,9 +144,17 @@ void prepare_to_run_script(JS::Realm& realm)
     // 1. Push realms's execution context onto the JavaScript execution context stack; it is now the running JavaScript execution context.
     realm.global_object().vm().push_execution_context(execution_context_of_realm(realm));
 
-    // FIXME: 2. If realm is a principal realm, then:
-    // FIXME: 2.1 Let settings be realm's settings object.
-    // FIXME: 2.2 Add settings to the currently running task's script evaluation environment settings object set.
+    // 2. If realm is a principal realm, then:
+    if (is<Bindings::PrincipalHostDefined>(*realm.host_defined())) {
+        // 1. Let settings be realm's settings object.
+        auto& settings = Bindings::principal_host_defined_environment_settings_object(realm);
+
+        // 2. Add settings to the currently running task's script evaluation environment settings object set.
+        // NOTE: There is no currently running task if the script runs outside of the event loop processing model, for
+        //       example when it is run in response to an IPC message.
+        if (auto* task = settings.responsible_event_loop().currently_running_task())
+            task->add_to_script_evaluation_environment_settings_object_set(settings);
+    }
 }
 
 // https://whatpr.org/html/9893/b8ea975...df5706b/webappapis.html#concept-realm-execution-context
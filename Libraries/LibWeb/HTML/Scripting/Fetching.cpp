@@ -8,8 +8,10 @@
 
 #include <LibCore/EventLoop.h>
 #include <LibGC/Function.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/ModuleRequest.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/DOM/Document.h>
@@ -324,6 +326,32 @@ String resolve_a_module_integrity_metadata(const URL::URL& url, EnvironmentSetti
     return map.integrity().get(url).value_or(""_string);
 }
 
+// OPTIMIZATION: Parsing a large script takes a while, and only depends on its source text. So rather than parsing it on
+//               the main thread when the script is created, we parse it on the thread pool as soon as it has arrived, and
+//               leave the result in the program cache for creating the script to pick up. This lets scripts that arrive
+//               around the same time (e.g. the modules of a module graph) be parsed concurrently.
+static void parse_script_ahead_of_time(GC::Heap& heap, JS::Program::Type type, String source_text, StringView filename, Function<void(String)> on_complete)
+{
+    if (source_text.bytes().size() < JS::ProgramCache::minimum_source_length) {
+        on_complete(move(source_text));
+        return;
+    }
+
+    // NOTE: Nothing that is shared with the main thread may be handed to the thread pool, so the work only gets its own
+    //       copy of the filename, and the callback stays on the main thread's heap.
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().enqueue([&main_thread_event_loop, type, source_text = move(source_text), filename = MUST(String::from_utf8(filename)), on_complete = GC::Root { GC::create_function(heap, move(on_complete)) }]() mutable {
+        auto program = JS::ProgramCache::parse_on_any_thread(type, source_text, filename, 1);
+
+        main_thread_event_loop.deferred_invoke([type, source_text = move(source_text), filename = move(filename), program = move(program), on_complete = move(on_complete)]() mutable {
+            if (program)
+                JS::ProgramCache::the().add(type, filename, 1, program.release_nonnull());
+            on_complete->function()(move(source_text));
+        });
+        main_thread_event_loop.wake();
+    });
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-classic-script
 WebIDL::ExceptionOr<void> fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& url, EnvironmentSettingsObject& settings_object, ScriptFetchOptions options, CORSSettingAttribute cors_setting, String character_encoding, OnFetchScriptComplete on_complete)
 {
@@ -375,14 +403,17 @@ WebIDL::ExceptionOr<void> fetch_classic_script(GC::Ref<HTMLScriptElement> elemen
         // 6. Let muted errors be true if response was CORS-cross-origin, and false otherwise.
         auto muted_errors = response->is_cors_cross_origin() ? ClassicScript::MutedErrors::Yes : ClassicScript::MutedErrors::No;
 
-        // 7. Let script be the result of creating a classic script given source text, settings object's realm, response's URL,
-        //    options, and muted errors.
-        // FIXME: Pass options.
         auto response_url = response->url().value_or({});
-        auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url, 1, muted_errors);
-
-        // 8. Run onComplete given script.
-        on_complete->function()(script);
+        auto filename = response_url.to_byte_string();
+        parse_script_ahead_of_time(settings_object.heap(), JS::Program::Type::Script, move(source_text), filename, [&settings_object, filename, response_url = move(response_url), muted_errors, on_complete](String source_text) {
+            // 7. Let script be the result of creating a classic script given source text, settings object's realm, response's URL,
+            //    options, and muted errors.
+            // FIXME: Pass options.
+            auto script = ClassicScript::create(filename, source_text, settings_object.realm(), response_url, 1, muted_errors);
+
+            // 8. Run onComplete given script.
+            on_complete->function()(script);
+        });
     };
 
     TRY(Fetch::Fetching::fetch(element->realm(), request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input))));
@@ -704,23 +735,30 @@ void fetch_single_module_script(JS::Realm& realm,
         // 3. Let mimeType be the result of extracting a MIME type from response's header list.
         auto mime_type = response->header_list()->extract_mime_type();
 
-        // 4. Let moduleScript be null.
-        GC::Ptr<JavaScriptModuleScript> module_script;
+        auto create_module_script = [&module_map, url, module_type, &module_map_realm, on_complete, response, is_javascript = mime_type.has_value() && mime_type->is_javascript()](String source_text) {
+            // 4. Let moduleScript be null.
+            GC::Ptr<JavaScriptModuleScript> module_script;
 
-        // FIXME: 5. Let referrerPolicy be the result of parsing the `Referrer-Policy` header given response. [REFERRERPOLICY]
-        // FIXME: 6. If referrerPolicy is not the empty string, set options's referrer policy to referrerPolicy.
+            // FIXME: 5. Let referrerPolicy be the result of parsing the `Referrer-Policy` header given response. [REFERRERPOLICY]
+            // FIXME: 6. If referrerPolicy is not the empty string, set options's referrer policy to referrerPolicy.
 
-        // 7. If mimeType is a JavaScript MIME type and moduleType is "javascript", then set moduleScript to the result of creating a JavaScript module script given sourceText, moduleMapRealm, response's URL, and options.
-        // FIXME: Pass options.
-        if (mime_type.has_value() && mime_type->is_javascript() && module_type == "javascript")
-            module_script = JavaScriptModuleScript::create(url.basename(), source_text, module_map_realm, response->url().value_or({})).release_value_but_fixme_should_propagate_errors();
+            // 7. If mimeType is a JavaScript MIME type and moduleType is "javascript", then set moduleScript to the result of creating a JavaScript module script given sourceText, moduleMapRealm, response's URL, and options.
+            // FIXME: Pass options.
+            if (is_javascript && module_type == "javascript")
+                module_script = JavaScriptModuleScript::create(url.basename(), source_text, module_map_realm, response->url().value_or({})).release_value_but_fixme_should_propagate_errors();
 
-        // FIXME: 8. If the MIME type essence of mimeType is "text/css" and moduleType is "css", then set moduleScript to the result of creating a CSS module script given sourceText and settingsObject.
-        // FIXME: 9. If mimeType is a JSON MIME type and moduleType is "json", then set moduleScript to the result of creating a JSON module script given sourceText and settingsObject.
+            // FIXME: 8. If the MIME type essence of mimeType is "text/css" and moduleType is "css", then set moduleScript to the result of creating a CSS module script given sourceText and settingsObject.
+            // FIXME: 9. If mimeType is a JSON MIME type and moduleType is "json", then set moduleScript to the result of creating a JSON module script given sourceText and settingsObject.
 
-        // 10. Set moduleMap[(url, moduleType)] to moduleScript, and run onComplete given moduleScript.
-        module_map.set(url, module_type.to_byte_string(), { ModuleMap::EntryType::ModuleScript, module_script });
-        on_complete->function()(module_script);
+            // 10. Set moduleMap[(url, moduleType)] to moduleScript, and run onComplete given moduleScript.
+            module_map.set(url, module_type.to_byte_string(), { ModuleMap::EntryType::ModuleScript, module_script });
+            on_complete->function()(module_script);
+        };
+
+        if (mime_type.has_value() && mime_type->is_javascript() && module_type == "javascript")
+            parse_script_ahead_of_time(module_map_realm.heap(), JS::Program::Type::Module, move(source_text), url.basename(), move(create_module_script));
+        else
+            create_module_script(move(source_text));
     };
 
     if (perform_fetch != nullptr) {
@@ -5,9 +5,12 @@
  */
 
 #include <LibJS/Runtime/ModuleRequest.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/ModuleScript.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -49,7 +52,10 @@ WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> JavaScriptModuleScript::cre
     script->set_error_to_rethrow(JS::js_null());
 
     // 7. Let result be ParseModule(source, realm, script).
-    auto result = JS::SourceTextModule::parse(source, realm, filename.view(), script);
+    auto result = [&] {
+        PhaseTimer phase_timer { Phase::JSParse };
+        return JS::SourceTextModule::parse(source, realm, filename.view(), script);
+    }();
 
     // 8. If result is a list of errors, then:
     if (result.is_error()) {
@@ -74,6 +80,8 @@ WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> JavaScriptModuleScript::cre
 // https://whatpr.org/html/9893/webappapis.html#run-a-module-script
 JS::Promise* JavaScriptModuleScript::run(PreventErrorReporting)
 {
+    PhaseTimer phase_timer { Phase::JSExecute };
+
     // 1. Let realm be the realm of script.
     auto& realm = this->realm();
 
@@ -108,6 +116,8 @@ JS::Promise* JavaScriptModuleScript::run(PreventErrorReporting)
         module_execution_context->script_or_module = GC::Ref<JS::Module> { *record };
         vm().push_execution_context(*module_execution_context);
 
+        relevant_agent(realm.global_object()).event_loop->did_enter_script(*this);
+
         // 2. Set evaluationPromise to record.Evaluate().
         auto elevation_promise_or_error = record->evaluate(vm());
 
@@ -28,8 +28,10 @@ GC::Ref<SharedResourceRequest> SharedResourceRequest::get_or_create(JS::Realm& r
     auto document = Bindings::principal_host_defined_environment_settings_object(realm).responsible_document();
     VERIFY(document);
     auto& shared_resource_requests = document->shared_resource_requests();
-    if (auto it = shared_resource_requests.find(url); it != shared_resource_requests.end())
+    if (auto it = shared_resource_requests.find(url); it != shared_resource_requests.end()) {
+        it->value->m_last_use_time = MonotonicTime::now_coarse();
         return *it->value;
+    }
     auto request = realm.create<SharedResourceRequest>(page, url, *document);
     shared_resource_requests.set(url, request);
     return request;
@@ -60,6 +62,7 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partially_available);
     }
     visitor.visit(m_image_data);
 }
@@ -87,25 +90,31 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
         //        https://github.com/whatwg/html/issues/9355
         response = response->unsafe_response();
 
-        auto process_body = GC::create_function(heap(), [this, request, response](ByteBuffer data) {
-            auto extracted_mime_type = response->header_list()->extract_mime_type();
-            auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence().bytes_as_string_view() : StringView {};
-            handle_successful_fetch(request->url(), mime_type, move(data));
-        });
-        auto process_body_error = GC::create_function(heap(), [this](JS::Value) {
-            handle_failed_fetch();
-        });
-
         // Check for failed fetch response
         if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
             handle_failed_fetch();
             return;
         }
 
-        response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
+        auto extracted_mime_type = response->header_list()->extract_mime_type();
+        auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence() : String {};
+
+        auto process_body_chunk = GC::create_function(heap(), [this, mime_type](ByteBuffer chunk) {
+            m_received_data.append(chunk);
+            decode_partially_received_image_if_needed(mime_type);
+        });
+        auto process_end_of_body = GC::create_function(heap(), [this, request, mime_type] {
+            handle_successful_fetch(request->url(), mime_type, move(m_received_data));
+        });
+        auto process_body_error = GC::create_function(heap(), [this](JS::Value) {
+            handle_failed_fetch();
+        });
+
+        response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
     m_state = State::Fetching;
+    m_last_partial_decode_time = MonotonicTime::now_coarse();
 
     auto fetch_controller = Fetch::Fetching::fetch(
         realm,
@@ -116,7 +125,7 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -135,6 +144,8 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partially_available)
+        callbacks.on_partially_available = GC::create_function(vm().heap(), move(on_partially_available));
 
     m_callbacks.append(move(callbacks));
 }
@@ -165,7 +176,10 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
                 .duration = static_cast<int>(frame.duration),
             });
         }
-        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+        if (result.streamed_animation_id.has_value())
+            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create_streamed(strong_this->m_document->realm(), move(frames), result.frame_count, result.loop_count, *result.streamed_animation_id, result.color_space).release_value_but_fixme_should_propagate_errors();
+        else
+            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
         strong_this->handle_successful_resource_load();
         return {};
     };
@@ -174,7 +188,63 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    // NOTE: Large animations are only decoded a few frames at a time, as keeping all of their frames around can take up
+    //       hundreds of megabytes.
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image_streaming_animation_frames(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+}
+
+// AD-HOC: While a large JPEG or PNG is still being downloaded, we decode what we have received so far every now and then,
+//         so that whatever part of the image has arrived can be shown until the whole image is available. Decoders that
+//         need all of the data to produce anything simply fail, and we keep waiting for the rest.
+void SharedResourceRequest::decode_partially_received_image_if_needed(StringView mime_type)
+{
+    static constexpr size_t minimum_new_data_size = 64 * KiB;
+    static constexpr auto minimum_time_between_decodes = AK::Duration::from_milliseconds(250);
+
+    if (mime_type != "image/jpeg"sv && mime_type != "image/png"sv)
+        return;
+    if (m_partial_decode_in_progress || m_state != State::Fetching)
+        return;
+    if (m_received_data.size() < m_partially_decoded_size + minimum_new_data_size)
+        return;
+
+    // NOTE: Images that arrive quickly are never decoded partially, as that would only take time away from decoding the
+    //       whole image.
+    auto now = MonotonicTime::now_coarse();
+    if (now - m_last_partial_decode_time < minimum_time_between_decodes)
+        return;
+
+    m_partial_decode_in_progress = true;
+    m_partially_decoded_size = m_received_data.size();
+
+    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+        strong_this->m_partial_decode_in_progress = false;
+        strong_this->m_last_partial_decode_time = MonotonicTime::now_coarse();
+
+        // NOTE: The complete image may have been decoded before this partial one was.
+        if (strong_this->m_state != State::Fetching || result.frames.is_empty() || !result.frames[0].bitmap)
+            return {};
+
+        Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+        frames.append(AnimatedBitmapDecodedImageData::Frame {
+            .bitmap = Gfx::ImmutableBitmap::create(*result.frames[0].bitmap, Gfx::AlphaType::Premultiplied, result.color_space),
+            .duration = 0,
+        });
+        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), 0, false).release_value_but_fixme_should_propagate_errors();
+
+        for (auto& callback : strong_this->m_callbacks) {
+            if (callback.on_partially_available)
+                callback.on_partially_available->function()();
+        }
+        return {};
+    };
+
+    auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
+        strong_this->m_partial_decode_in_progress = false;
+        strong_this->m_last_partial_decode_time = MonotonicTime::now_coarse();
+    };
+
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(m_received_data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
 }
 
 void SharedResourceRequest::handle_failed_fetch()
@@ -195,6 +265,8 @@ void SharedResourceRequest::handle_successful_resource_load()
             callback.on_finish->function()();
     }
     m_callbacks.clear();
+
+    m_document->did_finish_shared_resource_request(*this);
 }
 
 bool SharedResourceRequest::needs_fetching() const
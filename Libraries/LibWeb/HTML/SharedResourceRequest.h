@@ -8,6 +8,7 @@
 
 #include <AK/Error.h>
 #include <AK/OwnPtr.h>
+#include <AK/Time.h>
 #include <LibGC/Function.h>
 #include <LibGC/Root.h>
 #include <LibGfx/Size.h>
@@ -34,10 +35,13 @@ public:
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_available = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
+    bool is_finished() const { return m_state == State::Finished; }
+
+    MonotonicTime last_use_time() const { return m_last_use_time; }
 
 private:
     explicit SharedResourceRequest(GC::Ref<Page>, URL::URL, GC::Ref<DOM::Document>);
@@ -46,6 +50,7 @@ private:
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
+    void decode_partially_received_image_if_needed(StringView mime_type);
     void handle_failed_fetch();
     void handle_successful_resource_load();
 
@@ -63,6 +68,7 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partially_available;
     };
     Vector<Callbacks> m_callbacks;
 
@@ -70,6 +76,13 @@ private:
     GC::Ptr<DecodedImageData> m_image_data;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
 
+    ByteBuffer m_received_data;
+    size_t m_partially_decoded_size { 0 };
+    MonotonicTime m_last_partial_decode_time { MonotonicTime::now_coarse() };
+    bool m_partial_decode_in_progress { false };
+
+    MonotonicTime m_last_use_time { MonotonicTime::now_coarse() };
+
     GC::Ptr<DOM::Document> m_document;
 };
 
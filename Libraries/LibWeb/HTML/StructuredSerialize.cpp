@@ -38,6 +38,7 @@
 #include <LibWeb/Bindings/ImageBitmapPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MessagePortPrototype.h>
+#include <LibWeb/Bindings/OffscreenCanvasPrototype.h>
 #include <LibWeb/Bindings/ReadableStreamPrototype.h>
 #include <LibWeb/Bindings/Serializable.h>
 #include <LibWeb/Bindings/Transferable.h>
@@ -57,6 +58,7 @@
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/Streams/ReadableStream.h>
@@ -275,29 +277,7 @@ public:
         auto deep = false;
 
         // 4. If value is undefined, null, a Boolean, a Number, a BigInt, or a String, then return { [[Type]]: "primitive", [[Value]]: value }.
-        bool return_primitive_type = true;
-
-        if (value.is_undefined()) {
-            serialized.encode(ValueTag::UndefinedPrimitive);
-        } else if (value.is_null()) {
-            serialized.encode(ValueTag::NullPrimitive);
-        } else if (value.is_boolean()) {
-            serialized.encode(ValueTag::BooleanPrimitive);
-            serialized.encode(value.as_bool());
-        } else if (value.is_number()) {
-            serialized.encode(ValueTag::NumberPrimitive);
-            serialized.encode(value.as_double());
-        } else if (value.is_bigint()) {
-            serialized.encode(ValueTag::BigIntPrimitive);
-            serialized.encode(MUST(value.as_bigint().big_integer().to_base(10)));
-        } else if (value.is_string()) {
-            serialized.encode(ValueTag::StringPrimitive);
-            serialized.encode(value.as_string().utf8_string());
-        } else {
-            return_primitive_type = false;
-        }
-
-        if (return_primitive_type)
+        if (serialize_primitive(serialized, value))
             return serialized.take_buffer().take_data();
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
@@ -488,10 +468,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize_contained_value(serialized, copied_value));
                 }
             }
 
@@ -512,10 +490,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize_contained_value(serialized, copied_value));
                 }
             }
 
@@ -539,11 +515,10 @@ public:
                         auto input_value = TRY(object.internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
+                        // NOTE: The key is written first, so that outputValue can be written straight after it.
                         serialized.encode(key.as_string().utf8_string());
-                        serialized.append(move(output_value));
+                        TRY(serialize_contained_value(serialized, input_value));
 
                         ++property_count;
                     }
@@ -561,6 +536,44 @@ public:
     }
 
 private:
+    static bool serialize_primitive(TransferDataEncoder& serialized, JS::Value value)
+    {
+        if (value.is_undefined()) {
+            serialized.encode(ValueTag::UndefinedPrimitive);
+        } else if (value.is_null()) {
+            serialized.encode(ValueTag::NullPrimitive);
+        } else if (value.is_boolean()) {
+            serialized.encode(ValueTag::BooleanPrimitive);
+            serialized.encode(value.as_bool());
+        } else if (value.is_number()) {
+            serialized.encode(ValueTag::NumberPrimitive);
+            serialized.encode(value.as_double());
+        } else if (value.is_bigint()) {
+            serialized.encode(ValueTag::BigIntPrimitive);
+            serialized.encode(MUST(value.as_bigint().big_integer().to_base(10)));
+        } else if (value.is_string()) {
+            serialized.encode(ValueTag::StringPrimitive);
+            serialized.encode(value.as_string().utf8_string());
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+    // Runs StructuredSerializeInternal on a value contained in the value being serialized, and appends the result.
+    WebIDL::ExceptionOr<void> serialize_contained_value(TransferDataEncoder& serialized, JS::Value value)
+    {
+        // OPTIMIZATION: A primitive can never be in memory, so it's written straight into the containing record instead
+        //               of into a record of its own that is then copied over. Most values in a typical message are
+        //               primitives, so this saves an allocation and a copy for each of them.
+        if (serialize_primitive(serialized, value))
+            return {};
+
+        serialized.append(TRY(structured_serialize_internal(m_vm, value, m_for_storage, m_memory)));
+        return {};
+    }
+
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
     u32 m_next_id { 0 };
@@ -1117,6 +1130,8 @@ static bool is_transferable_interface_exposed_on_target_realm(TransferType name,
         return intrinsics.is_interface_exposed<Bindings::TransformStreamPrototype>(realm);
     case TransferType::ImageBitmap:
         return intrinsics.is_interface_exposed<Bindings::ImageBitmapPrototype>(realm);
+    case TransferType::OffscreenCanvas:
+        return intrinsics.is_interface_exposed<Bindings::OffscreenCanvasPrototype>(realm);
     case TransferType::Unknown:
         dbgln("Unknown interface type for transfer: {}", to_underlying(name));
         break;
@@ -1154,6 +1169,11 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(image_bitmap->transfer_receiving_steps(decoder));
         return image_bitmap;
     }
+    case TransferType::OffscreenCanvas: {
+        auto offscreen_canvas = OffscreenCanvas::create(target_realm, 0, 0);
+        TRY(offscreen_canvas->transfer_receiving_steps(decoder));
+        return offscreen_canvas;
+    }
     case TransferType::ArrayBuffer:
     case TransferType::ResizableArrayBuffer:
     case TransferType::Unknown:
@@ -1347,6 +1367,24 @@ WebIDL::ExceptionOr<ByteBuffer> TransferDataDecoder::decode_buffer(JS::Realm& re
 
 namespace IPC {
 
+// OPTIMIZATION: Serialization records are sent as a single payload, rather than as a vector that is encoded one byte at
+//               a time. Large ones are sent in shared memory.
+static ErrorOr<void> encode_serialization_record(Encoder& encoder, Web::HTML::SerializationRecord const& record)
+{
+    return encoder.encode_payload(record.span());
+}
+
+static ErrorOr<Web::HTML::SerializationRecord> decode_serialization_record(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode_size());
+
+    Web::HTML::SerializationRecord record;
+    TRY(record.try_resize(size));
+    TRY(decoder.decode_payload_into(record.span()));
+
+    return record;
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, Web::HTML::TransferDataEncoder const& data_holder)
 {
@@ -1360,7 +1398,7 @@ ErrorOr<void> encode(Encoder& encoder, Web::HTML::TransferDataEncoder const& dat
         files.unchecked_append(IPC::File::adopt_fd(fd));
     }
 
-    TRY(encoder.encode(data_holder.buffer().data()));
+    TRY(encode_serialization_record(encoder, data_holder.buffer().data()));
     TRY(encoder.encode(files));
     return {};
 }
@@ -1368,7 +1406,7 @@ ErrorOr<void> encode(Encoder& encoder, Web::HTML::TransferDataEncoder const& dat
 template<>
 ErrorOr<Web::HTML::TransferDataEncoder> decode(Decoder& decoder)
 {
-    auto data = TRY(decoder.decode<Web::HTML::SerializationRecord>());
+    auto data = TRY(decode_serialization_record(decoder));
     auto files = TRY(decoder.decode<Vector<IPC::File>>());
 
     // FIXME: The churn between IPC::File and IPC::AutoCloseFileDescriptor is pretty awkward, we should find a way to
@@ -1388,7 +1426,7 @@ ErrorOr<Web::HTML::TransferDataEncoder> decode(Decoder& decoder)
 template<>
 ErrorOr<void> encode(Encoder& encoder, Web::HTML::SerializedTransferRecord const& record)
 {
-    TRY(encoder.encode(record.serialized));
+    TRY(encode_serialization_record(encoder, record.serialized));
     TRY(encoder.encode(record.transfer_data_holders));
     return {};
 }
@@ -1396,7 +1434,7 @@ ErrorOr<void> encode(Encoder& encoder, Web::HTML::SerializedTransferRecord const
 template<>
 ErrorOr<Web::HTML::SerializedTransferRecord> decode(Decoder& decoder)
 {
-    auto serialized = TRY(decoder.decode<Web::HTML::SerializationRecord>());
+    auto serialized = TRY(decode_serialization_record(decoder));
     auto transfer_data_holders = TRY(decoder.decode<Vector<Web::HTML::TransferDataEncoder>>());
 
     return Web::HTML::SerializedTransferRecord { move(serialized), move(transfer_data_holders) };
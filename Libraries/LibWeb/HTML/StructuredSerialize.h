@@ -31,6 +31,12 @@ public:
         MUST(m_encoder.encode(value));
     }
 
+    // Encodes bytes the same way as a ByteBuffer, to be read back with TransferDataDecoder::decode_buffer().
+    void encode_buffer(ReadonlyBytes bytes)
+    {
+        MUST(m_encoder.encode_payload(bytes));
+    }
+
     void append(SerializationRecord&&);
     void extend(Vector<TransferDataEncoder>);
 
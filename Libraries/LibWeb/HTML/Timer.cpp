@@ -13,16 +13,17 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(Timer);
 
-GC::Ref<Timer> Timer::create(JS::Object& window_or_worker_global_scope, i32 milliseconds, Function<void()> callback, i32 id)
+GC::Ref<Timer> Timer::create(JS::Object& window_or_worker_global_scope, i32 milliseconds, Function<void()> callback, i32 id, HighResolutionTime::DOMHighResTimeStamp deadline)
 {
     auto heap_function_callback = GC::create_function(window_or_worker_global_scope.heap(), move(callback));
-    return window_or_worker_global_scope.heap().allocate<Timer>(window_or_worker_global_scope, milliseconds, heap_function_callback, id);
+    return window_or_worker_global_scope.heap().allocate<Timer>(window_or_worker_global_scope, milliseconds, heap_function_callback, id, deadline);
 }
 
-Timer::Timer(JS::Object& window_or_worker_global_scope, i32 milliseconds, GC::Ref<GC::Function<void()>> callback, i32 id)
+Timer::Timer(JS::Object& window_or_worker_global_scope, i32 milliseconds, GC::Ref<GC::Function<void()>> callback, i32 id, HighResolutionTime::DOMHighResTimeStamp deadline)
     : m_window_or_worker_global_scope(window_or_worker_global_scope)
     , m_callback(move(callback))
     , m_id(id)
+    , m_deadline(deadline)
 {
     m_timer = Core::Timer::create_single_shot(milliseconds, [this] {
         m_callback->function()();
@@ -51,4 +52,9 @@ void Timer::stop()
     m_timer->stop();
 }
 
+bool Timer::is_active() const
+{
+    return m_timer->is_active();
+}
+
 }
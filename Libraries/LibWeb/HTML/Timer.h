@@ -14,6 +14,7 @@
 #include <LibGC/Ptr.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 
 namespace Web::HTML {
 
@@ -22,14 +23,19 @@ class Timer final : public JS::Cell {
     GC_DECLARE_ALLOCATOR(Timer);
 
 public:
-    static GC::Ref<Timer> create(JS::Object&, i32 milliseconds, Function<void()> callback, i32 id);
+    static GC::Ref<Timer> create(JS::Object&, i32 milliseconds, Function<void()> callback, i32 id, HighResolutionTime::DOMHighResTimeStamp deadline);
     virtual ~Timer() override;
 
     void start();
     void stop();
 
+    bool is_active() const;
+
+    // The time at which the timer is due, relative to the time origin of its global.
+    HighResolutionTime::DOMHighResTimeStamp deadline() const { return m_deadline; }
+
 private:
-    Timer(JS::Object& window, i32 milliseconds, GC::Ref<GC::Function<void()>> callback, i32 id);
+    Timer(JS::Object& window, i32 milliseconds, GC::Ref<GC::Function<void()>> callback, i32 id, HighResolutionTime::DOMHighResTimeStamp deadline);
 
     virtual void visit_edges(Cell::Visitor&) override;
 
@@ -37,6 +43,7 @@ private:
     GC::Ref<JS::Object> m_window_or_worker_global_scope;
     GC::Ref<GC::Function<void()>> m_callback;
     i32 m_id { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_deadline { 0 };
 };
 
 }
@@ -45,6 +45,7 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
         visitor.visit(m_emulated_position_data.get<GC::Ref<Geolocation::GeolocationCoordinates>>());
     visitor.visit(m_session_history_entries);
     visitor.visit(m_session_history_traversal_queue);
+    visitor.visit(m_documents_in_back_forward_cache);
     visitor.visit(m_storage_shed);
 }
 
@@ -870,6 +871,8 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
 
     page().client().page_did_change_url(current_session_history_entry()->url());
 
+    evict_documents_from_back_forward_cache_if_needed();
+
     // 21. Return "applied".
     return HistoryStepResult::Applied;
 }
@@ -1108,6 +1111,61 @@ void TraversableNavigable::clear_the_forward_session_history()
     }
 }
 
+// NOTE: Each document in the back/forward cache keeps everything it has loaded in memory, so only a few are kept.
+static constexpr size_t maximum_documents_in_back_forward_cache = 4;
+
+void TraversableNavigable::did_keep_document_in_back_forward_cache(DOM::Document& document)
+{
+    m_documents_in_back_forward_cache.remove_first_matching([&](auto const& cached_document) { return cached_document == &document; });
+    m_documents_in_back_forward_cache.append(document);
+}
+
+void TraversableNavigable::evict_documents_from_back_forward_cache_if_needed()
+{
+    if (m_documents_in_back_forward_cache.is_empty())
+        return;
+
+    auto entry_with_document = [&](DOM::Document const& document) -> GC::Ptr<SessionHistoryEntry> {
+        for (auto& entry : m_session_history_entries) {
+            if (entry->document() == &document)
+                return entry;
+        }
+        return nullptr;
+    };
+
+    // NOTE: Documents that have become active again are no longer in the cache.
+    m_documents_in_back_forward_cache.remove_all_matching([](auto const& document) {
+        return document->is_fully_active() || document->has_been_destroyed();
+    });
+
+    // Documents whose session history entry has been removed (or that were replaced in it by a reload) can never be
+    // traversed back to, so they're evicted along with the least recently unloaded ones that don't fit in the cache.
+    Vector<GC::Ref<DOM::Document>> documents_to_evict;
+    size_t documents_to_keep = 0;
+    for (size_t i = m_documents_in_back_forward_cache.size(); i > 0; --i) {
+        auto& document = m_documents_in_back_forward_cache[i - 1];
+        if (documents_to_keep < maximum_documents_in_back_forward_cache && entry_with_document(document)) {
+            ++documents_to_keep;
+            continue;
+        }
+        documents_to_evict.append(document);
+    }
+
+    m_documents_in_back_forward_cache.remove_all_matching([&](auto const& document) {
+        return documents_to_evict.contains_slow(document);
+    });
+
+    for (auto& document : documents_to_evict) {
+        // NOTE: Traversing to the entry will load the document again from now on.
+        if (auto entry = entry_with_document(document))
+            entry->document_state()->set_document(nullptr);
+
+        // NOTE: We're already in a task on the document's event loop, and since the document isn't fully active, a task
+        //       queued to destroy it would never run. So it's destroyed right away instead.
+        document->destroy();
+    }
+}
+
 bool TraversableNavigable::can_go_forward() const
 {
     auto step = current_session_history_step();
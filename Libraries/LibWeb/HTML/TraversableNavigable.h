@@ -80,6 +80,8 @@ public:
 
     Vector<int> get_all_used_history_steps() const;
     void clear_the_forward_session_history();
+
+    void did_keep_document_in_back_forward_cache(DOM::Document&);
     void traverse_the_history_by_delta(int delta, GC::Ptr<DOM::Document> source_document = {});
 
     void close_top_level_traversable();
@@ -145,6 +147,8 @@ private:
 
     [[nodiscard]] bool can_go_forward() const;
 
+    void evict_documents_from_back_forward_cache_if_needed();
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-current-session-history-step
     int m_current_session_history_step { 0 };
 
@@ -168,6 +172,10 @@ private:
 
     GC::Ref<SessionHistoryTraversalQueue> m_session_history_traversal_queue;
 
+    // NOTE: Documents that were kept alive in their session history entry after being unloaded, so that traversing back
+    //       to them doesn't have to load them again. The most recently unloaded one comes last.
+    Vector<GC::Ref<DOM::Document>> m_documents_in_back_forward_cache;
+
     String m_window_handle;
 
     // https://w3c.github.io/geolocation/#dfn-emulated-position-data
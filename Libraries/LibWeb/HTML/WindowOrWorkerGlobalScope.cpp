@@ -17,6 +17,7 @@
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/FetchMethod.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/ErrorEvent.h>
@@ -25,6 +26,7 @@
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scheduler.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
@@ -33,8 +35,10 @@
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/SupportedPerformanceTypes.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
 #include <LibWeb/PerformanceTimeline/EventNames.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
@@ -81,6 +85,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_registered_event_sources);
     visitor.visit(m_crypto);
     visitor.visit(m_cache_storage);
+    visitor.visit(m_scheduler);
     visitor.visit(m_resource_timing_secondary_buffer);
 }
 
@@ -335,6 +340,23 @@ void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
     m_timers.clear();
 }
 
+Optional<HighResolutionTime::DOMHighResTimeStamp> WindowOrWorkerGlobalScopeMixin::earliest_active_timer_deadline() const
+{
+    Optional<HighResolutionTime::DOMHighResTimeStamp> earliest_deadline;
+
+    for (auto const& it : m_timers) {
+        // NOTE: Timers started by "run steps after a timeout" stay in the map after they fired, as we don't implement
+        //       step 5.5 of that algorithm yet.
+        if (!it.value->is_active())
+            continue;
+
+        if (!earliest_deadline.has_value() || it.value->deadline() < *earliest_deadline)
+            earliest_deadline = it.value->deadline();
+    }
+
+    return earliest_deadline;
+}
+
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#timer-initialisation-steps
 // With no active script fix from https://github.com/whatwg/html/pull/9712
 i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler handler, i32 timeout, GC::RootVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id)
@@ -877,6 +899,18 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout(i32 timeout, Func
     return run_steps_after_a_timeout_impl(timeout, move(completion_step));
 }
 
+// Timers of hidden documents fire on multiples of this interval of the monotonic clock. As that clock is shared by
+// every process, this lines up the timers of all hidden pages, not just the ones in this process.
+static constexpr i64 hidden_document_timer_alignment_in_milliseconds = 1000;
+
+static i32 align_timeout_to_hidden_document_wakeup_boundary(i32 timeout)
+{
+    auto now = MonotonicTime::now().milliseconds();
+    auto fire_time = now + timeout;
+    auto aligned_fire_time = ceil_div(fire_time, hidden_document_timer_alignment_in_milliseconds) * hidden_document_timer_alignment_in_milliseconds;
+    return static_cast<i32>(min(aligned_fire_time - now, static_cast<i64>(NumericLimits<i32>::max())));
+}
+
 void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout, Function<void()> completion_step, Optional<i32> timer_key)
 {
     // 1. Assert: if timerKey is given, then the caller of this algorithm is the timer initialization steps. (Other specifications must not pass timerKey.)
@@ -886,17 +920,26 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout,
     if (!timer_key.has_value())
         timer_key = m_timer_id_allocator.allocate();
 
-    // FIXME: 3. Let startTime be the current high resolution time given global.
-    auto timer = Timer::create(this_impl(), timeout, move(completion_step), timer_key.value());
+    // NOTE: We wait for the further implementation-defined length of time from step 5.3 right away, by adding it to the
+    //       timeout of the timer.
+    // OPTIMIZATION: The timers of documents that aren't visible are delayed until the next shared wakeup boundary, so
+    //               that the timers of all hidden pages fire together, instead of each waking the process up on its own.
+    if (auto* window = as_if<Window>(this_impl()); window && window->associated_document().hidden())
+        timeout = align_timeout_to_hidden_document_wakeup_boundary(timeout);
+
+    // 3. Let startTime be the current high resolution time given global.
+    auto start_time = HighResolutionTime::current_high_resolution_time(this_impl());
 
-    // FIXME: 4. Set global's map of active timers[timerKey] to startTime plus milliseconds.
+    // 4. Set global's map of active timers[timerKey] to startTime plus milliseconds.
+    auto timer = Timer::create(this_impl(), timeout, move(completion_step), timer_key.value(), start_time + timeout);
     m_timers.set(timer_key.value(), timer);
 
     // FIXME: 5. Run the following steps in parallel:
     // FIXME:    1. If global is a Window object, wait until global's associated Document has been fully active for a further milliseconds milliseconds (not necessarily consecutively).
     //              Otherwise, global is a WorkerGlobalScope object; wait until milliseconds milliseconds have passed with the worker not suspended (not necessarily consecutively).
     // FIXME:    2. Wait until any invocations of this algorithm that had the same global and orderingIdentifier, that started before this one, and whose milliseconds is equal to or less than this one's, have completed.
-    // FIXME:    3. Optionally, wait a further implementation-defined length of time.
+    //          3. Optionally, wait a further implementation-defined length of time.
+    //             NOTE: This was done above.
     // FIXME:    4. Perform completionSteps.
     // FIXME:    5. If timerKey is a non-numeric value, remove global's map of active timers[timerKey].
 
@@ -1122,4 +1165,16 @@ GC::Ref<ServiceWorker::CacheStorage> WindowOrWorkerGlobalScopeMixin::caches()
     return GC::Ref { *m_cache_storage };
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    auto& platform_object = this_impl();
+    auto& realm = platform_object.realm();
+
+    // NOTE: Each global has its own scheduler, created lazily since most pages never use it.
+    if (!m_scheduler)
+        m_scheduler = Scheduler::create(realm);
+    return GC::Ref { *m_scheduler };
+}
+
 }
@@ -16,6 +16,7 @@
 #include <LibWeb/Fetch/Request.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
 #include <LibWeb/PerformanceTimeline/PerformanceEntryTuple.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
@@ -48,6 +49,9 @@ public:
     void clear_interval(i32);
     void clear_map_of_active_timers();
 
+    // The earliest of the values of the map of active timers that are still waiting to fire, if any.
+    Optional<HighResolutionTime::DOMHighResTimeStamp> earliest_active_timer_deadline() const;
+
     enum class CheckIfPerformanceBufferIsFull {
         No,
         Yes,
@@ -103,6 +107,8 @@ public:
 
     [[nodiscard]] GC::Ref<ServiceWorker::CacheStorage> caches();
 
+    [[nodiscard]] GC::Ref<Scheduler> scheduler();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -151,6 +157,8 @@ private:
 
     GC::Ptr<ServiceWorker::CacheStorage> m_cache_storage;
 
+    GC::Ptr<Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
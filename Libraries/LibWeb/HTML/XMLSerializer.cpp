@@ -245,30 +245,29 @@ static Optional<FlyString> record_namespace_information(DOM::Element const& elem
 
     // 2. Main: For each attribute attr in element's attributes, in the order they are specified in the element's attribute list:
     for (size_t attribute_index = 0; attribute_index < element.attributes()->length(); ++attribute_index) {
-        auto const* attribute = element.attributes()->item(attribute_index);
-        VERIFY(attribute);
+        auto const& attribute = element.attributes()->entry_at(attribute_index);
 
         // 1. Let attribute namespace be the value of attr's namespaceURI value.
-        auto const& attribute_namespace = attribute->namespace_uri();
+        auto const& attribute_namespace = attribute.namespace_uri();
 
         // 2. Let attribute prefix be the value of attr's prefix.
-        auto const& attribute_prefix = attribute->prefix();
+        auto const& attribute_prefix = attribute.prefix();
 
         // 3. If the attribute namespace is the XMLNS namespace, then:
         if (attribute_namespace == Namespace::XMLNS) {
             // 1. If attribute prefix is null, then attr is a default namespace declaration. Set the default namespace attr value to attr's value and stop running these steps,
             //    returning to Main to visit the next attribute.
             if (!attribute_prefix.has_value()) {
-                default_namespace_attribute_value = attribute->value();
+                default_namespace_attribute_value = attribute.value();
                 continue;
             }
 
             // 2. Otherwise, the attribute prefix is not null and attr is a namespace prefix definition. Run the following steps:
             // 1. Let prefix definition be the value of attr's localName.
-            auto const& prefix_definition = attribute->local_name();
+            auto const& prefix_definition = attribute.local_name();
 
             // 2. Let namespace definition be the value of attr's value.
-            Optional<FlyString> namespace_definition = attribute->value();
+            Optional<FlyString> namespace_definition = attribute.value();
 
             // 3. If namespace definition is the XML namespace, then stop running these steps, and return to Main to visit the next attribute.
             if (namespace_definition == Namespace::XML)
@@ -342,14 +341,13 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
 
     // 3. Loop: For each attribute attr in element's attributes, in the order they are specified in the element's attribute list:
     for (size_t attribute_index = 0; attribute_index < element.attributes()->length(); ++attribute_index) {
-        auto const* attribute = element.attributes()->item(attribute_index);
-        VERIFY(attribute);
+        auto const& attribute = element.attributes()->entry_at(attribute_index);
 
         // 1. If the require well-formed flag is set (its value is true), and the localname set contains a tuple whose values match those of a new tuple consisting of attr's namespaceURI attribute and localName attribute,
         //      then throw an exception; the serialization of this attr would fail to produce a well-formed element serialization.
         if (require_well_formed == RequireWellFormed::Yes) {
             auto local_name_set_iterator = local_name_set.find_if([&attribute](LocalNameSetEntry const& entry) {
-                return entry.namespace_uri == attribute->namespace_uri() && entry.local_name == attribute->local_name();
+                return entry.namespace_uri == attribute.namespace_uri() && entry.local_name == attribute.local_name();
             });
 
             if (local_name_set_iterator != local_name_set.end())
@@ -358,14 +356,14 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
 
         // 2. Create a new tuple consisting of attr's namespaceURI attribute and localName attribute, and add it to the localname set.
         LocalNameSetEntry new_local_name_set_entry {
-            .namespace_uri = attribute->namespace_uri(),
-            .local_name = attribute->local_name(),
+            .namespace_uri = attribute.namespace_uri(),
+            .local_name = attribute.local_name(),
         };
 
         local_name_set.append(move(new_local_name_set_entry));
 
         // 3. Let attribute namespace be the value of attr's namespaceURI value.
-        auto const& attribute_namespace = attribute->namespace_uri();
+        auto const& attribute_namespace = attribute.namespace_uri();
 
         // 4. Let candidate prefix be null.
         Optional<FlyString> candidate_prefix;
@@ -373,55 +371,55 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
         // 5. If attribute namespace is not null, then run these sub-steps:
         if (attribute_namespace.has_value()) {
             // 1. Let candidate prefix be the result of retrieving a preferred prefix string from map given namespace attribute namespace with preferred prefix being attr's prefix value.
-            candidate_prefix = retrieve_a_preferred_prefix_string(attribute->prefix(), namespace_prefix_map, attribute->namespace_uri());
+            candidate_prefix = retrieve_a_preferred_prefix_string(attribute.prefix(), namespace_prefix_map, attribute.namespace_uri());
 
             // 2. If the value of attribute namespace is the XMLNS namespace, then run these steps:
             if (attribute_namespace == Namespace::XMLNS) {
                 // 1. If any of the following are true, then stop running these steps and goto Loop to visit the next attribute:
                 // - the attr's value is the XML namespace;
-                if (attribute->value() == Namespace::XML)
+                if (attribute.value() == Namespace::XML)
                     continue;
 
                 // - the attr's prefix is null and the ignore namespace definition attribute flag is true (the Element's default namespace attribute should be skipped);
-                if (!attribute->prefix().has_value() && ignore_namespace_definition_attribute)
+                if (!attribute.prefix().has_value() && ignore_namespace_definition_attribute)
                     continue;
 
                 // - the attr's prefix is not null and either
-                if (attribute->prefix().has_value()) {
+                if (attribute.prefix().has_value()) {
                     // - the attr's localName is not a key contained in the local prefixes map, or
-                    auto name_in_local_prefix_map_iterator = local_prefixes_map.find(attribute->local_name());
+                    auto name_in_local_prefix_map_iterator = local_prefixes_map.find(attribute.local_name());
                     if (name_in_local_prefix_map_iterator == local_prefixes_map.end())
                         continue;
 
                     // - the attr's localName is present in the local prefixes map but the value of the key does not match attr's value
-                    if (name_in_local_prefix_map_iterator->value != attribute->value())
+                    if (name_in_local_prefix_map_iterator->value != attribute.value())
                         continue;
                 }
 
                 // and furthermore that the attr's localName (as the prefix to find) is found in the namespace prefix map given the namespace consisting of the attr's value
                 // (the current namespace prefix definition was exactly defined previously--on an ancestor element not the current element whose attributes are being processed).
-                if (prefix_is_in_prefix_map(attribute->local_name(), namespace_prefix_map, attribute->value()))
+                if (prefix_is_in_prefix_map(attribute.local_name(), namespace_prefix_map, attribute.value()))
                     continue;
 
                 // 2. If the require well-formed flag is set (its value is true), and the value of attr's value attribute matches the XMLNS namespace,
                 //    then throw an exception; the serialization of this attribute would produce invalid XML because the XMLNS namespace is reserved and cannot be applied as an element's namespace via XML parsing.
-                if (require_well_formed == RequireWellFormed::Yes && attribute->value() == Namespace::XMLNS)
+                if (require_well_formed == RequireWellFormed::Yes && attribute.value() == Namespace::XMLNS)
                     return WebIDL::InvalidStateError::create(realm, "The XMLNS namespace cannot be used as an element's namespace"_string);
 
                 // 3. If the require well-formed flag is set (its value is true), and the value of attr's value attribute is the empty string,
                 //    then throw an exception; namespace prefix declarations cannot be used to undeclare a namespace (use a default namespace declaration instead).
-                if (require_well_formed == RequireWellFormed::Yes && attribute->value().is_empty())
+                if (require_well_formed == RequireWellFormed::Yes && attribute.value().is_empty())
                     return WebIDL::InvalidStateError::create(realm, "Attribute's value is empty"_string);
 
                 // 4. [If] the attr's prefix matches the string "xmlns", then let candidate prefix be the string "xmlns".
-                if (attribute->prefix() == "xmlns"sv)
+                if (attribute.prefix() == "xmlns"sv)
                     candidate_prefix = "xmlns"_fly_string;
             }
 
             // 3. Otherwise, the attribute namespace in not the XMLNS namespace. Run these steps:
             else {
                 // 1. Let candidate prefix be the result of generating a prefix providing map, attribute namespace, and prefix index as input.
-                candidate_prefix = generate_a_prefix(namespace_prefix_map, attribute->namespace_uri(), prefix_index);
+                candidate_prefix = generate_a_prefix(namespace_prefix_map, attribute.namespace_uri(), prefix_index);
 
                 // 2. Append the following to result, in the order listed:
                 // 1. " " (U+0020 SPACE);
@@ -436,7 +434,7 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
                 result.append("=\""sv);
 
                 // 5. The result of serializing an attribute value given attribute namespace and the require well-formed flag as input
-                result.append(TRY(serialize_an_attribute_value(attribute->namespace_uri(), require_well_formed)));
+                result.append(TRY(serialize_an_attribute_value(attribute.namespace_uri(), require_well_formed)));
 
                 // 6. """ (U+0022 QUOTATION MARK).
                 result.append('"');
@@ -453,24 +451,24 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
         // 8. If the require well-formed flag is set (its value is true), and this attr's localName attribute contains the character ":" (U+003A COLON)
         //    or does not match the XML Name production or equals "xmlns" and attribute namespace is null, then throw an exception; the serialization of this attr would not be a well-formed attribute.
         if (require_well_formed == RequireWellFormed::Yes) {
-            if (attribute->local_name().bytes_as_string_view().contains(':'))
+            if (attribute.local_name().bytes_as_string_view().contains(':'))
                 return WebIDL::InvalidStateError::create(realm, "Attribute's local name contains a colon"_string);
 
             // FIXME: Check attribute's local name against the XML Name production.
 
-            if (attribute->local_name() == "xmlns"sv && !attribute->namespace_uri().has_value())
+            if (attribute.local_name() == "xmlns"sv && !attribute.namespace_uri().has_value())
                 return WebIDL::InvalidStateError::create(realm, "Attribute's local name is 'xmlns' and the attribute has no namespace"_string);
         }
 
         // 9. Append the following strings to result, in the order listed:
         // 1. The value of attr's localName;
-        result.append(attribute->local_name());
+        result.append(attribute.local_name());
 
         // 2. "="" (U+003D EQUALS SIGN, U+0022 QUOTATION MARK);
         result.append("=\""sv);
 
         // 3. The result of serializing an attribute value given attr's value attribute and the require well-formed flag as input;
-        result.append(TRY(serialize_an_attribute_value(attribute->value(), require_well_formed)));
+        result.append(TRY(serialize_an_attribute_value(attribute.value(), require_well_formed)));
 
         // 4. """ (U+0022 QUOTATION MARK).
         result.append('"');
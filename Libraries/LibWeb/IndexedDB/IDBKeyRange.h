@@ -48,9 +48,32 @@ public:
 
     bool is_unbound() const { return m_lower_bound == nullptr && m_upper_bound == nullptr; }
     bool is_in_range(GC::Ref<Key>) const;
+    bool is_below_lower_bound(GC::Ref<Key>) const;
+    bool is_above_upper_bound(GC::Ref<Key>) const;
     GC::Ptr<Key> lower_key() const { return m_lower_bound; }
     GC::Ptr<Key> upper_key() const { return m_upper_bound; }
 
+    // NOTE: The records in a list of records that is sorted by key are all below the range's lower bound up to some
+    //       point, so this finds the first one that might be in range with a binary search. Everything after it is in
+    //       range until the first record that is above the range's upper bound.
+    template<typename RecordType>
+    size_t index_of_first_record_not_below_lower_bound(ReadonlySpan<RecordType> records) const
+    {
+        if (!m_lower_bound)
+            return 0;
+
+        size_t low = 0;
+        size_t high = records.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (is_below_lower_bound(records[middle].key))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+
 protected:
     explicit IDBKeyRange(JS::Realm&, GC::Ptr<Key> lower_bound, GC::Ptr<Key> upper_bound, LowerOpen lower_open, UpperOpen upper_open);
     virtual void initialize(JS::Realm&) override;
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
+#include <AK/BinarySearch.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -51,11 +51,11 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
+    auto const* record = binary_search(m_records, key, nullptr, [](GC::Ref<Key> needle, IndexRecord const& record) {
+        return Key::compare_two_keys(needle, record.key);
     });
 
-    return index != m_records.end();
+    return record != nullptr;
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +63,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,20 +73,23 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto index = range->index_of_first_record_not_below_lower_bound(records());
+    if (index >= m_records.size() || range->is_above_upper_bound(m_records[index].key))
+        return {};
+    return m_records[index];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    for (auto index = range->index_of_first_record_not_below_lower_bound(this->records()); index < m_records.size(); ++index) {
         if (count.has_value() && records.size() >= *count)
             break;
+
+        auto const& record = m_records[index];
+        if (range->is_above_upper_bound(record.key))
+            break;
+        records.append(record);
     }
 
     return records;
@@ -101,25 +98,35 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
     u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
+    for (auto index = range->index_of_first_record_not_below_lower_bound(records()); index < m_records.size(); ++index) {
+        if (range->is_above_upper_bound(m_records[index].key))
+            break;
+        ++count;
     }
     return count;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
+    auto is_after_record = [&](IndexRecord const& other) {
+        auto key_comparison = Key::compare_two_keys(other.key, record.key);
         if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+            return key_comparison > 0;
+
+        return Key::compare_two_keys(other.value, record.value) > 0;
+    };
+
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (is_after_record(m_records[middle]))
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    m_records.insert(low, record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
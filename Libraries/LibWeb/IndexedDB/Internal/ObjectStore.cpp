@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
+#include <AK/BinarySearch.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -41,47 +41,65 @@ void ObjectStore::visit_edges(Visitor& visitor)
     }
 }
 
+// NOTE: The records are always kept sorted by key, so all the records in a range are next to each other, and the first
+//       one can be found with a binary search rather than by looking at every record in the object store.
+static size_t index_of_first_record_after_range(ReadonlySpan<Record> records, IDBKeyRange const& range, size_t start)
+{
+    auto end = start;
+    while (end < records.size() && !range.is_above_upper_bound(records[end].key))
+        ++end;
+    return end;
+}
+
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto start = range->index_of_first_record_not_below_lower_bound(records());
+    auto end = index_of_first_record_after_range(records(), *range, start);
+    m_records.remove(start, end - start);
 }
 
-bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
+Optional<Record const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
+    auto const* record = binary_search(m_records, key, nullptr, [](GC::Ref<Key> needle, Record const& record) {
+        return Key::compare_two_keys(needle, record.key);
     });
+    if (!record)
+        return {};
+    return *record;
+}
 
-    return index != m_records.end();
+bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
+{
+    return record_with_key(key).has_value();
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::compare_two_keys(m_records[middle].key, record.key) <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    m_records.insert(low, record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto start = range->index_of_first_record_not_below_lower_bound(records());
+    return index_of_first_record_after_range(records(), *range, start) - start;
 }
 
 Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto index = range->index_of_first_record_not_below_lower_bound(records());
+    if (index >= m_records.size() || range->is_above_upper_bound(m_records[index].key))
+        return {};
+    return m_records[index];
 }
 
 void ObjectStore::clear_records()
@@ -92,12 +110,14 @@ void ObjectStore::clear_records()
 GC::ConservativeVector<Record> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<Record> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    for (auto index = range->index_of_first_record_not_below_lower_bound(this->records()); index < m_records.size(); ++index) {
         if (count.has_value() && records.size() >= *count)
             break;
+
+        auto const& record = m_records[index];
+        if (range->is_above_upper_bound(record.key))
+            break;
+        records.append(record);
     }
 
     return records;
@@ -51,6 +51,7 @@ public:
     ReadonlySpan<Record> records() const { return m_records; }
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
+    Optional<Record const&> record_with_key(GC::Ref<Key> key) const;
     bool has_record_with_key(GC::Ref<Key> key);
     void store_a_record(Record const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
@@ -131,11 +131,7 @@ String isomorphic_decode(ReadonlyBytes input)
     // To isomorphic decode a byte sequence input, return a string whose code point length is equal
     // to input’s length and whose code points have the same values as the values of input’s bytes, in the same order.
     // NOTE: This is essentially spec-speak for "Decode as ISO-8859-1 / Latin-1".
-    StringBuilder builder(input.size());
-    for (u8 code_point : input) {
-        builder.append_code_point(code_point);
-    }
-    return builder.to_string_without_validation();
+    return MUST(String::from_latin1(input));
 }
 
 // https://infra.spec.whatwg.org/#code-unit-less-than
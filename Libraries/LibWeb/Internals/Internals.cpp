@@ -22,6 +22,7 @@
 #include <LibWeb/Page/InputEvent.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/PhaseTimings.h>
 
 namespace Web::Internals {
 
@@ -138,6 +139,20 @@ JS::Object* Internals::hit_test(double x, double y)
     return nullptr;
 }
 
+JS::Object* Internals::phase_timings()
+{
+    auto timings = JS::Object::create(realm(), nullptr);
+    PhaseTimings::to_json().for_each_member([&](String const& name, JsonValue const& value) {
+        timings->define_direct_property(FlyString { name }, JS::Value(*value.get_double_with_precision_loss()), JS::default_attributes);
+    });
+    return timings;
+}
+
+void Internals::reset_phase_timings()
+{
+    PhaseTimings::reset();
+}
+
 void Internals::send_text(HTML::HTMLElement& target, String const& text, WebIDL::UnsignedShort modifiers)
 {
     auto& page = this->page();
@@ -29,6 +29,9 @@ public:
     void gc();
     JS::Object* hit_test(double x, double y);
 
+    JS::Object* phase_timings();
+    void reset_phase_timings();
+
     void send_text(HTML::HTMLElement&, String const&, WebIDL::UnsignedShort modifiers);
     void send_key(HTML::HTMLElement&, String const&, WebIDL::UnsignedShort modifiers);
     void commit_text();
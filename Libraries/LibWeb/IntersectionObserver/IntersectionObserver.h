@@ -36,6 +36,11 @@ struct IntersectionObserverRegistration {
     // https://www.w3.org/TR/intersection-observer/#dom-intersectionobserverregistration-previousisintersecting
     // [A] previousIsIntersecting property holding a boolean.
     bool previous_is_intersecting { false };
+
+    // NOTE: These are not in the spec. They are what the geometry of the target's document and the root intersection
+    //       rectangle were when previousThresholdIndex and previousIsIntersecting were last computed.
+    Optional<u64> previous_geometry_generation;
+    CSSPixelRect previous_root_bounds;
 };
 
 // https://w3c.github.io/IntersectionObserver/#intersection-observer-interface
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Format.h>
+#include <AK/HashFunctions.h>
 #include <AK/String.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/PixelUnits.h>
@@ -42,6 +43,8 @@ public:
 
     String to_string() const;
 
+    unsigned hash() const { return pair_int_hash(to_underlying(m_type), m_value.raw_value()); }
+
     bool operator==(AvailableSize const& other) const = default;
     bool operator<(AvailableSize const& other) const { return m_value < other.m_value; }
 
@@ -89,6 +92,8 @@ public:
 
     bool operator==(AvailableSpace const& other) const = default;
 
+    unsigned hash() const { return pair_int_hash(width.hash(), height.hash()); }
+
     AvailableSize width;
     AvailableSize height;
 
@@ -97,6 +102,11 @@ public:
 
 }
 
+template<>
+struct AK::Traits<Web::Layout::AvailableSpace> : public AK::DefaultTraits<Web::Layout::AvailableSpace> {
+    static unsigned hash(Web::Layout::AvailableSpace const& available_space) { return available_space.hash(); }
+};
+
 template<>
 struct AK::Formatter<Web::Layout::AvailableSize> : Formatter<StringView> {
     ErrorOr<void> format(FormatBuilder& builder, Web::Layout::AvailableSize const& available_size)
@@ -576,6 +576,9 @@ CSSPixels BlockFormattingContext::compute_auto_height_for_block_level_element(Bo
         return compute_auto_height_for_block_formatting_context_root(box);
     }
 
+    if (box_is_sized_as_if_empty(box))
+        return 0;
+
     auto const& box_state = m_state.get(box);
 
     auto display = box.display();
@@ -8,6 +8,7 @@
 
 #include <AK/OwnPtr.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Node.h>
 
 namespace Web::Layout {
@@ -22,6 +23,10 @@ struct IntrinsicSizes {
     Optional<CSSPixels> max_content_width;
     HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
     HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+
+    // NOTE: These are only used by table wrappers, and are keyed on the available space given to the table box.
+    HashMap<AvailableSpace, CSSPixels> table_box_border_box_width;
+    HashMap<AvailableSpace, CSSPixels> table_box_border_box_height;
 };
 
 class Box : public NodeWithStyleAndBoxModelMetrics {
@@ -349,6 +349,9 @@ Optional<CSSPixels> FormattingContext::compute_auto_height_for_absolutely_positi
 CSSPixels FormattingContext::compute_auto_height_for_block_formatting_context_root(Box const& root) const
 {
     // 10.6.7 'Auto' heights for block formatting context roots
+    if (box_is_sized_as_if_empty(root))
+        return 0;
+
     Optional<CSSPixels> top;
     Optional<CSSPixels> bottom;
 
@@ -438,17 +441,24 @@ CSSPixels FormattingContext::compute_table_box_width_inside_table_wrapper(Box co
     });
     VERIFY(table_box.has_value());
 
-    LayoutState throwaway_state;
+    // OPTIMIZATION: Measuring the table means running the table layout algorithm up to the width calculation,
+    //               which is expensive, and flex and grid layout may ask for it many times for the same input.
+    //               The result only depends on the table's subtree and the space we give it, so we cache it on
+    //               the wrapper alongside its other intrinsic sizes.
+    auto table_available_space = m_state.get(*table_box).available_inner_space_or_constraints_from(available_space);
+    auto table_used_width = box.cached_intrinsic_sizes().table_box_border_box_width.ensure(table_available_space, [&] {
+        LayoutState throwaway_state;
 
-    auto& table_box_state = throwaway_state.get_mutable(*table_box);
-    auto const& table_box_computed_values = table_box->computed_values();
-    table_box_state.border_left = table_box_computed_values.border_left().width;
-    table_box_state.border_right = table_box_computed_values.border_right().width;
+        auto& table_box_state = throwaway_state.get_mutable(*table_box);
+        auto const& table_box_computed_values = table_box->computed_values();
+        table_box_state.border_left = table_box_computed_values.border_left().width;
+        table_box_state.border_right = table_box_computed_values.border_right().width;
 
-    auto context = make<TableFormattingContext>(throwaway_state, LayoutMode::IntrinsicSizing, *table_box, this);
-    context->run_until_width_calculation(m_state.get(*table_box).available_inner_space_or_constraints_from(available_space));
+        auto context = make<TableFormattingContext>(throwaway_state, LayoutMode::IntrinsicSizing, *table_box, this);
+        context->run_until_width_calculation(table_available_space);
 
-    auto table_used_width = throwaway_state.get(*table_box).border_box_width();
+        return throwaway_state.get(*table_box).border_box_width();
+    });
     return available_space.width.is_definite() ? min(table_used_width, available_width) : table_used_width;
 }
 
@@ -477,23 +487,27 @@ CSSPixels FormattingContext::compute_table_box_height_inside_table_wrapper(Box c
     // table-wrapper can't have borders or paddings but it might have margin taken from table-root.
     auto available_height = height_of_containing_block - margin_top.to_px(box) - margin_bottom.to_px(box);
 
-    LayoutState throwaway_state;
+    // OPTIMIZATION: See compute_table_box_width_inside_table_wrapper().
+    auto wrapper_available_space = m_state.get(box).available_inner_space_or_constraints_from(available_space);
+    auto table_used_height = box.cached_intrinsic_sizes().table_box_border_box_height.ensure(wrapper_available_space, [&] {
+        LayoutState throwaway_state;
 
-    auto context = create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
-    VERIFY(context);
-    context->run(m_state.get(box).available_inner_space_or_constraints_from(available_space));
+        auto context = create_independent_formatting_context_if_needed(throwaway_state, LayoutMode::IntrinsicSizing, box);
+        VERIFY(context);
+        context->run(wrapper_available_space);
 
-    Optional<Box const&> table_box;
-    box.for_each_in_subtree_of_type<Box>([&](Box const& child_box) {
-        if (child_box.display().is_table_inside()) {
-            table_box = child_box;
-            return TraversalDecision::Break;
-        }
-        return TraversalDecision::Continue;
-    });
-    VERIFY(table_box.has_value());
+        Optional<Box const&> table_box;
+        box.for_each_in_subtree_of_type<Box>([&](Box const& child_box) {
+            if (child_box.display().is_table_inside()) {
+                table_box = child_box;
+                return TraversalDecision::Break;
+            }
+            return TraversalDecision::Continue;
+        });
+        VERIFY(table_box.has_value());
 
-    auto table_used_height = throwaway_state.get(*table_box).border_box_height();
+        return throwaway_state.get(*table_box).border_box_height();
+    });
     return available_space.height.is_definite() ? min(table_used_height, available_height) : table_used_height;
 }
 
@@ -1440,6 +1454,23 @@ CSSPixels FormattingContext::calculate_fit_content_height(Layout::Box const& box
     return calculate_max_content_height(box, available_space.width.to_px_or_zero());
 }
 
+// https://drafts.csswg.org/css-contain-2/#containment-size
+// The intrinsic sizes of the size containment box are determined as if the element had no content.
+// NOTE: Replaced boxes get this through their natural sizes, and flex, grid and table containers
+//       still size their explicit tracks, so we only short-circuit block containers here.
+bool FormattingContext::box_is_sized_as_if_empty(Box const& box)
+{
+    return box.has_size_containment() && box.is_block_container() && !box.is_replaced_box();
+}
+
+// https://drafts.csswg.org/css-contain-2/#containment-inline-size
+bool FormattingContext::box_is_sized_as_if_empty_in_inline_axis(Box const& box)
+{
+    if (box_is_sized_as_if_empty(box))
+        return true;
+    return box.has_inline_size_containment() && box.is_block_container() && !box.is_replaced_box();
+}
+
 CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box) const
 {
     if (box.is_replaced_box() && box.computed_values().width().is_percentage()) {
@@ -1449,6 +1480,9 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
+    if (box_is_sized_as_if_empty_in_inline_axis(box))
+        return 0;
+
     auto& cache = box.cached_intrinsic_sizes().min_content_width;
     if (cache.has_value())
         return cache.value();
@@ -1481,6 +1515,9 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
+    if (box_is_sized_as_if_empty_in_inline_axis(box))
+        return 0;
+
     auto& cache = box.cached_intrinsic_sizes().max_content_width;
     if (cache.has_value())
         return cache.value();
@@ -1521,6 +1558,9 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
     }
 
+    if (box_is_sized_as_if_empty(box))
+        return 0;
+
     auto& cache = box.cached_intrinsic_sizes().min_content_height.ensure(width);
     if (cache.has_value())
         return cache.value();
@@ -1552,6 +1592,9 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
     if (box.has_natural_height())
         return *box.natural_height();
 
+    if (box_is_sized_as_if_empty(box))
+        return 0;
+
     auto& cache_slot = box.cached_intrinsic_sizes().max_content_height.ensure(width);
     if (cache_slot.has_value())
         return cache_slot.value();
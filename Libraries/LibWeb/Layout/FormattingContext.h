@@ -57,6 +57,9 @@ public:
 
     static bool creates_block_formatting_context(Box const&);
 
+    static bool box_is_sized_as_if_empty(Box const&);
+    static bool box_is_sized_as_if_empty_in_inline_axis(Box const&);
+
     CSSPixels compute_table_box_width_inside_table_wrapper(Box const&, AvailableSpace const&);
     CSSPixels compute_table_box_height_inside_table_wrapper(Box const&, AvailableSpace const&);
 
@@ -735,17 +735,20 @@ void GridFormattingContext::resolve_intrinsic_track_sizes(GridDimension dimensio
 
     // FIXME: 1. Shim baseline-aligned items so their intrinsic size contributions reflect their baseline alignment.
 
-    // 2. Size tracks to fit non-spanning items:
-    increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, 1);
+    // OPTIMIZATION: Group the items by their span up front, so that each of the following steps only has to look at
+    //               the items it's about, instead of going through all of them once for every possible span.
+    HashMap<size_t, Vector<GridItem const&>> items_by_span;
+    for (auto& item : m_grid_items)
+        items_by_span.ensure(item.span(dimension)).append(item);
+    auto spans = items_by_span.keys();
+    quick_sort(spans);
 
+    // 2. Size tracks to fit non-spanning items:
     // 3. Increase sizes to accommodate spanning items crossing content-sized tracks: Next, consider the
     // items with a span of 2 that do not span a track with a flexible sizing function.
     // Repeat incrementally for items with greater spans until all items have been considered.
-    size_t max_item_span = 1;
-    for (auto& item : m_grid_items)
-        max_item_span = max(item.span(dimension), max_item_span);
-    for (size_t span = 2; span <= max_item_span; span++)
-        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, span);
+    for (auto span : spans)
+        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, items_by_span.get(span).value());
 
     // 4. Increase sizes to accommodate spanning items crossing flexible tracks: Next, repeat the previous
     // step instead considering (together, rather than grouped by span size) all items that do span a
@@ -920,15 +923,10 @@ void GridFormattingContext::distribute_extra_space_across_spanned_tracks_growth_
     }
 }
 
-void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, size_t span)
+void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, Vector<GridItem const&> const& items_with_same_span)
 {
     auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
-    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
-    for (auto& item : m_grid_items) {
-        auto const item_span = item.span(dimension);
-        if (item_span != span)
-            continue;
-
+    for (auto& item : items_with_same_span) {
         Vector<GridTrack&> spanned_tracks;
         for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
             spanned_tracks.append(track);
@@ -985,7 +983,9 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
+        // NOTE: Only the base sizes of the tracks spanned by this item have changed, so those are the only tracks whose
+        //       growth limit may now be less than their base size.
+        for (auto& track : spanned_tracks) {
             if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
                 track.growth_limit = track.base_size;
         }
@@ -1037,7 +1037,6 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
 void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension dimension)
 {
-    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
     for (auto& item : m_grid_items) {
         Vector<GridTrack&> spanned_tracks;
         for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
@@ -1065,7 +1064,9 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
+        // NOTE: Only the base sizes of the tracks spanned by this item have changed, so those are the only tracks whose
+        //       growth limit may now be less than their base size.
+        for (auto& track : spanned_tracks) {
             if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
                 track.growth_limit = track.base_size;
         }
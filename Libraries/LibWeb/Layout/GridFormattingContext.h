@@ -366,7 +366,7 @@ private:
 
     void initialize_track_sizes(GridDimension);
     void resolve_intrinsic_track_sizes(GridDimension);
-    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, size_t span);
+    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, Vector<GridItem const&> const& items_with_same_span);
     void increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension);
     void maximize_tracks_using_available_size(AvailableSpace const& available_space, GridDimension dimension);
     void maximize_tracks(GridDimension);
@@ -1471,7 +1471,7 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
 
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
-    if (m_needs_layout_update)
+    if (m_needs_layout_update && m_needs_intrinsic_sizes_update)
         return;
 
     if constexpr (UPDATE_LAYOUT_DEBUG) {
@@ -1482,20 +1482,31 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
     }
 
     m_needs_layout_update = true;
+    m_needs_intrinsic_sizes_update = true;
 
     // Mark any anonymous children generated by this node for layout update.
     // NOTE: if this node generated an anonymous parent, all ancestors are indiscriminately marked below.
     for_each_child_of_type<Box>([&](Box& child) {
         if (child.is_anonymous() && !is<TableWrapper>(child)) {
             child.m_needs_layout_update = true;
+            child.m_needs_intrinsic_sizes_update = true;
         }
         return IterationDecision::Continue;
     });
 
+    // OPTIMIZATION: A change inside a box that is sized as if it were empty can't affect the intrinsic sizes of
+    //               its ancestors, so we only invalidate their cached intrinsic sizes up to that boundary.
+    //               They still need to be laid out again, since the box's own layout may have changed.
+    bool reached_intrinsic_size_boundary = false;
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
-        if (ancestor->m_needs_layout_update)
+        if (reached_intrinsic_size_boundary ? ancestor->m_needs_layout_update : ancestor->m_needs_intrinsic_sizes_update)
             break;
         ancestor->m_needs_layout_update = true;
+        if (reached_intrinsic_size_boundary)
+            continue;
+        ancestor->m_needs_intrinsic_sizes_update = true;
+        if (auto const* box = as_if<Box>(*ancestor); box && FormattingContext::box_is_sized_as_if_empty(*box))
+            reached_intrinsic_size_boundary = true;
     }
 }
 
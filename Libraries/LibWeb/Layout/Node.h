@@ -47,7 +47,15 @@ public:
 
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_needs_intrinsic_sizes_update = false;
+    }
+
+    // NOTE: This is a subset of needs_layout_update(): it stops propagating upwards at boxes whose
+    //       intrinsic sizes don't depend on their contents, so their ancestors can keep their cached sizes.
+    bool needs_intrinsic_sizes_update() const { return m_needs_intrinsic_sizes_update; }
 
     bool is_generated() const { return m_generated_for.has_value(); }
     Optional<CSS::PseudoElement> generated_for_pseudo_element() const { return m_generated_for; }
@@ -225,6 +233,7 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_needs_intrinsic_sizes_update { false };
 
     Optional<CSS::PseudoElement> m_generated_for {};
 
@@ -106,6 +106,8 @@ void TableFormattingContext::compute_cell_measures()
 
     compute_constrainedness();
 
+    auto use_fixed_mode_layout = this->use_fixed_mode_layout();
+
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
         CSSPixels padding_top = computed_values.padding().top().to_px(cell.box, containing_block.content_height());
@@ -136,8 +138,12 @@ void TableFormattingContext::compute_cell_measures()
         // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
         // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
         // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
+        // NOTE: Only the cells in the first row can determine the width of a column in fixed mode, as described by
+        //       https://www.w3.org/TR/CSS22/tables.html#fixed-table-layout. This is what makes fixed mode layout fast
+        //       for large tables, as the rest of the cells no longer have any say in the column widths.
         auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
-        if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
+        auto cell_contributes_to_column_widths = !use_fixed_mode_layout || (cell.row_index == 0 && width_is_specified_length_or_percentage);
+        if (cell_contributes_to_column_widths) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
 
@@ -160,7 +166,7 @@ void TableFormattingContext::compute_cell_measures()
         // See the explanation for height and max_height above.
         auto width = computed_values.width().is_length() ? computed_values.width().to_px(cell.box, containing_block.content_width()) : 0;
         auto max_width = computed_values.max_width().is_length() ? computed_values.max_width().to_px(cell.box, containing_block.content_width()) : CSSPixels::max();
-        if (use_fixed_mode_layout() && !width_is_specified_length_or_percentage) {
+        if (!cell_contributes_to_column_widths) {
             continue;
         }
         if (m_columns[cell.column_index].is_constrained) {
@@ -309,6 +309,7 @@ void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
     m_grapheme_segmenter.clear();
+    m_chunk_cache.clear();
 }
 
 String const& TextNode::text_for_rendering() const
@@ -396,14 +397,6 @@ Unicode::Segmenter& TextNode::grapheme_segmenter() const
     return *m_grapheme_segmenter;
 }
 
-TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_lines, bool respect_linebreaks)
-    : m_wrap_lines(wrap_lines)
-    , m_respect_linebreaks(respect_linebreaks)
-    , m_utf8_view(text_node.text_for_rendering())
-    , m_font_cascade_list(text_node.computed_values().font_list())
-    , m_grapheme_segmenter(text_node.grapheme_segmenter())
-{
-}
 
 static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
 {
@@ -446,26 +439,79 @@ static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
     }
 }
 
+class ChunkSplitter {
+public:
+    ChunkSplitter(TextNode const& text_node, bool wrap_lines, bool respect_linebreaks)
+        : m_wrap_lines(wrap_lines)
+        , m_respect_linebreaks(respect_linebreaks)
+        , m_utf8_view(text_node.text_for_rendering())
+        , m_font_cascade_list(text_node.computed_values().font_list())
+        , m_grapheme_segmenter(text_node.grapheme_segmenter())
+    {
+    }
+
+    Vector<TextNode::Chunk> split()
+    {
+        Vector<TextNode::Chunk> chunks;
+        for (auto chunk = next(); chunk.has_value(); chunk = next())
+            chunks.append(chunk.release_value());
+        return chunks;
+    }
+
+private:
+    Optional<TextNode::Chunk> next();
+    Optional<TextNode::Chunk> try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, bool has_breaking_tab, Gfx::Font const&, Gfx::GlyphRun::TextType) const;
+
+    bool const m_wrap_lines;
+    bool const m_respect_linebreaks;
+    Utf8View m_utf8_view;
+    Gfx::FontCascadeList const& m_font_cascade_list;
+
+    Unicode::Segmenter& m_grapheme_segmenter;
+    size_t m_current_index { 0 };
+};
+
+Vector<TextNode::Chunk> const& TextNode::chunks(bool wrap_lines, bool respect_linebreaks) const
+{
+    auto const& font_cascade_list = computed_values().font_list();
+    if (m_chunk_cache.has_value()
+        && m_chunk_cache->font_cascade_list.ptr() == &font_cascade_list
+        && m_chunk_cache->wrap_lines == wrap_lines
+        && m_chunk_cache->respect_linebreaks == respect_linebreaks) {
+        return m_chunk_cache->chunks;
+    }
+
+    m_chunk_cache = ChunkCache {
+        .font_cascade_list = font_cascade_list,
+        .wrap_lines = wrap_lines,
+        .respect_linebreaks = respect_linebreaks,
+        .chunks = ChunkSplitter { *this, wrap_lines, respect_linebreaks }.split(),
+    };
+    return m_chunk_cache->chunks;
+}
+
+// NOTE: The chunks are only ever recomputed when the text, the fonts or the white-space properties change, none of
+//       which happens while a text node is being laid out.
+TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_lines, bool respect_linebreaks)
+    : m_chunks(text_node.chunks(wrap_lines, respect_linebreaks))
+{
+}
+
 Optional<TextNode::Chunk> TextNode::ChunkIterator::next()
 {
-    if (!m_peek_queue.is_empty())
-        return m_peek_queue.take_first();
-    return next_without_peek();
+    if (m_next_chunk_index >= m_chunks.size())
+        return {};
+    return m_chunks[m_next_chunk_index++];
 }
 
 Optional<TextNode::Chunk> TextNode::ChunkIterator::peek(size_t count)
 {
-    while (m_peek_queue.size() <= count) {
-        auto next = next_without_peek();
-        if (!next.has_value())
-            return {};
-        m_peek_queue.append(*next);
-    }
-
-    return m_peek_queue[count];
+    if (m_next_chunk_index + count >= m_chunks.size())
+        return {};
+    return m_chunks[m_next_chunk_index + count];
 }
 
-Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
+Optional<TextNode::Chunk> ChunkSplitter::next()
 {
     if (m_current_index >= m_utf8_view.byte_length())
         return {};
@@ -551,11 +597,11 @@ Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
     return {};
 }
 
-Optional<TextNode::Chunk> TextNode::ChunkIterator::try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, bool has_breaking_tab, Gfx::Font const& font, Gfx::GlyphRun::TextType text_type) const
+Optional<TextNode::Chunk> ChunkSplitter::try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, bool has_breaking_tab, Gfx::Font const& font, Gfx::GlyphRun::TextType text_type) const
 {
     if (auto byte_length = end - start; byte_length > 0) {
         auto chunk_view = m_utf8_view.substring_view(start, byte_length);
-        return Chunk {
+        return TextNode::Chunk {
             .view = chunk_view,
             .font = font,
             .start = start,
@@ -47,18 +47,8 @@ public:
         Optional<Chunk> peek(size_t);
 
     private:
-        Optional<Chunk> next_without_peek();
-        Optional<Chunk> try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, bool has_breaking_tab, Gfx::Font const&, Gfx::GlyphRun::TextType) const;
-
-        bool const m_wrap_lines;
-        bool const m_respect_linebreaks;
-        Utf8View m_utf8_view;
-        Gfx::FontCascadeList const& m_font_cascade_list;
-
-        Unicode::Segmenter& m_grapheme_segmenter;
-        size_t m_current_index { 0 };
-
-        Vector<Chunk> m_peek_queue;
+        Vector<Chunk> const& m_chunks;
+        size_t m_next_chunk_index { 0 };
     };
 
     void invalidate_text_for_rendering();
@@ -66,6 +56,8 @@ public:
 
     Unicode::Segmenter& grapheme_segmenter() const;
 
+    Vector<Chunk> const& chunks(bool wrap_lines, bool respect_linebreaks) const;
+
     virtual GC::Ptr<Painting::Paintable> create_paintable() const override;
 
 private:
@@ -73,6 +65,17 @@ private:
 
     Optional<String> m_text_for_rendering;
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
+
+    // OPTIMIZATION: Splitting the text into chunks means looking up the font and the grapheme boundaries for every code
+    //               point, but the result only changes along with the text and the fonts. So it's kept around to make
+    //               relayouts (e.g. while the viewport is resized) cheaper.
+    struct ChunkCache {
+        NonnullRefPtr<Gfx::FontCascadeList const> font_cascade_list;
+        bool wrap_lines { false };
+        bool respect_linebreaks { false };
+        Vector<Chunk> chunks;
+    };
+    mutable Optional<ChunkCache> m_chunk_cache;
 };
 
 template<>
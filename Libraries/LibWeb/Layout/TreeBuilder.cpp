@@ -21,6 +21,7 @@
 #include <LibWeb/Dump.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/HTMLSlotElement.h>
+#include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/FieldSetBox.h>
 #include <LibWeb/Layout/ListItemBox.h>
 #include <LibWeb/Layout/ListItemMarkerBox.h>
@@ -426,6 +427,157 @@ static bool is_ignorable_whitespace(Layout::Node const& node)
     return false;
 }
 
+// Whether the layout nodes of children can be inserted into or removed from this layout node without rebuilding it, as
+// nothing else in it (like anonymous wrappers, generated content or inline continuations) has to change along with them.
+static bool can_update_layout_nodes_of_children_in_place(DOM::Node const& dom_node, NodeWithStyle const& layout_node)
+{
+    if (!dom_node.is_element())
+        return false;
+    auto const& element = static_cast<DOM::Element const&>(dom_node);
+    if (element.is_shadow_host() || is<HTML::HTMLSlotElement>(element) || element.is_html_button_element() || element.is_html_input_element())
+        return false;
+    if (!layout_node.parent() || layout_node.is_anonymous() || !is<BlockContainer>(layout_node) || is<FieldSetBox>(layout_node) || layout_node.is_svg_box())
+        return false;
+    auto display = layout_node.display();
+    return display.is_flow_inside() || display.is_flow_root_inside();
+}
+
+// Whether a DOM subtree may change the counters of the elements after it, which would have to be resolved again.
+static bool may_affect_counters_of_following_elements(DOM::Node& dom_node)
+{
+    bool may_affect_counters = false;
+    dom_node.for_each_in_inclusive_subtree_of_type<DOM::Element>([&](DOM::Element& element) {
+        auto style = element.computed_properties();
+        if (!style)
+            return TraversalDecision::SkipChildrenAndContinue;
+        if (element.has_non_empty_counters_set()
+            || style->display().is_list_item()
+            || !style->counter_data(CSS::PropertyID::CounterReset).is_empty()
+            || !style->counter_data(CSS::PropertyID::CounterIncrement).is_empty()
+            || !style->counter_data(CSS::PropertyID::CounterSet).is_empty()) {
+            may_affect_counters = true;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return may_affect_counters;
+}
+
+static GC::Ptr<Layout::Node> next_sibling_layout_node_in_tree(DOM::Node& dom_node)
+{
+    for (auto* sibling = dom_node.next_sibling(); sibling; sibling = sibling->next_sibling()) {
+        if (auto layout_node = sibling->layout_node(); layout_node && layout_node->parent())
+            return layout_node;
+    }
+    return nullptr;
+}
+
+// OPTIMIZATION: When nodes were only inserted into a node whose layout node is kept, we try to insert just their layout
+//               nodes in between the ones of their siblings, instead of rebuilding the layout subtree of the whole parent.
+bool TreeBuilder::can_insert_layout_nodes_of_new_children(DOM::Node& dom_node)
+{
+    auto const* parent = as_if<NodeWithStyle>(dom_node.layout_node());
+
+    for (auto* child = dom_node.first_child(); child; child = child->next_sibling()) {
+        if (!child->needs_layout_tree_update())
+            continue;
+
+        // NOTE: Layout nodes that are still where they were get replaced in place.
+        if (auto old_layout_node = child->layout_node(); old_layout_node && old_layout_node->parent()) {
+            if (parent && old_layout_node->is_inclusive_descendant_of(*parent))
+                continue;
+            return false;
+        }
+
+        CSS::Display display;
+        if (child->is_text()) {
+            display = CSS::Display(CSS::DisplayOutside::Inline, CSS::DisplayInside::Flow);
+        } else if (auto* element = as_if<DOM::Element>(*child)) {
+            if (element->rendered_in_top_layer())
+                continue;
+            auto style = element->computed_properties();
+            if (!style)
+                return false;
+            display = style->display();
+            if (display.is_none())
+                continue;
+            if (display.is_contents()
+                || style->position() == CSS::Positioning::Absolute
+                || style->position() == CSS::Positioning::Fixed
+                || style->float_() != CSS::Float::None
+                || element->is_svg_container()
+                || element->requires_svg_container()
+                || may_affect_counters_of_following_elements(*element))
+                return false;
+        } else {
+            continue;
+        }
+
+        if (!parent || !can_update_layout_nodes_of_children_in_place(dom_node, *parent))
+            return false;
+
+        if (auto next_sibling = next_sibling_layout_node_in_tree(*child)) {
+            if (next_sibling->parent() != parent || display.is_inline_outside() != parent->children_are_inline())
+                return false;
+        } else if (auto const* last_child = parent->last_child(); last_child && (last_child->is_generated() || (last_child->is_anonymous() && !last_child->children_are_inline()))) {
+            // NOTE: New layout nodes may not be appended after generated content like ::after.
+            return false;
+        }
+    }
+    return true;
+}
+
+void TreeBuilder::insert_node_between_existing_siblings(DOM::Node& dom_node, Layout::Node& layout_node, CSS::Display display)
+{
+    if (auto next_sibling = next_sibling_layout_node_in_tree(dom_node)) {
+        next_sibling->parent()->insert_before(layout_node, next_sibling);
+        return;
+    }
+    insert_node_into_inline_or_block_ancestor(layout_node, display, AppendOrPrepend::Append);
+}
+
+void TreeBuilder::remove_layout_nodes_of_subtree(DOM::Node& dom_node)
+{
+    dom_node.for_each_in_inclusive_subtree([&](auto& node) {
+        node.set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
+        node.set_child_needs_layout_tree_update(false);
+        auto layout_node = node.layout_node();
+        if (layout_node && layout_node->parent()) {
+            layout_node->remove();
+        }
+        node.detach_layout_node({});
+        node.clear_paintable();
+        if (is<DOM::Element>(node))
+            static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
+        return TraversalDecision::Continue;
+    });
+}
+
+bool TreeBuilder::remove_layout_nodes_of_node_being_removed(DOM::Node& dom_node)
+{
+    auto* parent = dom_node.parent();
+    auto layout_node = dom_node.layout_node();
+    if (!parent || !layout_node || !layout_node->parent() || layout_node->parent() != parent->layout_node())
+        return false;
+    if (auto const* parent_layout_node = as_if<NodeWithStyle>(*layout_node->parent()); !parent_layout_node || !can_update_layout_nodes_of_children_in_place(*parent, *parent_layout_node))
+        return false;
+
+    // NOTE: Anonymous wrappers on both sides would have to be merged into one, and inline continuations would have to be
+    //       joined back together.
+    if (auto const* previous_sibling = layout_node->previous_sibling(); previous_sibling && previous_sibling->is_anonymous())
+        return false;
+    if (auto const* next_sibling = layout_node->next_sibling(); next_sibling && next_sibling->is_anonymous())
+        return false;
+    if (auto const* box_model_node = as_if<NodeWithStyleAndBoxModelMetrics>(*layout_node); box_model_node && box_model_node->continuation_of_node())
+        return false;
+    if (may_affect_counters_of_following_elements(dom_node))
+        return false;
+
+    layout_node->parent()->set_needs_layout_update(DOM::SetNeedsLayoutReason::LayoutTreeUpdate);
+    remove_layout_nodes_of_subtree(dom_node);
+    return true;
+}
+
 void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context& context, MustCreateSubtree must_create_subtree)
 {
     bool should_create_layout_node = must_create_subtree == MustCreateSubtree::Yes
@@ -433,6 +585,9 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         || dom_node.document().needs_full_layout_tree_update()
         || (dom_node.is_document() && !dom_node.layout_node());
 
+    if (!should_create_layout_node && dom_node.child_needs_layout_tree_update() && !can_insert_layout_nodes_of_new_children(dom_node))
+        should_create_layout_node = true;
+
     if (dom_node.is_element()) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         if (element.rendered_in_top_layer() && !context.layout_top_layer)
@@ -453,21 +608,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     ScopeGuard remove_stale_layout_node_guard = [&] {
         // If we didn't create a layout node for this DOM node,
         // go through the DOM tree and remove any old layout & paint nodes since they are now all stale.
-        if (!layout_node) {
-            dom_node.for_each_in_inclusive_subtree([&](auto& node) {
-                node.set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
-                node.set_child_needs_layout_tree_update(false);
-                auto layout_node = node.layout_node();
-                if (layout_node && layout_node->parent()) {
-                    layout_node->remove();
-                }
-                node.detach_layout_node({});
-                node.clear_paintable();
-                if (is<DOM::Element>(node))
-                    static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
-                return TraversalDecision::Continue;
-            });
-        }
+        if (!layout_node)
+            remove_layout_nodes_of_subtree(dom_node);
     };
 
     if (dom_node.is_svg_container()) {
@@ -535,6 +677,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             old_layout_node->parent()->replace_child(*layout_node, *old_layout_node);
         } else if (layout_node->is_svg_box()) {
             m_ancestor_stack.last()->append_child(*layout_node);
+        } else if (context.insert_between_existing_siblings && must_create_subtree == MustCreateSubtree::No) {
+            insert_node_between_existing_siblings(dom_node, *layout_node, display);
         } else {
             insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
         }
@@ -572,6 +716,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
                 shadow_root->set_child_needs_layout_tree_update(false);
                 shadow_root->set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
             } else {
+                TemporaryChange insert_between_existing_siblings(context.insert_between_existing_siblings, !should_create_layout_node);
+
                 // This is the same as as<DOM::ParentNode>(dom_node).for_each_child
                 for (auto* node = as<DOM::ParentNode>(dom_node).first_child(); node; node = node->next_sibling())
                     update_layout_tree(*node, context, should_create_layout_node ? MustCreateSubtree::Yes : MustCreateSubtree::No);
@@ -581,6 +727,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
                 // Elements in the top layer do not lay out normally based on their position in the document; instead they
                 // generate boxes as if they were siblings of the root element.
                 TemporaryChange<bool> layout_mask(context.layout_top_layer, true);
+                TemporaryChange insert_between_existing_siblings(context.insert_between_existing_siblings, false);
                 for (auto const& top_layer_element : document.top_layer_elements()) {
                     if (top_layer_element->rendered_in_top_layer()) {
                         // Each element rendered in the top layer has a ::backdrop pseudo-element, for which it is the originating element.
@@ -603,6 +750,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             auto slottables = slot_element.assigned_nodes_internal();
             push_parent(as<NodeWithStyle>(*layout_node));
 
+            TemporaryChange insert_between_existing_siblings(context.insert_between_existing_siblings, false);
+
             MustCreateSubtree must_create_subtree_for_slottable = must_create_subtree;
             if (slot_element.needs_layout_tree_update())
                 must_create_subtree_for_slottable = MustCreateSubtree::Yes;
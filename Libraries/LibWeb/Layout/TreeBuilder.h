@@ -20,13 +20,22 @@ public:
 
     GC::Ptr<Layout::Node> build(DOM::Node&);
 
+    // Removes the layout nodes of a DOM node that's about to be removed from its parent, so that the layout subtree of
+    // the parent can be kept. Returns false if that can't be done, in which case the parent has to be rebuilt instead.
+    static bool remove_layout_nodes_of_node_being_removed(DOM::Node&);
+
 private:
     struct Context {
         bool has_svg_root = false;
         bool layout_top_layer = false;
         bool layout_svg_mask_or_clip_path = false;
+        bool insert_between_existing_siblings = false;
     };
 
+    static void remove_layout_nodes_of_subtree(DOM::Node&);
+    static bool can_insert_layout_nodes_of_new_children(DOM::Node&);
+    void insert_node_between_existing_siblings(DOM::Node&, Layout::Node&, CSS::Display);
+
     i32 calculate_list_item_index(DOM::Node&);
 
     void update_layout_tree_before_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_has_content_visibility_hidden);
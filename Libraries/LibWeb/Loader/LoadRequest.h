@@ -13,6 +13,7 @@
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web {
 
@@ -46,6 +47,13 @@ public:
     GC::Ptr<Page> page() const { return m_page.ptr(); }
     void set_page(Page& page) { m_page = page; }
 
+    // The partition of RequestServer's disk cache that this request may use, if any.
+    Optional<ByteString> const& cache_partition() const { return m_cache_partition; }
+    void set_cache_partition(Optional<ByteString> cache_partition) { m_cache_partition = move(cache_partition); }
+
+    RequestServer::RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestServer::RequestPriority priority) { m_priority = priority; }
+
     unsigned hash() const
     {
         auto body_hash = string_hash((char const*)m_body.data(), m_body.size());
@@ -82,6 +90,8 @@ private:
     ByteBuffer m_body;
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
+    Optional<ByteString> m_cache_partition;
+    RequestServer::RequestPriority m_priority { RequestServer::RequestPriority::Medium };
     bool m_main_resource { false };
 };
 
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceLongTaskTimingPrototype.h>
+#include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/HTML/HTMLFrameElement.h>
+#include <LibWeb/HTML/HTMLIFrameElement.h>
+#include <LibWeb/HTML/HTMLObjectElement.h>
+#include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/NavigableContainer.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+
+namespace Web::LongTasks {
+
+GC_DEFINE_ALLOCATOR(PerformanceLongTaskTiming);
+
+PerformanceLongTaskTiming::PerformanceLongTaskTiming(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, GC::Ref<TaskAttributionTiming> attribution)
+    : PerformanceTimeline::PerformanceEntry(realm, name, start_time, duration)
+    , m_attribution({ attribution })
+{
+}
+
+PerformanceLongTaskTiming::~PerformanceLongTaskTiming() = default;
+
+void PerformanceLongTaskTiming::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceLongTaskTiming);
+    Base::initialize(realm);
+}
+
+void PerformanceLongTaskTiming::visit_edges(JS::Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_attribution);
+}
+
+FlyString const& PerformanceLongTaskTiming::entry_type() const
+{
+    return PerformanceTimeline::EntryTypes::longtask;
+}
+
+static GC::Ptr<HTML::BrowsingContext> browsing_context_of(HTML::EnvironmentSettingsObject& settings)
+{
+    if (auto* window = as_if<HTML::Window>(settings.global_object()))
+        return window->browsing_context();
+    return nullptr;
+}
+
+// https://w3c.github.io/longtasks/#report-long-tasks
+void report_long_tasks(HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp end_time, Vector<GC::Ref<HTML::BrowsingContext>> const& top_level_browsing_contexts, HTML::Task const& task)
+{
+    // 1. If end time minus start time is less than the long tasks threshold of 50 ms, abort these steps.
+    if (end_time - start_time < long_tasks_threshold)
+        return;
+
+    // 2. Let destinationRealms be an empty set.
+    Vector<GC::Ref<JS::Realm>> destination_realms;
+    auto add_destination_realm = [&](DOM::Document& document) {
+        auto& realm = HTML::relevant_realm(document);
+        if (!destination_realms.contains_slow(realm))
+            destination_realms.append(realm);
+    };
+
+    // 3. Determine the set of JavaScript realms to which reports will be delivered:
+    //    For each top-level browsing context topmostBC in top-level browsing contexts:
+    for (auto const& topmost_browsing_context : top_level_browsing_contexts) {
+        auto* topmost_document = topmost_browsing_context->active_document();
+        if (!topmost_document)
+            continue;
+
+        // 1. Add topmostBC's active document's relevant Realm to destinationRealms.
+        add_destination_realm(*topmost_document);
+
+        // 2. Let descendantBCs be topmostBC's active document's list of the descendant browsing contexts.
+        // 3. For each descendantBC in descendantBCs, add descendantBC's active document's relevant Realm to
+        //    destinationRealms.
+        for (auto const& descendant_navigable : topmost_document->descendant_navigables()) {
+            if (auto descendant_document = descendant_navigable->active_document())
+                add_destination_realm(*descendant_document);
+        }
+    }
+
+    auto const& task_settings_set = task.script_evaluation_environment_settings_object_set();
+
+    // 4. For each destinationRealm in destinationRealms:
+    for (auto const& destination_realm : destination_realms) {
+        auto& destination_settings = Bindings::principal_host_defined_environment_settings_object(destination_realm);
+
+        // 1. Let name be the empty string. This will be used to report minimal frame attribution, below.
+        String name;
+
+        // 2. Let culpritSettings be null.
+        GC::Ptr<HTML::EnvironmentSettingsObject> culprit_settings;
+
+        // 3. Process task's script evaluation environment settings object set to determine name and culpritSettings
+        //    as follows:
+        // 1. If task's script evaluation environment settings object set is empty: set name to "unknown" and
+        //    culpritSettings to null.
+        if (task_settings_set.is_empty()) {
+            name = "unknown"_string;
+        }
+        // 2. Otherwise, if task's script evaluation environment settings object set's length is greater than one: set
+        //    name to "multiple-contexts" and culpritSettings to null.
+        else if (task_settings_set.size() > 1) {
+            name = "multiple-contexts"_string;
+        }
+        // 3. Otherwise, i.e. if task's script evaluation environment settings object set's length is one:
+        else {
+            // 1. Set culpritSettings to the single item in task's script evaluation environment settings object set.
+            culprit_settings = task_settings_set.first();
+
+            // 2. Let destinationSettings be destinationRealm's relevant settings object.
+            // 3. Let destinationOrigin be destinationSettings's origin.
+            auto destination_origin = destination_settings.origin();
+
+            // 4. Let destinationBC be destinationSettings's global object's browsing context.
+            auto destination_browsing_context = browsing_context_of(destination_settings);
+
+            // 5. Let culpritBC be culpritSettings's global object's browsing context.
+            auto culprit_browsing_context = browsing_context_of(*culprit_settings);
+
+            // 6. Assert: culpritBC is not null.
+            // AD-HOC: The culprit's browsing context is gone if the task discarded its document, in which case we treat
+            //         the culprit as unknown.
+            if (!culprit_browsing_context) {
+                name = "unknown"_string;
+                culprit_settings = nullptr;
+            }
+            // 7. If culpritSettings is the same as destinationSettings, set name to "self".
+            else if (culprit_settings.ptr() == &destination_settings) {
+                name = "self"_string;
+            }
+            // 8. Otherwise, if culpritSettings's origin and destinationOrigin are same origin:
+            else if (culprit_settings->origin().is_same_origin(destination_origin)) {
+                // 1. If destinationBC is null, set name to "same-origin".
+                if (!destination_browsing_context)
+                    name = "same-origin"_string;
+                // 2. Otherwise, if culpritBC is an ancestor of destinationBC, set name to "same-origin-ancestor".
+                else if (culprit_browsing_context->is_ancestor_of(*destination_browsing_context))
+                    name = "same-origin-ancestor"_string;
+                // 3. Otherwise, if destinationBC is an ancestor of culpritBC, set name to "same-origin-descendant".
+                else if (destination_browsing_context->is_ancestor_of(*culprit_browsing_context))
+                    name = "same-origin-descendant"_string;
+                // 4. Otherwise, set name to "same-origin".
+                else
+                    name = "same-origin"_string;
+            }
+            // 9. Otherwise:
+            else {
+                // 1. If culpritBC is an ancestor of destinationBC, set name to "cross-origin-ancestor" and set
+                //    culpritSettings to null.
+                // NOTE: This is not allowed because the container might not be in the same process.
+                if (destination_browsing_context && culprit_browsing_context->is_ancestor_of(*destination_browsing_context)) {
+                    name = "cross-origin-ancestor"_string;
+                    culprit_settings = nullptr;
+                }
+                // 2. Otherwise, if destinationBC is an ancestor of culpritBC, set name to "cross-origin-descendant".
+                else if (destination_browsing_context && destination_browsing_context->is_ancestor_of(*culprit_browsing_context)) {
+                    name = "cross-origin-descendant"_string;
+                }
+                // 3. Otherwise, set name to "cross-origin-unreachable".
+                else {
+                    name = "cross-origin-unreachable"_string;
+                }
+            }
+        }
+
+        // 4. Let attribution be a new TaskAttributionTiming object with destinationRealm and set its attributes as
+        //    follows:
+        // 1. Set attribution's name attribute to "unknown".
+        // 2. Set attribution's entryType attribute to "taskattribution".
+        // 3. Set attribution's startTime and duration to 0.
+        // 4. Set attribution's containerType attribute to "window".
+        auto container_type = "window"_string;
+
+        // 5. Set attribution's containerName and containerSrc attributes to the empty string.
+        String container_name;
+        String container_src;
+        String container_id;
+
+        // 6. If culpritSettings is not null:
+        if (culprit_settings) {
+            // 1. Let culpritBC be culpritSettings's global object's browsing context.
+            // 2. Assert: culpritBC is not null.
+            auto& culprit_window = as<HTML::Window>(culprit_settings->global_object());
+
+            // 3. Let container be culpritBC's browsing context container.
+            // 4. Assert: container is not null.
+            // NOTE: The container is null if the culprit is a top-level browsing context, which the spec does not
+            //       account for. There is nothing more to attribute then.
+            GC::Ptr<HTML::NavigableContainer> container;
+            if (auto navigable = culprit_window.navigable())
+                container = navigable->container();
+
+            if (container) {
+                // 5. Set attribution's containerId attribute to the value of container's ID content attribute, or the
+                //    empty string if the attribute is absent.
+                container_id = container->get_attribute_value(HTML::AttributeNames::id);
+
+                // 6. If container is an iframe element:
+                if (is<HTML::HTMLIFrameElement>(*container)) {
+                    // 1. Set attribution's containerType attribute to "iframe".
+                    container_type = "iframe"_string;
+
+                    // 2. Set attribution's containerName attribute to the value of container's name content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_name = container->get_attribute_value(HTML::AttributeNames::name);
+
+                    // 3. Set attribution's containerSrc attribute to the value of container's src content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_src = container->get_attribute_value(HTML::AttributeNames::src);
+                }
+                // 7. If container is a frame element:
+                else if (is<HTML::HTMLFrameElement>(*container)) {
+                    // 1. Set attribution's containerType attribute to "frame".
+                    container_type = "frame"_string;
+
+                    // 2. Set attribution's containerName attribute to the value of container's name content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_name = container->get_attribute_value(HTML::AttributeNames::name);
+
+                    // 3. Set attribution's containerSrc attribute to the value of container's src content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_src = container->get_attribute_value(HTML::AttributeNames::src);
+                }
+                // 8. If container is an object element:
+                else if (is<HTML::HTMLObjectElement>(*container)) {
+                    // 1. Set attribution's containerType attribute to "object".
+                    container_type = "object"_string;
+
+                    // 2. Set attribution's containerName attribute to the value of container's name content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_name = container->get_attribute_value(HTML::AttributeNames::name);
+
+                    // 3. Set attribution's containerSrc attribute to the value of container's data content attribute,
+                    //    or the empty string if the attribute is absent.
+                    container_src = container->get_attribute_value(HTML::AttributeNames::data);
+                }
+            }
+        }
+
+        auto attribution = TaskAttributionTiming::create(destination_realm, move(container_type), move(container_src), move(container_id), move(container_name));
+
+        // 5. Create a new PerformanceLongTaskTiming object newEntry with destinationRealm and set its attributes as
+        //    follows:
+        // 1. Set newEntry's name attribute to name.
+        // 2. Set newEntry's entryType attribute to "longtask".
+        // 3. Set newEntry's startTime attribute to the result of coarsening start time given destinationSettings's
+        //    cross-origin isolated capability.
+        auto& destination_global = destination_settings.global_object();
+        auto entry_start_time = HighResolutionTime::relative_high_resolution_time(start_time, destination_global);
+
+        // 4. Let dur be the result of coarsening end time given destinationSettings's cross-origin isolated
+        //    capability, minus newEntry's startTime.
+        auto duration = HighResolutionTime::relative_high_resolution_time(end_time, destination_global) - entry_start_time;
+
+        // 5. Set newEntry's duration attribute to the integer part of dur.
+        // 6. Set newEntry's attribution attribute to a new frozen array containing the single value attribution.
+        auto new_entry = destination_realm->create<PerformanceLongTaskTiming>(destination_realm, name, entry_start_time, AK::trunc(duration), attribution);
+
+        // 6. Queue the PerformanceEntry newEntry.
+        auto& window_or_worker = as<HTML::WindowOrWorkerGlobalScopeMixin>(destination_global);
+        window_or_worker.queue_performance_entry(new_entry);
+        window_or_worker.add_performance_entry(new_entry, HTML::WindowOrWorkerGlobalScopeMixin::CheckIfPerformanceBufferIsFull::Yes);
+    }
+}
+
+}
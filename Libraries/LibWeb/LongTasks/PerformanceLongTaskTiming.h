@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+#include <LibWeb/LongTasks/TaskAttributionTiming.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongTasks {
+
+// https://w3c.github.io/longtasks/#long-tasks-threshold
+constexpr HighResolutionTime::DOMHighResTimeStamp long_tasks_threshold = 50;
+
+// https://w3c.github.io/longtasks/#sec-PerformanceLongTaskTiming
+class PerformanceLongTaskTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceLongTaskTiming, PerformanceTimeline::PerformanceEntry);
+    GC_DECLARE_ALLOCATOR(PerformanceLongTaskTiming);
+
+public:
+    virtual ~PerformanceLongTaskTiming() override;
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::No; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 200; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::Yes; }
+
+    virtual FlyString const& entry_type() const override;
+
+    Vector<GC::Ref<TaskAttributionTiming>> const& attribution() const { return m_attribution; }
+
+private:
+    PerformanceLongTaskTiming(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, GC::Ref<TaskAttributionTiming>);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(JS::Cell::Visitor&) override;
+
+    // https://w3c.github.io/longtasks/#dom-performancelongtasktiming-attribution
+    Vector<GC::Ref<TaskAttributionTiming>> m_attribution;
+};
+
+void report_long_tasks(HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp end_time, Vector<GC::Ref<HTML::BrowsingContext>> const& top_level_browsing_contexts, HTML::Task const&);
+
+}
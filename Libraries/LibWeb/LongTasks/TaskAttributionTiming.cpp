@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/TaskAttributionTimingPrototype.h>
+#include <LibWeb/LongTasks/TaskAttributionTiming.h>
+
+namespace Web::LongTasks {
+
+GC_DEFINE_ALLOCATOR(TaskAttributionTiming);
+
+GC::Ref<TaskAttributionTiming> TaskAttributionTiming::create(JS::Realm& realm, String container_type, String container_src, String container_id, String container_name)
+{
+    return realm.create<TaskAttributionTiming>(realm, move(container_type), move(container_src), move(container_id), move(container_name));
+}
+
+// https://w3c.github.io/longtasks/#report-long-tasks
+TaskAttributionTiming::TaskAttributionTiming(JS::Realm& realm, String container_type, String container_src, String container_id, String container_name)
+    // 1. Set attribution's name attribute to "unknown".
+    // 3. Set attribution's startTime and duration to 0.
+    : PerformanceTimeline::PerformanceEntry(realm, "unknown"_string, 0, 0)
+    , m_container_type(move(container_type))
+    , m_container_src(move(container_src))
+    , m_container_id(move(container_id))
+    , m_container_name(move(container_name))
+{
+}
+
+TaskAttributionTiming::~TaskAttributionTiming() = default;
+
+void TaskAttributionTiming::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(TaskAttributionTiming);
+    Base::initialize(realm);
+}
+
+FlyString const& TaskAttributionTiming::entry_type() const
+{
+    // 2. Set attribution's entryType attribute to "taskattribution".
+    static FlyString const entry_type = "taskattribution"_fly_string;
+    return entry_type;
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongTasks {
+
+// https://w3c.github.io/longtasks/#sec-TaskAttributionTiming
+class TaskAttributionTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(TaskAttributionTiming, PerformanceTimeline::PerformanceEntry);
+    GC_DECLARE_ALLOCATOR(TaskAttributionTiming);
+
+public:
+    static GC::Ref<TaskAttributionTiming> create(JS::Realm&, String container_type, String container_src, String container_id, String container_name);
+
+    virtual ~TaskAttributionTiming() override;
+
+    // NOTE: TaskAttributionTiming entries are never queued, so they are not in the registry.
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::No; }
+
+    virtual FlyString const& entry_type() const override;
+
+    String const& container_type() const { return m_container_type; }
+    String const& container_src() const { return m_container_src; }
+    String const& container_id() const { return m_container_id; }
+    String const& container_name() const { return m_container_name; }
+
+private:
+    TaskAttributionTiming(JS::Realm&, String container_type, String container_src, String container_id, String container_name);
+
+    virtual void initialize(JS::Realm&) override;
+
+    // https://w3c.github.io/longtasks/#dom-taskattributiontiming-containertype
+    String m_container_type;
+
+    // https://w3c.github.io/longtasks/#dom-taskattributiontiming-containersrc
+    String m_container_src;
+
+    // https://w3c.github.io/longtasks/#dom-taskattributiontiming-containerid
+    String m_container_id;
+
+    // https://w3c.github.io/longtasks/#dom-taskattributiontiming-containername
+    String m_container_name;
+};
+
+}
@@ -12,6 +12,7 @@
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Editing/Internal/Algorithms.h>
 #include <LibWeb/HTML/CloseWatcherManager.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Focus.h>
 #include <LibWeb/HTML/HTMLAnchorElement.h>
 #include <LibWeb/HTML/HTMLDialogElement.h>
@@ -378,7 +379,7 @@ Painting::PaintableBox const* EventHandler::paint_root() const
     return m_navigable->active_document()->paintable_box();
 }
 
-EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers, int wheel_delta_x, int wheel_delta_y)
+EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers, int wheel_delta_x, int wheel_delta_y, bool has_already_scrolled)
 {
     if (should_ignore_device_input_event())
         return EventResult::Dropped;
@@ -403,18 +404,20 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSS
         paintable = result->paintable;
 
     if (paintable) {
-        auto* containing_block = paintable->containing_block();
-        while (containing_block) {
-            auto handled_scroll_event = containing_block->handle_mousewheel({}, viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y);
-            if (handled_scroll_event)
-                return EventResult::Handled;
+        if (!has_already_scrolled) {
+            auto* containing_block = paintable->containing_block();
+            while (containing_block) {
+                auto handled_scroll_event = containing_block->handle_mousewheel({}, viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y);
+                if (handled_scroll_event)
+                    return EventResult::Handled;
+
+                containing_block = containing_block->containing_block();
+            }
 
-            containing_block = containing_block->containing_block();
+            if (paintable->handle_mousewheel({}, viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y))
+                return EventResult::Handled;
         }
 
-        if (paintable->handle_mousewheel({}, viewport_position, buttons, modifiers, wheel_delta_x, wheel_delta_y))
-            return EventResult::Handled;
-
         auto node = dom_node_for_event_dispatch(*paintable);
 
         if (node) {
@@ -434,7 +437,8 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSS
             auto page_offset = compute_mouse_event_page_offset(viewport_position);
             auto offset = compute_mouse_event_offset(page_offset, *layout_node->first_paintable());
             if (node->dispatch_event(UIEvents::WheelEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::wheel, screen_position, page_offset, viewport_position, offset, wheel_delta_x, wheel_delta_y, button, buttons, modifiers).release_value_but_fixme_should_propagate_errors())) {
-                m_navigable->active_window()->scroll_by(wheel_delta_x, wheel_delta_y);
+                if (!has_already_scrolled)
+                    m_navigable->active_window()->scroll_by(wheel_delta_x, wheel_delta_y);
             }
 
             handled_event = EventResult::Handled;
@@ -444,6 +448,70 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSS
     return handled_event;
 }
 
+static bool has_non_passive_wheel_event_listener(DOM::Node& node)
+{
+    for (auto* ancestor = &node; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+        if (ancestor->has_non_passive_event_listener(UIEvents::EventNames::wheel))
+            return true;
+    }
+    auto window = node.document().window();
+    return window && window->has_non_passive_event_listener(UIEvents::EventNames::wheel);
+}
+
+// Does the same scrolling as handle_mousewheel() would, but as soon as a wheel event is received, rather than once
+// input events are processed, which only happens during the next rendering update. That way, a page that's busy
+// running tasks keeps scrolling smoothly. This is only done when no listener that could cancel the event would be
+// dispatched to, because handle_mousewheel() only scrolls the viewport for events that weren't cancelled.
+MouseWheelScrollResult EventHandler::scroll_for_mousewheel_ahead_of_dispatch(CSSPixelPoint viewport_position, unsigned modifiers, int wheel_delta_x, int wheel_delta_y)
+{
+    if (should_ignore_device_input_event())
+        return MouseWheelScrollResult::NotScrolled;
+
+    auto document = m_navigable->active_document();
+    if (!document || !document->is_fully_active())
+        return MouseWheelScrollResult::NotScrolled;
+
+    // NOTE: We can get here while a task is waiting for something in the middle of running, which must not see the
+    //       page change underneath it.
+    auto& event_loop = HTML::main_thread_event_loop();
+    if (event_loop.currently_running_task() || event_loop.execution_paused())
+        return MouseWheelScrollResult::NotScrolled;
+
+    document->update_layout(DOM::UpdateLayoutReason::EventHandlerHandleMouseWheel);
+
+    if (!paint_root())
+        return MouseWheelScrollResult::NotScrolled;
+
+    if (modifiers & UIEvents::KeyModifier::Mod_Shift)
+        swap(wheel_delta_x, wheel_delta_y);
+
+    GC::Ptr<Painting::Paintable> paintable;
+    if (auto result = target_for_mouse_position(viewport_position); result.has_value())
+        paintable = result->paintable;
+    if (!paintable)
+        return MouseWheelScrollResult::NotScrolled;
+
+    auto node = dom_node_for_event_dispatch(*paintable);
+    if (!node || is<HTML::HTMLIFrameElement>(*node))
+        return MouseWheelScrollResult::NotScrolled;
+
+    Layout::Node* layout_node;
+    if (!parent_element_for_event_dispatch(*paintable, node, layout_node))
+        return MouseWheelScrollResult::NotScrolled;
+    if (has_non_passive_wheel_event_listener(*node))
+        return MouseWheelScrollResult::NotScrolled;
+
+    for (auto* containing_block = paintable->containing_block(); containing_block; containing_block = containing_block->containing_block()) {
+        if (containing_block->handle_mousewheel({}, viewport_position, 0, modifiers, wheel_delta_x, wheel_delta_y))
+            return MouseWheelScrollResult::ScrolledElement;
+    }
+    if (paintable->handle_mousewheel({}, viewport_position, 0, modifiers, wheel_delta_x, wheel_delta_y))
+        return MouseWheelScrollResult::ScrolledElement;
+
+    m_navigable->active_window()->scroll_by(wheel_delta_x, wheel_delta_y);
+    return MouseWheelScrollResult::ScrolledViewport;
+}
+
 EventResult EventHandler::handle_mouseup(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers)
 {
     if (should_ignore_device_input_event())
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/OwnPtr.h>
+#include <AK/Time.h>
 #include <AK/Variant.h>
 #include <AK/Vector.h>
 #include <LibGfx/Point.h>
@@ -89,6 +90,21 @@ struct QueuedInputEvent {
     u64 page_id { 0 };
     InputEvent event;
     size_t coalesced_event_count { 0 };
+    MonotonicTime queued_time { MonotonicTime::now() };
+
+    // Set for wheel events that were already scrolled for when they were received, which only have to be dispatched.
+    bool has_already_scrolled { false };
+};
+
+enum class MouseWheelScrollResult {
+    // Nothing was scrolled, and the event has to be handled as usual.
+    NotScrolled,
+
+    // An element was scrolled, which consumes the event. It must not be dispatched.
+    ScrolledElement,
+
+    // The viewport was scrolled. The event still has to be dispatched, but without scrolling again.
+    ScrolledViewport,
 };
 
 }
@@ -209,9 +209,18 @@ EventResult Page::handle_mousemove(DevicePixelPoint position, DevicePixelPoint s
     return top_level_traversable()->event_handler().handle_mousemove(device_to_css_point(position), device_to_css_point(screen_position), buttons, modifiers);
 }
 
-EventResult Page::handle_mousewheel(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y)
+EventResult Page::handle_mousewheel(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y, bool has_already_scrolled)
 {
-    return top_level_traversable()->event_handler().handle_mousewheel(device_to_css_point(position), device_to_css_point(screen_position), button, buttons, modifiers, wheel_delta_x.value(), wheel_delta_y.value());
+    return top_level_traversable()->event_handler().handle_mousewheel(device_to_css_point(position), device_to_css_point(screen_position), button, buttons, modifiers, wheel_delta_x.value(), wheel_delta_y.value(), has_already_scrolled);
+}
+
+MouseWheelScrollResult Page::scroll_for_mousewheel_ahead_of_dispatch(DevicePixelPoint position, unsigned modifiers, DevicePixels wheel_delta_x, DevicePixels wheel_delta_y)
+{
+    auto traversable = top_level_traversable();
+    auto result = traversable->event_handler().scroll_for_mousewheel_ahead_of_dispatch(device_to_css_point(position), modifiers, wheel_delta_x.value(), wheel_delta_y.value());
+    if (result != MouseWheelScrollResult::NotScrolled)
+        traversable->paint_next_frame_if_only_scroll_offsets_changed();
+    return result;
 }
 
 EventResult Page::handle_doubleclick(DevicePixelPoint position, DevicePixelPoint screen_position, unsigned button, unsigned buttons, unsigned modifiers)
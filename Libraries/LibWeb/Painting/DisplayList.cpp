@@ -9,11 +9,78 @@
 
 namespace Web::Painting {
 
+static bool command_only_affects_painting_state(Command const& command)
+{
+    return command.has<Translate>() || command.has<AddClipRect>() || command.has<AddRoundedRectClip>() || command.has<AddMask>() || command.has<ApplyTransform>();
+}
+
+static bool command_opens_layer_that_is_invisible_when_empty(Command const& command)
+{
+    // NOTE: Layers with a filter or a compositing operator are excluded, as those can change pixels even when empty.
+    return command.has<Save>() || command.has<SaveLayer>() || command.has<ApplyOpacity>();
+}
+
+bool DisplayList::try_remove_empty_save_restore_pair()
+{
+    for (size_t i = m_commands.size(); i > 0; --i) {
+        auto const& command = m_commands[i - 1].command;
+        if (command_only_affects_painting_state(command))
+            continue;
+        if (!command_opens_layer_that_is_invisible_when_empty(command))
+            return false;
+        while (m_commands.size() >= i)
+            (void)m_commands.take_last();
+        return true;
+    }
+    return false;
+}
+
+bool DisplayList::try_merge_with_last_fill_rect(FillRect const& fill_rect, Optional<i32> scroll_frame_id, ClipFrame const* clip_frame)
+{
+    if (m_commands.is_empty())
+        return false;
+    auto& last_item = m_commands.last();
+    if (!last_item.command.has<FillRect>() || last_item.scroll_frame_id != scroll_frame_id || last_item.clip_frame.ptr() != clip_frame)
+        return false;
+    auto& last_fill_rect = last_item.command.get<FillRect>();
+    if (last_fill_rect.color != fill_rect.color)
+        return false;
+
+    auto const& a = last_fill_rect.rect;
+    auto const& b = fill_rect.rect;
+    bool const stacked_vertically = a.x() == b.x() && a.width() == b.width() && (a.bottom() == b.top() || b.bottom() == a.top());
+    bool const stacked_horizontally = a.y() == b.y() && a.height() == b.height() && (a.right() == b.left() || b.right() == a.left());
+    if (!stacked_vertically && !stacked_horizontally)
+        return false;
+    last_fill_rect.rect.unite(fill_rect.rect);
+    return true;
+}
+
 void DisplayList::append(Command&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const> clip_frame)
 {
+    // OPTIMIZATION: Drop save/restore and stacking context pairs with nothing painted between them, and merge
+    //               adjacent fills of the same color into a single rect, so there is less to do during playback.
+    if (command.has<Restore>() && try_remove_empty_save_restore_pair())
+        return;
+    if (command.has<PopStackingContext>() && !m_commands.is_empty() && m_commands.last().command.has<PushStackingContext>()) {
+        (void)m_commands.take_last();
+        return;
+    }
+    if (command.has<FillRect>() && try_merge_with_last_fill_rect(command.get<FillRect>(), scroll_frame_id, clip_frame))
+        return;
+
     m_commands.append({ scroll_frame_id, clip_frame, move(command) });
 }
 
+void DisplayList::append_commands_from(DisplayList const& other, size_t start, size_t end)
+{
+    VERIFY(start <= end && end <= other.m_commands.size());
+    for (size_t i = start; i < end; ++i) {
+        auto item = other.m_commands[i];
+        m_commands.append(move(item));
+    }
+}
+
 String DisplayList::dump() const
 {
     StringBuilder builder;
@@ -48,13 +115,55 @@ static bool command_is_clip_or_mask(Command const& command)
 
 void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
 {
-    if (surface) {
-        surface->lock_context();
+    if (!surface) {
+        execute_impl(display_list, scroll_state, surface);
+        return;
+    }
+
+    surface->lock_context();
+
+    // OPTIMIZATION: If the surface already contains this display list rasterized with the same scroll state, the only
+    //               pixels that can differ are those covered by painting surfaces (e.g. canvases), so only that area
+    //               is rasterized again.
+    Optional<Gfx::IntRect> damage_rect;
+    auto previous_frame_index = m_rasterized_frames.find_first_index_if([&](auto const& frame) { return frame.surface.ptr() == surface.ptr(); });
+    if (previous_frame_index.has_value()) {
+        auto const& previous_frame = m_rasterized_frames[*previous_frame_index];
+        if (previous_frame.display_list.ptr() == &display_list && previous_frame.scroll_state == scroll_state && previous_frame.can_rasterize_only_painting_surfaces)
+            damage_rect = previous_frame.painting_surfaces_rect;
+        else
+            m_rasterized_frames.remove(*previous_frame_index);
     }
-    execute_impl(display_list, scroll_state, surface);
-    if (surface) {
-        surface->unlock_context();
+
+    if (damage_rect.has_value()) {
+        if (!damage_rect->is_empty()) {
+            m_damage_rect = damage_rect;
+            execute_impl(display_list, scroll_state, surface);
+            m_damage_rect = {};
+        }
+    } else {
+        if (m_rasterized_frames.size() >= max_rasterized_frames)
+            m_rasterized_frames.take_first();
+        m_rasterized_frames.append({ .surface = *surface, .display_list = display_list, .scroll_state = scroll_state });
+        m_frame_being_rasterized = &m_rasterized_frames.last();
+        execute_impl(display_list, scroll_state, surface);
+        m_frame_being_rasterized = nullptr;
+    }
+
+    surface->unlock_context();
+}
+
+void DisplayListPlayer::did_draw_painting_surface(Gfx::IntRect device_rect)
+{
+    if (!m_frame_being_rasterized)
+        return;
+
+    // NOTE: Rects drawn into an intermediate surface (e.g. a mask) are not in the target surface's coordinates.
+    if (m_surfaces.size() != 1) {
+        m_frame_being_rasterized->can_rasterize_only_painting_surfaces = false;
+        return;
     }
+    m_frame_being_rasterized->painting_surfaces_rect.unite(device_rect);
 }
 
 void DisplayListPlayer::apply_clip_frame(ClipFrame const& clip_frame, DevicePixelConverter const& device_pixel_converter)
@@ -102,10 +211,26 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    bool const is_rasterizing_damage_rect_only = surface && m_surfaces.size() == 1 && m_damage_rect.has_value();
+    if (is_rasterizing_damage_rect_only) {
+        save({});
+        add_clip_rect({ .rect = *m_damage_rect });
+    }
+
+    // NOTE: Images within one surface height above or below the surface are prepared ahead of being scrolled into view.
+    auto image_preparation_rect = surface().rect().inflated(0, surface().rect().height() * 2);
+
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
-        auto [scroll_frame_id, clip_frame, command] = commands[command_index];
+        auto const& [scroll_frame_id, clip_frame, recorded_command] = commands[command_index];
+
+        // OPTIMIZATION: Only copy the commands that have to be adjusted for the current scroll state. Copying all of
+        //               them would needlessly churn the reference counts of the resources they hold.
+        Optional<Command> adjusted_command;
+        if (scroll_frame_id.has_value() || recorded_command.has<PaintScrollBar>())
+            adjusted_command = recorded_command;
+        Command const& command = adjusted_command.has_value() ? *adjusted_command : recorded_command;
 
         if (clip_frames_stack.last() != clip_frame) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
@@ -129,8 +254,13 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             }
         }
 
+        // Filters can spread pixels of a painting surface beyond its rect, and nested display lists have their own
+        // scroll state, so frames containing any of these always need to be rasterized in full.
+        if (m_frame_being_rasterized && (command.has<ApplyFilter>() || command.has<ApplyBackdropFilter>() || command.has<PaintNestedDisplayList>()))
+            m_frame_being_rasterized->can_rasterize_only_painting_surfaces = false;
+
         if (command.has<PaintScrollBar>()) {
-            auto& paint_scroll_bar = command.get<PaintScrollBar>();
+            auto& paint_scroll_bar = adjusted_command->get<PaintScrollBar>();
             auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
             if (paint_scroll_bar.vertical) {
                 auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
@@ -144,7 +274,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         if (scroll_frame_id.has_value()) {
             auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
             auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
-            command.visit(
+            adjusted_command->visit(
                 [&](auto& command) {
                     if constexpr (requires { command.translate_by(scroll_offset); }) {
                         command.translate_by(scroll_offset);
@@ -154,6 +284,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
         auto bounding_rect = command_bounding_rectangle(command);
         if (bounding_rect.has_value() && (bounding_rect->is_empty() || would_be_fully_clipped_by_painter(*bounding_rect))) {
+            if (command.has<DrawScaledImmutableBitmap>() && m_surfaces.size() == 1 && image_preparation_rect.intersects(*bounding_rect))
+                prepare_image_for_drawing(*command.get<DrawScaledImmutableBitmap>().bitmap);
+
             // Any clip or mask that's located outside of the visible region is equivalent to a simple clip-rect,
             // so replace it with one to avoid doing unnecessary work.
             if (command_is_clip_or_mask(command)) {
@@ -220,6 +353,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
     }
 
+    if (is_rasterizing_damage_rect_only)
+        restore({});
+
     if (surface)
         flush();
 }
@@ -33,6 +33,9 @@ protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
     void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
 
+    // Must be called by implementations whenever a painting surface is drawn, with the device rect it covers.
+    void did_draw_painting_surface(Gfx::IntRect device_rect);
+
 private:
     virtual void flush() = 0;
     virtual void draw_glyph_run(DrawGlyphRun const&) = 0;
@@ -75,10 +78,28 @@ private:
     virtual void apply_mask_bitmap(ApplyMaskBitmap const&) = 0;
     virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect) const = 0;
 
+    // Called for images that aren't visible yet, but are close enough to the visible area to be scrolled into it soon.
+    virtual void prepare_image_for_drawing(Gfx::ImmutableBitmap const&) { }
+
     void apply_clip_frame(ClipFrame const&, DevicePixelConverter const&);
     void remove_clip_frame(ClipFrame const&);
 
     Vector<NonnullRefPtr<Gfx::PaintingSurface>, 1> m_surfaces;
+
+    // What was last rasterized into a target surface. If the same display list is executed again with the same
+    // scroll state, only the contents of the painting surfaces it draws (e.g. canvases) can have changed.
+    struct RasterizedFrame {
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+        NonnullRefPtr<DisplayList> display_list;
+        ScrollStateSnapshot scroll_state;
+        Gfx::IntRect painting_surfaces_rect {};
+        bool can_rasterize_only_painting_surfaces { true };
+    };
+    // NOTE: Two frames are enough to cover double-buffered backing stores.
+    static constexpr size_t max_rasterized_frames = 2;
+    Vector<RasterizedFrame, max_rasterized_frames> m_rasterized_frames;
+    RasterizedFrame* m_frame_being_rasterized { nullptr };
+    Optional<Gfx::IntRect> m_damage_rect;
 };
 
 class DisplayList : public AtomicRefCounted<DisplayList> {
@@ -90,6 +111,9 @@ public:
 
     void append(Command&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const>);
 
+    // Appends the commands in [start, end) of another display list as they are, without compacting them.
+    void append_commands_from(DisplayList const&, size_t start, size_t end);
+
     struct CommandListItem {
         Optional<i32> scroll_frame_id;
         RefPtr<ClipFrame const> clip_frame;
@@ -97,6 +121,7 @@ public:
     };
 
     AK::SegmentedVector<CommandListItem, 512> const& commands() const { return m_commands; }
+    CommandListItem& command_at(size_t index) { return m_commands[index]; }
 
     void set_device_pixels_per_css_pixel(double device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
@@ -106,6 +131,9 @@ public:
 private:
     DisplayList() = default;
 
+    bool try_remove_empty_save_restore_pair();
+    bool try_merge_with_last_fill_rect(FillRect const&, Optional<i32> scroll_frame_id, ClipFrame const*);
+
     AK::SegmentedVector<CommandListItem, 512> m_commands;
     double m_device_pixels_per_css_pixel;
 };
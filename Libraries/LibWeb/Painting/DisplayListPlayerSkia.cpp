@@ -9,6 +9,7 @@
 #include <core/SkBlurTypes.h>
 #include <core/SkCanvas.h>
 #include <core/SkFont.h>
+#include <core/SkImage.h>
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
@@ -19,6 +20,7 @@
 #include <effects/SkImageFilters.h>
 #include <effects/SkRuntimeEffect.h>
 #include <gpu/GrDirectContext.h>
+#include <gpu/ganesh/SkImageGanesh.h>
 #include <gpu/ganesh/SkSurfaceGanesh.h>
 #include <pathops/SkPathOps.h>
 
@@ -135,6 +137,53 @@ void DisplayListPlayerSkia::draw_painting_surface(DrawPaintingSurface const& com
     auto image = sk_surface.makeImageSnapshot();
     SkPaint paint;
     canvas.drawImageRect(image, src_rect, dst_rect, to_skia_sampling_options(command.scaling_mode), &paint, SkCanvas::kStrict_SrcRectConstraint);
+
+    auto device_rect = canvas.getTotalMatrix().mapRect(dst_rect).roundOut();
+    if (device_rect.intersect(canvas.getDeviceClipBounds()))
+        did_draw_painting_surface({ device_rect.x(), device_rect.y(), device_rect.width(), device_rect.height() });
+}
+
+struct DisplayListPlayerSkia::CachedDownscaledImages {
+    struct Entry {
+        u32 image_id;
+        Gfx::IntSize size;
+        sk_sp<SkImage> image;
+        size_t size_in_bytes;
+    };
+
+    static constexpr size_t max_entries = 64;
+    static constexpr size_t max_size_in_bytes = 64 * MiB;
+
+    // NOTE: Entries are kept in most recently used order.
+    Vector<Entry> entries;
+    size_t size_in_bytes { 0 };
+};
+
+SkImage const* DisplayListPlayerSkia::downscaled_image_for_drawing(SkImage const& image, Gfx::IntSize size)
+{
+    if (!m_cached_downscaled_images)
+        m_cached_downscaled_images = make<CachedDownscaledImages>();
+    auto& cache = *m_cached_downscaled_images;
+
+    if (auto index = cache.entries.find_first_index_if([&](auto const& entry) { return entry.image_id == image.uniqueID() && entry.size == size; }); index.has_value()) {
+        auto entry = cache.entries.take(*index);
+        cache.entries.prepend(move(entry));
+        return cache.entries.first().image.get();
+    }
+
+    SkBitmap bitmap;
+    if (!bitmap.tryAllocPixels(image.imageInfo().makeWH(size.width(), size.height())))
+        return nullptr;
+    if (!image.scalePixels(bitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kLinear)))
+        return nullptr;
+    bitmap.setImmutable();
+
+    auto size_in_bytes = bitmap.computeByteSize();
+    while (!cache.entries.is_empty() && (cache.entries.size() >= CachedDownscaledImages::max_entries || cache.size_in_bytes + size_in_bytes > CachedDownscaledImages::max_size_in_bytes))
+        cache.size_in_bytes -= cache.entries.take_last().size_in_bytes;
+    cache.entries.prepend({ image.uniqueID(), size, bitmap.asImage(), size_in_bytes });
+    cache.size_in_bytes += size_in_bytes;
+    return cache.entries.first().image.get();
 }
 
 void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const& command)
@@ -142,10 +191,27 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     auto dst_rect = to_skia_rect(command.dst_rect);
     auto clip_rect = to_skia_rect(command.clip_rect);
     auto& canvas = surface().canvas();
+    auto sampling_options = to_skia_sampling_options(command.scaling_mode);
+
+    // OPTIMIZATION: When a large image is drawn much smaller than its natural size, sampling the full image on every
+    //               frame is both slow and prone to aliasing. Instead, scale it down once (with mipmapping) to the
+    //               size it is drawn at, and draw that 1:1 from then on.
+    SkImage const* image = command.bitmap->sk_image();
+    auto const& matrix = canvas.getTotalMatrix();
+    auto dst_size = command.dst_rect.size();
+    bool const is_smooth_scaling_mode = command.scaling_mode == Gfx::ScalingMode::BilinearBlend || command.scaling_mode == Gfx::ScalingMode::BoxSampling;
+    if (is_smooth_scaling_mode && matrix.isTranslate() && !image->isTextureBacked() && !dst_size.is_empty()
+        && dst_size.width() * 2 <= image->width() && dst_size.height() * 2 <= image->height()) {
+        if (auto const* downscaled_image = downscaled_image_for_drawing(*image, dst_size)) {
+            image = downscaled_image;
+            sampling_options = SkSamplingOptions(SkFilterMode::kLinear);
+        }
+    }
+
     SkPaint paint;
     canvas.save();
     canvas.clipRect(clip_rect);
-    canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+    canvas.drawImageRect(image, dst_rect, sampling_options, &paint);
     canvas.restore();
 }
 
@@ -479,16 +545,20 @@ void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& co
     add_spread_distance_to_corner_radius(corner_radii.bottom_right);
     add_spread_distance_to_corner_radius(corner_radii.bottom_left);
 
-    auto& canvas = surface().canvas();
-    canvas.save();
-    canvas.clipRRect(content_rrect, SkClipOp::kDifference, true);
-    SkPaint paint;
-    paint.setAntiAlias(true);
-    paint.setColor(to_skia_color(color));
-    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
-    auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
-    canvas.drawRRect(shadow_rounded_rect, paint);
-    canvas.restore();
+    // NOTE: A blur with sigma s spreads out up to 3s pixels, and the blur radius is twice the sigma.
+    auto shadow_bounds = shadow_rect.inflated(blur_radius * 2, blur_radius * 2);
+
+    draw_box_shadow(outer_box_shadow_params, shadow_bounds, [&](SkCanvas& canvas) {
+        canvas.save();
+        canvas.clipRRect(content_rrect, SkClipOp::kDifference, true);
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        paint.setColor(to_skia_color(color));
+        paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
+        auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
+        canvas.drawRRect(shadow_rounded_rect, paint);
+        canvas.restore();
+    });
 }
 
 void DisplayListPlayerSkia::paint_inner_box_shadow(PaintInnerBoxShadow const& command)
@@ -522,28 +592,116 @@ void DisplayListPlayerSkia::paint_inner_box_shadow(PaintInnerBoxShadow const& co
     add_spread_distance_to_corner_radius(inner_rect_corner_radii.bottom_right);
     add_spread_distance_to_corner_radius(inner_rect_corner_radii.bottom_left);
 
-    auto outer_rect = to_skia_rrect(outer_shadow_rect, corner_radii);
-    auto inner_rect = to_skia_rrect(inner_shadow_rect, inner_rect_corner_radii);
+    // NOTE: Inner shadows are clipped to the content rect, so nothing is painted outside of it.
+    draw_box_shadow(outer_box_shadow_params, device_content_rect, [&](SkCanvas& canvas) {
+        auto outer_rect = to_skia_rrect(outer_shadow_rect, corner_radii);
+        auto inner_rect = to_skia_rrect(inner_shadow_rect, inner_rect_corner_radii);
 
-    SkPath outer_path;
-    outer_path.addRRect(outer_rect);
-    SkPath inner_path;
-    inner_path.addRRect(inner_rect);
+        SkPath outer_path;
+        outer_path.addRRect(outer_rect);
+        SkPath inner_path;
+        inner_path.addRRect(inner_rect);
 
-    SkPath result_path;
-    if (!Op(outer_path, inner_path, SkPathOp::kDifference_SkPathOp, &result_path)) {
-        VERIFY_NOT_REACHED();
-    }
+        SkPath result_path;
+        if (!Op(outer_path, inner_path, SkPathOp::kDifference_SkPathOp, &result_path)) {
+            VERIFY_NOT_REACHED();
+        }
 
+        SkPaint path_paint;
+        path_paint.setAntiAlias(true);
+        path_paint.setColor(to_skia_color(color));
+        path_paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
+        canvas.save();
+        canvas.clipRRect(to_skia_rrect(device_content_rect, corner_radii), true);
+        canvas.drawPath(result_path, path_paint);
+        canvas.restore();
+    });
+}
+
+struct DisplayListPlayerSkia::CachedBoxShadows {
+    struct Key {
+        ShadowPlacement placement;
+        Gfx::Color color;
+        CornerRadii corner_radii;
+        int offset_x;
+        int offset_y;
+        int blur_radius;
+        int spread_distance;
+        Gfx::IntSize content_size;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct Entry {
+        Key key;
+        sk_sp<SkImage> image;
+    };
+
+    static constexpr size_t max_entries = 32;
+    static constexpr int max_area_in_pixels = 512 * 512;
+
+    // NOTE: Entries are kept in most recently used order.
+    Vector<Entry> entries;
+};
+
+void DisplayListPlayerSkia::draw_box_shadow(PaintBoxShadowParams const& params, Gfx::IntRect const& shadow_bounds, Function<void(SkCanvas&)> const& paint_shadow)
+{
     auto& canvas = surface().canvas();
-    SkPaint path_paint;
-    path_paint.setAntiAlias(true);
-    path_paint.setColor(to_skia_color(color));
-    path_paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
-    canvas.save();
-    canvas.clipRRect(to_skia_rrect(device_content_rect, corner_radii), true);
-    canvas.drawPath(result_path, path_paint);
-    canvas.restore();
+
+    // OPTIMIZATION: Pages often have lots of elements with identical shadows (e.g. lists of cards), and blurring is
+    //               expensive. Since a shadow only depends on its parameters and the size of the content box, it is
+    //               rasterized once into an image that is then drawn for every shadow with the same key.
+    //               This is only equivalent to painting the shadow directly when the image can be drawn without
+    //               resampling, i.e. when the canvas is translated by a whole number of pixels.
+    auto const& matrix = canvas.getTotalMatrix();
+    bool const can_use_cache = matrix.isTranslate()
+        && SkScalarIsInt(matrix.getTranslateX())
+        && SkScalarIsInt(matrix.getTranslateY())
+        && !shadow_bounds.is_empty()
+        && shadow_bounds.width() * shadow_bounds.height() <= CachedBoxShadows::max_area_in_pixels;
+    if (!can_use_cache) {
+        paint_shadow(canvas);
+        return;
+    }
+
+    if (!m_cached_box_shadows)
+        m_cached_box_shadows = make<CachedBoxShadows>();
+    auto& entries = m_cached_box_shadows->entries;
+
+    CachedBoxShadows::Key key {
+        .placement = params.placement,
+        .color = params.color,
+        .corner_radii = params.corner_radii,
+        .offset_x = params.offset_x,
+        .offset_y = params.offset_y,
+        .blur_radius = params.blur_radius,
+        .spread_distance = params.spread_distance,
+        .content_size = params.device_content_rect.size(),
+    };
+
+    sk_sp<SkImage> image;
+    if (auto index = entries.find_first_index_if([&](auto const& entry) { return entry.key == key; }); index.has_value()) {
+        auto entry = entries.take(*index);
+        image = entry.image;
+        entries.prepend(move(entry));
+    } else {
+        auto shadow_surface = canvas.makeSurface(canvas.imageInfo().makeWH(shadow_bounds.width(), shadow_bounds.height()));
+        if (!shadow_surface) {
+            paint_shadow(canvas);
+            return;
+        }
+        auto& shadow_canvas = *shadow_surface->getCanvas();
+        shadow_canvas.clear(SK_ColorTRANSPARENT);
+        shadow_canvas.translate(-shadow_bounds.x(), -shadow_bounds.y());
+        paint_shadow(shadow_canvas);
+        image = shadow_surface->makeImageSnapshot();
+
+        if (entries.size() >= CachedBoxShadows::max_entries)
+            (void)entries.take_last();
+        entries.prepend({ key, image });
+    }
+
+    canvas.drawImage(image, shadow_bounds.x(), shadow_bounds.y());
 }
 
 void DisplayListPlayerSkia::paint_text_shadow(PaintTextShadow const& command)
@@ -1137,4 +1295,25 @@ bool DisplayListPlayerSkia::would_be_fully_clipped_by_painter(Gfx::IntRect rect)
     return surface().canvas().quickReject(to_skia_rect(rect));
 }
 
+void DisplayListPlayerSkia::prepare_image_for_drawing(Gfx::ImmutableBitmap const& bitmap)
+{
+    if (!m_context)
+        return;
+
+    auto const* image = bitmap.sk_image();
+    if (!image || image->isTextureBacked())
+        return;
+
+    // OPTIMIZATION: Upload images that are about to be scrolled into view, so that the frame in which they first
+    //               appear doesn't have to wait for the upload. The texture is kept in Skia's resource cache (which
+    //               is bounded by the context's resource cache limit), where drawing the image will find it.
+    if (m_prepared_image_ids.contains(image->uniqueID()))
+        return;
+    static constexpr size_t max_prepared_image_ids = 4096;
+    if (m_prepared_image_ids.size() >= max_prepared_image_ids)
+        m_prepared_image_ids.clear();
+    m_prepared_image_ids.set(image->uniqueID());
+    (void)SkImages::TextureFromImage(m_context->sk_context(), image, skgpu::Mipmapped::kNo, skgpu::Budgeted::kYes);
+}
+
 }
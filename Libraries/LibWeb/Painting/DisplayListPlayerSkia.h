@@ -6,12 +6,15 @@
 
 #pragma once
 
+#include <AK/HashTable.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Painting/Command.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 
 class GrDirectContext;
+class SkCanvas;
+class SkImage;
 
 namespace Web::Painting {
 
@@ -63,9 +66,22 @@ private:
     void apply_mask_bitmap(ApplyMaskBitmap const&) override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
+    void prepare_image_for_drawing(Gfx::ImmutableBitmap const&) override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
 
+    // SkImage unique IDs of the images that were already uploaded to the GPU ahead of being drawn.
+    HashTable<u32> m_prepared_image_ids;
+
+    void draw_box_shadow(PaintBoxShadowParams const&, Gfx::IntRect const& shadow_bounds, Function<void(SkCanvas&)> const& paint_shadow);
+
+    struct CachedDownscaledImages;
+    OwnPtr<CachedDownscaledImages> m_cached_downscaled_images;
+    SkImage const* downscaled_image_for_drawing(SkImage const&, Gfx::IntSize);
+
+    struct CachedBoxShadows;
+    OwnPtr<CachedBoxShadows> m_cached_box_shadows;
+
     struct CachedRuntimeEffects;
     OwnPtr<CachedRuntimeEffects> m_cached_runtime_effects;
     CachedRuntimeEffects& cached_runtime_effects();
@@ -9,6 +9,7 @@
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/StackingContext.h>
+#include <LibWeb/Painting/ViewportPaintable.h>
 
 namespace Web::Painting {
 
@@ -153,11 +154,37 @@ StackingContext* Paintable::enclosing_stacking_context()
     VERIFY_NOT_REACHED();
 }
 
+void Paintable::invalidate_display_list(DOM::Document& document)
+{
+    // OPTIMIZATION: Everything this paintable paints is recorded by its nearest stacking context, so only that one
+    //               (and its ancestors) have to be recorded again. Other stacking contexts can reuse their commands.
+    auto const* viewport = document.paintable();
+    StackingContext* stacking_context = nullptr;
+    if (viewport && viewport != this && viewport->stacking_context()) {
+        for (auto* paintable = this; paintable && !stacking_context; paintable = paintable->parent()) {
+            if (paintable->is_paintable_box())
+                stacking_context = const_cast<StackingContext*>(static_cast<PaintableBox const&>(*paintable).stacking_context());
+        }
+    }
+
+    // NOTE: Make sure we are part of the document's current stacking context tree.
+    auto const* root_stacking_context = stacking_context;
+    while (root_stacking_context && root_stacking_context->parent())
+        root_stacking_context = root_stacking_context->parent();
+    if (!root_stacking_context || root_stacking_context != viewport->stacking_context()) {
+        document.invalidate_display_list();
+        return;
+    }
+
+    stacking_context->invalidate_retained_display_list_commands();
+    document.invalidate_display_list_except_retained_commands();
+}
+
 void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
     auto& document = const_cast<DOM::Document&>(this->document());
     if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
+        invalidate_display_list(document);
 
     auto* containing_block = this->containing_block();
     if (!containing_block)
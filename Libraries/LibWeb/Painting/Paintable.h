@@ -151,6 +151,8 @@ protected:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    void invalidate_display_list(DOM::Document&);
+
 private:
     IntrusiveListNode<Paintable> m_list_node;
     GC::Ptr<DOM::Node> m_dom_node;
@@ -1285,7 +1285,10 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
 
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    auto& document = const_cast<DOM::Document&>(this->document());
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        invalidate_display_list(document);
+    document.set_needs_display(absolute_rect(), InvalidateDisplayList::No);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
@@ -7,11 +7,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibGfx/AffineTransform.h>
 #include <LibGfx/Matrix4x4.h>
 #include <LibGfx/Rect.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Painting/Blending.h>
@@ -199,8 +201,75 @@ void StackingContext::paint_descendants(PaintContext& context, Paintable const&
 void StackingContext::paint_child(PaintContext& context, StackingContext const& child)
 {
     VERIFY(!child.paintable_box().layout_node().is_svg_box());
-    const_cast<StackingContext&>(child).set_last_paint_generation_id(context.paint_generation_id());
-    child.paint(context);
+    auto& mutable_child = const_cast<StackingContext&>(child);
+    mutable_child.set_last_paint_generation_id(context.paint_generation_id());
+
+    auto& display_list = context.display_list_recorder().display_list();
+    auto display_list_generation = child.paintable_box().document().display_list_generation();
+    auto start = display_list.commands().size();
+
+    // OPTIMIZATION: If nothing painted by this stacking context was invalidated since it was last recorded, copy its
+    //               commands over from the previous display list instead of walking its paintables again.
+    //               Copying (instead of nesting the previous list) keeps the commands tied to the current scroll state.
+    if (auto const& retained = child.m_retained_display_list_commands; retained.has_value() && retained->display_list_generation == display_list_generation) {
+        display_list.append_commands_from(*retained->display_list, retained->start, retained->end);
+        mutable_child.move_retained_display_list_commands_of_descendants(*retained->display_list, retained->start, display_list, start);
+    } else {
+        child.paint(context);
+    }
+
+    auto end = max(start, display_list.commands().size());
+    mutable_child.m_retained_display_list_commands = RetainedDisplayListCommands { display_list, start, end, display_list_generation };
+}
+
+void StackingContext::move_retained_display_list_commands_of_descendants(DisplayList const& old_display_list, size_t old_start, DisplayList& new_display_list, size_t new_start)
+{
+    // NOTE: Descendants' commands were copied along with ours, so point them at the new display list as well. This
+    //       lets the old display list go away, and keeps the descendants reusable if we get invalidated later.
+    for (auto* child : m_children) {
+        auto& retained = child->m_retained_display_list_commands;
+        if (!retained.has_value() || retained->display_list.ptr() != &old_display_list)
+            continue;
+        retained->display_list = new_display_list;
+        retained->start = retained->start - old_start + new_start;
+        retained->end = retained->end - old_start + new_start;
+        child->move_retained_display_list_commands_of_descendants(old_display_list, old_start, new_display_list, new_start);
+    }
+}
+
+void StackingContext::invalidate_retained_display_list_commands()
+{
+    for (auto* stacking_context = this; stacking_context; stacking_context = stacking_context->m_parent)
+        stacking_context->m_retained_display_list_commands.clear();
+}
+
+void StackingContext::retain_commands_from_copy_of_display_list(DisplayList const& old_display_list, DisplayList& new_display_list)
+{
+    VERIFY(!m_parent);
+    move_retained_display_list_commands_of_descendants(old_display_list, 0, new_display_list, 0);
+}
+
+bool StackingContext::update_opacity_and_transform_of_retained_display_list_commands(DisplayList& display_list)
+{
+    auto const& retained = m_retained_display_list_commands;
+    if (!retained.has_value() || retained->display_list.ptr() != &display_list || retained->display_list_generation != paintable_box().document().display_list_generation())
+        return false;
+
+    // NOTE: Nothing at all is recorded for stacking contexts that are fully transparent.
+    auto opacity = paintable_box().computed_values().opacity();
+    if (opacity == 0.0f)
+        return false;
+
+    // NOTE: Our PushStackingContext is the first one among our commands, as anything before it only sets up clipping.
+    for (size_t i = retained->start; i < retained->end; ++i) {
+        auto* push_stacking_context = display_list.command_at(i).command.get_pointer<PushStackingContext>();
+        if (!push_stacking_context)
+            continue;
+        push_stacking_context->opacity = opacity;
+        push_stacking_context->transform = transform_in_device_pixels(float(display_list.device_pixels_per_css_pixel()));
+        return true;
+    }
+    return false;
 }
 
 void StackingContext::paint_internal(PaintContext& context) const
@@ -300,6 +369,15 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+StackingContextTransform StackingContext::transform_in_device_pixels(float to_device_pixels_scale) const
+{
+    auto transform_origin = paintable_box().transform_origin().to_type<float>();
+    return {
+        .origin = transform_origin.scaled(to_device_pixels_scale),
+        .matrix = matrix_with_scaled_translation(paintable_box().transform(), to_device_pixels_scale),
+    };
+}
+
 void StackingContext::paint(PaintContext& context) const
 {
     auto opacity = paintable_box().computed_values().opacity();
@@ -314,9 +392,6 @@ void StackingContext::paint(PaintContext& context) const
     auto to_device_pixels_scale = float(context.device_pixels_per_css_pixel());
     auto source_paintable_rect = context.enclosing_device_rect(paintable_box().absolute_paint_rect()).to_type<int>();
 
-    auto transform_matrix = paintable_box().transform();
-    auto transform_origin = paintable_box().transform_origin().to_type<float>();
-
     Gfx::CompositingAndBlendingOperator compositing_and_blending_operator = mix_blend_mode_to_compositing_and_blending_operator(paintable_box().computed_values().mix_blend_mode());
 
     DisplayListRecorder::PushStackingContextParams push_stacking_context_params {
@@ -325,10 +400,7 @@ void StackingContext::paint(PaintContext& context) const
         .isolate = paintable_box().computed_values().isolation() == CSS::Isolation::Isolate,
         .is_fixed_position = paintable_box().is_fixed_position(),
         .source_paintable_rect = source_paintable_rect,
-        .transform = {
-            .origin = transform_origin.scaled(to_device_pixels_scale),
-            .matrix = matrix_with_scaled_translation(transform_matrix, to_device_pixels_scale),
-        },
+        .transform = transform_in_device_pixels(to_device_pixels_scale),
     };
 
     auto const& computed_values = paintable_box().computed_values();
@@ -385,6 +457,133 @@ void StackingContext::paint(PaintContext& context) const
         paintable_box().clear_clip_overflow_rect(context, PaintPhase::Foreground);
 }
 
+static constexpr size_t minimum_positioned_descendants_for_hit_test_index = 64;
+static constexpr double hit_test_index_cell_size = 256;
+static constexpr i64 maximum_hit_test_index_cells_per_descendant = 256;
+
+// Unites everything that hit testing the paintable can find something in into the extent, going into the same children
+// as PaintableBox::hit_test_children() does. Returns false if what's found can move around without a relayout, or if
+// it isn't found by just looking at rectangles.
+static bool unite_hit_testable_extent(Paintable const& paintable, ScrollFrame const* scroll_frame, CSSPixelRect& extent)
+{
+    if (auto const* paintable_box = as_if<PaintableBox>(paintable)) {
+        if (paintable_box->has_css_transform() || paintable_box->enclosing_scroll_frame().ptr() != scroll_frame)
+            return false;
+        if (paintable_box->is_svg_paintable() || paintable_box->is_svg_svg_paintable())
+            return false;
+
+        extent.unite(paintable_box->absolute_border_box_rect());
+        if (auto const* paintable_with_lines = as_if<PaintableWithLines>(*paintable_box)) {
+            for (auto const& fragment : paintable_with_lines->fragments())
+                extent.unite(fragment.absolute_rect());
+        }
+    }
+
+    for (auto const* child = paintable.first_child(); child; child = child->next_sibling()) {
+        if (child->layout_node().is_positioned() && child->computed_values().z_index().value_or(0) == 0)
+            continue;
+        if (!unite_hit_testable_extent(*child, scroll_frame, extent))
+            return false;
+    }
+    return true;
+}
+
+static Optional<CSSPixelRect> hit_testable_extent_of_positioned_descendant(PaintableBox const& paintable_box)
+{
+    // NOTE: Stacking contexts may have transforms, and so do ancestors, which would have to be applied to the extent.
+    if (paintable_box.stacking_context())
+        return {};
+    for (auto const* containing_block = paintable_box.containing_block(); containing_block; containing_block = containing_block->containing_block()) {
+        if (containing_block->has_css_transform())
+            return {};
+    }
+
+    CSSPixelRect extent;
+    if (!unite_hit_testable_extent(paintable_box, paintable_box.enclosing_scroll_frame().ptr(), extent))
+        return {};
+    return extent;
+}
+
+static i64 hit_test_index_cell_coordinate(CSSPixels value)
+{
+    return static_cast<i64>(floor(value.to_double() / hit_test_index_cell_size));
+}
+
+static u64 hit_test_index_cell_key(i64 x, i64 y)
+{
+    return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(y);
+}
+
+StackingContext::PositionedDescendantsHitTestIndex const& StackingContext::positioned_descendants_hit_test_index() const
+{
+    if (m_positioned_descendants_hit_test_index.has_value())
+        return *m_positioned_descendants_hit_test_index;
+
+    PositionedDescendantsHitTestIndex index;
+    HashMap<ScrollFrame const*, size_t> grid_index_by_scroll_frame;
+
+    for (size_t i = 0; i < m_positioned_descendants_and_stacking_contexts_with_stack_level_0.size(); ++i) {
+        auto const& paintable_box = *m_positioned_descendants_and_stacking_contexts_with_stack_level_0[i];
+
+        auto extent = hit_testable_extent_of_positioned_descendant(paintable_box);
+        if (!extent.has_value()) {
+            index.unindexed_descendants.append(i);
+            continue;
+        }
+
+        // NOTE: Nothing can be hit in an empty extent, so there's no need to test this descendant at all.
+        if (extent->is_empty())
+            continue;
+
+        auto left = hit_test_index_cell_coordinate(extent->left());
+        auto top = hit_test_index_cell_coordinate(extent->top());
+        auto right = hit_test_index_cell_coordinate(extent->right());
+        auto bottom = hit_test_index_cell_coordinate(extent->bottom());
+
+        // OPTIMIZATION: Huge descendants would take up a lot of cells, so they are tested wherever the position is.
+        if ((right - left + 1) * (bottom - top + 1) > maximum_hit_test_index_cells_per_descendant) {
+            index.unindexed_descendants.append(i);
+            continue;
+        }
+
+        auto grid_index = grid_index_by_scroll_frame.ensure(paintable_box.enclosing_scroll_frame().ptr(), [&] {
+            index.grids.append({ .representative_descendant = i, .cells = {} });
+            return index.grids.size() - 1;
+        });
+        auto& grid = index.grids[grid_index];
+        for (auto y = top; y <= bottom; ++y) {
+            for (auto x = left; x <= right; ++x) {
+                grid.cells.ensure(hit_test_index_cell_key(x, y)).append(i);
+            }
+        }
+    }
+
+    m_positioned_descendants_hit_test_index = move(index);
+    return *m_positioned_descendants_hit_test_index;
+}
+
+// Returns the indices of the positioned descendants that can have something at the position, in reverse paint order.
+Vector<size_t> StackingContext::positioned_descendants_that_may_be_hit_at(CSSPixelPoint position) const
+{
+    auto const& index = positioned_descendants_hit_test_index();
+
+    Vector<size_t> candidates;
+    candidates.extend(index.unindexed_descendants);
+
+    for (auto const& grid : index.grids) {
+        auto const& representative_descendant = *m_positioned_descendants_and_stacking_contexts_with_stack_level_0[grid.representative_descendant];
+        auto position_adjusted_by_scroll_offset = position.translated(-representative_descendant.cumulative_offset_of_enclosing_scroll_frame());
+
+        auto x = hit_test_index_cell_coordinate(position_adjusted_by_scroll_offset.x());
+        auto y = hit_test_index_cell_coordinate(position_adjusted_by_scroll_offset.y());
+        if (auto cell = grid.cells.find(hit_test_index_cell_key(x, y)); cell != grid.cells.end())
+            candidates.extend(cell->value);
+    }
+
+    quick_sort(candidates, [](auto a, auto b) { return a > b; });
+    return candidates;
+}
+
 TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
     if (!paintable_box().is_visible())
@@ -409,12 +608,21 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
     }
 
     // 6. the child stacking contexts with stack level 0 and the positioned descendants with stack level 0.
-    for (auto const& paintable : m_positioned_descendants_and_stacking_contexts_with_stack_level_0.in_reverse()) {
-        if (paintable->stacking_context()) {
-            if (paintable->stacking_context()->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
+    auto hit_test_positioned_descendant = [&](PaintableBox const& paintable) {
+        if (paintable.stacking_context())
+            return paintable.stacking_context()->hit_test(transformed_position, type, callback);
+        return paintable.hit_test(transformed_position, type, callback);
+    };
+    // NOTE: Only exact hit tests can skip the descendants that don't contain the position. The others also look for
+    //       whatever is closest to it.
+    if (type == HitTestType::Exact && m_positioned_descendants_and_stacking_contexts_with_stack_level_0.size() >= minimum_positioned_descendants_for_hit_test_index) {
+        for (auto index : positioned_descendants_that_may_be_hit_at(transformed_position)) {
+            if (hit_test_positioned_descendant(m_positioned_descendants_and_stacking_contexts_with_stack_level_0[index]) == TraversalDecision::Break)
                 return TraversalDecision::Break;
-        } else {
-            if (paintable->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
+        }
+    } else {
+        for (auto const& paintable : m_positioned_descendants_and_stacking_contexts_with_stack_level_0.in_reverse()) {
+            if (hit_test_positioned_descendant(paintable) == TraversalDecision::Break)
                 return TraversalDecision::Break;
         }
     }
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
 #include <AK/Vector.h>
 #include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
 
 namespace Web::Painting {
@@ -46,6 +49,16 @@ public:
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    // Drops the commands retained for this stacking context and its ancestors, which include them.
+    void invalidate_retained_display_list_commands();
+
+    // Points the commands retained for the descendants of this (root) stacking context at a copy of the display list.
+    void retain_commands_from_copy_of_display_list(DisplayList const& old_display_list, DisplayList& new_display_list);
+
+    // Updates the opacity and transform in the commands retained for this stacking context in the given display list, for
+    // when nothing else about it changed since they were recorded. Returns false if they have to be recorded again instead.
+    [[nodiscard]] bool update_opacity_and_transform_of_retained_display_list_commands(DisplayList&);
+
 private:
     GC::Ref<PaintableBox> m_paintable;
     StackingContext* const m_parent { nullptr };
@@ -53,10 +66,42 @@ private:
     size_t m_index_in_tree_order { 0 };
     Optional<u64> m_last_paint_generation_id;
 
+    // The range of commands this stacking context recorded into the last display list it was painted into.
+    struct RetainedDisplayListCommands {
+        NonnullRefPtr<DisplayList> display_list;
+        size_t start { 0 };
+        size_t end { 0 };
+        u64 display_list_generation { 0 };
+    };
+    Optional<RetainedDisplayListCommands> m_retained_display_list_commands;
+
     Vector<GC::Ref<PaintableBox const>> m_positioned_descendants_and_stacking_contexts_with_stack_level_0;
     Vector<GC::Ref<PaintableBox const>> m_non_positioned_floating_descendants;
 
+    // NOTE: Hit testing goes through each of the positioned descendants, which adds up on pages with thousands of them.
+    //       So the area each one can be hit in is put into a grid, which lets exact hit tests skip the ones nowhere
+    //       near the position. The grid is built by the first hit test that needs it, and goes away along with the
+    //       rest of the stacking context tree, which is rebuilt after layout.
+    struct PositionedDescendantsHitTestGrid {
+        // Everything in a grid shares an enclosing scroll frame, so that scrolling doesn't move them around within it.
+        // This is the index of one of them, through which the current scroll offset is found.
+        size_t representative_descendant { 0 };
+        HashMap<u64, Vector<size_t>> cells;
+    };
+    struct PositionedDescendantsHitTestIndex {
+        Vector<PositionedDescendantsHitTestGrid> grids;
+
+        // The descendants we can't tell the extent of ahead of time, which are tested wherever the position is.
+        Vector<size_t> unindexed_descendants;
+    };
+    mutable Optional<PositionedDescendantsHitTestIndex> m_positioned_descendants_hit_test_index;
+
+    PositionedDescendantsHitTestIndex const& positioned_descendants_hit_test_index() const;
+    Vector<size_t> positioned_descendants_that_may_be_hit_at(CSSPixelPoint) const;
+
     static void paint_child(PaintContext&, StackingContext const&);
+    StackingContextTransform transform_in_device_pixels(float to_device_pixels_scale) const;
+    void move_retained_display_list_commands_of_descendants(DisplayList const& old_display_list, size_t old_start, DisplayList& new_display_list, size_t new_start);
     void paint_internal(PaintContext&) const;
 };
 
@@ -131,7 +131,7 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto paint_frame = [&](auto const& frame) {
         auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), frame->rect(), video_rect.to_type<int>());
         auto dst_rect = video_rect.to_type<int>();
-        context.display_list_recorder().draw_scaled_immutable_bitmap(dst_rect, dst_rect, Gfx::ImmutableBitmap::create(*frame), scaling_mode);
+        context.display_list_recorder().draw_scaled_immutable_bitmap(dst_rect, dst_rect, *frame, scaling_mode);
     };
 
     auto paint_transparent_black = [&]() {
@@ -155,8 +155,8 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
     case Representation::LastRenderedVideoFrame:
         // FIXME: We likely need to cache all (or a subset of) decoded video frames along with their position. We at least
         //        will need the first video frame and the last-rendered video frame.
-        if (current_frame.frame)
-            paint_frame(current_frame.frame);
+        if (current_frame.immutable_frame)
+            paint_frame(current_frame.immutable_frame);
         if (paint_user_agent_controls)
             paint_loaded_video_controls();
         break;
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/JsonObject.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/PhaseTimings.h>
+
+namespace Web {
+
+static Array<Atomic<i64>, to_underlying(Phase::__Count)> s_phase_nanoseconds;
+static AK::Duration s_garbage_collection_time_at_reset;
+
+static thread_local PhaseTimer* s_current_timer = nullptr;
+
+static void add_to_phase(Phase phase, AK::Duration duration)
+{
+    s_phase_nanoseconds[to_underlying(phase)].fetch_add(duration.to_nanoseconds(), AK::MemoryOrder::memory_order_relaxed);
+}
+
+AK::Duration PhaseTimings::total(Phase phase)
+{
+    return AK::Duration::from_nanoseconds(s_phase_nanoseconds[to_underlying(phase)].load(AK::MemoryOrder::memory_order_relaxed));
+}
+
+void PhaseTimings::reset()
+{
+    for (auto& nanoseconds : s_phase_nanoseconds)
+        nanoseconds.store(0, AK::MemoryOrder::memory_order_relaxed);
+
+    s_garbage_collection_time_at_reset = Bindings::main_thread_vm().heap().time_spent_collecting_garbage();
+}
+
+JsonObject PhaseTimings::to_json()
+{
+    auto to_milliseconds = [](AK::Duration duration) {
+        return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+    };
+
+    JsonObject timings;
+#define __ENUMERATE_PHASE(name, json_name) \
+    timings.set(json_name##sv, to_milliseconds(total(Phase::name)));
+    ENUMERATE_PHASES(__ENUMERATE_PHASE)
+#undef __ENUMERATE_PHASE
+
+    auto garbage_collection_time = Bindings::main_thread_vm().heap().time_spent_collecting_garbage() - s_garbage_collection_time_at_reset;
+    timings.set("garbageCollection"sv, to_milliseconds(garbage_collection_time));
+
+    return timings;
+}
+
+PhaseTimer::PhaseTimer(Phase phase)
+    : m_phase(phase)
+    , m_start(MonotonicTime::now())
+    , m_outer_timer(s_current_timer)
+{
+    // The outer phase is paused until this one is over.
+    if (m_outer_timer)
+        add_to_phase(m_outer_timer->m_phase, m_start - m_outer_timer->m_start);
+    s_current_timer = this;
+}
+
+PhaseTimer::~PhaseTimer()
+{
+    auto now = MonotonicTime::now();
+    add_to_phase(m_phase, now - m_start);
+
+    s_current_timer = m_outer_timer;
+    if (m_outer_timer)
+        m_outer_timer->m_start = now;
+}
+
+}
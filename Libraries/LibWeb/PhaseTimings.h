@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Forward.h>
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
+
+namespace Web {
+
+#define ENUMERATE_PHASES(X)         \
+    X(HTMLParse, "htmlParse")       \
+    X(CSSParse, "cssParse")         \
+    X(Style, "style")               \
+    X(Layout, "layout")             \
+    X(PaintRecord, "paintRecord")   \
+    X(Raster, "raster")             \
+    X(JSParse, "jsParse")           \
+    X(JSExecute, "jsExecute")
+
+enum class Phase : u8 {
+#define __ENUMERATE_PHASE(name, json_name) name,
+    ENUMERATE_PHASES(__ENUMERATE_PHASE)
+#undef __ENUMERATE_PHASE
+    __Count,
+};
+
+// Keeps a running total of the time this process has spent in each phase of loading and rendering pages, for
+// benchmarking. Time spent in a phase that is entered while another one is active on the same thread (e.g. a layout
+// that is forced by a script) only counts towards the inner phase, so the totals add up to the time spent in all of
+// them. Rasterization runs on the rendering thread, and can therefore overlap with the other phases.
+class PhaseTimings {
+public:
+    static AK::Duration total(Phase);
+    static void reset();
+
+    // Returns the totals in milliseconds, keyed by the name of each phase. The time spent collecting garbage on the
+    // main thread's heap is included as "garbageCollection", and overlaps with whichever phase triggered it.
+    static JsonObject to_json();
+};
+
+// Adds the time between its construction and destruction to a phase.
+class PhaseTimer {
+    AK_MAKE_NONCOPYABLE(PhaseTimer);
+    AK_MAKE_NONMOVABLE(PhaseTimer);
+
+public:
+    explicit PhaseTimer(Phase);
+    ~PhaseTimer();
+
+private:
+    Phase m_phase;
+    MonotonicTime m_start;
+    PhaseTimer* m_outer_timer { nullptr };
+};
+
+}
@@ -25,6 +25,10 @@ struct DecodedImage {
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if only the first few of frame_count frames were decoded.
+    Optional<i64> streamed_animation_id;
+    size_t frame_count { 0 };
 };
 
 class ImageCodecPlugin {
@@ -35,6 +39,15 @@ public:
     virtual ~ImageCodecPlugin();
 
     virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+
+    // Like decode_image(), but only decodes the first few frames of an animation that would take up a lot of memory once
+    // decoded. The rest of them have to be requested with request_animation_frames() as they're needed, and the state
+    // kept around for doing so has to be freed with release_animation() once they no longer are.
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image_streaming_animation_frames(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+
+    using AnimationFramesCallback = Function<void(size_t first_frame_index, Vector<Frame>)>;
+    virtual void request_animation_frames(i64 animation_id, size_t first_frame_index, size_t frame_count, ESCAPING AnimationFramesCallback) = 0;
+    virtual void release_animation(i64 animation_id) = 0;
 };
 
 }
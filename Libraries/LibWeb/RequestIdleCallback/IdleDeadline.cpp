@@ -41,7 +41,9 @@ double IdleDeadline::time_remaining() const
     // 1. Let now be a DOMHighResTimeStamp representing current high resolution time in milliseconds.
     auto now = HighResolutionTime::current_high_resolution_time(HTML::relevant_global_object(*this));
     // 2. Let deadline be the result of calling IdleDeadline's get deadline time algorithm.
-    auto deadline = event_loop.compute_deadline();
+    // NOTE: The deadline is a moment on the shared monotonic clock, so we make it relative to the time origin of our
+    //       global like now.
+    auto deadline = HighResolutionTime::relative_high_resolution_time(event_loop.compute_deadline(), HTML::relevant_global_object(*this));
     // 3. Let timeRemaining be deadline - now.
     auto time_remaining = deadline - now;
     // 4. If timeRemaining is negative, set it to 0.
@@ -6,6 +6,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/ResizeObserver/ResizeObservation.h>
@@ -39,6 +40,13 @@ void ResizeObservation::visit_edges(JS::Cell::Visitor& visitor)
 // https://drafts.csswg.org/resize-observer-1/#dom-resizeobservation-isactive
 bool ResizeObservation::is_active()
 {
+    // OPTIMIZATION: This gets asked for every observation at least once per rendering update, but the size of the target
+    //               can only have changed if layout was performed since we last found it to be the same. That doesn't
+    //               hold for device pixel sizes, as the device pixel ratio can change on its own.
+    auto layout_generation = m_target->document().layout_generation();
+    if (m_observed_box != Bindings::ResizeObserverBoxOptions::DevicePixelContentBox && m_layout_generation_when_found_inactive == layout_generation)
+        return false;
+
     // 1. Set currentSize by calculate box size given target and observedBox.
     auto current_size = ResizeObserverSize::calculate_box_size(m_realm, m_target, m_observed_box);
 
@@ -48,6 +56,7 @@ bool ResizeObservation::is_active()
         return true;
 
     // 3. Return false.
+    m_layout_generation_when_found_inactive = layout_generation;
     return false;
 }
 
@@ -36,6 +36,9 @@ private:
     GC::Ref<DOM::Element> m_target;
     Bindings::ResizeObserverBoxOptions m_observed_box;
     Vector<GC::Ref<ResizeObserverSize>> m_last_reported_sizes;
+
+    // The layout generation of the target's document when its size was last found to be the last reported one.
+    Optional<u64> m_layout_generation_when_found_inactive;
 };
 
 }
@@ -130,16 +130,29 @@ RefPtr<Gfx::ImmutableBitmap> SVGDecodedImageData::bitmap(size_t, Gfx::IntSize si
     if (size.is_empty())
         return nullptr;
 
-    if (auto it = m_cached_rendered_bitmaps.find(size); it != m_cached_rendered_bitmaps.end())
-        return it->value;
+    auto use = ++m_cached_rendered_bitmap_use_counter;
+
+    if (auto it = m_cached_rendered_bitmaps.find(size); it != m_cached_rendered_bitmaps.end()) {
+        it->value.last_use = use;
+        return it->value.bitmap;
+    }
+
+    auto bitmap = render(size);
+    if (!bitmap)
+        return nullptr;
 
     // Prevent the cache from growing too big.
-    // FIXME: Evict least used entries.
-    if (m_cached_rendered_bitmaps.size() > 10)
-        m_cached_rendered_bitmaps.remove(m_cached_rendered_bitmaps.begin());
+    if (m_cached_rendered_bitmaps.size() >= max_cached_rendered_bitmaps) {
+        auto least_recently_used = m_cached_rendered_bitmaps.begin();
+        for (auto it = m_cached_rendered_bitmaps.begin(); it != m_cached_rendered_bitmaps.end(); ++it) {
+            if (it->value.last_use < least_recently_used->value.last_use)
+                least_recently_used = it;
+        }
+        m_cached_rendered_bitmaps.remove(least_recently_used);
+    }
 
-    auto immutable_bitmap = Gfx::ImmutableBitmap::create(*render(size));
-    m_cached_rendered_bitmaps.set(size, immutable_bitmap);
+    auto immutable_bitmap = Gfx::ImmutableBitmap::create(*bitmap);
+    m_cached_rendered_bitmaps.set(size, { immutable_bitmap, use });
     return immutable_bitmap;
 }
 
@@ -42,7 +42,15 @@ private:
 
     RefPtr<Gfx::Bitmap> render(Gfx::IntSize) const;
 
-    mutable HashMap<Gfx::IntSize, NonnullRefPtr<Gfx::ImmutableBitmap>> m_cached_rendered_bitmaps;
+    // NOTE: An SVG image can't change once it's loaded, so a rendered bitmap stays valid for as long as the same size is
+    //       asked for. The least recently used one is thrown away once there are too many of them.
+    struct CachedRenderedBitmap {
+        NonnullRefPtr<Gfx::ImmutableBitmap> bitmap;
+        u64 last_use { 0 };
+    };
+    static constexpr size_t max_cached_rendered_bitmaps = 10;
+    mutable HashMap<Gfx::IntSize, CachedRenderedBitmap> m_cached_rendered_bitmaps;
+    mutable u64 m_cached_rendered_bitmap_use_counter { 0 };
 
     GC::Ref<Page> m_page;
     GC::Ref<SVGPageClient> m_page_client;
@@ -31,13 +31,33 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 {
     Base::attribute_changed(name, old_value, value, namespace_);
 
-    if (name == "d")
+    if (name == "d") {
         m_path = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_gfx_path.clear();
+    }
+}
+
+WebIDL::ExceptionOr<void> SVGPathElement::cloned(DOM::Node& copy, bool clone_children) const
+{
+    TRY(Base::cloned(copy, clone_children));
+
+    // OPTIMIZATION: The copy has the same "d" attribute as we do, so it can share our path instead of building its own.
+    auto& path_element_copy = as<SVGPathElement>(copy);
+    path_element_copy.m_gfx_path = gfx_path();
+
+    return {};
+}
+
+Gfx::Path const& SVGPathElement::gfx_path() const
+{
+    if (!m_gfx_path.has_value())
+        m_gfx_path = m_path.to_gfx_path();
+    return *m_gfx_path;
 }
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return m_path.to_gfx_path();
+    return gfx_path();
 }
 
 }
@@ -26,8 +26,16 @@ private:
     SVGPathElement(DOM::Document&, DOM::QualifiedName);
 
     virtual void initialize(JS::Realm&) override;
+    virtual WebIDL::ExceptionOr<void> cloned(DOM::Node&, bool) const override;
+
+    Gfx::Path const& gfx_path() const;
 
     Path m_path {};
+
+    // NOTE: Building a Gfx::Path from the path data isn't free, and the path data only changes with the "d" attribute,
+    //       so it's only built once. Copies of a Gfx::Path share their underlying path data until they're modified,
+    //       which means that every copy of this element made by a <use> element shares the same path data as well.
+    mutable Optional<Gfx::Path> m_gfx_path;
 };
 
 }
@@ -300,25 +300,25 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     // 5. Let pullSize be the smaller value of available and desiredSize.
     auto pull_size = min(available, desired_size);
 
-    // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
-
-    // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
-
     // 8. If stream’s current BYOB request view is non-null, then:
     if (auto byob_view = current_byob_request_view()) {
-        // 1. Write pulled into stream’s current BYOB request view.
-        byob_view->write(pulled);
+        // 6. Let pulled be the first pullSize bytes of bytes.
+        // 7. Remove the first pullSize bytes from bytes.
+        // 8.1. Write pulled into stream’s current BYOB request view.
+        // OPTIMIZATION: The bytes are written into the view straight from bytes, without being copied out of it first.
+        byob_view->write(bytes.bytes().trim(pull_size));
 
-        // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
+        // 8.2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
         TRY(readable_byte_stream_controller_respond(controller, pull_size));
     }
     // 9. Otherwise,
     else {
+        // NOTE: Without a BYOB request view, desiredSize is available, so pulled is all of bytes.
+        VERIFY(pull_size == available);
+
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
-        auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
+        // OPTIMIZATION: The new ArrayBuffer takes over the bytes, rather than getting a copy of them.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(bytes));
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
         // 2. Perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], view).
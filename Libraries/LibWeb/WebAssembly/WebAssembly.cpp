@@ -9,6 +9,8 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCore/EventLoop.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -19,13 +21,13 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Fetch/Response.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
-#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebAssembly/Global.h>
 #include <LibWeb/WebAssembly/Instance.h>
 #include <LibWeb/WebAssembly/Memory.h>
@@ -39,6 +41,8 @@
 namespace Web::WebAssembly {
 
 static GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM&, ByteBuffer, HTML::Task::Source = HTML::Task::Source::Unspecified);
+static void settle_compiled_webassembly_module_promise(JS::Realm&, GC::Ref<WebIDL::Promise>, JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>>, HTML::Task::Source);
+static void did_compile_webassembly_module(GC::Root<WebIDL::Promise>, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>, HTML::Task::Source);
 static GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::VM&, GC::Ref<WebIDL::Promise>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::VM&, GC::Ref<Module>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM&, GC::Ref<WebIDL::Promise>);
@@ -52,6 +56,50 @@ WebAssemblyCache& get_cache(JS::Realm& realm)
     return s_caches.ensure(realm.global_object());
 }
 
+CompiledModuleCache& CompiledModuleCache::the()
+{
+    static CompiledModuleCache cache;
+    return cache;
+}
+
+CompiledModuleCache::Digest CompiledModuleCache::digest_of(ReadonlyBytes bytes)
+{
+    return Crypto::Hash::SHA256::hash(bytes.data(), bytes.size());
+}
+
+RefPtr<Wasm::Module> CompiledModuleCache::get(Digest const& digest)
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].digest != digest)
+            continue;
+
+        auto entry = m_entries.take(i);
+        auto module = entry.module;
+        m_entries.append(move(entry));
+        return module;
+    }
+    return {};
+}
+
+void CompiledModuleCache::set(Digest const& digest, NonnullRefPtr<Wasm::Module> module, size_t byte_size)
+{
+    if (byte_size > max_total_byte_size)
+        return;
+
+    m_entries.remove_first_matching([&](auto const& entry) {
+        if (entry.digest != digest)
+            return false;
+        m_total_byte_size -= entry.byte_size;
+        return true;
+    });
+
+    while (m_total_byte_size + byte_size > max_total_byte_size)
+        m_total_byte_size -= m_entries.take_first().byte_size;
+
+    m_entries.append({ digest, move(module), byte_size });
+    m_total_byte_size += byte_size;
+}
+
 }
 
 void visit_edges(JS::Object& object, JS::Cell::Visitor& visitor)
@@ -266,7 +314,7 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
                         // 3.4.3.1. Create a host function from v and functype, and let funcaddr be the result.
                         cache.add_imported_object(function);
                         Wasm::HostFunction host_function {
-                            [&](auto&, auto& arguments) -> Wasm::Result {
+                            [&](auto&, auto arguments) -> Wasm::Result {
                                 GC::RootVector<JS::Value> argument_values { vm.heap() };
                                 size_t index = 0;
                                 for (auto& entry : arguments) {
@@ -411,21 +459,37 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
-    FixedMemoryStream stream { data.bytes() };
-    auto module_result = Wasm::Module::parse(stream);
-    if (module_result.is_error()) {
-        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
-    }
+    auto& module_cache = CompiledModuleCache::the();
+    auto digest = CompiledModuleCache::digest_of(data.bytes());
+    auto module = module_cache.get(digest);
+    if (!module) {
+        auto module_or_error = parse_and_validate_webassembly_module(data.bytes());
+        if (module_or_error.is_error())
+            return vm.throw_completion<CompileError>(module_or_error.release_error());
 
-    auto& cache = get_cache(*vm.current_realm());
-    if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
-        return vm.throw_completion<CompileError>(validation_result.error().error_string);
+        module = module_or_error.release_value();
+        module_cache.set(digest, *module, data.size());
     }
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
-    cache.add_compiled_module(compiled_module);
+
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module.release_nonnull());
+    get_cache(*vm.current_realm()).add_compiled_module(compiled_module);
     return compiled_module;
 }
 
+ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> parse_and_validate_webassembly_module(ReadonlyBytes data)
+{
+    FixedMemoryStream stream { data };
+    auto module_result = Wasm::Module::parse(stream);
+    if (module_result.is_error())
+        return Wasm::parse_error_to_byte_string(module_result.error());
+
+    auto module = module_result.release_value();
+    if (auto validation_result = Wasm::AbstractMachine::validate(module); validation_result.is_error())
+        return validation_result.error().error_string;
+
+    return module;
+}
+
 GC_DEFINE_ALLOCATOR(ExportedWasmFunction);
 
 GC::Ref<ExportedWasmFunction> ExportedWasmFunction::create(JS::Realm& realm, FlyString const& name, Function<JS::ThrowCompletionOr<JS::Value>(JS::VM&)> behavior, Wasm::FunctionAddress exported_address)
@@ -648,37 +712,84 @@ GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, B
     auto promise = WebIDL::create_promise(realm);
 
     // 2. Run the following steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(vm.heap(), [&vm, &realm, bytes = move(bytes), promise, task_source]() mutable {
-        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-        // 1. Compile the WebAssembly module bytes and store the result as module.
-        auto module_or_error = Detail::compile_a_webassembly_module(vm, move(bytes));
+    //    1. Compile the WebAssembly module bytes and store the result as module.
+    // OPTIMIZATION: Only the check whether the realm allows compiling needs the main thread. Parsing and validating take
+    //               nearly all of the time for large modules, and touch no JS state, so they run on the thread pool.
+    if (auto result = Detail::host_ensure_can_compile_wasm_bytes(vm); result.is_error()) {
+        settle_compiled_webassembly_module_promise(realm, promise, result.release_error(), task_source);
+        return promise;
+    }
 
-        // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
-        HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
-            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-            auto& realm = HTML::relevant_realm(*promise->promise());
+    // NOTE: Modules aren't safe to share between threads, so the compiled module cache is only ever used on the main
+    //       thread. Hashing the bytes takes a while for large modules too though, so that happens in the background.
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().enqueue([&main_thread_event_loop, bytes = move(bytes), promise = GC::Root { promise }, task_source]() mutable {
+        auto digest = Detail::CompiledModuleCache::digest_of(bytes);
 
-            // 1. If module is error, reject promise with a CompileError exception.
-            if (module_or_error.is_error()) {
-                WebIDL::reject_promise(realm, promise, module_or_error.error_value());
+        main_thread_event_loop.deferred_invoke([&main_thread_event_loop, bytes = move(bytes), digest, promise = move(promise), task_source]() mutable {
+            if (auto module = Detail::CompiledModuleCache::the().get(digest)) {
+                did_compile_webassembly_module(move(promise), module.release_nonnull(), task_source);
+                return;
             }
 
-            // 2. Otherwise,
-            else {
-                // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
-                // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
-                auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+            Threading::ThreadPool::the().enqueue([&main_thread_event_loop, bytes = move(bytes), digest, promise = move(promise), task_source]() mutable {
+                auto module_or_error = Detail::parse_and_validate_webassembly_module(bytes);
 
-                // 2. Resolve promise with moduleObject.
-                WebIDL::resolve_promise(realm, promise, module_object);
-            }
-        }));
-    }));
+                main_thread_event_loop.deferred_invoke([byte_size = bytes.size(), digest, promise = move(promise), module_or_error = move(module_or_error), task_source]() mutable {
+                    if (!module_or_error.is_error())
+                        Detail::CompiledModuleCache::the().set(digest, module_or_error.value(), byte_size);
+                    did_compile_webassembly_module(move(promise), move(module_or_error), task_source);
+                });
+                main_thread_event_loop.wake();
+            });
+        });
+        main_thread_event_loop.wake();
+    });
 
     // 3. Return promise.
     return promise;
 }
 
+void did_compile_webassembly_module(GC::Root<WebIDL::Promise> promise, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> module_or_error, HTML::Task::Source task_source)
+{
+    auto& realm = HTML::relevant_realm(*promise->promise());
+    HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+    if (module_or_error.is_error()) {
+        settle_compiled_webassembly_module_promise(realm, *promise, realm.vm().throw_completion<CompileError>(module_or_error.release_error()), task_source);
+        return;
+    }
+
+    auto compiled_module = make_ref_counted<Detail::CompiledWebAssemblyModule>(module_or_error.release_value());
+    Detail::get_cache(realm).add_compiled_module(compiled_module);
+    settle_compiled_webassembly_module_promise(realm, *promise, move(compiled_module), task_source);
+}
+
+// Steps 2.2 onwards of https://webassembly.github.io/spec/js-api/#asynchronously-compile-a-webassembly-module
+void settle_compiled_webassembly_module_promise(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>> module_or_error, HTML::Task::Source task_source)
+{
+    // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
+    HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(realm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        auto& realm = HTML::relevant_realm(*promise->promise());
+
+        // 1. If module is error, reject promise with a CompileError exception.
+        if (module_or_error.is_error()) {
+            WebIDL::reject_promise(realm, promise, module_or_error.error_value());
+        }
+
+        // 2. Otherwise,
+        else {
+            // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
+            // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
+            auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+
+            // 2. Resolve promise with moduleObject.
+            WebIDL::resolve_promise(realm, promise, module_object);
+        }
+    }));
+}
+
 // https://webassembly.github.io/spec/js-api/#asynchronously-instantiate-a-webassembly-module
 GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::VM& vm, GC::Ref<Module> module_object, GC::Ptr<JS::Object> import_object)
 {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Optional.h>
+#include <LibCrypto/Hash/HashFunction.h>
 #include <LibGC/Root.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Runtime/Completion.h>
@@ -69,6 +70,33 @@ private:
     Wasm::AbstractMachine m_abstract_machine;
 };
 
+// The modules compiled in this process by the SHA-256 digest of their bytes, so that compiling the same bytes again, as
+// happens every time a page using them is loaded, skips parsing and validating them. Modules are never changed once
+// they're validated, so they can be shared between realms.
+class CompiledModuleCache {
+public:
+    using Digest = Crypto::Hash::Digest<256>;
+
+    static constexpr size_t max_total_byte_size = 128 * MiB;
+
+    static CompiledModuleCache& the();
+    static Digest digest_of(ReadonlyBytes);
+
+    RefPtr<Wasm::Module> get(Digest const&);
+    void set(Digest const&, NonnullRefPtr<Wasm::Module>, size_t byte_size);
+
+private:
+    struct Entry {
+        Digest digest;
+        NonnullRefPtr<Wasm::Module> module;
+        size_t byte_size { 0 };
+    };
+
+    // NOTE: Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    size_t m_total_byte_size { 0 };
+};
+
 class ExportedWasmFunction final : public JS::NativeFunction {
     JS_OBJECT(ExportedWasmFunction, JS::NativeFunction);
     GC_DECLARE_ALLOCATOR(ExportedWasmFunction);
@@ -90,6 +118,8 @@ WebAssemblyCache& get_cache(JS::Realm&);
 
 JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS::VM&, Wasm::Module const&, GC::Ptr<JS::Object> import_object);
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM&, ByteBuffer);
+// The part of compiling a module that doesn't touch any JS state, and so can run off the main thread.
+ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> parse_and_validate_webassembly_module(ReadonlyBytes);
 JS::NativeFunction* create_native_function(JS::VM&, Wasm::FunctionAddress address, String const& name, Instance* instance = nullptr);
 JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM&, JS::Value value, Wasm::ValueType const& type);
 Wasm::Value default_webassembly_value(JS::VM&, Wasm::ValueType type);
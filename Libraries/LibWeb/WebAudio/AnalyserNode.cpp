@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Math.h>
 #include <AK/Vector.h>
@@ -53,52 +54,108 @@ Vector<f32> AnalyserNode::current_time_domain_data()
 }
 
 // https://webaudio.github.io/web-audio-api/#blackman-window
-Vector<f32> AnalyserNode::apply_a_blackman_window(Vector<f32> const& x) const
+Vector<f32> AnalyserNode::apply_a_blackman_window(Vector<f32> const& x)
 {
-    f32 const a = 0.16;
-    f32 const a0 = 0.5f * (1 - a);
-    f32 const a1 = 0.5;
-    f32 const a2 = a * 0.5f;
     unsigned long const N = m_fft_size;
 
-    auto w = [&](unsigned long n) {
-        return a0 - a1 * cos(2 * AK::Pi<f32> * (f32)n / (f32)N) + a2 * cos(4 * AK::Pi<f32> * (f32)n / (f32)N);
-    };
+    // OPTIMIZATION: The window only depends on fftSize, so it's computed once rather than every time the frequency data
+    //               is asked for, which is usually every animation frame.
+    if (m_blackman_window.size() != N) {
+        f32 const a = 0.16;
+        f32 const a0 = 0.5f * (1 - a);
+        f32 const a1 = 0.5;
+        f32 const a2 = a * 0.5f;
+
+        m_blackman_window.resize(N);
+        for (unsigned long n = 0; n < N; n++)
+            m_blackman_window[n] = a0 - a1 * AK::cos(2 * AK::Pi<f32> * (f32)n / (f32)N) + a2 * AK::cos(4 * AK::Pi<f32> * (f32)n / (f32)N);
+    }
 
     Vector<f32> x_hat;
-    x_hat.resize(m_fft_size);
-
-    // FIXME: Naive
-    for (unsigned long i = 0; i < m_fft_size; i++) {
-        x_hat[i] = x[i] * w(i);
-    };
+    x_hat.resize(N);
+    for (unsigned long i = 0; i < N; i++)
+        x_hat[i] = x[i] * m_blackman_window[i];
 
     return x_hat;
 }
 
 // https://webaudio.github.io/web-audio-api/#fourier-transform
+// NOTE: This returns the magnitudes |X[k]| for k = 0 .. N/2 - 1, as nothing else ever looks at the complex values.
 static Vector<f32> apply_a_fourier_transform(Vector<f32> const& input)
 {
-    dbgln("FIXME: Analyser node: implement apply a fourier transform");
-    auto result = Vector<f32>();
-    result.resize(input.size());
+    auto const N = input.size();
+    VERIFY(is_power_of_two(N));
+
+    // NOTE: This is an iterative radix-2 FFT, which takes O(N log N) rather than the O(N^2) of evaluating the sum in the
+    //       spec's definition directly. fftSize is always a power of two, so no other radix is ever needed.
+    Vector<f32> real;
+    Vector<f32> imaginary;
+    real.resize(N);
+    imaginary.resize(N);
+
+    // Put the input into bit-reversed order, so the butterflies below can work in place.
+    size_t bits = count_trailing_zeroes(N);
+    for (size_t i = 0; i < N; i++) {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < bits; bit++)
+            reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+        real[reversed] = input[i];
+    }
+
+    for (size_t length = 2; length <= N; length <<= 1) {
+        auto angle = -2 * AK::Pi<f32> / (f32)length;
+        f32 step_sin;
+        f32 step_cos;
+        AK::sincos(angle, step_sin, step_cos);
+
+        for (size_t start = 0; start < N; start += length) {
+            f32 twiddle_real = 1;
+            f32 twiddle_imaginary = 0;
+            for (size_t k = 0; k < length / 2; k++) {
+                auto even = start + k;
+                auto odd = even + length / 2;
+
+                auto odd_real = real[odd] * twiddle_real - imaginary[odd] * twiddle_imaginary;
+                auto odd_imaginary = real[odd] * twiddle_imaginary + imaginary[odd] * twiddle_real;
+
+                real[odd] = real[even] - odd_real;
+                imaginary[odd] = imaginary[even] - odd_imaginary;
+                real[even] += odd_real;
+                imaginary[even] += odd_imaginary;
+
+                auto next_twiddle_real = twiddle_real * step_cos - twiddle_imaginary * step_sin;
+                twiddle_imaginary = twiddle_real * step_sin + twiddle_imaginary * step_cos;
+                twiddle_real = next_twiddle_real;
+            }
+        }
+    }
+
+    // X[k] = 1/N * sum(x_hat[n] * e^(-2*pi*i*k*n/N)) for k = 0 .. N/2 - 1
+    Vector<f32> result;
+    result.ensure_capacity(N / 2);
+    for (size_t k = 0; k < N / 2; k++)
+        result.unchecked_append(AK::hypot(real[k], imaginary[k]) / (f32)N);
     return result;
 }
 
 // https://webaudio.github.io/web-audio-api/#smoothing-over-time
 Vector<f32> AnalyserNode::smoothing_over_time(Vector<f32> const& current_block)
 {
-    auto X = apply_a_fourier_transform(current_block);
-
-    // FIXME: Naive
     Vector<f32> result;
-    result.ensure_capacity(m_fft_size);
-    for (unsigned long i = 0; i < m_fft_size; i++) {
-        // FIXME: Complex modulus on X[i]
-        result.unchecked_append(m_smoothing_time_constant * m_previous_block[i] + (1.f - m_smoothing_time_constant) * abs(X[i]));
+    result.ensure_capacity(current_block.size());
+    for (size_t k = 0; k < current_block.size(); k++) {
+        // X_hat[k] = tau * X_hat_prev[k] + (1 - tau) * |X[k]|
+        auto value = static_cast<f32>(m_smoothing_time_constant * m_previous_block[k] + (1.0 - m_smoothing_time_constant) * current_block[k]);
+
+        // If X_hat[k] is NaN, positive infinity or negative infinity, set X_hat[k] = 0.
+        if (isnan(value) || isinf(value))
+            value = 0;
+
+        result.unchecked_append(value);
     }
 
-    m_previous_block = result;
+    for (size_t k = 0; k < result.size(); k++)
+        m_previous_block[k] = result[k];
 
     return result;
 }
@@ -106,11 +163,11 @@ Vector<f32> AnalyserNode::smoothing_over_time(Vector<f32> const& current_block)
 // https://webaudio.github.io/web-audio-api/#conversion-to-db
 Vector<f32> AnalyserNode::conversion_to_dB(Vector<f32> const& X_hat) const
 {
+    // Y[k] = 20 * log10(X_hat[k])
     Vector<f32> result;
     result.ensure_capacity(X_hat.size());
-    // FIXME: Naive
     for (auto x : X_hat)
-        result.unchecked_append(20.0f * AK::log(x));
+        result.unchecked_append(20.0f * AK::log10(x));
 
     return result;
 }
@@ -172,9 +229,6 @@ WebIDL::ExceptionOr<void> AnalyserNode::get_byte_frequency_data(GC::Root<WebIDL:
     //      more scaffolding
     //
 
-    // current_frequency_data returns a vector of size m_fftSize
-    // FIXME: Ensure sizes are correct after the fourier transform is implemented
-    //        Spec says to write frequencyBinCount bytes, not fftSize
     Vector<f32> dB_data = current_frequency_data();
     Vector<u8> byte_data;
     byte_data.ensure_capacity(dB_data.size());
@@ -70,7 +70,8 @@ private:
     Vector<f32> current_time_domain_data();
 
     // https://webaudio.github.io/web-audio-api/#blackman-window
-    Vector<f32> apply_a_blackman_window(Vector<f32> const& x) const;
+    Vector<f32> apply_a_blackman_window(Vector<f32> const& x);
+    Vector<f32> m_blackman_window;
 
     // https://webaudio.github.io/web-audio-api/#smoothing-over-time
     Vector<f32> smoothing_over_time(Vector<f32> const& current_block);
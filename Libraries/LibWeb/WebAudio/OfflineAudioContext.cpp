@@ -4,11 +4,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
 
@@ -58,7 +63,79 @@ OfflineAudioContext::~OfflineAudioContext() = default;
 // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-startrendering
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::start_rendering()
 {
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement OfflineAudioContext::start_rendering"_string);
+    auto& realm = this->realm();
+
+    // 1. If this's relevant global object's associated Document is not fully active then return a promise rejected with "InvalidStateError" DOMException.
+    auto const& associated_document = as<HTML::Window>(HTML::relevant_global_object(*this)).associated_document();
+    if (!associated_document.is_fully_active())
+        return WebIDL::InvalidStateError::create(realm, "Document is not fully active"_string);
+
+    // 2. If the [[rendering started]] slot on the OfflineAudioContext is true, return a rejected promise with InvalidStateError, and abort these steps.
+    if (m_rendering_started)
+        return WebIDL::InvalidStateError::create(realm, "Rendering has already started"_string);
+
+    // 3. Set the [[rendering started]] slot of the OfflineAudioContext to true.
+    m_rendering_started = true;
+
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Create a new AudioBuffer, with a number of channels, length and sample rate equal respectively to the
+    //    numberOfChannels, length and sampleRate values passed to this instance's constructor in the contextOptions
+    //    parameter. Assign this buffer to an internal slot [[rendered buffer]] in the OfflineAudioContext.
+    auto buffer_or_exception = AudioBuffer::create(realm, destination()->channel_count(), m_length, sample_rate());
+
+    // 6. If an exception was thrown during the preceding AudioBuffer constructor call, reject promise with this exception.
+    if (buffer_or_exception.is_exception()) {
+        WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(vm(), buffer_or_exception.release_error()).release_value());
+    }
+    // 7. Otherwise, in the case that the buffer was successfully constructed, begin offline rendering.
+    else {
+        m_rendered_buffer = buffer_or_exception.release_value();
+        begin_offline_rendering(promise);
+    }
+
+    // 8. Append promise to [[pending promises]].
+    m_pending_promises.append(promise);
+
+    // 9. Return promise.
+    return promise;
+}
+
+// https://webaudio.github.io/web-audio-api/#begin-offline-rendering
+void OfflineAudioContext::begin_offline_rendering(GC::Ref<WebIDL::Promise> promise)
+{
+    auto& realm = this->realm();
+
+    // 1. Given the current connections and scheduled changes, start rendering length sample-frames of audio into [[rendered buffer]].
+    // NOTE: [[rendered buffer]] was created silent, which is exactly what gets rendered when nothing is connected to the
+    //       destination. In that case, the buffer is handed to script as is, without rendering or copying anything.
+    // FIXME: Render the audio graph into [[rendered buffer]] once our nodes can produce audio.
+    if (destination()->has_input_connections()) {
+        WebIDL::reject_promise(realm, promise, WebIDL::NotSupportedError::create(realm, "FIXME: Rendering an audio graph is not yet supported"_string));
+        return;
+    }
+
+    // FIXME: 2. For every render quantum, check and suspend rendering if necessary.
+    // FIXME: 3. If a suspended context is resumed, continue to render the buffer.
+
+    // 4. Once the rendering is complete, queue a media element task to execute the following steps:
+    queue_a_media_element_task(GC::create_function(heap(), [&realm, promise, this]() {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        // 1. Resolve the promise created by startRendering() with [[rendered buffer]].
+        WebIDL::resolve_promise(realm, promise, m_rendered_buffer);
+        m_pending_promises.remove_first_matching([&promise](auto& pending_promise) {
+            return pending_promise == promise;
+        });
+
+        // 2. Queue a media element task to fire an event named complete at the OfflineAudioContext using
+        //    OfflineAudioCompletionEvent whose renderedBuffer property is set to [[rendered buffer]].
+        // FIXME: Use an OfflineAudioCompletionEvent once we have one.
+        queue_a_media_element_task(GC::create_function(heap(), [&realm, this]() {
+            this->dispatch_event(DOM::Event::create(realm, HTML::EventNames::complete));
+        }));
+    }));
 }
 
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::resume()
@@ -106,6 +183,7 @@ void OfflineAudioContext::initialize(JS::Realm& realm)
 void OfflineAudioContext::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visitor.visit(m_rendered_buffer);
 }
 
 }
@@ -47,7 +47,15 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    void begin_offline_rendering(GC::Ref<WebIDL::Promise>);
+
     WebIDL::UnsignedLong m_length {};
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendering-started-slot
+    bool m_rendering_started { false };
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendered-buffer-slot
+    GC::Ptr<AudioBuffer> m_rendered_buffer;
 };
 
 }
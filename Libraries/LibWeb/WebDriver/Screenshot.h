@@ -6,14 +6,15 @@
 
 #pragma once
 
-#include <LibGC/Ptr.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebDriver/Response.h>
 
 namespace Web::WebDriver {
 
-ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, DOM::Element&, Gfx::IntRect);
-Response encode_canvas_element(HTML::HTMLCanvasElement&);
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, Gfx::IntRect);
+Response encode_bitmap_as_base64(Gfx::Bitmap const&);
 
 }
@@ -27,6 +27,10 @@ extern "C" {
 
 namespace Web::WebGL {
 
+// NOTE: This is what EGL has made current on this thread, as far as we know. Nothing else in the process uses EGL, so
+//       it can only change through an OpenGLContext.
+static thread_local OpenGLContext* s_current_context = nullptr;
+
 struct OpenGLContext::Impl {
 #ifdef AK_OS_MACOS
     EGLDisplay display { nullptr };
@@ -50,6 +54,7 @@ OpenGLContext::~OpenGLContext()
 {
 #ifdef AK_OS_MACOS
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    s_current_context = nullptr;
     glDeleteFramebuffers(1, &m_impl->framebuffer);
     glDeleteRenderbuffers(1, &m_impl->depth_buffer);
     eglDestroyContext(m_impl->display, m_impl->context);
@@ -207,6 +212,7 @@ void OpenGLContext::allocate_painting_surface_if_needed()
     m_impl->surface = eglCreatePbufferFromClientBuffer(display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), config, surface_attributes);
 
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    s_current_context = this;
 
     EGLint texture_target_name = 0;
     eglGetConfigAttrib(display, config, EGL_BIND_TO_TEXTURE_TARGET_ANGLE, &texture_target_name);
@@ -245,7 +251,15 @@ void OpenGLContext::make_current()
 {
 #ifdef AK_OS_MACOS
     allocate_painting_surface_if_needed();
+
+    // OPTIMIZATION: Every WebGL call makes its context current first, and eglMakeCurrent() is far from free even when
+    //               nothing changes. Since a page usually keeps drawing to the same context, most of these calls can
+    //               be skipped.
+    if (s_current_context == this)
+        return;
+
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    s_current_context = this;
 #endif
 }
 
@@ -15,8 +15,11 @@
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/PhaseTimings.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/CallbackType.h>
 #include <LibWeb/WebIDL/Promise.h>
@@ -33,8 +36,9 @@ bool is_buffer_source_type(JS::Value value)
     return is<JS::TypedArrayBase>(object) || is<JS::DataView>(object) || is<JS::ArrayBuffer>(object);
 }
 
-// https://webidl.spec.whatwg.org/#dfn-get-buffer-source-copy
-ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
+// Steps 1-7 of https://webidl.spec.whatwg.org/#dfn-get-buffer-source-copy, returning a view of the bytes instead of
+// copying them.
+ReadonlyBytes get_buffer_source_bytes(JS::Object const& buffer_source)
 {
     // 1. Let esBufferSource be the result of converting bufferSource to an ECMAScript value.
 
@@ -55,7 +59,7 @@ ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
 
         // AD-HOC: The WebIDL spec has not been updated for resizable ArrayBuffer objects. This check follows the behavior of step 7.
         if (JS::is_typed_array_out_of_bounds(typed_array_record))
-            return ByteBuffer {};
+            return {};
 
         // 1. Set esArrayBuffer to esBufferSource.[[ViewedArrayBuffer]].
         es_array_buffer = es_buffer_source.viewed_array_buffer();
@@ -72,7 +76,7 @@ ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
 
         // AD-HOC: The WebIDL spec has not been updated for resizable ArrayBuffer objects. This check follows the behavior of step 7.
         if (JS::is_view_out_of_bounds(view_record))
-            return ByteBuffer {};
+            return {};
 
         // 1. Set esArrayBuffer to esBufferSource.[[ViewedArrayBuffer]].
         es_array_buffer = es_buffer_source.viewed_array_buffer();
@@ -96,19 +100,22 @@ ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
 
     // 7. If ! IsDetachedBuffer(esArrayBuffer) is true, then return the empty byte sequence.
     if (es_array_buffer->is_detached())
-        return ByteBuffer {};
+        return {};
 
-    // 8. Let bytes be a new byte sequence of length equal to length.
-    auto bytes = TRY(ByteBuffer::create_zeroed(length));
+    return es_array_buffer->buffer().bytes().slice(offset, length);
+}
 
-    // 9. For i in the range offset to offset + length − 1, inclusive, set bytes[i − offset] to ! GetValueFromBuffer(esArrayBuffer, i, Uint8, true, Unordered).
-    for (u64 i = offset; i < offset + length; ++i) {
-        auto value = es_array_buffer->get_value<u8>(i, true, JS::ArrayBuffer::Unordered);
-        bytes[i - offset] = static_cast<u8>(value.as_double());
-    }
+// https://webidl.spec.whatwg.org/#dfn-get-buffer-source-copy
+ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
+{
+    // 1-7. Let esArrayBuffer, offset and length be as for the bytes of bufferSource.
+    auto source_bytes = get_buffer_source_bytes(buffer_source);
 
+    // 8. Let bytes be a new byte sequence of length equal to length.
+    // 9. For i in the range offset to offset + length − 1, inclusive, set bytes[i − offset] to ! GetValueFromBuffer(esArrayBuffer, i, Uint8, true, Unordered).
+    // OPTIMIZATION: Reading the bytes one by one as unordered Uint8 values is the same as copying all of them at once.
     // 10. Return bytes.
-    return bytes;
+    return ByteBuffer::copy(source_bytes);
 }
 
 // https://webidl.spec.whatwg.org/#call-user-object-operation-return
@@ -143,6 +150,8 @@ inline JS::Completion clean_up_on_return(JS::Realm& stored_realm, JS::Realm& rel
 // https://whatpr.org/webidl/1437.html#call-a-user-objects-operation
 JS::Completion call_user_object_operation(CallbackType& callback, String const& operation_name, Optional<JS::Value> this_argument, ReadonlySpan<JS::Value> args)
 {
+    PhaseTimer phase_timer { Phase::JSExecute };
+
     // 1. Let completion be an uninitialized variable.
     JS::Completion completion;
 
@@ -197,7 +206,9 @@ JS::Completion call_user_object_operation(CallbackType& callback, String const&
     //        For simplicity, we currently make the caller do this. However, this means we can't throw exceptions at this point like the spec wants us to.
 
     // 11. Let callResult be Call(X, thisArg, esArgs).
-    auto call_result = JS::call(object->vm(), as<JS::FunctionObject>(*actual_function_object), this_argument.value(), args);
+    auto& function = as<JS::FunctionObject>(*actual_function_object);
+    HTML::relevant_agent(function).event_loop->did_enter_script(function);
+    auto call_result = JS::call(object->vm(), function, this_argument.value(), args);
 
     // 12. If callResult is an abrupt completion, set completion to callResult and jump to the step labeled return.
     if (call_result.is_throw_completion()) {
@@ -244,6 +255,8 @@ JS::ThrowCompletionOr<String> to_usv_string(JS::VM& vm, JS::Value value)
 template<typename ReturnSteps>
 static auto invoke_callback_impl(CallbackType& callback, Optional<JS::Value> this_argument, ReadonlySpan<JS::Value> args, ReturnSteps&& return_steps)
 {
+    PhaseTimer phase_timer { Phase::JSExecute };
+
     // 1. Let completion be an uninitialized variable.
 
     // 2. If thisArg was not given, let thisArg be undefined.
@@ -277,7 +290,9 @@ static auto invoke_callback_impl(CallbackType& callback, Optional<JS::Value> thi
     //           If this throws an exception, set completion to the completion value representing the thrown exception and jump to the step labeled return.
 
     // 10. Let callResult be Call(F, thisArg, jsArgs).
-    auto call_result = JS::call(function_object->vm(), as<JS::FunctionObject>(*function_object), this_argument.value(), args);
+    auto& function = as<JS::FunctionObject>(*function_object);
+    HTML::relevant_agent(function).event_loop->did_enter_script(function);
+    auto call_result = JS::call(function_object->vm(), function, this_argument.value(), args);
 
     // 11. If callResult is an abrupt completion, set completion to callResult and jump to the step labeled return.
     // 12. Set completion to the result of converting callResult.[[Value]] to an IDL value of the same type as callable’s
@@ -20,6 +20,10 @@ bool is_buffer_source_type(JS::Value);
 GC::Ptr<JS::ArrayBuffer> underlying_buffer_source(JS::Object& buffer_source);
 ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source);
 
+// NOTE: The returned bytes are the buffer source's own, so they must not be held on to across anything that can run
+//       script, which could detach or resize the buffer.
+ReadonlyBytes get_buffer_source_bytes(JS::Object const& buffer_source);
+
 JS::Completion call_user_object_operation(CallbackType& callback, String const& operation_name, Optional<JS::Value> this_argument, ReadonlySpan<JS::Value> args);
 
 JS::ThrowCompletionOr<String> to_string(JS::VM&, JS::Value);
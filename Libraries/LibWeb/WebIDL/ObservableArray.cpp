@@ -17,8 +17,9 @@ GC::Ref<ObservableArray> ObservableArray::create(JS::Realm& realm)
     return realm.create<ObservableArray>(realm, prototype);
 }
 
+// NOTE: Setting an indexed value has to go through internal_set(), so that the callbacks get to see it.
 ObservableArray::ObservableArray(JS::Realm& realm, Object& prototype)
-    : JS::Array(realm, prototype)
+    : JS::Array(realm, prototype, MayInterfereWithIndexedPropertyAccess::Yes)
 {
 }
 
@@ -245,6 +245,7 @@ libweb_js_bindings(HTML/PluginArray)
 libweb_js_bindings(HTML/PopStateEvent)
 libweb_js_bindings(HTML/PromiseRejectionEvent)
 libweb_js_bindings(HTML/RadioNodeList)
+libweb_js_bindings(HTML/Scheduler)
 libweb_js_bindings(HTML/ShadowRealmGlobalScope GLOBAL)
 libweb_js_bindings(HTML/SharedWorker)
 libweb_js_bindings(HTML/SharedWorkerGlobalScope GLOBAL)
@@ -287,6 +288,8 @@ libweb_js_bindings(Internals/Internals)
 libweb_js_bindings(Internals/WebUI)
 libweb_js_bindings(IntersectionObserver/IntersectionObserver)
 libweb_js_bindings(IntersectionObserver/IntersectionObserverEntry)
+libweb_js_bindings(LongTasks/PerformanceLongTaskTiming)
+libweb_js_bindings(LongTasks/TaskAttributionTiming)
 libweb_js_bindings(MathML/MathMLElement)
 libweb_js_bindings(MediaCapabilitiesAPI/MediaCapabilities)
 libweb_js_bindings(MediaSourceExtensions/BufferedChangeEvent)
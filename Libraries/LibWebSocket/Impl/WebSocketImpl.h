@@ -29,6 +29,10 @@ public:
 
     virtual bool handshake_complete_when_connected() const { return false; }
 
+    // If the implementation performs the opening handshake itself, this returns the value of the server's
+    // Sec-WebSocket-Extensions header, i.e. the extensions in use.
+    virtual Optional<ByteString> negotiated_extensions() const { return {}; }
+
     Function<void()> on_connected;
     Function<void()> on_connection_error;
     Function<void()> on_ready_to_read;
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibCompress/Deflate.h>
+#include <LibWebSocket/PerMessageDeflate.h>
+
+namespace WebSocket {
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+// Each compressed message is a chunk of one deflate stream that lasts for the whole connection, ending with a sync flush
+// whose trailing empty stored block is removed before sending.
+static constexpr Array<u8, 4> empty_stored_block { 0x00, 0x00, 0xff, 0xff };
+
+// NOTE: The deflate stream never ends, so we must not tell the decompressor that it's reached the end of its input just
+//       because we've given it all the messages received so far.
+class PerMessageDeflate::InputStream final : public Stream {
+public:
+    virtual ErrorOr<Bytes> read_some(Bytes bytes) override { return m_buffer.read_some(bytes); }
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes bytes) override { return m_buffer.write_some(bytes); }
+    virtual bool is_eof() const override { return false; }
+    virtual bool is_open() const override { return true; }
+    virtual void close() override { }
+
+    bool is_empty() const { return m_buffer.used_buffer_size() == 0; }
+
+private:
+    AllocatingMemoryStream m_buffer;
+};
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+ErrorOr<NonnullOwnPtr<PerMessageDeflate>> PerMessageDeflate::create(ReadonlySpan<StringView> response_parameters)
+{
+    bool has_server_no_context_takeover = false;
+    bool has_client_no_context_takeover = false;
+    bool has_server_max_window_bits = false;
+
+    for (auto parameter : response_parameters) {
+        auto name = parameter;
+        Optional<StringView> value;
+
+        if (auto equals = parameter.find('='); equals.has_value()) {
+            name = parameter.substring_view(0, *equals).trim_whitespace();
+            value = parameter.substring_view(*equals + 1).trim_whitespace();
+            if (value->length() >= 2 && value->starts_with('"') && value->ends_with('"'))
+                value = value->substring_view(1, value->length() - 2);
+        }
+
+        // A server MUST decline an extension negotiation offer for this extension if the negotiation offer contains
+        // multiple extension parameters with the same name, so we fail the connection if the response does.
+        if (name.equals_ignoring_ascii_case("server_no_context_takeover"sv)) {
+            if (has_server_no_context_takeover || value.has_value())
+                return Error::from_string_literal("Invalid server_no_context_takeover parameter");
+            has_server_no_context_takeover = true;
+
+            // NOTE: Keeping the previous messages around for decompression does no harm if the server doesn't refer to
+            //       them, so there's nothing for us to do.
+            continue;
+        }
+
+        if (name.equals_ignoring_ascii_case("client_no_context_takeover"sv)) {
+            if (has_client_no_context_takeover || value.has_value())
+                return Error::from_string_literal("Invalid client_no_context_takeover parameter");
+            has_client_no_context_takeover = true;
+            continue;
+        }
+
+        if (name.equals_ignoring_ascii_case("server_max_window_bits"sv)) {
+            if (has_server_max_window_bits || !value.has_value())
+                return Error::from_string_literal("Invalid server_max_window_bits parameter");
+
+            auto window_bits = value->to_number<u8>();
+            if (!window_bits.has_value() || *window_bits < 8 || *window_bits > 15)
+                return Error::from_string_literal("Invalid server_max_window_bits parameter");
+            has_server_max_window_bits = true;
+
+            // NOTE: We always decompress with the largest window, which can decode data compressed with a smaller one.
+            continue;
+        }
+
+        // NOTE: This also rejects client_max_window_bits, which the server may only send if we offered it, which we don't.
+        return Error::from_string_literal("Unsupported permessage-deflate parameter");
+    }
+
+    auto compressed_output = TRY(try_make<AllocatingMemoryStream>());
+    auto compressed_input = TRY(try_make<InputStream>());
+    auto per_message_deflate = TRY(adopt_nonnull_own_or_enomem(new (nothrow) PerMessageDeflate(has_client_no_context_takeover, move(compressed_output), move(compressed_input))));
+
+    TRY(per_message_deflate->reset_compressor());
+    per_message_deflate->m_decompressor = TRY(Compress::DeflateDecompressor::create(MaybeOwned<Stream> { *per_message_deflate->m_compressed_input }));
+
+    return per_message_deflate;
+}
+
+PerMessageDeflate::PerMessageDeflate(bool client_no_context_takeover, NonnullOwnPtr<AllocatingMemoryStream> compressed_output, NonnullOwnPtr<InputStream> compressed_input)
+    : m_client_no_context_takeover(client_no_context_takeover)
+    , m_compressed_output(move(compressed_output))
+    , m_compressed_input(move(compressed_input))
+{
+}
+
+PerMessageDeflate::~PerMessageDeflate() = default;
+
+ErrorOr<void> PerMessageDeflate::reset_compressor()
+{
+    m_compressor = TRY(Compress::DeflateCompressor::create(MaybeOwned<Stream> { *m_compressed_output }, Compress::GenericZlibCompressionLevel::Fastest));
+    return {};
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+ErrorOr<ByteBuffer> PerMessageDeflate::compress_message(ReadonlyBytes payload)
+{
+    // 1. Compress all the octets of the payload of the message using DEFLATE.
+    TRY(m_compressor->write_until_depleted(payload));
+
+    // 2. If the resulting data does not end with an empty DEFLATE block with no compression (the "BTYPE" bits are set to
+    //    00), append an empty DEFLATE block with no compression to the tail end.
+    TRY(m_compressor->sync_flush());
+
+    auto compressed = TRY(ByteBuffer::create_uninitialized(m_compressed_output->used_buffer_size()));
+    TRY(m_compressed_output->read_until_filled(compressed));
+    VERIFY(compressed.size() >= empty_stored_block.size());
+    VERIFY(compressed.bytes().slice(compressed.size() - empty_stored_block.size()) == empty_stored_block.span());
+
+    // 3. Remove 4 octets (that are 0x00 0x00 0xff 0xff) from the tail end. After this step, the last octet of the
+    //    compressed data contains (possibly part of) the DEFLATE header bits with the "BTYPE" bits set to 00.
+    compressed.resize(compressed.size() - empty_stored_block.size());
+
+    // https://datatracker.ietf.org/doc/html/rfc7692#section-7.1.1.2
+    // If the server agreed to client_no_context_takeover, we must start every message with an empty sliding window.
+    if (m_client_no_context_takeover)
+        TRY(reset_compressor());
+
+    return compressed;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.2
+ErrorOr<ByteBuffer> PerMessageDeflate::decompress_message(ReadonlyBytes payload)
+{
+    // 1. Append 4 octets of 0x00 0x00 0xff 0xff to the tail end of the payload of the message.
+    TRY(m_compressed_input->write_until_depleted(payload));
+    TRY(m_compressed_input->write_until_depleted(empty_stored_block));
+
+    // 2. Decompress the resulting data using DEFLATE.
+    // NOTE: The empty stored block flushes all the message's data out of the decompressor, so once it has consumed all of
+    //       its input and stopped filling our buffer, we have the whole message.
+    ByteBuffer message;
+    Array<u8, 16 * KiB> buffer;
+
+    while (true) {
+        auto decompressed = TRY(m_decompressor->read_some(buffer));
+        TRY(message.try_append(decompressed));
+
+        if (decompressed.size() < buffer.size() && m_compressed_input->is_empty())
+            break;
+    }
+
+    return message;
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/MemoryStream.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringView.h>
+#include <LibCompress/Forward.h>
+
+namespace WebSocket {
+
+// https://datatracker.ietf.org/doc/html/rfc7692
+// Compresses and decompresses the payload of messages on a connection which negotiated the "permessage-deflate" extension.
+class PerMessageDeflate {
+    AK_MAKE_NONCOPYABLE(PerMessageDeflate);
+    AK_MAKE_NONMOVABLE(PerMessageDeflate);
+
+public:
+    static constexpr auto extension_name = "permessage-deflate"sv;
+
+    // NOTE: Compressing small messages costs more than it saves, so we send them as they are.
+    static constexpr size_t min_compressed_payload_size = 64;
+
+    // Creates the extension from the parameters the server included in its response, e.g. "server_no_context_takeover".
+    static ErrorOr<NonnullOwnPtr<PerMessageDeflate>> create(ReadonlySpan<StringView> response_parameters);
+    ~PerMessageDeflate();
+
+    ErrorOr<ByteBuffer> compress_message(ReadonlyBytes);
+    ErrorOr<ByteBuffer> decompress_message(ReadonlyBytes);
+
+private:
+    class InputStream;
+
+    PerMessageDeflate(bool client_no_context_takeover, NonnullOwnPtr<AllocatingMemoryStream> compressed_output, NonnullOwnPtr<InputStream> compressed_input);
+
+    ErrorOr<void> reset_compressor();
+
+    bool m_client_no_context_takeover { false };
+
+    NonnullOwnPtr<AllocatingMemoryStream> m_compressed_output;
+    OwnPtr<Compress::DeflateCompressor> m_compressor;
+
+    NonnullOwnPtr<InputStream> m_compressed_input;
+    OwnPtr<Compress::DeflateDecompressor> m_decompressor;
+};
+
+}
@@ -35,6 +35,17 @@ void WebSocket::start()
     if (!m_impl)
         m_impl = adopt_ref(*new WebSocketImplSerenity);
 
+    // OPTIMIZATION: Offer to compress messages, which most servers support, and which especially helps with the many
+    //               small, repetitive (e.g. JSON) messages that are typically sent over WebSockets.
+    auto extensions = m_connection.extensions();
+    auto offers_per_message_deflate = extensions.first_matching([](auto const& extension) {
+        return extension.view().starts_with(PerMessageDeflate::extension_name, CaseSensitivity::CaseInsensitive);
+    });
+    if (!offers_per_message_deflate.has_value()) {
+        extensions.append(PerMessageDeflate::extension_name);
+        m_connection.set_extensions(move(extensions));
+    }
+
     m_impl->on_connection_error = [this] {
         dbgln("WebSocket: Connection error (underlying socket)");
         fatal_error(WebSocket::Error::CouldNotEstablishConnection);
@@ -43,6 +54,13 @@ void WebSocket::start()
         if (m_state != WebSocket::InternalState::EstablishingProtocolConnection)
             return;
         if (m_impl->handshake_complete_when_connected()) {
+            if (auto extensions = m_impl->negotiated_extensions(); extensions.has_value()) {
+                if (auto result = accept_extensions(*extensions); result.is_error()) {
+                    fail_connection(to_underlying(CloseStatusCode::ProtocolError), WebSocket::Error::ConnectionUpgradeFailed,
+                        ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which could not be accepted: {}. Failing connection.", *extensions, result.error()));
+                    return;
+                }
+            }
             set_state(WebSocket::InternalState::Open);
             notify_open();
         } else {
@@ -89,10 +107,16 @@ void WebSocket::send(Message const& message)
     // Calling send on a socket that is not opened is not allowed
     VERIFY(m_state == WebSocket::InternalState::Open);
     VERIFY(m_impl);
-    if (message.is_text())
-        send_frame(WebSocket::OpCode::Text, message.data(), true);
-    else
-        send_frame(WebSocket::OpCode::Binary, message.data(), true);
+    auto op_code = message.is_text() ? WebSocket::OpCode::Text : WebSocket::OpCode::Binary;
+
+    if (m_per_message_deflate && message.data().size() >= PerMessageDeflate::min_compressed_payload_size) {
+        // FIXME: Handle possible OOM situation.
+        auto compressed_payload = m_per_message_deflate->compress_message(message.data()).release_value_but_fixme_should_propagate_errors();
+        send_frame(op_code, compressed_payload, true, true);
+        return;
+    }
+
+    send_frame(op_code, message.data(), true);
 }
 
 void WebSocket::close(u16 code, ByteString const& message)
@@ -154,7 +178,10 @@ void WebSocket::drain_read()
         do {
             if (auto maybe_error = read_frame(); maybe_error.is_error())
                 break;
-        } while (!m_buffered_data.is_empty());
+        } while (m_buffered_data_offset < m_buffered_data.size());
+
+        m_buffered_data.remove(0, m_buffered_data_offset);
+        m_buffered_data_offset = 0;
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -352,19 +379,10 @@ void WebSocket::read_server_handshake()
 
         if (header_name.equals_ignoring_ascii_case("Sec-WebSocket-Extensions"sv)) {
             // 5. |Sec-WebSocket-Extensions| should not contain an extension that doesn't appear in m_connection->extensions()
-            auto server_extensions = parts[1].split(',');
-            for (auto const& extension : server_extensions) {
-                auto trimmed_extension = extension.trim_whitespace();
-                bool found_extension = false;
-                for (auto const& supported_extension : m_connection.extensions()) {
-                    if (trimmed_extension.equals_ignoring_ascii_case(supported_extension)) {
-                        found_extension = true;
-                    }
-                }
-                if (!found_extension) {
-                    fail_opening_handshake(ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which is not supported by the client. Failing connection.", trimmed_extension));
-                    return;
-                }
+            auto server_extensions = parts[1].trim_whitespace();
+            if (auto result = accept_extensions(server_extensions); result.is_error()) {
+                fail_opening_handshake(ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which could not be accepted: {}. Failing connection.", server_extensions, result.error()));
+                return;
             }
             continue;
         }
@@ -391,12 +409,48 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
+// https://datatracker.ietf.org/doc/html/rfc6455#section-9.1
+ErrorOr<void> WebSocket::accept_extensions(StringView server_extensions)
+{
+    Vector<ByteString> extensions_in_use;
+
+    for (auto extension : server_extensions.split_view(',')) {
+        auto parameters = extension.split_view(';');
+        if (parameters.is_empty())
+            continue;
+
+        auto name = parameters.take_first().trim_whitespace();
+        for (auto& parameter : parameters)
+            parameter = parameter.trim_whitespace();
+
+        auto was_offered = m_connection.extensions().first_matching([&](auto const& offered_extension) {
+            auto offered_name = offered_extension.view().find(';').map([&](auto index) { return offered_extension.view().substring_view(0, index); }).value_or(offered_extension.view());
+            return offered_name.trim_whitespace().equals_ignoring_ascii_case(name);
+        });
+        if (!was_offered.has_value())
+            return AK::Error::from_string_literal("The server is using an extension the client didn't offer");
+
+        if (name.equals_ignoring_ascii_case(PerMessageDeflate::extension_name)) {
+            if (m_per_message_deflate)
+                return AK::Error::from_string_literal("The server is using permessage-deflate more than once");
+            m_per_message_deflate = TRY(PerMessageDeflate::create(parameters));
+        }
+
+        extensions_in_use.append(extension.trim_whitespace());
+    }
+
+    m_extensions_in_use = ByteString::join(", "sv, extensions_in_use);
+    return {};
+}
+
 ErrorOr<void> WebSocket::read_frame()
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
+    // NOTE: We only drop the frames we have read from the buffer once we've read all complete frames, rather than after
+    //       every frame, so that a burst of small messages doesn't shift the remaining data over and over again.
+    size_t cursor = m_buffered_data_offset;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
         if (cursor + count > m_buffered_data.size())
             return {};
@@ -416,6 +470,8 @@ ErrorOr<void> WebSocket::read_frame()
 
     auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
     bool is_final_frame = head_bytes[0] & 0x80;
+    // https://datatracker.ietf.org/doc/html/rfc7692#section-6
+    bool is_compressed = head_bytes[0] & 0x40;
     bool is_masked = head_bytes[1] & 0x80;
 
     // Parse the payload length.
@@ -475,13 +531,7 @@ ErrorOr<void> WebSocket::read_frame()
         read_length += payload_part.size();
     }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    m_buffered_data_offset = cursor;
 
     if (is_masked) {
         // Unmask the payload
@@ -490,6 +540,15 @@ ErrorOr<void> WebSocket::read_frame()
         }
     }
 
+    if (is_compressed) {
+        // The "Per-Message Compressed" bit may only be set on the first frame of data messages, and only if we're using
+        // the permessage-deflate extension.
+        if (!m_per_message_deflate || (op_code != WebSocket::OpCode::Text && op_code != WebSocket::OpCode::Binary)) {
+            fail_connection(to_underlying(CloseStatusCode::ProtocolError), WebSocket::Error::ServerClosedSocket, "Server sent a frame with the RSV1 bit set, which we didn't negotiate");
+            return AK::Error::from_errno(EPROTO);
+        }
+    }
+
     if (op_code == WebSocket::OpCode::ConnectionClose) {
         if (payload.size() > 1) {
             m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
@@ -514,6 +573,7 @@ ErrorOr<void> WebSocket::read_frame()
         if (op_code != WebSocket::OpCode::Continuation) {
             // First fragmented message
             m_initial_fragment_opcode = op_code;
+            m_initial_fragment_is_compressed = is_compressed;
         }
         // First and next fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
@@ -523,9 +583,17 @@ ErrorOr<void> WebSocket::read_frame()
         // Last fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
-        m_fragmented_data_buffer.clear();
+        is_compressed = m_initial_fragment_is_compressed;
+        payload = move(m_fragmented_data_buffer);
+        m_fragmented_data_buffer = {};
+    }
+    if (is_compressed) {
+        auto decompressed_payload = m_per_message_deflate->decompress_message(payload);
+        if (decompressed_payload.is_error()) {
+            fail_connection(to_underlying(CloseStatusCode::InvalidPayload), WebSocket::Error::ServerClosedSocket, ByteString::formatted("Server sent a message that could not be decompressed: {}", decompressed_payload.error()));
+            return AK::Error::from_errno(EPROTO);
+        }
+        payload = decompressed_payload.release_value();
     }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(move(payload), true));
@@ -539,7 +607,7 @@ ErrorOr<void> WebSocket::read_frame()
     return {};
 }
 
-void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
+void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final, bool is_compressed)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
@@ -547,7 +615,7 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
     ByteBuffer buf = MUST(ByteBuffer::create_uninitialized(1 + 9 + 4 + payload.size()));
     size_t offset = 0;
 
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
+    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | (is_compressed ? 0x40 : 0x00) | ((u8)(op_code) & 0xf)) };
     buf.overwrite(offset, frame_head, 1);
     offset += 1;
     // Section 5.1 : a client MUST mask all frames that it sends to the server
@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include <AK/OwnPtr.h>
 #include <AK/Span.h>
 #include <LibCore/EventReceiver.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Impl/WebSocketImpl.h>
 #include <LibWebSocket/Message.h>
+#include <LibWebSocket/PerMessageDeflate.h>
 
 namespace WebSocket {
 
@@ -47,6 +49,7 @@ public:
     ReadyState ready_state();
 
     ByteString subprotocol_in_use();
+    ByteString const& extensions_in_use() const { return m_extensions_in_use; }
 
     // Call this to start the WebSocket connection.
     void start();
@@ -89,8 +92,10 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
+    ErrorOr<void> accept_extensions(StringView server_extensions);
+
     ErrorOr<void> read_frame();
-    void send_frame(OpCode, ReadonlyBytes, bool is_final);
+    void send_frame(OpCode, ReadonlyBytes, bool is_final, bool is_compressed = false);
 
     void notify_open();
     void notify_close(u16 code, ByteString reason, bool was_clean);
@@ -118,6 +123,9 @@ private:
     void fail_connection(u16 close_status_code, WebSocket::Error, ByteString const& reason);
 
     ByteString m_subprotocol_in_use { ByteString::empty() };
+    ByteString m_extensions_in_use { ByteString::empty() };
+
+    OwnPtr<PerMessageDeflate> m_per_message_deflate;
 
     ByteString m_websocket_key;
     bool m_has_read_server_handshake_first_line { false };
@@ -134,8 +142,11 @@ private:
     RefPtr<WebSocketImpl> m_impl;
 
     Vector<u8> m_buffered_data;
+    size_t m_buffered_data_offset { 0 };
+
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
+    bool m_initial_fragment_is_compressed { false };
 };
 
 }
@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
@@ -102,11 +103,14 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_scripting = false;
     bool disable_sql_database = false;
     Optional<u16> devtools_port;
+    Optional<size_t> spare_web_content_process_count;
+    Optional<size_t> spare_web_worker_process_count;
     Optional<StringView> debug_process;
     Optional<StringView> profile_process;
     Optional<StringView> webdriver_content_ipc_path;
     Optional<StringView> user_agent_preset;
     Optional<StringView> dns_server_address;
+    Optional<StringView> har_output_path;
     Optional<u16> dns_server_port;
     bool use_dns_over_tls = false;
     bool layout_test_mode = false;
@@ -115,6 +119,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_http_disk_cache = false;
+    bool use_shared_memory_for_response_bodies = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
@@ -160,8 +166,13 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(layout_test_mode, "Enable layout test mode", "layout-test-mode");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
+    args_parser.add_option(spare_web_content_process_count, "Number of WebContent processes to keep ready for new tabs (default: 1)", "spare-web-content-processes", 0, "count");
+    args_parser.add_option(spare_web_worker_process_count, "Number of WebWorker processes to keep ready for new dedicated workers (default: 1)", "spare-web-worker-processes", 0, "count");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
+    args_parser.add_option(use_shared_memory_for_response_bodies, "Send response bodies from RequestServer through shared memory", "use-shared-memory-for-response-bodies");
+    args_parser.add_option(har_output_path, "Record all network requests to an HTTP archive (HAR) at the given path", "har-output", 0, "path");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
@@ -232,6 +243,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .allow_popups = allow_popups ? AllowPopups::Yes : AllowPopups::No,
         .disable_scripting = disable_scripting ? DisableScripting::Yes : DisableScripting::No,
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
+        .enable_http_disk_cache = enable_http_disk_cache ? EnableHTTPDiskCache::Yes : EnableHTTPDiskCache::No,
+        .use_shared_memory_for_response_bodies = use_shared_memory_for_response_bodies ? UseSharedMemoryForResponseBodies::Yes : UseSharedMemoryForResponseBodies::No,
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
         .dns_settings = (dns_server_address.has_value()
@@ -249,6 +262,14 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     if (webdriver_content_ipc_path.has_value())
         m_browser_options.webdriver_content_ipc_path = *webdriver_content_ipc_path;
+    if (har_output_path.has_value())
+        m_browser_options.har_output_path = *har_output_path;
+
+    if (spare_web_content_process_count.has_value())
+        m_browser_options.spare_web_content_process_count = *spare_web_content_process_count;
+
+    if (spare_web_worker_process_count.has_value())
+        m_browser_options.spare_web_worker_process_count = *spare_web_worker_process_count;
 
     m_web_content_options = {
         .command_line = MUST(String::join(' ', m_arguments.strings)),
@@ -287,8 +308,9 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
 
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
+    if (!m_spare_web_content_processes.is_empty()) {
+        // The oldest spare process has had the most time to finish starting up.
+        auto web_content_client = m_spare_web_content_processes.take_first();
         launch_spare_web_content_process();
 
         web_content_client->assign_view({}, view);
@@ -308,10 +330,15 @@ void Application::launch_spare_web_content_process()
     if (browser_options().profile_helper_process == ProcessType::WebContent)
         return;
 
+    if (m_spare_web_content_processes.size() >= browser_options().spare_web_content_process_count)
+        return;
+
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
 
+    // NOTE: We only launch one spare process per event loop iteration, so that refilling the pool doesn't hold up the
+    //       UI, and then queue another launch until the pool is full.
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
@@ -321,10 +348,59 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
+        m_spare_web_content_processes.append(web_content_client.release_value());
 
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(m_spare_web_content_processes.last()->pid()); process.has_value())
             process->set_title("(spare)"_string);
+
+        launch_spare_web_content_process();
+    });
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    // NOTE: Only dedicated workers are common enough to be worth keeping a process around for. A spare process is
+    //       launched with its type already decided, so this would otherwise need a pool per worker type.
+    if (type != Web::Bindings::AgentType::DedicatedWorker)
+        return WebView::launch_web_worker_process(type);
+
+    if (!m_spare_web_worker_processes.is_empty()) {
+        // The oldest spare process has had the most time to finish starting up.
+        auto web_worker_client = m_spare_web_worker_processes.take_first();
+        launch_spare_web_worker_process();
+        return web_worker_client;
+    }
+
+    launch_spare_web_worker_process();
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_web_worker_process()
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as for WebContent.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_spare_web_worker_processes.size() >= browser_options().spare_web_worker_process_count)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_web_worker_process)
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_process = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_web_worker_process = false;
+
+        auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_web_worker_processes.append(web_worker_client.release_value());
+        launch_spare_web_worker_process();
     });
 }
 
@@ -362,6 +438,19 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); memory_pressure_watcher.is_error()) {
+        warnln("Unable to monitor memory pressure: {}", memory_pressure_watcher.error());
+    } else {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure_level_changed = [](Core::MemoryPressureLevel level) {
+            WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+                client.async_memory_pressure_level_changed(level);
+                return IterationDecision::Continue;
+            });
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
 
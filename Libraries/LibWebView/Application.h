@@ -18,6 +18,8 @@
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Bindings/AgentType.h>
+#include <LibWeb/Worker/WebWorkerClient.h>
 #include <LibWebView/Options.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
@@ -52,6 +54,7 @@ public:
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
 
     void add_child_process(Process&&);
 
@@ -88,6 +91,7 @@ protected:
 private:
     ErrorOr<void> launch_services();
     void launch_spare_web_content_process();
+    void launch_spare_web_worker_process();
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -135,14 +139,18 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>> m_spare_web_worker_processes;
+    bool m_has_queued_task_to_launch_spare_web_worker_process { false };
+
     RefPtr<Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
+    OwnPtr<Core::MemoryPressureWatcher> m_memory_pressure_watcher;
 
     OwnPtr<Core::EventLoop> m_event_loop;
     OwnPtr<ProcessManager> m_process_manager;
@@ -45,6 +45,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new CookieJar { PersistedStorage { database, statements } });
 }
@@ -67,11 +69,7 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
-            for (auto const& it : m_transient_storage.take_dirty_cookies())
-                m_persisted_storage->insert_cookie(it.value);
-
-            auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            m_persisted_storage->synchronize(m_transient_storage);
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -538,7 +536,9 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    // OPTIMIZATION: A cookie's domain is either identical to the canonicalized host, or (for domain-matching) one of its
+    //               parent domains. So rather than looking at every cookie in the store, only look at those.
+    m_transient_storage.for_each_cookie_for_domain_or_parent_domains(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -612,15 +612,38 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_cookie_keys_by_domain.clear();
+    for (auto const& it : m_cookies)
+        index_cookie(it.key);
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
+    index_cookie(key);
+
     m_cookies.set(key, cookie);
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
+void CookieJar::TransientStorage::index_cookie(CookieStorageKey const& key)
+{
+    m_cookie_keys_by_domain.ensure(key.domain).set(key);
+}
+
+void CookieJar::TransientStorage::unindex_cookie(CookieStorageKey const& key)
+{
+    auto keys = m_cookie_keys_by_domain.find(key.domain);
+    if (keys == m_cookie_keys_by_domain.end())
+        return;
+
+    keys->value.remove(key);
+    if (keys->value.is_empty())
+        m_cookie_keys_by_domain.remove(keys);
+}
+
 Optional<Web::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
     return m_cookies.get(key);
@@ -636,7 +659,13 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
+    auto is_expired = [&](auto const& key, auto const& cookie) {
+        if (cookie.expiry_time >= now)
+            return false;
+
+        unindex_cookie(key);
+        return true;
+    };
     m_cookies.remove_all_matching(is_expired);
 
     return now;
@@ -652,6 +681,21 @@ void CookieJar::TransientStorage::expire_and_purge_all_cookies()
     purge_expired_cookies();
 }
 
+void CookieJar::PersistedStorage::synchronize(TransientStorage& transient_storage)
+{
+    // OPTIMIZATION: Write all changes within a single transaction. Otherwise, SQLite commits (and syncs to disk) after
+    //               every single statement.
+    database.execute_statement(statements.begin_transaction, {});
+
+    for (auto const& it : transient_storage.take_dirty_cookies())
+        insert_cookie(it.value);
+
+    auto now = transient_storage.purge_expired_cookies();
+    database.execute_statement(statements.expire_cookie, {}, now);
+
+    database.execute_statement(statements.commit_transaction, {});
+}
+
 void CookieJar::PersistedStorage::insert_cookie(Web::Cookie::Cookie const& cookie)
 {
     database.execute_statement(
@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -34,6 +35,8 @@ class CookieJar {
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class TransientStorage {
@@ -67,12 +70,45 @@ class CookieJar {
             }
         }
 
+        // Invokes the callback for each cookie whose domain is the given domain or one of its parent domains, i.e. for
+        // every cookie which may domain-match it. The cookies are looked up by domain, so this only costs as much as the
+        // number of cookies set for those domains, rather than the number of cookies in the jar.
+        template<typename Callback>
+        void for_each_cookie_for_domain_or_parent_domains(StringView domain, Callback callback)
+        {
+            auto invoke_for_domain = [&](StringView domain) {
+                auto keys = m_cookie_keys_by_domain.find(domain);
+                if (keys == m_cookie_keys_by_domain.end())
+                    return;
+
+                for (auto const& key : keys->value) {
+                    if (auto cookie = m_cookies.find(key); cookie != m_cookies.end())
+                        callback(cookie->value);
+                }
+            };
+
+            while (true) {
+                invoke_for_domain(domain);
+
+                auto label_separator = domain.find('.');
+                if (!label_separator.has_value())
+                    break;
+                domain = domain.substring_view(*label_separator + 1);
+            }
+        }
+
     private:
+        void index_cookie(CookieStorageKey const&);
+        void unindex_cookie(CookieStorageKey const&);
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
     };
 
     struct PersistedStorage {
+        void synchronize(TransientStorage&);
         void insert_cookie(Web::Cookie::Cookie const& cookie);
         TransientStorage::Cookies select_all_cookies();
 
@@ -206,6 +206,13 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
     for (auto const& certificate : WebView::Application::browser_options().certificates)
         arguments.append(ByteString::formatted("--certificate={}", certificate));
 
+    if (WebView::Application::browser_options().enable_http_disk_cache == WebView::EnableHTTPDiskCache::Yes)
+        arguments.append("--enable-http-disk-cache"sv);
+    if (WebView::Application::browser_options().use_shared_memory_for_response_bodies == WebView::UseSharedMemoryForResponseBodies::Yes)
+        arguments.append("--use-shared-memory-for-response-bodies"sv);
+    if (auto const& har_output_path = WebView::Application::browser_options().har_output_path; har_output_path.has_value())
+        arguments.append(ByteString::formatted("--har-output={}", *har_output_path));
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
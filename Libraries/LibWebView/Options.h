@@ -47,6 +47,16 @@ enum class DisableSQLDatabase {
     Yes,
 };
 
+enum class EnableHTTPDiskCache {
+    No,
+    Yes,
+};
+
+enum class UseSharedMemoryForResponseBodies {
+    No,
+    Yes,
+};
+
 enum class EnableAutoplay {
     No,
     Yes,
@@ -80,11 +90,16 @@ struct BrowserOptions {
     AllowPopups allow_popups { AllowPopups::No };
     DisableScripting disable_scripting { DisableScripting::No };
     DisableSQLDatabase disable_sql_database { DisableSQLDatabase::No };
+    EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
+    UseSharedMemoryForResponseBodies use_shared_memory_for_response_bodies { UseSharedMemoryForResponseBodies::No };
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
+    Optional<ByteString> har_output_path {};
     Optional<DNSSettings> dns_settings {};
     Optional<u16> devtools_port;
+    size_t spare_web_content_process_count { 1 };
+    size_t spare_web_worker_process_count { 1 };
 };
 
 enum class IsLayoutTestMode {
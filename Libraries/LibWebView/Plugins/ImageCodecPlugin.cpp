@@ -32,6 +32,37 @@ void ImageCodecPlugin::set_client(NonnullRefPtr<ImageDecoderClient::Client> clie
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
 NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    return decode_image_impl(bytes, move(on_resolved), move(on_rejected), ImageDecoderClient::Client::StreamAnimationFrames::No);
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image_streaming_animation_frames(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    return decode_image_impl(bytes, move(on_resolved), move(on_rejected), ImageDecoderClient::Client::StreamAnimationFrames::Yes);
+}
+
+void ImageCodecPlugin::request_animation_frames(i64 animation_id, size_t first_frame_index, size_t frame_count, AnimationFramesCallback on_frames_decoded)
+{
+    // NOTE: If ImageDecoder went away, the decoder state of the animation went with it, and it just won't advance.
+    if (!m_client)
+        return;
+
+    m_client->request_animation_frames(animation_id, first_frame_index, frame_count, [on_frames_decoded = move(on_frames_decoded)](u32 first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps, Vector<u32> durations) {
+        Vector<Web::Platform::Frame> frames;
+        frames.ensure_capacity(bitmaps.size());
+        for (size_t i = 0; i < bitmaps.size(); ++i)
+            frames.unchecked_append({ move(bitmaps[i]), durations[i] });
+        on_frames_decoded(first_frame_index, move(frames));
+    });
+}
+
+void ImageCodecPlugin::release_animation(i64 animation_id)
+{
+    if (m_client)
+        m_client->release_animation(animation_id);
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image_impl(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoderClient::Client::StreamAnimationFrames stream_animation_frames)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -55,12 +86,15 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
                 decoded_image.frames.empend(move(frame.bitmap), frame.duration);
             }
             decoded_image.color_space = move(result.color_space);
+            decoded_image.streamed_animation_id = result.streamed_animation_id;
+            decoded_image.frame_count = result.frame_count;
             promise->resolve(move(decoded_image));
             return {};
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        {}, {}, stream_animation_frames);
 
     return promise;
 }
@@ -18,10 +18,15 @@ public:
     virtual ~ImageCodecPlugin() override;
 
     virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image_streaming_animation_frames(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual void request_animation_frames(i64 animation_id, size_t first_frame_index, size_t frame_count, AnimationFramesCallback) override;
+    virtual void release_animation(i64 animation_id) override;
 
     void set_client(NonnullRefPtr<ImageDecoderClient::Client>);
 
 private:
+    NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image_impl(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoderClient::Client::StreamAnimationFrames);
+
     RefPtr<ImageDecoderClient::Client> m_client;
 };
 
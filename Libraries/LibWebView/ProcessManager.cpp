@@ -126,6 +126,16 @@ void ProcessManager::update_all_process_statistics()
     (void)update_process_statistics(m_statistics);
 }
 
+Optional<AK::Duration> ProcessManager::cpu_time_of_process(pid_t pid)
+{
+    Threading::MutexLocker locker { m_lock };
+    for (auto const& info : m_statistics.processes) {
+        if (info->pid == pid)
+            return info->cpu_time;
+    }
+    return {};
+}
+
 JsonValue ProcessManager::serialize_json()
 {
     Threading::MutexLocker locker { m_lock };
@@ -6,6 +6,7 @@
 
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StdLibExtras.h>
+#include <AK/Time.h>
 #include <LibWebView/StorageJar.h>
 
 namespace WebView {
@@ -13,6 +14,8 @@ namespace WebView {
 // Quota size is specified in https://storage.spec.whatwg.org/#registered-storage-endpoints
 static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
 
+static constexpr auto DATABASE_SYNCHRONIZATION_DELAY = AK::Duration::from_seconds(1);
+
 ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
 {
     Statements statements {};
@@ -29,10 +32,10 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
 
     statements.set_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage VALUES (?, ?, ?, ?);"sv));
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
-    statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
+    statements.get_items = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
 }
@@ -45,178 +48,203 @@ NonnullOwnPtr<StorageJar> StorageJar::create()
 StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
     : m_persisted_storage(move(persisted_storage))
 {
-}
+    if (!m_persisted_storage.has_value())
+        return;
 
-StorageJar::~StorageJar() = default;
+    m_transient_storage.set_should_track_dirty_items(true);
 
-Optional<String> StorageJar::get_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
-{
-    StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_item(storage_location);
-    return m_transient_storage.get_item(storage_location);
+    m_persisted_storage->synchronization_timer = Core::Timer::create_single_shot(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_DELAY.to_milliseconds()),
+        [this]() {
+            m_persisted_storage->synchronize(m_transient_storage);
+        });
 }
 
-StorageOperationError StorageJar::set_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& bottle_value)
+StorageJar::~StorageJar()
 {
-    StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->set_item(storage_location, bottle_value);
-    return m_transient_storage.set_item(storage_location, bottle_value);
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer->stop();
+    m_persisted_storage->synchronize(m_transient_storage);
 }
 
-void StorageJar::remove_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& key)
+StorageJar::StorageArea& StorageJar::storage_area(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    StorageLocation storage_location { storage_endpoint, storage_key, key };
-    if (m_persisted_storage.has_value()) {
-        m_persisted_storage->delete_item(storage_location);
-    } else {
-        m_transient_storage.delete_item(storage_location);
-    }
+    return m_transient_storage.ensure_area(storage_endpoint, storage_key, [&]() {
+        // NOTE: All of a storage key's items are read from the database the first time any of them is needed. A storage
+        //       key can only hold LOCAL_STORAGE_QUOTA worth of items, and keeping them around means that nothing after
+        //       that has to go through the database, other than writing back the changes.
+        if (m_persisted_storage.has_value())
+            return m_persisted_storage->select_items(storage_endpoint, storage_key);
+        return StorageArea {};
+    });
 }
 
-void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key)
+void StorageJar::did_modify_storage()
 {
-    if (m_persisted_storage.has_value()) {
-        m_persisted_storage->clear(storage_endpoint, storage_key);
-    } else {
-        m_transient_storage.clear(storage_endpoint, storage_key);
-    }
+    if (!m_persisted_storage.has_value())
+        return;
+
+    // OPTIMIZATION: Changes are written back to the database a little while after they were made, all at once, so that
+    //               a page which writes to its storage in a loop doesn't cause a database write for every single item.
+    if (!m_persisted_storage->synchronization_timer->is_active())
+        m_persisted_storage->synchronization_timer->start();
 }
 
-Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+Optional<String> StorageJar::get_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
 {
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_keys(storage_endpoint, storage_key);
-    return m_transient_storage.get_keys(storage_endpoint, storage_key);
+    return storage_area(storage_endpoint, storage_key).items.get(bottle_key).copy();
 }
 
-StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
+StorageOperationError StorageJar::set_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& bottle_value)
 {
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
+    auto& area = storage_area(storage_endpoint, storage_key);
 
-    auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
-        return StorageOperationError::QuotaExceededError;
-    }
-
-    database.execute_statement(
-        statements.set_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key,
-        value);
+    auto result = m_transient_storage.set_item(area, { storage_endpoint, storage_key, bottle_key }, bottle_value);
+    if (result == StorageOperationError::None)
+        did_modify_storage();
 
-    return StorageOperationError::None;
+    return result;
 }
 
-void StorageJar::PersistedStorage::delete_item(StorageLocation const& key)
+void StorageJar::remove_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& key)
 {
-    database.execute_statement(
-        statements.delete_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
-}
+    auto& area = storage_area(storage_endpoint, storage_key);
 
-Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
-{
-    Optional<String> result;
-    database.execute_statement(
-        statements.get_item,
-        [&](auto statement_id) {
-            result = database.result_column<String>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
-    return result;
+    m_transient_storage.delete_item(area, { storage_endpoint, storage_key, key });
+    did_modify_storage();
 }
 
-void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
+void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    database.execute_statement(
-        statements.clear,
-        {},
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
+    auto& area = storage_area(storage_endpoint, storage_key);
+
+    m_transient_storage.clear(area, storage_endpoint, storage_key);
+    did_modify_storage();
 }
 
-Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
 {
+    auto const& area = storage_area(storage_endpoint, storage_key);
+
     Vector<String> keys;
-    database.execute_statement(
-        statements.get_keys,
-        [&](auto statement_id) {
-            keys.append(database.result_column<String>(statement_id, 0));
-        },
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
+    keys.ensure_capacity(area.items.size());
+    for (auto const& key : area.items.keys())
+        keys.unchecked_append(key);
     return keys;
 }
 
-StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation const& key, String const& value)
+static size_t item_size(String const& key, String const& value)
 {
-    u64 current_size = 0;
-    for (auto const& [existing_key, existing_value] : m_storage_items) {
-        if (existing_key.storage_endpoint == key.storage_endpoint && existing_key.storage_key == key.storage_key && existing_key.bottle_key != key.bottle_key) {
-            current_size += existing_key.bottle_key.bytes().size();
-            current_size += existing_value.bytes().size();
-        }
-    }
+    return key.bytes().size() + value.bytes().size();
+}
 
-    auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
+StorageOperationError StorageJar::TransientStorage::set_item(StorageArea& area, StorageLocation const& key, String const& value)
+{
+    auto current_size = area.size;
+    if (auto existing_value = area.items.get(key.bottle_key); existing_value.has_value())
+        current_size -= item_size(key.bottle_key, *existing_value);
+
+    auto new_size = item_size(key.bottle_key, value);
     if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
         return StorageOperationError::QuotaExceededError;
     }
 
-    m_storage_items.set(key, value);
+    area.items.set(key.bottle_key, value);
+    area.size = current_size + new_size;
+
+    if (m_should_track_dirty_items)
+        m_dirty_items.set(key, value);
     return StorageOperationError::None;
 }
 
-Optional<String> StorageJar::TransientStorage::get_item(StorageLocation const& key)
+void StorageJar::TransientStorage::delete_item(StorageArea& area, StorageLocation const& key)
 {
-    if (auto value = m_storage_items.get(key); value.has_value())
-        return value.value();
-    return OptionalNone {};
+    auto existing_value = area.items.take(key.bottle_key);
+    if (!existing_value.has_value())
+        return;
+
+    area.size -= item_size(key.bottle_key, *existing_value);
+
+    if (m_should_track_dirty_items)
+        m_dirty_items.set(key, OptionalNone {});
 }
 
-void StorageJar::TransientStorage::delete_item(StorageLocation const& key)
+void StorageJar::TransientStorage::clear(StorageArea& area, StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    m_storage_items.remove(key);
+    area.items.clear();
+    area.size = 0;
+
+    if (!m_should_track_dirty_items)
+        return;
+
+    // NOTE: Clearing the storage key in the database takes care of any changes to it that have not been written back yet.
+    m_dirty_items.remove_all_matching([&](auto const& key, auto const&) {
+        return key.storage_endpoint == storage_endpoint && key.storage_key == storage_key;
+    });
+
+    StorageLocation area_location { storage_endpoint, storage_key, {} };
+    if (!m_cleared_areas.contains_slow(area_location))
+        m_cleared_areas.append(move(area_location));
 }
 
-void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
+void StorageJar::PersistedStorage::synchronize(TransientStorage& transient_storage)
 {
-    Vector<StorageLocation> keys_to_remove;
-    for (auto const& [key, value] : m_storage_items) {
-        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
-            keys_to_remove.append(key);
+    if (!transient_storage.has_dirty_items())
+        return;
+
+    // OPTIMIZATION: Write all changes within a single transaction. Otherwise, SQLite commits (and syncs to disk) after
+    //               every single statement.
+    database.execute_statement(statements.begin_transaction, {});
+
+    // NOTE: Storage keys are cleared before anything else is written, as items that were set after a storage key was
+    //       cleared are the only changes to it that are still dirty.
+    for (auto const& area : transient_storage.take_cleared_areas()) {
+        database.execute_statement(
+            statements.clear,
+            {},
+            static_cast<int>(to_underlying(area.storage_endpoint)),
+            area.storage_key);
     }
 
-    for (auto const& key : keys_to_remove) {
-        m_storage_items.remove(key);
+    for (auto const& [key, value] : transient_storage.take_dirty_items()) {
+        if (value.has_value()) {
+            database.execute_statement(
+                statements.set_item,
+                {},
+                static_cast<int>(to_underlying(key.storage_endpoint)),
+                key.storage_key,
+                key.bottle_key,
+                *value);
+        } else {
+            database.execute_statement(
+                statements.delete_item,
+                {},
+                static_cast<int>(to_underlying(key.storage_endpoint)),
+                key.storage_key,
+                key.bottle_key);
+        }
     }
+
+    database.execute_statement(statements.commit_transaction, {});
 }
 
-Vector<String> StorageJar::TransientStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+StorageJar::StorageArea StorageJar::PersistedStorage::select_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
-    for (auto const& [key, value] : m_storage_items) {
-        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
-            keys.append(key.bottle_key);
-    }
-    return keys;
+    StorageArea area;
+    database.execute_statement(
+        statements.get_items,
+        [&](auto statement_id) {
+            auto key = database.result_column<String>(statement_id, 0);
+            auto value = database.result_column<String>(statement_id, 1);
+
+            area.size += item_size(key, value);
+            area.items.set(move(key), move(value));
+        },
+        static_cast<int>(to_underlying(storage_endpoint)),
+        storage_key);
+    return area;
 }
 
 }
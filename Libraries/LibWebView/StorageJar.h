@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <AK/Traits.h>
+#include <LibCore/Timer.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWebView/Database.h>
 #include <LibWebView/Forward.h>
@@ -26,6 +27,22 @@ struct StorageLocation {
     String bottle_key;
 };
 
+}
+
+template<>
+struct AK::Traits<WebView::StorageLocation> : public AK::DefaultTraits<WebView::StorageLocation> {
+    static unsigned hash(WebView::StorageLocation const& key)
+    {
+        unsigned hash = 0;
+        hash = pair_int_hash(hash, to_underlying(key.storage_endpoint));
+        hash = pair_int_hash(hash, key.storage_key.hash());
+        hash = pair_int_hash(hash, key.bottle_key.hash());
+        return hash;
+    }
+};
+
+namespace WebView {
+
 class StorageJar {
     AK_MAKE_NONCOPYABLE(StorageJar);
     AK_MAKE_NONMOVABLE(StorageJar);
@@ -46,35 +63,61 @@ private:
     struct Statements {
         Database::StatementID set_item { 0 };
         Database::StatementID delete_item { 0 };
-        Database::StatementID get_item { 0 };
         Database::StatementID clear { 0 };
-        Database::StatementID get_keys { 0 };
-        Database::StatementID calculate_size_excluding_key { 0 };
+        Database::StatementID get_items { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+    };
+
+    // The items stored for a single storage key in a single storage endpoint, along with their total size, so that the
+    // quota can be enforced without adding up the size of every item on every write.
+    struct StorageArea {
+        HashMap<String, String> items;
+        size_t size { 0 };
     };
 
     class TransientStorage {
     public:
-        StorageOperationError set_item(StorageLocation const& key, String const& value);
-        Optional<String> get_item(StorageLocation const& key);
-        void delete_item(StorageLocation const& key);
-        void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        template<typename Callback>
+        StorageArea& ensure_area(StorageEndpointType storage_endpoint, String const& storage_key, Callback&& initialization_callback)
+        {
+            return m_storage_areas.ensure({ storage_endpoint, storage_key, {} }, forward<Callback>(initialization_callback));
+        }
+
+        StorageOperationError set_item(StorageArea&, StorageLocation const& key, String const& value);
+        void delete_item(StorageArea&, StorageLocation const& key);
+        void clear(StorageArea&, StorageEndpointType storage_endpoint, String const& storage_key);
+
+        // A missing value means that the item was removed.
+        using DirtyItems = HashMap<StorageLocation, Optional<String>>;
+        auto take_dirty_items() { return move(m_dirty_items); }
+        auto take_cleared_areas() { return move(m_cleared_areas); }
+        bool has_dirty_items() const { return !m_dirty_items.is_empty() || !m_cleared_areas.is_empty(); }
+
+        // Changes only need to be remembered if they will be written back to a database.
+        void set_should_track_dirty_items(bool should_track_dirty_items) { m_should_track_dirty_items = should_track_dirty_items; }
 
     private:
-        HashMap<StorageLocation, String> m_storage_items;
+        // NOTE: The bottle key of the locations used for storage areas is always empty.
+        HashMap<StorageLocation, StorageArea> m_storage_areas;
+
+        DirtyItems m_dirty_items;
+        Vector<StorageLocation> m_cleared_areas;
+        bool m_should_track_dirty_items { false };
     };
 
     struct PersistedStorage {
-        StorageOperationError set_item(StorageLocation const& key, String const& value);
-        Optional<String> get_item(StorageLocation const& key);
-        void delete_item(StorageLocation const& key);
-        void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        void synchronize(TransientStorage&);
+        StorageArea select_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
         Database& database;
         Statements statements;
+        RefPtr<Core::Timer> synchronization_timer {};
     };
 
+    StorageArea& storage_area(StorageEndpointType storage_endpoint, String const& storage_key);
+    void did_modify_storage();
+
     explicit StorageJar(Optional<PersistedStorage>);
 
     Optional<PersistedStorage> m_persisted_storage;
@@ -82,15 +125,3 @@ private:
 };
 
 }
-
-template<>
-struct AK::Traits<WebView::StorageLocation> : public AK::DefaultTraits<WebView::StorageLocation> {
-    static unsigned hash(WebView::StorageLocation const& key)
-    {
-        unsigned hash = 0;
-        hash = pair_int_hash(hash, to_underlying(key.storage_endpoint));
-        hash = pair_int_hash(hash, key.storage_key.hash());
-        hash = pair_int_hash(hash, key.bottle_key.hash());
-        return hash;
-    }
-};
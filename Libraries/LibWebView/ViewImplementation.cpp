@@ -10,6 +10,7 @@
 #include <LibCore/StandardPaths.h>
 #include <LibCore/Timer.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibIPC/Connection.h>
 #include <LibWeb/Clipboard/SystemClipboard.h>
 #include <LibWeb/Crypto/Crypto.h>
 #include <LibWeb/Infra/Strings.h>
@@ -408,6 +409,10 @@ void ViewImplementation::request_style_sheet_source(Web::CSS::StyleSheetIdentifi
 
 void ViewImplementation::debug_request(ByteString const& request, ByteString const& argument)
 {
+    // NOTE: The UI process's own connections are dumped here, WebContent dumps its connections itself.
+    if (request == "dump-ipc-statistics")
+        IPC::ConnectionBase::dump_statistics_of_all_connections();
+
     client().async_debug_request(page_id(), request, argument);
 }
 
@@ -786,6 +791,20 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::dump_gc_heap_statistics()
+{
+    auto promise = request_internal_page_info(PageInfoType::GCHeapStatistics);
+    auto statistics_json = TRY(promise->await());
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("gc-heap-statistics-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(dump_file->write_until_depleted(statistics_json.bytes()));
+
+    return path;
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
     client().async_set_user_style(page_id(), source);
@@ -793,8 +812,8 @@ void ViewImplementation::set_user_style_sheet(String const& source)
 
 void ViewImplementation::use_native_user_style_sheet()
 {
-    extern String native_stylesheet_source;
-    set_user_style_sheet(native_stylesheet_source);
+    extern StringView native_stylesheet_source;
+    set_user_style_sheet(MUST(String::from_utf8(native_stylesheet_source)));
 }
 
 }
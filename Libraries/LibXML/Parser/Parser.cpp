@@ -174,6 +174,22 @@ void Parser::leave_node()
     if (m_listener) {
         auto& element = m_entered_node->content.get<Node::Element>();
         m_listener->element_end(element.name);
+
+        // OPTIMIZATION: The listener has seen everything there is to see about this element, so there is no need to
+        //               keep it around until the whole document is parsed. Since nothing else is appended to the tree
+        //               when there's a listener, only the elements that are currently open stay alive this way,
+        //               instead of a complete copy of the document alongside the one the listener is building.
+        auto* parent = m_entered_node->parent;
+        if (parent) {
+            auto& children = parent->content.get<Node::Element>().children;
+            VERIFY(children.last().ptr() == m_entered_node);
+            children.take_last();
+        } else {
+            VERIFY(m_root_node.ptr() == m_entered_node);
+            m_root_node.clear();
+        }
+        m_entered_node = parent;
+        return;
     }
 
     m_entered_node = m_entered_node->parent;
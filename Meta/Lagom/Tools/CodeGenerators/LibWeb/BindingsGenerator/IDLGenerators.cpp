@@ -420,6 +420,14 @@ static void generate_to_string(SourceGenerator& scoped_generator, ParameterType
         scoped_generator.set("to_string", "to_string"sv);
     }
 
+    // OPTIMIZATION: Converting a string to a DOMString can't fail or have side effects, so we don't go through the
+    //               generic conversion for those.
+    auto js_value = ByteString::formatted("{}{}", scoped_generator.get("js_name"), scoped_generator.get("js_suffix"));
+    if (parameter.type->name() == "DOMString")
+        scoped_generator.set("to_string_expression", ByteString::formatted("{0}.is_string() ? {0}.as_string().utf8_string() : TRY(WebIDL::to_string(vm, {0}))", js_value));
+    else
+        scoped_generator.set("to_string_expression", ByteString::formatted("TRY(WebIDL::{}(vm, {}))", scoped_generator.get("to_string"), js_value));
+
     if (variadic) {
         scoped_generator.append(R"~~~(
     Vector<String> @cpp_name@;
@@ -438,14 +446,14 @@ static void generate_to_string(SourceGenerator& scoped_generator, ParameterType
             scoped_generator.append(R"~~~(
     @string_type@ @cpp_name@;
     if (!@legacy_null_to_empty_string@ || !@js_name@@js_suffix@.is_null()) {
-        @cpp_name@ = TRY(WebIDL::@to_string@(vm, @js_name@@js_suffix@));
+        @cpp_name@ = @to_string_expression@;
     }
 )~~~");
         } else {
             scoped_generator.append(R"~~~(
     Optional<@string_type@> @cpp_name@;
     if (!@js_name@@js_suffix@.is_nullish())
-        @cpp_name@ = TRY(WebIDL::@to_string@(vm, @js_name@@js_suffix@));
+        @cpp_name@ = @to_string_expression@;
 )~~~");
         }
     } else {
@@ -464,13 +472,13 @@ static void generate_to_string(SourceGenerator& scoped_generator, ParameterType
             scoped_generator.append(R"~~~(
     if (!@js_name@@js_suffix@.is_undefined()) {
         if (!@js_name@@js_suffix@.is_null())
-            @cpp_name@ = TRY(WebIDL::@to_string@(vm, @js_name@@js_suffix@));
+            @cpp_name@ = @to_string_expression@;
     })~~~");
         } else {
             scoped_generator.append(R"~~~(
     if (!@js_name@@js_suffix@.is_undefined()) {
         if (!@legacy_null_to_empty_string@ || !@js_name@@js_suffix@.is_null())
-            @cpp_name@ = TRY(WebIDL::@to_string@(vm, @js_name@@js_suffix@));
+            @cpp_name@ = @to_string_expression@;
     })~~~");
         }
         if (!may_be_null) {
@@ -573,8 +581,12 @@ static void generate_to_integral(SourceGenerator& scoped_generator, ParameterTyp
     @cpp_name@ = @js_name@@js_suffix@.to_boolean();
 )~~~");
     } else {
+        // OPTIMIZATION: Integers are most often passed as int32 values, which neither rounding, clamping nor wrapping
+        //               changes as long as they're in range of the IDL type.
         scoped_generator.append(R"~~~(
-    @cpp_name@ = TRY(WebIDL::convert_to_int<@cpp_type@>(vm, @js_name@@js_suffix@, WebIDL::EnforceRange::@enforce_range@, WebIDL::Clamp::@clamp@));
+    @cpp_name@ = @js_name@@js_suffix@.is_int32() && AK::is_within_range<@cpp_type@>(@js_name@@js_suffix@.as_i32())
+        ? static_cast<@cpp_type@>(@js_name@@js_suffix@.as_i32())
+        : TRY(WebIDL::convert_to_int<@cpp_type@>(vm, @js_name@@js_suffix@, WebIDL::EnforceRange::@enforce_range@, WebIDL::Clamp::@clamp@));
 )~~~");
     }
 
@@ -1807,10 +1819,18 @@ void IDL::ParameterizedType::generate_sequence_from_iterable(SourceGenerator& ge
     IDL::Parameter parameter { .type = parameters().first(), .name = iterable_cpp_name, .optional_default_value = {}, .extended_attributes = {} };
     generate_to_cpp(sequence_generator, parameter, "next_item", ByteString::number(recursion_depth), ByteString::formatted("sequence_item{}", recursion_depth), interface, false, false, {}, false, recursion_depth);
 
-    sequence_generator.append(R"~~~(
+    // NOTE: Platform objects are converted to references, which can't be moved from.
+    if (IDL::is_platform_object(*parameters().first())) {
+        sequence_generator.append(R"~~~(
     @cpp_name@.append(sequence_item@recursion_depth@);
     }
 )~~~");
+    } else {
+        sequence_generator.append(R"~~~(
+    @cpp_name@.append(move(sequence_item@recursion_depth@));
+    }
+)~~~");
+    }
 }
 
 static void generate_wrap_statement(SourceGenerator& generator, ByteString const& value, IDL::Type const& type, IDL::Interface const& interface, StringView result_expression, size_t recursion_depth = 0, bool is_optional = false)
@@ -4792,6 +4812,7 @@ using namespace Web::HTML;
 using namespace Web::IndexedDB;
 using namespace Web::Internals;
 using namespace Web::IntersectionObserver;
+using namespace Web::LongTasks;
 using namespace Web::MediaCapabilitiesAPI;
 using namespace Web::MediaSourceExtensions;
 using namespace Web::NavigationTiming;
@@ -1,6 +1,8 @@
 #!/usr/bin/env python3
 r"""
-Embeds a file into a String, a la #embed from C++23
+Embeds a file into a StringView, a la #embed from C++23
+
+The contents end up in the read-only data of the binary, so they are shared by every process that loads it.
 """
 
 import argparse
@@ -16,15 +18,15 @@ def main():
     args = parser.parse_args()
 
     with open(args.output, "w") as f:
-        f.write("#include <AK/String.h>\n")
+        f.write("#include <AK/StringView.h>\n")
         if args.namespace:
             f.write(f"namespace {args.namespace} {{\n")
-        f.write(f"extern String {args.variable_name};\n")
-        f.write(f'String {args.variable_name} = R"~~~(')
+        f.write(f"extern StringView {args.variable_name};\n")
+        f.write(f'StringView {args.variable_name} = R"~~~(')
         with open(args.input, "r") as input:
             for line in input.readlines():
                 f.write(f"{line}")
-        f.write(')~~~"_string;\n')
+        f.write(')~~~"sv;\n')
         if args.namespace:
             f.write("}\n")
 
@@ -8,6 +8,8 @@
 #include <AK/IDAllocator.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
@@ -30,12 +32,18 @@ void ConnectionFromClient::die()
     }
     m_pending_jobs.clear();
 
+    for (auto& [_, animation] : m_streamed_animations) {
+        if (animation->pending_job)
+            animation->pending_job->cancel();
+    }
+    m_streamed_animations.clear();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
 
     if (s_connections.is_empty()) {
-        Threading::quit_background_thread();
+        DecodePool::the().shut_down();
         Core::EventLoop::current().quit(0);
     }
 }
@@ -84,11 +92,20 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+// NOTE: Animations that would take up more memory than this with all of their frames decoded are decoded a few frames at a
+//       time instead, if the client can deal with that.
+static constexpr size_t maximum_decoded_animation_size = 32 * MiB;
+static constexpr size_t initial_streamed_animation_frame_count = 8;
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, size_t first_frame_index, size_t end_frame_index, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
-    bitmaps.ensure_capacity(decoder.frame_count());
-    durations.ensure_capacity(decoder.frame_count());
-    for (size_t i = 0; i < decoder.frame_count(); ++i) {
+    end_frame_index = min(end_frame_index, decoder.frame_count());
+    if (first_frame_index >= end_frame_index)
+        return;
+
+    bitmaps.ensure_capacity(end_frame_index - first_frame_index);
+    durations.ensure_capacity(end_frame_index - first_frame_index);
+    for (size_t i = first_frame_index; i < end_frame_index; ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
             bitmaps.unchecked_append({});
@@ -101,7 +118,16 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
     }
 }
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+static bool should_stream_animation_frames(Gfx::ImageDecoder& decoder, Optional<Gfx::IntSize> ideal_size)
+{
+    if (!decoder.is_animated() || decoder.frame_count() <= initial_streamed_animation_frame_count)
+        return false;
+    auto frame_size = ideal_size.value_or(decoder.size());
+    auto decoded_size = static_cast<u64>(frame_size.width()) * frame_size.height() * sizeof(u32) * decoder.frame_count();
+    return decoded_size > maximum_decoded_animation_size;
+}
+
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type, bool stream_animation_frames)
 {
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
 
@@ -114,6 +140,7 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     ConnectionFromClient::DecodeResult result;
     result.is_animated = decoder->is_animated();
     result.loop_count = decoder->loop_count();
+    result.frame_count = decoder->frame_count();
 
     if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
         result.color_profile = maybe_icc_data.value();
@@ -134,35 +161,71 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    auto frames_to_decode = decoder->frame_count();
+    if (stream_animation_frames && should_stream_animation_frames(*decoder, ideal_size))
+        frames_to_decode = initial_streamed_animation_frame_count;
+
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, 0, frames_to_decode, bitmaps, result.durations);
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
 
     result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
 
+    if (frames_to_decode < decoder->frame_count())
+        result.decoder_for_remaining_frames = adopt_own(*new ConnectionFromClient::AnimationDecoder { move(encoded_buffer), decoder.release_nonnull(), ideal_size });
+
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
-{
-    return Job::construct(
-        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
-            return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
-        },
-        [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
-            strong_this->m_pending_jobs.remove(image_id);
-            return {};
-        },
-        [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
-            if (strong_this->is_open())
-                strong_this->async_did_fail_to_decode_image(image_id, MUST(String::formatted("Decoding failed: {}", error)));
-            strong_this->m_pending_jobs.remove(image_id);
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool stream_animation_frames)
+{
+    // NOTE: This runs on one of the decode pool's threads, so we don't hold on to the connection itself.
+    //       The result is handed back to the main thread, which looks the connection up again.
+    return Job::create(
+        [client_id = client_id(), image_id, encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type), stream_animation_frames, origin_event_loop = &Core::EventLoop::current()](Job& job) mutable {
+            auto decode_start_time = MonotonicTime::now_coarse();
+            auto result = decode_image_to_details(encoded_buffer, ideal_size, mime_type, stream_animation_frames);
+            auto decode_time = MonotonicTime::now_coarse() - decode_start_time;
+
+            if (job.is_canceled())
+                return;
+
+            origin_event_loop->deferred_invoke([client_id, image_id, job = NonnullRefPtr(job), result = move(result), decode_time]() mutable {
+                if (auto connection = s_connections.get(client_id); connection.has_value())
+                    connection.value()->did_finish_decode_job(image_id, *job, move(result), job->queue_time(), decode_time);
+            });
+            origin_event_loop->wake();
         });
 }
 
-Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+void ConnectionFromClient::did_finish_decode_job(i64 image_id, Job const& job, ErrorOr<DecodeResult> result, AK::Duration queue_time, AK::Duration decode_time)
+{
+    // The job may have been canceled while its result was on the way, or this may be a new client that reused the ID of a dead one.
+    auto pending_job = m_pending_jobs.get(image_id);
+    if (!pending_job.has_value() || pending_job.value().ptr() != &job)
+        return;
+    m_pending_jobs.remove(image_id);
+
+    if (result.is_error()) {
+        if (is_open())
+            async_did_fail_to_decode_image(image_id, MUST(String::formatted("Decoding failed: {}", result.error())));
+        return;
+    }
+
+    dbgln_if(IMAGE_DECODER_DEBUG, "Decoded image {} in {}ms after waiting {}ms", image_id, decode_time.to_milliseconds(), queue_time.to_milliseconds());
+
+    auto decode_result = result.release_value();
+    if (decode_result.decoder_for_remaining_frames) {
+        auto animation = make<StreamedAnimation>();
+        animation->decoder = move(decode_result.decoder_for_remaining_frames);
+        m_streamed_animations.set(image_id, move(animation));
+    }
+
+    async_did_decode_image(image_id, decode_result.is_animated, decode_result.loop_count, decode_result.frame_count, move(decode_result.bitmaps), move(decode_result.durations), decode_result.scale, move(decode_result.color_profile), queue_time, decode_time);
+}
+
+Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool stream_animation_frames)
 {
     auto image_id = m_next_image_id++;
 
@@ -172,7 +235,9 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return image_id;
     }
 
-    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    auto job = make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type), stream_animation_frames);
+    m_pending_jobs.set(image_id, job);
+    DecodePool::the().enqueue(move(job));
 
     return image_id;
 }
@@ -184,4 +249,72 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     }
 }
 
+void ConnectionFromClient::prioritize_decoding(i64 image_id)
+{
+    if (auto job = m_pending_jobs.get(image_id); job.has_value())
+        DecodePool::the().prioritize(*job.value());
+}
+
+void ConnectionFromClient::request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count)
+{
+    auto animation = m_streamed_animations.get(image_id);
+    if (!animation.has_value())
+        return;
+
+    if (!animation.value()->decoder) {
+        animation.value()->next_request = FrameRange { first_frame_index, frame_count };
+        return;
+    }
+
+    start_animation_frames_job(image_id, *animation.value(), { first_frame_index, frame_count });
+}
+
+void ConnectionFromClient::release_animation(i64 image_id)
+{
+    if (auto animation = m_streamed_animations.take(image_id); animation.has_value() && animation.value()->pending_job)
+        animation.value()->pending_job->cancel();
+}
+
+void ConnectionFromClient::start_animation_frames_job(i64 image_id, StreamedAnimation& animation, FrameRange frames)
+{
+    VERIFY(animation.decoder);
+
+    auto job = Job::create(
+        [client_id = client_id(), image_id, decoder = animation.decoder.release_nonnull(), frames, origin_event_loop = &Core::EventLoop::current()](Job& job) mutable {
+            Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+            Vector<u32> durations;
+            decode_image_to_bitmaps_and_durations_with_decoder(*decoder->decoder, decoder->ideal_size, frames.first_frame_index, static_cast<size_t>(frames.first_frame_index) + frames.frame_count, bitmaps, durations);
+
+            // NOTE: Even if the job was canceled, the decoder goes back to the main thread, which is the only one that
+            //       may release it while the connection might still be using the buffer it reads from.
+            origin_event_loop->deferred_invoke([client_id, image_id, job = NonnullRefPtr(job), decoder = move(decoder), first_frame_index = frames.first_frame_index, bitmaps = move(bitmaps), durations = move(durations)]() mutable {
+                if (auto connection = s_connections.get(client_id); connection.has_value())
+                    connection.value()->did_finish_animation_frames_job(image_id, *job, move(decoder), first_frame_index, Gfx::BitmapSequence { move(bitmaps) }, move(durations));
+            });
+            origin_event_loop->wake();
+        });
+
+    animation.pending_job = job;
+    DecodePool::the().enqueue(move(job), DecodePool::Priority::High);
+}
+
+void ConnectionFromClient::did_finish_animation_frames_job(i64 image_id, Job const& job, NonnullOwnPtr<AnimationDecoder> decoder, u32 first_frame_index, Gfx::BitmapSequence bitmaps, Vector<u32> durations)
+{
+    auto animation = m_streamed_animations.get(image_id);
+    if (!animation.has_value() || animation.value()->pending_job.ptr() != &job)
+        return;
+
+    auto& streamed_animation = *animation.value();
+    streamed_animation.pending_job = nullptr;
+    streamed_animation.decoder = move(decoder);
+
+    if (!job.is_canceled() && is_open())
+        async_did_decode_animation_frames(image_id, first_frame_index, move(bitmaps), move(durations));
+
+    if (auto next_request = streamed_animation.next_request; next_request.has_value()) {
+        streamed_animation.next_request.clear();
+        start_animation_frames_job(image_id, streamed_animation, *next_request);
+    }
+}
+
 }
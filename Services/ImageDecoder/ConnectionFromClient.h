@@ -7,13 +7,14 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <ImageDecoder/DecodePool.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibIPC/ConnectionFromClient.h>
-#include <LibThreading/BackgroundAction.h>
 
 namespace ImageDecoder {
 
@@ -26,6 +27,12 @@ public:
 
     virtual void die() override;
 
+    struct AnimationDecoder {
+        Core::AnonymousBuffer encoded_buffer;
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+        Optional<Gfx::IntSize> ideal_size;
+    };
+
     struct DecodeResult {
         bool is_animated = false;
         u32 loop_count = 0;
@@ -33,24 +40,53 @@ public:
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+
+        // Set if only the first few frames of an animation were decoded, to decode the rest of them with later.
+        u32 frame_count = 0;
+        OwnPtr<AnimationDecoder> decoder_for_remaining_frames;
     };
 
 private:
-    using Job = Threading::BackgroundAction<DecodeResult>;
+    using Job = DecodePool::Job;
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
-    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
+    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool stream_animation_frames) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void prioritize_decoding(i64 image_id) override;
+    virtual void request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count) override;
+    virtual void release_animation(i64 image_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::File> connect_new_client();
 
-    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool stream_animation_frames);
+    void did_finish_decode_job(i64 image_id, Job const&, ErrorOr<DecodeResult>, AK::Duration queue_time, AK::Duration decode_time);
+
+    // An animation whose frames are decoded a few at a time, as the client asks for them. The decoder keeps whatever
+    // state it needs to continue from the frames it decoded last.
+    struct FrameRange {
+        u32 first_frame_index { 0 };
+        u32 frame_count { 0 };
+    };
+
+    struct StreamedAnimation {
+        // NOTE: Neither the decoder nor the buffer it reads from can be shared between threads, so while a job is decoding
+        //       frames, it has them to itself, and hands them back once it's done.
+        OwnPtr<AnimationDecoder> decoder;
+
+        // The latest request that came in while a job was decoding frames, which is started once the job is done.
+        RefPtr<Job> pending_job;
+        Optional<FrameRange> next_request;
+    };
+
+    void start_animation_frames_job(i64 image_id, StreamedAnimation&, FrameRange);
+    void did_finish_animation_frames_job(i64 image_id, Job const&, NonnullOwnPtr<AnimationDecoder>, u32 first_frame_index, Gfx::BitmapSequence, Vector<u32> durations);
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, NonnullOwnPtr<StreamedAnimation>> m_streamed_animations;
 };
 
 }
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <ImageDecoder/DecodePool.h>
+#include <LibCore/System.h>
+
+namespace ImageDecoder {
+
+// Decoding is mostly memory bound, so more threads than this don't buy us much, and every
+// thread brings its own set of decoded bitmaps with it.
+static constexpr size_t max_decode_thread_count = 4;
+
+DecodePool& DecodePool::the()
+{
+    static NeverDestroyed<DecodePool> pool;
+    return *pool;
+}
+
+DecodePool::DecodePool()
+    : m_max_thread_count(clamp(Core::System::hardware_concurrency(), 1u, max_decode_thread_count))
+{
+}
+
+void DecodePool::enqueue(NonnullRefPtr<Job> job, Priority priority)
+{
+    Threading::MutexLocker locker(m_mutex);
+    VERIFY(!m_should_exit);
+
+    if (priority == Priority::High)
+        m_high_priority_jobs.enqueue(move(job));
+    else
+        m_normal_priority_jobs.enqueue(move(job));
+
+    spawn_thread_if_needed();
+    m_condition.signal();
+}
+
+void DecodePool::prioritize(Job& job)
+{
+    Threading::MutexLocker locker(m_mutex);
+    if (job.m_state.load() != Job::State::Queued)
+        return;
+
+    // NOTE: The job stays in the normal priority queue as well. Whichever copy is dequeued first marks it as
+    //       running, and take_next_job() skips the other one.
+    m_high_priority_jobs.enqueue(job);
+    m_condition.signal();
+}
+
+void DecodePool::spawn_thread_if_needed()
+{
+    if (m_idle_thread_count > 0 || m_threads.size() >= m_max_thread_count)
+        return;
+
+    auto thread = Threading::Thread::construct([this] { return worker_loop(); }, "ImageDecode"sv);
+    thread->start();
+    m_threads.append(move(thread));
+}
+
+RefPtr<DecodePool::Job> DecodePool::take_next_job()
+{
+    auto take_from = [](Queue<NonnullRefPtr<Job>>& queue) -> RefPtr<Job> {
+        while (!queue.is_empty()) {
+            auto job = queue.dequeue();
+            auto expected = Job::State::Queued;
+            if (job->m_state.compare_exchange_strong(expected, Job::State::Running))
+                return job;
+        }
+        return nullptr;
+    };
+
+    if (auto job = take_from(m_high_priority_jobs))
+        return job;
+    return take_from(m_normal_priority_jobs);
+}
+
+intptr_t DecodePool::worker_loop()
+{
+    while (true) {
+        RefPtr<Job> job;
+        {
+            Threading::MutexLocker locker(m_mutex);
+            ++m_idle_thread_count;
+            while (!m_should_exit && !(job = take_next_job()))
+                m_condition.wait();
+            --m_idle_thread_count;
+        }
+
+        if (!job)
+            return 0;
+
+        job->m_queue_time = MonotonicTime::now_coarse() - job->m_enqueue_time;
+        job->m_work(*job);
+        job->m_work = nullptr;
+    }
+}
+
+void DecodePool::shut_down()
+{
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_should_exit = true;
+        m_high_priority_jobs.clear();
+        m_normal_priority_jobs.clear();
+        threads = move(m_threads);
+        m_condition.broadcast();
+    }
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    Threading::MutexLocker locker(m_mutex);
+    m_should_exit = false;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Queue.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace ImageDecoder {
+
+// A bounded set of threads that decode images in parallel. High priority jobs (e.g. images that are
+// visible in the viewport) are always picked up before normal priority ones.
+class DecodePool {
+public:
+    enum class Priority : u8 {
+        Normal,
+        High,
+    };
+
+    class Job : public AtomicRefCounted<Job> {
+    public:
+        static NonnullRefPtr<Job> create(Function<void(Job&)> work) { return adopt_ref(*new Job(move(work))); }
+
+        // A canceled job that hasn't started yet is never run. A job that is already running
+        // keeps going, but should check is_canceled() before reporting its result.
+        void cancel() { m_state.store(State::Canceled); }
+        bool is_canceled() const { return m_state.load() == State::Canceled; }
+
+        // How long the job waited in the queue before a thread picked it up.
+        AK::Duration queue_time() const { return m_queue_time; }
+
+    private:
+        friend class DecodePool;
+
+        enum class State : u8 {
+            Queued,
+            Running,
+            Canceled,
+        };
+
+        explicit Job(Function<void(Job&)> work)
+            : m_work(move(work))
+        {
+        }
+
+        Function<void(Job&)> m_work;
+        Atomic<State> m_state { State::Queued };
+        MonotonicTime m_enqueue_time { MonotonicTime::now_coarse() };
+        AK::Duration m_queue_time;
+    };
+
+    static DecodePool& the();
+
+    void enqueue(NonnullRefPtr<Job>, Priority = Priority::Normal);
+
+    // Moves a job that hasn't started yet ahead of all normal priority jobs.
+    void prioritize(Job&);
+
+    // Stops and joins all threads. Jobs that haven't started yet are dropped.
+    void shut_down();
+
+private:
+    friend class AK::NeverDestroyed<DecodePool>;
+
+    DecodePool();
+
+    void spawn_thread_if_needed();
+    intptr_t worker_loop();
+    RefPtr<Job> take_next_job();
+
+    size_t const m_max_thread_count;
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Queue<NonnullRefPtr<Job>> m_high_priority_jobs;
+    Queue<NonnullRefPtr<Job>> m_normal_priority_jobs;
+    Vector<NonnullRefPtr<Threading::Thread>> m_threads;
+    size_t m_idle_thread_count { 0 };
+    bool m_should_exit { false };
+};
+
+}
@@ -11,18 +11,22 @@
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <LibRequests/ResponseBodyRingBuffer.h>
 #include <LibRequests/WebSocket.h>
 #include <LibTLS/TLSv12.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
+#include <RequestServer/TLSSessionCache.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
 #    include <AK/Windows.h>
@@ -32,9 +36,32 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+bool g_use_shared_memory_for_response_bodies { false };
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
+
+// https://www.rfc-editor.org/rfc/rfc8305#section-5
+static long s_connection_attempt_delay_milliseconds = 250L;
+
+// https://httpwg.org/specs/rfc7540.html#StreamPriority
+// NOTE: The dependency tree of RFC 7540 was deprecated by RFC 9113, so we only weigh streams against each other.
+static long http2_stream_weight(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Lowest:
+        return 16;
+    case RequestPriority::Low:
+        return 64;
+    case RequestPriority::Medium:
+        return 128;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Highest:
+        return 256;
+    }
+    VERIFY_NOT_REACHED();
+}
 static struct {
     Optional<Core::SocketAddress> server_address;
     Optional<ByteString> server_hostname;
@@ -86,8 +113,24 @@ ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringVi
 {
     StringBuilder resolve_opt_builder;
     resolve_opt_builder.appendff("{}:{}:", host, port);
+
+    // NOTE: curl races connections to the addresses of both families (https://www.rfc-editor.org/rfc/rfc8305#section-5),
+    //       starting with the family of the first address in the list. We list IPv6 addresses first, since those are
+    //       preferred (https://www.rfc-editor.org/rfc/rfc8305#section-4).
+    auto addresses = dns_result.cached_addresses();
+    Vector<Variant<IPv4Address, IPv6Address>> ordered_addresses;
+    ordered_addresses.ensure_capacity(addresses.size());
+    for (auto& addr : addresses) {
+        if (addr.has<IPv6Address>())
+            ordered_addresses.unchecked_append(addr);
+    }
+    for (auto& addr : addresses) {
+        if (addr.has<IPv4Address>())
+            ordered_addresses.unchecked_append(addr);
+    }
+
     auto first = true;
-    for (auto& addr : dns_result.cached_addresses()) {
+    for (auto& addr : ordered_addresses) {
         auto formatted_address = addr.visit(
             [&](IPv4Address const& ipv4) { return ipv4.to_byte_string(); },
             [&](IPv6Address const& ipv6) { return MUST(ipv6.to_string()).to_byte_string(); });
@@ -100,6 +143,55 @@ ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringVi
     return resolve_opt_builder.to_byte_string();
 }
 
+// OPTIMIZATION: Identical requests whose response may be stored in the disk cache (e.g. the same image loaded by several
+//               tabs at once) only go to the network once. The others wait until that request is done, and are then
+//               served from the disk cache, or go to the network by themselves if nothing was stored after all.
+class InFlightCacheableRequest : public RefCounted<InFlightCacheableRequest> {
+public:
+    static NonnullRefPtr<InFlightCacheableRequest> create(ByteString cache_key)
+    {
+        auto request = adopt_ref(*new InFlightCacheableRequest(move(cache_key)));
+        s_requests.set(request->m_cache_key, request.ptr());
+        return request;
+    }
+
+    static RefPtr<InFlightCacheableRequest> find(ByteString const& cache_key)
+    {
+        return s_requests.get(cache_key).value_or(nullptr);
+    }
+
+    ~InFlightCacheableRequest()
+    {
+        s_requests.remove(m_cache_key);
+
+        // NOTE: The waiters may issue new requests, so they are not started from within whatever is destroying us.
+        if (!m_waiters.is_empty()) {
+            Core::deferred_invoke([waiters = move(m_waiters)] {
+                for (auto const& waiter : waiters)
+                    waiter();
+            });
+        }
+    }
+
+    void wait(Function<void()> waiter)
+    {
+        m_waiters.append(move(waiter));
+    }
+
+private:
+    explicit InFlightCacheableRequest(ByteString cache_key)
+        : m_cache_key(move(cache_key))
+    {
+    }
+
+    static HashMap<ByteString, InFlightCacheableRequest*> s_requests;
+
+    ByteString m_cache_key;
+    Vector<Function<void()>> m_waiters;
+};
+
+HashMap<ByteString, InFlightCacheableRequest*> InFlightCacheableRequest::s_requests;
+
 struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     CURLM* multi { nullptr };
     CURL* easy { nullptr };
@@ -118,16 +210,43 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
 
-    ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
+    // If set, the response body is written to this shared buffer, and writer_fd is only used as a doorbell.
+    Optional<Requests::ResponseBodyRingBuffer> body_ring_buffer;
+    bool client_closed_doorbell { false };
+
+    // State for the disk cache. If the request may use the cache, its key is set.
+    Optional<ByteString> cache_key;
+    HTTP::HeaderMap request_headers;
+    UnixDateTime request_time;
+    UnixDateTime response_time;
+    u32 status_code { 0 };
+    bool is_validating_cached_response { false };
+    bool got_not_modified_response { false };
+    bool should_store_response_in_cache { false };
+    ByteBuffer body_for_cache;
+    RefPtr<InFlightCacheableRequest> in_flight_cacheable_request;
+
+    // When serving a response from the cache, its body is written to the client straight from the mapped file.
+    OwnPtr<Core::MappedFile> cached_body;
+    size_t cached_body_bytes_written { 0 };
+
+    // If this is a critical request, requests of lower priority to this origin are held back until it's done.
+    Optional<String> critical_request_origin;
+
+    ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd, Optional<Requests::ResponseBodyRingBuffer> body_ring_buffer = {})
         : multi(multi)
         , easy(easy)
         , request_id(request_id)
         , client(client)
         , writer_fd(writer_fd)
-        , write_notifier(Core::Notifier::construct(writer_fd, Core::NotificationType::Write))
+        // NOTE: With a shared buffer, we wait for the client to ring the doorbell once it has made room in the buffer.
+        , write_notifier(Core::Notifier::construct(writer_fd, body_ring_buffer.has_value() ? Core::NotificationType::Read : Core::NotificationType::Write))
+        , body_ring_buffer(move(body_ring_buffer))
     {
         write_notifier->set_enabled(false);
         write_notifier->on_activation = [this] {
+            if (this->body_ring_buffer.has_value())
+                drain_doorbell();
             if (auto maybe_error = write_queued_bytes_without_blocking(); maybe_error.is_error()) {
                 dbgln("Warning: Failed to write buffered request data (it's likely the client disappeared): {}", maybe_error.error());
             }
@@ -144,12 +263,63 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         });
     }
 
+    bool has_queued_bytes() const
+    {
+        if (cached_body)
+            return cached_body_bytes_written < cached_body->bytes().size();
+        return !send_buffer.is_eof();
+    }
+
+    void drain_doorbell()
+    {
+        u8 buffer[64];
+        while (true) {
+            auto result = Core::System::read(this->writer_fd, { buffer, sizeof(buffer) });
+            if (result.is_error() && result.error().code() == EINTR)
+                continue;
+            if (result.is_error() && result.error().code() == EAGAIN)
+                return;
+            if (result.is_error() || result.value() == 0) {
+                client_closed_doorbell = true;
+                write_notifier->set_enabled(false);
+                return;
+            }
+        }
+    }
+
+    ErrorOr<size_t> write_to_client(ReadonlyBytes bytes)
+    {
+        if (!body_ring_buffer.has_value())
+            return Core::System::write(this->writer_fd, bytes);
+
+        if (client_closed_doorbell)
+            return Error::from_errno(EPIPE);
+
+        auto written = body_ring_buffer->write(bytes);
+        if (written == 0 && !bytes.is_empty())
+            return Error::from_errno(EAGAIN);
+
+        if (body_ring_buffer->should_ring_consumer()) {
+            u8 doorbell = 0;
+            auto result = Core::System::write(this->writer_fd, { &doorbell, 1 });
+
+            // NOTE: If the socket is full, the client has plenty of unread rings already.
+            if (result.is_error() && result.error().code() != EAGAIN)
+                return result.release_error();
+        }
+
+        return written;
+    }
+
     ErrorOr<void> write_queued_bytes_without_blocking()
     {
+        if (cached_body)
+            return write_cached_body_without_blocking();
+
         Vector<u8> bytes_to_send;
         bytes_to_send.resize(send_buffer.used_buffer_size());
         send_buffer.peek_some(bytes_to_send);
-        auto result = Core::System::write(this->writer_fd, bytes_to_send);
+        auto result = write_to_client(bytes_to_send);
         if (result.is_error()) {
             if (result.error().code() != EAGAIN) {
                 return result.release_error();
@@ -166,25 +336,60 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         return {};
     }
 
+    ErrorOr<void> write_cached_body_without_blocking()
+    {
+        auto result = write_to_client(cached_body->bytes().slice(cached_body_bytes_written));
+        if (result.is_error()) {
+            if (result.error().code() != EAGAIN) {
+                return result.release_error();
+            }
+            write_notifier->set_enabled(true);
+            return {};
+        }
+
+        cached_body_bytes_written += result.value();
+        write_notifier->set_enabled(has_queued_bytes());
+        if (!has_queued_bytes() && done_fetching)
+            schedule_self_destruction();
+
+        return {};
+    }
+
     void notify_about_fetching_completion()
     {
         done_fetching = true;
-        if (send_buffer.is_eof())
+        if (!has_queued_bytes())
             schedule_self_destruction();
     }
 
+    void send_cached_response(DiskCache::Entry const& entry, NonnullOwnPtr<Core::MappedFile> body)
+    {
+        got_all_headers = true;
+        client->async_headers_became_available(request_id, entry.headers, entry.status_code, entry.reason_phrase);
+
+        cached_body = move(body);
+        if (auto maybe_error = write_queued_bytes_without_blocking(); maybe_error.is_error())
+            dbgln("Warning: Failed to write cached response data (it's likely the client disappeared): {}", maybe_error.error());
+
+        client->async_request_finished(request_id, entry.body_size, {}, {});
+        notify_about_fetching_completion();
+    }
+
     ~ActiveRequest()
     {
-        if (!send_buffer.is_eof()) {
+        if (has_queued_bytes()) {
             dbgln("Warning: Request destroyed with buffered data (it's likely that the client disappeared or the request was cancelled)");
         }
 
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
-        curl_easy_cleanup(easy);
+        // NOTE: Responses served from the disk cache don't have a curl handle.
+        if (easy) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            curl_easy_cleanup(easy);
+        }
 
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
@@ -198,6 +403,21 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
+
+        if (cache_key.has_value()) {
+            status_code = static_cast<u32>(http_status_code);
+            response_time = UnixDateTime::now();
+
+            // NOTE: If the server confirmed that our stored response is still valid, the client gets the stored
+            //       response instead once the request completes.
+            if (is_validating_cached_response && status_code == 304) {
+                got_not_modified_response = true;
+                return;
+            }
+
+            should_store_response_in_cache = DiskCache::is_response_storable(request_headers, status_code, headers);
+        }
+
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
     }
 };
@@ -242,8 +462,25 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
+    if (request->got_not_modified_response)
+        return total_size;
+
     auto maybe_write_error = [&] -> ErrorOr<void> {
-        TRY(request->send_buffer.write_some(bytes));
+        auto bytes_to_queue = bytes;
+
+        // OPTIMIZATION: If nothing is queued up, hand the data to the client right away instead of copying it into
+        //               the send buffer first.
+        if (!request->has_queued_bytes()) {
+            auto result = request->write_to_client(bytes);
+            if (result.is_error() && result.error().code() != EAGAIN)
+                return result.release_error();
+            if (!result.is_error())
+                bytes_to_queue = bytes.slice(result.value());
+            if (bytes_to_queue.is_empty())
+                return {};
+        }
+
+        TRY(request->send_buffer.write_some(bytes_to_queue));
         return request->write_queued_bytes_without_blocking();
     }();
 
@@ -253,6 +490,16 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     }
 
     request->downloaded_so_far += total_size;
+
+    if (request->should_store_response_in_cache) {
+        if (auto const* disk_cache = DiskCache::the(); disk_cache && request->body_for_cache.size() + total_size <= disk_cache->max_body_size()) {
+            request->body_for_cache.append(bytes);
+        } else {
+            request->should_store_response_in_cache = false;
+            request->body_for_cache.clear();
+        }
+    }
+
     return total_size;
 }
 
@@ -335,6 +582,10 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
         VERIFY(result == CURLM_OK);
         check_active_requests();
     });
+
+    m_held_requests_timer = Core::Timer::create_single_shot(static_cast<int>(max_request_hold_time.to_milliseconds()), [this] {
+        start_held_requests_that_waited_too_long();
+    });
 }
 
 ConnectionFromClient::~ConnectionFromClient()
@@ -429,48 +680,271 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ByteString>, RequestPriority)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+ErrorOr<NonnullOwnPtr<ConnectionFromClient::ActiveRequest>> ConnectionFromClient::create_active_request(i32 request_id, void* easy)
+{
+    // OPTIMIZATION: Response bodies can be handed to the client through shared memory instead of a pipe. This saves
+    //               the client from copying every chunk out of the kernel, and us from an extra syscall per chunk.
+    if (g_use_shared_memory_for_response_bodies) {
+        auto body_ring_buffer = TRY(Requests::ResponseBodyRingBuffer::create());
+
+        int fds[2];
+        TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+        for (auto fd : fds) {
+            TRY(Core::System::fcntl(fd, F_SETFD, FD_CLOEXEC));
+            TRY(Core::System::fcntl(fd, F_SETFL, O_NONBLOCK));
+        }
+
+        async_request_started(request_id, IPC::File::adopt_fd(fds[0]), body_ring_buffer.anonymous_buffer());
+        return make<ActiveRequest>(*this, m_curl_multi, easy, request_id, fds[1], move(body_ring_buffer));
+    }
+
+    auto fds = TRY(Core::System::pipe2(O_NONBLOCK));
+    async_request_started(request_id, IPC::File::adopt_fd(fds[0]), {});
+    return make<ActiveRequest>(*this, m_curl_multi, easy, request_id, fds[1]);
+}
+
+bool ConnectionFromClient::serve_request_from_disk_cache(i32 request_id, ByteString const& cache_key)
 {
+    auto* disk_cache = DiskCache::the();
+    auto const* entry = disk_cache->find(cache_key);
+    VERIFY(entry);
+
+    auto body = disk_cache->map_body(*entry);
+    if (body.is_error()) {
+        dbgln("StartRequest: Unable to read cached response body: {}", body.error());
+        disk_cache->remove(cache_key);
+        return false;
+    }
+
+    auto request_or_error = create_active_request(request_id, nullptr);
+    if (request_or_error.is_error()) {
+        dbgln("StartRequest: Failed to set up response body transport: {}", request_or_error.error());
+        return false;
+    }
+
+    auto request = request_or_error.release_value();
+    request->send_cached_response(*entry, body.release_value());
+    m_active_requests.set(request_id, move(request));
+
+    if (auto* har_entry = har_entry_for_request(request_id)) {
+        har_entry->status_code = entry->status_code;
+        har_entry->reason_phrase = entry->reason_phrase;
+        har_entry->response_headers = entry->headers;
+        har_entry->body_size = entry->body_size;
+        har_entry->served_from_disk_cache = true;
+        record_har_entry(request_id);
+    }
+    return true;
+}
+
+HARRecorder::Entry* ConnectionFromClient::har_entry_for_request(i32 request_id)
+{
+    auto it = m_har_entries.find(request_id);
+    if (it == m_har_entries.end())
+        return nullptr;
+    return &it->value;
+}
+
+void ConnectionFromClient::record_har_entry(i32 request_id)
+{
+    if (auto entry = m_har_entries.take(request_id); entry.has_value())
+        HARRecorder::the()->record(*entry);
+}
+
+bool ConnectionFromClient::should_hold_back_request(String const& origin, RequestPriority priority) const
+{
+    if (priority >= RequestPriority::Medium)
+        return false;
+    return m_critical_requests_in_flight.contains(origin);
+}
+
+void ConnectionFromClient::did_finish_critical_request(Optional<String> origin)
+{
+    if (!origin.has_value())
+        return;
+
+    auto it = m_critical_requests_in_flight.find(*origin);
+    if (it == m_critical_requests_in_flight.end())
+        return;
+    if (--it->value != 0)
+        return;
+
+    m_critical_requests_in_flight.remove(it);
+    start_held_requests([&](auto const& held_request) { return held_request.origin == *origin; });
+}
+
+void ConnectionFromClient::start_held_requests(Function<bool(HeldRequest const&)> const& should_start)
+{
+    Vector<HeldRequest> requests_to_start;
+    m_held_requests.remove_all_matching([&](auto& held_request) {
+        if (!should_start(held_request))
+            return false;
+        requests_to_start.append(move(held_request));
+        return true;
+    });
+
+    for (auto& held_request : requests_to_start)
+        held_request.start();
+}
+
+void ConnectionFromClient::start_held_requests_that_waited_too_long()
+{
+    auto now = MonotonicTime::now();
+    start_held_requests([&](auto const& held_request) { return now - held_request.held_since >= max_request_hold_time; });
+
+    if (!m_held_requests.is_empty()) {
+        auto remaining_hold_time = max_request_hold_time - (now - m_held_requests.first().held_since);
+        m_held_requests_timer->start(static_cast<int>(max(remaining_hold_time.to_milliseconds(), 1)));
+    }
+}
+
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<ByteString> cache_partition, RequestPriority priority)
+{
+    if (HARRecorder::the()) {
+        m_har_entries.set(request_id,
+            HARRecorder::Entry {
+                .started_date_time = UnixDateTime::now(),
+                .started = MonotonicTime::now(),
+                .method = method,
+                .url = url.to_string(),
+                .request_headers = request_headers,
+                .request_body_size = request_body.size(),
+            });
+    }
+
+    // OPTIMIZATION: While critical resources (e.g. render-blocking style sheets) from an origin are loading, requests
+    //               for less important ones (e.g. images) from that origin wait, so that they don't compete for the
+    //               same connection and bandwidth.
+    if (auto origin = url.origin().serialize(); should_hold_back_request(origin, priority)) {
+        m_held_requests.append({
+            .request_id = request_id,
+            .origin = move(origin),
+            .held_since = MonotonicTime::now(),
+            .start = [this, request_id, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data = move(proxy_data), cache_partition = move(cache_partition), priority]() mutable {
+                issue_request(request_id, move(method), move(url), move(request_headers), move(request_body), move(proxy_data), move(cache_partition), priority);
+            },
+        });
+
+        if (!m_held_requests_timer->is_active())
+            m_held_requests_timer->start(static_cast<int>(max_request_hold_time.to_milliseconds()));
+        return;
+    }
+
+    issue_request(request_id, move(method), move(url), move(request_headers), move(request_body), move(proxy_data), move(cache_partition), priority);
+}
+
+void ConnectionFromClient::issue_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<ByteString> cache_partition, RequestPriority priority, WaitForIdenticalRequest wait_for_identical_request)
+{
+    if (auto* har_entry = har_entry_for_request(request_id))
+        har_entry->issued = MonotonicTime::now();
+
+    // OPTIMIZATION: Fresh responses stored in the disk cache are served without a DNS lookup or a network request.
+    //               Stale responses with validators are validated with a conditional request instead.
+    Optional<ByteString> cache_key;
+    bool is_validating_cached_response = false;
+    if (auto* disk_cache = DiskCache::the(); disk_cache && cache_partition.has_value() && DiskCache::can_use_cache_for_request(method, request_headers)) {
+        cache_key = DiskCache::cache_key(*cache_partition, url);
+
+        if (auto const* entry = disk_cache->find(*cache_key)) {
+            if (disk_cache->can_serve_without_validation(*entry, request_headers) && serve_request_from_disk_cache(request_id, *cache_key))
+                return;
+
+            // https://httpwg.org/specs/rfc9111.html#validation.sent
+            if (entry = disk_cache->find(*cache_key); entry && DiskCache::has_validators(*entry)) {
+                if (auto etag = entry->headers.get("ETag"sv); etag.has_value())
+                    request_headers.set("If-None-Match"sv, *etag);
+                if (auto last_modified = entry->headers.get("Last-Modified"sv); last_modified.has_value())
+                    request_headers.set("If-Modified-Since"sv, *last_modified);
+                is_validating_cached_response = true;
+            }
+        }
+    }
+
+    RefPtr<InFlightCacheableRequest> in_flight_cacheable_request;
+    if (cache_key.has_value()) {
+        if (auto identical_request = InFlightCacheableRequest::find(*cache_key)) {
+            if (wait_for_identical_request == WaitForIdenticalRequest::Yes) {
+                m_requests_waiting_for_identical_request.set(request_id);
+                identical_request->wait([weak_this = make_weak_ptr<ConnectionFromClient>(), request_id, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data = move(proxy_data), cache_partition = move(cache_partition), priority]() mutable {
+                    // NOTE: The request may have been stopped while it was waiting.
+                    if (!weak_this || !weak_this->m_requests_waiting_for_identical_request.remove(request_id))
+                        return;
+                    weak_this->issue_request(request_id, move(method), move(url), move(request_headers), move(request_body), move(proxy_data), move(cache_partition), priority, WaitForIdenticalRequest::No);
+                });
+                return;
+            }
+        } else {
+            in_flight_cacheable_request = InFlightCacheableRequest::create(*cache_key);
+        }
+    }
+
+    Optional<String> critical_request_origin;
+    if (is_critical_request_priority(priority)) {
+        critical_request_origin = url.origin().serialize();
+        ++m_critical_requests_in_flight.ensure(*critical_request_origin, [] { return 0; });
+    }
+
     auto host = url.serialized_host().to_byte_string();
 
-    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
-        ->when_rejected([this, request_id](auto const& error) {
+    if (auto* har_entry = har_entry_for_request(request_id))
+        har_entry->domain_lookup_start = MonotonicTime::now();
+
+    m_resolver->dns.lookup_addresses(host, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
+        ->when_rejected([this, request_id, critical_request_origin](auto const& error) {
             dbgln("StartRequest: DNS lookup failed: {}", error);
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+            did_finish_critical_request(critical_request_origin);
+
+            if (auto* har_entry = har_entry_for_request(request_id)) {
+                har_entry->domain_lookup_end = MonotonicTime::now();
+                har_entry->network_error = Requests::NetworkError::UnableToResolveHost;
+                record_har_entry(request_id);
+            }
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, cache_key = move(cache_key), is_validating_cached_response, priority, critical_request_origin, in_flight_cacheable_request = move(in_flight_cacheable_request)](auto const& dns_result) mutable {
+            auto* har_entry = har_entry_for_request(request_id);
+            if (har_entry)
+                har_entry->domain_lookup_end = MonotonicTime::now();
+
             if (dns_result->records().is_empty() || dns_result->cached_addresses().is_empty()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
                 async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+                did_finish_critical_request(move(critical_request_origin));
+
+                if (har_entry) {
+                    har_entry->network_error = Requests::NetworkError::UnableToResolveHost;
+                    record_har_entry(request_id);
+                }
                 return;
             }
 
             auto* easy = curl_easy_init();
             if (!easy) {
                 dbgln("StartRequest: Failed to initialize curl easy handle");
+                did_finish_critical_request(move(critical_request_origin));
                 return;
             }
 
-            auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
-            if (fds_or_error.is_error()) {
-                dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+            auto request_or_error = create_active_request(request_id, easy);
+            if (request_or_error.is_error()) {
+                dbgln("StartRequest: Failed to set up response body transport: {}", request_or_error.error());
+                curl_easy_cleanup(easy);
+                did_finish_critical_request(move(critical_request_origin));
                 return;
             }
 
-            auto fds = fds_or_error.release_value();
-            auto writer_fd = fds[1];
-            auto reader_fd = fds[0];
-            async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
-
-            auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
+            auto request = request_or_error.release_value();
             request->url = url.to_string();
+            request->request_time = UnixDateTime::now();
+            request->critical_request_origin = move(critical_request_origin);
+            request->in_flight_cacheable_request = move(in_flight_cacheable_request);
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -490,9 +964,20 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             set_option(CURLOPT_URL, url.to_string().to_byte_string().characters());
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
+            set_option(CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS, s_connection_attempt_delay_milliseconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, http2_stream_weight(priority));
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
+            if (auto* tls_session_cache = TLSSessionCache::the())
+                tls_session_cache->use_for_easy_handle(easy);
+
+            // OPTIMIZATION: When resuming a TLS 1.3 session, send the request as early data, saving a round trip. Early
+            //               data can be replayed by an attacker, so we only do this for methods that are safe to repeat.
+            // https://www.rfc-editor.org/rfc/rfc8470#section-4
+            if (method.is_one_of("GET"sv, "HEAD"sv))
+                set_option(CURLOPT_SSL_OPTIONS, static_cast<long>(CURLSSLOPT_EARLYDATA));
+
             bool did_set_body = false;
 
             if (method == "GET"sv) {
@@ -538,6 +1023,12 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 request->curl_string_lists.append(curl_headers);
             }
 
+            if (cache_key.has_value()) {
+                request->cache_key = move(cache_key);
+                request->request_headers = move(request_headers);
+                request->is_validating_cached_response = is_validating_cached_response;
+            }
+
             // FIXME: Set up proxy if applicable
             (void)proxy_data;
 
@@ -619,6 +1110,7 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
     auto response_start_time = get_timing_info(CURLINFO_STARTTRANSFER_TIME_T);
     auto response_end_time = get_timing_info(CURLINFO_TOTAL_TIME_T);
     auto encoded_body_size = get_timing_info(CURLINFO_SIZE_DOWNLOAD_T);
+    auto early_data_sent_bytes = get_timing_info(CURLINFO_EARLYDATA_SENT_T);
 
     long http_version = 0;
     auto get_version_result = curl_easy_getinfo(easy_handle, CURLINFO_HTTP_VERSION, &http_version);
@@ -654,7 +1146,52 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
         .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
         .encoded_body_size = encoded_body_size,
         .http_version_alpn_identifier = http_version_alpn,
+        .early_data_sent_bytes = early_data_sent_bytes,
+    };
+}
+
+// https://w3c.github.io/web-performance/specs/HAR/Overview.html#sec-object-types-timings
+static void fill_har_entry_from_curl_easy_handle(HARRecorder::Entry& entry, CURL* easy_handle)
+{
+    // NOTE: Unlike the phases of a HAR entry, curl measures all of these from the start of the transfer.
+    auto get_time = [easy_handle](auto option) {
+        curl_off_t time_value = 0;
+        auto result = curl_easy_getinfo(easy_handle, option, &time_value);
+        VERIFY(result == CURLE_OK);
+        return AK::Duration::from_microseconds(time_value);
+    };
+
+    auto queue_time = get_time(CURLINFO_QUEUE_TIME_T);
+    auto name_lookup_time = max(get_time(CURLINFO_NAMELOOKUP_TIME_T), queue_time);
+    auto connect_time = get_time(CURLINFO_CONNECT_TIME_T);
+    auto secure_connect_time = get_time(CURLINFO_APPCONNECT_TIME_T);
+    auto request_start_time = get_time(CURLINFO_PRETRANSFER_TIME_T);
+    auto response_start_time = get_time(CURLINFO_STARTTRANSFER_TIME_T);
+    auto response_end_time = get_time(CURLINFO_TOTAL_TIME_T);
+
+    auto time_between = [](AK::Duration start, AK::Duration end) {
+        return max(end - start, AK::Duration::zero());
     };
+
+    entry.queued = queue_time;
+
+    // NOTE: The connect and TLS handshake times are zero if an existing connection was reused.
+    auto connected_time = name_lookup_time;
+    if (connect_time > name_lookup_time) {
+        connected_time = max(connect_time, secure_connect_time);
+        entry.connect = time_between(name_lookup_time, connected_time);
+    }
+    if (secure_connect_time > connect_time && !connect_time.is_zero())
+        entry.ssl = time_between(connect_time, secure_connect_time);
+
+    entry.send = time_between(connected_time, request_start_time);
+    entry.wait = time_between(request_start_time, response_start_time);
+    entry.receive = time_between(response_start_time, response_end_time);
+
+    long http_status_code = 0;
+    auto result = curl_easy_getinfo(easy_handle, CURLINFO_RESPONSE_CODE, &http_status_code);
+    VERIFY(result == CURLE_OK);
+    entry.status_code = static_cast<u32>(http_status_code);
 }
 
 void ConnectionFromClient::check_active_requests()
@@ -707,7 +1244,49 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            if (auto* har_entry = har_entry_for_request(request->request_id)) {
+                fill_har_entry_from_curl_easy_handle(*har_entry, msg->easy_handle);
+                har_entry->reason_phrase = request->reason_phrase;
+                har_entry->response_headers = request->headers;
+                har_entry->http_version = timing_info.http_version_alpn_identifier;
+                har_entry->body_size = request->downloaded_so_far;
+                har_entry->validated_with_server = request->is_validating_cached_response;
+                har_entry->network_error = network_error;
+                record_har_entry(request->request_id);
+            }
+
+            // NOTE: Identical requests waiting for this one may be served from the disk cache once we're done with it.
+            auto in_flight_cacheable_request = move(request->in_flight_cacheable_request);
+
+            if (auto* disk_cache = DiskCache::the(); disk_cache && request->cache_key.has_value()) {
+                if (request->got_not_modified_response && request_was_successful) {
+                    // https://httpwg.org/specs/rfc9111.html#validation.response
+                    // A 304 (Not Modified) response status code indicates that the stored response can be updated and reused.
+                    disk_cache->freshen(*request->cache_key, request->headers, request->request_time, request->response_time);
+                    if (auto const* entry = disk_cache->find(*request->cache_key)) {
+                        if (auto body = disk_cache->map_body(*entry); !body.is_error()) {
+                            request->send_cached_response(*entry, body.release_value());
+                            did_finish_critical_request(exchange(request->critical_request_origin, {}));
+                            continue;
+                        }
+                        disk_cache->remove(*request->cache_key);
+                    }
+
+                    // NOTE: If our stored response disappeared in the meantime, all we can do is forward the 304.
+                    request->got_not_modified_response = false;
+                    request->should_store_response_in_cache = false;
+                    request->client->async_headers_became_available(request->request_id, request->headers, request->status_code, request->reason_phrase);
+                } else if (request->should_store_response_in_cache && request_was_successful) {
+                    disk_cache->store(*request->cache_key, request->status_code, request->reason_phrase, request->headers, request->request_time, request->response_time, request->body_for_cache);
+                    request->body_for_cache.clear();
+                } else if (request->status_code != 0 && !request->got_not_modified_response) {
+                    // NOTE: Any response we can't store replaces the one we may have stored before.
+                    disk_cache->remove(*request->cache_key);
+                }
+            }
+
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
+            did_finish_critical_request(exchange(request->critical_request_origin, {}));
         }
 
         request->notify_about_fetching_completion();
@@ -716,12 +1295,21 @@ void ConnectionFromClient::check_active_requests()
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
+    m_har_entries.remove(request_id);
+
+    // NOTE: Held requests have not been issued yet, so there is nothing else to clean up.
+    if (m_held_requests.remove_first_matching([&](auto const& held_request) { return held_request.request_id == request_id; }))
+        return true;
+    if (m_requests_waiting_for_identical_request.remove(request_id))
+        return true;
+
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
         dbgln("StopRequest: Request ID {} not found", request_id);
         return false;
     }
 
+    did_finish_critical_request(exchange(request.value()->critical_request_origin, {}));
     return true;
 }
 
@@ -738,43 +1326,65 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     auto const url_string_value = url.to_string();
 
     if (cache_level == CacheLevel::CreateConnection) {
-        auto* easy = curl_easy_init();
-        if (!easy) {
-            dbgln("EnsureConnection: Failed to initialize curl easy handle");
-            return;
-        }
-
-        auto set_option = [easy](auto option, auto value) {
-            auto result = curl_easy_setopt(easy, option, value);
-            if (result != CURLE_OK) {
-                dbgln("EnsureConnection: Failed to set curl option: {}", curl_easy_strerror(result));
-                return false;
-            }
-            return true;
-        };
-
-        auto connect_only_request_id = get_random<i32>();
-
-        auto request = make<ActiveRequest>(*this, m_curl_multi, easy, connect_only_request_id, 0);
-        request->url = url_string_value;
-        request->is_connect_only = true;
+        // NOTE: We resolve the host ourselves rather than letting curl do it, so that the addresses end up in our DNS cache
+        //       for the request that's going to follow.
+        auto host = url.serialized_host().to_byte_string();
+        m_resolver->dns.lookup_addresses(host, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
+            ->when_rejected([url](auto const& error) {
+                dbgln_if(REQUESTSERVER_DEBUG, "EnsureConnection: DNS lookup for {} failed: {}", url, error);
+            })
+            .when_resolved([this, host = move(host), url = move(url), url_string_value](auto const& dns_result) {
+                if (dns_result->cached_addresses().is_empty())
+                    return;
+
+                auto* easy = curl_easy_init();
+                if (!easy) {
+                    dbgln("EnsureConnection: Failed to initialize curl easy handle");
+                    return;
+                }
 
-        set_option(CURLOPT_PRIVATE, request.ptr());
-        set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
-        set_option(CURLOPT_PORT, url.port_or_default());
-        set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
-        set_option(CURLOPT_CONNECT_ONLY, 1L);
+                auto set_option = [easy](auto option, auto value) {
+                    auto result = curl_easy_setopt(easy, option, value);
+                    if (result != CURLE_OK) {
+                        dbgln("EnsureConnection: Failed to set curl option: {}", curl_easy_strerror(result));
+                        return false;
+                    }
+                    return true;
+                };
+
+                auto connect_only_request_id = get_random<i32>();
+
+                auto request = make<ActiveRequest>(*this, m_curl_multi, easy, connect_only_request_id, 0);
+                request->url = url_string_value;
+                request->is_connect_only = true;
+
+                set_option(CURLOPT_PRIVATE, request.ptr());
+                set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
+                set_option(CURLOPT_PORT, url.port_or_default());
+                set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
+                set_option(CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS, s_connection_attempt_delay_milliseconds);
+                set_option(CURLOPT_CONNECT_ONLY, 1L);
+
+                if (auto* tls_session_cache = TLSSessionCache::the())
+                    tls_session_cache->use_for_easy_handle(easy);
+
+                auto formatted_address = build_curl_resolve_list(*dns_result, host, url.port_or_default());
+                if (curl_slist* resolve_list = curl_slist_append(nullptr, formatted_address.characters())) {
+                    set_option(CURLOPT_RESOLVE, resolve_list);
+                    request->curl_string_lists.append(resolve_list);
+                }
 
-        auto const result = curl_multi_add_handle(m_curl_multi, easy);
-        VERIFY(result == CURLM_OK);
+                auto const result = curl_multi_add_handle(m_curl_multi, easy);
+                VERIFY(result == CURLM_OK);
 
-        m_active_requests.set(connect_only_request_id, move(request));
+                m_active_requests.set(connect_only_request_id, move(request));
+            });
 
         return;
     }
 
     if (cache_level == CacheLevel::ResolveOnly) {
-        [[maybe_unused]] auto promise = m_resolver->dns.lookup(url.serialized_host().to_byte_string(), DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally });
+        [[maybe_unused]] auto promise = m_resolver->dns.lookup_addresses(url.serialized_host().to_byte_string(), { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally });
         if constexpr (REQUESTSERVER_DEBUG) {
             Core::ElapsedTimer timer;
             timer.start();
@@ -791,7 +1401,7 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
 {
     auto host = url.serialized_host().to_byte_string();
 
-    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })
+    m_resolver->dns.lookup_addresses(host)
         ->when_rejected([this, websocket_id](auto const& error) {
             dbgln("WebSocketConnect: DNS lookup failed: {}", error);
             async_websocket_errored(websocket_id, static_cast<i32>(Requests::WebSocket::Error::CouldNotEstablishConnection));
@@ -820,15 +1430,18 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
                 async_websocket_connected(websocket_id);
             };
             connection->on_message = [this, websocket_id](auto message) {
-                async_websocket_received(websocket_id, message.is_text(), message.data());
+                queue_websocket_message(websocket_id, move(message));
             };
             connection->on_error = [this, websocket_id](auto message) {
+                deliver_queued_websocket_messages(websocket_id);
                 async_websocket_errored(websocket_id, (i32)message);
             };
             connection->on_close = [this, websocket_id](u16 code, ByteString reason, bool was_clean) {
+                deliver_queued_websocket_messages(websocket_id);
                 async_websocket_closed(websocket_id, code, move(reason), was_clean);
             };
             connection->on_ready_state_change = [this, websocket_id](auto state) {
+                deliver_queued_websocket_messages(websocket_id);
                 async_websocket_ready_state_changed(websocket_id, (u32)state);
             };
 
@@ -837,6 +1450,36 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
         });
 }
 
+void ConnectionFromClient::queue_websocket_message(i64 websocket_id, WebSocket::Message message)
+{
+    // OPTIMIZATION: A single read from the socket often yields many small messages. Rather than sending each of them to
+    //               the client on its own, we deliver all messages received during this event loop iteration at once.
+    auto is_text = message.is_text();
+    m_queued_websocket_messages.ensure(websocket_id).append({ .data = message.release_data(), .is_text = is_text });
+
+    if (m_has_scheduled_websocket_message_delivery)
+        return;
+    m_has_scheduled_websocket_message_delivery = true;
+
+    Core::deferred_invoke([weak_this = make_weak_ptr<ConnectionFromClient>()] {
+        if (!weak_this)
+            return;
+
+        weak_this->m_has_scheduled_websocket_message_delivery = false;
+
+        auto queued_websocket_messages = move(weak_this->m_queued_websocket_messages);
+        for (auto& [websocket_id, messages] : queued_websocket_messages)
+            weak_this->async_websocket_received(websocket_id, move(messages));
+    });
+}
+
+void ConnectionFromClient::deliver_queued_websocket_messages(i64 websocket_id)
+{
+    // NOTE: Messages must be delivered before any other events that happened after they were received.
+    if (auto messages = m_queued_websocket_messages.take(websocket_id); messages.has_value())
+        async_websocket_received(websocket_id, messages.release_value());
+}
+
 void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, ByteBuffer data)
 {
     if (auto connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
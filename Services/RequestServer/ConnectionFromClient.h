@@ -7,10 +7,14 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/HARRecorder.h>
 #include <RequestServer/RequestClientEndpoint.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
 namespace RequestServer {
@@ -42,7 +46,7 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ByteString> cache_partition, RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
@@ -54,6 +58,12 @@ private:
 
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
+    void queue_websocket_message(i64 websocket_id, WebSocket::Message);
+    void deliver_queued_websocket_messages(i64 websocket_id);
+
+    HashMap<i64, Vector<Requests::WebSocket::Message>> m_queued_websocket_messages;
+    bool m_has_scheduled_websocket_message_delivery { false };
+
     struct ActiveRequest;
     friend struct ActiveRequest;
 
@@ -64,7 +74,43 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
+    // Requests are held back while critical requests to the same origin are in flight, but never for longer than this.
+    static constexpr AK::Duration max_request_hold_time = AK::Duration::from_milliseconds(500);
+
+    struct HeldRequest {
+        i32 request_id { 0 };
+        String origin;
+        MonotonicTime held_since;
+        Function<void()> start;
+    };
+    Vector<HeldRequest> m_held_requests;
+    RefPtr<Core::Timer> m_held_requests_timer;
+    HashMap<String, size_t> m_critical_requests_in_flight;
+
+    bool should_hold_back_request(String const& origin, RequestPriority) const;
+    void did_finish_critical_request(Optional<String> origin);
+    void start_held_requests(Function<bool(HeldRequest const&)> const& should_start);
+    void start_held_requests_that_waited_too_long();
+
+    // Requests that wait for an identical request to finish, so that they can be served from the disk cache.
+    HashTable<i32> m_requests_waiting_for_identical_request;
+
+    enum class WaitForIdenticalRequest {
+        No,
+        Yes,
+    };
+
     void check_active_requests();
+    void issue_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ByteString> cache_partition, RequestPriority, WaitForIdenticalRequest = WaitForIdenticalRequest::Yes);
+    ErrorOr<NonnullOwnPtr<ActiveRequest>> create_active_request(i32 request_id, void* easy);
+    bool serve_request_from_disk_cache(i32 request_id, ByteString const& cache_key);
+
+    // The requests in flight while the HAR recorder is recording, along with what was recorded about them so far.
+    HashMap<i32, HARRecorder::Entry> m_har_entries;
+
+    HARRecorder::Entry* har_entry_for_request(i32 request_id);
+    void record_har_entry(i32 request_id);
+
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
@@ -0,0 +1,574 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/GenericShorthands.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/Utf8View.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibURL/URL.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr i64 index_version = 1;
+static constexpr int index_write_delay_ms = 1000;
+
+static OwnPtr<DiskCache> s_disk_cache;
+
+void DiskCache::initialize(LexicalPath directory, u64 size_limit)
+{
+    if (auto result = Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes); result.is_error()) {
+        dbgln("DiskCache: Unable to create cache directory '{}': {}", directory, result.error());
+        return;
+    }
+
+    s_disk_cache = adopt_own(*new DiskCache(move(directory), size_limit));
+}
+
+void DiskCache::shutdown()
+{
+    s_disk_cache = nullptr;
+}
+
+DiskCache* DiskCache::the()
+{
+    return s_disk_cache.ptr();
+}
+
+DiskCache::DiskCache(LexicalPath directory, u64 size_limit)
+    : m_directory(move(directory))
+    , m_size_limit(size_limit)
+{
+    m_index_write_timer = Core::Timer::create_single_shot(index_write_delay_ms, [this] {
+        if (auto result = write_index(); result.is_error())
+            dbgln("DiskCache: Unable to write index: {}", result.error());
+    });
+
+    if (auto result = read_index(); result.is_error()) {
+        dbgln("DiskCache: Unable to read index, starting with an empty cache: {}", result.error());
+        m_entries.clear();
+        m_total_size = 0;
+    }
+
+    // NOTE: Remove bodies that the index doesn't know about, e.g. because we were terminated before the index was written.
+    HashTable<u64> known_body_ids;
+    for (auto const& it : m_entries)
+        known_body_ids.set(it.value.body_id);
+
+    (void)Core::Directory::for_each_entry(m_directory.string(), Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        auto name = entry.name.view();
+        if (!name.ends_with(".body"sv))
+            return IterationDecision::Continue;
+        auto body_id = name.substring_view(0, name.length() - 5).template to_number<u64>();
+        if (!body_id.has_value() || !known_body_ids.contains(*body_id))
+            (void)Core::System::unlink(m_directory.append(name).string());
+        return IterationDecision::Continue;
+    });
+}
+
+DiskCache::~DiskCache()
+{
+    if (m_index_write_timer->is_active())
+        (void)write_index();
+}
+
+LexicalPath DiskCache::body_path(u64 body_id) const
+{
+    return m_directory.append(ByteString::formatted("{}.body", body_id));
+}
+
+LexicalPath DiskCache::index_path() const
+{
+    return m_directory.append("index.json"sv);
+}
+
+ByteString DiskCache::cache_key(StringView partition, URL::URL const& url)
+{
+    // https://httpwg.org/specs/rfc9111.html#constructing.responses.from.caches
+    // NOTE: Fragments are never sent to the server, so they are not part of the target URI.
+    return ByteString::formatted("{} {}", partition, url.serialize(URL::ExcludeFragment::Yes));
+}
+
+struct CacheControl {
+    bool no_cache { false };
+    bool no_store { false };
+    Optional<i64> max_age;
+};
+
+// https://httpwg.org/specs/rfc9111.html#field.cache-control
+static CacheControl parse_cache_control(HTTP::HeaderMap const& headers)
+{
+    CacheControl cache_control;
+
+    auto value = headers.get("Cache-Control"sv);
+    if (!value.has_value()) {
+        // https://httpwg.org/specs/rfc9111.html#field.pragma
+        // When the Cache-Control header field is not present in a request, caches MUST consider the no-cache request
+        // pragma directive as having the same effect as if "Cache-Control: no-cache" were present.
+        if (auto pragma = headers.get("Pragma"sv); pragma.has_value() && pragma->contains("no-cache"sv, CaseSensitivity::CaseInsensitive))
+            cache_control.no_cache = true;
+        return cache_control;
+    }
+
+    for (auto directive : value->split_view(',')) {
+        directive = directive.trim_whitespace();
+
+        if (directive.equals_ignoring_ascii_case("no-cache"sv) || directive.starts_with("no-cache="sv, CaseSensitivity::CaseInsensitive)) {
+            cache_control.no_cache = true;
+        } else if (directive.equals_ignoring_ascii_case("no-store"sv)) {
+            cache_control.no_store = true;
+        } else if (directive.starts_with("max-age="sv, CaseSensitivity::CaseInsensitive)) {
+            auto seconds = directive.substring_view(8).trim("\""sv).to_number<i64>();
+            // If a cache receives a max-age directive with an invalid value, it treats the response as stale.
+            cache_control.max_age = max(seconds.value_or(0), 0);
+        }
+    }
+
+    return cache_control;
+}
+
+// https://httpwg.org/specs/rfc9110.html#http.date
+static Optional<UnixDateTime> parse_http_date(StringView value)
+{
+    // NOTE: We only understand the preferred format, e.g. "Sun, 06 Nov 1994 08:49:37 GMT". Recipients that can't parse
+    //       a date treat it as invalid, which makes responses relying on it stale.
+    static constexpr Array<StringView, 12> month_names { "Jan"sv, "Feb"sv, "Mar"sv, "Apr"sv, "May"sv, "Jun"sv, "Jul"sv, "Aug"sv, "Sep"sv, "Oct"sv, "Nov"sv, "Dec"sv };
+
+    auto parts = value.trim_whitespace().split_view(' ');
+    if (parts.size() != 6 || parts[5] != "GMT"sv)
+        return {};
+
+    auto day = parts[1].to_number<u8>();
+    auto month = month_names.first_index_of(parts[2]);
+    auto year = parts[3].to_number<i32>();
+
+    auto time = parts[4].split_view(':');
+    if (!day.has_value() || !month.has_value() || !year.has_value() || time.size() != 3)
+        return {};
+
+    auto hour = time[0].to_number<u8>();
+    auto minute = time[1].to_number<u8>();
+    auto second = time[2].to_number<u8>();
+    if (!hour.has_value() || !minute.has_value() || !second.has_value())
+        return {};
+    if (*day < 1 || *day > 31 || *hour > 23 || *minute > 59 || *second > 60)
+        return {};
+
+    return UnixDateTime::from_unix_time_parts(*year, static_cast<u8>(*month + 1), *day, *hour, *minute, *second, 0);
+}
+
+bool DiskCache::can_use_cache_for_request(StringView method, HTTP::HeaderMap const& request_headers)
+{
+    // NOTE: We only cache GET requests, and leave conditional and partial requests (which clients might use to
+    //       validate their own caches) as well as authenticated requests to the server.
+    if (method != "GET"sv)
+        return false;
+
+    for (auto header : { "Authorization"sv, "Range"sv, "If-Match"sv, "If-None-Match"sv, "If-Modified-Since"sv, "If-Unmodified-Since"sv, "If-Range"sv }) {
+        if (request_headers.contains(header))
+            return false;
+    }
+
+    return !parse_cache_control(request_headers).no_store;
+}
+
+// https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+static bool is_heuristically_cacheable_status(u32 status_code)
+{
+    // NOTE: 206 is left out, as we don't handle range requests.
+    return first_is_one_of(status_code, 200u, 203u, 204u, 300u, 301u, 308u, 404u, 405u, 410u, 414u, 501u);
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::is_response_storable(HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    // A cache MUST NOT store a response to a request unless:
+
+    // - the response status code is final, and understood by the cache;
+    if (!is_heuristically_cacheable_status(status_code))
+        return false;
+
+    // - the no-store cache directive is not present in the response (or the request);
+    auto cache_control = parse_cache_control(response_headers);
+    if (cache_control.no_store || parse_cache_control(request_headers).no_store)
+        return false;
+
+    // NOTE: We don't store secondary keys, so we can't store responses that vary on anything but the content coding,
+    //       which curl always negotiates in the same way.
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        for (auto field_name : vary->split_view(',')) {
+            if (!field_name.trim_whitespace().equals_ignoring_ascii_case("Accept-Encoding"sv))
+                return false;
+        }
+    }
+
+    // NOTE: Replaying Set-Cookie from the cache would overwrite cookies that changed since the response was stored.
+    if (response_headers.contains("Set-Cookie"sv))
+        return false;
+
+    // NOTE: The index is stored as JSON, so we can only store header fields that are valid UTF-8.
+    for (auto const& header : response_headers.headers()) {
+        if (!Utf8View { header.name.view() }.validate() || !Utf8View { header.value.view() }.validate())
+            return false;
+    }
+
+    // - the response contains at least one of: an Expires header field, a max-age response directive, or a status
+    //   code that is defined as heuristically cacheable.
+    // NOTE: For the latter, we also require a validator or a Last-Modified date, since we couldn't ever reuse it otherwise.
+    return response_headers.contains("Expires"sv)
+        || cache_control.max_age.has_value()
+        || response_headers.contains("ETag"sv)
+        || response_headers.contains("Last-Modified"sv);
+}
+
+DiskCache::Entry const* DiskCache::find(ByteString const& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return nullptr;
+
+    it->value.last_access_time = UnixDateTime::now();
+    schedule_index_write();
+    return &it->value;
+}
+
+bool DiskCache::has_validators(Entry const& entry)
+{
+    return entry.headers.contains("ETag"sv) || entry.headers.contains("Last-Modified"sv);
+}
+
+// https://httpwg.org/specs/rfc9110.html#field.date
+static UnixDateTime date_value(DiskCache::Entry const& entry)
+{
+    // NOTE: Responses without a (valid) Date header field are treated as if they were generated when we received them.
+    if (auto date = entry.headers.get("Date"sv); date.has_value()) {
+        if (auto date_value = parse_http_date(*date); date_value.has_value())
+            return *date_value;
+    }
+    return entry.response_time;
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static AK::Duration freshness_lifetime(DiskCache::Entry const& entry)
+{
+    auto cache_control = parse_cache_control(entry.headers);
+
+    // - If the cache is shared and the s-maxage response directive is present, use its value, or
+    // - If the max-age response directive is present, use its value, or
+    if (cache_control.max_age.has_value())
+        return AK::Duration::from_seconds(*cache_control.max_age);
+
+    auto date = date_value(entry);
+
+    // - If the Expires response header field is present, use its value minus the value of the Date response header field, or
+    if (auto expires = entry.headers.get("Expires"sv); expires.has_value()) {
+        auto expires_time = parse_http_date(*expires);
+        if (!expires_time.has_value())
+            return {};
+        return max(*expires_time - date, AK::Duration {});
+    }
+
+    // - Otherwise, no explicit expiration time is present in the response. A heuristic freshness lifetime might be applicable.
+    // https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+    // If the response has a Last-Modified header field, caches are encouraged to use a heuristic expiration value that
+    // is no more than some fraction of the interval since that time. A typical setting of this fraction might be 10%.
+    if (auto last_modified = entry.headers.get("Last-Modified"sv); last_modified.has_value()) {
+        if (auto last_modified_time = parse_http_date(*last_modified); last_modified_time.has_value() && *last_modified_time < date)
+            return AK::Duration::from_milliseconds((date - *last_modified_time).to_milliseconds() / 10);
+    }
+
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static AK::Duration current_age(DiskCache::Entry const& entry)
+{
+    AK::Duration age_value;
+    if (auto age = entry.headers.get("Age"sv); age.has_value())
+        age_value = AK::Duration::from_seconds(max(age->to_number<i64>().value_or(0), 0));
+
+    auto apparent_age = max(entry.response_time - date_value(entry), AK::Duration {});
+    auto response_delay = entry.response_time - entry.request_time;
+    auto corrected_age_value = age_value + response_delay;
+    auto corrected_initial_age = max(apparent_age, corrected_age_value);
+    auto resident_time = UnixDateTime::now() - entry.response_time;
+    return corrected_initial_age + resident_time;
+}
+
+bool DiskCache::can_serve_without_validation(Entry const& entry, HTTP::HeaderMap const& request_headers) const
+{
+    // https://httpwg.org/specs/rfc9111.html#constructing.responses.from.caches
+    // - the stored response does not contain the no-cache directive, unless it is successfully validated, and
+    if (parse_cache_control(entry.headers).no_cache)
+        return false;
+
+    // https://httpwg.org/specs/rfc9111.html#cache-request-directive.no-cache
+    // The no-cache request directive indicates that the client prefers a stored response not be used to satisfy the
+    // request without successful validation on the origin server.
+    auto request_cache_control = parse_cache_control(request_headers);
+    if (request_cache_control.no_cache)
+        return false;
+
+    auto age = current_age(entry);
+
+    // https://httpwg.org/specs/rfc9111.html#cache-request-directive.max-age
+    // The max-age request directive indicates that the client prefers a response whose age is less than or equal to
+    // the specified number of seconds.
+    if (request_cache_control.max_age.has_value() && age > AK::Duration::from_seconds(*request_cache_control.max_age))
+        return false;
+
+    // - the stored response is fresh.
+    // NOTE: We never serve stale responses.
+    return freshness_lifetime(entry) > age;
+}
+
+ErrorOr<NonnullOwnPtr<Core::MappedFile>> DiskCache::map_body(Entry const& entry) const
+{
+    auto body = TRY(Core::MappedFile::map(body_path(entry.body_id).string()));
+    if (body->bytes().size() != entry.body_size)
+        return Error::from_string_literal("Cached body has an unexpected size");
+    return body;
+}
+
+// https://httpwg.org/specs/rfc9111.html#storing.fields
+static bool is_exempted_for_storage(StringView header_name)
+{
+    return header_name.is_one_of_ignoring_ascii_case(
+        "Connection"sv,
+        "Proxy-Connection"sv,
+        "Keep-Alive"sv,
+        "TE"sv,
+        "Transfer-Encoding"sv,
+        "Upgrade"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#update
+static bool is_exempted_for_updating(StringView header_name)
+{
+    // NOTE: We store decoded bodies, so the metadata describing them must not change either.
+    return is_exempted_for_storage(header_name)
+        || header_name.is_one_of_ignoring_ascii_case("Content-Length"sv, "Content-Encoding"sv, "Content-Type"sv, "Content-Range"sv);
+}
+
+void DiskCache::store(ByteString const& key, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const& headers, UnixDateTime request_time, UnixDateTime response_time, ReadonlyBytes body)
+{
+    remove(key);
+
+    if (body.size() > max_body_size())
+        return;
+
+    evict_entries_to_fit(body.size());
+
+    auto body_id = m_next_body_id++;
+    auto result = [&]() -> ErrorOr<void> {
+        auto file = TRY(Core::File::open(body_path(body_id).string(), Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(body));
+        return {};
+    }();
+    if (result.is_error()) {
+        dbgln("DiskCache: Unable to store body for '{}': {}", key, result.error());
+        (void)Core::System::unlink(body_path(body_id).string());
+        return;
+    }
+
+    HTTP::HeaderMap stored_headers;
+    for (auto const& header : headers.headers()) {
+        if (!is_exempted_for_storage(header.name))
+            stored_headers.set(header.name, header.value);
+    }
+
+    m_entries.set(key, Entry {
+                           .body_id = body_id,
+                           .body_size = body.size(),
+                           .status_code = status_code,
+                           .reason_phrase = move(reason_phrase),
+                           .headers = move(stored_headers),
+                           .request_time = request_time,
+                           .response_time = response_time,
+                           .last_access_time = response_time,
+                       });
+    m_total_size += body.size();
+    schedule_index_write();
+}
+
+// https://httpwg.org/specs/rfc9111.html#freshening.responses
+void DiskCache::freshen(ByteString const& key, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+    auto& entry = it->value;
+
+    // The cache MUST update its header fields with the header fields provided in the 304 (Not Modified) response,
+    // replacing field values that are already present.
+    HashTable<ByteString, CaseInsensitiveStringTraits> updated_names;
+    for (auto const& header : not_modified_headers.headers()) {
+        if (!is_exempted_for_updating(header.name))
+            updated_names.set(header.name);
+    }
+
+    HTTP::HeaderMap headers;
+    for (auto const& header : entry.headers.headers()) {
+        if (!updated_names.contains(header.name))
+            headers.set(header.name, header.value);
+    }
+    for (auto const& header : not_modified_headers.headers()) {
+        if (updated_names.contains(header.name) && Utf8View { header.name.view() }.validate() && Utf8View { header.value.view() }.validate())
+            headers.set(header.name, header.value);
+    }
+
+    entry.headers = move(headers);
+    entry.request_time = request_time;
+    entry.response_time = response_time;
+    entry.last_access_time = response_time;
+    schedule_index_write();
+}
+
+void DiskCache::remove(ByteString const& key)
+{
+    auto entry = m_entries.take(key);
+    if (!entry.has_value())
+        return;
+
+    m_total_size -= entry->body_size;
+    (void)Core::System::unlink(body_path(entry->body_id).string());
+    schedule_index_write();
+}
+
+void DiskCache::evict_entries_to_fit(u64 size_to_add)
+{
+    // NOTE: Evict the least recently used entries until the new body fits into our budget.
+    while (!m_entries.is_empty() && m_total_size + size_to_add > m_size_limit) {
+        auto least_recently_used = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_access_time < least_recently_used->value.last_access_time)
+                least_recently_used = it;
+        }
+        remove(ByteString { least_recently_used->key });
+    }
+}
+
+void DiskCache::schedule_index_write()
+{
+    if (!m_index_write_timer->is_active())
+        m_index_write_timer->start();
+}
+
+ErrorOr<void> DiskCache::read_index()
+{
+    auto file = Core::File::open(index_path().string(), Core::File::OpenMode::Read);
+    if (file.is_error()) {
+        if (file.error().is_errno() && file.error().code() == ENOENT)
+            return {};
+        return file.release_error();
+    }
+
+    auto contents = TRY(file.value()->read_until_eof());
+    auto json = TRY(JsonValue::from_string(contents));
+    if (!json.is_object())
+        return Error::from_string_literal("Index is not a JSON object");
+
+    auto const& index = json.as_object();
+    if (index.get_i64("version"sv) != index_version)
+        return Error::from_string_literal("Index has an unsupported version");
+
+    m_next_body_id = index.get_u64("next_body_id"sv).value_or(0);
+
+    auto entries = index.get_array("entries"sv);
+    if (!entries.has_value())
+        return Error::from_string_literal("Index has no entries");
+
+    for (auto const& value : entries->values()) {
+        if (!value.is_object())
+            return Error::from_string_literal("Index entry is not a JSON object");
+        auto const& object = value.as_object();
+
+        auto key = object.get_string("key"sv);
+        auto body_id = object.get_u64("body_id"sv);
+        auto body_size = object.get_u64("body_size"sv);
+        auto status_code = object.get_u32("status_code"sv);
+        auto headers = object.get_array("headers"sv);
+        auto request_time = object.get_i64("request_time"sv);
+        auto response_time = object.get_i64("response_time"sv);
+        auto last_access_time = object.get_i64("last_access_time"sv);
+        if (!key.has_value() || !body_id.has_value() || !body_size.has_value() || !status_code.has_value() || !headers.has_value()
+            || !request_time.has_value() || !response_time.has_value() || !last_access_time.has_value())
+            return Error::from_string_literal("Index entry is missing a field");
+
+        Entry entry {
+            .body_id = *body_id,
+            .body_size = *body_size,
+            .status_code = *status_code,
+            .reason_phrase = object.get_string("reason_phrase"sv).copy(),
+            .headers = {},
+            .request_time = UnixDateTime::from_milliseconds_since_epoch(*request_time),
+            .response_time = UnixDateTime::from_milliseconds_since_epoch(*response_time),
+            .last_access_time = UnixDateTime::from_milliseconds_since_epoch(*last_access_time),
+        };
+
+        for (auto const& header : headers->values()) {
+            if (!header.is_array() || header.as_array().size() != 2 || !header.as_array()[0].is_string() || !header.as_array()[1].is_string())
+                return Error::from_string_literal("Index entry has an invalid header");
+            entry.headers.set(header.as_array()[0].as_string().to_byte_string(), header.as_array()[1].as_string().to_byte_string());
+        }
+
+        m_next_body_id = max(m_next_body_id, entry.body_id + 1);
+        m_total_size += entry.body_size;
+        m_entries.set(key->to_byte_string(), move(entry));
+    }
+
+    return {};
+}
+
+ErrorOr<void> DiskCache::write_index() const
+{
+    JsonArray entries;
+    for (auto const& [key, entry] : m_entries) {
+        JsonArray headers;
+        for (auto const& header : entry.headers.headers()) {
+            JsonArray name_and_value;
+            name_and_value.must_append(header.name.view());
+            name_and_value.must_append(header.value.view());
+            headers.must_append(move(name_and_value));
+        }
+
+        JsonObject object;
+        object.set("key"sv, key.view());
+        object.set("body_id"sv, entry.body_id);
+        object.set("body_size"sv, entry.body_size);
+        object.set("status_code"sv, entry.status_code);
+        if (entry.reason_phrase.has_value())
+            object.set("reason_phrase"sv, *entry.reason_phrase);
+        object.set("headers"sv, move(headers));
+        object.set("request_time"sv, entry.request_time.milliseconds_since_epoch());
+        object.set("response_time"sv, entry.response_time.milliseconds_since_epoch());
+        object.set("last_access_time"sv, entry.last_access_time.milliseconds_since_epoch());
+        entries.must_append(move(object));
+    }
+
+    JsonObject index;
+    index.set("version"sv, index_version);
+    index.set("next_body_id"sv, m_next_body_id);
+    index.set("entries"sv, move(entries));
+
+    // NOTE: Write the index to a temporary file first, so that we never leave a partially written index behind.
+    auto temporary_path = m_directory.append("index.json.tmp"sv);
+    {
+        auto file = TRY(Core::File::open(temporary_path.string(), Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(index.serialized().bytes()));
+    }
+    TRY(Core::System::rename(temporary_path.string(), index_path().string()));
+    return {};
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/LexicalPath.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibCore/Forward.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/Forward.h>
+
+namespace RequestServer {
+
+// A persistent HTTP cache (https://httpwg.org/specs/rfc9111.html), shared by every client of this RequestServer.
+// The index of stored responses lives in memory and is periodically written to disk, while response bodies are kept
+// in separate files that are memory-mapped when they are served.
+class DiskCache {
+    AK_MAKE_NONCOPYABLE(DiskCache);
+    AK_MAKE_NONMOVABLE(DiskCache);
+
+public:
+    static constexpr u64 default_size_limit = 256 * MiB;
+
+    static void initialize(LexicalPath directory, u64 size_limit = default_size_limit);
+    static void shutdown();
+    static DiskCache* the();
+
+    ~DiskCache();
+
+    struct Entry {
+        u64 body_id { 0 };
+        u64 body_size { 0 };
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap headers;
+        UnixDateTime request_time;
+        UnixDateTime response_time;
+        UnixDateTime last_access_time;
+    };
+
+    static ByteString cache_key(StringView partition, URL::URL const&);
+
+    // Whether a request may be answered from the cache, and whether its response may be stored.
+    static bool can_use_cache_for_request(StringView method, HTTP::HeaderMap const& request_headers);
+    static bool is_response_storable(HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers);
+
+    Entry const* find(ByteString const& key);
+
+    // A fresh entry can be served without contacting the server. Otherwise, it has to be validated first.
+    bool can_serve_without_validation(Entry const&, HTTP::HeaderMap const& request_headers) const;
+    static bool has_validators(Entry const&);
+
+    ErrorOr<NonnullOwnPtr<Core::MappedFile>> map_body(Entry const&) const;
+
+    void store(ByteString const& key, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const& headers, UnixDateTime request_time, UnixDateTime response_time, ReadonlyBytes body);
+    void freshen(ByteString const& key, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time);
+    void remove(ByteString const& key);
+
+    u64 max_body_size() const { return m_size_limit / 8; }
+
+private:
+    DiskCache(LexicalPath directory, u64 size_limit);
+
+    LexicalPath body_path(u64 body_id) const;
+    LexicalPath index_path() const;
+
+    void evict_entries_to_fit(u64 size_to_add);
+    void schedule_index_write();
+    ErrorOr<void> read_index();
+    ErrorOr<void> write_index() const;
+
+    LexicalPath m_directory;
+    u64 m_size_limit { 0 };
+    u64 m_total_size { 0 };
+    u64 m_next_body_id { 0 };
+    HashMap<ByteString, Entry> m_entries;
+    RefPtr<Core::Timer> m_index_write_timer;
+};
+
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <RequestServer/HARRecorder.h>
+#include <time.h>
+
+namespace RequestServer {
+
+static OwnPtr<HARRecorder> s_har_recorder;
+
+void HARRecorder::initialize(LexicalPath output_path)
+{
+    s_har_recorder = adopt_own(*new HARRecorder(move(output_path)));
+}
+
+void HARRecorder::shutdown()
+{
+    s_har_recorder = nullptr;
+}
+
+HARRecorder* HARRecorder::the()
+{
+    return s_har_recorder.ptr();
+}
+
+HARRecorder::HARRecorder(LexicalPath output_path)
+    : m_output_path(move(output_path))
+{
+}
+
+HARRecorder::~HARRecorder()
+{
+    if (auto result = write_archive(); result.is_error())
+        dbgln("HARRecorder: Unable to write HTTP archive to '{}': {}", m_output_path, result.error());
+}
+
+// HAR times are in milliseconds, with -1 standing for phases that don't apply to a request.
+static double to_har_time(Optional<AK::Duration> duration)
+{
+    if (!duration.has_value())
+        return -1;
+    return static_cast<double>(max(duration->to_microseconds(), 0)) / 1000.0;
+}
+
+static String to_iso8601_string(UnixDateTime date_time)
+{
+    auto seconds = static_cast<time_t>(date_time.seconds_since_epoch());
+    struct tm tm;
+    gmtime_r(&seconds, &tm);
+
+    return MUST(String::formatted("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z",
+        tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+        date_time.milliseconds_since_epoch() % 1000));
+}
+
+// NOTE: Header values aren't necessarily valid UTF-8, but JSON strings have to be.
+static String to_har_string(StringView string)
+{
+    return String::from_utf8_with_replacement_character(string, String::WithBOMHandling::No);
+}
+
+static JsonArray to_har_headers(HTTP::HeaderMap const& headers)
+{
+    JsonArray har_headers;
+    for (auto const& header : headers.headers()) {
+        JsonObject har_header;
+        har_header.set("name"sv, to_har_string(header.name));
+        har_header.set("value"sv, to_har_string(header.value));
+        har_headers.must_append(move(har_header));
+    }
+    return har_headers;
+}
+
+void HARRecorder::record(Entry const& entry)
+{
+    auto now = MonotonicTime::now();
+    auto issued = entry.issued.value_or(entry.started);
+
+    Optional<AK::Duration> dns;
+    if (entry.domain_lookup_start.has_value() && entry.domain_lookup_end.has_value())
+        dns = *entry.domain_lookup_end - *entry.domain_lookup_start;
+
+    auto http_version = Requests::alpn_http_version_to_fly_string(entry.http_version).to_string();
+
+    JsonObject request;
+    request.set("method"sv, to_har_string(entry.method));
+    request.set("url"sv, entry.url);
+    request.set("httpVersion"sv, http_version);
+    request.set("cookies"sv, JsonArray {});
+    request.set("headers"sv, to_har_headers(entry.request_headers));
+    request.set("queryString"sv, JsonArray {});
+    request.set("headersSize"sv, -1);
+    request.set("bodySize"sv, entry.request_body_size);
+
+    JsonObject content;
+    content.set("size"sv, entry.body_size);
+    content.set("mimeType"sv, to_har_string(entry.response_headers.get("Content-Type"sv).value_or({})));
+
+    JsonObject response;
+    response.set("status"sv, entry.status_code);
+    response.set("statusText"sv, entry.reason_phrase.value_or({}));
+    response.set("httpVersion"sv, http_version);
+    response.set("cookies"sv, JsonArray {});
+    response.set("headers"sv, to_har_headers(entry.response_headers));
+    response.set("content"sv, move(content));
+    response.set("redirectURL"sv, to_har_string(entry.response_headers.get("Location"sv).value_or({})));
+    response.set("headersSize"sv, -1);
+    response.set("bodySize"sv, entry.served_from_disk_cache ? 0 : entry.body_size);
+    if (entry.network_error.has_value())
+        response.set("_error"sv, Requests::network_error_to_string(*entry.network_error));
+
+    JsonObject timings;
+    timings.set("blocked"sv, to_har_time((issued - entry.started) + entry.queued));
+    timings.set("dns"sv, to_har_time(dns));
+    timings.set("connect"sv, to_har_time(entry.connect));
+    timings.set("ssl"sv, to_har_time(entry.ssl));
+    timings.set("send"sv, to_har_time(entry.send.value_or({})));
+    timings.set("wait"sv, to_har_time(entry.wait.value_or({})));
+    timings.set("receive"sv, to_har_time(entry.receive.value_or({})));
+
+    JsonObject har_entry;
+    har_entry.set("startedDateTime"sv, to_iso8601_string(entry.started_date_time));
+    har_entry.set("time"sv, to_har_time(now - entry.started));
+    har_entry.set("request"sv, move(request));
+    har_entry.set("response"sv, move(response));
+    har_entry.set("cache"sv, JsonObject {});
+    har_entry.set("timings"sv, move(timings));
+    har_entry.set("_servedFromDiskCache"sv, entry.served_from_disk_cache);
+    har_entry.set("_validatedWithServer"sv, entry.validated_with_server);
+
+    m_entries.must_append(move(har_entry));
+}
+
+ErrorOr<void> HARRecorder::write_archive() const
+{
+    JsonObject creator;
+    creator.set("name"sv, "Ladybird"sv);
+    creator.set("version"sv, "1.0"sv);
+
+    JsonObject log;
+    log.set("version"sv, "1.2"sv);
+    log.set("creator"sv, move(creator));
+    log.set("pages"sv, JsonArray {});
+    log.set("entries"sv, m_entries);
+
+    JsonObject archive;
+    archive.set("log"sv, move(log));
+
+    // NOTE: We write to a temporary file first, so that we never leave a partially written archive behind.
+    auto temporary_path = ByteString::formatted("{}.tmp", m_output_path.string());
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(archive.serialized().bytes()));
+    }
+    TRY(Core::System::rename(temporary_path, m_output_path.string()));
+    return {};
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/JsonArray.h>
+#include <AK/LexicalPath.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibRequests/ALPNHttpVersion.h>
+#include <LibRequests/NetworkError.h>
+
+namespace RequestServer {
+
+// Records every request made through this RequestServer process in an HTTP Archive (HAR), along with how long it spent
+// in each phase of loading, so that slow page loads can be looked into after the fact. The archive is written to the
+// given path on shutdown.
+// http://www.softwareishard.com/blog/har-12-spec/
+class HARRecorder {
+    AK_MAKE_NONCOPYABLE(HARRecorder);
+    AK_MAKE_NONMOVABLE(HARRecorder);
+
+public:
+    struct Entry {
+        UnixDateTime started_date_time;
+        MonotonicTime started;
+
+        ByteString method;
+        String url;
+        HTTP::HeaderMap request_headers;
+        size_t request_body_size { 0 };
+
+        // When the request was issued, after it was held back by the priority scheduler or waited for an identical
+        // request to finish.
+        Optional<MonotonicTime> issued;
+        Optional<MonotonicTime> domain_lookup_start;
+        Optional<MonotonicTime> domain_lookup_end;
+
+        // The phases after the host was resolved, as measured by curl. Phases that didn't happen (like connecting, if
+        // an existing connection was reused) are left empty.
+        AK::Duration queued;
+        Optional<AK::Duration> connect;
+        Optional<AK::Duration> ssl;
+        Optional<AK::Duration> send;
+        Optional<AK::Duration> wait;
+        Optional<AK::Duration> receive;
+
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap response_headers;
+        Requests::ALPNHttpVersion http_version { Requests::ALPNHttpVersion::None };
+        u64 body_size { 0 };
+
+        bool served_from_disk_cache { false };
+        bool validated_with_server { false };
+        Optional<Requests::NetworkError> network_error;
+    };
+
+    static void initialize(LexicalPath output_path);
+    static void shutdown();
+    static HARRecorder* the();
+
+    ~HARRecorder();
+
+    void record(Entry const&);
+
+private:
+    explicit HARRecorder(LexicalPath output_path);
+
+    ErrorOr<void> write_archive() const;
+
+    LexicalPath m_output_path;
+    JsonArray m_entries;
+};
+
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// How urgently the client needs a response. Requests of High priority and above are considered critical, e.g. because
+// they block rendering, and requests for less important resources from the same origin are held back while they load.
+enum class RequestPriority : u8 {
+    Lowest,
+    Low,
+    Medium,
+    High,
+    Highest,
+};
+
+constexpr bool is_critical_request_priority(RequestPriority priority)
+{
+    return priority >= RequestPriority::High;
+}
+
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Base64.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Time.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <RequestServer/TLSSessionCache.h>
+
+#ifdef AK_OS_WINDOWS
+// needed because curl.h includes winsock2.h
+#    include <AK/Windows.h>
+#endif
+#include <curl/curl.h>
+
+namespace RequestServer {
+
+static constexpr i64 sessions_version = 1;
+
+static OwnPtr<TLSSessionCache> s_tls_session_cache;
+
+void TLSSessionCache::initialize(Optional<LexicalPath> persistent_path)
+{
+    auto* share = curl_share_init();
+    if (!share) {
+        dbgln("TLSSessionCache: Failed to initialize curl share handle");
+        return;
+    }
+
+    // NOTE: RequestServer only runs curl on the main thread, so the share doesn't need locking callbacks.
+    if (auto result = curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION); result != CURLSHE_OK) {
+        dbgln("TLSSessionCache: Failed to share TLS sessions: {}", curl_share_strerror(result));
+        curl_share_cleanup(share);
+        return;
+    }
+
+    s_tls_session_cache = adopt_own(*new TLSSessionCache(share, move(persistent_path)));
+}
+
+void TLSSessionCache::shutdown()
+{
+    s_tls_session_cache = nullptr;
+}
+
+TLSSessionCache* TLSSessionCache::the()
+{
+    return s_tls_session_cache.ptr();
+}
+
+TLSSessionCache::TLSSessionCache(void* share, Optional<LexicalPath> persistent_path)
+    : m_share(share)
+    , m_persistent_path(move(persistent_path))
+{
+    if (!m_persistent_path.has_value())
+        return;
+
+    if (auto result = read_sessions(); result.is_error())
+        dbgln("TLSSessionCache: Unable to read sessions from '{}': {}", *m_persistent_path, result.error());
+}
+
+TLSSessionCache::~TLSSessionCache()
+{
+    if (m_persistent_path.has_value()) {
+        if (auto result = write_sessions(); result.is_error())
+            dbgln("TLSSessionCache: Unable to write sessions to '{}': {}", *m_persistent_path, result.error());
+    }
+
+    curl_share_cleanup(m_share);
+}
+
+void TLSSessionCache::use_for_easy_handle(void* easy) const
+{
+    if (auto result = curl_easy_setopt(easy, CURLOPT_SHARE, m_share); result != CURLE_OK)
+        dbgln("TLSSessionCache: Failed to attach share handle: {}", curl_easy_strerror(result));
+}
+
+// NOTE: Importing and exporting sessions works through an easy handle that uses our share.
+template<typename Callback>
+static ErrorOr<void> with_easy_handle(TLSSessionCache const& cache, Callback callback)
+{
+    auto* easy = curl_easy_init();
+    if (!easy)
+        return Error::from_string_literal("Failed to initialize curl easy handle");
+    ScopeGuard cleanup_easy = [&] { curl_easy_cleanup(easy); };
+
+    cache.use_for_easy_handle(easy);
+    return callback(easy);
+}
+
+ErrorOr<void> TLSSessionCache::read_sessions()
+{
+    auto file = Core::File::open(m_persistent_path->string(), Core::File::OpenMode::Read);
+    if (file.is_error()) {
+        if (file.error().is_errno() && file.error().code() == ENOENT)
+            return {};
+        return file.release_error();
+    }
+
+    auto contents = TRY(file.value()->read_until_eof());
+    auto json = TRY(JsonValue::from_string(contents));
+    if (!json.is_object())
+        return Error::from_string_literal("Sessions are not a JSON object");
+
+    auto const& object = json.as_object();
+    if (object.get_i64("version"sv) != sessions_version)
+        return Error::from_string_literal("Sessions have an unsupported version");
+
+    auto sessions = object.get_array("sessions"sv);
+    if (!sessions.has_value())
+        return Error::from_string_literal("Sessions are missing");
+
+    auto now = UnixDateTime::now().seconds_since_epoch();
+
+    return with_easy_handle(*this, [&](CURL* easy) -> ErrorOr<void> {
+        for (auto const& value : sessions->values()) {
+            if (!value.is_object())
+                continue;
+            auto const& session = value.as_object();
+
+            auto valid_until = session.get_i64("valid_until"sv);
+            auto shmac = session.get_string("shmac"sv);
+            auto data = session.get_string("data"sv);
+            if (!valid_until.has_value() || !shmac.has_value() || !data.has_value())
+                continue;
+            if (*valid_until != 0 && *valid_until <= now)
+                continue;
+
+            auto decoded_shmac = decode_base64(*shmac);
+            auto decoded_data = decode_base64(*data);
+            if (decoded_shmac.is_error() || decoded_data.is_error())
+                continue;
+
+            // NOTE: We only store the salted hash of each session's key, which is all curl needs to find the session again.
+            auto result = curl_easy_ssls_import(easy, nullptr, decoded_shmac.value().data(), decoded_shmac.value().size(), decoded_data.value().data(), decoded_data.value().size());
+            if (result != CURLE_OK)
+                dbgln("TLSSessionCache: Failed to import session: {}", curl_easy_strerror(result));
+        }
+        return {};
+    });
+}
+
+ErrorOr<void> TLSSessionCache::write_sessions() const
+{
+    JsonArray sessions;
+
+    TRY(with_easy_handle(*this, [&](CURL* easy) -> ErrorOr<void> {
+        auto export_session = [](CURL*, void* user_data, char const*, unsigned char const* shmac, size_t shmac_length, unsigned char const* data, size_t data_length, curl_off_t valid_until, int, char const*, size_t) -> CURLcode {
+            auto& sessions = *static_cast<JsonArray*>(user_data);
+
+            auto encoded_shmac = encode_base64({ shmac, shmac_length });
+            auto encoded_data = encode_base64({ data, data_length });
+            if (encoded_shmac.is_error() || encoded_data.is_error())
+                return CURLE_OUT_OF_MEMORY;
+
+            JsonObject session;
+            session.set("valid_until"sv, static_cast<i64>(valid_until));
+            session.set("shmac"sv, encoded_shmac.release_value());
+            session.set("data"sv, encoded_data.release_value());
+            sessions.must_append(move(session));
+            return CURLE_OK;
+        };
+
+        if (auto result = curl_easy_ssls_export(easy, export_session, &sessions); result != CURLE_OK)
+            return Error::from_string_view(StringView { curl_easy_strerror(result), strlen(curl_easy_strerror(result)) });
+        return {};
+    }));
+
+    JsonObject object;
+    object.set("version"sv, sessions_version);
+    object.set("sessions"sv, move(sessions));
+
+    // NOTE: Sessions allow resuming connections without authenticating the server again, so they're only readable by us.
+    //       We also write them to a temporary file first, so that we never leave a partially written file behind.
+    auto temporary_path = ByteString::formatted("{}.tmp", m_persistent_path->string());
+    {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(object.serialized().bytes()));
+    }
+    TRY(Core::System::rename(temporary_path, m_persistent_path->string()));
+    return {};
+}
+
+}
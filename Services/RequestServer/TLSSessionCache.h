@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/LexicalPath.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+
+namespace RequestServer {
+
+// Shares TLS sessions between all of curl's connections, no matter which client they belong to. Connecting to a server
+// we've talked to before then resumes the previous session instead of performing a full handshake, which also allows
+// sending requests as TLS 1.3 early data. Sessions are keyed by curl, by (among other things) host, port and ALPN.
+//
+// If given a path, the sessions are read from it on startup and written back to it on shutdown, so that they survive
+// RequestServer restarts.
+class TLSSessionCache {
+    AK_MAKE_NONCOPYABLE(TLSSessionCache);
+    AK_MAKE_NONMOVABLE(TLSSessionCache);
+
+public:
+    static void initialize(Optional<LexicalPath> persistent_path = {});
+    static void shutdown();
+    static TLSSessionCache* the();
+
+    ~TLSSessionCache();
+
+    void use_for_easy_handle(void* easy) const;
+
+private:
+    TLSSessionCache(void* share, Optional<LexicalPath> persistent_path);
+
+    ErrorOr<void> read_sessions();
+    ErrorOr<void> write_sessions() const;
+
+    void* m_share { nullptr };
+    Optional<LexicalPath> m_persistent_path;
+};
+
+}
@@ -6,6 +6,7 @@
 
 #include "ConnectionFromClient.h"
 
+#include <RequestServer/TLSSessionCache.h>
 #include <RequestServer/WebSocketImplCurl.h>
 
 namespace RequestServer {
@@ -65,6 +66,9 @@ void WebSocketImplCurl::connect(WebSocket::ConnectionInfo const& info)
     set_option(CURLOPT_URL, url.to_byte_string().characters());
     set_option(CURLOPT_PORT, url.port_or_default());
 
+    if (auto* tls_session_cache = TLSSessionCache::the())
+        tls_session_cache->use_for_easy_handle(m_easy_handle);
+
     if (auto root_certs = info.root_certificates_path(); root_certs.has_value())
         set_option(CURLOPT_CAINFO, root_certs->characters());
 
@@ -204,6 +208,18 @@ bool WebSocketImplCurl::did_connect()
     if (res != CURLE_OK || socket_fd == CURL_SOCKET_BAD)
         return false;
 
+    // NOTE: curl performs the opening handshake, but leaves the extensions to us, since we're using it in raw mode.
+    curl_header* extensions_header = nullptr;
+    if (curl_easy_header(m_easy_handle, "Sec-WebSocket-Extensions", 0, CURLH_HEADER, -1, &extensions_header) == CURLHE_OK) {
+        Vector<ByteString> extensions;
+        for (size_t i = 0; i < extensions_header->amount; ++i) {
+            curl_header* header = nullptr;
+            if (curl_easy_header(m_easy_handle, "Sec-WebSocket-Extensions", i, CURLH_HEADER, -1, &header) == CURLHE_OK)
+                extensions.append(header->value);
+        }
+        m_negotiated_extensions = ByteString::join(","sv, extensions);
+    }
+
     m_read_notifier = Core::Notifier::construct(socket_fd, Core::Notifier::Type::Read);
     m_read_notifier->on_activation = [this] {
         read_from_socket();
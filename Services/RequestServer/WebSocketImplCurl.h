@@ -28,6 +28,7 @@ public:
     virtual void discard_connection() override;
 
     virtual bool handshake_complete_when_connected() const override { return true; }
+    virtual Optional<ByteString> negotiated_extensions() const override { return m_negotiated_extensions; }
 
     bool did_connect();
 
@@ -42,6 +43,7 @@ private:
     RefPtr<Core::Notifier> m_error_notifier;
     Vector<curl_slist*> m_curl_string_lists;
     AllocatingMemoryStream m_read_buffer;
+    Optional<ByteString> m_negotiated_extensions;
 };
 
 }
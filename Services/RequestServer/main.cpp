@@ -12,9 +12,13 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
+#include <RequestServer/HARRecorder.h>
+#include <RequestServer/TLSSessionCache.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -23,6 +27,7 @@
 namespace RequestServer {
 
 extern ByteString g_default_certificate_path;
+extern bool g_use_shared_memory_for_response_bodies;
 
 }
 
@@ -33,11 +38,17 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool enable_http_disk_cache = false;
+    bool use_shared_memory_for_response_bodies = false;
+    StringView har_output_path;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
+    args_parser.add_option(use_shared_memory_for_response_bodies, "Send response bodies to clients through shared memory", "use-shared-memory-for-response-bodies");
+    args_parser.add_option(har_output_path, "Record all requests to an HTTP archive (HAR) at the given path", "har-output", 0, "path");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -47,8 +58,24 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!certificates.is_empty())
         RequestServer::g_default_certificate_path = certificates.first();
 
+    RequestServer::g_use_shared_memory_for_response_bodies = use_shared_memory_for_response_bodies;
+
     Core::EventLoop event_loop;
 
+    auto cache_directory = LexicalPath { ByteString::formatted("{}/Ladybird/Cache", Core::StandardPaths::user_data_directory()) };
+
+    if (enable_http_disk_cache)
+        RequestServer::DiskCache::initialize(cache_directory);
+
+    // NOTE: TLS sessions are only persisted along with the disk cache, so that they are cleared along with it.
+    if (enable_http_disk_cache)
+        RequestServer::TLSSessionCache::initialize(cache_directory.append("tls-sessions.json"sv));
+    else
+        RequestServer::TLSSessionCache::initialize();
+
+    if (!har_output_path.is_empty())
+        RequestServer::HARRecorder::initialize(LexicalPath { har_output_path });
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty())
         Core::Platform::register_with_mach_server(mach_server_name);
@@ -56,5 +83,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     auto client = TRY(IPC::take_over_accepted_client_from_system_server<RequestServer::ConnectionFromClient>());
 
-    return event_loop.exec();
+    auto exit_code = event_loop.exec();
+    RequestServer::TLSSessionCache::shutdown();
+    RequestServer::DiskCache::shutdown();
+    RequestServer::HARRecorder::shutdown();
+    return exit_code;
 }
@@ -10,28 +10,35 @@
  */
 
 #include <AK/JsonObject.h>
+#include <AK/NumberFormat.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibGfx/TextLayout.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/SamplingProfiler.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/DecodedFontCache.h>
 #include <LibWeb/CSS/StyleComputer.h>
-#include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CharacterData.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -211,6 +218,10 @@ void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
         if (event.type != Web::MouseEvent::Type::MouseMove && event.type != Web::MouseEvent::Type::MouseWheel)
             return nullptr;
 
+        // NOTE: Events that were already scrolled for can't take on the scrolling of another one.
+        if (m_input_event_queue.tail().has_already_scrolled)
+            return nullptr;
+
         if (auto const* mouse_event = m_input_event_queue.tail().event.get_pointer<Web::MouseEvent>()) {
             if (mouse_event->type == event.type)
                 return mouse_event;
@@ -219,6 +230,23 @@ void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
         return nullptr;
     };
 
+    // NOTE: This is only done while no other input events are waiting, as those have to be handled first, and their
+    //       results reported to the UI process in order.
+    if (event.type == Web::MouseEvent::Type::MouseWheel && m_input_event_queue.is_empty()) {
+        if (auto page = this->page(page_id); page.has_value()) {
+            switch (page->page().scroll_for_mousewheel_ahead_of_dispatch(event.position, event.modifiers, event.wheel_delta_x, event.wheel_delta_y)) {
+            case Web::MouseWheelScrollResult::NotScrolled:
+                break;
+            case Web::MouseWheelScrollResult::ScrolledElement:
+                async_did_finish_handling_input_event(page_id, Web::EventResult::Handled);
+                return;
+            case Web::MouseWheelScrollResult::ScrolledViewport:
+                enqueue_input_event({ .page_id = page_id, .event = move(event), .has_already_scrolled = true });
+                return;
+            }
+        }
+    }
+
     if (auto const* last_mouse_event = event_to_coalesce()) {
         event.wheel_delta_x += last_mouse_event->wheel_delta_x;
         event.wheel_delta_y += last_mouse_event->wheel_delta_y;
@@ -262,6 +290,77 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-frame-timeline") {
+        auto const& frame_timeline = page->page().top_level_traversable()->frame_timeline();
+        if (argument == "trace-events")
+            dbgln("{}", frame_timeline.to_trace_events_json());
+        else
+            dbgln("{}", frame_timeline.dump());
+        return;
+    }
+
+    if (request == "dump-task-statistics") {
+        dbgln("{}", Web::HTML::main_thread_event_loop().task_statistics().dump());
+        return;
+    }
+
+    if (request == "js-sampling-profiler") {
+        auto& interpreter = Web::Bindings::main_thread_vm().bytecode_interpreter();
+        if (argument == "start") {
+            interpreter.start_sampling_profiler(AK::Duration::from_milliseconds(1));
+            dbgln("Started the JavaScript sampling profiler");
+        } else if (auto profiler = interpreter.stop_sampling_profiler()) {
+            dbgln("JavaScript sampling profiler: {} samples, as folded stacks:", profiler->sample_count());
+            dbgln("{}", profiler->folded_stacks());
+        }
+        return;
+    }
+
+    if (request == "js-allocation-sampler") {
+        auto& vm = Web::Bindings::main_thread_vm();
+        if (argument == "start") {
+            vm.heap().start_sampling_allocations(64 * KiB, [&vm] {
+                if (vm.execution_context_stack().is_empty())
+                    return "(no JavaScript)"_string;
+                return JS::Bytecode::SamplingProfiler::current_stack(vm);
+            });
+            dbgln("Started sampling GC allocations");
+        } else {
+            vm.heap().stop_sampling_allocations();
+            dbgln("Stopped sampling GC allocations, the sampled sites are part of the GC heap statistics");
+        }
+        return;
+    }
+
+    if (request == "js-instruction-profiler") {
+        auto& interpreter = Web::Bindings::main_thread_vm().bytecode_interpreter();
+        if (argument == "start") {
+            interpreter.start_instruction_profiler();
+            dbgln("Started the JavaScript instruction profiler");
+        } else if (auto profiler = interpreter.stop_instruction_profiler()) {
+            dbgln("JavaScript instruction profile:");
+            dbgln("{}", profiler->dump());
+        }
+        return;
+    }
+
+    if (request == "dump-http-cache-statistics") {
+        auto statistics = Web::Fetch::Fetching::http_cache_statistics();
+        auto lookup_count = statistics.hit_count + statistics.miss_count;
+        auto hit_rate = lookup_count != 0 ? static_cast<double>(statistics.hit_count) / static_cast<double>(lookup_count) * 100.0 : 0.0;
+
+        dbgln("HTTP cache: {} responses, {} of {} resident", statistics.entry_count, human_readable_size(statistics.resident_bytes), human_readable_size(statistics.size_limit));
+        dbgln("  {} hits, {} misses ({:.1}% hit rate), {} evictions", statistics.hit_count, statistics.miss_count, hit_rate, statistics.eviction_count);
+        for (auto const& partition : statistics.partitions)
+            dbgln("  {}: {} responses, {}", partition.top_level_origin, partition.entry_count, human_readable_size(partition.resident_bytes));
+        return;
+    }
+
+    if (request == "dump-ipc-statistics") {
+        IPC::ConnectionBase::dump_statistics_of_all_connections();
+        return;
+    }
+
     if (request == "dump-dom-tree") {
         if (auto* doc = page->page().top_level_browsing_context().active_document())
             Web::dump_tree(*doc);
@@ -370,6 +469,8 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
 
     if (request == "clear-cache") {
         Web::ResourceLoader::the().clear_cache();
+        Web::Fetch::Fetching::shrink_http_cache();
+        Web::CSS::DecodedFontCache::the().clear();
         return;
     }
 
@@ -985,6 +1086,12 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_gc_heap_statistics(StringBuilder& builder)
+{
+    auto statistics = Web::Bindings::main_thread_vm().heap().statistics();
+    statistics.serialize(builder);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -1023,6 +1130,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::GCHeapStatistics)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_gc_heap_statistics(builder);
+    }
+
     async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
 }
 
@@ -1307,4 +1420,26 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::memory_pressure_level_changed(Core::MemoryPressureLevel level)
+{
+    if (level == Core::MemoryPressureLevel::Normal)
+        return;
+
+    Gfx::purge_text_caches();
+
+    // NOTE: Under moderate pressure, the most recently used half of the HTTP cache is kept around.
+    if (level == Core::MemoryPressureLevel::Critical) {
+        Web::ResourceLoader::the().clear_cache();
+        Web::Fetch::Fetching::shrink_http_cache();
+        Web::CSS::DecodedFontCache::the().clear();
+    } else {
+        Web::Fetch::Fetching::shrink_http_cache(Web::Fetch::Fetching::http_cache_statistics().resident_bytes / 2);
+    }
+
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([] {
+        Web::Bindings::main_thread_vm().heap().collect_garbage();
+    });
+}
+
 }
@@ -155,6 +155,7 @@ private:
     virtual void paste(u64 page_id, String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void memory_pressure_level_changed(Core::MemoryPressureLevel) override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
@@ -13,12 +13,15 @@
 #include <LibCore/SystemServerTakeover.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
+#include <LibGfx/SkiaBackendContext.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibMain/Main.h>
 #include <LibMedia/Audio/Loader.h>
 #include <LibRequests/RequestClient.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Loader/ContentFilter.h>
@@ -111,6 +114,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool collect_garbage_on_every_allocation = false;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
+    Optional<size_t> gpu_resource_cache_limit_in_mib;
+    Optional<size_t> http_cache_limit_in_mib;
     StringView echo_server_port_string_view {};
 
     Core::ArgsParser args_parser;
@@ -132,6 +137,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
+    args_parser.add_option(gpu_resource_cache_limit_in_mib, "Limit for GPU memory used by cached resources such as uploaded images, in MiB", "gpu-resource-cache-limit", 0, "mib");
+    args_parser.add_option(http_cache_limit_in_mib, "Limit for memory used by the HTTP cache, in MiB", "http-cache-limit", 0, "mib");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
 
@@ -159,6 +166,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     // Always use the CPU backend for layout tests, as the GPU backend is not deterministic
     WebContent::PageClient::set_use_skia_painter(force_cpu_painting ? WebContent::PageClient::UseSkiaPainter::CPUBackend : WebContent::PageClient::UseSkiaPainter::GPUBackendIfAvailable);
 
+    if (gpu_resource_cache_limit_in_mib.has_value())
+        Gfx::SkiaBackendContext::set_resource_cache_limit_for_new_contexts(*gpu_resource_cache_limit_in_mib * MiB);
+
     WebContent::PageClient::set_is_headless(is_headless);
 
     if (disable_site_isolation)
@@ -168,6 +178,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Web::Fetch::Fetching::g_http_cache_enabled = true;
     }
 
+    if (http_cache_limit_in_mib.has_value())
+        Web::Fetch::Fetching::set_http_cache_size_limit(*http_cache_limit_in_mib * MiB);
+
     Web::Painting::g_paint_viewport_scrollbars = !disable_scrollbar_painting;
 
     if (!echo_server_port_string_view.is_empty()) {
@@ -225,6 +238,12 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             dbgln("Failed to reinitialize image decoder: {}", maybe_error.error());
     };
 
+    // OPTIMIZATION: Most WebContent processes are launched as spares, and sit idle until they're given a page to load.
+    //               Use that time to parse the UA style sheets, which every page needs before it can compute any style.
+    Core::deferred_invoke([] {
+        Web::CSS::StyleComputer::load_user_agent_style_sheets();
+    });
+
     return event_loop.exec();
 }
 
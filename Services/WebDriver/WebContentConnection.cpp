@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibWeb/WebDriver/Screenshot.h>
 #include <WebDriver/Client.h>
 #include <WebDriver/WebContentConnection.h>
 
@@ -26,4 +29,17 @@ void WebContentConnection::driver_execution_complete(Web::WebDriver::Response re
         on_driver_execution_complete(move(response));
 }
 
+void WebContentConnection::driver_screenshot_complete(Gfx::ShareableBitmap screenshot)
+{
+    if (!on_driver_execution_complete)
+        return;
+
+    if (!screenshot.is_valid()) {
+        on_driver_execution_complete(Web::WebDriver::Error::from_code(Web::WebDriver::ErrorCode::UnableToCaptureScreen, "Failed to transfer screenshot"sv));
+        return;
+    }
+
+    on_driver_execution_complete(Web::WebDriver::encode_bitmap_as_base64(*screenshot.bitmap()));
+}
+
 }
@@ -28,6 +28,7 @@ private:
     virtual void die() override;
 
     virtual void driver_execution_complete(Web::WebDriver::Response) override;
+    virtual void driver_screenshot_complete(Gfx::ShareableBitmap) override;
 };
 
 }
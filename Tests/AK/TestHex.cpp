@@ -59,3 +59,23 @@ TEST_CASE(should_constexpr_decode_hex_digit)
     static_assert(14u == decode_hex_digit('E'));
     static_assert(15u == decode_hex_digit('F'));
 }
+
+TEST_CASE(should_encode_hex)
+{
+    EXPECT_EQ(encode_hex({}), ""sv);
+
+    u8 const bytes[] = { 0x00, 0x01, 0x7f, 0x80, 0xab, 0xcd, 0xef, 0xff };
+    EXPECT_EQ(encode_hex(bytes), "00017f80abcdefff"sv);
+}
+
+TEST_CASE(should_decode_hex)
+{
+    auto decoded = TRY_OR_FAIL(decode_hex("00017F80abCDefFF"sv));
+    u8 const expected[] = { 0x00, 0x01, 0x7f, 0x80, 0xab, 0xcd, 0xef, 0xff };
+    EXPECT_EQ(decoded.bytes(), ReadonlyBytes { expected });
+
+    EXPECT(TRY_OR_FAIL(decode_hex(""sv)).is_empty());
+    EXPECT(decode_hex("abc"sv).is_error());
+    EXPECT(decode_hex("0g"sv).is_error());
+    EXPECT(decode_hex("g0"sv).is_error());
+}
@@ -69,6 +69,39 @@ TEST_CASE(json_string)
     EXPECT_EQ(json.as_string() == "A", true);
 }
 
+TEST_CASE(json_long_string)
+{
+    auto json = JsonValue::from_string("\"this string is longer than sixteen bytes, and has 🤓 in it\""sv).value();
+    EXPECT_EQ(json.type(), JsonValue::Type::String);
+    EXPECT_EQ(json.as_string(), "this string is longer than sixteen bytes, and has 🤓 in it"sv);
+
+    json = JsonValue::from_string("\"this string is longer than sixteen bytes\\nand has escapes\\t\\\"in it\\\"\""sv).value();
+    EXPECT_EQ(json.type(), JsonValue::Type::String);
+    EXPECT_EQ(json.as_string(), "this string is longer than sixteen bytes\nand has escapes\t\"in it\""sv);
+
+    EXPECT(JsonValue::from_string("\"this string is longer than sixteen bytes\nbut has a raw newline\""sv).is_error());
+    EXPECT(JsonValue::from_string("\"this string is longer than sixteen bytes, but never ends"sv).is_error());
+}
+
+TEST_CASE(json_parse_integer_limits)
+{
+    auto json = JsonValue::from_string("18446744073709551615"sv).value();
+    EXPECT(json.is_integer<u64>());
+    EXPECT_EQ(json.as_integer<u64>(), NumericLimits<u64>::max());
+
+    json = JsonValue::from_string("-9223372036854775808"sv).value();
+    EXPECT(json.is_integer<i64>());
+    EXPECT_EQ(json.as_integer<i64>(), NumericLimits<i64>::min());
+
+    json = JsonValue::from_string("18446744073709551616"sv).value();
+    EXPECT(json.as_number().has<double>());
+    EXPECT_EQ(json.as_number().get<double>(), 18446744073709551616.0);
+
+    json = JsonValue::from_string("-9223372036854775809"sv).value();
+    EXPECT(json.as_number().has<double>());
+    EXPECT_EQ(json.as_number().get<double>(), -9223372036854775809.0);
+}
+
 TEST_CASE(json_utf8_character)
 {
     auto json = JsonValue::from_string("\"\\u0041\""sv).value();
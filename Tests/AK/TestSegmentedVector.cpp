@@ -26,3 +26,20 @@ TEST_CASE(at)
     EXPECT_EQ(segmented_vector[1], 2);
     EXPECT_EQ(segmented_vector[2], 3);
 }
+
+TEST_CASE(take_last)
+{
+    AK::SegmentedVector<int, 2> segmented_vector;
+    segmented_vector.append(1);
+    segmented_vector.append(2);
+    segmented_vector.append(3);
+    EXPECT_EQ(segmented_vector.take_last(), 3);
+    EXPECT_EQ(segmented_vector.take_last(), 2);
+    EXPECT_EQ(segmented_vector.size(), 1u);
+    EXPECT_EQ(segmented_vector.last(), 1);
+    segmented_vector.append(4);
+    segmented_vector.append(5);
+    EXPECT_EQ(segmented_vector.size(), 3u);
+    EXPECT_EQ(segmented_vector[1], 4);
+    EXPECT_EQ(segmented_vector.last(), 5);
+}
@@ -588,3 +588,22 @@ TEST_CASE(code_point_at)
     test(u"😀"sv, 1);
     test(u"hello 😀 there!"sv, 14);
 }
+
+TEST_CASE(utf16_string_builder)
+{
+    StringBuilder builder(StringBuilder::Mode::UTF16);
+    builder.ensure_capacity(1024);
+
+    builder.append("hello "sv);
+    builder.append("😀 "sv);
+    builder.append(u"wörld"sv);
+    builder.append(" \xff!"sv);
+
+    auto string = builder.to_utf16_string();
+    EXPECT_EQ(string, u"hello 😀 wörld �!"sv);
+
+    StringBuilder surrogate_builder(StringBuilder::Mode::UTF16);
+    surrogate_builder.append(Utf16View { u"\xd83d"sv });
+    surrogate_builder.append(Utf16View { u"\xde00"sv });
+    EXPECT_EQ(surrogate_builder.to_utf16_string(), u"😀"sv);
+}
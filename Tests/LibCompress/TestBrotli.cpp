@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Brotli.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(brotli_decompress_simple)
+{
+    Array<u8, 26> const compressed {
+        0x1B, 0x1C, 0x00, 0xF8, 0x25, 0x53, 0x74, 0xC2, 0x5A, 0x90, 0x42, 0x1A,
+        0x91, 0x44, 0xC7, 0x80, 0xCE, 0x3D, 0x0A, 0xF1, 0x29, 0x5D, 0x02, 0xD0,
+        0x71, 0x00
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto decompressed = TRY_OR_FAIL(Compress::BrotliDecompressor::decompress_all(compressed));
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(brotli_decompress_stream)
+{
+    Array<u8, 26> const compressed {
+        0x1B, 0x1C, 0x00, 0xF8, 0x25, 0x53, 0x74, 0xC2, 0x5A, 0x90, 0x42, 0x1A,
+        0x91, 0x44, 0xC7, 0x80, 0xCE, 0x3D, 0x0A, 0xF1, 0x29, 0x5D, 0x02, 0xD0,
+        0x71, 0x00
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto stream = make<AllocatingMemoryStream>();
+    auto input = MaybeOwned<Stream> { *stream };
+    auto decompressor = TRY_OR_FAIL(Compress::BrotliDecompressor::create(move(input)));
+    TRY_OR_FAIL(stream->write_until_depleted(compressed));
+    auto decompressed = TRY_OR_FAIL(decompressor->read_until_eof());
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(brotli_decompress_truncated)
+{
+    Array<u8, 20> const compressed {
+        0x1B, 0x1C, 0x00, 0xF8, 0x25, 0x53, 0x74, 0xC2, 0x5A, 0x90, 0x42, 0x1A,
+        0x91, 0x44, 0xC7, 0x80, 0xCE, 0x3D, 0x0A, 0xF1
+    };
+
+    auto result = Compress::BrotliDecompressor::decompress_all(compressed);
+    EXPECT(result.is_error());
+}
+
+TEST_CASE(brotli_decompress_trailing_data)
+{
+    Array<u8, 27> const compressed {
+        0x1B, 0x1C, 0x00, 0xF8, 0x25, 0x53, 0x74, 0xC2, 0x5A, 0x90, 0x42, 0x1A,
+        0x91, 0x44, 0xC7, 0x80, 0xCE, 0x3D, 0x0A, 0xF1, 0x29, 0x5D, 0x02, 0xD0,
+        0x71, 0x00, 0x00
+    };
+
+    auto result = Compress::BrotliDecompressor::decompress_all(compressed);
+    EXPECT(result.is_error());
+}
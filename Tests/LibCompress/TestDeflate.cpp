@@ -155,3 +155,41 @@ TEST_CASE(deflate_compress_literals)
     Array<u8, 0x13> test { 0, 0, 0, 0, 0x72, 0, 0, 0xee, 0, 0, 0, 0x26, 0, 0, 0, 0x28, 0, 0, 0x72 };
     auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(test));
 }
+
+TEST_CASE(deflate_sync_flush)
+{
+    auto message = "Hello, friends! Hello, friends!"sv.bytes();
+
+    AllocatingMemoryStream compressed_stream;
+    auto compressor = TRY_OR_FAIL(Compress::DeflateCompressor::create(MaybeOwned<Stream> { compressed_stream }));
+
+    auto compress_message = [&]() -> ErrorOr<ByteBuffer> {
+        TRY(compressor->write_until_depleted(message));
+        TRY(compressor->sync_flush());
+
+        auto compressed = TRY(ByteBuffer::create_uninitialized(compressed_stream.used_buffer_size()));
+        TRY(compressed_stream.read_until_filled(compressed));
+        return compressed;
+    };
+
+    auto first_compressed = TRY_OR_FAIL(compress_message());
+    auto second_compressed = TRY_OR_FAIL(compress_message());
+
+    // A sync flush ends with an empty stored block.
+    Array<u8, 4> const empty_stored_block { 0x00, 0x00, 0xff, 0xff };
+    EXPECT(first_compressed.bytes().slice(first_compressed.size() - 4) == empty_stored_block.span());
+    EXPECT(second_compressed.bytes().slice(second_compressed.size() - 4) == empty_stored_block.span());
+
+    // The second message can refer back to the first one.
+    EXPECT(second_compressed.size() < first_compressed.size());
+
+    auto compressed = TRY_OR_FAIL(ByteBuffer::copy(first_compressed));
+    TRY_OR_FAIL(compressed.try_append(second_compressed));
+
+    auto decompressor = TRY_OR_FAIL(Compress::DeflateDecompressor::create(make<FixedMemoryStream>(compressed.bytes())));
+    auto uncompressed = TRY_OR_FAIL(ByteBuffer::create_uninitialized(message.size() * 2));
+    TRY_OR_FAIL(decompressor->read_until_filled(uncompressed));
+
+    EXPECT(uncompressed.bytes().slice(0, message.size()) == message);
+    EXPECT(uncompressed.bytes().slice(message.size()) == message);
+}
@@ -44,6 +44,37 @@ TEST_CASE(zlib_decompress_stream)
     EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
 }
 
+TEST_CASE(zlib_decompress_spans)
+{
+    Array<u8, 40> const compressed {
+        0x78, 0x01, 0x01, 0x1D, 0x00, 0xE2, 0xFF, 0x54, 0x68, 0x69, 0x73, 0x20,
+        0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20,
+        0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x3A, 0x29,
+        0x99, 0x5E, 0x09, 0xE8
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto decompressor = TRY_OR_FAIL(Compress::ZlibDecompressor::create(MaybeOwned<Stream> { make<AllocatingMemoryStream>() }));
+
+    // Feed the input in small pieces, into an output buffer that's too small to hold all of it at once.
+    Array<u8, 64> decompressed {};
+    size_t decompressed_size = 0;
+    ReadonlyBytes input = compressed;
+    while (!input.is_empty()) {
+        auto piece = input.trim(7);
+        auto output = decompressed.span().slice(decompressed_size, 10);
+        auto result = TRY_OR_FAIL(decompressor->decompress_some(piece, output));
+        EXPECT(result.input_bytes_consumed != 0 || result.output_bytes_produced != 0);
+        input = input.slice(result.input_bytes_consumed);
+        decompressed_size += result.output_bytes_produced;
+    }
+
+    EXPECT_EQ(decompressed_size, sizeof(uncompressed) - 1);
+    EXPECT(decompressed.span().trim(decompressed_size) == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+    EXPECT(decompressor->is_eof());
+}
+
 TEST_CASE(zlib_round_trip_simple_default)
 {
     u8 const uncompressed[] = "This is a simple text file :)";
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCompress/Zstd.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(zstd_decompress_simple)
+{
+    Array<u8, 42> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x1D, 0xE9, 0x00, 0x00, 0x54, 0x68, 0x69,
+        0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C,
+        0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+        0x3A, 0x29, 0xFA, 0x56, 0xB6, 0xC7
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(zstd_decompress_multiple_frames)
+{
+    Array<u8, 38> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x04, 0x58, 0x31, 0x00, 0x00, 0x61, 0x62, 0x63,
+        0x61, 0x62, 0x63, 0xE6, 0x41, 0x5F, 0xB1, 0x28, 0xB5, 0x2F, 0xFD, 0x04,
+        0x58, 0x31, 0x00, 0x00, 0x61, 0x62, 0x63, 0x61, 0x62, 0x63, 0xE6, 0x41,
+        0x5F, 0xB1
+    };
+
+    u8 const uncompressed[] = "abcabcabcabc";
+
+    auto decompressed = TRY_OR_FAIL(Compress::ZstdDecompressor::decompress_all(compressed));
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
+TEST_CASE(zstd_decompress_spans)
+{
+    Array<u8, 42> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x1D, 0xE9, 0x00, 0x00, 0x54, 0x68, 0x69,
+        0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C,
+        0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+        0x3A, 0x29, 0xFA, 0x56, 0xB6, 0xC7
+    };
+
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto decompressor = TRY_OR_FAIL(Compress::ZstdDecompressor::create(MaybeOwned<Stream> { make<AllocatingMemoryStream>() }));
+
+    Array<u8, 64> decompressed {};
+    size_t decompressed_size = 0;
+    ReadonlyBytes input = compressed;
+    while (!input.is_empty()) {
+        auto result = TRY_OR_FAIL(decompressor->decompress_some(input.trim(5), decompressed.span().slice(decompressed_size, 10)));
+        EXPECT(result.input_bytes_consumed != 0 || result.output_bytes_produced != 0);
+        input = input.slice(result.input_bytes_consumed);
+        decompressed_size += result.output_bytes_produced;
+    }
+
+    EXPECT(decompressed.span().trim(decompressed_size) == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+    EXPECT(decompressor->is_eof());
+}
+
+TEST_CASE(zstd_decompress_truncated)
+{
+    Array<u8, 30> const compressed {
+        0x28, 0xB5, 0x2F, 0xFD, 0x24, 0x1D, 0xE9, 0x00, 0x00, 0x54, 0x68, 0x69,
+        0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C,
+        0x65, 0x20, 0x74, 0x65, 0x78, 0x74
+    };
+
+    auto result = Compress::ZstdDecompressor::decompress_all(compressed);
+    EXPECT(result.is_error());
+}
@@ -209,6 +209,40 @@ TEST_CASE(test_unsigned_bigint_base10_to_string)
     EXPECT_EQ(result, "57195071295721390579057195715793");
 }
 
+TEST_CASE(test_unsigned_bigint_large_base10_string_roundtrip)
+{
+    StringBuilder builder;
+    builder.append('9');
+    for (size_t i = 0; i < 2000; ++i)
+        builder.append("00000123456789"sv);
+    auto string = builder.to_byte_string();
+
+    auto bigint = TRY_OR_FAIL(Crypto::UnsignedBigInteger::from_base(10, string));
+    auto result = MUST(bigint.to_base(10));
+    EXPECT_EQ(result.bytes_as_string_view(), string.view());
+
+    auto power_of_ten = Crypto::UnsignedBigInteger { 10 }.pow(28000);
+    auto low_digits = TRY_OR_FAIL(Crypto::UnsignedBigInteger::from_base(10, string.substring_view(1)));
+    EXPECT_EQ(power_of_ten.multiplied_by(Crypto::UnsignedBigInteger { 9 }).plus(low_digits), bigint);
+    EXPECT_EQ(MUST(power_of_ten.to_base(10)).bytes().size(), 28001u);
+
+    EXPECT_EQ(Crypto::UnsignedBigInteger::from_base(10, ByteString::formatted("{}A{}", string, string)).is_error(), true);
+}
+
+TEST_CASE(test_signed_bigint_large_base16_string_roundtrip)
+{
+    StringBuilder builder;
+    builder.append("-f"sv);
+    for (size_t i = 0; i < 4000; ++i)
+        builder.append("0123456789abcdef"sv);
+    auto string = builder.to_byte_string();
+
+    auto bigint = TRY_OR_FAIL(Crypto::SignedBigInteger::from_base(16, string));
+    EXPECT(bigint.is_negative());
+    auto result = MUST(bigint.to_base(16));
+    EXPECT_EQ(result.bytes_as_string_view(), string.view());
+}
+
 TEST_CASE(test_bigint_import_big_endian_decode_encode_roundtrip)
 {
     u8 random_bytes[128];
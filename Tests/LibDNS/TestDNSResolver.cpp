@@ -102,3 +102,65 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+TEST_CASE(test_negative_caching)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            Core::SocketAddress addr = { IPv4Address::from_string("1.1.1.1"sv).value(), static_cast<u16>(53) };
+            return DNS::Resolver::SocketResult {
+                TRY(Core::BufferedSocket<Core::UDPSocket>::create(TRY(Core::UDPSocket::connect(addr)))),
+                DNS::Resolver::ConnectionMode::UDP,
+            };
+        }
+    };
+
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    resolver.lookup("does-not-exist.invalid", DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })
+        ->when_resolved([&](auto& result) {
+            EXPECT(result->records().is_empty());
+
+            auto cached_result = resolver.lookup_in_cache("does-not-exist.invalid"sv);
+            EXPECT(cached_result);
+            EXPECT(cached_result && cached_result->is_negative());
+            loop.quit(0);
+        })
+        .when_rejected([&](auto& error) {
+            outln("Failed to resolve: {}", error);
+            loop.quit(1);
+        });
+
+    EXPECT_EQ(0, loop.exec());
+}
+
+TEST_CASE(test_lookup_addresses)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            Core::SocketAddress addr = { IPv4Address::from_string("1.1.1.1"sv).value(), static_cast<u16>(53) };
+            return DNS::Resolver::SocketResult {
+                TRY(Core::BufferedSocket<Core::UDPSocket>::create(TRY(Core::UDPSocket::connect(addr)))),
+                DNS::Resolver::ConnectionMode::UDP,
+            };
+        }
+    };
+
+    TRY_OR_FAIL(resolver.when_socket_ready()->await());
+
+    resolver.lookup_addresses("google.com")
+        ->when_resolved([&](auto& result) {
+            EXPECT(!result->cached_addresses().is_empty());
+            loop.quit(0);
+        })
+        .when_rejected([&](auto& error) {
+            outln("Failed to resolve: {}", error);
+            loop.quit(1);
+        });
+
+    EXPECT_EQ(0, loop.exec());
+}
@@ -0,0 +1,33 @@
+// Creating closures, and calling them through variables captured from enclosing scopes.
+
+function makeCounter(start) {
+    let count = start;
+    return {
+        increment: () => ++count,
+        get: () => count,
+    };
+}
+
+function makeAdder(amount) {
+    return value => value + amount;
+}
+
+function compose(...functions) {
+    return value => functions.reduceRight((accumulator, func) => func(accumulator), value);
+}
+
+let total = 0;
+for (let i = 0; i < 20000; ++i) {
+    const counter = makeCounter(i);
+    for (let j = 0; j < 10; ++j) counter.increment();
+    const addAll = compose(makeAdder(1), makeAdder(2), makeAdder(3));
+    total += addAll(counter.get());
+}
+
+const callbacks = [];
+for (let i = 0; i < 1000; ++i) callbacks.push(() => i);
+for (let i = 0; i < 100; ++i) {
+    for (const callback of callbacks) total += callback();
+}
+
+if (total !== 250260000) throw new Error(`Unexpected total ${total}`);
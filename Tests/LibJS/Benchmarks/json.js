@@ -0,0 +1,29 @@
+// Serializing object graphs with JSON.stringify(), and parsing the result back with JSON.parse().
+
+const items = [];
+for (let i = 0; i < 500; ++i) {
+    items.push({
+        id: i,
+        name: `Item number ${i}`,
+        price: i * 1.25,
+        tags: ["a", "b", "c"].slice(0, (i % 3) + 1),
+        available: i % 2 === 0,
+        dimensions: { width: i, height: i * 2, depth: null },
+    });
+}
+const document = { version: 1, items };
+
+let total = 0;
+for (let i = 0; i < 30; ++i) {
+    const json = JSON.stringify(document);
+    total += json.length;
+    const parsed = JSON.parse(json);
+    total += parsed.items.length;
+
+    const pretty = JSON.stringify(document, null, 2);
+    total += pretty.length;
+    const revived = JSON.parse(pretty, (key, value) => (key === "price" ? Math.round(value) : value));
+    total += revived.items[revived.items.length - 1].price;
+}
+
+if (total !== 5931570) throw new Error(`Unexpected total ${total}`);
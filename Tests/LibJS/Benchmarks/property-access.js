@@ -0,0 +1,64 @@
+// Gets and puts of named properties, on objects of a single shape, of a few shapes, and of too many shapes to cache.
+
+class Point {
+    constructor(x, y) {
+        this.x = x;
+        this.y = y;
+    }
+
+    get lengthSquared() {
+        return this.x * this.x + this.y * this.y;
+    }
+}
+
+function sumMonomorphic(points) {
+    let sum = 0;
+    for (const point of points) sum += point.x + point.y + point.lengthSquared;
+    return sum;
+}
+
+function sumPolymorphic(objects) {
+    let sum = 0;
+    for (const object of objects) sum += object.value;
+    return sum;
+}
+
+function bumpAll(objects) {
+    for (const object of objects) object.value = object.value + 1;
+}
+
+const points = [];
+for (let i = 0; i < 1000; ++i) points.push(new Point(i, -i));
+
+const fewShapes = [];
+for (let i = 0; i < 1000; ++i) {
+    switch (i % 3) {
+        case 0:
+            fewShapes.push({ value: i });
+            break;
+        case 1:
+            fewShapes.push({ a: 0, value: i });
+            break;
+        default:
+            fewShapes.push({ a: 0, b: 0, value: i });
+    }
+}
+
+const manyShapes = [];
+for (let i = 0; i < 1000; ++i) {
+    const object = {};
+    object[`key${i % 32}`] = 0;
+    object.value = i;
+    manyShapes.push(object);
+}
+
+let total = 0;
+for (let i = 0; i < 100; ++i) {
+    total += sumMonomorphic(points);
+    total += sumPolymorphic(fewShapes);
+    total += sumPolymorphic(manyShapes);
+    bumpAll(fewShapes);
+    bumpAll(manyShapes);
+}
+
+if (total !== 66676500000) throw new Error(`Unexpected total ${total}`);
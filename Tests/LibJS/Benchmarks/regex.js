@@ -0,0 +1,25 @@
+// Matching, searching and replacing with regular expressions over a few kilobytes of text.
+
+const words = ["lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "2026-10-14", "user@example.com"];
+const lines = [];
+for (let i = 0; i < 500; ++i) lines.push(`${words[i % words.length]} ${words[(i * 7) % words.length]} ${i} ${words[(i * 3) % words.length]}`);
+const text = lines.join("\n");
+
+let total = 0;
+for (let i = 0; i < 20; ++i) {
+    total += text.match(/\b\d{4}-\d{2}-\d{2}\b/g).length;
+    total += text.match(/[\w.]+@[\w.]+\.\w+/g).length;
+    total += text.split(/\s+/).length;
+    total += text.replace(/(\w+) (\w+)/g, "$2 $1").length;
+    total += text.replaceAll(/o/g, "0").length;
+
+    let count = 0;
+    for (const line of lines) {
+        if (/^(lorem|ipsum)\b/.test(line)) ++count;
+    }
+    total += count;
+
+    for (const match of text.matchAll(/(?<word>[a-z]+) (?<number>\d+)/g)) total += match.groups.number.length;
+}
+
+if (total !== 650580) throw new Error(`Unexpected total ${total}`);
@@ -0,0 +1,23 @@
+// Building strings piece by piece with concatenation, template literals, Array.prototype.join() and repeat().
+
+let total = 0;
+for (let i = 0; i < 20; ++i) {
+    let concatenated = "";
+    for (let j = 0; j < 5000; ++j) concatenated += j;
+    total += concatenated.length;
+
+    let templated = "";
+    for (let j = 0; j < 2000; ++j) templated = `${templated}<li id="item-${j}">${j * 2}</li>`;
+    total += templated.length;
+
+    const parts = [];
+    for (let j = 0; j < 5000; ++j) parts.push(String.fromCharCode(97 + (j % 26)));
+    total += parts.join("").length;
+    total += parts.join(", ").length;
+
+    total += "abc".repeat(10000).length;
+    total += concatenated.indexOf("4999");
+    total += concatenated.slice(100, 200).toUpperCase().length;
+}
+
+if (total !== 2844180) throw new Error(`Unexpected total ${total}`);
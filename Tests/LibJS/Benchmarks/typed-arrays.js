@@ -0,0 +1,32 @@
+// Reading and writing typed arrays element by element, and with their built-in bulk operations.
+
+const length = 100000;
+const floats = new Float64Array(length);
+const bytes = new Uint8Array(length);
+const ints = new Int32Array(length);
+
+let total = 0;
+for (let i = 0; i < 10; ++i) {
+    for (let j = 0; j < length; ++j) {
+        floats[j] = j * 0.5;
+        bytes[j] = j;
+        ints[j] = j - length / 2;
+    }
+
+    let sum = 0;
+    for (let j = 0; j < length; ++j) sum += floats[j] + bytes[j] + ints[j];
+    total += sum;
+
+    const copy = bytes.slice();
+    copy.sort();
+    total += copy[length - 1];
+    total += ints.subarray(10, 20).reduce((accumulator, value) => accumulator + value, 0);
+    total += new DataView(floats.buffer).getFloat64(8, true);
+
+    ints.fill(1);
+    total += ints.indexOf(1);
+    floats.set(bytes, 0);
+    total += floats[length - 1];
+}
+
+if (total !== 25121678795) throw new Error(`Unexpected total ${total}`);
@@ -1186,6 +1186,106 @@ TEST_CASE(optimizer_alternation)
     }
 }
 
+TEST_CASE(lazy_dfa)
+{
+    Array tests {
+        // Pattern, Subject, Whether it matches anywhere
+        Tuple { "^\\/api\\/v\\d+\\/[a-z]+"sv, "/api/v12/users/42"sv, true },
+        Tuple { "^\\/api\\/v\\d+\\/[a-z]+"sv, "/api/v/users"sv, false },
+        Tuple { "^\\/api\\/v\\d+\\/[a-z]+"sv, "x/api/v1/users"sv, false },
+        Tuple { "error|warning"sv, "2026-10-14 12:00:00 [warning] disk almost full"sv, true },
+        Tuple { "error|warning"sv, "2026-10-14 12:00:00 [info] all good"sv, false },
+        Tuple { "a[bc]*d$"sv, "xxabcbcd"sv, true },
+        Tuple { "a[bc]*d$"sv, "xxabcbcdx"sv, false },
+        Tuple { "(foo|bar)?baz"sv, "foobaz"sv, true },
+        Tuple { "(foo|bar)?baz"sv, "fooba"sv, false },
+        Tuple { "x*"sv, ""sv, true },
+        Tuple { "^$"sv, ""sv, true },
+        Tuple { "^$"sv, "a"sv, false },
+        Tuple { "[^a-z]+"sv, "abc"sv, false },
+        Tuple { "[^a-z]+"sv, "abc1"sv, true },
+        Tuple { "."sv, "\n"sv, false },
+        Tuple { "\\d\\.\\d"sv, "version 1.2"sv, true },
+        // Not eligible for the DFA, these have to keep working through the VM.
+        Tuple { "(a)\\1"sv, "baab"sv, true },
+        Tuple { "a{3}"sv, "aab"sv, false },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>(), (ECMAScriptFlags)regex::AllFlags::Global);
+        EXPECT_EQ(re.has_match(test.get<1>()), test.get<2>());
+        EXPECT_EQ(re.match(test.get<1>()).success, test.get<2>());
+    }
+}
+
+TEST_CASE(literal_prefix)
+{
+    Regex<ECMA262> re("error: (\\w+)"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    EXPECT_EQ(re.parser_result.optimization_data.literal_prefix, "error: "sv);
+
+    auto check = [&](RegexResult const& result) {
+        EXPECT(result.success);
+        EXPECT_EQ(result.count, 2u);
+        EXPECT_EQ(result.matches.at(0).view, "error: disk"sv);
+        EXPECT_EQ(result.matches.at(0).column, 3u);
+        EXPECT_EQ(result.capture_group_matches.at(1).at(0).view, "memory"sv);
+    };
+
+    auto subject = "ok\nerror: disk\nwarning: cpu\nerror:error: memory error:"sv;
+    check(re.match(subject));
+
+    auto ascii_subject = Utf16String::from_utf8(subject);
+    check(re.match(Utf16View { ascii_subject }));
+
+    // Strings whose code units are stored as 16-bit values are searched differently.
+    auto utf16_subject = Utf16String::from_utf8("ok\nerror: disk\n\u00e9rror: cpu\nerror:error: memory error:"sv);
+    check(re.match(Utf16View { utf16_subject }));
+
+    EXPECT(!re.match("errors: none"sv).success);
+}
+
+TEST_CASE(failed_threads_across_start_positions)
+{
+    {
+        Regex<ECMA262> re("(a|a)*b"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+
+        auto subject = ByteString::repeated('a', 1000);
+        EXPECT(!re.match(subject.view()).success);
+
+        auto matching_subject = ByteString::formatted("{}b", subject);
+        auto result = re.match(matching_subject.view());
+        EXPECT(result.success);
+        EXPECT_EQ(result.matches.first().view.length(), 1001u);
+    }
+    {
+        // Threads that failed at one position have to be forgotten after a match, and by the next one.
+        Regex<ECMA262> re("a(b|c)*d"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+        auto result = re.match("abcbx abd acd abcbcb"sv);
+        EXPECT_EQ(result.count, 2u);
+        EXPECT_EQ(result.matches.at(0).view, "abd"sv);
+        EXPECT_EQ(result.matches.at(1).view, "acd"sv);
+    }
+    {
+        // Backreferences make threads depend on the captures of the ones before them.
+        Regex<ECMA262> re("(a|b)\\1"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+        EXPECT(!re.parser_result.optimization_data.failed_threads_stay_failed);
+        EXPECT_EQ(re.match("abba"sv).matches.first().view, "bb"sv);
+    }
+}
+
+TEST_CASE(cached_parse_results)
+{
+    // Patterns parsed ahead of time share the optimized result of the first one.
+    for (size_t i = 0; i < 3; ++i) {
+        Regex<ECMA262> re(Regex<ECMA262>::parse_pattern("ca+ched"sv, ECMAScriptFlags::Global), "ca+ched", ECMAScriptFlags::Global);
+        EXPECT_EQ(re.parser_result.error, regex::Error::NoError);
+        EXPECT_EQ(re.match("not caaached yet"sv).matches.first().view, "caaached"sv);
+    }
+
+    Regex<ECMA262> re("ca+ched", ECMAScriptFlags::Global);
+    EXPECT_EQ(re.match("not caaached yet"sv).matches.first().view, "caaached"sv);
+}
+
 TEST_CASE(start_anchor)
 {
     // Ensure that a circumflex at the start only matches the start of the line.
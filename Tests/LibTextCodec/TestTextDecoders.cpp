@@ -48,3 +48,41 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_utf16be_decode_unpaired_surrogate)
+{
+    auto decoder = TextCodec::UTF16BEDecoder();
+    auto test_string = "\x00s\xd8=\x00k"sv;
+
+    EXPECT(!decoder.validate(test_string));
+    auto utf8 = MUST(decoder.to_utf8(test_string));
+    EXPECT_EQ(utf8, "s�k"sv);
+}
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    auto test_string = "This is plain ASCII, then s\xe4k and \xff\x80"sv;
+
+    auto utf8 = MUST(decoder.to_utf8(test_string));
+    EXPECT_EQ(utf8, "This is plain ASCII, then säk and ÿ\u0080"sv);
+}
+
+TEST_CASE(test_single_byte_decode)
+{
+    auto decoder = TextCodec::decoder_for("windows-1252"sv);
+    EXPECT(decoder.has_value());
+
+    EXPECT_EQ(MUST(decoder->to_utf8("only ASCII in this rather long string"sv)), "only ASCII in this rather long string"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("\x80"sv)), "€"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("A string that is longer than sixteen bytes costs \x80\x35, or \x80\x80\x39 \x93quoted\x94"sv)),
+        "A string that is longer than sixteen bytes costs €5, or €€9 “quoted”"sv);
+}
+
+TEST_CASE(test_x_user_defined_decode)
+{
+    auto decoder = TextCodec::decoder_for("x-user-defined"sv);
+    EXPECT(decoder.has_value());
+
+    EXPECT_EQ(MUST(decoder->to_utf8("abc\x80\xff"sv)), "abc\uf780\uf7ff"sv);
+}
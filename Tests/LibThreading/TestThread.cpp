@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/FlyString.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
 #include <LibCore/System.h>
 #include <LibTest/TestCase.h>
 #include <LibThreading/Thread.h>
@@ -71,3 +74,34 @@ TEST_CASE(join_dead_thread)
     auto join_result = TRY_OR_FAIL(thread->join<int*>());
     EXPECT_EQ(join_result, static_cast<int*>(0));
 }
+
+TEST_CASE(threads_can_intern_the_same_fly_strings)
+{
+    static constexpr auto thread_count = 8;
+    static constexpr auto iteration_count = 10'000;
+    static constexpr Array strings { "thisisdefinitelymorethan7bytes"sv, "thisisalsoforsuremorethan7bytes"sv, "andsoisthisone,too"sv };
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (auto i = 0; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct([]() {
+            for (auto j = 0; j < iteration_count; ++j) {
+                auto string = strings[j % strings.size()];
+                auto fly_string = MUST(FlyString::from_utf8(string));
+                auto copy = fly_string;
+                if (fly_string != string || copy != fly_string)
+                    return 1;
+            }
+            return 0;
+        });
+        thread->start();
+        threads.append(move(thread));
+    }
+
+    for (auto& thread : threads) {
+        auto join_result = TRY_OR_FAIL(thread->join<int*>());
+        EXPECT_EQ(join_result, static_cast<int*>(0));
+    }
+
+    // Every fly string was dropped again, so they must all be gone from the table.
+    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+}
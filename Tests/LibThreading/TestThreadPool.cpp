@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Time.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+using namespace AK::TimeLiterals;
+
+static void wait_until(Function<bool()> condition)
+{
+    static constexpr auto delay = 10_ms;
+
+    for (auto i = 0; i < 500; ++i) {
+        if (condition())
+            return;
+
+        (void)Core::System::sleep_ms(delay.to_milliseconds());
+    }
+
+    FAIL("Timed out waiting for the thread pool");
+}
+
+TEST_CASE(runs_all_jobs)
+{
+    Threading::ThreadPool pool { 4 };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> completed_job_count { 0 };
+    for (size_t i = 0; i < 1000; ++i)
+        pool.enqueue([&] { completed_job_count.fetch_add(1); });
+
+    wait_until([&] { return completed_job_count.load() == 1000; });
+}
+
+TEST_CASE(jobs_enqueued_by_a_busy_worker_are_stolen)
+{
+    Threading::ThreadPool pool { 2 };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> stolen_job_ran { false };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release_worker { false };
+
+    // The enqueued job goes onto the busy worker's own queue, so it can only run if the other worker steals it.
+    pool.enqueue([&] {
+        pool.enqueue([&] { stolen_job_ran.store(true); });
+        while (!release_worker.load())
+            (void)Core::System::sleep_ms(1);
+    });
+
+    wait_until([&] { return stolen_job_ran.load(); });
+    release_worker.store(true);
+}
+
+TEST_CASE(higher_priority_jobs_run_first)
+{
+    Threading::ThreadPool pool { 1 };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release_worker { false };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Threading::Mutex mutex;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<Threading::ThreadPool::Priority> order;
+
+    pool.enqueue([&] {
+        while (!release_worker.load())
+            (void)Core::System::sleep_ms(1);
+    });
+
+    for (auto priority : { Threading::ThreadPool::Priority::Low, Threading::ThreadPool::Priority::Normal, Threading::ThreadPool::Priority::High }) {
+        pool.enqueue([&, priority] {
+            Threading::MutexLocker locker(mutex);
+            order.append(priority);
+        },
+            priority);
+    }
+
+    release_worker.store(true);
+    wait_until([&] {
+        Threading::MutexLocker locker(mutex);
+        return order.size() == 3;
+    });
+
+    EXPECT_EQ(order[0], Threading::ThreadPool::Priority::High);
+    EXPECT_EQ(order[1], Threading::ThreadPool::Priority::Normal);
+    EXPECT_EQ(order[2], Threading::ThreadPool::Priority::Low);
+}
+
+TEST_CASE(canceled_jobs_do_not_run)
+{
+    Threading::ThreadPool pool { 1 };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release_worker { false };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> canceled_job_ran { false };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> last_job_ran { false };
+
+    pool.enqueue([&] {
+        while (!release_worker.load())
+            (void)Core::System::sleep_ms(1);
+    });
+
+    auto job = pool.enqueue([&] { canceled_job_ran.store(true); });
+    job->cancel();
+    EXPECT(job->is_canceled());
+
+    pool.enqueue([&] { last_job_ran.store(true); }, Threading::ThreadPool::Priority::Low);
+
+    release_worker.store(true);
+    wait_until([&] { return last_job_ran.load(); });
+    EXPECT(!canceled_job_ran.load());
+}
+
+TEST_CASE(workers_restart_after_shutdown)
+{
+    Threading::ThreadPool pool { 2 };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> completed_job_count { 0 };
+
+    pool.enqueue([&] { completed_job_count.fetch_add(1); });
+    wait_until([&] { return completed_job_count.load() == 1; });
+
+    pool.shutdown();
+
+    pool.enqueue([&] { completed_job_count.fetch_add(1); });
+    wait_until([&] { return completed_job_count.load() == 2; });
+}
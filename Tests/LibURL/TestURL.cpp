@@ -709,3 +709,45 @@ TEST_CASE(same_site)
     EXPECT(!site1_https_url.origin().is_same_site(site1_http_url.origin()));
     EXPECT(!site1_https_url.origin().is_same_site(site2_https_url.origin()));
 }
+
+TEST_CASE(canonical_special_urls)
+{
+    struct TestCase {
+        StringView input;
+        StringView serialized;
+    };
+
+    // NOTE: Some of these take the fast path for already serialized URLs through the parser, and the rest have to fall
+    //       back to the full parser. Both have to agree on what the URL is.
+    static constexpr Array test_cases {
+        TestCase { "https://ladybird.org"sv, "https://ladybird.org/"sv },
+        TestCase { "https://ladybird.org:443/"sv, "https://ladybird.org/"sv },
+        TestCase { "https://ladybird.org:0443/"sv, "https://ladybird.org/"sv },
+        TestCase { "http://ladybird.org:8080/"sv, "http://ladybird.org:8080/"sv },
+        TestCase { "ws://ladybird.org:80?"sv, "ws://ladybird.org/?"sv },
+        TestCase { "wss://ladybird.org#"sv, "wss://ladybird.org/#"sv },
+        TestCase { "http://ladybird.org//a//b/"sv, "http://ladybird.org//a//b/"sv },
+        TestCase { "http://ladybird.org/a/%2e/b/%2E%2e/c"sv, "http://ladybird.org/a/c"sv },
+        TestCase { "http://ladybird.org/a/./b/../c?d=e#f"sv, "http://ladybird.org/a/c?d=e#f"sv },
+        TestCase { "http://ladybird.org/%41?%41#%41"sv, "http://ladybird.org/%41?%41#%41"sv },
+        TestCase { "http://ladybird.org/a'b?c'd#e'f"sv, "http://ladybird.org/a'b?c%27d#e'f"sv },
+        TestCase { "http://ladybird.org/a^b?c^d#e`f"sv, "http://ladybird.org/a%5Eb?c^d#e%60f"sv },
+        TestCase { "http://ladybird.org/a\\b"sv, "http://ladybird.org/a/b"sv },
+        TestCase { "http://LadyBird.org/"sv, "http://ladybird.org/"sv },
+        TestCase { "http://ladybird.org:/"sv, "http://ladybird.org/"sv },
+        TestCase { "http://192.168.0.1/"sv, "http://192.168.0.1/"sv },
+        TestCase { "http://0x7f.1/"sv, "http://127.0.0.1/"sv },
+        TestCase { "http://ladybird.org/ a"sv, "http://ladybird.org/%20a"sv },
+        TestCase { "https://ladybird.org/a#b#c"sv, "https://ladybird.org/a#b#c"sv },
+        TestCase { "httpss://ladybird.org/"sv, "httpss://ladybird.org/"sv },
+    };
+
+    for (auto const& test_case : test_cases) {
+        auto url = URL::Parser::basic_parse(test_case.input);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->serialize(), test_case.serialized);
+    }
+
+    EXPECT(!URL::Parser::basic_parse("http://ladybird.org:65536/"sv).has_value());
+    EXPECT(!URL::Parser::basic_parse("http://1.2.3.256/"sv).has_value());
+}
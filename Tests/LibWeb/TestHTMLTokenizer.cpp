@@ -251,6 +251,59 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html, 23u, 27u);
 }
 
+TEST_CASE(long_text)
+{
+    auto text = ByteString::repeated('x', 1000);
+    auto tokens = run_tokenizer(ByteString::formatted("<p>{}</p>", text));
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 2u);
+    for (auto c : text.view()) {
+        EXPECT_CHARACTER_TOKEN(c);
+    }
+    EXPECT_END_TAG_TOKEN(p, 1005u, 1006u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(text_with_carriage_returns_and_nulls)
+{
+    auto tokens = run_tokenizer("a\r\nb\rc\0d"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_CHARACTER_TOKEN('a');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_CHARACTER_TOKEN('b');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_CHARACTER_TOKEN('c');
+    EXPECT_CHARACTER_TOKEN('\0');
+    EXPECT_CHARACTER_TOKEN('d');
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(long_attribute_value)
+{
+    auto value = ByteString::repeated('y', 300);
+    auto tokens = run_tokenizer(ByteString::formatted("<p foo=\"{}\">", value));
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 309u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(1);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(foo, value.view(), 3u, 6u, 7u, 309u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(attribute_value_with_carriage_returns_and_nulls)
+{
+    auto tokens = run_tokenizer("<p foo=\"a\r\nb\0c\" bar='d\re'>"sv);
+    BEGIN_ENUMERATION(tokens);
+    NEXT_TOKEN();
+    EXPECT_EQ(last_token->type(), Token::Type::StartTag);
+    EXPECT_EQ(last_token->raw_attribute("foo"_fly_string)->value, "a\nb\uFFFDc"sv);
+    EXPECT_EQ(last_token->raw_attribute("bar"_fly_string)->value, "d\ne"sv);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
@@ -39,6 +39,8 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(test_dry_run, "List the tests that would be run, without running them", "dry-run");
     args_parser.add_option(rebaseline, "Rebaseline any executed layout or text tests", "rebaseline");
     args_parser.add_option(per_test_timeout_in_seconds, "Per-test timeout (default: 30)", "per-test-timeout", 't', "seconds");
+    args_parser.add_option(benchmark_pages_path, "Instead of running tests, benchmark loading the pages listed in the given file", "benchmark", 0, "path");
+    args_parser.add_option(benchmark_iterations, "Number of times to load each benchmarked page (default: 5)", "benchmark-iterations", 0, "count");
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
@@ -43,6 +43,9 @@ public:
 
     int per_test_timeout_in_seconds { 30 };
 
+    ByteString benchmark_pages_path;
+    size_t benchmark_iterations { 5 };
+
     u8 verbosity { 0 };
 };
 
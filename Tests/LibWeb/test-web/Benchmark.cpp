@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "Benchmark.h"
+#include "Application.h"
+#include "TestWebView.h"
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/Timer.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibURL/URL.h>
+
+namespace TestWeb {
+
+static String report_phase_timings_once_settled = R"(
+document.fonts.ready.then(() => {
+    requestAnimationFrame(() => {
+        requestAnimationFrame(() => {
+            internals.signalTestIsDone(JSON.stringify(internals.phaseTimings()));
+        });
+    });
+});
+)"_string;
+
+static String reset_phase_timings = "internals.resetPhaseTimings();"_string;
+
+static ErrorOr<Vector<URL::URL>> read_benchmark_pages(ByteString const& path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    auto directory = LexicalPath { TRY(FileSystem::real_path(path)) }.parent();
+    Vector<URL::URL> pages;
+
+    for (auto line : StringView { contents }.split_view('\n')) {
+        line = line.trim_whitespace();
+        if (line.is_empty() || line.starts_with('#'))
+            continue;
+
+        auto page_path = LexicalPath::absolute_path(directory.string(), line);
+        auto url = URL::create_with_file_scheme(TRY(FileSystem::real_path(page_path)));
+        if (!url.has_value())
+            return Error::from_string_literal("Unable to create a URL for a benchmark page");
+
+        pages.append(url.release_value());
+    }
+
+    if (pages.is_empty())
+        return Error::from_string_literal("No benchmark pages found");
+    return pages;
+}
+
+// Loads the page once, and returns the phase timings of that load, or an error if the page timed out or crashed.
+static ErrorOr<JsonObject> load_page_once(TestWebView& view, URL::URL const& url, int timeout_in_milliseconds)
+{
+    Optional<ErrorOr<JsonObject>> result;
+    auto load_start = MonotonicTime::now();
+
+    auto timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [&]() {
+        result = Error::from_string_literal("Page load timed out");
+    });
+
+    view.on_web_content_crashed = [&]() {
+        result = Error::from_string_literal("WebContent crashed");
+    };
+
+    view.on_load_finish = [&](auto const& loaded_url) {
+        if (loaded_url.equals(URL::about_blank())) {
+            // NOTE: The timings are reset from the blank page, so that they only cover loading and rendering the page
+            //       itself. Both messages are handled in order, so the reset happens before the page starts loading.
+            view.run_javascript(reset_phase_timings);
+            load_start = MonotonicTime::now();
+            view.load(url);
+            return;
+        }
+
+        // We don't want subframe loads to report the timings.
+        if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            return;
+
+        view.run_javascript(report_phase_timings_once_settled);
+    };
+
+    view.on_test_finish = [&](auto const& text) {
+        auto wall_time = MonotonicTime::now() - load_start;
+
+        auto timings = JsonValue::from_string(text);
+        if (timings.is_error() || !timings.value().is_object()) {
+            result = Error::from_string_literal("Unable to parse the page's phase timings");
+            return;
+        }
+
+        auto object = timings.value().as_object();
+        object.set("wallTime"sv, static_cast<double>(wall_time.to_nanoseconds()) / 1'000'000.0);
+        result = move(object);
+    };
+
+    view.load(URL::about_blank());
+    timer->start();
+
+    Core::EventLoop::current().spin_until([&]() { return result.has_value(); });
+    timer->stop();
+
+    view.on_web_content_crashed = {};
+    view.on_load_finish = {};
+    view.on_test_finish = {};
+
+    return result.release_value();
+}
+
+ErrorOr<int> run_page_load_benchmark(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size)
+{
+    auto& app = Application::the();
+    auto pages = TRY(read_benchmark_pages(app.benchmark_pages_path));
+
+    // NOTE: Pages are loaded one at a time, so that they don't compete with each other for the CPU.
+    auto view = TestWebView::create(theme, window_size);
+
+    bool loaded_initial_page = false;
+    view->on_load_finish = [&](auto const&) { loaded_initial_page = true; };
+    Core::EventLoop::current().spin_until([&]() { return loaded_initial_page; });
+
+    size_t failure_count = 0;
+    JsonArray results;
+
+    for (auto const& url : pages) {
+        JsonArray runs;
+
+        for (size_t iteration = 0; iteration < app.benchmark_iterations; ++iteration) {
+            auto timings = load_page_once(*view, url, app.per_test_timeout_in_seconds * 1000);
+            if (timings.is_error()) {
+                warnln("{}: {}", url, timings.error());
+                ++failure_count;
+                continue;
+            }
+
+            runs.must_append(timings.release_value());
+        }
+
+        JsonObject page;
+        page.set("url"sv, url.serialize());
+        page.set("runs"sv, move(runs));
+        results.must_append(move(page));
+    }
+
+    JsonObject report;
+    report.set("iterations"sv, app.benchmark_iterations);
+    report.set("pages"sv, move(results));
+    outln("{}", report.serialized());
+
+    return failure_count;
+}
+
+}
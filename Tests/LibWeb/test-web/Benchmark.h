@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibWeb/PixelUnits.h>
+
+namespace TestWeb {
+
+// Loads each page listed in the application's benchmark file a number of times, and prints how long each load spent in
+// each phase of loading and rendering the page as JSON.
+ErrorOr<int> run_page_load_benchmark(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size);
+
+}
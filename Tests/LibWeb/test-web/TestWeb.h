@@ -48,6 +48,11 @@ struct Test {
 
     UnixDateTime start_time {};
     UnixDateTime end_time {};
+
+    // The CPU time spent by the test's WebContent process while running the test, if it could be measured.
+    Optional<AK::Duration> cpu_time_at_start {};
+    Optional<AK::Duration> cpu_time {};
+
     size_t index { 0 };
 
     String text {};
@@ -24,6 +24,8 @@ public:
 
     void clear_content_filters();
 
+    pid_t web_content_pid() const { return client().pid(); }
+
     NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> take_screenshot();
 
     TestPromise& test_promise() { return *m_test_promise; }
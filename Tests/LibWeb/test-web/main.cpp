@@ -9,6 +9,7 @@
  */
 
 #include "Application.h"
+#include "Benchmark.h"
 #include "TestWeb.h"
 #include "TestWebView.h"
 
@@ -582,6 +583,21 @@ static void set_ui_callbacks_for_tests(TestWebView& view)
     };
 }
 
+static Optional<AK::Duration> web_content_cpu_time(TestWebView& view)
+{
+    auto& process_manager = Application::process_manager();
+    process_manager.update_all_process_statistics();
+
+    return process_manager.cpu_time_of_process(view.web_content_pid());
+}
+
+static ByteString format_cpu_time(Test const& test)
+{
+    if (!test.cpu_time.has_value())
+        return {};
+    return ByteString::formatted(" (CPU: {}ms)", test.cpu_time->to_milliseconds());
+}
+
 static ErrorOr<int> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size)
 {
     auto& app = Application::the();
@@ -673,6 +689,8 @@ static ErrorOr<int> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePix
 
             auto& test = tests[index];
             test.start_time = UnixDateTime::now();
+            if (app.verbosity >= Application::VERBOSITY_LEVEL_LOG_TEST_DURATION)
+                test.cpu_time_at_start = web_content_cpu_time(*view);
             test.index = index + 1;
 
             if (log_on_one_line) {
@@ -694,8 +712,12 @@ static ErrorOr<int> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePix
             result.test.end_time = UnixDateTime::now();
 
             if (app.verbosity >= Application::VERBOSITY_LEVEL_LOG_TEST_DURATION) {
+                // NOTE: If the WebContent process crashed, the view will have been given a new one by now.
+                if (auto cpu_time = web_content_cpu_time(*view); cpu_time.has_value() && result.test.cpu_time_at_start.has_value() && *cpu_time >= *result.test.cpu_time_at_start)
+                    result.test.cpu_time = *cpu_time - *result.test.cpu_time_at_start;
+
                 auto duration = result.test.end_time - result.test.start_time;
-                outln("{}/{}: Finish {}: {}ms", result.test.index, tests.size(), result.test.relative_path, duration.to_milliseconds());
+                outln("{}/{}: Finish {}: {}ms{}", result.test.index, tests.size(), result.test.relative_path, duration.to_milliseconds(), format_cpu_time(result.test));
             }
 
             switch (result.result) {
@@ -759,7 +781,7 @@ static ErrorOr<int> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePix
         for (auto const& test : tests.span().trim(tests_to_print)) {
             auto duration = test.end_time - test.start_time;
 
-            outln("{}: {}ms", test.relative_path, duration.to_milliseconds());
+            outln("{}: {}ms{}", test.relative_path, duration.to_milliseconds(), format_cpu_time(test));
         }
     }
 
@@ -791,6 +813,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     auto const& browser_options = TestWeb::Application::browser_options();
     Web::DevicePixelSize window_size { browser_options.window_width, browser_options.window_height };
 
+    if (!app->benchmark_pages_path.is_empty())
+        return TestWeb::run_page_load_benchmark(theme, window_size);
+
     VERIFY(!app->test_root_path.is_empty());
 
     app->test_root_path = LexicalPath::absolute_path(TRY(FileSystem::current_working_directory()), app->test_root_path);
@@ -45,3 +45,29 @@ TEST_CASE(unicode_name)
     XML::Parser parser("<div 中文=\"\"></div>"sv);
     TRY_OR_FAIL(parser.parse());
 }
+
+TEST_CASE(listener_sees_elements_in_order)
+{
+    struct RecordingListener final : public XML::Listener {
+        virtual void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const& attributes) override
+        {
+            StringBuilder builder;
+            builder.appendff("<{}", name);
+            if (auto value = attributes.get("id"sv); value.has_value())
+                builder.appendff(" id={}", *value);
+            builder.append('>');
+            events.append(builder.to_byte_string());
+        }
+        virtual void element_end(XML::Name const& name) override { events.append(ByteString::formatted("</{}>", name)); }
+        virtual void text(StringView text) override { events.append(text); }
+
+        Vector<ByteString> events;
+    };
+
+    XML::Parser parser("<a><b id=\"1\">x</b><b id=\"2\"/><c><d>y</d></c></a>"sv);
+    RecordingListener listener;
+    TRY_OR_FAIL(parser.parse_with_listener(listener));
+
+    Vector<ByteString> expected { "<a>", "<b id=1>", "x", "</b>", "<b id=2>", "</b>", "<c>", "<d>", "y", "</d>", "</c>", "</a>" };
+    EXPECT_EQ(listener.events, expected);
+}
@@ -409,6 +409,48 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("dump-display-list");
     });
 
+    auto* dump_frame_timeline = new QAction("Dump Frame Timeline", this);
+    dump_frame_timeline->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(dump_frame_timeline);
+    QObject::connect(dump_frame_timeline, &QAction::triggered, this, [this] {
+        debug_request("dump-frame-timeline");
+    });
+
+    auto* dump_task_statistics = new QAction("Dump Task Statistics", this);
+    dump_task_statistics->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(dump_task_statistics);
+    QObject::connect(dump_task_statistics, &QAction::triggered, this, [this] {
+        debug_request("dump-task-statistics");
+    });
+
+    auto* start_js_sampling_profiler = new QAction("Start JavaScript Sampling Profiler", this);
+    start_js_sampling_profiler->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(start_js_sampling_profiler);
+    QObject::connect(start_js_sampling_profiler, &QAction::triggered, this, [this] {
+        debug_request("js-sampling-profiler", "start");
+    });
+
+    auto* stop_js_sampling_profiler = new QAction("Stop JavaScript Sampling Profiler", this);
+    stop_js_sampling_profiler->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(stop_js_sampling_profiler);
+    QObject::connect(stop_js_sampling_profiler, &QAction::triggered, this, [this] {
+        debug_request("js-sampling-profiler", "stop");
+    });
+
+    auto* start_js_instruction_profiler = new QAction("Start JavaScript Instruction Profiler", this);
+    start_js_instruction_profiler->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(start_js_instruction_profiler);
+    QObject::connect(start_js_instruction_profiler, &QAction::triggered, this, [this] {
+        debug_request("js-instruction-profiler", "start");
+    });
+
+    auto* stop_js_instruction_profiler = new QAction("Stop JavaScript Instruction Profiler", this);
+    stop_js_instruction_profiler->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(stop_js_instruction_profiler);
+    QObject::connect(stop_js_instruction_profiler, &QAction::triggered, this, [this] {
+        debug_request("js-instruction-profiler", "stop");
+    });
+
     auto* dump_style_sheets_action = new QAction("Dump &Style Sheets", this);
     dump_style_sheets_action->setIcon(load_icon_from_uri("resource://icons/16x16/filetype-css.png"sv));
     debug_menu->addAction(dump_style_sheets_action);
@@ -471,6 +513,29 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         }
     });
 
+    auto* dump_gc_heap_statistics_action = new QAction("Dump GC Heap Statistics", this);
+    debug_menu->addAction(dump_gc_heap_statistics_action);
+    QObject::connect(dump_gc_heap_statistics_action, &QAction::triggered, this, [this] {
+        if (m_current_tab) {
+            auto statistics_path = m_current_tab->view().dump_gc_heap_statistics();
+            warnln("\033[33;1mDumped GC heap statistics into {}"
+                   "\033[0m",
+                statistics_path);
+        }
+    });
+
+    auto* start_gc_allocation_sampling_action = new QAction("Start Sampling GC Allocations", this);
+    debug_menu->addAction(start_gc_allocation_sampling_action);
+    QObject::connect(start_gc_allocation_sampling_action, &QAction::triggered, this, [this] {
+        debug_request("js-allocation-sampler", "start");
+    });
+
+    auto* stop_gc_allocation_sampling_action = new QAction("Stop Sampling GC Allocations", this);
+    debug_menu->addAction(stop_gc_allocation_sampling_action);
+    QObject::connect(stop_gc_allocation_sampling_action, &QAction::triggered, this, [this] {
+        debug_request("js-allocation-sampler", "stop");
+    });
+
     auto* clear_cache_action = new QAction("Clear &Cache", this);
     clear_cache_action->setIcon(load_icon_from_uri("resource://icons/browser/clear-cache.png"sv));
     debug_menu->addAction(clear_cache_action);
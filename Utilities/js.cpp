@@ -8,9 +8,14 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/Math.h>
 #include <AK/NeverDestroyed.h>
+#include <AK/NumberFormat.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/StandardPaths.h>
@@ -804,12 +809,159 @@ static ErrorOr<int> run_repl(bool gc_on_every_allocation, bool syntax_highlight)
 
 #endif
 
+struct BenchmarkRun {
+    AK::Duration duration;
+    size_t garbage_collections { 0 };
+    u64 allocated_bytes { 0 };
+    u64 inline_cache_misses { 0 };
+    u64 megamorphic_cache_hits { 0 };
+    u64 megamorphic_cache_misses { 0 };
+    OwnPtr<JS::Bytecode::Interpreter::InstructionCounts> instruction_counts;
+};
+
+static ErrorOr<Optional<BenchmarkRun>> run_benchmark_once(StringView source, StringView source_name, bool use_test262_global, bool count_instructions)
+{
+    // NOTE: Every run gets a realm of its own, so that scripts can declare whatever they want at the top level.
+    OwnPtr<JS::ExecutionContext> execution_context;
+    if (use_test262_global)
+        execution_context = JS::create_simple_execution_context<JS::Test262::GlobalObject>(*g_vm);
+    else
+        execution_context = JS::create_simple_execution_context<ScriptObject>(*g_vm);
+    ScopeGuard pop_execution_context = [&] { g_vm->pop_execution_context(); };
+
+    auto& realm = *execution_context->realm;
+    auto& console_object = *realm.intrinsics().console_object();
+    ReplConsoleClient console_client(console_object.console());
+    console_object.console().set_client(console_client);
+
+    auto& heap = g_vm->heap();
+    auto& interpreter = g_vm->bytecode_interpreter();
+    auto& cache_statistics = JS::Bytecode::MegamorphicPropertyLookupCache::the().statistics();
+
+    auto garbage_collections_at_start = heap.collection_count();
+    auto allocated_bytes_at_start = heap.total_allocated_bytes();
+    auto cache_statistics_at_start = cache_statistics;
+
+    if (count_instructions)
+        interpreter.start_counting_instructions();
+
+    auto start = MonotonicTime::now();
+    auto succeeded = TRY(parse_and_run(realm, source, source_name));
+    auto duration = MonotonicTime::now() - start;
+
+    auto instruction_counts = interpreter.stop_counting_instructions();
+
+    if (!succeeded)
+        return OptionalNone {};
+
+    return BenchmarkRun {
+        .duration = duration,
+        .garbage_collections = heap.collection_count() - garbage_collections_at_start,
+        .allocated_bytes = heap.total_allocated_bytes() - allocated_bytes_at_start,
+        .inline_cache_misses = cache_statistics.inline_cache_misses - cache_statistics_at_start.inline_cache_misses,
+        .megamorphic_cache_hits = cache_statistics.hits - cache_statistics_at_start.hits,
+        .megamorphic_cache_misses = cache_statistics.misses - cache_statistics_at_start.misses,
+        .instruction_counts = move(instruction_counts),
+    };
+}
+
+static u64 total_instruction_count(JS::Bytecode::Interpreter::InstructionCounts const& instruction_counts)
+{
+    u64 total = 0;
+    for (auto count : instruction_counts)
+        total += count;
+    return total;
+}
+
+static ErrorOr<int> run_benchmark(StringView source, StringView source_name, size_t warmup_iterations, size_t iterations, bool use_test262_global, bool count_instructions)
+{
+    for (size_t i = 0; i < warmup_iterations; ++i) {
+        if (!TRY(run_benchmark_once(source, source_name, use_test262_global, count_instructions)).has_value())
+            return 1;
+    }
+
+    Vector<BenchmarkRun> runs;
+    for (size_t i = 0; i < iterations; ++i) {
+        auto run = TRY(run_benchmark_once(source, source_name, use_test262_global, count_instructions));
+        if (!run.has_value())
+            return 1;
+
+        outln("Run {}: {:.3}ms, {} GCs, {} allocated, {} inline cache misses, {} megamorphic cache hits, {} megamorphic cache misses",
+            i + 1, run->duration.to_nanoseconds() / 1'000'000.0, run->garbage_collections, human_readable_size(run->allocated_bytes),
+            run->inline_cache_misses, run->megamorphic_cache_hits, run->megamorphic_cache_misses);
+        if (run->instruction_counts)
+            outln("    {} instructions", total_instruction_count(*run->instruction_counts));
+
+        runs.append(run.release_value());
+    }
+
+    if (runs.is_empty())
+        return 0;
+
+    Vector<double> milliseconds;
+    for (auto const& run : runs)
+        milliseconds.append(run.duration.to_nanoseconds() / 1'000'000.0);
+    quick_sort(milliseconds);
+
+    double sum = 0;
+    for (auto value : milliseconds)
+        sum += value;
+    auto mean = sum / milliseconds.size();
+
+    double squared_deviations = 0;
+    for (auto value : milliseconds)
+        squared_deviations += (value - mean) * (value - mean);
+    auto standard_deviation = milliseconds.size() > 1 ? AK::sqrt(squared_deviations / (milliseconds.size() - 1)) : 0.0;
+
+    auto median = milliseconds.size() % 2 == 0
+        ? (milliseconds[milliseconds.size() / 2 - 1] + milliseconds[milliseconds.size() / 2]) / 2
+        : milliseconds[milliseconds.size() / 2];
+
+    outln();
+    outln("{}: {} runs after {} warm-up runs", source_name, runs.size(), warmup_iterations);
+    outln("    Mean:   {:.3}ms ± {:.3}ms", mean, standard_deviation);
+    outln("    Median: {:.3}ms", median);
+    outln("    Min:    {:.3}ms", milliseconds.first());
+    outln("    Max:    {:.3}ms", milliseconds.last());
+
+    if (count_instructions) {
+        JS::Bytecode::Interpreter::InstructionCounts instruction_counts {};
+        for (auto const& run : runs) {
+            for (size_t i = 0; i < instruction_counts.size(); ++i)
+                instruction_counts[i] += (*run.instruction_counts)[i];
+        }
+        auto total = total_instruction_count(instruction_counts);
+
+        Vector<size_t> types;
+        for (size_t i = 0; i < instruction_counts.size(); ++i) {
+            if (instruction_counts[i] != 0)
+                types.append(i);
+        }
+        quick_sort(types, [&](auto a, auto b) { return instruction_counts[a] > instruction_counts[b]; });
+
+        outln();
+        outln("Instructions per run:");
+        for (auto type : types) {
+            outln("    {:40} {:12} ({:.1}%)", JS::Bytecode::Instruction::type_name(static_cast<JS::Bytecode::Instruction::Type>(type)),
+                instruction_counts[type] / runs.size(), static_cast<double>(instruction_counts[type]) * 100.0 / static_cast<double>(total));
+        }
+    }
+
+    return 0;
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     bool gc_on_every_allocation = false;
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool dump_property_cache_statistics = false;
+    bool benchmark = false;
+    size_t benchmark_iterations = 10;
+    size_t benchmark_warmup_iterations = 3;
+    bool benchmark_count_instructions = false;
+    bool profile_bytecode = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -817,6 +969,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(profile_bytecode, "Count how often each bytecode instruction runs and misses its caches, and dump the counts along with the bytecode on exit", "profile-bytecode", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -827,6 +980,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(dump_property_cache_statistics, "Dump property lookup cache statistics on exit", "dump-property-cache-statistics", {});
+    args_parser.add_option(benchmark, "Run the script repeatedly, and report how long it took along with GC and property lookup cache activity", "benchmark", {});
+    args_parser.add_option(benchmark_iterations, "Number of measured benchmark runs (default: 10)", "benchmark-iterations", {}, "count");
+    args_parser.add_option(benchmark_warmup_iterations, "Number of benchmark runs to do before measuring (default: 3)", "benchmark-warmup-iterations", {}, "count");
+    args_parser.add_option(benchmark_count_instructions, "Count the instructions of each type run by the benchmark (slows it down)", "benchmark-count-instructions", {});
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -911,7 +1069,21 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        if (benchmark)
+            return run_benchmark(builder.string_view(), source_name, benchmark_warmup_iterations, benchmark_iterations, use_test262_global, benchmark_count_instructions);
+
+        if (profile_bytecode)
+            g_vm->bytecode_interpreter().start_instruction_profiler();
+
+        auto succeeded = TRY(parse_and_run(realm, builder.string_view(), source_name));
+
+        if (auto profiler = g_vm->bytecode_interpreter().stop_instruction_profiler())
+            warn("{}", profiler->dump());
+
+        if (dump_property_cache_statistics)
+            JS::Bytecode::MegamorphicPropertyLookupCache::the().dump_statistics();
+
+        if (!succeeded)
             return 1;
     }
 